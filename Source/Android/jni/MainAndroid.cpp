@@ -732,16 +732,16 @@ JNIEXPORT jboolean JNICALL Java_org_dolphinemu_dolphinemu_NativeLibrary_ConvertD
     break;
 
   case DiscIO::BlobType::GCZ:
-    success =
-        DiscIO::ConvertToGCZ(blob_reader.get(), in_path, out_path,
-                             platform == DiscIO::Platform::WiiDisc ? 1 : 0, jBlockSize, callback);
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), in_path, out_path,
+                                   platform == DiscIO::Platform::WiiDisc ? 1 : 0, jBlockSize, 0,
+                                   callback);
     break;
 
   case DiscIO::BlobType::WIA:
   case DiscIO::BlobType::RVZ:
     success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), in_path, out_path,
                                         format == DiscIO::BlobType::RVZ, compression,
-                                        jCompressionLevel, jBlockSize, callback);
+                                        jCompressionLevel, jBlockSize, false, 0, callback);
     break;
 
   default:
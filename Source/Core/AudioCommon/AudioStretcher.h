@@ -14,14 +14,20 @@ class AudioStretcher
 public:
   explicit AudioStretcher(unsigned int sample_rate);
   void ProcessSamples(const short* in, unsigned int num_in, unsigned int num_out);
-  void GetStretchedSamples(short* out, unsigned int num_out);
+  // Returns the number of samples that were available; the rest of out is padded.
+  unsigned int GetStretchedSamples(short* out, unsigned int num_out);
   void Clear();
 
+  // Overrides MAIN_AUDIO_STRETCH_LATENCY when non-zero. The backlog is kept about half of this.
+  void SetMaxLatency(double max_latency_ms) { m_max_latency_override = max_latency_ms; }
+  unsigned int GetBacklog() const { return m_sound_touch.numSamples(); }
+
 private:
   unsigned int m_sample_rate;
   std::array<short, 2> m_last_stretched_sample = {};
   soundtouch::SoundTouch m_sound_touch;
   double m_stretch_ratio = 1.0;
+  double m_max_latency_override = 0.0;
 };
 
 }  // namespace AudioCommon
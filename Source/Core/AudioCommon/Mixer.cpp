@@ -8,10 +8,10 @@
 #include <cstring>
 
 #include "AudioCommon/Enums.h"
+#include "AudioCommon/MixerKernels.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
-#include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "VideoCommon/PerformanceMetrics.h"
@@ -102,32 +102,37 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
-  const auto read_buffer = [this](auto index) {
-    return m_little_endian ? m_buffer[index] : Common::swap16(m_buffer[index]);
-  };
-
   // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
+  while (currentSample < numSamples * 2)
   {
-    u32 indexR2 = indexR + 2;  // next sample
-
-    s16 l1 = read_buffer(indexR & INDEX_MASK);   // current
-    s16 l2 = read_buffer(indexR2 & INDEX_MASK);  // next
-    int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
-    sampleL = (sampleL * lvolume) >> 8;
-    sampleL += samples[currentSample + 1];
-    samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
-
-    s16 r1 = read_buffer((indexR + 1) & INDEX_MASK);   // current
-    s16 r2 = read_buffer((indexR2 + 1) & INDEX_MASK);  // next
-    int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
-    sampleR = (sampleR * rvolume) >> 8;
-    sampleR += samples[currentSample];
-    samples[currentSample] = std::clamp(sampleR, -32767, 32767);
-
-    m_frac += ratio;
-    indexR += 2 * (u16)(m_frac >> 16);
-    m_frac &= 0xffff;
+    // Gather the frames to interpolate between, so that the kernel can process several at once.
+    std::array<short, MIX_BATCH_SIZE * 2> current;
+    std::array<short, MIX_BATCH_SIZE * 2> next;
+    std::array<u16, MIX_BATCH_SIZE> frac;
+    u32 num_frames = 0;
+    for (; num_frames < MIX_BATCH_SIZE && currentSample + num_frames * 2 < numSamples * 2 &&
+           ((indexW - indexR) & INDEX_MASK) > 2;
+         ++num_frames)
+    {
+      u32 indexR2 = indexR + 2;  // next sample
+
+      current[num_frames * 2] = m_buffer[indexR & INDEX_MASK];
+      current[num_frames * 2 + 1] = m_buffer[(indexR + 1) & INDEX_MASK];
+      next[num_frames * 2] = m_buffer[indexR2 & INDEX_MASK];
+      next[num_frames * 2 + 1] = m_buffer[(indexR2 + 1) & INDEX_MASK];
+      frac[num_frames] = static_cast<u16>(m_frac);
+
+      m_frac += ratio;
+      indexR += 2 * (u16)(m_frac >> 16);
+      m_frac &= 0xffff;
+    }
+
+    if (num_frames == 0)
+      break;
+
+    AudioCommon::MixInterpolatedFrames(&samples[currentSample], current.data(), next.data(),
+                                       frac.data(), num_frames, lvolume, rvolume);
+    currentSample += num_frames * 2;
   }
 
   // Actual number of samples written to the buffer without padding.
@@ -135,8 +140,8 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
 
   // Padding
   short s[2];
-  s[0] = read_buffer((indexR - 1) & INDEX_MASK);
-  s[1] = read_buffer((indexR - 2) & INDEX_MASK);
+  s[0] = m_buffer[(indexR - 1) & INDEX_MASK];
+  s[1] = m_buffer[(indexR - 2) & INDEX_MASK];
   s[0] = (s[0] * rvolume) >> 8;
   s[1] = (s[1] * lvolume) >> 8;
   for (; currentSample < numSamples * 2; currentSample += 2)
@@ -164,7 +169,15 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   // TODO: Determine how emulation speed will be used in audio
   // const float emulation_speed = g_perf_metrics.GetSpeed();
   const float emulation_speed = m_config_emulation_speed;
-  const int timing_variance = m_config_timing_variance;
+  int timing_variance = m_config_timing_variance;
+  if (m_config_low_latency)
+  {
+    // Let the FIFOs settle just above the target instead of the configured timing variance.
+    m_low_latency_target = std::max(m_low_latency_target, num_samples);
+    timing_variance = static_cast<int>((u64(m_low_latency_target) * 1000 + m_sampleRate - 1) /
+                                       m_sampleRate);
+  }
+
   if (m_config_audio_stretch)
   {
     unsigned int available_samples =
@@ -194,22 +207,81 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
       m_stretcher.Clear();
       m_is_stretching = true;
     }
+    m_stretcher.SetMaxLatency(m_config_low_latency ? timing_variance * 2.0 : 0.0);
     m_stretcher.ProcessSamples(m_scratch_buffer.data(), available_samples, num_samples);
-    m_stretcher.GetStretchedSamples(samples, num_samples);
+    const unsigned int stretched_samples = m_stretcher.GetStretchedSamples(samples, num_samples);
+
+    if (m_config_low_latency)
+    {
+      UpdateLowLatencyTarget(num_samples,
+                             stretched_samples != 0 && stretched_samples < num_samples);
+      UpdateMeasuredLatency(num_samples, m_stretcher.GetBacklog());
+    }
   }
   else
   {
-    m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+    const unsigned int dma_samples =
+        m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
     m_streaming_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
     m_wiimote_speaker_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
     for (auto& mixer : m_gba_mixers)
       mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
     m_is_stretching = false;
+
+    if (m_config_low_latency)
+    {
+      // Running dry in the middle of a callback is an underrun. An empty FIFO just means nothing
+      // is being emulated right now.
+      UpdateLowLatencyTarget(num_samples, dma_samples != 0 && dma_samples < num_samples);
+      UpdateMeasuredLatency(num_samples, m_dma_mixer.AvailableSamples());
+    }
   }
 
   return num_samples;
 }
 
+void Mixer::UpdateLowLatencyTarget(unsigned int num_samples, bool underrun)
+{
+  const u32 max_target = std::max(num_samples, m_sampleRate * MAX_LOW_LATENCY_TARGET_MS / 1000);
+
+  if (underrun)
+  {
+    m_samples_since_underrun = 0;
+    m_low_latency_target = std::min(m_low_latency_target + num_samples, max_target);
+    INFO_LOG_FMT(AUDIO, "Audio underrun, raising target latency to {} frames",
+                 m_low_latency_target);
+    return;
+  }
+
+  // Give back a quarter of a period for every second without an underrun.
+  m_samples_since_underrun += num_samples;
+  if (m_samples_since_underrun >= m_sampleRate)
+  {
+    m_samples_since_underrun = 0;
+    const u32 step = std::min(m_low_latency_target - num_samples, std::max(num_samples / 4, 1u));
+    m_low_latency_target = std::min(m_low_latency_target - step, max_target);
+  }
+}
+
+void Mixer::UpdateMeasuredLatency(unsigned int num_samples, unsigned int backlog)
+{
+  // The samples still queued here and the period that is being handed over.
+  m_measured_latency.store(backlog + num_samples);
+
+  m_samples_since_report += num_samples;
+  if (m_samples_since_report >= m_sampleRate * 5)
+  {
+    m_samples_since_report = 0;
+    INFO_LOG_FMT(AUDIO, "Audio latency: {:.1f} ms (target {:.1f} ms)", GetMeasuredLatency(),
+                 m_low_latency_target * 1000.0f / m_sampleRate);
+  }
+}
+
+float Mixer::GetMeasuredLatency() const
+{
+  return m_measured_latency.load() * 1000.0f / m_sampleRate;
+}
+
 unsigned int Mixer::MixSurround(float* samples, unsigned int num_samples)
 {
   if (!num_samples)
@@ -254,22 +326,27 @@ void Mixer::MixerFifo::PushSamples(const short* samples, unsigned int num_sample
   // AyuanX: Actual re-sampling work has been moved to sound thread
   // to alleviate the workload on main thread
   // and we simply store raw data here to make fast mem copy
-  int over_bytes = num_samples * 4 - (MAX_SAMPLES * 2 - (indexW & INDEX_MASK)) * sizeof(short);
-  if (over_bytes > 0)
-  {
-    memcpy(&m_buffer[indexW & INDEX_MASK], samples, num_samples * 4 - over_bytes);
-    memcpy(&m_buffer[0], samples + (num_samples * 4 - over_bytes) / sizeof(short), over_bytes);
-  }
-  else
-  {
-    memcpy(&m_buffer[indexW & INDEX_MASK], samples, num_samples * 4);
-  }
+  const u32 count = num_samples * 2;
+  const u32 count_before_wrap = std::min(count, MAX_SAMPLES * 2 - (indexW & INDEX_MASK));
+  CopyToBuffer(&m_buffer[indexW & INDEX_MASK], samples, count_before_wrap);
+  CopyToBuffer(&m_buffer[0], samples + count_before_wrap, count - count_before_wrap);
 
   m_indexW.fetch_add(num_samples * 2);
 }
 
+void Mixer::MixerFifo::CopyToBuffer(short* dst, const short* src, u32 count) const
+{
+  if (m_little_endian)
+    std::copy_n(src, count, dst);
+  else
+    AudioCommon::ByteSwapSamples(dst, src, count);
+}
+
 void Mixer::PushSamples(const short* samples, unsigned int num_samples)
 {
+  if (m_discard_samples.load(std::memory_order_relaxed))
+    return;
+
   m_dma_mixer.PushSamples(samples, num_samples);
   if (m_log_dsp_audio)
   {
@@ -282,6 +359,9 @@ void Mixer::PushSamples(const short* samples, unsigned int num_samples)
 
 void Mixer::PushStreamingSamples(const short* samples, unsigned int num_samples)
 {
+  if (m_discard_samples.load(std::memory_order_relaxed))
+    return;
+
   m_streaming_mixer.PushSamples(samples, num_samples);
   if (m_log_dtk_audio)
   {
@@ -295,6 +375,9 @@ void Mixer::PushStreamingSamples(const short* samples, unsigned int num_samples)
 void Mixer::PushWiimoteSpeakerSamples(const short* samples, unsigned int num_samples,
                                       unsigned int sample_rate_divisor)
 {
+  if (m_discard_samples.load(std::memory_order_relaxed))
+    return;
+
   // Max 20 bytes/speaker report, may be 4-bit ADPCM so multiply by 2
   static constexpr u32 MAX_SPEAKER_SAMPLES = 20 * 2;
   std::array<short, MAX_SPEAKER_SAMPLES * 2> samples_stereo;
@@ -318,6 +401,9 @@ void Mixer::PushWiimoteSpeakerSamples(const short* samples, unsigned int num_sam
 
 void Mixer::PushGBASamples(int device_number, const short* samples, unsigned int num_samples)
 {
+  if (m_discard_samples.load(std::memory_order_relaxed))
+    return;
+
   m_gba_mixers[device_number].PushSamples(samples, num_samples);
 }
 
@@ -430,6 +516,7 @@ void Mixer::RefreshConfig()
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_timing_variance = Config::Get(Config::MAIN_TIMING_VARIANCE);
   m_config_audio_stretch = Config::Get(Config::MAIN_AUDIO_STRETCH);
+  m_config_low_latency = Config::Get(Config::MAIN_AUDIO_LOW_LATENCY);
 }
 
 void Mixer::MixerFifo::DoState(PointerWrap& p)
@@ -32,8 +32,15 @@ public:
                                  unsigned int sample_rate_divisor);
   void PushGBASamples(int device_number, const short* samples, unsigned int num_samples);
 
+  // While set, pushed samples are dropped instead of being played or dumped. Used for emulation
+  // that is going to be rolled back.
+  void SetDiscardingSamples(bool discard) { m_discard_samples.store(discard); }
+
   unsigned int GetSampleRate() const { return m_sampleRate; }
 
+  // Estimated time from a sample being pushed until it is handed to the backend, in milliseconds.
+  float GetMeasuredLatency() const;
+
   void SetDMAInputSampleRateDivisor(unsigned int rate_divisor);
   void SetStreamInputSampleRateDivisor(unsigned int rate_divisor);
   void SetGBAInputSampleRateDivisors(int device_number, unsigned int rate_divisor);
@@ -57,6 +64,8 @@ private:
   static constexpr int MAX_FREQ_SHIFT = 200;  // Per 32000 Hz
   static constexpr float CONTROL_FACTOR = 0.2f;
   static constexpr u32 CONTROL_AVG = 32;  // In freq_shift per FIFO size offset
+  // Upper bound for the queued audio in low latency mode.
+  static constexpr u32 MAX_LOW_LATENCY_TARGET_MS = 60;
 
   const unsigned int SURROUND_CHANNELS = 6;
 
@@ -79,12 +88,19 @@ private:
     unsigned int AvailableSamples() const;
 
   private:
+    // Frames handed to the mixing kernel at once.
+    static constexpr u32 MIX_BATCH_SIZE = 64;
+
+    void CopyToBuffer(short* dst, const short* src, u32 count) const;
+
     Mixer* m_mixer;
     unsigned m_input_sample_rate_divisor;
     bool m_little_endian;
+    // Always holds host endian samples; big endian input is swapped when it's pushed.
     std::array<short, MAX_SAMPLES * 2> m_buffer{};
-    std::atomic<u32> m_indexW{0};
-    std::atomic<u32> m_indexR{0};
+    // Written by different threads, so kept on separate cache lines.
+    alignas(64) std::atomic<u32> m_indexW{0};
+    alignas(64) std::atomic<u32> m_indexR{0};
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
     std::atomic<s32> m_RVolume{256};
@@ -93,6 +109,10 @@ private:
   };
 
   void RefreshConfig();
+  // Low latency mode sizes the queued audio to the device period: it starts at one period, grows
+  // by a period after every underrun and shrinks back slowly while playback stays clean.
+  void UpdateLowLatencyTarget(unsigned int num_samples, bool underrun);
+  void UpdateMeasuredLatency(unsigned int num_samples, unsigned int backlog);
 
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
   MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, false};
@@ -108,6 +128,12 @@ private:
   AudioCommon::SurroundDecoder m_surround_decoder;
   std::array<short, MAX_SAMPLES * 2> m_scratch_buffer{};
 
+  u32 m_low_latency_target = 0;
+  u32 m_samples_since_underrun = 0;
+  u32 m_samples_since_report = 0;
+  std::atomic<u32> m_measured_latency{0};
+  std::atomic<bool> m_discard_samples{false};
+
   WaveFileWriter m_wave_writer_dtk;
   WaveFileWriter m_wave_writer_dsp;
 
@@ -117,6 +143,7 @@ private:
   float m_config_emulation_speed;
   int m_config_timing_variance;
   bool m_config_audio_stretch;
+  bool m_config_low_latency;
 
   size_t m_config_changed_callback_id;
 };
@@ -0,0 +1,114 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/MixerKernels.h"
+
+#include <algorithm>
+
+#include "Common/Swap.h"
+
+#if defined(_M_X86) || defined(_M_X86_64)
+#define USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace AudioCommon
+{
+namespace
+{
+s16 MixSample(s16 existing, s16 current, s16 next, u16 frac, s32 volume)
+{
+  // Computed with unsigned arithmetic so that large steps between samples wrap around the same
+  // way as in the vector versions.
+  s32 sample = static_cast<s32>((u32(current) << 16) + u32(next - current) * frac) >> 16;
+  sample = (sample * volume) >> 8;
+  return static_cast<s16>(std::clamp(sample + existing, -32767, 32767));
+}
+
+#if defined(USE_SSE)
+// Computes the 32-bit products of signed samples and unsigned factors.
+void MultiplyUnsigned(__m128i samples, __m128i factors, __m128i* lo, __m128i* hi)
+{
+  // _mm_mulhi_epi16 treats factors >= 0x8000 as negative, which is off by samples << 16.
+  const __m128i correction = _mm_and_si128(samples, _mm_srai_epi16(factors, 15));
+  const __m128i prod_lo = _mm_mullo_epi16(samples, factors);
+  const __m128i prod_hi = _mm_add_epi16(_mm_mulhi_epi16(samples, factors), correction);
+  *lo = _mm_unpacklo_epi16(prod_lo, prod_hi);
+  *hi = _mm_unpackhi_epi16(prod_lo, prod_hi);
+}
+
+__m128i SwapChannels(__m128i frames)
+{
+  return _mm_shufflehi_epi16(_mm_shufflelo_epi16(frames, 0xB1), 0xB1);
+}
+#endif
+}  // namespace
+
+void ByteSwapSamples(s16* dst, const s16* src, u32 count)
+{
+  u32 i = 0;
+
+#if defined(USE_SSE)
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i swapped = _mm_or_si128(_mm_slli_epi16(samples, 8), _mm_srli_epi16(samples, 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), swapped);
+  }
+#endif
+
+  for (; i < count; ++i)
+    dst[i] = static_cast<s16>(Common::swap16(static_cast<u16>(src[i])));
+}
+
+void MixInterpolatedFrames(s16* out, const s16* current, const s16* next, const u16* frac,
+                           u32 num_frames, s32 lvolume, s32 rvolume)
+{
+  u32 i = 0;
+
+#if defined(USE_SSE)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i volumes = _mm_setr_epi16(s16(rvolume), s16(lvolume), s16(rvolume), s16(lvolume),
+                                         s16(rvolume), s16(lvolume), s16(rvolume), s16(lvolume));
+  for (; i + 4 <= num_frames; i += 4)
+  {
+    const __m128i curr =
+        SwapChannels(_mm_loadu_si128(reinterpret_cast<const __m128i*>(current + i * 2)));
+    const __m128i nxt =
+        SwapChannels(_mm_loadu_si128(reinterpret_cast<const __m128i*>(next + i * 2)));
+    const __m128i frac4 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(frac + i));
+    const __m128i f = _mm_unpacklo_epi16(frac4, frac4);
+
+    // ((current << 16) + (next - current) * frac) >> 16
+    __m128i curr_lo, curr_hi, next_lo, next_hi;
+    MultiplyUnsigned(curr, f, &curr_lo, &curr_hi);
+    MultiplyUnsigned(nxt, f, &next_lo, &next_hi);
+    const __m128i lo =
+        _mm_add_epi32(_mm_unpacklo_epi16(zero, curr), _mm_sub_epi32(next_lo, curr_lo));
+    const __m128i hi =
+        _mm_add_epi32(_mm_unpackhi_epi16(zero, curr), _mm_sub_epi32(next_hi, curr_hi));
+    const __m128i interpolated = _mm_packs_epi32(_mm_srai_epi32(lo, 16), _mm_srai_epi32(hi, 16));
+
+    const __m128i prod_lo = _mm_mullo_epi16(interpolated, volumes);
+    const __m128i prod_hi = _mm_mulhi_epi16(interpolated, volumes);
+    const __m128i existing = _mm_loadu_si128(reinterpret_cast<const __m128i*>(out + i * 2));
+    const __m128i mixed_lo =
+        _mm_add_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(prod_lo, prod_hi), 8),
+                      _mm_srai_epi32(_mm_unpacklo_epi16(existing, existing), 16));
+    const __m128i mixed_hi =
+        _mm_add_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(prod_lo, prod_hi), 8),
+                      _mm_srai_epi32(_mm_unpackhi_epi16(existing, existing), 16));
+
+    const __m128i mixed =
+        _mm_max_epi16(_mm_packs_epi32(mixed_lo, mixed_hi), _mm_set1_epi16(-32767));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2), mixed);
+  }
+#endif
+
+  for (; i < num_frames; ++i)
+  {
+    out[i * 2 + 1] = MixSample(out[i * 2 + 1], current[i * 2], next[i * 2], frac[i], lvolume);
+    out[i * 2] = MixSample(out[i * 2], current[i * 2 + 1], next[i * 2 + 1], frac[i], rvolume);
+  }
+}
+}  // namespace AudioCommon
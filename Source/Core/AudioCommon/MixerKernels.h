@@ -0,0 +1,22 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Sample processing kernels used by the Mixer. Several samples are handled at once where the host
+// supports it, with results identical to processing one sample at a time.
+namespace AudioCommon
+{
+// Copies count samples from src to dst, swapping the byte order of each one.
+void ByteSwapSamples(s16* dst, const s16* src, u32 count);
+
+// Linearly interpolates num_frames stereo frames, scales them by the channel volumes (0 to 256)
+// and adds them to out, saturating to [-32767, 32767].
+//
+// current and next hold the (left, right) input frames to interpolate between, and frac the 0.16
+// fixed point position between them. Note that the frames in out are stored as (right, left).
+void MixInterpolatedFrames(s16* out, const s16* current, const s16* next, const u16* frac,
+                           u32 num_frames, s32 lvolume, s32 rvolume);
+}  // namespace AudioCommon
@@ -41,6 +41,7 @@ PulseAudio::~PulseAudio()
 void PulseAudio::SoundLoop()
 {
   Common::SetCurrentThreadName("Audio thread - pulse");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
 
   if (PulseInit())
   {
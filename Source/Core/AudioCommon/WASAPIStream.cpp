@@ -319,6 +319,7 @@ bool WASAPIStream::SetRunning(bool running)
 void WASAPIStream::SoundLoop()
 {
   Common::SetCurrentThreadName("WASAPI Handler");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
   BYTE* data;
 
   m_audio_renderer->GetBuffer(m_frames_in_buffer, &data);
@@ -3249,6 +3249,14 @@ void ARM64FloatEmitter::UCVTF(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale)
 {
   EmitShiftImm(IsQuad(Rd), 1, size * 2 - scale, 0x1C, Rd, Rn);
 }
+void ARM64FloatEmitter::FCVTZS(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale)
+{
+  EmitShiftImm(IsQuad(Rd), 0, size * 2 - scale, 0x1F, Rd, Rn);
+}
+void ARM64FloatEmitter::FCVTZU(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale)
+{
+  EmitShiftImm(IsQuad(Rd), 1, size * 2 - scale, 0x1F, Rd, Rn);
+}
 void ARM64FloatEmitter::SQXTN(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn)
 {
   Emit2RegMisc(false, 0, dest_size >> 4, 0b10100, Rd, Rn);
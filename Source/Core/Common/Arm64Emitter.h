@@ -1196,6 +1196,8 @@ public:
   void UCVTF(u8 size, ARM64Reg Rd, ARM64Reg Rn);
   void SCVTF(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale);
   void UCVTF(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale);
+  void FCVTZS(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale);
+  void FCVTZU(u8 size, ARM64Reg Rd, ARM64Reg Rn, int scale);
   void SQXTN(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn);
   void SQXTN2(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn);
   void UQXTN(u8 dest_size, ARM64Reg Rd, ARM64Reg Rn);
@@ -0,0 +1,149 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/AsyncFileReader.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "Common/Assert.h"
+#include "Common/IOFile.h"
+#include "Common/Thread.h"
+
+namespace File
+{
+AsyncFileReader::AsyncFileReader(IOFile& file, u32 max_in_flight)
+    : m_max_in_flight(std::max<u32>(max_in_flight, 1))
+{
+  ASSERT(file.IsOpen());
+#ifdef _WIN32
+  m_handle = reinterpret_cast<void*>(_get_osfhandle(_fileno(file.GetHandle())));
+#else
+  m_fd = fileno(file.GetHandle());
+#endif
+}
+
+AsyncFileReader::~AsyncFileReader()
+{
+  {
+    std::lock_guard lk(m_mutex);
+    m_exiting = true;
+  }
+  m_request_cv.notify_all();
+
+  for (std::thread& worker : m_workers)
+    worker.join();
+}
+
+bool AsyncFileReader::ReadAt(u64 offset, u64 size, u8* out_ptr) const
+{
+  while (size > 0)
+  {
+#ifdef _WIN32
+    // With an OVERLAPPED structure, ReadFile reads at the given offset even when the handle
+    // wasn't opened for overlapped I/O. It does update the file pointer in that case, and the
+    // system serializes reads on such a handle, but the worker threads still let the caller
+    // carry on while a read is outstanding.
+    const DWORD chunk_size =
+        static_cast<DWORD>(std::min<u64>(size, std::numeric_limits<DWORD>::max()));
+    OVERLAPPED overlapped{};
+    overlapped.Offset = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD bytes_read = 0;
+    if (!ReadFile(static_cast<HANDLE>(m_handle), out_ptr, chunk_size, &bytes_read, &overlapped) ||
+        bytes_read == 0)
+    {
+      return false;
+    }
+#else
+    const size_t chunk_size =
+        static_cast<size_t>(std::min<u64>(size, std::numeric_limits<ssize_t>::max()));
+    const ssize_t bytes_read = pread(m_fd, out_ptr, chunk_size, static_cast<off_t>(offset));
+    if (bytes_read < 0 && errno == EINTR)
+      continue;
+    if (bytes_read <= 0)
+      return false;
+#endif
+
+    offset += bytes_read;
+    size -= bytes_read;
+    out_ptr += bytes_read;
+  }
+
+  return true;
+}
+
+AsyncFileReader::RequestID AsyncFileReader::Submit(u64 offset, u64 size, u8* out_ptr)
+{
+  RequestID id;
+  {
+    std::lock_guard lk(m_mutex);
+    id = m_next_id++;
+    m_pending.push_back(Request{id, offset, size, out_ptr});
+
+    // Workers are only started once needed, since most readers never submit anything
+    if (m_workers.size() < m_max_in_flight)
+      m_workers.emplace_back(&AsyncFileReader::WorkerThread, this);
+  }
+  m_request_cv.notify_one();
+  return id;
+}
+
+bool AsyncFileReader::Wait(RequestID id)
+{
+  std::unique_lock lk(m_mutex);
+
+  const auto pending = std::find_if(m_pending.begin(), m_pending.end(),
+                                    [id](const Request& request) { return request.id == id; });
+  if (pending != m_pending.end())
+  {
+    const Request request = *pending;
+    m_pending.erase(pending);
+    lk.unlock();
+    return ReadAt(request.offset, request.size, request.out_ptr);
+  }
+
+  m_done_cv.wait(lk, [this, id] { return m_done.contains(id); });
+  const auto it = m_done.find(id);
+  const bool success = it->second;
+  m_done.erase(it);
+  return success;
+}
+
+bool AsyncFileReader::IsDone(RequestID id) const
+{
+  std::lock_guard lk(m_mutex);
+  return m_done.contains(id);
+}
+
+void AsyncFileReader::WorkerThread()
+{
+  Common::SetCurrentThreadName("Async file reader");
+
+  std::unique_lock lk(m_mutex);
+  while (true)
+  {
+    m_request_cv.wait(lk, [this] { return m_exiting || !m_pending.empty(); });
+    if (m_exiting)
+      return;
+
+    const Request request = m_pending.front();
+    m_pending.pop_front();
+
+    lk.unlock();
+    const bool success = ReadAt(request.offset, request.size, request.out_ptr);
+    lk.lock();
+
+    m_done.emplace(request.id, success);
+    m_done_cv.notify_all();
+  }
+}
+}  // namespace File
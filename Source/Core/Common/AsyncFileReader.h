@@ -0,0 +1,77 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+class IOFile;
+
+// Reads from a file at arbitrary offsets without using or moving the file position, either
+// directly or on a small pool of worker threads, so that several reads can be in flight at once.
+// On high-latency storage (network shares in particular) this lets the requests overlap instead
+// of paying the full round trip for each one in turn.
+//
+// The file must stay open for as long as the reader exists. Reads which use the file position
+// (IOFile::Seek/ReadBytes) must not be mixed with this, since not every platform's positional
+// read leaves the file position alone.
+class AsyncFileReader final
+{
+public:
+  using RequestID = u64;
+
+  AsyncFileReader(IOFile& file, u32 max_in_flight);
+  ~AsyncFileReader();
+
+  AsyncFileReader(const AsyncFileReader&) = delete;
+  AsyncFileReader& operator=(const AsyncFileReader&) = delete;
+
+  bool ReadAt(u64 offset, u64 size, u8* out_ptr) const;
+
+  // Queues a read. out_ptr must stay valid until Wait has been called for the returned ID,
+  // which must happen exactly once per request.
+  RequestID Submit(u64 offset, u64 size, u8* out_ptr);
+  // Returns whether the read succeeded. A request which hasn't been started yet is read on the
+  // calling thread instead of waiting for a worker to pick it up.
+  bool Wait(RequestID id);
+  bool IsDone(RequestID id) const;
+
+private:
+  struct Request
+  {
+    RequestID id;
+    u64 offset;
+    u64 size;
+    u8* out_ptr;
+  };
+
+  void WorkerThread();
+
+#ifdef _WIN32
+  void* m_handle;
+#else
+  int m_fd;
+#endif
+
+  u32 m_max_in_flight;
+  RequestID m_next_id = 0;
+  std::vector<std::thread> m_workers;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_request_cv;
+  std::condition_variable m_done_cv;
+  std::deque<Request> m_pending;
+  std::map<RequestID, bool> m_done;
+  bool m_exiting = false;
+};
+}  // namespace File
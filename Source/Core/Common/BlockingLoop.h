@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <thread>
 
+#include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
 
@@ -28,6 +31,17 @@ public:
     kBlockAndGiveUp,
   };
 
+  struct WakeupStatistics
+  {
+    // Wakeups that arrived while the worker was still spinning, and so needed no event.
+    u64 spin_wakeups = 0;
+    // Wakeups that had to signal the sleeping worker.
+    u64 event_wakeups = 0;
+    // Time from Wakeup() until the worker noticed it, over both kinds of wakeups.
+    u64 total_latency_ns = 0;
+    u64 max_latency_ns = 0;
+  };
+
   BlockingLoop() { m_stopped.Set(); }
   ~BlockingLoop() { Stop(kBlockAndGiveUp); }
   // Triggers to rerun the payload of the Run() function at least once again.
@@ -41,7 +55,10 @@ public:
 
     // Mark that new data is available. If the old state will rerun the payload
     // itself, we don't have to set the event to interrupt the worker.
-    if (m_running_state.exchange(STATE_NEED_EXECUTION) != STATE_SLEEPING)
+    const int old_state = m_running_state.exchange(STATE_NEED_EXECUTION);
+    if (old_state <= STATE_DONE)
+      m_wakeup_time.store(Now(), std::memory_order_relaxed);
+    if (old_state != STATE_SLEEPING)
       return;
 
     // Else as the worker thread may sleep now, we have to set the event.
@@ -164,6 +181,13 @@ public:
         // loop.
         if (m_may_sleep.TestAndClear())
         {
+          // Poll a little before sleeping, as waking up through the event is much slower.
+          if (SpinForWakeup())
+          {
+            m_may_sleep.Set();
+            break;
+          }
+
           // Try to set the sleeping state.
           if (m_running_state-- != STATE_DONE)
             break;
@@ -185,6 +209,8 @@ public:
         {
           m_new_work_event.Wait();
         }
+        if (m_running_state.load() == STATE_NEED_EXECUTION)
+          RecordWakeup(m_event_wakeups);
         break;
       }
     }
@@ -232,7 +258,65 @@ public:
   // that we will fall back from the busy loop to sleeping.
   void AllowSleep() { m_may_sleep.Set(); }
 
+  // Lets the worker poll for new work for up to this long before it goes to sleep. The actual
+  // spin time adapts to how often recent spins were cut short by a Wakeup() call.
+  // Zero, the default, makes the worker sleep right away.
+  void SetMaxSpinTime(std::chrono::microseconds time) { m_max_spin_time.store(time.count()); }
+
+  WakeupStatistics GetWakeupStatistics() const
+  {
+    WakeupStatistics stats;
+    stats.spin_wakeups = m_spin_wakeups.load(std::memory_order_relaxed);
+    stats.event_wakeups = m_event_wakeups.load(std::memory_order_relaxed);
+    stats.total_latency_ns = m_total_wakeup_latency.load(std::memory_order_relaxed);
+    stats.max_latency_ns = m_max_wakeup_latency.load(std::memory_order_relaxed);
+    return stats;
+  }
+
 private:
+  static s64 Now()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  // Returns true if Wakeup() was called while spinning.
+  bool SpinForWakeup()
+  {
+    const s64 max_spin_time = m_max_spin_time.load(std::memory_order_relaxed);
+    if (max_spin_time <= 0)
+      return false;
+
+    const s64 min_spin_time = std::max<s64>(max_spin_time / 16, 1);
+    m_spin_time = std::clamp(m_spin_time, min_spin_time, max_spin_time);
+    const s64 deadline = Now() + m_spin_time * 1000;
+    do
+    {
+      if (m_running_state.load() != STATE_DONE)
+      {
+        // Worth spinning for, so try a bit longer next time.
+        m_spin_time = std::min(m_spin_time * 2, max_spin_time);
+        RecordWakeup(m_spin_wakeups);
+        return true;
+      }
+      std::this_thread::yield();
+    } while (Now() < deadline);
+
+    m_spin_time = std::max(m_spin_time / 2, min_spin_time);
+    return false;
+  }
+
+  void RecordWakeup(std::atomic<u64>& counter)
+  {
+    const s64 latency = std::max<s64>(Now() - m_wakeup_time.load(std::memory_order_relaxed), 0);
+    counter.fetch_add(1, std::memory_order_relaxed);
+    m_total_wakeup_latency.fetch_add(latency, std::memory_order_relaxed);
+    if (static_cast<u64>(latency) > m_max_wakeup_latency.load(std::memory_order_relaxed))
+      m_max_wakeup_latency.store(latency, std::memory_order_relaxed);
+  }
+
+
   std::mutex m_wait_lock;
   std::mutex m_prepare_lock;
 
@@ -253,5 +337,14 @@ private:
 
   Flag m_may_sleep;  // If this is set, we fall back from the busy loop to an event based
                      // synchronization.
+
+  std::atomic<s64> m_max_spin_time = 0;  // In microseconds
+  s64 m_spin_time = 0;                   // Only touched by the worker thread
+
+  std::atomic<s64> m_wakeup_time = 0;
+  std::atomic<u64> m_spin_wakeups = 0;
+  std::atomic<u64> m_event_wakeups = 0;
+  std::atomic<u64> m_total_wakeup_latency = 0;
+  std::atomic<u64> m_max_wakeup_latency = 0;
 };
 }  // namespace Common
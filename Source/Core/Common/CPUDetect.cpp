@@ -0,0 +1,139 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/CPUDetect.h"
+
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+
+namespace
+{
+// Logical processors grouped by how fast their cores are, with the fastest last.
+using CoreClasses = std::map<u64, u64>;
+
+#if defined(__linux__)
+// Parses a CPU list from sysfs, like "0-7,16,18".
+u64 ParseCPUList(const std::string& list)
+{
+  u64 mask = 0;
+  for (const std::string& range : SplitString(std::string(StripWhitespace(list)), ','))
+  {
+    const size_t dash = range.find('-');
+    u32 first;
+    u32 last;
+    if (!TryParse(range.substr(0, dash), &first))
+      continue;
+    if (dash == std::string::npos)
+      last = first;
+    else if (!TryParse(range.substr(dash + 1), &last))
+      continue;
+
+    for (u32 i = first; i <= last && i < 64; ++i)
+      mask |= u64(1) << i;
+  }
+  return mask;
+}
+
+bool ReadSysfsValue(const std::string& path, std::string* value)
+{
+  if (!File::ReadFileToString(path, *value))
+    return false;
+  *value = std::string(StripWhitespace(*value));
+  return !value->empty();
+}
+
+CoreClasses GetCoreClasses()
+{
+  CoreClasses classes;
+
+  // Intel hybrid CPUs have a separate PMU for each kind of core, which lists its processors.
+  std::string core_cpus;
+  std::string atom_cpus;
+  if (ReadSysfsValue("/sys/devices/cpu_core/cpus", &core_cpus) &&
+      ReadSysfsValue("/sys/devices/cpu_atom/cpus", &atom_cpus))
+  {
+    classes[0] = ParseCPUList(atom_cpus);
+    classes[1] = ParseCPUList(core_cpus);
+    return classes;
+  }
+
+  // Elsewhere, like on big.LITTLE ARM CPUs, tell the cores apart by their capacity as seen by the
+  // scheduler. Maximum clock speeds aren't used, as they also differ between the favored cores of
+  // CPUs that aren't hybrid.
+  for (u32 i = 0; i < 64; ++i)
+  {
+    std::string value;
+    u64 capacity;
+    if (ReadSysfsValue(fmt::format("/sys/devices/system/cpu/cpu{}/cpu_capacity", i), &value) &&
+        TryParse(value, &capacity))
+    {
+      classes[capacity] |= u64(1) << i;
+    }
+  }
+  return classes;
+}
+#elif defined(_WIN32)
+CoreClasses GetCoreClasses()
+{
+  CoreClasses classes;
+
+  DWORD length = 0;
+  GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &length);
+  std::vector<u8> buffer(length);
+  if (length == 0 || !GetLogicalProcessorInformationEx(
+                         RelationProcessorCore,
+                         reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()),
+                         &length))
+  {
+    return classes;
+  }
+
+  for (DWORD offset = 0; offset < length;)
+  {
+    const auto* info =
+        reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+    // Thread affinity masks only cover the processor group of the thread, which is the first one
+    // unless there are more than 64 logical processors.
+    const GROUP_AFFINITY& group = info->Processor.GroupMask[0];
+    if (group.Group == 0)
+      classes[info->Processor.EfficiencyClass] |= group.Mask;
+    offset += info->Size;
+  }
+  return classes;
+}
+#endif
+}  // namespace
+
+void CPUInfo::DetectCoreTypes()
+{
+#if defined(__APPLE__)
+  // The kernel decides which cores a thread runs on from its QoS class, so there are no masks.
+  int perf_levels = 0;
+  size_t size = sizeof(perf_levels);
+  if (sysctlbyname("hw.nperflevels", &perf_levels, &size, nullptr, 0) == 0)
+    bHybrid = perf_levels > 1;
+#elif defined(__linux__) || defined(_WIN32)
+  const CoreClasses classes = GetCoreClasses();
+  if (classes.size() < 2)
+    return;
+
+  performance_core_mask = classes.rbegin()->second;
+  for (auto it = classes.begin(); it != std::prev(classes.end()); ++it)
+    efficiency_core_mask |= it->second;
+  bHybrid = performance_core_mask != 0 && efficiency_core_mask != 0;
+#endif
+}
@@ -6,6 +6,8 @@
 
 #include <string>
 
+#include "Common/CommonTypes.h"
+
 enum class CPUVendor
 {
   Intel,
@@ -24,6 +26,13 @@ struct CPUInfo
   bool HTT = false;
   int num_cores = 0;
 
+  // Hybrid CPUs, like Alder Lake or Apple Silicon, have both performance and efficiency cores.
+  bool bHybrid = false;
+  // One bit for each of the first 64 logical processors that is a performance or efficiency core
+  // on a hybrid CPU. Both are 0 where threads can't be pinned to processors, like on macOS.
+  u64 performance_core_mask = 0;
+  u64 efficiency_core_mask = 0;
+
   bool bSSE3 = false;
   bool bSSSE3 = false;
   bool bSSE4_1 = false;
@@ -63,6 +72,8 @@ struct CPUInfo
 
 private:
   void Detect();
+  // Sets bHybrid and the core masks. Implemented per OS rather than per architecture.
+  void DetectCoreTypes();
 };
 
 extern CPUInfo cpu_info;
@@ -119,6 +119,7 @@ void FileInfo::AndroidContentInit(const std::string& path)
   m_exists = result != -1;
   m_stat.st_mode = result == -2 ? S_IFDIR : S_IFREG;
   m_stat.st_size = result >= 0 ? result : 0;
+  m_stat.st_mtime = 0;
 }
 #endif
 
@@ -142,6 +143,11 @@ u64 FileInfo::GetSize() const
   return IsFile() ? m_stat.st_size : 0;
 }
 
+s64 FileInfo::GetModificationTime() const
+{
+  return m_exists ? static_cast<s64>(m_stat.st_mtime) : 0;
+}
+
 // Returns true if the path exists
 bool Exists(const std::string& path)
 {
@@ -548,6 +554,7 @@ FSTEntry ScanDirectoryTree(std::string directory, bool recursive)
     {
       entry.size = file_info.GetSize();
     }
+    entry.modificationTime = file_info.GetModificationTime();
     entry.virtualName = virtual_name;
     entry.physicalName = physical_name;
 
@@ -94,6 +94,7 @@ struct FSTEntry
 {
   bool isDirectory = false;
   u64 size = 0;              // File length, or for directories, recursive count of children
+  s64 modificationTime = 0;  // Seconds since the Unix epoch, or 0 if unknown
   std::string physicalName;  // Name on disk
   std::string virtualName;   // Name in FST names table
   std::vector<FSTEntry> children;
@@ -118,6 +119,9 @@ public:
   bool IsFile() const;
   // Returns the size of a file (or returns 0 if the path doesn't refer to a file)
   u64 GetSize() const;
+  // Returns the last modification time in seconds since the Unix epoch (or returns 0 if the path
+  // doesn't exist or the time isn't known)
+  s64 GetModificationTime() const;
 
 private:
 #ifdef ANDROID
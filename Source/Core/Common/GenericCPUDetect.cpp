@@ -7,6 +7,7 @@ CPUInfo cpu_info;
 
 CPUInfo::CPUInfo()
 {
+  DetectCoreTypes();
 }
 
 std::string CPUInfo::Summarize()
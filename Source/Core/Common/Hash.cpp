@@ -4,9 +4,12 @@
 #include "Common/Hash.h"
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cstring>
 
+#define XXH_STATIC_LINKING_ONLY
+#include <xxhash.h>
 #include <zlib.h>
 
 #include "Common/BitUtils.h"
@@ -451,6 +454,36 @@ u64 GetHash64(const u8* src, u32 len, u32 samples)
   return s_texture_hash_func(src, len, samples);
 }
 
+u64 GetXXH3Hash64(const u8* src, u32 len, u32 samples)
+{
+  // XXH3 is fast enough that gathering samples is only worth it when it skips most of the data.
+  const u32 num_words = len / 8;
+  if (samples == 0 || samples >= num_words / 2)
+    return XXH3_64bits_withSeed(src, len, len);
+
+  // Hash the same u64 words GetHash64 samples, plus the trailing bytes.
+  const u32 step = num_words / samples;
+  XXH3_state_t state;
+  XXH3_INITSTATE(&state);
+  XXH3_64bits_reset_withSeed(&state, len);
+
+  std::array<u64, 64> buffer;
+  size_t buffered = 0;
+  for (u32 i = 0; i < num_words; i += step)
+  {
+    std::memcpy(&buffer[buffered++], src + i * sizeof(u64), sizeof(u64));
+    if (buffered == buffer.size())
+    {
+      XXH3_64bits_update(&state, buffer.data(), sizeof(buffer));
+      buffered = 0;
+    }
+  }
+  XXH3_64bits_update(&state, buffer.data(), buffered * sizeof(u64));
+  XXH3_64bits_update(&state, src + num_words * sizeof(u64), len % sizeof(u64));
+
+  return XXH3_64bits_digest(&state);
+}
+
 u32 StartCRC32()
 {
   return crc32_z(0L, Z_NULL, 0);
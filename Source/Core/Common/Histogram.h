@@ -0,0 +1,77 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Counts values into buckets with fixed upper bounds. One thread can add values while any other
+// thread reads them, which is what exporting the metrics of the emulation threads needs.
+template <size_t NumBounds>
+class Histogram final
+{
+public:
+  struct Snapshot
+  {
+    // The number of values in each bucket, not cumulative. The last bucket holds the values
+    // greater than all bounds.
+    std::array<u64, NumBounds + 1> counts{};
+    u64 sum = 0;
+    u64 count = 0;
+  };
+
+  // The bounds must be sorted in ascending order. A value falls into the first bucket whose
+  // bound it doesn't exceed.
+  explicit constexpr Histogram(const std::array<u64, NumBounds>& upper_bounds)
+      : m_upper_bounds(upper_bounds)
+  {
+  }
+
+  Histogram(const Histogram&) = delete;
+  Histogram& operator=(const Histogram&) = delete;
+
+  void Add(u64 value)
+  {
+    size_t bucket = 0;
+    while (bucket < NumBounds && value > m_upper_bounds[bucket])
+      ++bucket;
+
+    m_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  void Reset()
+  {
+    for (std::atomic<u64>& count : m_counts)
+      count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+  }
+
+  // The snapshot isn't atomic as a whole, so values added while it is taken may be missing from
+  // some of its fields.
+  Snapshot GetSnapshot() const
+  {
+    Snapshot snapshot;
+    for (size_t i = 0; i < m_counts.size(); ++i)
+    {
+      snapshot.counts[i] = m_counts[i].load(std::memory_order_relaxed);
+      snapshot.count += snapshot.counts[i];
+    }
+    snapshot.sum = m_sum.load(std::memory_order_relaxed);
+    return snapshot;
+  }
+
+  const std::array<u64, NumBounds>& GetUpperBounds() const { return m_upper_bounds; }
+
+private:
+  const std::array<u64, NumBounds> m_upper_bounds;
+  std::array<std::atomic<u64>, NumBounds + 1> m_counts{};
+  std::atomic<u64> m_sum = 0;
+};
+}  // namespace Common
@@ -3,11 +3,13 @@
 
 #include "Common/JitRegister.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -21,6 +23,16 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <elf.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+
+#include "Common/Logging/Log.h"
+#include "Common/WorkQueueThread.h"
+#endif
+
 #if defined USE_OPROFILE && USE_OPROFILE
 #include <opagent.h>
 #endif
@@ -36,11 +48,166 @@ static op_agent_t s_agent = nullptr;
 
 static File::IOFile s_perf_map_file;
 
+#ifdef __linux__
+// The jitdump format read by perf inject --jit, see tools/perf/Documentation/jitdump-specification
+// in the Linux sources. Records are assembled on the JIT thread, since the code they contain can
+// be overwritten at any time, and written out by a separate thread.
+namespace
+{
+constexpr u32 JITDUMP_MAGIC = 0x4A695444;
+constexpr u32 JITDUMP_VERSION = 1;
+
+#if defined(_M_X86_64)
+constexpr u32 JITDUMP_ELF_MACHINE = EM_X86_64;
+#elif defined(_M_ARM_64)
+constexpr u32 JITDUMP_ELF_MACHINE = EM_AARCH64;
+#else
+constexpr u32 JITDUMP_ELF_MACHINE = EM_NONE;
+#endif
+
+enum : u32
+{
+  JIT_CODE_LOAD = 0,
+  JIT_CODE_DEBUG_INFO = 2,
+  JIT_CODE_CLOSE = 3,
+};
+
+// The name of the "source file" of the debug info entries. The line numbers are guest addresses.
+constexpr char JITDUMP_SOURCE_NAME[] = "ppc";
+
+File::IOFile s_jitdump_file;
+void* s_jitdump_marker = nullptr;
+size_t s_jitdump_marker_size = 0;
+Common::WorkQueueThread<std::vector<u8>> s_jitdump_writer;
+std::atomic<u64> s_jitdump_code_index = 0;
+
+u64 GetJitDumpTimestamp()
+{
+  // perf has to be told to use the same clock with -k mono.
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<u64>(ts.tv_sec) * 1000000000 + static_cast<u64>(ts.tv_nsec);
+}
+
+template <typename T>
+void Append(std::vector<u8>& buffer, const T& value)
+{
+  const u8* const bytes = reinterpret_cast<const u8*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void AppendRecordHeader(std::vector<u8>& buffer, u32 id, size_t total_size, u64 timestamp)
+{
+  Append<u32>(buffer, id);
+  Append<u32>(buffer, static_cast<u32>(total_size));
+  Append<u64>(buffer, timestamp);
+}
+
+void AppendString(std::vector<u8>& buffer, std::string_view str)
+{
+  buffer.insert(buffer.end(), str.begin(), str.end());
+  buffer.push_back(0);
+}
+
+void OpenJitDump(const std::string& dir)
+{
+  const std::string filename = fmt::format("{}/jit-{}.dump", dir, getpid());
+  if (!s_jitdump_file.Open(filename, "w+b"))
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to open {}", filename);
+    return;
+  }
+
+  std::vector<u8> header;
+  Append<u32>(header, JITDUMP_MAGIC);
+  Append<u32>(header, JITDUMP_VERSION);
+  Append<u32>(header, 40);
+  Append<u32>(header, JITDUMP_ELF_MACHINE);
+  Append<u32>(header, 0);
+  Append<u32>(header, static_cast<u32>(getpid()));
+  Append<u64>(header, GetJitDumpTimestamp());
+  Append<u64>(header, 0);
+  s_jitdump_file.WriteBytes(header.data(), header.size());
+  s_jitdump_file.Flush();
+
+  // perf finds the file through this executable mapping of it.
+  s_jitdump_marker_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  s_jitdump_marker = mmap(nullptr, s_jitdump_marker_size, PROT_READ | PROT_EXEC, MAP_PRIVATE,
+                          fileno(s_jitdump_file.GetHandle()), 0);
+  if (s_jitdump_marker == MAP_FAILED)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map {}", filename);
+    s_jitdump_marker = nullptr;
+    s_jitdump_file.Close();
+    return;
+  }
+
+  s_jitdump_code_index = 0;
+  s_jitdump_writer.Reset([](std::vector<u8> record) {
+    s_jitdump_file.WriteBytes(record.data(), record.size());
+  });
+}
+
+void CloseJitDump()
+{
+  if (!s_jitdump_file.IsOpen())
+    return;
+
+  std::vector<u8> record;
+  AppendRecordHeader(record, JIT_CODE_CLOSE, 16, GetJitDumpTimestamp());
+  s_jitdump_writer.EmplaceItem(std::move(record));
+  s_jitdump_writer.Shutdown();
+
+  munmap(s_jitdump_marker, s_jitdump_marker_size);
+  s_jitdump_marker = nullptr;
+  s_jitdump_file.Close();
+}
+
+void WriteJitDumpRecords(const void* base_address, u32 code_size, const std::string& symbol_name,
+                         const std::vector<JitRegister::SourceLine>& source_lines)
+{
+  const u64 timestamp = GetJitDumpTimestamp();
+  const u64 code_address = reinterpret_cast<uintptr_t>(base_address);
+  std::vector<u8> records;
+
+  // The debug info has to come before the code it describes.
+  if (!source_lines.empty())
+  {
+    const size_t entry_size = 16 + sizeof(JITDUMP_SOURCE_NAME);
+    AppendRecordHeader(records, JIT_CODE_DEBUG_INFO, 32 + source_lines.size() * entry_size,
+                       timestamp);
+    Append<u64>(records, code_address);
+    Append<u64>(records, source_lines.size());
+    for (const JitRegister::SourceLine& line : source_lines)
+    {
+      Append<u64>(records, reinterpret_cast<uintptr_t>(line.host_address));
+      Append<u32>(records, line.guest_address);
+      Append<u32>(records, 0);
+      AppendString(records, JITDUMP_SOURCE_NAME);
+    }
+  }
+
+  AppendRecordHeader(records, JIT_CODE_LOAD, 56 + symbol_name.size() + 1 + code_size, timestamp);
+  Append<u32>(records, static_cast<u32>(getpid()));
+  Append<u32>(records, static_cast<u32>(syscall(SYS_gettid)));
+  Append<u64>(records, code_address);
+  Append<u64>(records, code_address);
+  Append<u64>(records, code_size);
+  Append<u64>(records, s_jitdump_code_index++);
+  AppendString(records, symbol_name);
+  const u8* const code = static_cast<const u8*>(base_address);
+  records.insert(records.end(), code, code + code_size);
+
+  s_jitdump_writer.EmplaceItem(std::move(records));
+}
+}  // namespace
+#endif
+
 namespace JitRegister
 {
 static bool s_is_enabled = false;
 
-void Init(const std::string& perf_dir)
+void Init(const std::string& perf_dir, bool write_jitdump)
 {
 #if defined USE_OPROFILE && USE_OPROFILE
   s_agent = op_open_agent();
@@ -57,6 +224,15 @@ void Init(const std::string& perf_dir)
     std::setvbuf(s_perf_map_file.GetHandle(), nullptr, _IONBF, 0);
     s_is_enabled = true;
   }
+
+#ifdef __linux__
+  if (write_jitdump)
+  {
+    OpenJitDump(perf_dir.empty() ? "/tmp" : perf_dir);
+    if (s_jitdump_file.IsOpen())
+      s_is_enabled = true;
+  }
+#endif
 }
 
 void Shutdown()
@@ -73,6 +249,10 @@ void Shutdown()
   if (s_perf_map_file.IsOpen())
     s_perf_map_file.Close();
 
+#ifdef __linux__
+  CloseJitDump();
+#endif
+
   s_is_enabled = false;
 }
 
@@ -81,10 +261,26 @@ bool IsEnabled()
   return s_is_enabled;
 }
 
+bool IsJitDumpEnabled()
+{
+#ifdef __linux__
+  return s_jitdump_file.IsOpen();
+#else
+  return false;
+#endif
+}
+
 void Register(const void* base_address, u32 code_size, const std::string& symbol_name)
+{
+  RegisterWithSourceLines(base_address, code_size, symbol_name, {});
+}
+
+void RegisterWithSourceLines(const void* base_address, u32 code_size,
+                             const std::string& symbol_name,
+                             const std::vector<SourceLine>& source_lines)
 {
 #if !(defined USE_OPROFILE && USE_OPROFILE) && !defined(USE_VTUNE)
-  if (!s_perf_map_file.IsOpen())
+  if (!s_is_enabled)
     return;
 #endif
 
@@ -101,6 +297,11 @@ void Register(const void* base_address, u32 code_size, const std::string& symbol
   iJIT_NotifyEvent(iJVM_EVENT_TYPE_METHOD_LOAD_FINISHED, (void*)&jmethod);
 #endif
 
+#ifdef __linux__
+  if (s_jitdump_file.IsOpen())
+    WriteJitDumpRecords(base_address, code_size, symbol_name, source_lines);
+#endif
+
   // Linux perf /tmp/perf-$pid.map:
   if (!s_perf_map_file.IsOpen())
     return;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -11,10 +12,23 @@
 
 namespace JitRegister
 {
-void Init(const std::string& perf_dir);
+// Maps the host code starting at host_address to the emulated instruction it was generated for.
+struct SourceLine
+{
+  const void* host_address;
+  u32 guest_address;
+};
+
+void Init(const std::string& perf_dir, bool write_jitdump);
 void Shutdown();
 void Register(const void* base_address, u32 code_size, const std::string& symbol_name);
+// The source lines are only used by the jitdump output, and must be sorted by host address.
+void RegisterWithSourceLines(const void* base_address, u32 code_size,
+                             const std::string& symbol_name,
+                             const std::vector<SourceLine>& source_lines);
 bool IsEnabled();
+// Whether it is worth collecting source lines for the code which gets registered.
+bool IsJitDumpEnabled();
 
 template <typename... Args>
 inline void Register(const void* base_address, u32 code_size, fmt::format_string<Args...> format,
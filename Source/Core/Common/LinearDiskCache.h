@@ -4,13 +4,21 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "Common/Version.h"
 
 // On disk format:
@@ -25,6 +33,22 @@
 // u32 value_size;
 // key_type   key;
 // value_type[value_size]   value;
+// u32 entry_number;  // 1-based index of the pair in the file
+//}
+
+// Index file (<filename>.idx), written when the cache is closed:
+// index_header{
+// u32 'DIDX';
+// u32 index_version;
+// u64 covered_size;     // size of the part of the cache file described by the index
+// u32 covered_entries;  // number of key_value_pairs in that part
+// u32 num_index_entries;
+//}
+
+// index_entry{
+// key_type key;
+// u64 value_offset;
+// u32 value_size;
 //}
 
 template <typename K, typename V>
@@ -35,9 +59,13 @@ public:
 };
 
 // Dead simple unsorted key-value store with append functionality.
-// No random read functionality, all reading is done in OpenAndRead.
 // Keys and values can contain any characters, including \0.
 //
+// The cache file is mapped into memory rather than read, and an index of the keys is kept next to
+// it, so opening a cache only reads the index and the values are only paged in when they're used,
+// through Find() or ForEach(). If a key was appended more than once, the last value is used and
+// the file is compacted when it is opened.
+//
 // Suitable for caching generated shader bytecode between executions.
 // Not tuned for extreme performance but should be reasonably fast.
 // Does not support keys or values larger than 2GB, which should be reasonable.
@@ -50,8 +78,14 @@ template <typename K, typename V>
 class LinearDiskCache
 {
 public:
-  // return number of read entries
-  u32 OpenAndRead(const std::string& filename, LinearDiskCacheReader<K, V>& reader)
+  LinearDiskCache() = default;
+  ~LinearDiskCache() { Close(); }
+
+  LinearDiskCache(const LinearDiskCache&) = delete;
+  LinearDiskCache& operator=(const LinearDiskCache&) = delete;
+
+  // Opens the cache, creating it if it doesn't exist or isn't valid. Returns the number of keys.
+  u32 Open(const std::string& filename)
   {
     // Since we're reading/writing directly to the storage of K instances,
     // K must be trivially copyable.
@@ -59,66 +93,73 @@ public:
 
     // close any currently opened file
     Close();
-    m_num_entries = 0;
-
-    // try opening for reading/writing
-    m_file.Open(filename, "r+b");
-
-    const u64 file_size = m_file.GetSize();
 
     m_header.Init();
-    if (m_file.IsOpen() && ValidateHeader())
+    if (MapAndIndex(filename) && (m_num_entries == m_entries.size() || Compact(filename)))
     {
-      // good header, read some key/value pairs
-      K key;
-
-      std::unique_ptr<V[]> value = nullptr;
-      u32 value_size = 0;
-      u32 entry_number = 0;
-      u64 last_valid_value_start = m_file.Tell();
-
-      while (m_file.ReadArray(&value_size, 1))
-      {
-        const u64 next_extent = m_file.Tell() + sizeof(value_size) + value_size;
-        if (next_extent > file_size)
-          break;
-
-        // TODO: use make_unique_for_overwrite in C++20
-        value = std::unique_ptr<V[]>(new V[value_size]);
-
-        // read key/value and pass to reader
-        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.get(), value_size) &&
-            m_file.ReadArray(&entry_number, 1) && entry_number == m_num_entries + 1)
-        {
-          last_valid_value_start = m_file.Tell();
-          reader.Read(key, value.get(), value_size);
-        }
-        else
-        {
-          break;
-        }
-
-        m_num_entries++;
-      }
-      m_file.ClearError();
-      m_file.Seek(last_valid_value_start, File::SeekOrigin::Begin);
-
-      return m_num_entries;
+      return static_cast<u32>(m_entries.size());
     }
 
     // failed to open file for reading or bad header
     // close and recreate file
     Close();
+    File::Delete(GetIndexFileName(filename), File::IfAbsentBehavior::NoConsoleWarning);
+    m_filename = filename;
     m_file.Open(filename, "wb");
     WriteHeader();
+    m_end_offset = sizeof(Header);
+    m_index_dirty = true;
     return 0;
   }
 
+  // return number of read entries
+  u32 OpenAndRead(const std::string& filename, LinearDiskCacheReader<K, V>& reader)
+  {
+    const u32 count = Open(filename);
+    ForEach([&reader](const K& key, const V* value, u32 value_size) {
+      reader.Read(key, value, value_size);
+    });
+    return count;
+  }
+
+  // Returns the value for key, or nullptr if the cache doesn't contain it. The value stays valid
+  // until the cache is closed.
+  const V* Find(const K& key, u32* value_size) const
+  {
+    const auto it = m_index.find(key);
+    if (it == m_index.end())
+      return nullptr;
+
+    const Entry& entry = m_entries[it->second];
+    *value_size = entry.value_size;
+    return entry.value;
+  }
+
+  // Calls f(key, value, value_size) for every key, in the order they were first appended.
+  template <typename F>
+  void ForEach(F&& f) const
+  {
+    for (const Entry& entry : m_entries)
+      f(entry.key, entry.value, entry.value_size);
+  }
+
   void Sync() { m_file.Flush(); }
   void Close()
   {
     if (m_file.IsOpen())
+    {
       m_file.Close();
+      if (m_index_dirty)
+        WriteIndex();
+    }
+
+    m_mapping.Close();
+    m_entries.clear();
+    m_index.clear();
+    m_owned_values.clear();
+    m_num_entries = 0;
+    m_end_offset = 0;
+    m_index_dirty = false;
   }
 
   // Appends a key-value pair to the store.
@@ -131,18 +172,262 @@ public:
     m_file.WriteArray(value, value_size);
     m_num_entries++;
     m_file.WriteArray(&m_num_entries, 1);
+
+    // The value isn't part of the mapping, so keep a copy of it.
+    AddEntry(key, m_end_offset + sizeof(u32) + sizeof(K), value_size,
+             CopyValue(value, value_size));
+
+    m_end_offset += GetRecordSize(value_size);
+    m_index_dirty = true;
   }
 
 private:
-  void WriteHeader() { m_file.WriteArray(&m_header, 1); }
-  bool ValidateHeader()
+  struct Entry
+  {
+    K key;
+    u64 value_offset;
+    u32 value_size;
+    const V* value;
+  };
+
+  struct KeyHash
+  {
+    size_t operator()(const K& key) const
+    {
+      return std::hash<std::string_view>()(
+          std::string_view(reinterpret_cast<const char*>(&key), sizeof(K)));
+    }
+  };
+
+  struct KeyEqual
+  {
+    bool operator()(const K& a, const K& b) const { return std::memcmp(&a, &b, sizeof(K)) == 0; }
+  };
+
+  static constexpr u32 INDEX_VERSION = 1;
+  static constexpr size_t INDEX_HEADER_SIZE = 2 * sizeof(u32) + sizeof(u64) + 2 * sizeof(u32);
+  static constexpr size_t INDEX_ENTRY_SIZE = sizeof(K) + sizeof(u64) + sizeof(u32);
+
+  static std::string GetIndexFileName(const std::string& filename) { return filename + ".idx"; }
+
+  static u64 GetRecordSize(u32 value_size)
+  {
+    return sizeof(u32) + sizeof(K) + u64(value_size) * sizeof(V) + sizeof(u32);
+  }
+
+  template <typename T>
+  static T ReadValue(const u8* data)
+  {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+  }
+
+  // Keeps a copy of a value which can't be used where it is.
+  const V* CopyValue(const void* value, u32 value_size)
+  {
+    // TODO: use make_unique_for_overwrite in C++20
+    auto copy = std::unique_ptr<V[]>(new V[value_size]);
+    std::memcpy(copy.get(), value, value_size * sizeof(V));
+    return m_owned_values.emplace_back(std::move(copy)).get();
+  }
+
+  // Values in the mapping can be used in place unless they aren't suitably aligned for V.
+  const V* GetMappedValue(u64 value_offset, u32 value_size)
+  {
+    const u8* const value = m_mapping.GetData() + value_offset;
+    if (reinterpret_cast<uintptr_t>(value) % alignof(V) == 0)
+      return reinterpret_cast<const V*>(value);
+    return CopyValue(value, value_size);
+  }
+
+  void AddEntry(const K& key, u64 value_offset, u32 value_size, const V* value)
+  {
+    const auto [it, inserted] = m_index.emplace(key, m_entries.size());
+    if (inserted)
+      m_entries.push_back(Entry{key, value_offset, value_size, value});
+    else
+      m_entries[it->second] = Entry{key, value_offset, value_size, value};
+  }
+
+  // Maps the cache file, builds the index from the index file and whatever pairs were appended
+  // after it was written, and opens the cache file for appending.
+  bool MapAndIndex(const std::string& filename)
+  {
+    Close();
+
+    if (!m_mapping.Open(filename) || m_mapping.GetSize() < sizeof(Header) ||
+        std::memcmp(&m_header, m_mapping.GetData(), sizeof(Header)) != 0)
+    {
+      m_mapping.Close();
+      return false;
+    }
+
+    m_filename = filename;
+    if (!ReadIndex())
+    {
+      m_entries.clear();
+      m_index.clear();
+      m_owned_values.clear();
+      m_num_entries = 0;
+      m_end_offset = sizeof(Header);
+      m_index_dirty = true;
+    }
+
+    // Pick up the pairs that were appended after the index was written. Anything after the last
+    // valid pair is overwritten by the next append.
+    const u32 indexed_entries = m_num_entries;
+    ScanEntries();
+    if (m_num_entries != indexed_entries)
+      m_index_dirty = true;
+
+    // try opening for reading/writing
+    m_file.Open(filename, "r+b");
+    if (!m_file.IsOpen() || !m_file.Seek(m_end_offset, File::SeekOrigin::Begin))
+    {
+      Close();
+      return false;
+    }
+    return true;
+  }
+
+  void ScanEntries()
   {
-    char file_header[sizeof(Header)];
+    const u8* const data = m_mapping.GetData();
+    const u64 size = m_mapping.GetSize();
+    u64 pos = m_end_offset;
+    while (size - pos >= GetRecordSize(0))
+    {
+      const u32 value_size = ReadValue<u32>(data + pos);
+      const u64 record_size = GetRecordSize(value_size);
+      if (record_size > size - pos ||
+          ReadValue<u32>(data + pos + record_size - sizeof(u32)) != m_num_entries + 1)
+      {
+        break;
+      }
 
-    return (m_file.ReadArray(file_header, sizeof(Header)) &&
-            !memcmp((const char*)&m_header, file_header, sizeof(Header)));
+      const u64 value_offset = pos + sizeof(u32) + sizeof(K);
+      AddEntry(ReadValue<K>(data + pos + sizeof(u32)), value_offset, value_size,
+               GetMappedValue(value_offset, value_size));
+      m_num_entries++;
+      pos += record_size;
+    }
+    m_end_offset = pos;
   }
 
+  // Rewrites the cache file without the values that were replaced by later appends of the same
+  // key, and opens it again. If the file can't be replaced, the original one stays in use. Returns
+  // false if the cache couldn't be opened again.
+  bool Compact(const std::string& filename)
+  {
+    const std::string temp_filename = File::GetTempFilenameForAtomicWrite(filename);
+    {
+      File::IOFile temp_file(temp_filename, "wb");
+      bool good = temp_file.WriteArray(&m_header, 1);
+      u32 entry_number = 0;
+      for (const Entry& entry : m_entries)
+      {
+        entry_number++;
+        good = good && temp_file.WriteArray(&entry.value_size, 1) &&
+               temp_file.WriteArray(&entry.key, 1) &&
+               temp_file.WriteArray(entry.value, entry.value_size) &&
+               temp_file.WriteArray(&entry_number, 1);
+      }
+      if (!good || !temp_file.Close())
+      {
+        // The cache is still open, just not compacted.
+        File::Delete(temp_filename, File::IfAbsentBehavior::NoConsoleWarning);
+        return true;
+      }
+    }
+
+    // The mapping has to be closed before the file can be replaced on Windows. The index is
+    // rebuilt when the file is opened again.
+    m_index_dirty = false;
+    Close();
+    File::Delete(GetIndexFileName(filename), File::IfAbsentBehavior::NoConsoleWarning);
+    if (!File::Rename(temp_filename, filename))
+      File::Delete(temp_filename, File::IfAbsentBehavior::NoConsoleWarning);
+    return MapAndIndex(filename);
+  }
+
+  void WriteIndex()
+  {
+    File::IOFile index(GetIndexFileName(m_filename), "wb");
+    const u32 num_index_entries = static_cast<u32>(m_entries.size());
+    index.WriteBytes("DIDX", sizeof(u32));
+    index.WriteArray(&INDEX_VERSION, 1);
+    index.WriteArray(&m_end_offset, 1);
+    index.WriteArray(&m_num_entries, 1);
+    index.WriteArray(&num_index_entries, 1);
+    for (const Entry& entry : m_entries)
+    {
+      index.WriteArray(&entry.key, 1);
+      index.WriteArray(&entry.value_offset, 1);
+      index.WriteArray(&entry.value_size, 1);
+    }
+  }
+
+  // Reads the index file, if it matches the cache file. Sets m_end_offset to the end of the part
+  // of the cache file it covers.
+  bool ReadIndex()
+  {
+    std::string index;
+    if (!File::ReadFileToString(GetIndexFileName(m_filename), index) ||
+        index.size() < INDEX_HEADER_SIZE)
+    {
+      return false;
+    }
+
+    const u8* data = reinterpret_cast<const u8*>(index.data());
+    const u64 covered_size = ReadValue<u64>(data + 2 * sizeof(u32));
+    const u32 covered_entries = ReadValue<u32>(data + 2 * sizeof(u32) + sizeof(u64));
+    const u32 num_index_entries = ReadValue<u32>(data + 3 * sizeof(u32) + sizeof(u64));
+    if (std::memcmp(data, "DIDX", sizeof(u32)) != 0 ||
+        ReadValue<u32>(data + sizeof(u32)) != INDEX_VERSION ||
+        index.size() != INDEX_HEADER_SIZE + u64(num_index_entries) * INDEX_ENTRY_SIZE ||
+        covered_size < sizeof(Header) || covered_size > m_mapping.GetSize())
+    {
+      return false;
+    }
+
+    // Make sure that the cache file wasn't recreated since the index was written, by checking that
+    // the last covered pair is where the index says. Keys are also checked when they're found.
+    if (covered_entries == 0)
+    {
+      if (covered_size != sizeof(Header))
+        return false;
+    }
+    else if (covered_size < sizeof(Header) + GetRecordSize(0) ||
+             ReadValue<u32>(m_mapping.GetData() + covered_size - sizeof(u32)) != covered_entries)
+    {
+      return false;
+    }
+
+    const u8* const mapped = m_mapping.GetData();
+    for (u32 i = 0; i < num_index_entries; ++i)
+    {
+      const u8* const entry = data + INDEX_HEADER_SIZE + i * INDEX_ENTRY_SIZE;
+      const K key = ReadValue<K>(entry);
+      const u64 value_offset = ReadValue<u64>(entry + sizeof(K));
+      const u32 value_size = ReadValue<u32>(entry + sizeof(K) + sizeof(u64));
+      if (value_offset < sizeof(Header) + sizeof(u32) + sizeof(K) ||
+          value_offset + u64(value_size) * sizeof(V) + sizeof(u32) > covered_size ||
+          std::memcmp(mapped + value_offset - sizeof(K), &key, sizeof(K)) != 0)
+      {
+        return false;
+      }
+
+      AddEntry(key, value_offset, value_size, GetMappedValue(value_offset, value_size));
+    }
+
+    m_num_entries = covered_entries;
+    m_end_offset = covered_size;
+    return true;
+  }
+
+  void WriteHeader() { m_file.WriteArray(&m_header, 1); }
+
   struct Header
   {
     void Init()
@@ -161,5 +446,18 @@ private:
   } m_header;
 
   File::IOFile m_file;
+  File::MappedFile m_mapping;
+  std::string m_filename;
+
+  // Distinct keys in the order they were first appended, and where to find them in m_entries.
+  std::vector<Entry> m_entries;
+  std::unordered_map<K, size_t, KeyHash, KeyEqual> m_index;
+  // Values which couldn't be used from the mapping, like the ones that were appended.
+  std::vector<std::unique_ptr<V[]>> m_owned_values;
+
+  // Number of pairs in the file. This is more than the number of keys if any were duplicated.
   u32 m_num_entries = 0;
+  // End of the last valid pair in the file, which is where the next one is appended.
+  u64 m_end_offset = 0;
+  bool m_index_dirty = false;
 };
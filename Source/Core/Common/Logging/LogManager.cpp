@@ -7,6 +7,7 @@
 #include <chrono>
 #include <cstdarg>
 #include <cstring>
+#include <iterator>
 #include <locale>
 #include <mutex>
 #include <ostream>
@@ -21,6 +22,7 @@
 #include "Common/Logging/ConsoleListener.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 
 namespace Common::Log
 {
@@ -42,12 +44,12 @@ public:
     SetEnable(true);
   }
 
+  // Only called from the log thread.
   void Log(LogLevel, const char* msg) override
   {
     if (!IsEnabled() || !IsValid())
       return;
 
-    std::lock_guard<std::mutex> lk(m_log_lock);
     m_logfile << msg << std::flush;
   }
 
@@ -56,7 +58,6 @@ public:
   void SetEnable(bool enable) { m_enable = enable; }
 
 private:
-  std::mutex m_log_lock;
   std::ofstream m_logfile;
   bool m_enable;
 };
@@ -168,10 +169,20 @@ LogManager::LogManager()
   }
 
   m_path_cutoff_point = DeterminePathCutOffPoint();
+
+  m_running.Set();
+  m_thread = std::thread(&LogManager::LogThreadFunc, this);
 }
 
 LogManager::~LogManager()
 {
+  m_running.Clear();
+  m_queue_event.Set();
+  m_thread.join();
+
+  // Anything logged while the thread was exiting still has to go out.
+  DispatchQueuedMessages();
+
   // The log window listener pointer is owned by the GUI code.
   delete m_listeners[LogListener::CONSOLE_LISTENER];
   delete m_listeners[LogListener::FILE_LISTENER];
@@ -205,13 +216,12 @@ void LogManager::Log(LogLevel level, LogType type, const char* file, int line, c
   LogWithFullPath(level, type, file + m_path_cutoff_point, line, message);
 }
 
-std::string LogManager::GetTimestamp()
+std::string LogManager::GetTimestamp(std::chrono::system_clock::time_point now)
 {
   // NOTE: the Qt LogWidget hardcodes the expected length of the timestamp portion of the log line,
   // so ensure they stay in sync
 
   // We want milliseconds *and not hours*, so can't directly use STL formatters
-  const auto now = std::chrono::system_clock::now();
   const auto now_s = std::chrono::floor<std::chrono::seconds>(now);
   const auto now_ms = std::chrono::floor<std::chrono::milliseconds>(now);
   return fmt::format("{:%M:%S}:{:03}", now_s, (now_ms - now_s).count());
@@ -220,14 +230,39 @@ std::string LogManager::GetTimestamp()
 void LogManager::LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
                                  const char* message)
 {
-  const std::string msg =
-      fmt::format("{} {}:{} {}[{}]: {}\n", GetTimestamp(), file, line,
-                  LOG_LEVEL_TO_CHAR[static_cast<int>(level)], GetShortName(type), message);
+  // Only the timestamp is taken here. Building the final line and writing it out is left to the
+  // log thread so that logging stays cheap for the thread doing it.
+  m_queue.Push(QueuedMessage{std::chrono::system_clock::now(), level, type, file, line, message});
+  m_queue_event.Set();
+}
+
+void LogManager::LogThreadFunc()
+{
+  Common::SetCurrentThreadName("Log Thread");
 
-  for (const auto listener_id : m_listener_ids)
+  while (m_running.IsSet())
+  {
+    m_queue_event.Wait();
+    DispatchQueuedMessages();
+  }
+}
+
+void LogManager::DispatchQueuedMessages()
+{
+  std::string msg;
+  for (QueuedMessage entry; m_queue.Pop(entry);)
   {
-    if (m_listeners[listener_id])
-      m_listeners[listener_id]->Log(level, msg.c_str());
+    msg.clear();
+    fmt::format_to(std::back_inserter(msg), "{} {}:{} {}[{}]: {}\n", GetTimestamp(entry.time),
+                   entry.file, entry.line, LOG_LEVEL_TO_CHAR[static_cast<int>(entry.level)],
+                   GetShortName(entry.type), entry.message);
+
+    std::lock_guard lk(m_listener_mutex);
+    for (const auto listener_id : m_listener_ids)
+    {
+      if (m_listeners[listener_id])
+        m_listeners[listener_id]->Log(entry.level, msg.c_str());
+    }
   }
 }
 
@@ -273,11 +308,13 @@ const char* LogManager::GetFullName(LogType type) const
 
 void LogManager::RegisterListener(LogListener::LISTENER id, LogListener* listener)
 {
+  std::lock_guard lk(m_listener_mutex);
   m_listeners[id] = listener;
 }
 
 void LogManager::EnableListener(LogListener::LISTENER id, bool enable)
 {
+  std::lock_guard lk(m_listener_mutex);
   m_listener_ids[id] = enable;
 }
 
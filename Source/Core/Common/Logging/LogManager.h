@@ -4,13 +4,19 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstdarg>
 #include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "Common/BitSet.h"
 #include "Common/EnumMap.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Common/Logging/Log.h"
+#include "Common/MPSCQueue.h"
 
 namespace Common::Log
 {
@@ -38,6 +44,9 @@ public:
   static void Init();
   static void Shutdown();
 
+  // Messages are queued and handed to the listeners by a background thread, in the order they
+  // were logged. Listeners are only ever called from that thread. Only the pointer to `file` is
+  // kept, so it has to stay valid (e.g. __FILE__).
   void Log(LogLevel level, LogType type, const char* file, int line, const char* message);
   void LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
                        const char* message);
@@ -67,6 +76,16 @@ private:
     bool m_enable = false;
   };
 
+  struct QueuedMessage
+  {
+    std::chrono::system_clock::time_point time;
+    LogLevel level{};
+    LogType type{};
+    const char* file = nullptr;
+    int line = 0;
+    std::string message;
+  };
+
   LogManager();
   ~LogManager();
 
@@ -75,12 +94,24 @@ private:
   LogManager(LogManager&&) = delete;
   LogManager& operator=(LogManager&&) = delete;
 
-  static std::string GetTimestamp();
+  static std::string GetTimestamp(std::chrono::system_clock::time_point time);
+
+  void LogThreadFunc();
+  void DispatchQueuedMessages();
 
   LogLevel m_level;
   EnumMap<LogContainer, LAST_LOG_TYPE> m_log{};
   std::array<LogListener*, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
   BitSet32 m_listener_ids;
   size_t m_path_cutoff_point = 0;
+
+  // Held by the log thread while it calls into the listeners, so that a listener which has been
+  // unregistered or disabled is guaranteed not to be called anymore.
+  std::mutex m_listener_mutex;
+
+  Common::MPSCQueue<QueuedMessage> m_queue;
+  Common::Event m_queue_event;
+  Common::Flag m_running;
+  std::thread m_thread;
 };
 }  // namespace Common::Log
@@ -0,0 +1,79 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a simple lockless thread-safe,
+// multiple producer, single consumer queue
+
+#include <atomic>
+#include <utility>
+
+namespace Common
+{
+// Any number of threads may Push() concurrently, but only one thread at a time may Pop().
+//
+// Producers only do a single atomic exchange, so they never wait for each other or for the
+// consumer. The flip side is that an element whose producer is in the middle of Push() (after the
+// exchange, but before linking the element in) hides the elements pushed after it from the
+// consumer until that producer is done. Empty() and Pop() can thus report an empty queue while
+// another thread is pushing, like they would if the push hadn't started yet.
+template <typename T>
+class MPSCQueue
+{
+public:
+  MPSCQueue() : m_write_ptr(new ElementPtr()) { m_read_ptr = m_write_ptr.load(); }
+  ~MPSCQueue()
+  {
+    Clear();
+    delete m_read_ptr;
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  bool Empty() const { return !m_read_ptr->next.load(std::memory_order_acquire); }
+
+  template <typename Arg>
+  void Push(Arg&& t)
+  {
+    ElementPtr* new_ptr = new ElementPtr();
+    new_ptr->current = std::forward<Arg>(t);
+
+    // claim our place in the queue, then link the previous element to us
+    ElementPtr* prev_ptr = m_write_ptr.exchange(new_ptr, std::memory_order_acq_rel);
+    prev_ptr->next.store(new_ptr, std::memory_order_release);
+  }
+
+  bool Pop(T& t)
+  {
+    // the read pointer always points at an element which has already been consumed
+    ElementPtr* next_ptr = m_read_ptr->next.load(std::memory_order_acquire);
+    if (!next_ptr)
+      return false;
+
+    t = std::move(next_ptr->current);
+    delete m_read_ptr;
+    m_read_ptr = next_ptr;
+    return true;
+  }
+
+  // only safe to call from the consumer thread
+  void Clear()
+  {
+    for (T t; Pop(t);)
+    {
+    }
+  }
+
+private:
+  struct ElementPtr
+  {
+    T current{};
+    std::atomic<ElementPtr*> next{nullptr};
+  };
+
+  std::atomic<ElementPtr*> m_write_ptr;
+  ElementPtr* m_read_ptr;
+};
+}  // namespace Common
@@ -13,6 +13,15 @@ namespace Common
 {
 #ifdef _WIN32
 struct WindowsMemoryRegion;
+
+struct WindowsMemoryFunctions
+{
+  Common::DynamicLibrary m_kernel32_handle;
+  Common::DynamicLibrary m_api_ms_win_core_memory_l1_1_6_handle;
+  void* m_address_UnmapViewOfFileEx = nullptr;
+  void* m_address_VirtualAlloc2 = nullptr;
+  void* m_address_MapViewOfFile3 = nullptr;
+};
 #endif
 
 // This class lets you create a block of anonymous RAM, and then arbitrarily map views into it.
@@ -34,8 +43,10 @@ public:
   /// CreateView() and ReleaseView(). Used to make a mappable region for emulated memory.
   ///
   /// @param size The amount of bytes that should be allocated in this region.
+  /// @param use_huge_pages Whether to back the segment with huge pages if GetHugePageSize() is
+  /// not 0.
   ///
-  void GrabSHMSegment(size_t size);
+  void GrabSHMSegment(size_t size, bool use_huge_pages = false);
 
   ///
   /// Release the memory segment previously allocated with GrabSHMSegment().
@@ -99,6 +110,23 @@ public:
   ///
   void UnmapFromMemoryRegion(void* view, size_t size);
 
+  ///
+  /// Get the granularity at which offsets, sizes and addresses passed to MapInMemoryRegion() and
+  /// UnmapFromMemoryRegion() have to be aligned.
+  ///
+  /// @return The mapping granularity in bytes.
+  ///
+  size_t GetMappingGranularity() const;
+
+  ///
+  /// Get the size of the huge pages that GrabSHMSegment() can back the memory segment with.
+  /// Huge pages don't change the mapping granularity, but they are only used for the parts of the
+  /// segment that are mapped at addresses and offsets aligned to this size.
+  ///
+  /// @return The huge page size in bytes, or 0 if huge pages aren't supported on this host.
+  ///
+  size_t GetHugePageSize() const;
+
 private:
 #ifdef _WIN32
   WindowsMemoryRegion* EnsureSplitRegionForMapping(void* address, size_t size);
@@ -107,11 +135,7 @@ private:
   std::vector<WindowsMemoryRegion> m_regions;
   void* m_reserved_region = nullptr;
   void* m_memory_handle = nullptr;
-  Common::DynamicLibrary m_kernel32_handle;
-  Common::DynamicLibrary m_api_ms_win_core_memory_l1_1_6_handle;
-  void* m_address_UnmapViewOfFileEx = nullptr;
-  void* m_address_VirtualAlloc2 = nullptr;
-  void* m_address_MapViewOfFile3 = nullptr;
+  WindowsMemoryFunctions m_memory_functions;
 #else
 #ifdef ANDROID
   int fd;
@@ -119,7 +143,81 @@ private:
   int m_shm_fd;
   void* m_reserved_region;
   std::size_t m_reserved_region_size;
+  std::size_t m_huge_page_size = 0;
+#endif
+#endif
+};
+
+// This class reserves a large zero-initialized region of memory, of which the host only commits the
+// pages that actually get written to. Reading pages which have never been written to is allowed
+// and returns zeros. Call EnsureMemoryPageWritable() before writing to a page.
+class LazyMemoryRegion final
+{
+public:
+  LazyMemoryRegion();
+  ~LazyMemoryRegion();
+  LazyMemoryRegion(const LazyMemoryRegion&) = delete;
+  LazyMemoryRegion(LazyMemoryRegion&&) = delete;
+  LazyMemoryRegion& operator=(const LazyMemoryRegion&) = delete;
+  LazyMemoryRegion& operator=(LazyMemoryRegion&&) = delete;
+
+  ///
+  /// Reserve a memory region.
+  ///
+  /// @param size The size of the region.
+  ///
+  /// @return Pointer to the memory region, or nullptr on failure.
+  ///
+  void* Create(size_t size);
+
+  ///
+  /// Reset the memory region back to zeros, giving the committed pages back to the host.
+  ///
+  void Clear();
+
+  ///
+  /// Ensure that the memory page at the given offset can be written to. Only Windows needs this, as
+  /// it can't commit pages on the first write by itself.
+  ///
+  /// @param offset The offset into the memory region.
+  ///
+  void EnsureMemoryPageWritable(size_t offset)
+  {
+#ifdef _WIN32
+    const size_t block_index = offset / BLOCK_SIZE;
+    if (m_writable_block_handles[block_index] == nullptr)
+      MakeMemoryBlockWritable(block_index);
 #endif
+  }
+
+  ///
+  /// Release the memory previously reserved with Create(). After this call the pointer that was
+  /// returned by Create() is invalid.
+  ///
+  void Release();
+
+  ///
+  /// Get the size of the memory region.
+  ///
+  /// @return The size of the memory region, or 0 if no region is reserved.
+  ///
+  size_t GetSize() const { return m_size; }
+
+private:
+  void* m_memory = nullptr;
+  size_t m_size = 0;
+
+#ifdef _WIN32
+  bool MapZeroBlock(size_t block_index);
+  void MakeMemoryBlockWritable(size_t block_index);
+
+  // The region is made up of blocks of this size, which each either map the single shared
+  // read-only zero block or a writable block of their own.
+  static constexpr size_t BLOCK_SIZE = 8 * 1024 * 1024;
+
+  void* m_zero_block = nullptr;
+  std::vector<void*> m_writable_block_handles;
+  WindowsMemoryFunctions m_memory_functions;
 #endif
 };
 
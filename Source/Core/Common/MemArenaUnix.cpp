@@ -5,6 +5,7 @@
 
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <set>
@@ -14,8 +15,10 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include "Common/Assert.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
@@ -25,8 +28,37 @@ namespace Common
 MemArena::MemArena() = default;
 MemArena::~MemArena() = default;
 
-void MemArena::GrabSHMSegment(size_t size)
+namespace
 {
+void AdviseHugePages(void* address, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+  if (madvise(address, size, MADV_HUGEPAGE) != 0)
+    NOTICE_LOG_FMT(MEMMAP, "madvise(MADV_HUGEPAGE) failed: {}", LastStrerrorString());
+#endif
+}
+}  // namespace
+
+void MemArena::GrabSHMSegment(size_t size, bool use_huge_pages)
+{
+  m_huge_page_size = 0;
+#ifdef __linux__
+  // Transparent huge pages are only used for shmem files on the internal mount, which memfds live
+  // on, and not for /dev/shm unless it happens to be mounted with huge pages enabled.
+  if (use_huge_pages && GetHugePageSize() != 0)
+  {
+    m_shm_fd = memfd_create("dolphin-emu", MFD_CLOEXEC);
+    if (m_shm_fd != -1)
+    {
+      if (ftruncate(m_shm_fd, size) < 0)
+        ERROR_LOG_FMT(MEMMAP, "Failed to allocate low memory space");
+      m_huge_page_size = GetHugePageSize();
+      return;
+    }
+    WARN_LOG_FMT(MEMMAP, "memfd_create failed, not using huge pages: {}", strerror(errno));
+  }
+#endif
+
   const std::string file_name = "/dolphin-emu." + std::to_string(getpid());
   m_shm_fd = shm_open(file_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
   if (m_shm_fd == -1)
@@ -54,6 +86,8 @@ void* MemArena::CreateView(s64 offset, size_t size)
   }
   else
   {
+    if (m_huge_page_size != 0)
+      AdviseHugePages(retval, size);
     return retval;
   }
 }
@@ -65,13 +99,25 @@ void MemArena::ReleaseView(void* view, size_t size)
 
 u8* MemArena::ReserveMemoryRegion(size_t memory_size)
 {
+  // Align the region to the huge page size, so that views mapped at aligned offsets within it can
+  // use huge pages.
+  const size_t alignment = m_huge_page_size;
   const int flags = MAP_ANON | MAP_PRIVATE;
-  void* base = mmap(nullptr, memory_size, PROT_NONE, flags, -1, 0);
+  void* base = mmap(nullptr, memory_size + alignment, PROT_NONE, flags, -1, 0);
   if (base == MAP_FAILED)
   {
     PanicAlertFmt("Failed to map enough memory space: {}", LastStrerrorString());
     return nullptr;
   }
+  if (alignment != 0)
+  {
+    u8* const start = static_cast<u8*>(base);
+    const size_t head = (alignment - reinterpret_cast<uintptr_t>(start) % alignment) % alignment;
+    if (head != 0)
+      munmap(start, head);
+    munmap(start + head + memory_size, alignment - head);
+    base = start + head;
+  }
   m_reserved_region = base;
   m_reserved_region_size = memory_size;
   return static_cast<u8*>(base);
@@ -96,6 +142,8 @@ void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
   }
   else
   {
+    if (m_huge_page_size != 0)
+      AdviseHugePages(retval, size);
     return retval;
   }
 }
@@ -106,4 +154,85 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
   if (retval == MAP_FAILED)
     NOTICE_LOG_FMT(MEMMAP, "mmap failed");
 }
+
+size_t MemArena::GetMappingGranularity() const
+{
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+size_t MemArena::GetHugePageSize() const
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  static const size_t huge_page_size = [] {
+    std::string enabled;
+    if (!File::ReadFileToString("/sys/kernel/mm/transparent_hugepage/shmem_enabled", enabled) ||
+        enabled.find("[never]") != std::string::npos ||
+        enabled.find("[deny]") != std::string::npos)
+    {
+      return size_t(0);
+    }
+
+    std::string size_string;
+    size_t size = 0;
+    if (!File::ReadFileToString("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size",
+                                size_string) ||
+        !TryParse(std::string(StripWhitespace(size_string)), &size))
+    {
+      return size_t(0);
+    }
+    return size;
+  }();
+  return huge_page_size;
+#else
+  return 0;
+#endif
+}
+
+LazyMemoryRegion::LazyMemoryRegion() = default;
+
+LazyMemoryRegion::~LazyMemoryRegion()
+{
+  Release();
+}
+
+void* LazyMemoryRegion::Create(size_t size)
+{
+  ASSERT(!m_memory);
+
+  if (size == 0)
+    return nullptr;
+
+  void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (memory == MAP_FAILED)
+  {
+    NOTICE_LOG_FMT(MEMMAP, "Memory reservation of {} bytes failed: {}", size,
+                   LastStrerrorString());
+    return nullptr;
+  }
+
+  m_memory = memory;
+  m_size = size;
+  return memory;
+}
+
+void LazyMemoryRegion::Clear()
+{
+  ASSERT(m_memory);
+
+  // Mapping fresh anonymous memory over the region drops all of the pages that were written to.
+  void* new_memory = mmap(m_memory, m_size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+  ASSERT(new_memory == m_memory);
+}
+
+void LazyMemoryRegion::Release()
+{
+  if (m_memory)
+  {
+    munmap(m_memory, m_size);
+    m_memory = nullptr;
+    m_size = 0;
+  }
+}
 }  // namespace Common
@@ -10,6 +10,7 @@
 
 #include <windows.h>
 
+#include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
@@ -47,48 +48,55 @@ struct WindowsMemoryRegion
   }
 };
 
-MemArena::MemArena()
+static bool InitWindowsMemoryFunctions(WindowsMemoryFunctions* functions)
 {
-  // Check if VirtualAlloc2 and MapViewOfFile3 are available, which provide functionality to reserve
-  // a memory region no other allocation may occupy while still allowing us to allocate and map
-  // stuff within it. If they're not available we'll instead fall back to the 'legacy' logic and
-  // just hope that nothing allocates in our address range.
   DynamicLibrary kernelBase{"KernelBase.dll"};
   if (!kernelBase.IsOpen())
-    return;
+    return false;
 
   void* const ptr_IsApiSetImplemented = kernelBase.GetSymbolAddress("IsApiSetImplemented");
   if (!ptr_IsApiSetImplemented)
-    return;
+    return false;
   if (!static_cast<PIsApiSetImplemented>(ptr_IsApiSetImplemented)("api-ms-win-core-memory-l1-1-6"))
-    return;
+    return false;
 
-  m_api_ms_win_core_memory_l1_1_6_handle.Open("api-ms-win-core-memory-l1-1-6.dll");
-  m_kernel32_handle.Open("Kernel32.dll");
-  if (!m_api_ms_win_core_memory_l1_1_6_handle.IsOpen() || !m_kernel32_handle.IsOpen())
+  functions->m_api_ms_win_core_memory_l1_1_6_handle.Open("api-ms-win-core-memory-l1-1-6.dll");
+  functions->m_kernel32_handle.Open("Kernel32.dll");
+  if (!functions->m_api_ms_win_core_memory_l1_1_6_handle.IsOpen() ||
+      !functions->m_kernel32_handle.IsOpen())
   {
-    m_api_ms_win_core_memory_l1_1_6_handle.Close();
-    m_kernel32_handle.Close();
-    return;
+    functions->m_api_ms_win_core_memory_l1_1_6_handle.Close();
+    functions->m_kernel32_handle.Close();
+    return false;
   }
 
   void* const address_VirtualAlloc2 =
-      m_api_ms_win_core_memory_l1_1_6_handle.GetSymbolAddress("VirtualAlloc2FromApp");
+      functions->m_api_ms_win_core_memory_l1_1_6_handle.GetSymbolAddress("VirtualAlloc2FromApp");
   void* const address_MapViewOfFile3 =
-      m_api_ms_win_core_memory_l1_1_6_handle.GetSymbolAddress("MapViewOfFile3FromApp");
-  void* const address_UnmapViewOfFileEx = m_kernel32_handle.GetSymbolAddress("UnmapViewOfFileEx");
+      functions->m_api_ms_win_core_memory_l1_1_6_handle.GetSymbolAddress("MapViewOfFile3FromApp");
+  void* const address_UnmapViewOfFileEx =
+      functions->m_kernel32_handle.GetSymbolAddress("UnmapViewOfFileEx");
   if (address_VirtualAlloc2 && address_MapViewOfFile3 && address_UnmapViewOfFileEx)
   {
-    m_address_VirtualAlloc2 = address_VirtualAlloc2;
-    m_address_MapViewOfFile3 = address_MapViewOfFile3;
-    m_address_UnmapViewOfFileEx = address_UnmapViewOfFileEx;
-  }
-  else
-  {
-    // at least one function is not available, use legacy logic
-    m_api_ms_win_core_memory_l1_1_6_handle.Close();
-    m_kernel32_handle.Close();
+    functions->m_address_VirtualAlloc2 = address_VirtualAlloc2;
+    functions->m_address_MapViewOfFile3 = address_MapViewOfFile3;
+    functions->m_address_UnmapViewOfFileEx = address_UnmapViewOfFileEx;
+    return true;
   }
+
+  // at least one function is not available, use legacy logic
+  functions->m_api_ms_win_core_memory_l1_1_6_handle.Close();
+  functions->m_kernel32_handle.Close();
+  return false;
+}
+
+MemArena::MemArena()
+{
+  // Check if VirtualAlloc2 and MapViewOfFile3 are available, which provide functionality to reserve
+  // a memory region no other allocation may occupy while still allowing us to allocate and map
+  // stuff within it. If they're not available we'll instead fall back to the 'legacy' logic and
+  // just hope that nothing allocates in our address range.
+  InitWindowsMemoryFunctions(&m_memory_functions);
 }
 
 MemArena::~MemArena()
@@ -97,7 +105,7 @@ MemArena::~MemArena()
   ReleaseSHMSegment();
 }
 
-void MemArena::GrabSHMSegment(size_t size)
+void MemArena::GrabSHMSegment(size_t size, bool use_huge_pages)
 {
   const std::string name = "dolphin-emu." + std::to_string(GetCurrentProcessId());
   m_memory_handle = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0,
@@ -132,11 +140,12 @@ u8* MemArena::ReserveMemoryRegion(size_t memory_size)
   }
 
   u8* base;
-  if (m_api_ms_win_core_memory_l1_1_6_handle.IsOpen())
+  if (m_memory_functions.m_api_ms_win_core_memory_l1_1_6_handle.IsOpen())
   {
-    base = static_cast<u8*>(static_cast<PVirtualAlloc2>(m_address_VirtualAlloc2)(
-        nullptr, nullptr, memory_size, MEM_RESERVE | MEM_RESERVE_PLACEHOLDER, PAGE_NOACCESS,
-        nullptr, 0));
+    base = static_cast<u8*>(
+        static_cast<PVirtualAlloc2>(m_memory_functions.m_address_VirtualAlloc2)(
+            nullptr, nullptr, memory_size, MEM_RESERVE | MEM_RESERVE_PLACEHOLDER, PAGE_NOACCESS,
+            nullptr, 0));
     if (base)
     {
       m_reserved_region = base;
@@ -163,7 +172,7 @@ u8* MemArena::ReserveMemoryRegion(size_t memory_size)
 
 void MemArena::ReleaseMemoryRegion()
 {
-  if (m_api_ms_win_core_memory_l1_1_6_handle.IsOpen() && m_reserved_region)
+  if (m_memory_functions.m_api_ms_win_core_memory_l1_1_6_handle.IsOpen() && m_reserved_region)
   {
     // user should have unmapped everything by this point, check if that's true and yell if not
     // (it indicates a bug in the emulated memory mapping logic)
@@ -300,7 +309,7 @@ WindowsMemoryRegion* MemArena::EnsureSplitRegionForMapping(void* start_address,
 
 void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
 {
-  if (m_api_ms_win_core_memory_l1_1_6_handle.IsOpen())
+  if (m_memory_functions.m_api_ms_win_core_memory_l1_1_6_handle.IsOpen())
   {
     WindowsMemoryRegion* const region = EnsureSplitRegionForMapping(base, size);
     if (!region)
@@ -309,7 +318,7 @@ void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
       return nullptr;
     }
 
-    void* rv = static_cast<PMapViewOfFile3>(m_address_MapViewOfFile3)(
+    void* rv = static_cast<PMapViewOfFile3>(m_memory_functions.m_address_MapViewOfFile3)(
         m_memory_handle, nullptr, base, offset, size, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE,
         nullptr, 0);
     if (rv)
@@ -402,10 +411,10 @@ bool MemArena::JoinRegionsAfterUnmap(void* start_address, size_t size)
 
 void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
 {
-  if (m_api_ms_win_core_memory_l1_1_6_handle.IsOpen())
+  if (m_memory_functions.m_api_ms_win_core_memory_l1_1_6_handle.IsOpen())
   {
-    if (static_cast<PUnmapViewOfFileEx>(m_address_UnmapViewOfFileEx)(view,
-                                                                     MEM_PRESERVE_PLACEHOLDER))
+    if (static_cast<PUnmapViewOfFileEx>(m_memory_functions.m_address_UnmapViewOfFileEx)(
+            view, MEM_PRESERVE_PLACEHOLDER))
     {
       if (!JoinRegionsAfterUnmap(view, size))
         PanicAlertFmt("Joining memory region failed.");
@@ -419,4 +428,187 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
 
   UnmapViewOfFile(view);
 }
+
+size_t MemArena::GetMappingGranularity() const
+{
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwAllocationGranularity;
+}
+
+size_t MemArena::GetHugePageSize() const
+{
+  // SEC_LARGE_PAGES sections can only be mapped at large page granularity, which is too coarse for
+  // the mirrors and page table mappings of fastmem.
+  return 0;
+}
+
+LazyMemoryRegion::LazyMemoryRegion() = default;
+
+LazyMemoryRegion::~LazyMemoryRegion()
+{
+  Release();
+}
+
+void* LazyMemoryRegion::Create(size_t size)
+{
+  ASSERT(!m_memory);
+
+  if (size == 0)
+    return nullptr;
+
+  // Committing the whole region up front would count all of it against the commit limit, so map a
+  // single read-only zero block everywhere instead, and give blocks memory of their own once they
+  // get written to. This needs placeholders, without which we fail and the caller falls back.
+  if (!m_memory_functions.m_api_ms_win_core_memory_l1_1_6_handle.IsOpen() &&
+      !InitWindowsMemoryFunctions(&m_memory_functions))
+  {
+    NOTICE_LOG_FMT(MEMMAP, "VirtualAlloc2 and/or MapViewFromFile3 unavailable, "
+                           "not reserving a lazy memory region.");
+    return nullptr;
+  }
+
+  const size_t memory_size = Common::AlignUp(size, BLOCK_SIZE);
+  const size_t block_count = memory_size / BLOCK_SIZE;
+  u8* const memory =
+      static_cast<u8*>(static_cast<PVirtualAlloc2>(m_memory_functions.m_address_VirtualAlloc2)(
+          nullptr, nullptr, memory_size, MEM_RESERVE | MEM_RESERVE_PLACEHOLDER, PAGE_NOACCESS,
+          nullptr, 0));
+  if (!memory)
+  {
+    NOTICE_LOG_FMT(MEMMAP, "Memory reservation of {} bytes failed: {}", memory_size,
+                   GetLastErrorString());
+    return nullptr;
+  }
+
+  m_memory = memory;
+  m_size = memory_size;
+  m_writable_block_handles.assign(block_count, nullptr);
+
+  // Split the placeholder into one placeholder per block.
+  for (size_t i = 0; i < block_count - 1; ++i)
+  {
+    if (!VirtualFree(memory + i * BLOCK_SIZE, BLOCK_SIZE, MEM_RELEASE | MEM_PRESERVE_PLACEHOLDER))
+    {
+      NOTICE_LOG_FMT(MEMMAP, "Splitting memory region failed: {}", GetLastErrorString());
+      Release();
+      return nullptr;
+    }
+  }
+
+  m_zero_block = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READONLY,
+                                   static_cast<DWORD>(u64(BLOCK_SIZE) >> 32),
+                                   static_cast<DWORD>(BLOCK_SIZE), nullptr);
+  if (!m_zero_block)
+  {
+    NOTICE_LOG_FMT(MEMMAP, "Creating the zero block failed: {}", GetLastErrorString());
+    Release();
+    return nullptr;
+  }
+
+  for (size_t i = 0; i < block_count; ++i)
+  {
+    if (!MapZeroBlock(i))
+    {
+      Release();
+      return nullptr;
+    }
+  }
+
+  return memory;
+}
+
+bool LazyMemoryRegion::MapZeroBlock(size_t block_index)
+{
+  void* const address = static_cast<u8*>(m_memory) + block_index * BLOCK_SIZE;
+  void* const result = static_cast<PMapViewOfFile3>(m_memory_functions.m_address_MapViewOfFile3)(
+      m_zero_block, nullptr, address, 0, BLOCK_SIZE, MEM_REPLACE_PLACEHOLDER, PAGE_READONLY,
+      nullptr, 0);
+  if (result != address)
+  {
+    NOTICE_LOG_FMT(MEMMAP, "Mapping the zero block failed: {}", GetLastErrorString());
+    return false;
+  }
+  return true;
+}
+
+void LazyMemoryRegion::MakeMemoryBlockWritable(size_t block_index)
+{
+  void* const address = static_cast<u8*>(m_memory) + block_index * BLOCK_SIZE;
+
+  void* const block = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(u64(BLOCK_SIZE) >> 32),
+                                        static_cast<DWORD>(BLOCK_SIZE), nullptr);
+  if (!block)
+  {
+    PanicAlertFmt("Failed to allocate memory block: {}", GetLastErrorString());
+    return;
+  }
+
+  if (!static_cast<PUnmapViewOfFileEx>(m_memory_functions.m_address_UnmapViewOfFileEx)(
+          address, MEM_PRESERVE_PLACEHOLDER))
+  {
+    PanicAlertFmt("Failed to unmap the zero block: {}", GetLastErrorString());
+    CloseHandle(block);
+    return;
+  }
+
+  void* const result = static_cast<PMapViewOfFile3>(m_memory_functions.m_address_MapViewOfFile3)(
+      block, nullptr, address, 0, BLOCK_SIZE, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE, nullptr, 0);
+  if (result != address)
+  {
+    PanicAlertFmt("Failed to map memory block: {}", GetLastErrorString());
+    CloseHandle(block);
+    MapZeroBlock(block_index);
+    return;
+  }
+
+  m_writable_block_handles[block_index] = block;
+}
+
+void LazyMemoryRegion::Clear()
+{
+  ASSERT(m_memory);
+
+  // Only the blocks that were written to need to go back to the zero block.
+  for (size_t i = 0; i < m_writable_block_handles.size(); ++i)
+  {
+    void*& handle = m_writable_block_handles[i];
+    if (!handle)
+      continue;
+
+    void* const address = static_cast<u8*>(m_memory) + i * BLOCK_SIZE;
+    static_cast<PUnmapViewOfFileEx>(m_memory_functions.m_address_UnmapViewOfFileEx)(
+        address, MEM_PRESERVE_PLACEHOLDER);
+    CloseHandle(handle);
+    handle = nullptr;
+    MapZeroBlock(i);
+  }
+}
+
+void LazyMemoryRegion::Release()
+{
+  if (m_memory)
+  {
+    // Each block is either a mapped view or a bare placeholder, depending on how far Create() got.
+    for (size_t i = 0; i < m_writable_block_handles.size(); ++i)
+    {
+      void* const address = static_cast<u8*>(m_memory) + i * BLOCK_SIZE;
+      static_cast<PUnmapViewOfFileEx>(m_memory_functions.m_address_UnmapViewOfFileEx)(
+          address, MEM_PRESERVE_PLACEHOLDER);
+      VirtualFree(address, 0, MEM_RELEASE);
+      if (m_writable_block_handles[i])
+        CloseHandle(m_writable_block_handles[i]);
+    }
+    m_writable_block_handles.clear();
+    m_memory = nullptr;
+    m_size = 0;
+  }
+
+  if (m_zero_block)
+  {
+    CloseHandle(m_zero_block);
+    m_zero_block = nullptr;
+  }
+}
 }  // namespace Common
@@ -34,5 +34,7 @@ void ReadProtectMemory(void* ptr, size_t size);
 void WriteProtectMemory(void* ptr, size_t size, bool executable = false);
 void UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute = false);
 size_t MemPhysical();
+// The granularity at which the Protect functions above work.
+size_t MemPageSize();
 
 }  // namespace Common
@@ -359,17 +359,24 @@ TCPPacket::TCPPacket(const MACAddress& destination, const MACAddress& source,
 std::vector<u8> TCPPacket::Build() const
 {
   std::vector<u8> result;
-  result.reserve(Size());  // Useful not to invalidate .data() pointers
+  Build(&result);
+  return result;
+}
+
+void TCPPacket::Build(std::vector<u8>* result) const
+{
+  result->clear();
+  result->reserve(Size());  // Useful not to invalidate .data() pointers
 
   // Copy data
-  InsertObj(&result, eth_header);
-  u8* const ip_ptr = result.data() + result.size();
-  InsertObj(&result, ip_header);
-  result.insert(result.end(), ipv4_options.begin(), ipv4_options.end());
-  u8* const tcp_ptr = result.data() + result.size();
-  InsertObj(&result, tcp_header);
-  result.insert(result.end(), tcp_options.begin(), tcp_options.end());
-  result.insert(result.end(), data.begin(), data.end());
+  InsertObj(result, eth_header);
+  u8* const ip_ptr = result->data() + result->size();
+  InsertObj(result, ip_header);
+  result->insert(result->end(), ipv4_options.begin(), ipv4_options.end());
+  u8* const tcp_ptr = result->data() + result->size();
+  InsertObj(result, tcp_header);
+  result->insert(result->end(), tcp_options.begin(), tcp_options.end());
+  result->insert(result->end(), data.begin(), data.end());
 
   // Adjust size and checksum fields
   const u16 tcp_length = static_cast<u16>(TCPHeader::SIZE + tcp_options.size() + data.size());
@@ -391,8 +398,6 @@ std::vector<u8> TCPPacket::Build() const
   checksum_bitcast_ptr = u16(0);
   checksum_bitcast_ptr = ComputeTCPNetworkChecksum(
       ip_header.source_addr, ip_header.destination_addr, tcp_ptr, tcp_length, IPPROTO_TCP);
-
-  return result;
 }
 
 u16 TCPPacket::Size() const
@@ -413,16 +418,23 @@ UDPPacket::UDPPacket(const MACAddress& destination, const MACAddress& source,
 std::vector<u8> UDPPacket::Build() const
 {
   std::vector<u8> result;
-  result.reserve(Size());  // Useful not to invalidate .data() pointers
+  Build(&result);
+  return result;
+}
+
+void UDPPacket::Build(std::vector<u8>* result) const
+{
+  result->clear();
+  result->reserve(Size());  // Useful not to invalidate .data() pointers
 
   // Copy data
-  InsertObj(&result, eth_header);
-  u8* const ip_ptr = result.data() + result.size();
-  InsertObj(&result, ip_header);
-  result.insert(result.end(), ipv4_options.begin(), ipv4_options.end());
-  u8* const udp_ptr = result.data() + result.size();
-  InsertObj(&result, udp_header);
-  result.insert(result.end(), data.begin(), data.end());
+  InsertObj(result, eth_header);
+  u8* const ip_ptr = result->data() + result->size();
+  InsertObj(result, ip_header);
+  result->insert(result->end(), ipv4_options.begin(), ipv4_options.end());
+  u8* const udp_ptr = result->data() + result->size();
+  InsertObj(result, udp_header);
+  result->insert(result->end(), data.begin(), data.end());
 
   // Adjust size and checksum fields
   const u16 udp_length = static_cast<u16>(UDPHeader::SIZE + data.size());
@@ -441,8 +453,6 @@ std::vector<u8> UDPPacket::Build() const
   checksum_bitcast_ptr = u16(0);
   checksum_bitcast_ptr = ComputeTCPNetworkChecksum(
       ip_header.source_addr, ip_header.destination_addr, udp_ptr, udp_length, IPPROTO_UDP);
-
-  return result;
 }
 
 u16 UDPPacket::Size() const
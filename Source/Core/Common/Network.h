@@ -204,6 +204,8 @@ struct TCPPacket
   TCPPacket(const MACAddress& destination, const MACAddress& source, const sockaddr_in& from,
             const sockaddr_in& to, u32 seq, u32 ack, u16 flags);
   std::vector<u8> Build() const;
+  // Builds the frame into an existing buffer, reusing its capacity.
+  void Build(std::vector<u8>* result) const;
   u16 Size() const;
 
   EthernetHeader eth_header;
@@ -222,6 +224,8 @@ struct UDPPacket
   UDPPacket(const MACAddress& destination, const MACAddress& source, const sockaddr_in& from,
             const sockaddr_in& to, const std::vector<u8>& payload);
   std::vector<u8> Build() const;
+  // Builds the frame into an existing buffer, reusing its capacity.
+  void Build(std::vector<u8>* result) const;
   u16 Size() const;
 
   EthernetHeader eth_header;
@@ -0,0 +1,136 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a simple lockless thread-safe,
+// single producer, single consumer queue
+// which reuses the elements that have been popped
+
+#include <atomic>
+#include <utility>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Works like SPSCQueue, but popped elements aren't freed. The producer takes them back for later
+// pushes, so once the queue has been as long as it usually gets, Push() and Pop() don't allocate
+// anymore. The memory is only freed when the queue is destroyed.
+//
+// Popped values are left in their elements until these get reused, and pushing assigns to them.
+// That way, a type which owns a buffer, such as a packet, keeps its capacity across reuses as
+// long as Pop() without an argument is used.
+template <typename T, bool NeedSize = true>
+class PooledSPSCQueue
+{
+public:
+  PooledSPSCQueue()
+  {
+    ElementPtr* const dummy = new ElementPtr();
+    m_write_ptr = m_first_free = m_read_ptr_copy = dummy;
+    m_read_ptr.store(dummy, std::memory_order_relaxed);
+  }
+
+  ~PooledSPSCQueue()
+  {
+    // every element is reachable from the oldest free one
+    ElementPtr* ptr = m_first_free;
+    while (ptr)
+    {
+      ElementPtr* const next_ptr = ptr->next.load(std::memory_order_relaxed);
+      delete ptr;
+      ptr = next_ptr;
+    }
+  }
+
+  PooledSPSCQueue(const PooledSPSCQueue&) = delete;
+  PooledSPSCQueue& operator=(const PooledSPSCQueue&) = delete;
+
+  u32 Size() const
+  {
+    static_assert(NeedSize, "using Size() on PooledSPSCQueue without NeedSize");
+    return m_size.load();
+  }
+
+  // Must be called from the consumer thread, like Front() and Pop().
+  bool Empty() const { return !ReadPtr()->next.load(std::memory_order_acquire); }
+  T& Front() const { return ReadPtr()->next.load(std::memory_order_acquire)->current; }
+
+  template <typename Arg>
+  void Push(Arg&& t)
+  {
+    ElementPtr* const new_ptr = AllocateElement();
+    new_ptr->current = std::forward<Arg>(t);
+    new_ptr->next.store(nullptr, std::memory_order_relaxed);
+
+    m_write_ptr->next.store(new_ptr, std::memory_order_release);
+    m_write_ptr = new_ptr;
+    if (NeedSize)
+      m_size++;
+  }
+
+  void Pop()
+  {
+    if (NeedSize)
+      m_size--;
+    // the element that was read becomes the new head, and the old head can be reused
+    m_read_ptr.store(ReadPtr()->next.load(std::memory_order_acquire), std::memory_order_release);
+  }
+
+  bool Pop(T& t)
+  {
+    ElementPtr* const next_ptr = ReadPtr()->next.load(std::memory_order_acquire);
+    if (!next_ptr)
+      return false;
+
+    if (NeedSize)
+      m_size--;
+    t = std::move(next_ptr->current);
+    m_read_ptr.store(next_ptr, std::memory_order_release);
+    return true;
+  }
+
+  // only safe to call from the consumer thread
+  void Clear()
+  {
+    while (!Empty())
+      Pop();
+  }
+
+private:
+  // stores an element and a pointer to the next ElementPtr
+  struct ElementPtr
+  {
+    T current{};
+    std::atomic<ElementPtr*> next{nullptr};
+  };
+
+  ElementPtr* ReadPtr() const { return m_read_ptr.load(std::memory_order_relaxed); }
+
+  // The elements from m_first_free up to, but not including, the head of the consumer have been
+  // consumed and can be reused.
+  ElementPtr* AllocateElement()
+  {
+    if (m_first_free == m_read_ptr_copy)
+    {
+      m_read_ptr_copy = m_read_ptr.load(std::memory_order_acquire);
+      if (m_first_free == m_read_ptr_copy)
+        return new ElementPtr();
+    }
+
+    ElementPtr* const ptr = m_first_free;
+    m_first_free = ptr->next.load(std::memory_order_relaxed);
+    return ptr;
+  }
+
+  // only used by the producer
+  ElementPtr* m_write_ptr;
+  ElementPtr* m_first_free;
+  ElementPtr* m_read_ptr_copy;
+
+  // the last element that was popped, which is never reused while it is there
+  std::atomic<ElementPtr*> m_read_ptr;
+  std::atomic<u32> m_size{0};
+};
+}  // namespace Common
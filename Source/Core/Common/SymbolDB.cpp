@@ -52,6 +52,7 @@ void SymbolDB::Clear(const char* prefix)
   // TODO: honor prefix
   m_functions.clear();
   m_checksum_to_function.clear();
+  m_functions_changed = true;
 }
 
 void SymbolDB::Index()
@@ -109,5 +110,6 @@ std::vector<Symbol*> SymbolDB::GetSymbolsFromHash(u32 hash)
 void SymbolDB::AddCompleteSymbol(const Symbol& symbol)
 {
   m_functions.emplace(symbol.address, symbol);
+  m_functions_changed = true;
 }
 }  // namespace Common
@@ -77,7 +77,11 @@ public:
   std::vector<Symbol*> GetSymbolsFromHash(u32 hash);
 
   const XFuncMap& Symbols() const { return m_functions; }
-  XFuncMap& AccessSymbols() { return m_functions; }
+  XFuncMap& AccessSymbols()
+  {
+    m_functions_changed = true;
+    return m_functions;
+  }
   bool IsEmpty() const;
   void Clear(const char* prefix = "");
   void List();
@@ -86,5 +90,8 @@ public:
 protected:
   XFuncMap m_functions;
   XFuncPtrMap m_checksum_to_function;
+  // Set whenever symbols may have been added to or removed from m_functions, so that derived
+  // classes know when to rebuild their lookup structures.
+  bool m_functions_changed = true;
 };
 }  // namespace Common
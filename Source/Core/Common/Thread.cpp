@@ -3,6 +3,8 @@
 
 #include "Common/Thread.h"
 
+#include <atomic>
+
 #ifdef _WIN32
 #include <Windows.h>
 #include <processthreadsapi.h>
@@ -10,8 +12,14 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+
 #ifdef __APPLE__
 #include <mach/mach.h>
+#include <pthread.h>
 #elif defined BSD4_4 || defined __FreeBSD__ || defined __OpenBSD__
 #include <pthread_np.h>
 #elif defined __NetBSD__
@@ -25,9 +33,11 @@
 #pragma comment(lib, "libittnotify.lib")
 #endif
 
+#include "Common/CPUDetect.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/StringUtil.h"
+#include "Common/Trace.h"
 
 namespace Common
 {
@@ -44,12 +54,12 @@ int CurrentThreadId()
 
 #ifdef _WIN32
 
-void SetThreadAffinity(std::thread::native_handle_type thread, u32 mask)
+void SetThreadAffinity(std::thread::native_handle_type thread, u64 mask)
 {
   SetThreadAffinityMask(thread, mask);
 }
 
-void SetCurrentThreadAffinity(u32 mask)
+void SetCurrentThreadAffinity(u64 mask)
 {
   SetThreadAffinityMask(GetCurrentThread(), mask);
 }
@@ -113,11 +123,14 @@ void SetCurrentThreadName(const char* name)
 {
   SetCurrentThreadNameViaException(name);
   SetCurrentThreadNameViaApi(name);
+#ifdef USE_TRACING
+  Trace::SetThreadName(name);
+#endif
 }
 
 #else  // !WIN32, so must be POSIX threads
 
-void SetThreadAffinity(std::thread::native_handle_type thread, u32 mask)
+void SetThreadAffinity(std::thread::native_handle_type thread, u64 mask)
 {
 #ifdef __APPLE__
   thread_policy_set(pthread_mach_thread_np(thread), THREAD_AFFINITY_POLICY, (integer_t*)&mask, 1);
@@ -149,7 +162,7 @@ void SetThreadAffinity(std::thread::native_handle_type thread, u32 mask)
 #endif
 }
 
-void SetCurrentThreadAffinity(u32 mask)
+void SetCurrentThreadAffinity(u64 mask)
 {
   SetThreadAffinity(pthread_self(), mask);
 }
@@ -183,8 +196,43 @@ void SetCurrentThreadName(const char* name)
   // API.
   __itt_thread_set_name(name);
 #endif
+#ifdef USE_TRACING
+  Trace::SetThreadName(name);
+#endif
 }
 
 #endif
 
+static std::atomic<bool> s_thread_placement_enabled = false;
+
+void SetThreadPlacementEnabled(bool enabled)
+{
+  s_thread_placement_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void SetCurrentThreadRole(ThreadRole role)
+{
+  if (!s_thread_placement_enabled.load(std::memory_order_relaxed) || !cpu_info.bHybrid)
+    return;
+
+  const bool emulation = role == ThreadRole::Emulation;
+#ifdef __APPLE__
+  // Threads can't be pinned to cores, but the scheduler picks the cores based on the QoS class.
+  pthread_set_qos_class_self_np(emulation ? QOS_CLASS_USER_INTERACTIVE : QOS_CLASS_UTILITY, 0);
+#else
+  const u64 mask = emulation ? cpu_info.performance_core_mask : cpu_info.efficiency_core_mask;
+  if (mask != 0)
+    SetCurrentThreadAffinity(mask);
+
+#ifdef _WIN32
+  SetThreadPriority(GetCurrentThread(),
+                    emulation ? THREAD_PRIORITY_ABOVE_NORMAL : THREAD_PRIORITY_BELOW_NORMAL);
+#elif defined(__linux__)
+  // Raising the priority of a thread needs privileges that we usually don't have.
+  if (!emulation)
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 5);
+#endif
+#endif
+}
+
 }  // namespace Common
@@ -19,8 +19,23 @@ namespace Common
 {
 int CurrentThreadId();
 
-void SetThreadAffinity(std::thread::native_handle_type thread, u32 mask);
-void SetCurrentThreadAffinity(u32 mask);
+void SetThreadAffinity(std::thread::native_handle_type thread, u64 mask);
+void SetCurrentThreadAffinity(u64 mask);
+
+// What a thread is for, which decides where it runs on CPUs with performance and efficiency cores.
+enum class ThreadRole
+{
+  // Threads that the emulation speed depends on, like the CPU, GPU, DSP, DVD and audio threads.
+  Emulation,
+  // Threads that work in the background, like shader compilers or memory card flushers.
+  Background,
+};
+
+// Off by default. Only affects threads that set their role afterwards.
+void SetThreadPlacementEnabled(bool enabled);
+// If thread placement is enabled and the CPU is hybrid, keeps the current thread on the kind of
+// core that suits its role, and raises or lowers its priority to match.
+void SetCurrentThreadRole(ThreadRole role);
 
 void SleepCurrentThread(int ms);
 void SwitchCurrentThread();  // On Linux, this is equal to sleep 1ms
@@ -0,0 +1,178 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Common/Thread.h"
+
+namespace Common
+{
+// The pool and worker index of the current thread, if it's a worker.
+static thread_local ThreadPool* s_current_pool = nullptr;
+static thread_local u32 s_current_worker = 0;
+
+ThreadPool::ThreadPool(u32 num_workers, const char* name, u32 affinity_mask) : m_name(name)
+{
+  num_workers = std::max(num_workers, 1u);
+
+  m_queues.reserve(num_workers);
+  for (u32 i = 0; i < num_workers; ++i)
+    m_queues.push_back(std::make_unique<WorkerQueue>());
+
+  m_workers.reserve(num_workers);
+  for (u32 i = 0; i < num_workers; ++i)
+  {
+    m_workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    if (affinity_mask != 0)
+      SetThreadAffinity(m_workers.back().native_handle(), affinity_mask);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard lk(m_sleep_mutex);
+    m_shutdown = true;
+  }
+  m_sleep_cv.notify_all();
+
+  for (std::thread& worker : m_workers)
+    worker.join();
+}
+
+ThreadPool& ThreadPool::GetShared()
+{
+  static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 3u) - 2,
+                         "Background Worker");
+  return pool;
+}
+
+void ThreadPool::Submit(std::function<void()> task, Priority priority)
+{
+  // Tasks submitted by a worker go to its own queue, since they often work on the same data.
+  const u32 index = s_current_pool == this ?
+                        s_current_worker :
+                        m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+
+  WorkerQueue& queue = *m_queues[index];
+  {
+    std::lock_guard lk(queue.mutex);
+    queue.tasks[static_cast<size_t>(priority)].push_back(std::move(task));
+  }
+
+  m_pending.fetch_add(1, std::memory_order_release);
+  {
+    // Makes sure a worker which has just seen m_pending at 0 is already waiting.
+    std::lock_guard lk(m_sleep_mutex);
+  }
+  m_sleep_cv.notify_one();
+}
+
+bool ThreadPool::TryPop(u32 index, std::function<void()>* task)
+{
+  const size_t num_queues = m_queues.size();
+  for (size_t priority = 0; priority < NUM_PRIORITIES; ++priority)
+  {
+    // Our own queue first, then steal from the others.
+    for (size_t i = 0; i < num_queues; ++i)
+    {
+      WorkerQueue& queue = *m_queues[(index + i) % num_queues];
+      std::lock_guard lk(queue.mutex);
+      auto& tasks = queue.tasks[priority];
+      if (tasks.empty())
+        continue;
+
+      *task = std::move(tasks.front());
+      tasks.pop_front();
+      m_pending.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ThreadPool::WorkerLoop(u32 index)
+{
+  SetCurrentThreadName(m_name);
+  s_current_pool = this;
+  s_current_worker = index;
+
+  while (true)
+  {
+    std::function<void()> task;
+    if (TryPop(index, &task))
+    {
+      task();
+      continue;
+    }
+
+    // Remaining tasks still get run on shutdown.
+    std::unique_lock lk(m_sleep_mutex);
+    if (m_shutdown)
+      break;
+    m_sleep_cv.wait(lk, [this] {
+      return m_pending.load(std::memory_order_acquire) != 0 || m_shutdown;
+    });
+  }
+}
+
+TaskGroup::TaskGroup(ThreadPool::Priority priority, ThreadPool& pool)
+    : m_pool(pool), m_priority(priority), m_state(std::make_shared<State>())
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+  Cancel();
+}
+
+void TaskGroup::Submit(std::function<void()> task)
+{
+  u64 generation;
+  {
+    std::lock_guard lk(m_state->mutex);
+    generation = m_state->generation;
+    ++m_state->queued;
+  }
+
+  // The task may only be picked up after the group is gone if it has been cancelled, in which case
+  // it only touches the state.
+  m_pool.Submit(
+      [state = m_state, generation, task = std::move(task)] {
+        {
+          std::lock_guard lk(state->mutex);
+          if (state->generation != generation)
+            return;
+          --state->queued;
+          ++state->running;
+        }
+
+        task();
+
+        {
+          std::lock_guard lk(state->mutex);
+          --state->running;
+        }
+        state->cv.notify_all();
+      },
+      m_priority);
+}
+
+void TaskGroup::Wait()
+{
+  std::unique_lock lk(m_state->mutex);
+  m_state->cv.wait(lk, [this] { return m_state->queued == 0 && m_state->running == 0; });
+}
+
+void TaskGroup::Cancel()
+{
+  std::unique_lock lk(m_state->mutex);
+  ++m_state->generation;
+  m_state->queued = 0;
+  m_state->cv.wait(lk, [this] { return m_state->running == 0; });
+}
+}  // namespace Common
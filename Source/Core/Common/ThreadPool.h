@@ -0,0 +1,108 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// A pool of worker threads for background work. Every worker has its own queue, and workers which
+// run out of work steal from the others, so that tasks submitted from a worker mostly stay on it.
+// Higher priority tasks are always picked before lower priority ones, no matter which queue they
+// are in.
+class ThreadPool
+{
+public:
+  enum class Priority
+  {
+    High,
+    Normal,
+    Low,
+  };
+
+  // If affinity_mask is non-zero, the workers are restricted to the cores in it.
+  ThreadPool(u32 num_workers, const char* name, u32 affinity_mask = 0);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  void Submit(std::function<void()> task, Priority priority = Priority::Normal);
+
+  u32 GetWorkerCount() const { return static_cast<u32>(m_workers.size()); }
+
+  // The pool shared by all background work which isn't latency sensitive. It leaves two cores free
+  // for the CPU and GPU threads, so that background work doesn't compete with emulation.
+  static ThreadPool& GetShared();
+
+private:
+  static constexpr size_t NUM_PRIORITIES = 3;
+
+  struct WorkerQueue
+  {
+    std::mutex mutex;
+    std::array<std::deque<std::function<void()>>, NUM_PRIORITIES> tasks;
+  };
+
+  void WorkerLoop(u32 index);
+  bool TryPop(u32 index, std::function<void()>* task);
+
+  std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+  std::vector<std::thread> m_workers;
+  const char* m_name;
+  std::atomic<u32> m_next_queue = 0;
+
+  // Number of tasks sitting in the queues. Workers sleep while it's 0.
+  std::atomic<size_t> m_pending = 0;
+  std::mutex m_sleep_mutex;
+  std::condition_variable m_sleep_cv;
+  bool m_shutdown = false;
+};
+
+// Tracks the tasks a subsystem has submitted to a ThreadPool, so that it can wait for them or
+// cancel them without affecting the tasks of anyone else.
+class TaskGroup
+{
+public:
+  explicit TaskGroup(ThreadPool::Priority priority = ThreadPool::Priority::Normal,
+                     ThreadPool& pool = ThreadPool::GetShared());
+  ~TaskGroup();
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  void Submit(std::function<void()> task);
+
+  // Waits until all submitted tasks have run.
+  void Wait();
+  // Drops the tasks which haven't started yet and waits for the running ones to finish. The group
+  // can be used again afterwards.
+  void Cancel();
+
+private:
+  struct State
+  {
+    std::mutex mutex;
+    std::condition_variable cv;
+    // Incremented by Cancel(). Tasks submitted before that are skipped when they're picked up.
+    u64 generation = 0;
+    u32 queued = 0;
+    u32 running = 0;
+  };
+
+  ThreadPool& m_pool;
+  ThreadPool::Priority m_priority;
+  std::shared_ptr<State> m_state;
+};
+}  // namespace Common
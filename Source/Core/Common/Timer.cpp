@@ -5,15 +5,29 @@
 
 #include <chrono>
 
+#include <algorithm>
+#include <cerrno>
+#include <thread>
+
 #ifdef _WIN32
 #include <Windows.h>
 #include <ctime>
 #include <timeapi.h>
 #else
 #include <sys/time.h>
+#include <time.h>
+#endif
+
+#ifdef __linux__
+#include <sys/prctl.h>
 #endif
 
 #include "Common/CommonTypes.h"
+#include "Common/Thread.h"
+
+#if defined(_WIN32) && !defined(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION)
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
 
 namespace Common
 {
@@ -119,4 +133,95 @@ void Timer::RestoreResolution()
 #endif
 }
 
+// The OS sleep is never allowed to end closer to the deadline than this, or further from it.
+constexpr DT MIN_SPIN_MARGIN = std::chrono::microseconds(20);
+constexpr DT MAX_SPIN_MARGIN = std::chrono::milliseconds(2);
+
+PrecisionTimer::PrecisionTimer()
+{
+#ifdef _WIN32
+  // High resolution timers need Windows 10 1803, fall back to a regular one on older versions.
+  m_timer_handle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                                          TIMER_ALL_ACCESS);
+  if (!m_timer_handle)
+    m_timer_handle = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+  m_spin_margin = std::chrono::milliseconds(1);
+#else
+  m_spin_margin = std::chrono::microseconds(100);
+#endif
+}
+
+PrecisionTimer::~PrecisionTimer()
+{
+#ifdef _WIN32
+  if (m_timer_handle)
+    CloseHandle(m_timer_handle);
+#endif
+}
+
+void PrecisionTimer::SleepOS(TimePoint deadline)
+{
+#if defined(_WIN32)
+  if (m_timer_handle)
+  {
+    // Negative due times are relative, in units of 100ns.
+    LARGE_INTEGER due_time;
+    due_time.QuadPart = -std::max<s64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now()).count() / 100,
+        1);
+    if (SetWaitableTimerEx(m_timer_handle, &due_time, 0, nullptr, nullptr, nullptr, 0))
+    {
+      WaitForSingleObject(m_timer_handle, INFINITE);
+      return;
+    }
+  }
+  std::this_thread::sleep_until(deadline);
+#elif defined(__linux__)
+  // The default timer slack of 50us would be added to every sleep. It's per thread, so set it
+  // the first time a thread sleeps here.
+  static thread_local bool s_timer_slack_set = false;
+  if (!s_timer_slack_set)
+  {
+    prctl(PR_SET_TIMERSLACK, 1, 0, 0, 0);
+    s_timer_slack_set = true;
+  }
+
+  // steady_clock is CLOCK_MONOTONIC on Linux.
+  const auto ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+  timespec ts;
+  ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+  ts.tv_nsec = static_cast<long>(ns % 1000000000);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+  {
+  }
+#else
+  std::this_thread::sleep_until(deadline);
+#endif
+}
+
+DT PrecisionTimer::SleepUntil(TimePoint deadline)
+{
+  const TimePoint wake_target = deadline - m_spin_margin;
+  if (Clock::now() < wake_target)
+  {
+    SleepOS(wake_target);
+
+    // Keep the margin somewhat above the typical overshoot, so that the OS sleep rarely ends after
+    // the deadline, without spinning longer than needed.
+    const DT overshoot = Clock::now() - wake_target;
+    m_spin_margin += (overshoot * 3 / 2 - m_spin_margin) / 8;
+    m_spin_margin = std::clamp(m_spin_margin, MIN_SPIN_MARGIN, MAX_SPIN_MARGIN);
+  }
+
+  TimePoint now = Clock::now();
+  while (now < deadline)
+  {
+    YieldCPU();
+    now = Clock::now();
+  }
+
+  return now - deadline;
+}
+
 }  // Namespace Common
@@ -32,4 +32,30 @@ private:
   bool m_running{false};
 };
 
+// Sleeps until a deadline with much less overshoot than std::this_thread::sleep_until. The OS
+// sleep (a high resolution waitable timer on Windows, clock_nanosleep with minimal timer slack on
+// Linux) wakes up a bit early, and the rest of the time is spun away. How early is adjusted to how
+// late the OS sleep has been waking up.
+class PrecisionTimer
+{
+public:
+  PrecisionTimer();
+  ~PrecisionTimer();
+
+  PrecisionTimer(const PrecisionTimer&) = delete;
+  PrecisionTimer& operator=(const PrecisionTimer&) = delete;
+
+  // Returns how late the thread woke up.
+  DT SleepUntil(TimePoint deadline);
+
+private:
+  void SleepOS(TimePoint deadline);
+
+#ifdef _WIN32
+  void* m_timer_handle = nullptr;
+#endif
+  // How long before the deadline the OS sleep should end.
+  DT m_spin_margin;
+};
+
 }  // Namespace Common
@@ -0,0 +1,233 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef USE_TRACING
+
+#include "Common/Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace Common::Trace
+{
+namespace
+{
+// Number of events a thread collects before writing them to the file.
+constexpr size_t EVENTS_PER_FLUSH = 4096;
+
+struct Event
+{
+  const char* name;
+  u64 start_ns;
+  u64 duration_ns;
+};
+
+struct ThreadBuffer
+{
+  std::mutex mutex;
+  std::vector<Event> events;
+  std::string name;
+  u32 tid = 0;
+  bool name_written = false;
+};
+
+// Lock order: s_registry_mutex, then ThreadBuffer::mutex, then s_file_mutex.
+std::mutex s_registry_mutex;
+std::vector<std::shared_ptr<ThreadBuffer>> s_buffers;
+std::atomic<u32> s_next_tid = 1;
+
+std::mutex s_file_mutex;
+File::IOFile s_file;
+bool s_first_event = true;
+u64 s_session_start_ns = 0;
+
+std::atomic<bool> s_active = false;
+
+u64 NowNs()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+std::string EscapeJSON(std::string_view str)
+{
+  std::string result;
+  result.reserve(str.size());
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+      result += '\\';
+    if (static_cast<unsigned char>(c) >= 0x20)
+      result += c;
+  }
+  return result;
+}
+
+void WriteEvent(const std::string& event)
+{
+  if (!s_file.IsOpen())
+    return;
+
+  s_file.WriteString(s_first_event ? "\n" : ",\n");
+  s_file.WriteString(event);
+  s_first_event = false;
+}
+
+// Must be called with buffer.mutex held.
+void FlushBuffer(ThreadBuffer& buffer)
+{
+  std::lock_guard file_lock(s_file_mutex);
+
+  if (!buffer.name_written && !buffer.name.empty())
+  {
+    WriteEvent(fmt::format(R"({{"ph":"M","name":"thread_name","pid":1,"tid":{},)"
+                           R"("args":{{"name":"{}"}}}})",
+                           buffer.tid, EscapeJSON(buffer.name)));
+    buffer.name_written = true;
+  }
+
+  for (const Event& event : buffer.events)
+  {
+    // Zones which were open when the trace was started are clipped to its start.
+    const u64 start_ns = std::max(event.start_ns, s_session_start_ns);
+    const u64 end_ns = std::max(event.start_ns + event.duration_ns, start_ns);
+    WriteEvent(fmt::format(R"({{"ph":"X","name":"{}","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                           EscapeJSON(event.name), buffer.tid,
+                           (start_ns - s_session_start_ns) / 1000.0,
+                           (end_ns - start_ns) / 1000.0));
+  }
+  buffer.events.clear();
+}
+
+// Owns the calling thread's buffer, and writes out its remaining events when the thread exits.
+class ThreadHandle
+{
+public:
+  ThreadHandle() : m_buffer(std::make_shared<ThreadBuffer>())
+  {
+    m_buffer->tid = s_next_tid++;
+    m_buffer->events.reserve(EVENTS_PER_FLUSH);
+
+    std::lock_guard lock(s_registry_mutex);
+    s_buffers.push_back(m_buffer);
+  }
+
+  ~ThreadHandle()
+  {
+    std::lock_guard lock(s_registry_mutex);
+    {
+      std::lock_guard buffer_lock(m_buffer->mutex);
+      if (s_active.load(std::memory_order_relaxed))
+        FlushBuffer(*m_buffer);
+    }
+    s_buffers.erase(std::find(s_buffers.begin(), s_buffers.end(), m_buffer));
+  }
+
+  ThreadHandle(const ThreadHandle&) = delete;
+  ThreadHandle& operator=(const ThreadHandle&) = delete;
+
+  ThreadBuffer& GetBuffer() { return *m_buffer; }
+
+private:
+  std::shared_ptr<ThreadBuffer> m_buffer;
+};
+
+ThreadBuffer& GetThreadBuffer()
+{
+  thread_local ThreadHandle handle;
+  return handle.GetBuffer();
+}
+}  // namespace
+
+void Start(const std::string& path)
+{
+  std::lock_guard lock(s_registry_mutex);
+  if (s_active.load(std::memory_order_relaxed))
+    return;
+
+  {
+    std::lock_guard file_lock(s_file_mutex);
+    if (!s_file.Open(path, "wb"))
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to open trace file {}", path);
+      return;
+    }
+    s_file.WriteString(R"({"displayTimeUnit":"ms","traceEvents":[)");
+    s_first_event = true;
+    s_session_start_ns = NowNs();
+  }
+
+  // Drop whatever was recorded after the previous trace was stopped.
+  for (const std::shared_ptr<ThreadBuffer>& buffer : s_buffers)
+  {
+    std::lock_guard buffer_lock(buffer->mutex);
+    buffer->events.clear();
+    buffer->name_written = false;
+  }
+
+  s_active.store(true, std::memory_order_relaxed);
+  NOTICE_LOG_FMT(COMMON, "Writing trace to {}", path);
+}
+
+void Stop()
+{
+  std::lock_guard lock(s_registry_mutex);
+  if (!s_active.exchange(false, std::memory_order_relaxed))
+    return;
+
+  for (const std::shared_ptr<ThreadBuffer>& buffer : s_buffers)
+  {
+    std::lock_guard buffer_lock(buffer->mutex);
+    FlushBuffer(*buffer);
+  }
+
+  std::lock_guard file_lock(s_file_mutex);
+  s_file.WriteString("\n]}\n");
+  s_file.Close();
+}
+
+bool IsActive()
+{
+  return s_active.load(std::memory_order_relaxed);
+}
+
+void SetThreadName(const char* name)
+{
+  ThreadBuffer& buffer = GetThreadBuffer();
+  std::lock_guard lock(buffer.mutex);
+  buffer.name = name;
+  buffer.name_written = false;
+}
+
+ScopedZone::ScopedZone(const char* name)
+    : m_name(name), m_active(s_active.load(std::memory_order_relaxed))
+{
+  if (m_active)
+    m_start_ns = NowNs();
+}
+
+ScopedZone::~ScopedZone()
+{
+  if (!m_active || !s_active.load(std::memory_order_relaxed))
+    return;
+
+  const u64 end_ns = NowNs();
+  ThreadBuffer& buffer = GetThreadBuffer();
+  std::lock_guard lock(buffer.mutex);
+  buffer.events.push_back({m_name, m_start_ns, end_ns - m_start_ns});
+  if (buffer.events.size() >= EVENTS_PER_FLUSH)
+    FlushBuffer(buffer);
+}
+}  // namespace Common::Trace
+
+#endif
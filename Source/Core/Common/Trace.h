@@ -0,0 +1,55 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Scoped-zone tracing of the emulation threads, written as a Chrome trace event file which can be
+// opened in chrome://tracing or Perfetto.
+//
+// The zones are compiled in only when USE_TRACING is defined (ENABLE_TRACING in CMake), so that
+// regular builds don't pay anything for them. Zone names must be string literals, since only the
+// pointer is stored until the events are written out.
+
+#ifdef USE_TRACING
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Common::Trace
+{
+// Starts writing a trace to the file at path. Does nothing if a trace is already being written.
+void Start(const std::string& path);
+// Writes out all recorded events and closes the trace file.
+void Stop();
+bool IsActive();
+
+// Names the calling thread in the trace. Called by Common::SetCurrentThreadName.
+void SetThreadName(const char* name);
+
+class ScopedZone final
+{
+public:
+  explicit ScopedZone(const char* name);
+  ~ScopedZone();
+
+  ScopedZone(const ScopedZone&) = delete;
+  ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+  const char* m_name;
+  u64 m_start_ns = 0;
+  bool m_active;
+};
+}  // namespace Common::Trace
+
+#define TRACE_ZONE_CONCAT_INNER(a, b) a##b
+#define TRACE_ZONE_CONCAT(a, b) TRACE_ZONE_CONCAT_INNER(a, b)
+#define TRACE_ZONE(name)                                                                           \
+  const Common::Trace::ScopedZone TRACE_ZONE_CONCAT(trace_zone_, __LINE__)(name)
+
+#else
+
+#define TRACE_ZONE(name) ((void)0)
+
+#endif
@@ -236,6 +236,8 @@ void CPUInfo::Detect()
 
   model_name = ReplaceAll(model_name, ",", "_");
   cpu_id = ReplaceAll(cpu_id, ",", "_");
+
+  DetectCoreTypes();
 }
 
 std::string CPUInfo::Summarize()
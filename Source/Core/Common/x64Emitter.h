@@ -847,6 +847,8 @@ public:
   void VMULPD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void VDIVPD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void VSQRTSD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
+  void VCVTSS2SD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
+  void VCVTSD2SS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void VCMPPD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg, u8 compare);
   void VSHUFPS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg, u8 shuffle);
   void VSHUFPD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg, u8 shuffle);
@@ -22,8 +22,10 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstring>
 #include <iterator>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <variant>
@@ -41,7 +43,10 @@
 #include "Core/ARDecrypt.h"
 #include "Core/CheatCodes.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 namespace ActionReplay
 {
@@ -81,9 +86,37 @@ enum
   SUB_MASTER_CODE = 0x03,
 };
 
+// A RAM write (or fill) performed by a compiled code.
+struct CompiledWrite
+{
+  u32 address;
+  u32 value;
+  u32 count;
+  u32 size;
+};
+
+// A run of compiled writes which cover adjacent memory, along with the bytes they produce.
+struct CompiledSegment
+{
+  u32 address;
+  std::vector<u8> data;
+  size_t first_write;
+  size_t write_count;
+};
+
+// Codes which consist of nothing but RAM writes are flattened into the memory they write every
+// frame instead of being interpreted again.
+struct CompiledCode
+{
+  std::vector<CompiledWrite> writes;
+  std::vector<CompiledSegment> segments;
+};
+
 // General lock. Protects codes list and internal log.
 static std::mutex s_lock;
 static std::vector<ARCode> s_active_codes;
+// One entry per active code, or empty if it has to be rebuilt.
+static std::vector<std::optional<CompiledCode>> s_compiled_codes;
 static std::vector<ARCode> s_synced_codes;
 static std::vector<std::string> s_internal_log;
 static std::atomic<bool> s_use_internal_log{false};
@@ -123,6 +156,7 @@ void ApplyCodes(const std::vector<ARCode>& codes)
   std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                [](const ARCode& code) { return code.enabled; });
   s_active_codes.shrink_to_fit();
+  s_compiled_codes.clear();
 }
 
 void SetSyncedCodesAsActive()
@@ -130,6 +164,7 @@ void SetSyncedCodesAsActive()
   s_active_codes.clear();
   s_active_codes.reserve(s_synced_codes.size());
   s_active_codes = s_synced_codes;
+  s_compiled_codes.clear();
 }
 
 void UpdateSyncedCodes(const std::vector<ARCode>& codes)
@@ -150,6 +185,7 @@ std::vector<ARCode> ApplyAndReturnCodes(const std::vector<ARCode>& codes)
     s_active_codes.clear();
     std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                  [](const ARCode& code) { return code.enabled; });
+    s_compiled_codes.clear();
   }
   s_active_codes.shrink_to_fit();
 
@@ -166,6 +202,7 @@ void AddCode(ARCode code)
     std::lock_guard guard(s_lock);
     s_disable_logging = false;
     s_active_codes.emplace_back(std::move(code));
+    s_compiled_codes.clear();
   }
 }
 
@@ -977,6 +1014,144 @@ static bool RunCodeLocked(const ARCode& arcode)
   return true;
 }
 
+static void AddCompiledWrite(CompiledCode* code, const CompiledWrite& write)
+{
+  const bool continues_segment =
+      !code->segments.empty() &&
+      u64(code->segments.back().address) + code->segments.back().data.size() == write.address;
+  if (!continues_segment)
+    code->segments.push_back({write.address, {}, code->writes.size(), 0});
+
+  // Memory is big endian
+  CompiledSegment& segment = code->segments.back();
+  for (u32 i = 0; i < write.count; ++i)
+  {
+    for (u32 byte = write.size; byte-- > 0;)
+      segment.data.push_back(static_cast<u8>(write.value >> (byte * 8)));
+  }
+  ++segment.write_count;
+  code->writes.push_back(write);
+}
+
+static std::optional<CompiledCode> CompileCode(const ARCode& arcode)
+{
+  CompiledCode code;
+
+  for (const AREntry& entry : arcode.ops)
+  {
+    const ARAddr addr(entry.cmd_addr);
+    const u32 data = entry.value;
+
+    if (0x0 == addr)
+    {
+      const u8 zcode = data >> 29;
+      if (zcode == ZCODE_END)
+        break;
+      if (zcode == ZCODE_NORM)
+        continue;
+      return std::nullopt;
+    }
+
+    if ((addr >= 0x00002000 && addr < 0x00003000) || addr.type != 0x00 ||
+        addr.subtype != SUB_RAM_WRITE)
+    {
+      return std::nullopt;
+    }
+
+    // Same as Subtype_RamWriteAndFill
+    switch (addr.size)
+    {
+    case DATATYPE_8BIT:
+      AddCompiledWrite(&code, {addr.GCAddress(), data & 0xFF, (data >> 8) + 1, 1});
+      break;
+    case DATATYPE_16BIT:
+      AddCompiledWrite(&code, {addr.GCAddress(), data & 0xFFFF, (data >> 16) + 1, 2});
+      break;
+    case DATATYPE_32BIT_FLOAT:
+    case DATATYPE_32BIT:
+      AddCompiledWrite(&code, {addr.GCAddress(), data, 1, 4});
+      break;
+    default:
+      return std::nullopt;
+    }
+  }
+
+  return code;
+}
+
+static void RunCompiledWrite(const CompiledWrite& write)
+{
+  for (u32 i = 0; i < write.count; ++i)
+  {
+    const u32 address = write.address + i * write.size;
+    switch (write.size)
+    {
+    case 1:
+      PowerPC::HostWrite_U8(write.value, address);
+      break;
+    case 2:
+      PowerPC::HostWrite_U16(write.value, address);
+      break;
+    default:
+      PowerPC::HostWrite_U32(write.value, address);
+      break;
+    }
+  }
+}
+
+// Copies the whole segment straight into RAM. Returns false without writing anything if part of
+// it isn't backed by RAM, or if the data cache is emulated (which the pointers would bypass).
+static bool WriteSegmentToRAM(Memory::MemoryManager& memory, const CompiledSegment& segment)
+{
+  if (PowerPC::ppcState.m_enable_dcache)
+    return false;
+
+  static std::vector<u8*> s_page_pointers;
+  s_page_pointers.clear();
+
+  const u32 size = static_cast<u32>(segment.data.size());
+  for (u32 offset = 0; offset < size;)
+  {
+    const u32 address = segment.address + offset;
+    u8* const pointer = PowerPC::HostGetRAMPointer(address);
+    if (!pointer)
+      return false;
+    s_page_pointers.push_back(pointer);
+    offset += static_cast<u32>(PowerPC::HW_PAGE_SIZE - (address & PowerPC::HW_PAGE_MASK));
+  }
+
+  u32 offset = 0;
+  for (u8* const pointer : s_page_pointers)
+  {
+    const u32 address = segment.address + offset;
+    const u32 length = std::min(
+        size - offset, static_cast<u32>(PowerPC::HW_PAGE_SIZE - (address & PowerPC::HW_PAGE_MASK)));
+    std::memcpy(pointer, segment.data.data() + offset, length);
+
+    const u8* const ram = memory.GetRAM();
+    if (pointer >= ram && pointer < ram + memory.GetRamSize())
+      memory.MarkWritten(static_cast<u32>(pointer - ram), length);
+    else
+      memory.MarkWritten(static_cast<u32>(pointer - memory.GetEXRAM()) | 0x10000000, length);
+
+    offset += length;
+  }
+
+  return true;
+}
+
+static void RunCompiledCode(Memory::MemoryManager& memory, const CompiledCode& code)
+{
+  for (const CompiledSegment& segment : code.segments)
+  {
+    if (WriteSegmentToRAM(memory, segment))
+      continue;
+
+    for (size_t i = 0; i < segment.write_count; ++i)
+      RunCompiledWrite(code.writes[segment.first_write + i]);
+  }
+}
+
 void RunAllActive()
 {
   if (!Config::Get(Config::MAIN_ENABLE_CHEATS))
@@ -986,13 +1161,43 @@ void RunAllActive()
   // are only atomic ops unless contested. It should be rare for this to
   // be contested.
   std::lock_guard guard(s_lock);
-  s_active_codes.erase(std::remove_if(s_active_codes.begin(), s_active_codes.end(),
-                                      [](const ARCode& code) {
-                                        bool success = RunCodeLocked(code);
-                                        LogInfo("\n");
-                                        return !success;
-                                      }),
-                       s_active_codes.end());
+
+  // Codes are always interpreted while logging, so that the log shows what they do.
+  const bool use_compiled_codes = s_disable_logging;
+  if (use_compiled_codes && s_compiled_codes.size() != s_active_codes.size())
+  {
+    s_compiled_codes.clear();
+    s_compiled_codes.reserve(s_active_codes.size());
+    for (const ARCode& code : s_active_codes)
+      s_compiled_codes.push_back(CompileCode(code));
+  }
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  size_t kept_codes = 0;
+  for (size_t i = 0; i < s_active_codes.size(); ++i)
+  {
+    if (use_compiled_codes && s_compiled_codes[i])
+    {
+      RunCompiledCode(memory, *s_compiled_codes[i]);
+    }
+    else
+    {
+      const bool success = RunCodeLocked(s_active_codes[i]);
+      LogInfo("\n");
+      if (!success)
+        continue;
+    }
+
+    if (kept_codes != i)
+      s_active_codes[kept_codes] = std::move(s_active_codes[i]);
+    ++kept_codes;
+  }
+
+  if (kept_codes != s_active_codes.size())
+  {
+    s_active_codes.resize(kept_codes);
+    s_compiled_codes.clear();
+  }
   s_disable_logging = true;
 }
 
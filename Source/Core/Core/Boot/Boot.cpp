@@ -172,6 +172,16 @@ void BootSessionData::SetNetplaySettings(std::unique_ptr<NetPlay::NetSettings> n
   m_netplay_settings = std::move(netplay_settings);
 }
 
+std::vector<u8>* BootSessionData::GetNetplayState()
+{
+  return m_netplay_state ? &*m_netplay_state : nullptr;
+}
+
+void BootSessionData::SetNetplayState(std::vector<u8> state)
+{
+  m_netplay_state = std::move(state);
+}
+
 BootParameters::BootParameters(Parameters&& parameters_, BootSessionData boot_session_data_)
     : parameters(std::move(parameters_)), boot_session_data(std::move(boot_session_data_))
 {
@@ -89,6 +89,10 @@ public:
   const NetPlay::NetSettings* GetNetplaySettings() const;
   void SetNetplaySettings(std::unique_ptr<NetPlay::NetSettings> netplay_settings);
 
+  // A state which every NetPlay player loads after booting, to resume from where the host was.
+  std::vector<u8>* GetNetplayState();
+  void SetNetplayState(std::vector<u8> state);
+
 private:
   std::optional<std::string> m_savestate_path;
   DeleteSavestateAfterBoot m_delete_savestate = DeleteSavestateAfterBoot::No;
@@ -99,6 +103,7 @@ private:
   WiiSyncCleanupFunction m_wii_sync_cleanup;
 
   std::unique_ptr<NetPlay::NetSettings> m_netplay_settings;
+  std::optional<std::vector<u8>> m_netplay_state;
 };
 
 struct BootParameters
@@ -3,11 +3,15 @@
 
 #include "Core/CheatSearch.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -15,6 +19,7 @@
 #include "Common/Align.h"
 #include "Common/BitUtils.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
 
 #include "Core/Core.h"
 #include "Core/HW/Memmap.h"
@@ -186,6 +191,142 @@ TryReadValueFromEmulatedMemory(u32 addr, PowerPC::RequestedAddressSpace space)
 {
   return PowerPC::HostTryReadF64(addr, space);
 }
+
+// Whether addresses in the given address space go through the MMU, given the current MSR.DR.
+bool IsTranslated(PowerPC::RequestedAddressSpace address_space, bool data_translation)
+{
+  return address_space == PowerPC::RequestedAddressSpace::Virtual ||
+         (address_space == PowerPC::RequestedAddressSpace::Effective && data_translation);
+}
+
+// New searches are split into chunks of this many pages, which are searched on several threads.
+constexpr u64 SEARCH_CHUNK_PAGES = 64;
+constexpr size_t MAX_SEARCH_THREADS = 8;
+
+template <typename T>
+T ReadValueFromPages(const std::vector<u8*>& pages, u64 offset)
+{
+  const size_t page = offset / PowerPC::HW_PAGE_SIZE;
+  const size_t offset_in_page = offset % PowerPC::HW_PAGE_SIZE;
+
+  T value;
+  if (offset_in_page + sizeof(T) <= PowerPC::HW_PAGE_SIZE)
+  {
+    std::memcpy(&value, pages[page] + offset_in_page, sizeof(T));
+  }
+  else
+  {
+    const size_t first_part = PowerPC::HW_PAGE_SIZE - offset_in_page;
+    std::memcpy(&value, pages[page] + offset_in_page, first_part);
+    std::memcpy(reinterpret_cast<u8*>(&value) + first_part, pages[page + 1],
+                sizeof(T) - first_part);
+  }
+  return Common::FromBigEndian(value);
+}
+
+// Searches the values starting at start_address + i for every i < length that is a multiple of
+// increment. Pages which are backed by MEM1 or MEM2 are translated once and read directly from
+// host memory on worker threads, and everything else goes through the regular host read functions
+// on the calling thread.
+template <typename T>
+void SearchRange(u32 start_address, u64 length, u32 increment,
+                 PowerPC::RequestedAddressSpace address_space, bool translated,
+                 bool use_host_memory, const std::function<bool(const T& value)>& validator,
+                 std::vector<Cheats::SearchResult<T>>* results)
+{
+  const u64 first_page = start_address / PowerPC::HW_PAGE_SIZE;
+  const u64 end_address = u64(start_address) + length + sizeof(T) - 1;
+  const u64 num_pages = (end_address + PowerPC::HW_PAGE_MASK) / PowerPC::HW_PAGE_SIZE - first_page;
+  const u64 base_address = first_page * PowerPC::HW_PAGE_SIZE;
+
+  std::vector<u8*> pages(num_pages);
+  if (use_host_memory)
+  {
+    for (u64 i = 0; i < num_pages; ++i)
+    {
+      const u32 page_address = static_cast<u32>(base_address + i * PowerPC::HW_PAGE_SIZE);
+      pages[i] = PowerPC::HostGetRAMPointer(page_address, address_space);
+    }
+  }
+
+  const Cheats::SearchResultValueState value_state =
+      translated ? Cheats::SearchResultValueState::ValueFromVirtualMemory :
+                   Cheats::SearchResultValueState::ValueFromPhysicalMemory;
+  const u64 num_chunks = (num_pages + SEARCH_CHUNK_PAGES - 1) / SEARCH_CHUNK_PAGES;
+  std::vector<std::vector<Cheats::SearchResult<T>>> chunk_results(num_chunks);
+  std::vector<bool> chunk_in_host_memory(num_chunks);
+
+  for (u64 chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    // Values starting in the last page of a chunk may extend into the next one.
+    const u64 first = chunk * SEARCH_CHUNK_PAGES;
+    const u64 last = std::min(first + SEARCH_CHUNK_PAGES, num_pages - 1);
+    chunk_in_host_memory[chunk] =
+        std::all_of(pages.begin() + first, pages.begin() + last + 1, [](u8* p) { return p; });
+  }
+
+  const auto search_chunk = [&](u64 chunk) {
+    const u64 chunk_start = base_address + chunk * SEARCH_CHUNK_PAGES * PowerPC::HW_PAGE_SIZE;
+    const u64 chunk_end = chunk_start + SEARCH_CHUNK_PAGES * PowerPC::HW_PAGE_SIZE;
+    const u64 begin = Common::AlignUp(std::max<u64>(chunk_start, start_address) - start_address,
+                                      increment);
+    const u64 end = std::min<u64>(chunk_end - start_address, length);
+
+    std::vector<Cheats::SearchResult<T>>& chunk_result = chunk_results[chunk];
+    for (u64 i = begin; i < end; i += increment)
+    {
+      const u32 addr = static_cast<u32>(start_address + i);
+      if (chunk_in_host_memory[chunk])
+      {
+        const T value = ReadValueFromPages<T>(pages, start_address + i - base_address);
+        if (validator(value))
+          chunk_result.push_back({value, value_state, addr});
+        continue;
+      }
+
+      const auto current_value = TryReadValueFromEmulatedMemory<T>(addr, address_space);
+      if (current_value && validator(current_value->value))
+      {
+        chunk_result.push_back({current_value->value,
+                                current_value->translated ?
+                                    Cheats::SearchResultValueState::ValueFromVirtualMemory :
+                                    Cheats::SearchResultValueState::ValueFromPhysicalMemory,
+                                addr});
+      }
+    }
+  };
+
+  std::atomic<u64> next_chunk = 0;
+  const auto search_host_chunks = [&] {
+    for (u64 chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++)
+    {
+      if (chunk_in_host_memory[chunk])
+        search_chunk(chunk);
+    }
+  };
+  const size_t num_threads =
+      std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MAX_SEARCH_THREADS);
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < std::min<u64>(num_threads, num_chunks); ++i)
+    threads.emplace_back(search_host_chunks);
+  search_host_chunks();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  // The host read functions use the emulated MMU state, so they must stay on this thread.
+  for (u64 chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    if (!chunk_in_host_memory[chunk])
+      search_chunk(chunk);
+  }
+
+  size_t total_results = results->size();
+  for (const auto& chunk_result : chunk_results)
+    total_results += chunk_result.size();
+  results->reserve(total_results);
+  for (auto& chunk_result : chunk_results)
+    results->insert(results->end(), chunk_result.begin(), chunk_result.end());
+}
 }  // namespace
 
 template <typename T>
@@ -213,6 +354,10 @@ Cheats::NewSearch(const std::vector<Cheats::MemoryRange>& memory_ranges,
       return;
     }
 
+    // Reading host memory directly would skip the emulated dcache.
+    const bool use_host_memory = !ppc_state.m_enable_dcache;
+    const bool translated = IsTranslated(address_space, ppc_state.msr.DR);
+
     for (const Cheats::MemoryRange& range : memory_ranges)
     {
       if (range.m_length < data_size)
@@ -226,23 +371,8 @@ Cheats::NewSearch(const std::vector<Cheats::MemoryRange>& memory_ranges,
         continue;
 
       const u64 length = aligned_length - (data_size - 1);
-      for (u64 i = 0; i < length; i += increment_per_loop)
-      {
-        const u32 addr = start_address + i;
-        const auto current_value = TryReadValueFromEmulatedMemory<T>(addr, address_space);
-        if (!current_value)
-          continue;
-
-        if (validator(current_value->value))
-        {
-          auto& r = results.emplace_back();
-          r.m_value = current_value->value;
-          r.m_value_state = current_value->translated ?
-                                Cheats::SearchResultValueState::ValueFromVirtualMemory :
-                                Cheats::SearchResultValueState::ValueFromPhysicalMemory;
-          r.m_address = addr;
-        }
-      }
+      SearchRange<T>(start_address, length, increment_per_loop, address_space, translated,
+                     use_host_memory, validator, &results);
     }
   });
   if (error_code == Cheats::SearchErrorCode::Success)
@@ -274,10 +404,35 @@ Cheats::NextSearch(const std::vector<Cheats::SearchResult<T>>& previous_results,
       return;
     }
 
+    // Previous results are sorted by address, so most of them share a page with the result before
+    // them and the page only has to be translated once.
+    const bool use_host_memory = !ppc_state.m_enable_dcache;
+    const bool translated = IsTranslated(address_space, ppc_state.msr.DR);
+    std::optional<u32> cached_page;
+    u8* cached_page_pointer = nullptr;
+
     for (const auto& previous_result : previous_results)
     {
       const u32 addr = previous_result.m_address;
-      const auto current_value = TryReadValueFromEmulatedMemory<T>(addr, address_space);
+      std::optional<PowerPC::ReadResult<T>> current_value;
+      const u32 offset_in_page = addr & PowerPC::HW_PAGE_MASK;
+      if (use_host_memory && offset_in_page + sizeof(T) <= PowerPC::HW_PAGE_SIZE)
+      {
+        const u32 page = addr - offset_in_page;
+        if (cached_page != page)
+        {
+          cached_page = page;
+          cached_page_pointer = PowerPC::HostGetRAMPointer(page, address_space);
+        }
+        if (cached_page_pointer)
+        {
+          T value;
+          std::memcpy(&value, cached_page_pointer + offset_in_page, sizeof(T));
+          current_value.emplace(translated, Common::FromBigEndian(value));
+        }
+      }
+      if (!current_value)
+        current_value = TryReadValueFromEmulatedMemory<T>(addr, address_space);
       if (!current_value)
       {
         auto& r = results.emplace_back();
@@ -36,13 +36,31 @@ const Info<bool> MAIN_SKIP_IPL{{System::Main, "Core", "SkipIPL"}, true};
 const Info<PowerPC::CPUCore> MAIN_CPU_CORE{{System::Main, "Core", "CPUCore"},
                                            PowerPC::DefaultCPUCore()};
 const Info<bool> MAIN_JIT_FOLLOW_BRANCH{{System::Main, "Core", "JITFollowBranch"}, true};
+const Info<bool> MAIN_JIT_PERSISTENT_BLOCK_CACHE{{System::Main, "Core", "JITPersistentBlockCache"},
+                                                 false};
+const Info<bool> MAIN_JIT_TIERED_COMPILATION{{System::Main, "Core", "JITTieredCompilation"}, false};
+const Info<bool> MAIN_JIT_BRANCH_PROFILING{{System::Main, "Core", "JITBranchProfiling"}, false};
+const Info<bool> MAIN_JIT_REGISTER_CONTRACTS{{System::Main, "Core", "JITRegisterContracts"}, false};
+const Info<bool> MAIN_JIT_GENERATIONAL_CODE_SPACE{
+    {System::Main, "Core", "JITGenerationalCodeSpace"}, false};
+const Info<bool> MAIN_JIT_FULL_BLOCK_MAP{{System::Main, "Core", "JITFullBlockMap"}, false};
+const Info<int> MAIN_JIT_BLOCK_ALIGNMENT{{System::Main, "Core", "JITBlockAlignment"}, 16};
 const Info<bool> MAIN_FASTMEM{{System::Main, "Core", "Fastmem"}, true};
+const Info<bool> MAIN_PAGE_TABLE_FASTMEM{{System::Main, "Core", "PageTableFastmem"}, false};
+const Info<bool> MAIN_CODE_WRITE_PROTECTION{{System::Main, "Core", "CodeWriteProtection"}, false};
+const Info<bool> MAIN_HUGE_PAGES{{System::Main, "Core", "HugePages"}, false};
+const Info<int> MAIN_MMU_TRANSLATION_CACHE_SIZE{
+    {System::Main, "Core", "MMUTranslationCacheSize"}, 1024};
 const Info<bool> MAIN_ACCURATE_CPU_CACHE{{System::Main, "Core", "AccurateCPUCache"}, false};
+const Info<bool> MAIN_HLE_LIBC_FUNCTIONS{{System::Main, "Core", "HLELibCFunctions"}, false};
 const Info<bool> MAIN_DSP_HLE{{System::Main, "Core", "DSPHLE"}, true};
 const Info<int> MAIN_MAX_FALLBACK{{System::Main, "Core", "MaxFallback"}, 100};
 const Info<int> MAIN_TIMING_VARIANCE{{System::Main, "Core", "TimingVariance"}, 40};
+const Info<bool> MAIN_PRECISE_THROTTLE{{System::Main, "Core", "PreciseThrottle"}, false};
 const Info<bool> MAIN_CPU_THREAD{{System::Main, "Core", "CPUThread"}, true};
 const Info<bool> MAIN_SYNC_ON_SKIP_IDLE{{System::Main, "Core", "SyncOnSkipIdle"}, true};
+const Info<bool> MAIN_COALESCE_EVENTS{{System::Main, "Core", "CoalesceEvents"}, false};
+const Info<bool> MAIN_THREAD_PLACEMENT{{System::Main, "Core", "ThreadPlacement"}, false};
 const Info<std::string> MAIN_DEFAULT_ISO{{System::Main, "Core", "DefaultISO"}, ""};
 const Info<bool> MAIN_ENABLE_CHEATS{{System::Main, "Core", "EnableCheats"}, false};
 const Info<int> MAIN_GC_LANGUAGE{{System::Main, "Core", "SelectedLanguage"}, 0};
@@ -54,6 +72,7 @@ const Info<AudioCommon::DPL2Quality> MAIN_DPL2_QUALITY{{System::Main, "Core", "D
 const Info<int> MAIN_AUDIO_LATENCY{{System::Main, "Core", "AudioLatency"}, 20};
 const Info<bool> MAIN_AUDIO_STRETCH{{System::Main, "Core", "AudioStretch"}, false};
 const Info<int> MAIN_AUDIO_STRETCH_LATENCY{{System::Main, "Core", "AudioStretchMaxLatency"}, 80};
+const Info<bool> MAIN_AUDIO_LOW_LATENCY{{System::Main, "Core", "AudioLowLatency"}, false};
 const Info<std::string> MAIN_MEMCARD_A_PATH{{System::Main, "Core", "MemcardAPath"}, ""};
 const Info<std::string> MAIN_MEMCARD_B_PATH{{System::Main, "Core", "MemcardBPath"}, ""};
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot)
@@ -161,6 +180,9 @@ const Info<bool>& GetInfoForAdapterRumble(int channel)
   return infos[channel];
 }
 
+const Info<bool> MAIN_ADAPTER_LOW_LATENCY_POLLING{
+    {System::Main, "Core", "AdapterLowLatencyPolling"}, false};
+
 const Info<bool>& GetInfoForSimulateKonga(int channel)
 {
   static const std::array<const Info<bool>, 4> infos{
@@ -188,7 +210,10 @@ const Info<bool> MAIN_SYNC_GPU{{System::Main, "Core", "SyncGPU"}, false};
 const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE{{System::Main, "Core", "SyncGpuMaxDistance"}, 200000};
 const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE{{System::Main, "Core", "SyncGpuMinDistance"}, -200000};
 const Info<float> MAIN_SYNC_GPU_OVERCLOCK{{System::Main, "Core", "SyncGpuOverclock"}, 1.0f};
+const Info<int> MAIN_GPU_THREAD_SPIN_TIME{{System::Main, "Core", "GPUThreadSpinTime"}, 0};
+const Info<bool> MAIN_GPU_PREDECODE_THREAD{{System::Main, "Core", "GPUPredecodeThread"}, false};
 const Info<bool> MAIN_FAST_DISC_SPEED{{System::Main, "Core", "FastDiscSpeed"}, false};
+const Info<bool> MAIN_DISC_ACCESS_TRACE{{System::Main, "Core", "DiscAccessTrace"}, false};
 const Info<bool> MAIN_LOW_DCBZ_HACK{{System::Main, "Core", "LowDCBZHack"}, false};
 const Info<bool> MAIN_FLOAT_EXCEPTIONS{{System::Main, "Core", "FloatExceptions"}, false};
 const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS{{System::Main, "Core", "DivByZeroExceptions"},
@@ -227,6 +252,11 @@ GPUDeterminismMode GetGPUDeterminismMode()
 }
 
 const Info<std::string> MAIN_PERF_MAP_DIR{{System::Main, "Core", "PerfMapDir"}, ""};
+const Info<bool> MAIN_PERF_JITDUMP{{System::Main, "Core", "PerfJitDump"}, false};
+const Info<std::string> MAIN_METRICS_EXPORT_PATH{{System::Main, "Core", "MetricsExportPath"}, ""};
+// In milliseconds.
+const Info<u32> MAIN_METRICS_EXPORT_INTERVAL{{System::Main, "Core", "MetricsExportInterval"},
+                                             1000};
 const Info<bool> MAIN_CUSTOM_RTC_ENABLE{{System::Main, "Core", "EnableCustomRTC"}, false};
 // Measured in seconds since the unix epoch (1.1.1970).  Default is 1.1.2000; there are 7 leap years
 // between those dates.
@@ -237,6 +267,12 @@ const Info<DiscIO::Region> MAIN_FALLBACK_REGION{{System::Main, "Core", "Fallback
 const Info<bool> MAIN_AUTO_DISC_CHANGE{{System::Main, "Core", "AutoDiscChange"}, false};
 const Info<bool> MAIN_ALLOW_SD_WRITES{{System::Main, "Core", "WiiSDCardAllowWrites"}, true};
 const Info<bool> MAIN_ENABLE_SAVESTATES{{System::Main, "Core", "EnableSaveStates"}, false};
+const Info<int> MAIN_SAVESTATE_COMPRESSION_LEVEL{
+    {System::Main, "Core", "SaveStateCompressionLevel"}, 1};
+const Info<bool> MAIN_REWIND_ENABLED{{System::Main, "Core", "RewindEnabled"}, false};
+const Info<int> MAIN_REWIND_INTERVAL{{System::Main, "Core", "RewindInterval"}, 10};
+const Info<int> MAIN_REWIND_BUFFER_SIZE{{System::Main, "Core", "RewindBufferSize"}, 256};
+const Info<int> MAIN_RUN_AHEAD_FIELDS{{System::Main, "Core", "RunAheadFields"}, 0};
 const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS{
     {System::Main, "Core", "RealWiiRemoteRepeatReports"}, true};
 
@@ -261,6 +297,7 @@ const Info<bool> MAIN_DISABLE_SCREENSAVER{{System::Main, "Display", "DisableScre
 // Main.DSP
 
 const Info<bool> MAIN_DSP_THREAD{{System::Main, "DSP", "DSPThread"}, false};
+const Info<bool> MAIN_DSP_HLE_THREAD{{System::Main, "DSP", "HLEThread"}, false};
 const Info<bool> MAIN_DSP_CAPTURE_LOG{{System::Main, "DSP", "CaptureLog"}, false};
 const Info<bool> MAIN_DSP_JIT{{System::Main, "DSP", "EnableJIT"}, true};
 const Info<bool> MAIN_DUMP_AUDIO{{System::Main, "DSP", "DumpAudio"}, false};
@@ -469,6 +506,9 @@ const Info<bool> MAIN_MOVIE_DUMP_FRAMES_SILENT{{System::Main, "Movie", "DumpFram
 const Info<bool> MAIN_MOVIE_SHOW_INPUT_DISPLAY{{System::Main, "Movie", "ShowInputDisplay"}, false};
 const Info<bool> MAIN_MOVIE_SHOW_RTC{{System::Main, "Movie", "ShowRTC"}, false};
 const Info<bool> MAIN_MOVIE_SHOW_RERECORD{{System::Main, "Movie", "ShowRerecord"}, false};
+const Info<bool> MAIN_MOVIE_COMPACT_FORMAT{{System::Main, "Movie", "CompactFormat"}, false};
+const Info<u32> MAIN_MOVIE_CHECKPOINT_INTERVAL{{System::Main, "Movie", "CheckpointInterval"},
+                                               3600};
 
 // Main.Input
 
@@ -497,6 +537,9 @@ const Info<bool> MAIN_DEBUG_JIT_SYSTEM_REGISTERS_OFF{
 const Info<bool> MAIN_DEBUG_JIT_BRANCH_OFF{{System::Main, "Debug", "JitBranchOff"}, false};
 const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF{{System::Main, "Debug", "JitRegisterCacheOff"},
                                                    false};
+const Info<bool> MAIN_DEBUG_JIT_SAMPLING_PROFILER{{System::Main, "Debug", "JitSamplingProfiler"},
+                                                  false};
+const Info<bool> MAIN_DEBUG_JIT_EVENT_COUNTERS{{System::Main, "Debug", "JitEventCounters"}, false};
 
 // Main.BluetoothPassthrough
 
@@ -54,14 +54,30 @@ namespace Config
 extern const Info<bool> MAIN_SKIP_IPL;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
+extern const Info<bool> MAIN_JIT_PERSISTENT_BLOCK_CACHE;
+extern const Info<bool> MAIN_JIT_TIERED_COMPILATION;
+extern const Info<bool> MAIN_JIT_BRANCH_PROFILING;
+extern const Info<bool> MAIN_JIT_REGISTER_CONTRACTS;
+extern const Info<bool> MAIN_JIT_GENERATIONAL_CODE_SPACE;
+extern const Info<bool> MAIN_JIT_FULL_BLOCK_MAP;
+extern const Info<int> MAIN_JIT_BLOCK_ALIGNMENT;
 extern const Info<bool> MAIN_FASTMEM;
+extern const Info<bool> MAIN_PAGE_TABLE_FASTMEM;
+extern const Info<bool> MAIN_CODE_WRITE_PROTECTION;
+extern const Info<bool> MAIN_HUGE_PAGES;
+extern const Info<int> MAIN_MMU_TRANSLATION_CACHE_SIZE;
 extern const Info<bool> MAIN_ACCURATE_CPU_CACHE;
+extern const Info<bool> MAIN_HLE_LIBC_FUNCTIONS;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
 extern const Info<bool> MAIN_DSP_HLE;
 extern const Info<int> MAIN_MAX_FALLBACK;
 extern const Info<int> MAIN_TIMING_VARIANCE;
+extern const Info<bool> MAIN_PRECISE_THROTTLE;
 extern const Info<bool> MAIN_CPU_THREAD;
 extern const Info<bool> MAIN_SYNC_ON_SKIP_IDLE;
+extern const Info<bool> MAIN_COALESCE_EVENTS;
+// Keeps emulation threads on performance cores and background threads on efficiency cores.
+extern const Info<bool> MAIN_THREAD_PLACEMENT;
 extern const Info<std::string> MAIN_DEFAULT_ISO;
 extern const Info<bool> MAIN_ENABLE_CHEATS;
 extern const Info<int> MAIN_GC_LANGUAGE;
@@ -71,6 +87,7 @@ extern const Info<AudioCommon::DPL2Quality> MAIN_DPL2_QUALITY;
 extern const Info<int> MAIN_AUDIO_LATENCY;
 extern const Info<bool> MAIN_AUDIO_STRETCH;
 extern const Info<int> MAIN_AUDIO_STRETCH_LATENCY;
+extern const Info<bool> MAIN_AUDIO_LOW_LATENCY;
 extern const Info<std::string> MAIN_MEMCARD_A_PATH;
 extern const Info<std::string> MAIN_MEMCARD_B_PATH;
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot);
@@ -95,6 +112,7 @@ extern const Info<std::string> MAIN_BBA_BUILTIN_DNS;
 extern const Info<std::string> MAIN_BBA_BUILTIN_IP;
 const Info<SerialInterface::SIDevices>& GetInfoForSIDevice(int channel);
 const Info<bool>& GetInfoForAdapterRumble(int channel);
+extern const Info<bool> MAIN_ADAPTER_LOW_LATENCY_POLLING;
 const Info<bool>& GetInfoForSimulateKonga(int channel);
 extern const Info<bool> MAIN_WII_SD_CARD;
 extern const Info<bool> MAIN_WII_SD_CARD_ENABLE_FOLDER_SYNC;
@@ -109,7 +127,10 @@ extern const Info<bool> MAIN_SYNC_GPU;
 extern const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const Info<float> MAIN_SYNC_GPU_OVERCLOCK;
+extern const Info<int> MAIN_GPU_THREAD_SPIN_TIME;
+extern const Info<bool> MAIN_GPU_PREDECODE_THREAD;
 extern const Info<bool> MAIN_FAST_DISC_SPEED;
+extern const Info<bool> MAIN_DISC_ACCESS_TRACE;
 extern const Info<bool> MAIN_LOW_DCBZ_HACK;
 extern const Info<bool> MAIN_FLOAT_EXCEPTIONS;
 extern const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS;
@@ -139,11 +160,22 @@ extern const Info<std::string> MAIN_GPU_DETERMINISM_MODE;
 GPUDeterminismMode GetGPUDeterminismMode();
 
 extern const Info<std::string> MAIN_PERF_MAP_DIR;
+extern const Info<bool> MAIN_PERF_JITDUMP;
+extern const Info<std::string> MAIN_METRICS_EXPORT_PATH;
+extern const Info<u32> MAIN_METRICS_EXPORT_INTERVAL;
 extern const Info<bool> MAIN_CUSTOM_RTC_ENABLE;
 extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+extern const Info<int> MAIN_SAVESTATE_COMPRESSION_LEVEL;
+extern const Info<bool> MAIN_REWIND_ENABLED;
+// In emulated fields (half-frames for interlaced video modes)
+extern const Info<int> MAIN_REWIND_INTERVAL;
+// In MiB
+extern const Info<int> MAIN_REWIND_BUFFER_SIZE;
+// In emulated fields, 0 disables run-ahead
+extern const Info<int> MAIN_RUN_AHEAD_FIELDS;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
@@ -152,6 +184,7 @@ extern const Info<std::string> MAIN_WII_NUS_SHOP_URL;
 // Main.DSP
 
 extern const Info<bool> MAIN_DSP_THREAD;
+extern const Info<bool> MAIN_DSP_HLE_THREAD;
 extern const Info<bool> MAIN_DSP_CAPTURE_LOG;
 extern const Info<bool> MAIN_DSP_JIT;
 extern const Info<bool> MAIN_DUMP_AUDIO;
@@ -307,6 +340,9 @@ extern const Info<bool> MAIN_MOVIE_DUMP_FRAMES_SILENT;
 extern const Info<bool> MAIN_MOVIE_SHOW_INPUT_DISPLAY;
 extern const Info<bool> MAIN_MOVIE_SHOW_RTC;
 extern const Info<bool> MAIN_MOVIE_SHOW_RERECORD;
+extern const Info<bool> MAIN_MOVIE_COMPACT_FORMAT;
+// In frames. 0 disables checkpoints.
+extern const Info<u32> MAIN_MOVIE_CHECKPOINT_INTERVAL;
 
 // Main.Input
 
@@ -327,6 +363,8 @@ extern const Info<bool> MAIN_DEBUG_JIT_PAIRED_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_SYSTEM_REGISTERS_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_BRANCH_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF;
+extern const Info<bool> MAIN_DEBUG_JIT_SAMPLING_PROFILER;
+extern const Info<bool> MAIN_DEBUG_JIT_EVENT_COUNTERS;
 
 // Main.BluetoothPassthrough
 
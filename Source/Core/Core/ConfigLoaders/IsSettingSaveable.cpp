@@ -66,6 +66,7 @@ bool IsSettingSaveable(const Config::Location& config_location)
       &Config::MAIN_AUDIO_LATENCY.GetLocation(),
       &Config::MAIN_AUDIO_STRETCH.GetLocation(),
       &Config::MAIN_AUDIO_STRETCH_LATENCY.GetLocation(),
+      &Config::MAIN_AUDIO_LOW_LATENCY.GetLocation(),
       &Config::MAIN_OVERCLOCK.GetLocation(),
       &Config::MAIN_OVERCLOCK_ENABLE.GetLocation(),
       &Config::MAIN_RAM_OVERRIDE_ENABLE.GetLocation(),
@@ -73,6 +74,11 @@ bool IsSettingSaveable(const Config::Location& config_location)
       &Config::MAIN_MEM2_SIZE.GetLocation(),
       &Config::MAIN_GFX_BACKEND.GetLocation(),
       &Config::MAIN_ENABLE_SAVESTATES.GetLocation(),
+      &Config::MAIN_SAVESTATE_COMPRESSION_LEVEL.GetLocation(),
+      &Config::MAIN_REWIND_ENABLED.GetLocation(),
+      &Config::MAIN_REWIND_INTERVAL.GetLocation(),
+      &Config::MAIN_REWIND_BUFFER_SIZE.GetLocation(),
+      &Config::MAIN_RUN_AHEAD_FIELDS.GetLocation(),
       &Config::MAIN_FALLBACK_REGION.GetLocation(),
       &Config::MAIN_REAL_WII_REMOTE_REPEAT_REPORTS.GetLocation(),
       &Config::MAIN_DSP_HLE.GetLocation(),
@@ -90,6 +96,13 @@ bool IsSettingSaveable(const Config::Location& config_location)
       &Config::MAIN_CUSTOM_RTC_ENABLE.GetLocation(),
       &Config::MAIN_CUSTOM_RTC_VALUE.GetLocation(),
       &Config::MAIN_JIT_FOLLOW_BRANCH.GetLocation(),
+      &Config::MAIN_JIT_PERSISTENT_BLOCK_CACHE.GetLocation(),
+      &Config::MAIN_JIT_TIERED_COMPILATION.GetLocation(),
+      &Config::MAIN_JIT_BRANCH_PROFILING.GetLocation(),
+      &Config::MAIN_JIT_REGISTER_CONTRACTS.GetLocation(),
+      &Config::MAIN_JIT_GENERATIONAL_CODE_SPACE.GetLocation(),
+      &Config::MAIN_JIT_FULL_BLOCK_MAP.GetLocation(),
+      &Config::MAIN_JIT_BLOCK_ALIGNMENT.GetLocation(),
       &Config::MAIN_FLOAT_EXCEPTIONS.GetLocation(),
       &Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS.GetLocation(),
       &Config::MAIN_LOW_DCBZ_HACK.GetLocation(),
@@ -99,18 +112,32 @@ bool IsSettingSaveable(const Config::Location& config_location)
       &Config::GetInfoForAdapterRumble(1).GetLocation(),
       &Config::GetInfoForAdapterRumble(2).GetLocation(),
       &Config::GetInfoForAdapterRumble(3).GetLocation(),
+      &Config::MAIN_ADAPTER_LOW_LATENCY_POLLING.GetLocation(),
       &Config::GetInfoForSimulateKonga(0).GetLocation(),
       &Config::GetInfoForSimulateKonga(1).GetLocation(),
       &Config::GetInfoForSimulateKonga(2).GetLocation(),
       &Config::GetInfoForSimulateKonga(3).GetLocation(),
       &Config::MAIN_EMULATION_SPEED.GetLocation(),
       &Config::MAIN_PERF_MAP_DIR.GetLocation(),
+      &Config::MAIN_PERF_JITDUMP.GetLocation(),
+      &Config::MAIN_METRICS_EXPORT_PATH.GetLocation(),
+      &Config::MAIN_METRICS_EXPORT_INTERVAL.GetLocation(),
       &Config::MAIN_GPU_DETERMINISM_MODE.GetLocation(),
       &Config::MAIN_DISABLE_ICACHE.GetLocation(),
       &Config::MAIN_FAST_DISC_SPEED.GetLocation(),
+      &Config::MAIN_DISC_ACCESS_TRACE.GetLocation(),
       &Config::MAIN_SYNC_ON_SKIP_IDLE.GetLocation(),
+      &Config::MAIN_COALESCE_EVENTS.GetLocation(),
+      &Config::MAIN_THREAD_PLACEMENT.GetLocation(),
+      &Config::MAIN_GPU_THREAD_SPIN_TIME.GetLocation(),
+      &Config::MAIN_GPU_PREDECODE_THREAD.GetLocation(),
       &Config::MAIN_FASTMEM.GetLocation(),
+      &Config::MAIN_PAGE_TABLE_FASTMEM.GetLocation(),
+      &Config::MAIN_CODE_WRITE_PROTECTION.GetLocation(),
+      &Config::MAIN_HUGE_PAGES.GetLocation(),
+      &Config::MAIN_MMU_TRANSLATION_CACHE_SIZE.GetLocation(),
       &Config::MAIN_TIMING_VARIANCE.GetLocation(),
+      &Config::MAIN_PRECISE_THROTTLE.GetLocation(),
       &Config::MAIN_MAX_FALLBACK.GetLocation(),
       &Config::MAIN_WII_SD_CARD.GetLocation(),
       &Config::MAIN_WII_SD_CARD_ENABLE_FOLDER_SYNC.GetLocation(),
@@ -129,6 +156,7 @@ bool IsSettingSaveable(const Config::Location& config_location)
       &Config::MAIN_MMU.GetLocation(),
       &Config::MAIN_PAUSE_ON_PANIC.GetLocation(),
       &Config::MAIN_ACCURATE_CPU_CACHE.GetLocation(),
+      &Config::MAIN_HLE_LIBC_FUNCTIONS.GetLocation(),
       &Config::MAIN_BB_DUMP_PORT.GetLocation(),
       &Config::MAIN_SYNC_GPU.GetLocation(),
       &Config::MAIN_SYNC_GPU_MAX_DISTANCE.GetLocation(),
@@ -61,6 +61,8 @@ public:
 
     layer->Set(Config::GFX_HACK_EFB_ACCESS_ENABLE, m_settings.efb_access_enable);
     layer->Set(Config::GFX_HACK_BBOX_ENABLE, m_settings.bbox_enable);
+    // The speculative values depend on host GPU timing, so they would desync.
+    layer->Set(Config::GFX_HACK_BBOX_SPECULATIVE, false);
     layer->Set(Config::GFX_HACK_FORCE_PROGRESSIVE, m_settings.force_progressive);
     layer->Set(Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM, m_settings.efb_to_texture_enable);
     layer->Set(Config::GFX_HACK_SKIP_XFB_COPY_TO_RAM, m_settings.xfb_to_texture_enable);
@@ -70,12 +72,14 @@ public:
     layer->Set(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES,
                m_settings.safe_texture_cache_color_samples);
     layer->Set(Config::GFX_PERF_QUERIES_ENABLE, m_settings.perf_queries_enable);
+    layer->Set(Config::GFX_PERF_QUERIES_ASYNC, m_settings.perf_queries_async);
     layer->Set(Config::MAIN_FLOAT_EXCEPTIONS, m_settings.float_exceptions);
     layer->Set(Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS, m_settings.divide_by_zero_exceptions);
     layer->Set(Config::MAIN_FPRF, m_settings.fprf);
     layer->Set(Config::MAIN_ACCURATE_NANS, m_settings.accurate_nans);
     layer->Set(Config::MAIN_DISABLE_ICACHE, m_settings.disable_icache);
     layer->Set(Config::MAIN_SYNC_ON_SKIP_IDLE, m_settings.sync_on_skip_idle);
+    layer->Set(Config::MAIN_COALESCE_EVENTS, m_settings.coalesce_events);
     layer->Set(Config::MAIN_SYNC_GPU, m_settings.sync_gpu);
     layer->Set(Config::MAIN_SYNC_GPU_MAX_DISTANCE, m_settings.sync_gpu_max_distance);
     layer->Set(Config::MAIN_SYNC_GPU_MIN_DISTANCE, m_settings.sync_gpu_min_distance);
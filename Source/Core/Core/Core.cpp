@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cstring>
+#include <functional>
 #include <mutex>
 #include <queue>
 #include <utility>
@@ -36,6 +37,7 @@
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
+#include "Common/Trace.h"
 #include "Common/Version.h"
 
 #include "Core/Boot/Boot.h"
@@ -61,6 +63,7 @@
 #include "Core/Host.h"
 #include "Core/IOS/IOS.h"
 #include "Core/MemTools.h"
+#include "Core/MetricsExporter.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
 #include "Core/NetPlayProto.h"
@@ -105,6 +108,7 @@ static bool s_is_started = false;
 static Common::Flag s_is_booting;
 static std::thread s_emu_thread;
 static std::vector<StateChangedCallbackFunc> s_on_state_changed_callbacks;
+static FramePresentedCallbackFunc s_frame_presented_callback;
 
 static std::thread s_cpu_thread;
 static bool s_is_throttler_temp_disabled = false;
@@ -233,6 +237,8 @@ bool Init(std::unique_ptr<BootParameters> boot, const WindowSystemInfo& wsi)
   INFO_LOG_FMT(BOOT, "CPU Thread separate = {}",
                Core::System::GetInstance().IsDualCoreMode() ? "Yes" : "No");
 
+  Common::SetThreadPlacementEnabled(Config::Get(Config::MAIN_THREAD_PLACEMENT));
+
   Host_UpdateMainFrame();  // Disable any menus or buttons at boot
 
   // Manually reactivate the video backend in case a GameINI overrides the video backend setting.
@@ -330,7 +336,7 @@ static void CPUSetInitialExecutionState(bool force_paused = false)
 }
 
 // Create the CPU thread, which is a CPU + Video thread in Single Core mode.
-static void CpuThread(const std::optional<std::string>& savestate_path, bool delete_savestate)
+static void CpuThread(BootSessionData& boot_session_data)
 {
   DeclareAsCPUThread();
 
@@ -338,6 +344,7 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
     Common::SetCurrentThreadName("CPU thread");
   else
     Common::SetCurrentThreadName("CPU-GPU thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
 
   // This needs to be delayed until after the video backend is ready.
   DolphinAnalytics::Instance().ReportGameStart();
@@ -359,13 +366,21 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
   s_memory_watcher = std::make_unique<MemoryWatcher>();
 #endif
 
-  if (savestate_path)
+  if (const std::optional<std::string>& savestate_path = boot_session_data.GetSavestatePath())
   {
     ::State::LoadAs(*savestate_path);
-    if (delete_savestate)
+    if (boot_session_data.GetDeleteSavestate() == DeleteSavestateAfterBoot::Yes)
       File::Delete(*savestate_path);
   }
 
+  if (std::vector<u8>* netplay_state = boot_session_data.GetNetplayState())
+  {
+    if (!::State::LoadNetPlaySyncedState(*netplay_state))
+      PanicAlertFmtT("Failed to load the state synchronized by the NetPlay host.");
+    netplay_state->clear();
+    netplay_state->shrink_to_fit();
+  }
+
   s_is_started = true;
   {
 #ifndef _WIN32
@@ -391,9 +406,21 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
     }
   }
 
+  const bool sampling_profiler = Config::Get(Config::MAIN_DEBUG_JIT_SAMPLING_PROFILER);
+  if (sampling_profiler)
+    JitInterface::StartSamplingProfiler();
+
   // Enter CPU run loop. When we leave it - we are done.
   CPU::Run();
 
+  if (sampling_profiler)
+  {
+    JitInterface::StopSamplingProfiler();
+    JitInterface::WriteSampledProfile(File::GetUserPath(D_DUMP_IDX) + "JitSampledProfile.txt");
+  }
+  if (Config::Get(Config::MAIN_DEBUG_JIT_EVENT_COUNTERS))
+    JitInterface::WriteJitEventCounters(File::GetUserPath(D_DUMP_IDX) + "JitEventCounters.txt");
+
 #ifdef USE_MEMORYWATCHER
   s_memory_watcher.reset();
 #endif
@@ -411,8 +438,7 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
   }
 }
 
-static void FifoPlayerThread(const std::optional<std::string>& savestate_path,
-                             bool delete_savestate)
+static void FifoPlayerThread(BootSessionData& boot_session_data)
 {
   DeclareAsCPUThread();
 
@@ -420,6 +446,7 @@ static void FifoPlayerThread(const std::optional<std::string>& savestate_path,
     Common::SetCurrentThreadName("FIFO player thread");
   else
     Common::SetCurrentThreadName("FIFO-GPU thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
 
   // Enter CPU run loop. When we leave it - we are done.
   if (auto cpu_core = FifoPlayer::GetInstance().GetCPUCore())
@@ -464,6 +491,13 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
 
   Common::SetCurrentThreadName("Emuthread - Starting");
 
+#ifdef USE_TRACING
+  Common::Trace::Start(fmt::format("{}trace_{:%Y-%m-%d_%H-%M-%S}.json",
+                                   File::GetUserPath(D_DUMP_IDX),
+                                   fmt::localtime(std::time(nullptr))));
+  Common::ScopeGuard trace_guard{&Common::Trace::Stop};
+#endif
+
   DeclareAsGPUThread();
 
   // For a time this acts as the CPU thread...
@@ -480,9 +514,6 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
   Keyboard::LoadConfig();
 
   BootSessionData boot_session_data = std::move(boot->boot_session_data);
-  const std::optional<std::string>& savestate_path = boot_session_data.GetSavestatePath();
-  const bool delete_savestate =
-      boot_session_data.GetDeleteSavestate() == DeleteSavestateAfterBoot::Yes;
 
   bool sync_sd_folder = core_parameter.bWii && Config::Get(Config::MAIN_WII_SD_CARD) &&
                         Config::Get(Config::MAIN_WII_SD_CARD_ENABLE_FOLDER_SYNC);
@@ -538,6 +569,14 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
   }
   Common::ScopeGuard video_guard{[] { g_video_backend->Shutdown(); }};
 
+  if (const std::string metrics_path = Config::Get(Config::MAIN_METRICS_EXPORT_PATH);
+      !metrics_path.empty())
+  {
+    MetricsExporter::Start(metrics_path, std::chrono::milliseconds(
+                                             Config::Get(Config::MAIN_METRICS_EXPORT_INTERVAL)));
+  }
+  Common::ScopeGuard metrics_guard{&MetricsExporter::Stop};
+
   // Render a single frame without anything on it to clear the screen.
   // This avoids the game list being displayed while the core is finishing initializing.
   g_renderer->BeginUIFrame();
@@ -571,7 +610,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
   PowerPC::SetMode(PowerPC::CoreMode::Interpreter);
 
   // Determine the CPU thread function
-  void (*cpuThreadFunc)(const std::optional<std::string>& savestate_path, bool delete_savestate);
+  void (*cpuThreadFunc)(BootSessionData& boot_session_data);
   if (std::holds_alternative<BootParameters::DFF>(boot->parameters))
     cpuThreadFunc = FifoPlayerThread;
   else
@@ -617,11 +656,12 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
     // This thread, after creating the EmuWindow, spawns a CPU
     // thread, and then takes over and becomes the video thread
     Common::SetCurrentThreadName("Video thread");
+    Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
     UndeclareAsCPUThread();
     FPURoundMode::LoadDefaultSIMDState();
 
     // Spawn the CPU thread. The CPU thread will signal the event that boot is complete.
-    s_cpu_thread = std::thread(cpuThreadFunc, savestate_path, delete_savestate);
+    s_cpu_thread = std::thread(cpuThreadFunc, std::ref(boot_session_data));
 
     // become the GPU thread
     system.GetFifo().RunGpuLoop(system);
@@ -636,7 +676,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
   else  // SingleCore mode
   {
     // Become the CPU thread
-    cpuThreadFunc(savestate_path, delete_savestate);
+    cpuThreadFunc(boot_session_data);
   }
 
   INFO_LOG_FMT(CONSOLE, "{}", StopMessage(true, "Stopping GDB ..."));
@@ -844,11 +884,16 @@ void Callback_FramePresented(double actual_emulation_speed)
 
   s_last_actual_emulation_speed = actual_emulation_speed;
   s_stop_frame_step.store(true);
+
+  if (s_frame_presented_callback)
+    s_frame_presented_callback();
 }
 
 // Called from VideoInterface::Update (CPU thread) at emulated field boundaries
 void Callback_NewField()
 {
+  ::State::OnNewField();
+
   if (s_frame_step)
   {
     // To ensure that s_stop_frame_step is up to date, wait for the GPU thread queue to empty,
@@ -926,6 +971,11 @@ bool RemoveOnStateChangedCallback(int* handle)
   return false;
 }
 
+void SetFramePresentedCallback(FramePresentedCallbackFunc callback)
+{
+  s_frame_presented_callback = std::move(callback);
+}
+
 void CallOnStateChangedCallbacks(Core::State state)
 {
   for (const StateChangedCallbackFunc& on_state_changed_callback : s_on_state_changed_callbacks)
@@ -145,6 +145,11 @@ int AddOnStateChangedCallback(StateChangedCallbackFunc callback);
 bool RemoveOnStateChangedCallback(int* handle);
 void CallOnStateChangedCallbacks(Core::State state);
 
+// Called on the GPU thread whenever a new frame has been presented. Must not be changed while the
+// emulation is running.
+using FramePresentedCallbackFunc = std::function<void()>;
+void SetFramePresentedCallback(FramePresentedCallbackFunc callback);
+
 // Run on the Host thread when the factors change. [NOT THREADSAFE]
 void UpdateWantDeterminism(bool initial = false);
 
@@ -4,7 +4,7 @@
 #include "Core/CoreTiming.h"
 
 #include <algorithm>
-#include <mutex>
+#include <array>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,7 +14,8 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
+#include "Common/Trace.h"
 
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
@@ -22,6 +23,7 @@
 #include "Core/System.h"
 
 #include "VideoCommon/Fifo.h"
+#include "VideoCommon/FrameTimeBreakdown.h"
 #include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoConfig.h"
@@ -29,10 +31,6 @@
 namespace CoreTiming
 {
 // Sort by time, unless the times are the same, in which case sort by the order added to the queue
-static bool operator>(const Event& left, const Event& right)
-{
-  return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
-}
 static bool operator<(const Event& left, const Event& right)
 {
   return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
@@ -40,6 +38,201 @@ static bool operator<(const Event& left, const Event& right)
 
 static constexpr int MAX_SLICE_LENGTH = 20000;
 
+bool EventQueue::Earlier(const Event& left, const Event& right)
+{
+  return left < right;
+}
+
+void EventQueue::Push(const Event& event)
+{
+  u32 slot;
+  if (m_free_slots.empty())
+  {
+    slot = static_cast<u32>(m_slots.size());
+    m_slots.emplace_back();
+  }
+  else
+  {
+    slot = m_free_slots.back();
+    m_free_slots.pop_back();
+  }
+
+  // Link the slot in at the front of the list of its type.
+  auto [it, inserted] = m_first_slot_of_type.try_emplace(event.type, INVALID_SLOT);
+  m_slots[slot].prev = INVALID_SLOT;
+  m_slots[slot].next = it->second;
+  if (it->second != INVALID_SLOT)
+    m_slots[it->second].prev = slot;
+  it->second = slot;
+
+  const u32 heap_index = static_cast<u32>(m_heap.size());
+  m_heap.push_back(Node{event, slot});
+  m_slots[slot].heap_index = heap_index;
+  SiftUp(heap_index);
+}
+
+Event EventQueue::Pop()
+{
+  const Event event = m_heap.front().event;
+  RemoveAt(0);
+  return event;
+}
+
+size_t EventQueue::RemoveAll(const EventType* event_type)
+{
+  const auto it = m_first_slot_of_type.find(event_type);
+  if (it == m_first_slot_of_type.end())
+    return 0;
+
+  size_t count = 0;
+  while (it->second != INVALID_SLOT)
+  {
+    RemoveAt(m_slots[it->second].heap_index);
+    count++;
+  }
+  return count;
+}
+
+void EventQueue::Clear()
+{
+  m_heap.clear();
+  m_slots.clear();
+  m_free_slots.clear();
+  m_first_slot_of_type.clear();
+}
+
+s64 EventQueue::GetDeadline() const
+{
+  // The time of an event is never earlier than the time of its parent, so subtrees whose root is
+  // not earlier than the best deadline so far can be skipped. Usually only a handful of events are
+  // visited.
+  s64 deadline = m_heap.front().event.time + m_heap.front().event.type->max_delay;
+  std::array<u32, 64> stack;
+  size_t stack_size = 0;
+  stack[stack_size++] = 0;
+  while (stack_size != 0)
+  {
+    const u32 heap_index = stack[--stack_size];
+    const Event& event = m_heap[heap_index].event;
+    if (event.time >= deadline)
+      continue;
+    deadline = std::min(deadline, event.time + event.type->max_delay);
+
+    const u32 first_child = heap_index * ARITY + 1;
+    const u32 end = std::min<u32>(first_child + ARITY, static_cast<u32>(m_heap.size()));
+    for (u32 child = first_child; child < end; ++child)
+    {
+      // Can't happen with any realistic number of events, but stay on the safe side if it does
+      if (stack_size == stack.size())
+        deadline = std::min(deadline, m_heap[child].event.time);
+      else
+        stack[stack_size++] = child;
+    }
+  }
+  return deadline;
+}
+
+std::vector<Event> EventQueue::GetEvents() const
+{
+  std::vector<Event> events;
+  events.reserve(m_heap.size());
+  for (const Node& node : m_heap)
+    events.push_back(node.event);
+  return events;
+}
+
+void EventQueue::Place(u32 heap_index, Node node)
+{
+  m_slots[node.slot].heap_index = heap_index;
+  m_heap[heap_index] = std::move(node);
+}
+
+void EventQueue::SiftUp(u32 heap_index)
+{
+  Node node = std::move(m_heap[heap_index]);
+  while (heap_index > 0)
+  {
+    const u32 parent = (heap_index - 1) / ARITY;
+    if (!Earlier(node.event, m_heap[parent].event))
+      break;
+    Place(heap_index, std::move(m_heap[parent]));
+    heap_index = parent;
+  }
+  Place(heap_index, std::move(node));
+}
+
+void EventQueue::SiftDown(u32 heap_index)
+{
+  const u32 size = static_cast<u32>(m_heap.size());
+  Node node = std::move(m_heap[heap_index]);
+  while (true)
+  {
+    const u32 first_child = heap_index * ARITY + 1;
+    if (first_child >= size)
+      break;
+
+    u32 earliest = first_child;
+    const u32 last_child = std::min(first_child + ARITY, size);
+    for (u32 child = first_child + 1; child < last_child; ++child)
+    {
+      if (Earlier(m_heap[child].event, m_heap[earliest].event))
+        earliest = child;
+    }
+
+    if (!Earlier(m_heap[earliest].event, node.event))
+      break;
+    Place(heap_index, std::move(m_heap[earliest]));
+    heap_index = earliest;
+  }
+  Place(heap_index, std::move(node));
+}
+
+void EventQueue::RemoveAt(u32 heap_index)
+{
+  const u32 slot = m_heap[heap_index].slot;
+  const Slot& removed = m_slots[slot];
+
+  // Unlink the slot from the list of its type.
+  if (removed.prev != INVALID_SLOT)
+  {
+    m_slots[removed.prev].next = removed.next;
+  }
+  else
+  {
+    // The entry is kept even when the list becomes empty, there are only so many event types.
+    m_first_slot_of_type.find(m_heap[heap_index].event.type)->second = removed.next;
+  }
+  if (removed.next != INVALID_SLOT)
+    m_slots[removed.next].prev = removed.prev;
+  m_free_slots.push_back(slot);
+
+  // Fill the hole with the last event and move that to where it belongs.
+  const u32 last_index = static_cast<u32>(m_heap.size() - 1);
+  if (heap_index != last_index)
+  {
+    Place(heap_index, std::move(m_heap[last_index]));
+    m_heap.pop_back();
+    if (heap_index > 0 && Earlier(m_heap[heap_index].event, m_heap[(heap_index - 1) / ARITY].event))
+      SiftUp(heap_index);
+    else
+      SiftDown(heap_index);
+  }
+  else
+  {
+    m_heap.pop_back();
+  }
+}
+
+void EventQueue::Rebuild()
+{
+  const u32 size = static_cast<u32>(m_heap.size());
+  if (size <= 1)
+    return;
+
+  for (u32 i = (size - 2) / ARITY + 1; i-- > 0;)
+    SiftDown(i);
+}
+
 static void EmptyTimedCallback(Core::System& system, u64 userdata, s64 cyclesLate)
 {
 }
@@ -65,7 +258,8 @@ int CoreTimingManager::CyclesToDowncount(int cycles) const
   return static_cast<int>(cycles * m_last_oc_factor);
 }
 
-EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallback callback)
+EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallback callback,
+                                            s64 max_delay)
 {
   // check for existing type with same name.
   // we want event type names to remain unique so that we can use them for serialization.
@@ -74,7 +268,7 @@ EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallba
              "during Init to avoid breaking save states.",
              name);
 
-  auto info = m_event_types.emplace(name, EventType{callback, nullptr});
+  auto info = m_event_types.emplace(name, EventType{callback, nullptr, max_delay});
   EventType* event_type = &info.first->second;
   event_type->name = &info.first->first;
   return event_type;
@@ -82,7 +276,7 @@ EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallba
 
 void CoreTimingManager::UnregisterAllEvents()
 {
-  ASSERT_MSG(POWERPC, m_event_queue.empty(), "Cannot unregister events with events pending");
+  ASSERT_MSG(POWERPC, m_event_queue.Empty(), "Cannot unregister events with events pending");
   m_event_types.clear();
 }
 
@@ -107,14 +301,17 @@ void CoreTimingManager::Init()
 
   // Reset data used by the throttling system
   ResetThrottle(0);
+  m_throttle_suspended = false;
 
   m_event_fifo_id = 0;
+  m_advances_this_field = 0;
+  m_advances_per_field = 0.0f;
+  m_coalesced_event_count = 0;
   m_ev_lost = RegisterEvent("_lost_event", &EmptyTimedCallback);
 }
 
 void CoreTimingManager::Shutdown()
 {
-  std::lock_guard lk(m_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
@@ -127,11 +324,15 @@ void CoreTimingManager::RefreshConfig()
       Config::Get(Config::MAIN_OVERCLOCK_ENABLE) ? Config::Get(Config::MAIN_OVERCLOCK) : 1.0f;
   m_config_oc_inv_factor = 1.0f / m_config_oc_factor;
   m_config_sync_on_skip_idle = Config::Get(Config::MAIN_SYNC_ON_SKIP_IDLE);
+  m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
+  m_config_max_fallback = Config::Get(Config::MAIN_MAX_FALLBACK);
+  m_config_timing_variance = Config::Get(Config::MAIN_TIMING_VARIANCE);
+  m_config_precise_throttle = Config::Get(Config::MAIN_PRECISE_THROTTLE);
+  m_config_coalesce_events = Config::Get(Config::MAIN_COALESCE_EVENTS);
 }
 
 void CoreTimingManager::DoState(PointerWrap& p)
 {
-  std::lock_guard lk(m_ts_write_lock);
   p.Do(m_globals.slice_length);
   p.Do(m_globals.global_timer);
   p.Do(m_idled_cycles);
@@ -146,7 +347,10 @@ void CoreTimingManager::DoState(PointerWrap& p)
   p.DoMarker("CoreTimingData");
 
   MoveEvents();
-  p.DoEachElement(m_event_queue, [this](PointerWrap& pw, Event& ev) {
+  std::vector<Event> events;
+  if (!p.IsReadMode())
+    events = m_event_queue.GetEvents();
+  p.DoEachElement(events, [this](PointerWrap& pw, Event& ev) {
     pw.Do(ev.time);
     pw.Do(ev.fifo_order);
 
@@ -184,7 +388,9 @@ void CoreTimingManager::DoState(PointerWrap& p)
     // When loading from a save state, we must assume the Event order is random and meaningless.
     // The exact layout of the heap in memory is implementation defined, therefore it is platform
     // and library version specific.
-    std::make_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    m_event_queue.Clear();
+    for (const Event& ev : events)
+      m_event_queue.Push(ev);
 
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
@@ -212,7 +418,7 @@ u64 CoreTimingManager::GetIdleTicks() const
 
 void CoreTimingManager::ClearPendingEvents()
 {
-  m_event_queue.clear();
+  m_event_queue.Clear();
 }
 
 void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
@@ -239,10 +445,12 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
 
     // If this event needs to be scheduled before the next advance(), force one early
     if (!m_is_global_timer_sane)
-      ForceExceptionCheck(cycles_into_future);
+    {
+      ForceExceptionCheck(cycles_into_future +
+                          (m_config_coalesce_events ? event_type->max_delay : 0));
+    }
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::push_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    m_event_queue.Push(Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -254,22 +462,13 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
                     *event_type->name);
     }
 
-    std::lock_guard lk(m_ts_write_lock);
     m_ts_queue.Push(Event{m_globals.global_timer + cycles_into_future, 0, userdata, event_type});
   }
 }
 
 void CoreTimingManager::RemoveEvent(EventType* event_type)
 {
-  auto itr = std::remove_if(m_event_queue.begin(), m_event_queue.end(),
-                            [&](const Event& e) { return e.type == event_type; });
-
-  // Removing random items breaks the invariant so we have to re-establish it.
-  if (itr != m_event_queue.end())
-  {
-    m_event_queue.erase(itr, m_event_queue.end());
-    std::make_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
-  }
+  m_event_queue.RemoveAll(event_type);
 }
 
 void CoreTimingManager::RemoveAllEvents(EventType* event_type)
@@ -296,13 +495,17 @@ void CoreTimingManager::MoveEvents()
   for (Event ev; m_ts_queue.Pop(ev);)
   {
     ev.fifo_order = m_event_fifo_id++;
-    m_event_queue.emplace_back(std::move(ev));
-    std::push_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    m_event_queue.Push(ev);
   }
 }
 
 void CoreTimingManager::Advance()
 {
+  TRACE_ZONE("CoreTiming::Advance");
+  // Entering a phase credits the time since the last phase change, which keeps the CPU time of
+  // the frame breakdown up to date between the phase changes done by the events.
+  FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::CPU);
+
   auto& system = m_system;
   auto& ppc_state = m_system.GetPPCState();
 
@@ -315,12 +518,14 @@ void CoreTimingManager::Advance()
   m_globals.slice_length = MAX_SLICE_LENGTH;
 
   m_is_global_timer_sane = true;
+  m_advances_this_field++;
 
-  while (!m_event_queue.empty() && m_event_queue.front().time <= m_globals.global_timer)
+  u32 events_run = 0;
+  while (!m_event_queue.Empty() && m_event_queue.Top().time <= m_globals.global_timer)
   {
-    Event evt = std::move(m_event_queue.front());
-    std::pop_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
-    m_event_queue.pop_back();
+    const Event evt = m_event_queue.Pop();
+    if (events_run++ != 0)
+      m_coalesced_event_count++;
 
     Throttle(evt.time);
     evt.type->callback(system, evt.userdata, m_globals.global_timer - evt.time);
@@ -328,11 +533,15 @@ void CoreTimingManager::Advance()
 
   m_is_global_timer_sane = false;
 
-  // Still events left (scheduled in the future)
-  if (!m_event_queue.empty())
+  // Still events left (scheduled in the future). When coalescing, events which may run late are put
+  // off until the latest point at which all of them can still run, which usually is the next event
+  // that can't.
+  if (!m_event_queue.Empty())
   {
-    m_globals.slice_length = static_cast<int>(
-        std::min<s64>(m_event_queue.front().time - m_globals.global_timer, MAX_SLICE_LENGTH));
+    const s64 next_time =
+        m_config_coalesce_events ? m_event_queue.GetDeadline() : m_event_queue.Top().time;
+    m_globals.slice_length =
+        static_cast<int>(std::min<s64>(next_time - m_globals.global_timer, MAX_SLICE_LENGTH));
   }
 
   ppc_state.downcount = CyclesToDowncount(m_globals.slice_length);
@@ -346,6 +555,9 @@ void CoreTimingManager::Advance()
 
 void CoreTimingManager::Throttle(const s64 target_cycle)
 {
+  if (m_throttle_suspended)
+    return;
+
   // Based on number of cycles and emulation speed, increase the target deadline
   const s64 cycles = target_cycle - m_throttle_last_cycle;
 
@@ -356,7 +568,7 @@ void CoreTimingManager::Throttle(const s64 target_cycle)
   m_throttle_last_cycle = target_cycle;
 
   const double speed =
-      Core::GetIsThrottlerTempDisabled() ? 0.0 : Config::Get(Config::MAIN_EMULATION_SPEED);
+      Core::GetIsThrottlerTempDisabled() ? 0.0 : m_config_emulation_speed;
 
   if (0.0 < speed)
     m_throttle_deadline +=
@@ -365,7 +577,7 @@ void CoreTimingManager::Throttle(const s64 target_cycle)
   // A maximum fallback is used to prevent the system from sleeping for
   // too long or going full speed in an attempt to catch up to timings.
   const DT max_fallback =
-      std::chrono::duration_cast<DT>(DT_ms(Config::Get(Config::MAIN_MAX_FALLBACK)));
+      std::chrono::duration_cast<DT>(DT_ms(m_config_max_fallback));
 
   const TimePoint time = Clock::now();
   const TimePoint min_deadline = time - max_fallback;
@@ -385,18 +597,25 @@ void CoreTimingManager::Throttle(const s64 target_cycle)
   // Skip the VI interrupt if the CPU is lagging by a certain amount.
   // It doesn't matter what amount of lag we skip VI at, as long as it's constant.
   const DT max_variance =
-      std::chrono::duration_cast<DT>(DT_ms(Config::Get(Config::MAIN_TIMING_VARIANCE)));
+      std::chrono::duration_cast<DT>(DT_ms(m_config_timing_variance));
   const TimePoint vi_deadline = time - max_variance;
   m_throttle_disable_vi_int = 0.0 < speed && m_throttle_deadline < vi_deadline;
 
   // Only sleep if we are behind the deadline
   if (time < m_throttle_deadline)
   {
-    std::this_thread::sleep_until(m_throttle_deadline);
+    {
+      FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::Throttle);
+      if (m_config_precise_throttle)
+        m_throttle_timer.SleepUntil(m_throttle_deadline);
+      else
+        std::this_thread::sleep_until(m_throttle_deadline);
+    }
 
     // Count amount of time sleeping for analytics
     const TimePoint time_after_sleep = Clock::now();
-    g_perf_metrics.CountThrottleSleep(time_after_sleep - time);
+    g_perf_metrics.CountThrottleSleep(time_after_sleep - time,
+                                      time_after_sleep - m_throttle_deadline);
   }
 }
 
@@ -419,7 +638,7 @@ bool CoreTimingManager::GetVISkip() const
 
 void CoreTimingManager::LogPendingEvents() const
 {
-  auto clone = m_event_queue;
+  auto clone = m_event_queue.GetEvents();
   std::sort(clone.begin(), clone.end());
   for (const Event& ev : clone)
   {
@@ -434,11 +653,10 @@ void CoreTimingManager::AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clo
   m_throttle_clock_per_sec = new_ppc_clock;
   m_throttle_min_clock_per_sleep = new_ppc_clock / 1200;
 
-  for (Event& ev : m_event_queue)
-  {
-    const s64 ticks = (ev.time - m_globals.global_timer) * new_ppc_clock / old_ppc_clock;
-    ev.time = m_globals.global_timer + ticks;
-  }
+  m_event_queue.TransformTimes([&](s64 time) {
+    const s64 ticks = (time - m_globals.global_timer) * new_ppc_clock / old_ppc_clock;
+    return m_globals.global_timer + ticks;
+  });
 }
 
 void CoreTimingManager::Idle()
@@ -459,12 +677,23 @@ void CoreTimingManager::Idle()
   ppc_state.downcount = 0;
 }
 
+void CoreTimingManager::CountField()
+{
+  if (m_advances_per_field == 0.0f)
+    m_advances_per_field = static_cast<float>(m_advances_this_field);
+  else
+    m_advances_per_field += (m_advances_this_field - m_advances_per_field) / 16;
+  m_advances_this_field = 0;
+}
+
 std::string CoreTimingManager::GetScheduledEventsSummary() const
 {
-  std::string text = "Scheduled events\n";
+  std::string text = fmt::format("Advances per field: {:.1f}, coalesced events: {}\n",
+                                 m_advances_per_field, m_coalesced_event_count);
+  text += "Scheduled events\n";
   text.reserve(1000);
 
-  auto clone = m_event_queue;
+  auto clone = m_event_queue.GetEvents();
   std::sort(clone.begin(), clone.end());
   for (const Event& ev : clone)
   {
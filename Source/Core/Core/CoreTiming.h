@@ -16,13 +16,13 @@
 // inside callback:
 //   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
 
-#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
+#include "Common/Timer.h"
 
 class PointerWrap;
 
@@ -49,6 +49,9 @@ struct EventType
 {
   TimedCallback callback;
   const std::string* name;
+  // How many cycles late the event may run, so that it can share an Advance() with a later event
+  // instead of needing one of its own.
+  s64 max_delay;
 };
 
 struct Event
@@ -59,6 +62,71 @@ struct Event
   EventType* type;
 };
 
+// A 4-ary min-heap of events, ordered by time and then by the order they were added in.
+// Unlike a plain std::push_heap/pop_heap heap, it keeps track of where the events of each type
+// are, so removing them costs O(log n) per event instead of a scan and rebuild of the whole heap.
+class EventQueue
+{
+public:
+  bool Empty() const { return m_heap.empty(); }
+  size_t Size() const { return m_heap.size(); }
+  const Event& Top() const { return m_heap.front().event; }
+  // The earliest time by which some event has to run, taking their allowed delays into account.
+  // Must not be called on an empty queue.
+  s64 GetDeadline() const;
+
+  void Push(const Event& event);
+  Event Pop();
+
+  // Returns the number of removed events.
+  size_t RemoveAll(const EventType* event_type);
+  void Clear();
+
+  // In no particular order.
+  std::vector<Event> GetEvents() const;
+
+  // Replaces the time of every event with f(time) and then restores the heap order.
+  template <typename F>
+  void TransformTimes(F&& f)
+  {
+    for (Node& node : m_heap)
+      node.event.time = f(node.event.time);
+    Rebuild();
+  }
+
+private:
+  static constexpr u32 ARITY = 4;
+  static constexpr u32 INVALID_SLOT = 0xffffffff;
+
+  struct Node
+  {
+    Event event;
+    u32 slot;
+  };
+
+  // Bookkeeping for an event which is in the heap, stays in place while the event moves around.
+  struct Slot
+  {
+    u32 heap_index;
+    // Doubly linked list of the slots of all events with the same type.
+    u32 prev;
+    u32 next;
+  };
+
+  static bool Earlier(const Event& left, const Event& right);
+
+  void Place(u32 heap_index, Node node);
+  void SiftUp(u32 heap_index);
+  void SiftDown(u32 heap_index);
+  void RemoveAt(u32 heap_index);
+  void Rebuild();
+
+  std::vector<Node> m_heap;
+  std::vector<Slot> m_slots;
+  std::vector<u32> m_free_slots;
+  std::unordered_map<const EventType*, u32> m_first_slot_of_type;
+};
+
 enum class FromThread
 {
   CPU,
@@ -93,7 +161,10 @@ public:
 
   // Returns the event_type identifier. if name is not unique, an existing event_type will be
   // discarded.
-  EventType* RegisterEvent(const std::string& name, TimedCallback callback);
+  // With Core/CoalesceEvents, events with a non-zero max_delay may run up to that many cycles late
+  // if that lets them run in the same Advance() as another event. This is only meant for events whose callbacks account for
+  // cyclesLate and whose effects the emulated software can't time precisely anyway.
+  EventType* RegisterEvent(const std::string& name, TimedCallback callback, s64 max_delay = 0);
   void UnregisterAllEvents();
 
   // userdata MAY NOT CONTAIN POINTERS. userdata might get written and reloaded from savestates.
@@ -150,6 +221,20 @@ public:
   TimePoint GetCPUTimePoint(s64 cyclesLate) const;  // Used by Dolphin Analytics
   bool GetVISkip() const;                           // Used By VideoInterface
 
+  // Called by VideoInterface at the end of every field, to keep track of how many times Advance()
+  // ran per field. Each of those is an exit from JIT code.
+  void CountField();
+  // Moving average over the last fields.
+  float GetAdvancesPerField() const { return m_advances_per_field; }
+  // Number of events which ran in the same Advance() as an earlier one.
+  u64 GetCoalescedEventCount() const { return m_coalesced_event_count; }
+
+  // Used by run-ahead. The fields it emulates ahead get thrown away, so they run unthrottled, and
+  // the pacing of the fields that are kept has to carry over the state load that discards them.
+  void SetThrottleSuspended(bool suspended) { m_throttle_suspended = suspended; }
+  TimePoint GetThrottleDeadline() const { return m_throttle_deadline; }
+  void SetThrottleDeadline(TimePoint deadline) { m_throttle_deadline = deadline; }
+
 private:
   Globals m_globals;
 
@@ -160,14 +245,10 @@ private:
   std::unordered_map<std::string, EventType> m_event_types;
 
   // STATE_TO_SAVE
-  // The queue is a min-heap using std::make_heap/push_heap/pop_heap.
-  // We don't use std::priority_queue because we need to be able to serialize, unserialize and
-  // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accomodated
-  // by the standard adaptor class.
-  std::vector<Event> m_event_queue;
+  EventQueue m_event_queue;
   u64 m_event_fifo_id = 0;
-  std::mutex m_ts_write_lock;
-  Common::SPSCQueue<Event, false> m_ts_queue;
+  // Events scheduled from other threads, which the CPU thread moves into m_event_queue.
+  Common::MPSCQueue<Event> m_ts_queue;
 
   float m_last_oc_factor = 0.0f;
 
@@ -180,16 +261,27 @@ private:
 
   EventType* m_ev_lost = nullptr;
 
+  u32 m_advances_this_field = 0;
+  float m_advances_per_field = 0.0f;
+  u64 m_coalesced_event_count = 0;
+
   size_t m_registered_config_callback_id = 0;
   float m_config_oc_factor = 0.0f;
   float m_config_oc_inv_factor = 0.0f;
   bool m_config_sync_on_skip_idle = false;
+  float m_config_emulation_speed = 0.0f;
+  int m_config_max_fallback = 0;
+  int m_config_timing_variance = 0;
+  bool m_config_precise_throttle = false;
+  bool m_config_coalesce_events = false;
 
   s64 m_throttle_last_cycle = 0;
   TimePoint m_throttle_deadline = Clock::now();
   s64 m_throttle_clock_per_sec = 0;
   s64 m_throttle_min_clock_per_sleep = 0;
   bool m_throttle_disable_vi_int = false;
+  bool m_throttle_suspended = false;
+  Common::PrecisionTimer m_throttle_timer;
 
   void ResetThrottle(s64 cycle);
 
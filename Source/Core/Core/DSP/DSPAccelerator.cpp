@@ -11,6 +11,19 @@
 
 namespace DSP
 {
+namespace
+{
+s16 DecodeADPCMSample(u8 byte, u32 address, u16 pred_scale, s32 coef1, s32 coef2, s16 yn1,
+                      s16 yn2)
+{
+  // The high nibble comes first. Sign extension by shifting avoids branching on the value.
+  const s32 nibble = static_cast<s8>((address & 1) ? byte << 4 : byte & 0xF0) >> 4;
+  const s32 prediction = (0x400 + coef1 * yn1 + coef2 * yn2) >> 11;
+  const s32 val32 = nibble * (1 << (pred_scale & 0xF)) + prediction;
+  return static_cast<s16>(std::clamp<s32>(val32, -0x7FFF, 0x7FFF));
+}
+}  // namespace
+
 u16 Accelerator::ReadD3()
 {
   u16 val = 0;
@@ -76,20 +89,9 @@ u16 Accelerator::Read(const s16* coefs)
   {
   case 0x00:  // ADPCM audio
   {
-    int scale = 1 << (m_pred_scale & 0xF);
-    int coef_idx = (m_pred_scale >> 4) & 0x7;
-
-    s32 coef1 = coefs[coef_idx * 2 + 0];
-    s32 coef2 = coefs[coef_idx * 2 + 1];
-
-    int temp = (m_current_address & 1) ? (ReadMemory(m_current_address >> 1) & 0xF) :
-                                         (ReadMemory(m_current_address >> 1) >> 4);
-
-    if (temp >= 8)
-      temp -= 16;
-
-    s32 val32 = (scale * temp) + ((0x400 + coef1 * m_yn1 + coef2 * m_yn2) >> 11);
-    val = static_cast<s16>(std::clamp<s32>(val32, -0x7FFF, 0x7FFF));
+    const int coef_idx = (m_pred_scale >> 4) & 0x7;
+    val = DecodeADPCMSample(ReadMemory(m_current_address >> 1), m_current_address, m_pred_scale,
+                            coefs[coef_idx * 2 + 0], coefs[coef_idx * 2 + 1], m_yn1, m_yn2);
     step_size_bytes = 2;
 
     m_yn2 = m_yn1;
@@ -160,6 +162,63 @@ u16 Accelerator::Read(const s16* coefs)
   return val;
 }
 
+void Accelerator::ReadSamples(s16* samples, u32 count, const s16* coefs)
+{
+  u32 i = 0;
+  while (i < count)
+  {
+    if (m_sample_format == 0x00 && !m_reads_stopped)
+      i += DecodeADPCMRun(samples + i, count - i, coefs);
+
+    // The sample that needs the exception and loop handling.
+    if (i < count)
+      samples[i++] = static_cast<s16>(Read(coefs));
+  }
+}
+
+u32 Accelerator::DecodeADPCMRun(s16* samples, u32 count, const s16* coefs)
+{
+  const u32 address = m_current_address;
+
+  // Stop before the read that reaches the next frame header, or any address Read() checks
+  // against the end address. None of them can be skipped over, as the address only goes up by one.
+  u32 run = 15 - (address & 15);
+  for (const u32 target : {m_end_address - 1, m_end_address, m_end_address + 1})
+  {
+    if (target > address)
+      run = std::min(run, target - address - 1);
+  }
+  run = std::min(run, count);
+  if (run == 0)
+    return 0;
+
+  const int coef_idx = (m_pred_scale >> 4) & 0x7;
+  const s32 coef1 = coefs[coef_idx * 2 + 0];
+  const s32 coef2 = coefs[coef_idx * 2 + 1];
+  s16 yn1 = m_yn1;
+  s16 yn2 = m_yn2;
+
+  u8 byte = ReadMemory(address >> 1);
+  for (u32 i = 0; i < run; ++i)
+  {
+    const u32 sample_address = address + i;
+    // Both nibbles of a byte are decoded from a single memory read.
+    if (i != 0 && (sample_address & 1) == 0)
+      byte = ReadMemory(sample_address >> 1);
+
+    const s16 sample =
+        DecodeADPCMSample(byte, sample_address, m_pred_scale, coef1, coef2, yn1, yn2);
+    yn2 = yn1;
+    yn1 = sample;
+    samples[i] = sample;
+  }
+
+  m_yn1 = yn1;
+  m_yn2 = yn2;
+  SetCurrentAddress(address + run);
+  return run;
+}
+
 void Accelerator::DoState(PointerWrap& p)
 {
   p.Do(m_start_address);
@@ -15,6 +15,9 @@ public:
   virtual ~Accelerator() = default;
 
   u16 Read(const s16* coefs);
+  // Reads count samples, with the same results as calling Read() count times. Runs of ADPCM
+  // samples within a frame are decoded without going through Read().
+  void ReadSamples(s16* samples, u32 count, const s16* coefs);
   // Zelda ucode reads ARAM through 0xffd3.
   u16 ReadD3();
   void WriteD3(u16 value);
@@ -37,6 +40,10 @@ public:
   void DoState(PointerWrap& p);
 
 protected:
+  // Decodes the ADPCM samples before the next frame header, end address or loop address, at most
+  // count of them. Returns the number of samples decoded.
+  u32 DecodeADPCMRun(s16* samples, u32 count, const s16* coefs);
+
   virtual void OnEndException() = 0;
   virtual u8 ReadMemory(u32 address) = 0;
   virtual void WriteMemory(u32 address, u8 value) = 0;
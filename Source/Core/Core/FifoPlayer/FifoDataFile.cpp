@@ -5,22 +5,43 @@
 
 #include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <zstd.h>
+
+#include "Common/Assert.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
 constexpr u32 FILE_ID = 0x0d01f1f0;
-constexpr u32 VERSION_NUMBER = 5;
+constexpr u32 VERSION_NUMBER = 6;
 constexpr u32 MIN_LOADER_VERSION = 1;
 // This value is only used if the DFF file was created with overridden RAM sizes.
 // If the MIN_LOADER_VERSION ever exceeds this, it's alright to remove it.
 constexpr u32 MIN_LOADER_VERSION_FOR_RAM_OVERRIDE = 5;
+constexpr u32 MIN_LOADER_VERSION_FOR_STREAMED = 6;
+
+// Recording has to keep up with the game, so streamed files use the fastest compression level.
+constexpr int STREAMED_COMPRESSION_LEVEL = 1;
+// Number of frames after the last requested one which are decompressed in the background.
+constexpr u32 READAHEAD_FRAMES = 4;
+constexpr size_t MAX_CACHED_FRAMES = 16;
+
+// Memory update data of streamed files is stored in chunks of this size, which are compressed in
+// blocks of CHUNKS_PER_BLOCK chunks. The last chunk of an update is padded with zeroes.
+constexpr u32 CHUNK_SIZE = 4096;
+constexpr u32 CHUNKS_PER_BLOCK = 64;
+constexpr size_t MAX_CACHED_CHUNK_BLOCKS = 16;
 
 #pragma pack(push, 1)
 
@@ -46,7 +67,10 @@ struct FileHeader
   // will crash and burn with mismatched settings.  See PR #8722.
   u32 mem1_size;
   u32 mem2_size;
-  u8 reserved[32];
+  // Only used by streamed files
+  u64 chunkBlockListOffset;
+  u32 chunkBlockCount;
+  u8 reserved[20];
 };
 static_assert(sizeof(FileHeader) == 128, "FileHeader should be 128 bytes");
 
@@ -73,11 +97,67 @@ struct FileMemoryUpdate
 };
 static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 bytes");
 
+// The frame list entry of a streamed file. Each frame is stored as one compressed block, which
+// contains the FileMemoryUpdate list, followed by the FIFO data and then the IDs (u32) of the
+// chunks that make up the data of each memory update. The data offsets in the FileMemoryUpdates
+// point to the first chunk ID of the update, relative to the start of the block.
+struct FileStreamedFrameInfo
+{
+  u64 blockOffset;
+  u32 blockSize;
+  u32 uncompressedSize;
+  u32 fifoStart;
+  u32 fifoEnd;
+  u32 fifoDataSize;
+  u32 numMemoryUpdates;
+  u64 memoryDataSize;
+  u8 reserved[24];
+};
+static_assert(sizeof(FileStreamedFrameInfo) == 64, "FileStreamedFrameInfo should be 64 bytes");
+
+// Chunk i is stored in chunk block i / CHUNKS_PER_BLOCK.
+struct FileChunkBlockInfo
+{
+  u64 blockOffset;
+  u32 blockSize;
+  u32 uncompressedSize;
+};
+static_assert(sizeof(FileChunkBlockInfo) == 16, "FileChunkBlockInfo should be 16 bytes");
+
 #pragma pack(pop)
 
+static std::vector<u8> Compress(const std::vector<u8>& data)
+{
+  std::vector<u8> compressed(ZSTD_compressBound(data.size()));
+  const size_t compressed_size = ZSTD_compress(compressed.data(), compressed.size(), data.data(),
+                                               data.size(), STREAMED_COMPRESSION_LEVEL);
+  if (ZSTD_isError(compressed_size))
+  {
+    PanicAlertFmtT("Internal Zstandard Error - compression failed");
+    return {};
+  }
+
+  compressed.resize(compressed_size);
+  return compressed;
+}
+
+static u32 GetChunkCount(u32 size)
+{
+  return (size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+}
+
 FifoDataFile::FifoDataFile() = default;
 
-FifoDataFile::~FifoDataFile() = default;
+FifoDataFile::~FifoDataFile()
+{
+  m_readahead.Cancel();
+
+  if (!m_stream_path.empty())
+  {
+    m_stream_file.Close();
+    File::Delete(m_stream_path);
+  }
+}
 
 bool FifoDataFile::ShouldGenerateFakeVIUpdates() const
 {
@@ -101,11 +181,269 @@ bool FifoDataFile::GetIsWii() const
 
 void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
 {
-  m_Frames.push_back(frameInfo);
+  if (!m_streamed)
+  {
+    m_Frames.push_back(std::make_shared<const FifoFrameInfo>(frameInfo));
+    return;
+  }
+
+  ASSERT(!m_stream_finished);
+
+  const u32 list_size = static_cast<u32>(frameInfo.memoryUpdates.size() * sizeof(FileMemoryUpdate));
+  u32 num_chunk_ids = 0;
+  u64 memory_data_size = 0;
+  for (const MemoryUpdate& update : frameInfo.memoryUpdates)
+  {
+    num_chunk_ids += GetChunkCount(static_cast<u32>(update.data.size()));
+    memory_data_size += update.data.size();
+  }
+
+  std::vector<u8> block(list_size + frameInfo.fifoData.size() + num_chunk_ids * sizeof(u32));
+  std::copy(frameInfo.fifoData.begin(), frameInfo.fifoData.end(), block.begin() + list_size);
+
+  u64 data_offset = list_size + frameInfo.fifoData.size();
+  for (size_t i = 0; i < frameInfo.memoryUpdates.size(); ++i)
+  {
+    const MemoryUpdate& srcUpdate = frameInfo.memoryUpdates[i];
+    const u32 size = static_cast<u32>(srcUpdate.data.size());
+
+    FileMemoryUpdate dstUpdate{};
+    dstUpdate.address = srcUpdate.address;
+    dstUpdate.dataOffset = data_offset;
+    dstUpdate.dataSize = size;
+    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+    dstUpdate.type = srcUpdate.type;
+    std::memcpy(&block[i * sizeof(FileMemoryUpdate)], &dstUpdate, sizeof(FileMemoryUpdate));
+
+    for (u32 offset = 0; offset < size; offset += CHUNK_SIZE)
+    {
+      const u32 chunk_id =
+          StoreChunk(srcUpdate.data.data() + offset, std::min(CHUNK_SIZE, size - offset));
+      std::memcpy(&block[data_offset], &chunk_id, sizeof(u32));
+      data_offset += sizeof(u32);
+    }
+  }
+
+  const std::vector<u8> compressed = Compress(block);
+  if (compressed.empty())
+    return;
+
+  StreamedFrame& frame = m_streamed_frames.emplace_back();
+  frame.block_size = static_cast<u32>(compressed.size());
+  frame.uncompressed_size = static_cast<u32>(block.size());
+  frame.fifo_start = frameInfo.fifoStart;
+  frame.fifo_end = frameInfo.fifoEnd;
+  frame.fifo_data_size = static_cast<u32>(frameInfo.fifoData.size());
+  frame.num_memory_updates = static_cast<u32>(frameInfo.memoryUpdates.size());
+  frame.memory_data_size = memory_data_size;
+
+  std::lock_guard lk(m_stream_file_mutex);
+  m_stream_file.Seek(0, File::SeekOrigin::End);
+  frame.block_offset = m_stream_file.Tell();
+  m_stream_file.WriteBytes(compressed.data(), compressed.size());
+}
+
+u32 FifoDataFile::StoreChunk(const u8* data, u32 size)
+{
+  // The chunks are identified by their hash alone. GetXXH3Hash64 seeds the hash with the size, so
+  // a partial chunk can't be mistaken for a full chunk starting with the same data.
+  const u64 hash = Common::GetXXH3Hash64(data, size, 0);
+  if (const auto it = m_chunk_ids.find(hash); it != m_chunk_ids.end())
+    return it->second;
+
+  const u32 chunk_id = m_chunk_count++;
+  m_chunk_ids.emplace(hash, chunk_id);
+
+  const size_t offset = m_pending_chunks.size();
+  m_pending_chunks.resize(offset + CHUNK_SIZE);
+  std::copy(data, data + size, m_pending_chunks.begin() + offset);
+  if (m_pending_chunks.size() == CHUNKS_PER_BLOCK * CHUNK_SIZE)
+    FlushChunks();
+
+  return chunk_id;
+}
+
+void FifoDataFile::FlushChunks()
+{
+  if (m_pending_chunks.empty())
+    return;
+
+  const std::vector<u8> compressed = Compress(m_pending_chunks);
+
+  ChunkBlock& chunk_block = m_chunk_blocks.emplace_back();
+  chunk_block.size = static_cast<u32>(compressed.size());
+  chunk_block.uncompressed_size = static_cast<u32>(m_pending_chunks.size());
+  m_pending_chunks.clear();
+
+  std::lock_guard lk(m_stream_file_mutex);
+  m_stream_file.Seek(0, File::SeekOrigin::End);
+  chunk_block.offset = m_stream_file.Tell();
+  m_stream_file.WriteBytes(compressed.data(), compressed.size());
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::GetFrame(u32 frame) const
+{
+  if (!m_streamed)
+    return m_Frames[frame];
+
+  ASSERT(m_stream_finished);
+
+  std::shared_ptr<const FifoFrameInfo> frame_info;
+  {
+    std::lock_guard lk(m_frame_cache_mutex);
+    m_last_requested_frame = frame;
+    if (const auto it = m_frame_cache.find(frame); it != m_frame_cache.end())
+      frame_info = it->second;
+  }
+
+  if (!frame_info)
+  {
+    frame_info = ReadStreamedFrame(frame);
+    CacheStreamedFrame(frame, frame_info);
+  }
+
+  // Playback loops back to the first frame after the last one.
+  const u32 frame_count = GetFrameCount();
+  for (u32 i = 1; i <= READAHEAD_FRAMES && i < frame_count; ++i)
+    m_readahead.EmplaceItem((frame + i) % frame_count);
+
+  return frame_info;
+}
+
+u32 FifoDataFile::GetFrameCount() const
+{
+  if (m_streamed)
+    return static_cast<u32>(m_streamed_frames.size());
+  return static_cast<u32>(m_Frames.size());
+}
+
+u32 FifoDataFile::GetFrameFifoDataSize(u32 frame) const
+{
+  if (m_streamed)
+    return m_streamed_frames[frame].fifo_data_size;
+  return static_cast<u32>(m_Frames[frame]->fifoData.size());
+}
+
+u64 FifoDataFile::GetFrameMemoryDataSize(u32 frame) const
+{
+  if (m_streamed)
+    return m_streamed_frames[frame].memory_data_size;
+
+  u64 size = 0;
+  for (const MemoryUpdate& update : m_Frames[frame]->memoryUpdates)
+    size += update.data.size();
+  return size;
+}
+
+bool FifoDataFile::StartStreaming(const std::string& filename)
+{
+  ASSERT(!m_streamed && m_Frames.empty());
+
+  if (!m_stream_file.Open(filename, "w+b"))
+    return false;
+
+  m_streamed = true;
+  m_stream_path = filename;
+
+  // Reserve space for the header, which is written once the recording is complete
+  PadFile(sizeof(FileHeader), m_stream_file);
+  StartReadahead();
+  return true;
+}
+
+bool FifoDataFile::FinishStreaming()
+{
+  if (m_stream_finished)
+    return true;
+
+  FlushChunks();
+  m_chunk_ids.clear();
+
+  std::lock_guard lk(m_stream_file_mutex);
+  File::IOFile& file = m_stream_file;
+  file.Seek(0, File::SeekOrigin::End);
+
+  const u64 bpMemOffset = file.Tell();
+  file.WriteArray(m_BPMem);
+  const u64 cpMemOffset = file.Tell();
+  file.WriteArray(m_CPMem);
+  const u64 xfMemOffset = file.Tell();
+  file.WriteArray(m_XFMem);
+  const u64 xfRegsOffset = file.Tell();
+  file.WriteArray(m_XFRegs);
+  const u64 texMemOffset = file.Tell();
+  file.WriteArray(m_TexMem);
+
+  const u64 frameListOffset = file.Tell();
+  for (const StreamedFrame& srcFrame : m_streamed_frames)
+  {
+    FileStreamedFrameInfo dstFrame{};
+    dstFrame.blockOffset = srcFrame.block_offset;
+    dstFrame.blockSize = srcFrame.block_size;
+    dstFrame.uncompressedSize = srcFrame.uncompressed_size;
+    dstFrame.fifoStart = srcFrame.fifo_start;
+    dstFrame.fifoEnd = srcFrame.fifo_end;
+    dstFrame.fifoDataSize = srcFrame.fifo_data_size;
+    dstFrame.numMemoryUpdates = srcFrame.num_memory_updates;
+    dstFrame.memoryDataSize = srcFrame.memory_data_size;
+    file.WriteBytes(&dstFrame, sizeof(FileStreamedFrameInfo));
+  }
+
+  const u64 chunkBlockListOffset = file.Tell();
+  for (const ChunkBlock& srcBlock : m_chunk_blocks)
+  {
+    FileChunkBlockInfo dstBlock{};
+    dstBlock.blockOffset = srcBlock.offset;
+    dstBlock.blockSize = srcBlock.size;
+    dstBlock.uncompressedSize = srcBlock.uncompressed_size;
+    file.WriteBytes(&dstBlock, sizeof(FileChunkBlockInfo));
+  }
+
+  FileHeader header{};
+  header.fileId = FILE_ID;
+  header.file_version = VERSION_NUMBER;
+  header.min_loader_version = MIN_LOADER_VERSION_FOR_STREAMED;
+  header.bpMemOffset = bpMemOffset;
+  header.bpMemSize = BP_MEM_SIZE;
+  header.cpMemOffset = cpMemOffset;
+  header.cpMemSize = CP_MEM_SIZE;
+  header.xfMemOffset = xfMemOffset;
+  header.xfMemSize = XF_MEM_SIZE;
+  header.xfRegsOffset = xfRegsOffset;
+  header.xfRegsSize = XF_REGS_SIZE;
+  header.texMemOffset = texMemOffset;
+  header.texMemSize = TEX_MEM_SIZE;
+  header.frameListOffset = frameListOffset;
+  header.frameCount = static_cast<u32>(m_streamed_frames.size());
+  header.flags = m_Flags | FLAG_STREAMED;
+  header.chunkBlockListOffset = chunkBlockListOffset;
+  header.chunkBlockCount = static_cast<u32>(m_chunk_blocks.size());
+
+  auto& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
+  header.mem1_size = memory.GetRamSizeReal();
+  header.mem2_size = memory.GetExRamSizeReal();
+
+  file.Seek(0, File::SeekOrigin::Begin);
+  file.WriteBytes(&header, sizeof(FileHeader));
+
+  if (!file.Flush())
+    return false;
+
+  m_stream_finished = true;
+  return true;
 }
 
 bool FifoDataFile::Save(const std::string& filename)
 {
+  if (m_streamed)
+  {
+    if (!FinishStreaming())
+      return false;
+
+    return filename == m_stream_path || File::Copy(m_stream_path, filename);
+  }
+
   File::IOFile file;
   if (!file.Open(filename, "wb"))
     return false;
@@ -173,7 +511,7 @@ bool FifoDataFile::Save(const std::string& filename)
   // Write frames list
   for (unsigned int i = 0; i < m_Frames.size(); ++i)
   {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
+    const FifoFrameInfo& srcFrame = *m_Frames[i];
 
     // Write FIFO data
     file.Seek(0, File::SeekOrigin::End);
@@ -316,6 +654,17 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
 
+  if (dataFile->GetFlag(FLAG_STREAMED))
+  {
+    // Only the frame list is read here, the frames themselves are read when they are needed.
+    dataFile->m_stream_file = std::move(file);
+    if (!dataFile->LoadStreamedFrames(header.frameListOffset, header.frameCount,
+                                      header.chunkBlockListOffset, header.chunkBlockCount))
+      return panic_failed_to_read();
+
+    return dataFile;
+  }
+
   // Read frames
   for (u32 i = 0; i < header.frameCount; ++i)
   {
@@ -345,6 +694,191 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   return dataFile;
 }
 
+bool FifoDataFile::LoadStreamedFrames(u64 frame_list_offset, u32 frame_count,
+                                      u64 chunk_block_list_offset, u32 chunk_block_count)
+{
+  std::vector<FileStreamedFrameInfo> frame_list(frame_count);
+  std::vector<FileChunkBlockInfo> chunk_block_list(chunk_block_count);
+  if (!m_stream_file.Seek(frame_list_offset, File::SeekOrigin::Begin) ||
+      !m_stream_file.ReadArray(frame_list.data(), frame_list.size()) ||
+      !m_stream_file.Seek(chunk_block_list_offset, File::SeekOrigin::Begin) ||
+      !m_stream_file.ReadArray(chunk_block_list.data(), chunk_block_list.size()))
+  {
+    return false;
+  }
+
+  m_chunk_blocks.reserve(chunk_block_count);
+  for (const FileChunkBlockInfo& srcBlock : chunk_block_list)
+  {
+    ChunkBlock& dstBlock = m_chunk_blocks.emplace_back();
+    dstBlock.offset = srcBlock.blockOffset;
+    dstBlock.size = srcBlock.blockSize;
+    dstBlock.uncompressed_size = srcBlock.uncompressedSize;
+  }
+
+  m_streamed = true;
+  m_stream_finished = true;
+  m_streamed_frames.reserve(frame_count);
+  for (const FileStreamedFrameInfo& srcFrame : frame_list)
+  {
+    StreamedFrame& dstFrame = m_streamed_frames.emplace_back();
+    dstFrame.block_offset = srcFrame.blockOffset;
+    dstFrame.block_size = srcFrame.blockSize;
+    dstFrame.uncompressed_size = srcFrame.uncompressedSize;
+    dstFrame.fifo_start = srcFrame.fifoStart;
+    dstFrame.fifo_end = srcFrame.fifoEnd;
+    dstFrame.fifo_data_size = srcFrame.fifoDataSize;
+    dstFrame.num_memory_updates = srcFrame.numMemoryUpdates;
+    dstFrame.memory_data_size = srcFrame.memoryDataSize;
+  }
+
+  StartReadahead();
+  return true;
+}
+
+bool FifoDataFile::ReadStreamedBlock(u64 offset, u32 size, std::vector<u8>* data) const
+{
+  std::vector<u8> compressed(size);
+  {
+    std::lock_guard lk(m_stream_file_mutex);
+    if (!m_stream_file.Seek(offset, File::SeekOrigin::Begin) ||
+        !m_stream_file.ReadBytes(compressed.data(), compressed.size()))
+    {
+      return false;
+    }
+  }
+
+  const size_t result =
+      ZSTD_decompress(data->data(), data->size(), compressed.data(), compressed.size());
+  return !ZSTD_isError(result) && result == data->size();
+}
+
+std::shared_ptr<const std::vector<u8>> FifoDataFile::GetChunkBlock(u32 block) const
+{
+  {
+    std::lock_guard lk(m_chunk_block_cache_mutex);
+    if (const auto it = m_chunk_block_cache.find(block); it != m_chunk_block_cache.end())
+      return it->second;
+  }
+
+  const ChunkBlock& chunk_block = m_chunk_blocks[block];
+  auto data = std::make_shared<std::vector<u8>>(chunk_block.uncompressed_size);
+  if (!ReadStreamedBlock(chunk_block.offset, chunk_block.size, data.get()))
+    return nullptr;
+
+  std::lock_guard lk(m_chunk_block_cache_mutex);
+  m_chunk_block_cache.emplace(block, data);
+  // Chunks stored early on are the most likely to be reused, e.g. by textures used in every frame,
+  // so the newest blocks are evicted first.
+  if (m_chunk_block_cache.size() > MAX_CACHED_CHUNK_BLOCKS)
+  {
+    auto it = std::prev(m_chunk_block_cache.end());
+    if (it->first == block)
+      --it;
+    m_chunk_block_cache.erase(it);
+  }
+
+  return data;
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::ReadStreamedFrame(u32 frame) const
+{
+  const StreamedFrame& srcFrame = m_streamed_frames[frame];
+
+  auto dstFrame = std::make_shared<FifoFrameInfo>();
+  dstFrame->fifoStart = srcFrame.fifo_start;
+  dstFrame->fifoEnd = srcFrame.fifo_end;
+
+  std::vector<u8> block(srcFrame.uncompressed_size);
+  const size_t list_size = srcFrame.num_memory_updates * sizeof(FileMemoryUpdate);
+  if (!ReadStreamedBlock(srcFrame.block_offset, srcFrame.block_size, &block) ||
+      list_size + srcFrame.fifo_data_size > block.size())
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to read frame {} of the FIFO log", frame);
+    return dstFrame;
+  }
+
+  const auto fifo_data = block.begin() + list_size;
+  dstFrame->fifoData.assign(fifo_data, fifo_data + srcFrame.fifo_data_size);
+
+  dstFrame->memoryUpdates.resize(srcFrame.num_memory_updates);
+  for (u32 i = 0; i < srcFrame.num_memory_updates; ++i)
+  {
+    FileMemoryUpdate srcUpdate;
+    std::memcpy(&srcUpdate, &block[i * sizeof(FileMemoryUpdate)], sizeof(FileMemoryUpdate));
+
+    MemoryUpdate& dstUpdate = dstFrame->memoryUpdates[i];
+    dstUpdate.address = srcUpdate.address;
+    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+    dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
+    dstUpdate.data.resize(srcUpdate.dataSize);
+
+    const u64 num_chunks = GetChunkCount(srcUpdate.dataSize);
+    if (srcUpdate.dataOffset > block.size() ||
+        num_chunks > (block.size() - srcUpdate.dataOffset) / sizeof(u32))
+    {
+      ERROR_LOG_FMT(VIDEO, "Frame {} of the FIFO log is corrupted", frame);
+      dstFrame->memoryUpdates.resize(i);
+      break;
+    }
+
+    for (u32 offset = 0; offset < srcUpdate.dataSize; offset += CHUNK_SIZE)
+    {
+      u32 chunk_id;
+      std::memcpy(&chunk_id, &block[srcUpdate.dataOffset + offset / CHUNK_SIZE * sizeof(u32)],
+                  sizeof(u32));
+
+      const u32 chunk_block = chunk_id / CHUNKS_PER_BLOCK;
+      const size_t chunk_offset = (chunk_id % CHUNKS_PER_BLOCK) * CHUNK_SIZE;
+      const auto chunks =
+          chunk_block < m_chunk_blocks.size() ? GetChunkBlock(chunk_block) : nullptr;
+      if (!chunks || chunk_offset + CHUNK_SIZE > chunks->size())
+      {
+        ERROR_LOG_FMT(VIDEO, "Failed to read chunk {} of the FIFO log", chunk_id);
+        continue;
+      }
+
+      const u32 size = std::min(CHUNK_SIZE, srcUpdate.dataSize - offset);
+      std::copy_n(chunks->begin() + chunk_offset, size, dstUpdate.data.begin() + offset);
+    }
+  }
+
+  return dstFrame;
+}
+
+void FifoDataFile::CacheStreamedFrame(u32 frame,
+                                      std::shared_ptr<const FifoFrameInfo> frame_info) const
+{
+  std::lock_guard lk(m_frame_cache_mutex);
+  m_frame_cache.emplace(frame, std::move(frame_info));
+
+  // Evict the frames which playback would reach last, i.e. the ones right before the last
+  // requested frame.
+  const u32 frame_count = GetFrameCount();
+  const auto distance = [&](u32 cached_frame) {
+    return (cached_frame + frame_count - m_last_requested_frame) % frame_count;
+  };
+  while (m_frame_cache.size() > MAX_CACHED_FRAMES)
+  {
+    const auto it = std::max_element(
+        m_frame_cache.begin(), m_frame_cache.end(),
+        [&](const auto& a, const auto& b) { return distance(a.first) < distance(b.first); });
+    m_frame_cache.erase(it);
+  }
+}
+
+void FifoDataFile::StartReadahead()
+{
+  m_readahead.Reset([this](u32 frame) {
+    {
+      std::lock_guard lk(m_frame_cache_mutex);
+      if (m_frame_cache.contains(frame))
+        return;
+    }
+    CacheStreamedFrame(frame, ReadStreamedFrame(frame));
+  });
+}
+
 void FifoDataFile::PadFile(size_t numBytes, File::IOFile& file)
 {
   for (size_t i = 0; i < numBytes; ++i)
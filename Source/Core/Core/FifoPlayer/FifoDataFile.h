@@ -4,18 +4,18 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Common/WorkQueueThread.h"
 #include "VideoCommon/XFMemory.h"
 
-namespace File
-{
-class IOFile;
-}
-
 struct MemoryUpdate
 {
   enum Type
@@ -43,6 +43,13 @@ struct FifoFrameInfo
   std::vector<MemoryUpdate> memoryUpdates;
 };
 
+// Files from before version 6 are kept in memory in their entirety. Version 6 adds streamed files,
+// whose frames are compressed with Zstandard and appended to the file while recording, with the
+// frame list and the register state written at the end. Their frames are read back from disk as
+// they are needed, with the following frames being decompressed ahead of time in the background.
+// The data of memory updates in streamed files is split into fixed-size chunks which are stored
+// only once, no matter how many updates contain them, so that repeatedly uploading a buffer that
+// only changed in a few places doesn't store all of it again.
 class FifoDataFile
 {
 public:
@@ -73,8 +80,16 @@ public:
   u32 GetExRamSizeReal() { return m_exram_size_real; }
 
   void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
-  u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  std::shared_ptr<const FifoFrameInfo> GetFrame(u32 frame) const;
+  u32 GetFrameCount() const;
+  // These don't require reading the frame from a streamed file.
+  u32 GetFrameFifoDataSize(u32 frame) const;
+  u64 GetFrameMemoryDataSize(u32 frame) const;
+
+  // Makes AddFrame compress frames and append them to the file at filename as they are added,
+  // instead of keeping them in memory. The file is only complete after Save() has been called, and
+  // is deleted along with this object.
+  bool StartStreaming(const std::string& filename);
   bool Save(const std::string& filename);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
@@ -82,11 +97,43 @@ public:
 private:
   enum
   {
-    FLAG_IS_WII = 1
+    FLAG_IS_WII = 1,
+    FLAG_STREAMED = 2,
+  };
+
+  struct StreamedFrame
+  {
+    u64 block_offset;
+    u32 block_size;
+    u32 uncompressed_size;
+    u32 fifo_start;
+    u32 fifo_end;
+    u32 fifo_data_size;
+    u32 num_memory_updates;
+    u64 memory_data_size;
+  };
+
+  struct ChunkBlock
+  {
+    u64 offset;
+    u32 size;
+    u32 uncompressed_size;
   };
 
   void PadFile(size_t numBytes, File::IOFile& file);
 
+  u32 StoreChunk(const u8* data, u32 size);
+  void FlushChunks();
+  std::shared_ptr<const std::vector<u8>> GetChunkBlock(u32 block) const;
+  bool ReadStreamedBlock(u64 offset, u32 size, std::vector<u8>* data) const;
+
+  bool FinishStreaming();
+  bool LoadStreamedFrames(u64 frame_list_offset, u32 frame_count, u64 chunk_block_list_offset,
+                          u32 chunk_block_count);
+  std::shared_ptr<const FifoFrameInfo> ReadStreamedFrame(u32 frame) const;
+  void CacheStreamedFrame(u32 frame, std::shared_ptr<const FifoFrameInfo> frame_info) const;
+  void StartReadahead();
+
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
@@ -105,5 +152,24 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
-  std::vector<FifoFrameInfo> m_Frames;
+  std::vector<std::shared_ptr<const FifoFrameInfo>> m_Frames;
+
+  // Only used by streamed files
+  bool m_streamed = false;
+  bool m_stream_finished = false;
+  std::string m_stream_path;
+  std::vector<StreamedFrame> m_streamed_frames;
+  mutable File::IOFile m_stream_file;
+  mutable std::mutex m_stream_file_mutex;
+  std::vector<ChunkBlock> m_chunk_blocks;
+  // Only used while recording, to find chunks which were already stored
+  std::unordered_map<u64, u32> m_chunk_ids;
+  u32 m_chunk_count = 0;
+  std::vector<u8> m_pending_chunks;
+  mutable std::map<u32, std::shared_ptr<const std::vector<u8>>> m_chunk_block_cache;
+  mutable std::mutex m_chunk_block_cache_mutex;
+  mutable std::map<u32, std::shared_ptr<const FifoFrameInfo>> m_frame_cache;
+  mutable u32 m_last_requested_frame = 0;
+  mutable std::mutex m_frame_cache_mutex;
+  mutable Common::WorkQueueThread<u32> m_readahead;
 };
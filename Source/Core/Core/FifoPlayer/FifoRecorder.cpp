@@ -6,6 +6,8 @@
 #include <algorithm>
 #include <cstring>
 
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
@@ -218,6 +220,11 @@ void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
 
   m_File = std::make_unique<FifoDataFile>();
 
+  // Frames are written out as they are recorded, so that long recordings don't have to fit into
+  // memory. Saving the recording copies the finished file to where it's saved.
+  if (!m_File->StartStreaming(File::GetUserPath(D_CACHE_IDX) + "fifo_recording.dff"))
+    WARN_LOG_FMT(VIDEO, "Failed to create FIFO recording file, recording to memory instead");
+
   // TODO: This, ideally, would be deallocated when done recording.
   //       However, care needs to be taken since global state
   //       and multithreading don't play well nicely together.
@@ -13,6 +13,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/GeckoCode.h"
+#include "Core/HLE/HLE_LibC.h"
 #include "Core/HLE/HLE_Misc.h"
 #include "Core/HLE/HLE_OS.h"
 #include "Core/HW/Memmap.h"
@@ -27,7 +28,7 @@ namespace HLE
 static std::map<u32, u32> s_hooked_addresses;
 
 // clang-format off
-constexpr std::array<Hook, 23> os_patches{{
+constexpr std::array<Hook, 35> os_patches{{
     // Placeholder, os_patches[0] is the "non-existent function" index
     {"FAKE_TO_SKIP_0",               HLE_Misc::UnimplementedFunction,       HookType::Replace, HookFlag::Generic},
 
@@ -57,6 +58,20 @@ constexpr std::array<Hook, 23> os_patches{{
     {"___blank",                     HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Debug}, // used for early init things (normally)
     {"__write_console",              HLE_OS::HLE_write_console,             HookType::Start,   HookFlag::Debug}, // used by sysmenu (+more?)
 
+    // Bulk memory operations
+    {"memcpy",                       HLE_LibC::HLE_memcpy,                  HookType::Replace, HookFlag::LibC},
+    {"memmove",                      HLE_LibC::HLE_memmove,                 HookType::Replace, HookFlag::LibC},
+    {"memset",                       HLE_LibC::HLE_memset,                  HookType::Replace, HookFlag::LibC},
+    {"__fill_mem",                   HLE_LibC::HLE_memset,                  HookType::Replace, HookFlag::LibC},
+    {"strlen",                       HLE_LibC::HLE_strlen,                  HookType::Replace, HookFlag::LibC},
+    {"strcpy",                       HLE_LibC::HLE_strcpy,                  HookType::Replace, HookFlag::LibC},
+    {"strcmp",                       HLE_LibC::HLE_strcmp,                  HookType::Replace, HookFlag::LibC},
+    {"DCFlushRange",                 HLE_LibC::HLE_DCRange,                 HookType::Replace, HookFlag::LibC},
+    {"DCFlushRangeNoSync",           HLE_LibC::HLE_DCRange,                 HookType::Replace, HookFlag::LibC},
+    {"DCStoreRange",                 HLE_LibC::HLE_DCRange,                 HookType::Replace, HookFlag::LibC},
+    {"DCStoreRangeNoSync",           HLE_LibC::HLE_DCRange,                 HookType::Replace, HookFlag::LibC},
+    {"DCInvalidateRange",            HLE_LibC::HLE_DCRange,                 HookType::Replace, HookFlag::LibC},
+
     {"GeckoCodehandler",             HLE_Misc::GeckoCodeHandlerICacheFlush, HookType::Start,   HookFlag::Fixed},
     {"GeckoHandlerReturnTrampoline", HLE_Misc::GeckoReturnTrampoline,       HookType::Replace, HookFlag::Fixed},
     {"AppLoaderReport",              HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Fixed} // apploader needs OSReport-like function
@@ -149,6 +164,9 @@ void Reload(Core::System& system)
 {
   Clear();
   PatchFixedFunctions(system);
+  // Without a symbol map, the library functions can still be found by their signatures.
+  if (g_symbolDB.IsEmpty() && Config::Get(Config::MAIN_HLE_LIBC_FUNCTIONS))
+    HLE_LibC::FindFunctions(system);
   PatchFunctions(system);
 }
 
@@ -194,6 +212,9 @@ HookFlag GetHookFlagsByIndex(u32 index)
 
 bool IsEnabled(HookFlag flag)
 {
+  if (flag == HookFlag::LibC)
+    return HLE_LibC::IsAvailable(Core::System::GetInstance());
+
   return flag != HLE::HookFlag::Debug || Config::Get(Config::MAIN_ENABLE_DEBUGGING) ||
          PowerPC::GetMode() == PowerPC::CoreMode::Interpreter;
 }
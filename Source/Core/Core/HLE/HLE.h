@@ -28,6 +28,7 @@ enum class HookFlag
   Generic,  // Miscellaneous function
   Debug,    // Debug output function
   Fixed,    // An arbitrary hook mapped to a fixed address instead of a symbol
+  LibC,     // Host implementation of a library function, see HLE_LibC::IsAvailable
 };
 
 struct Hook
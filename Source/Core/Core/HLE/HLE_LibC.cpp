@@ -0,0 +1,211 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HLE/HLE_LibC.h"
+
+#include <cstring>
+#include <vector>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/HW/Memmap.h"
+#include "Core/Host.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/PowerPC/SignatureDB/SignatureDB.h"
+#include "Core/System.h"
+
+namespace HLE_LibC
+{
+constexpr u32 PAGE_SIZE = static_cast<u32>(PowerPC::HW_PAGE_SIZE);
+constexpr u32 PAGE_MASK = static_cast<u32>(PowerPC::HW_PAGE_MASK);
+
+// Returns the host memory backing the given range if all of it is contiguous RAM, which is the
+// case for everything mapped by the BATs. Returns nullptr otherwise.
+static u8* GetRAMPointer(u32 address, u32 size)
+{
+  u8* const pointer = PowerPC::HostGetRAMPointer(address);
+  if (!pointer || size == 0)
+    return pointer;
+
+  const u32 last_address = address + (size - 1);
+  if (last_address < address)
+    return nullptr;
+
+  const u32 first_page = address & ~PAGE_MASK;
+  const u32 page_count = ((last_address & ~PAGE_MASK) - first_page) / PAGE_SIZE;
+  for (u32 i = 1; i <= page_count; ++i)
+  {
+    const u32 page = first_page + i * PAGE_SIZE;
+    if (PowerPC::HostGetRAMPointer(page) != pointer + (page - address))
+      return nullptr;
+  }
+
+  return pointer;
+}
+
+// Behaves like memmove, which also covers the memcpy implementations which handle overlap.
+static void Move(u32 dst, u32 src, u32 size)
+{
+  if (size == 0)
+    return;
+
+  u8* const dst_pointer = GetRAMPointer(dst, size);
+  const u8* const src_pointer = GetRAMPointer(src, size);
+  if (dst_pointer && src_pointer)
+  {
+    std::memmove(dst_pointer, src_pointer, size);
+    return;
+  }
+
+  // Part of the range is MMIO or isn't mapped to contiguous memory.
+  std::vector<u8> buffer(size);
+  for (u32 i = 0; i < size; ++i)
+    buffer[i] = PowerPC::HostRead_U8(src + i);
+  for (u32 i = 0; i < size; ++i)
+    PowerPC::HostWrite_U8(buffer[i], dst + i);
+}
+
+static void Fill(u32 dst, u8 value, u32 size)
+{
+  if (size == 0)
+    return;
+
+  if (u8* const pointer = GetRAMPointer(dst, size))
+  {
+    std::memset(pointer, value, size);
+    return;
+  }
+
+  for (u32 i = 0; i < size; ++i)
+    PowerPC::HostWrite_U8(value, dst + i);
+}
+
+static u32 StringLength(u32 address)
+{
+  u32 length = 0;
+  while (true)
+  {
+    const u32 current = address + length;
+    const u8* const pointer = PowerPC::HostGetRAMPointer(current);
+    if (!pointer)
+    {
+      if (PowerPC::HostRead_U8(current) == 0)
+        return length;
+      ++length;
+      continue;
+    }
+
+    // HostGetRAMPointer is only valid up to the end of the page.
+    const u32 available = PAGE_SIZE - (current & PAGE_MASK);
+    if (const void* end = std::memchr(pointer, 0, available))
+      return length + static_cast<u32>(static_cast<const u8*>(end) - pointer);
+    length += available;
+  }
+}
+
+static void Return(PowerPC::PowerPCState& ppc_state)
+{
+  ppc_state.npc = LR(ppc_state);
+}
+
+void HLE_memcpy()
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  Move(ppc_state.gpr[3], ppc_state.gpr[4], ppc_state.gpr[5]);
+  Return(ppc_state);
+}
+
+void HLE_memmove()
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  Move(ppc_state.gpr[3], ppc_state.gpr[4], ppc_state.gpr[5]);
+  Return(ppc_state);
+}
+
+// Also used for __fill_mem, which takes the same arguments but doesn't return anything.
+void HLE_memset()
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  Fill(ppc_state.gpr[3], static_cast<u8>(ppc_state.gpr[4]), ppc_state.gpr[5]);
+  Return(ppc_state);
+}
+
+void HLE_strlen()
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  ppc_state.gpr[3] = StringLength(ppc_state.gpr[3]);
+  Return(ppc_state);
+}
+
+void HLE_strcpy()
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  const u32 src = ppc_state.gpr[4];
+  Move(ppc_state.gpr[3], src, StringLength(src) + 1);
+  Return(ppc_state);
+}
+
+void HLE_strcmp()
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  const u32 lhs = ppc_state.gpr[3];
+  const u32 rhs = ppc_state.gpr[4];
+
+  for (u32 i = 0;; ++i)
+  {
+    const u8 lhs_char = PowerPC::HostRead_U8(lhs + i);
+    const u8 rhs_char = PowerPC::HostRead_U8(rhs + i);
+    if (lhs_char != rhs_char || lhs_char == 0)
+    {
+      ppc_state.gpr[3] = static_cast<u32>(s32{lhs_char} - s32{rhs_char});
+      break;
+    }
+  }
+
+  Return(ppc_state);
+}
+
+// DCFlushRange, DCStoreRange, DCInvalidateRange and their NoSync variants. Without data cache
+// emulation, the only effect of the dcb* instructions they're made of is invalidating the JIT
+// cache, and these functions run those instructions once per cache line touched by the range.
+void HLE_DCRange()
+{
+  auto& ppc_state = Core::System::GetInstance().GetPPCState();
+  const u32 address = ppc_state.gpr[3];
+  const u32 size = ppc_state.gpr[4];
+
+  if (size != 0)
+  {
+    const u64 count = ((address & 0x1f) + u64{size} + 0x1f) >> 5;
+    JitInterface::InvalidateICacheLines(address, static_cast<u32>(count));
+  }
+
+  Return(ppc_state);
+}
+
+bool IsAvailable(const Core::System& system)
+{
+  return Config::Get(Config::MAIN_HLE_LIBC_FUNCTIONS) && !system.IsMMUMode() &&
+         !system.GetPPCState().m_enable_dcache && !PowerPC::memchecks.HasAny();
+}
+
+void FindFunctions(Core::System& system)
+{
+  auto& memory = system.GetMemory();
+
+  PPCAnalyst::FindFunctions(Memory::MEM1_BASE_ADDR,
+                            Memory::MEM1_BASE_ADDR + memory.GetRamSizeReal(), &g_symbolDB);
+  SignatureDB db(SignatureDB::HandlerType::DSY);
+  if (db.Load(File::GetSysDirectory() + TOTALDB))
+    db.Apply(&g_symbolDB);
+
+  Host_NotifyMapLoaded();
+}
+}  // namespace HLE_LibC
@@ -0,0 +1,31 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+namespace Core
+{
+class System;
+}
+
+namespace HLE_LibC
+{
+// Host implementations of the C library and SDK routines which games use for bulk memory
+// operations. They are only used while Config::MAIN_HLE_LIBC_FUNCTIONS is enabled and the state of
+// the emulated CPU allows it (see IsAvailable).
+void HLE_memcpy();
+void HLE_memmove();
+void HLE_memset();
+void HLE_strlen();
+void HLE_strcpy();
+void HLE_strcmp();
+void HLE_DCRange();
+
+// The replacements can't raise DSI exceptions and bypass the emulated data cache, so they are
+// unavailable with MMU or data cache emulation. Memory checks need every access to be emulated, so
+// they make them unavailable too.
+bool IsAvailable(const Core::System& system);
+
+// Finds the routines in games which don't come with a symbol map, using the signature database.
+void FindFunctions(Core::System& system);
+}  // namespace HLE_LibC
@@ -16,6 +16,7 @@
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 #include "VideoCommon/Fifo.h"
+#include "VideoCommon/FrameTimeBreakdown.h"
 
 namespace CPU
 {
@@ -126,7 +127,10 @@ void Run()
       }
 
       // Enter a fast runloop
-      PowerPC::RunLoop();
+      {
+        FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::CPU);
+        PowerPC::RunLoop();
+      }
 
       state_lock.lock();
       s_state_cpu_thread_active = false;
@@ -6,6 +6,8 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
+#include "Common/Thread.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
@@ -16,10 +18,15 @@ namespace DSP::HLE
 {
 DSPHLE::DSPHLE() = default;
 
-DSPHLE::~DSPHLE() = default;
+DSPHLE::~DSPHLE()
+{
+  StopThread();
+}
 
 bool DSPHLE::Initialize(bool wii, bool dsp_thread)
 {
+  StopThread();
+
   m_wii = wii;
   m_ucode = nullptr;
   m_last_ucode = nullptr;
@@ -33,20 +40,92 @@ bool DSPHLE::Initialize(bool wii, bool dsp_thread)
 
   m_dsp_state.Reset();
 
+  // The uCode writes to memory at unpredictable times when it runs on its own thread.
+  if (Config::Get(Config::MAIN_DSP_HLE_THREAD) && !Core::WantsDeterminism())
+    StartThread();
+
   return true;
 }
 
+void DSPHLE::HLEThread(DSPHLE* dsp_hle)
+{
+  Common::SetCurrentThreadName("DSP HLE thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
+
+  while (dsp_hle->m_is_running.IsSet())
+  {
+    u32 mail;
+    if (dsp_hle->m_cpu_mails.Pop(mail))
+    {
+      dsp_hle->m_mail_handler.SetDeferred(true);
+      dsp_hle->SendMailToDSP(mail);
+      dsp_hle->m_mail_handler.SetDeferred(false);
+
+      dsp_hle->m_mails_handled.fetch_add(1, std::memory_order_release);
+      dsp_hle->m_idle_event.Set();
+      continue;
+    }
+
+    dsp_hle->m_hle_event.Wait();
+  }
+}
+
+void DSPHLE::StartThread()
+{
+  m_mails_sent = 0;
+  m_mails_handled.store(0);
+  m_is_running.Set(true);
+  m_is_hle_on_thread = true;
+  m_hle_thread = std::thread(HLEThread, this);
+}
+
+void DSPHLE::StopThread()
+{
+  if (!m_is_hle_on_thread)
+    return;
+
+  SyncWithThread();
+  m_is_running.Clear();
+  m_hle_event.Set();
+  m_hle_thread.join();
+  m_is_hle_on_thread = false;
+}
+
+void DSPHLE::SyncWithThread()
+{
+  if (!m_is_hle_on_thread)
+    return;
+
+  while (!IsThreadIdle())
+    m_idle_event.Wait();
+  m_mail_handler.ApplyDeferred();
+}
+
+bool DSPHLE::IsThreadIdle() const
+{
+  return m_mails_handled.load(std::memory_order_acquire) == m_mails_sent;
+}
+
 void DSPHLE::DSP_StopSoundStream()
 {
+  StopThread();
 }
 
 void DSPHLE::Shutdown()
 {
+  StopThread();
   m_ucode = nullptr;
 }
 
 void DSPHLE::DSP_Update(int cycles)
 {
+  // Every DSP update is a sync point, so the uCode never lags more than one update period behind
+  // the mail sent to it.
+  SyncWithThread();
+
+  if (m_is_hle_on_thread && Core::WantsDeterminism())
+    StopThread();
+
   if (m_ucode != nullptr)
     m_ucode->Update();
 }
@@ -96,6 +175,8 @@ void DSPHLE::SwapUCode(u32 crc)
 
 void DSPHLE::DoState(PointerWrap& p)
 {
+  SyncWithThread();
+
   bool is_hle = true;
   p.Do(is_hle);
   if (!is_hle && p.IsReadMode())
@@ -146,6 +227,11 @@ u16 DSPHLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
   }
   else
   {
+    // Make mail the HLE thread has finished sending visible without waiting for the next sync
+    // point. The CPU always reads the high half first, so both halves come from the same mail.
+    if (m_is_hle_on_thread && IsThreadIdle())
+      m_mail_handler.ApplyDeferred();
+
     return AccessMailHandler().ReadDSPMailboxHigh();
   }
 }
@@ -179,7 +265,16 @@ void DSPHLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
   if (cpu_mailbox)
   {
     m_dsp_state.cpu_mailbox = (m_dsp_state.cpu_mailbox & 0xFFFF0000) | value;
-    SendMailToDSP(m_dsp_state.cpu_mailbox);
+    if (m_is_hle_on_thread)
+    {
+      m_cpu_mails.Push(m_dsp_state.cpu_mailbox);
+      ++m_mails_sent;
+      m_hle_event.Set();
+    }
+    else
+    {
+      SendMailToDSP(m_dsp_state.cpu_mailbox);
+    }
     // Mail sent so clear MSB to show that it is progressed
     m_dsp_state.cpu_mailbox &= 0x7FFFFFFF;
   }
@@ -192,6 +287,9 @@ void DSPHLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
 // Other DSP functions
 u16 DSPHLE::DSP_WriteControlRegister(u16 value)
 {
+  // Resetting the DSP replaces the uCode.
+  SyncWithThread();
+
   DSP::UDSPControl temp(value);
 
   if (m_dsp_control.DSPHalt != temp.DSPHalt)
@@ -242,5 +340,8 @@ u16 DSPHLE::DSP_ReadControlRegister()
 
 void DSPHLE::PauseAndLock(bool do_lock, bool unpause_on_unlock)
 {
+  // The CPU thread is paused, so no new mail can arrive until it is unlocked.
+  if (do_lock)
+    SyncWithThread();
 }
 }  // namespace DSP::HLE
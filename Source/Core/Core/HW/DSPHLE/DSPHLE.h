@@ -3,9 +3,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
 #include "Core/DSPEmulator.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/MailHandler.h"
@@ -43,6 +48,14 @@ public:
   void SwapUCode(u32 crc);
 
 private:
+  static void HLEThread(DSPHLE* dsp_hle);
+  void StartThread();
+  void StopThread();
+  // Waits for the HLE thread to handle every mail sent so far and makes the mail it sent in
+  // response visible to the CPU. Must be called before the CPU thread touches the uCode.
+  void SyncWithThread();
+  bool IsThreadIdle() const;
+
   void SendMailToDSP(u32 mail);
 
   // Fake mailbox utility
@@ -67,5 +80,16 @@ private:
   DSP::UDSPControl m_dsp_control;
   u64 m_control_reg_init_code_clear_time = 0;
   CMailHandler m_mail_handler;
+
+  // When the HLE thread is enabled, mail written by the CPU is handed to the uCode through
+  // m_cpu_mails, and everything else that needs the uCode syncs with the thread first.
+  std::thread m_hle_thread;
+  bool m_is_hle_on_thread = false;
+  Common::Flag m_is_running;
+  Common::SPSCQueue<u32, false> m_cpu_mails;
+  u64 m_mails_sent = 0;
+  std::atomic<u64> m_mails_handled{0};
+  Common::Event m_hle_event;
+  Common::Event m_idle_event;
 };
 }  // namespace DSP::HLE
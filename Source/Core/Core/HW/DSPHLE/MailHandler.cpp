@@ -21,6 +21,12 @@ CMailHandler::~CMailHandler()
 
 void CMailHandler::PushMail(u32 mail, bool interrupt, int cycles_into_future)
 {
+  if (m_deferred)
+  {
+    m_deferred_calls.push_back({mail, interrupt, cycles_into_future, false});
+    return;
+  }
+
   if (interrupt)
   {
     if (m_pending_mails.empty())
@@ -71,14 +77,40 @@ u16 CMailHandler::ReadDSPMailboxLow()
 
 void CMailHandler::ClearPending()
 {
+  if (m_deferred)
+  {
+    m_deferred_calls.push_back({0, false, 0, true});
+    return;
+  }
+
   m_pending_mails.clear();
 }
 
 bool CMailHandler::HasPending() const
 {
+  // A deferred ClearPending call drops everything that was pushed before it.
+  if (!m_deferred_calls.empty())
+    return !m_deferred_calls.back().clear_pending;
   return !m_pending_mails.empty();
 }
 
+void CMailHandler::SetDeferred(bool deferred)
+{
+  m_deferred = deferred;
+}
+
+void CMailHandler::ApplyDeferred()
+{
+  for (const DeferredCall& call : m_deferred_calls)
+  {
+    if (call.clear_pending)
+      ClearPending();
+    else
+      PushMail(call.mail, call.interrupt, call.cycles_into_future);
+  }
+  m_deferred_calls.clear();
+}
+
 void CMailHandler::SetHalted(bool halt)
 {
   m_halted = halt;
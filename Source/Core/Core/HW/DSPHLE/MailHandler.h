@@ -5,6 +5,7 @@
 
 #include <deque>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -34,7 +35,22 @@ public:
   u16 ReadDSPMailboxHigh();
   u16 ReadDSPMailboxLow();
 
+  // While deferred, PushMail and ClearPending calls are recorded instead of being applied, so that
+  // a uCode running on the DSP HLE thread never touches the mail state the CPU reads. The recorded
+  // calls are replayed in order by ApplyDeferred, which must be called on the CPU thread while the
+  // uCode is not running.
+  void SetDeferred(bool deferred);
+  void ApplyDeferred();
+
 private:
+  struct DeferredCall
+  {
+    u32 mail;
+    bool interrupt;
+    int cycles_into_future;
+    bool clear_pending;
+  };
+
   // The actual DSP only has a single pair of mail registers, and doesn't keep track of pending
   // mails. But for HLE, it's a lot easier to write all the mails that will be read ahead of time,
   // and then give them to the CPU in the requested order.
@@ -44,5 +60,8 @@ private:
   u32 m_last_mail = 0;
   // When halted, the DSP itself is not running, but the last mail can be read.
   bool m_halted = false;
+
+  std::vector<DeferredCall> m_deferred_calls;
+  bool m_deferred = false;
 };
 }  // namespace DSP::HLE
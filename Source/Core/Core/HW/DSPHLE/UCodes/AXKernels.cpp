@@ -0,0 +1,238 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXKernels.h"
+
+#include <algorithm>
+
+#include "Common/MathUtil.h"
+
+#if defined(_M_X86) || defined(_M_X86_64)
+#define USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace DSP::HLE::AXKernels
+{
+namespace
+{
+constexpr u32 VECTOR_SIZE = 8;
+
+s16 ScaleSample(s16 sample, u16 volume)
+{
+  const s32 scaled = (s32(sample) * volume) >> 15;
+  return static_cast<s16>(std::clamp(scaled, -32767, 32767));  // -32768 ?
+}
+
+#if defined(USE_SSE)
+// Computes the 32-bit products of signed samples and unsigned factors.
+void MultiplyUnsigned(__m128i samples, __m128i factors, __m128i* lo, __m128i* hi)
+{
+  // _mm_mulhi_epi16 treats factors >= 0x8000 as negative, which is off by samples << 16.
+  const __m128i correction = _mm_and_si128(samples, _mm_srai_epi16(factors, 15));
+  const __m128i prod_lo = _mm_mullo_epi16(samples, factors);
+  const __m128i prod_hi = _mm_add_epi16(_mm_mulhi_epi16(samples, factors), correction);
+  *lo = _mm_unpacklo_epi16(prod_lo, prod_hi);
+  *hi = _mm_unpackhi_epi16(prod_lo, prod_hi);
+}
+
+__m128i ScaleSamples(__m128i samples, __m128i volumes)
+{
+  __m128i lo, hi;
+  MultiplyUnsigned(samples, volumes, &lo, &hi);
+  const __m128i scaled = _mm_packs_epi32(_mm_srai_epi32(lo, 15), _mm_srai_epi32(hi, 15));
+  return _mm_max_epi16(scaled, _mm_set1_epi16(-32767));
+}
+
+__m128i RampVolumes(u16 volume, u16 volume_delta)
+{
+  const __m128i lane_index = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m128i steps = _mm_mullo_epi16(_mm_set1_epi16(s16(volume_delta)), lane_index);
+  return _mm_add_epi16(_mm_set1_epi16(s16(volume)), steps);
+}
+#endif
+}  // namespace
+
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta)
+{
+  u32 i = 0;
+
+#if defined(USE_SSE)
+  for (; i + VECTOR_SIZE <= count; i += VECTOR_SIZE)
+  {
+    __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+    _mm_storeu_si128(ptr, ScaleSamples(_mm_loadu_si128(ptr), RampVolumes(volume, volume_delta)));
+    volume = static_cast<u16>(volume + volume_delta * VECTOR_SIZE);
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    samples[i] = ScaleSample(samples[i], volume);
+    volume += volume_delta;
+  }
+
+  return volume;
+}
+
+u16 MixAdd(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta,
+           s16* last_sample)
+{
+  u32 i = 0;
+
+#if defined(USE_SSE)
+  for (; i + VECTOR_SIZE <= count; i += VECTOR_SIZE)
+  {
+    const __m128i scaled =
+        ScaleSamples(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)),
+                     RampVolumes(volume, volume_delta));
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(scaled, scaled), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(scaled, scaled), 16);
+
+    __m128i* dst = reinterpret_cast<__m128i*>(out + i);
+    _mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), lo));
+    _mm_storeu_si128(dst + 1, _mm_add_epi32(_mm_loadu_si128(dst + 1), hi));
+
+    *last_sample = static_cast<s16>(_mm_extract_epi16(scaled, 7));
+    volume = static_cast<u16>(volume + volume_delta * VECTOR_SIZE);
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    const s16 sample = ScaleSample(input[i], volume);
+    out[i] += sample;
+    volume += volume_delta;
+
+    *last_sample = sample;
+  }
+
+  return volume;
+}
+
+u64 GetResampleInputCount(u32 count, u32 curr_pos, u32 ratio)
+{
+  return (u64(curr_pos) + u64(ratio) * count) >> 16;
+}
+
+// Both resamplers track the position of the current output sample relative to the first history
+// sample. The integer part is the number of new input samples consumed so far, so the samples to
+// interpolate between start at input[pos >> 16].
+
+void ResampleLinear(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio)
+{
+  u64 pos = curr_pos;
+  u32 i = 0;
+
+#if defined(USE_SSE)
+  for (; i + VECTOR_SIZE <= count; i += VECTOR_SIZE)
+  {
+    alignas(16) s16 s0[VECTOR_SIZE];
+    alignas(16) s16 s1[VECTOR_SIZE];
+    alignas(16) u16 frac[VECTOR_SIZE];
+    for (u32 j = 0; j < VECTOR_SIZE; ++j)
+    {
+      pos += ratio;
+      s0[j] = input[pos >> 16];
+      s1[j] = input[(pos >> 16) + 1];
+      frac[j] = static_cast<u16>(pos);
+    }
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i curr0 = _mm_load_si128(reinterpret_cast<const __m128i*>(s0));
+    const __m128i curr1 = _mm_load_si128(reinterpret_cast<const __m128i*>(s1));
+    const __m128i curr_frac = _mm_load_si128(reinterpret_cast<const __m128i*>(frac));
+    const __m128i inv_curr_frac = _mm_sub_epi16(zero, curr_frac);
+
+    __m128i a_lo, a_hi, b_lo, b_hi;
+    MultiplyUnsigned(curr0, inv_curr_frac, &a_lo, &a_hi);
+    MultiplyUnsigned(curr1, curr_frac, &b_lo, &b_hi);
+    const __m128i lo = _mm_srai_epi32(_mm_add_epi32(a_lo, b_lo), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_add_epi32(a_hi, b_hi), 16);
+    const __m128i interpolated = _mm_packs_epi32(lo, hi);
+
+    // If curr_frac is 0, take the first sample as is.
+    const __m128i whole = _mm_cmpeq_epi16(curr_frac, zero);
+    const __m128i result =
+        _mm_or_si128(_mm_and_si128(whole, curr0), _mm_andnot_si128(whole, interpolated));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), result);
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    pos += ratio;
+    const s32 s0 = input[pos >> 16];
+    const s32 s1 = input[(pos >> 16) + 1];
+    const u16 curr_frac = static_cast<u16>(pos);
+    const u16 inv_curr_frac = -curr_frac;
+
+    if (curr_frac)
+      output[i] = static_cast<s16>(((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16);
+    else
+      output[i] = static_cast<s16>(s0);
+  }
+}
+
+void ResamplePolyphase(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio,
+                       const s16* coeffs)
+{
+  u64 pos = curr_pos;
+  u32 i = 0;
+
+#if defined(USE_SSE)
+  for (; i + VECTOR_SIZE <= count; i += VECTOR_SIZE)
+  {
+    alignas(16) s16 taps[4][VECTOR_SIZE];
+    alignas(16) s16 tap_coeffs[4][VECTOR_SIZE];
+    for (u32 j = 0; j < VECTOR_SIZE; ++j)
+    {
+      pos += ratio;
+      const s16* t = &input[pos >> 16];
+      const s16* c = &coeffs[(static_cast<u16>(pos) >> 9) << 2];
+      for (u32 k = 0; k < 4; ++k)
+      {
+        taps[k][j] = t[k];
+        tap_coeffs[k][j] = c[k];
+      }
+    }
+
+    // The sum of four products can overflow 32 bits, so the low 15 bits of each product, which
+    // are shifted out at the end, are accumulated separately from the rest.
+    const __m128i low_mask = _mm_set1_epi32(0x7FFF);
+    __m128i high_lo = _mm_setzero_si128();
+    __m128i high_hi = _mm_setzero_si128();
+    __m128i low_lo = _mm_setzero_si128();
+    __m128i low_hi = _mm_setzero_si128();
+    for (u32 k = 0; k < 4; ++k)
+    {
+      const __m128i t = _mm_load_si128(reinterpret_cast<const __m128i*>(taps[k]));
+      const __m128i c = _mm_load_si128(reinterpret_cast<const __m128i*>(tap_coeffs[k]));
+      const __m128i prod_lo = _mm_mullo_epi16(t, c);
+      const __m128i prod_hi = _mm_mulhi_epi16(t, c);
+      const __m128i lo = _mm_unpacklo_epi16(prod_lo, prod_hi);
+      const __m128i hi = _mm_unpackhi_epi16(prod_lo, prod_hi);
+      high_lo = _mm_add_epi32(high_lo, _mm_srai_epi32(lo, 15));
+      high_hi = _mm_add_epi32(high_hi, _mm_srai_epi32(hi, 15));
+      low_lo = _mm_add_epi32(low_lo, _mm_and_si128(lo, low_mask));
+      low_hi = _mm_add_epi32(low_hi, _mm_and_si128(hi, low_mask));
+    }
+    const __m128i lo = _mm_add_epi32(high_lo, _mm_srli_epi32(low_lo, 15));
+    const __m128i hi = _mm_add_epi32(high_hi, _mm_srli_epi32(low_hi, 15));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(lo, hi));
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    pos += ratio;
+    const s16* t = &input[pos >> 16];
+    const s16* c = &coeffs[(static_cast<u16>(pos) >> 9) << 2];
+
+    const s64 sample = (s64(t[0]) * c[0] + s64(t[1]) * c[1] + s64(t[2]) * c[2] +
+                        s64(t[3]) * c[3]) >>
+                       15;
+    output[i] = MathUtil::SaturatingCast<s16>(sample);
+  }
+}
+}  // namespace DSP::HLE::AXKernels
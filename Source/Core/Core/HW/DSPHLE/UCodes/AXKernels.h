@@ -0,0 +1,37 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Sample processing kernels shared by AX GC and AX Wii voice processing. The results are
+// identical to processing one sample at a time, but several samples are handled at once where
+// the host supports it.
+namespace DSP::HLE::AXKernels
+{
+// Multiplies the samples by a 1.15 fixed point volume, which is incremented by volume_delta after
+// each sample, and saturates the results to [-32767, 32767]. Returns the volume after the last
+// sample.
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta);
+
+// Scales the input like ApplyVolumeRamp and adds the results to out. The last scaled sample is
+// stored to *last_sample if count is not zero.
+u16 MixAdd(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta,
+           s16* last_sample);
+
+// The resamplers below read from input, which holds the four history samples of the voice
+// followed by GetResampleInputCount() new input samples.
+//
+// curr_pos and ratio are 16.16 fixed point numbers. curr_pos must be less than 0x10000.
+
+// Returns the number of new input samples needed to produce count output samples.
+u64 GetResampleInputCount(u32 count, u32 curr_pos, u32 ratio);
+
+// Linear interpolation between two neighbouring input samples.
+void ResampleLinear(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio);
+
+// 4-tap polyphase filter, using the 64 phases of 4 coefficients in coeffs.
+void ResamplePolyphase(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio,
+                       const s16* coeffs);
+}  // namespace DSP::HLE::AXKernels
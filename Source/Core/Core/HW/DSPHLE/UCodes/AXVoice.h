@@ -12,7 +12,6 @@
 #endif
 
 #include <algorithm>
-#include <functional>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -20,6 +19,7 @@
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
+#include "Core/HW/DSPHLE/UCodes/AXKernels.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -206,16 +206,18 @@ void AcceleratorSetup(PB_TYPE* pb)
   s_accelerator->SetPredScale(pb->adpcm.pred_scale);
 }
 
-// Reads a sample from the accelerator. Also handles looping and
+// Reads samples from the accelerator. Also handles looping and
 // disabling streams that reached the end (this is done by an exception raised
 // by the accelerator on real hardware).
-u16 AcceleratorGetSample()
+void AcceleratorGetSamples(s16* samples, u32 count)
 {
-  return s_accelerator->Read(acc_pb->adpcm.coefs);
+  s_accelerator->ReadSamples(samples, count, acc_pb->adpcm.coefs);
 }
 
 // Reads samples from the input callback, resamples them to <count> samples at
-// the wanted sample rate (computed from the ratio, see below).
+// the wanted sample rate (computed from the ratio, see below). The callback is
+// called as input_callback(s16* samples, u32 count) and stores the next <count>
+// input samples.
 //
 // If srctype is SRCTYPE_POLYPHASE, coefficients need to be provided as well
 // (or the srctype will automatically be changed to LINEAR).
@@ -234,10 +236,30 @@ u16 AcceleratorGetSample()
 // We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
 // avoids discontinuities in the audio stream, especially with very low ratios
 // which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
+template <typename InputCallback>
+u32 ResampleAudio(InputCallback input_callback, s16* output, u32 count, s16* last_samples,
                   u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
 {
-  int read_samples_count = 0;
+  // Fetch all the input samples at once, so that the kernels can process several output samples
+  // at a time. Unusually high ratios fall back to the loops below.
+  constexpr u32 MAX_RESAMPLE_INPUT = 8 * MAX_SAMPLES_PER_FRAME;
+  const u64 input_count = AXKernels::GetResampleInputCount(count, curr_pos, ratio);
+  if ((srctype == SRCTYPE_LINEAR || srctype == SRCTYPE_POLYPHASE) && curr_pos < 0x10000 &&
+      input_count <= MAX_RESAMPLE_INPUT)
+  {
+    // The four history samples from the PB, followed by the new samples.
+    s16 input[4 + MAX_RESAMPLE_INPUT];
+    std::copy_n(last_samples, 4, input);
+    input_callback(input + 4, static_cast<u32>(input_count));
+
+    if (coeffs && srctype == SRCTYPE_POLYPHASE)
+      AXKernels::ResamplePolyphase(input, output, count, curr_pos, ratio, coeffs);
+    else
+      AXKernels::ResampleLinear(input, output, count, curr_pos, ratio);
+
+    std::copy_n(input + input_count, 4, last_samples);
+    return static_cast<u32>((curr_pos + u64(ratio) * count) & 0xFFFF);
+  }
 
   // If DSP DROM coefficients are available, support polyphase resampling.
   if (coeffs && srctype == SRCTYPE_POLYPHASE)
@@ -255,7 +277,7 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
       curr_pos += ratio;
       while (curr_pos >= 0x10000)
       {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
+        input_callback(&temp[idx++ & 3], 1);
         curr_pos -= 0x10000;
       }
 
@@ -298,7 +320,7 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
       // circular buffer.
       while (curr_pos >= 0x10000)
       {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
+        input_callback(&temp[idx++ & 3], 1);
         curr_pos -= 0x10000;
       }
 
@@ -337,8 +359,7 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
   {
     // No sample rate conversion here: simply read samples from the
     // accelerator to the output buffer.
-    for (u32 i = 0; i < count; ++i)
-      output[i] = input_callback(i);
+    input_callback(output, count);
 
     memcpy(last_samples, output + count - 4, 4 * sizeof(u16));
   }
@@ -354,9 +375,8 @@ void GetInputSamples(PB_TYPE& pb, s16* samples, u16 count, const s16* coeffs)
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos =
-      ResampleAudio([](u32) { return AcceleratorGetSample(); }, samples, count, pb.src.last_samples,
-                    pb.src.cur_addr_frac, HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+  u32 curr_pos = ResampleAudio(AcceleratorGetSamples, samples, count, pb.src.last_samples,
+                               pb.src.cur_addr_frac, HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -370,27 +390,12 @@ void GetInputSamples(PB_TYPE& pb, s16* samples, u16 count, const s16* coeffs)
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
-  u16& volume = vd->volume;
-  u16 volume_delta = vd->volume_delta;
-
   // If volume ramping is disabled, set volume_delta to 0. That way, the
   // mixing loop can avoid testing if volume ramping is enabled at each step,
   // and just add volume_delta.
-  if (!ramp)
-    volume_delta = 0;
+  const u16 volume_delta = ramp ? vd->volume_delta : 0;
 
-  for (u32 i = 0; i < count; ++i)
-  {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    sample = std::clamp((s32)sample, -32767, 32767);  // -32768 ?
-
-    out[i] += (s16)sample;
-    volume += volume_delta;
-
-    *dpop = (s16)sample;
-  }
+  vd->volume = AXKernels::MixAdd(out, input, count, vd->volume, volume_delta, dpop);
 }
 
 // Execute a low pass filter on the samples using one history value. Returns
@@ -416,12 +421,8 @@ void ProcessVoice(PB_TYPE& pb, const AXBuffers& buffers, u16 count, AXMixControl
   GetInputSamples(pb, samples, count, coeffs);
 
   // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
-  {
-    const s32 sample = ((s32)samples[i] * pb.vol_env.cur_volume) >> 15;
-    samples[i] = std::clamp(sample, -32767, 32767);  // -32768 ?
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  pb.vol_env.cur_volume = AXKernels::ApplyVolumeRamp(samples, count, pb.vol_env.cur_volume,
+                                                     static_cast<u16>(pb.vol_env.cur_volume_delta));
 
   // Optionally, execute a low pass filter
   if (pb.lpf.enabled)
@@ -523,9 +524,12 @@ void ProcessVoice(PB_TYPE& pb, const AXBuffers& buffers, u16 count, AXMixControl
 
     // We use ratio 0x55555 == (5 * 65536 + 21845) / 65536 == 5.3333 which
     // is the nearest we can get to 96/18
-    u32 curr_pos = ResampleAudio([&samples](u32 i) { return samples[i]; }, wm_samples, wm_count,
-                                 pb.remote_src.last_samples, pb.remote_src.cur_addr_frac, 0x55555,
-                                 SRCTYPE_POLYPHASE, coeffs);
+    const auto read_input = [input = static_cast<const s16*>(samples)](s16* out, u32 n) mutable {
+      std::copy_n(input, n, out);
+      input += n;
+    };
+    u32 curr_pos = ResampleAudio(read_input, wm_samples, wm_count, pb.remote_src.last_samples,
+                                 pb.remote_src.cur_addr_frac, 0x55555, SRCTYPE_POLYPHASE, coeffs);
     pb.remote_src.cur_addr_frac = curr_pos & 0xFFFF;
 
 // Mix to main[0-3] and aux[0-3]
@@ -59,6 +59,8 @@ void HLEMemory_Write_U8(u32 address, u8 value)
     memory.GetEXRAM()[address & memory.GetExRamMask()] = value;
   else
     memory.GetRAM()[address & memory.GetRamMask()] = value;
+
+  memory.MarkWritten(address, sizeof(value));
 }
 
 u16 HLEMemory_Read_U16LE(u32 address)
@@ -90,6 +92,8 @@ void HLEMemory_Write_U16LE(u32 address, u16 value)
     std::memcpy(&memory.GetEXRAM()[address & memory.GetExRamMask()], &value, sizeof(u16));
   else
     std::memcpy(&memory.GetRAM()[address & memory.GetRamMask()], &value, sizeof(u16));
+
+  memory.MarkWritten(address, sizeof(value));
 }
 
 void HLEMemory_Write_U16(u32 address, u16 value)
@@ -126,6 +130,8 @@ void HLEMemory_Write_U32LE(u32 address, u32 value)
     std::memcpy(&memory.GetEXRAM()[address & memory.GetExRamMask()], &value, sizeof(u32));
   else
     std::memcpy(&memory.GetRAM()[address & memory.GetRamMask()], &value, sizeof(u32));
+
+  memory.MarkWritten(address, sizeof(value));
 }
 
 void HLEMemory_Write_U32(u32 address, u32 value)
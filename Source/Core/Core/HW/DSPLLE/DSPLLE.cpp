@@ -3,6 +3,7 @@
 
 #include "Core/HW/DSPLLE/DSPLLE.h"
 
+#include <algorithm>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -57,6 +58,7 @@ void DSPLLE::DoState(PointerWrap& p)
 void DSPLLE::DSPThread(DSPLLE* dsp_lle)
 {
   Common::SetCurrentThreadName("DSP thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
 
   while (dsp_lle->m_is_running.IsSet())
   {
@@ -74,7 +76,8 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
         {
           dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(cycles);
         }
-        dsp_lle->m_cycle_count.store(0);
+        // The CPU thread may have granted more cycles in the meantime
+        dsp_lle->m_cycle_count.fetch_sub(cycles);
         continue;
       }
     }
@@ -212,16 +215,19 @@ u16 DSPLLE::DSP_ReadControlRegister()
 
 u16 DSPLLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
 {
+  m_mailbox_accessed = true;
   return m_dsp_core.ReadMailboxHigh(cpu_mailbox ? Mailbox::CPU : Mailbox::DSP);
 }
 
 u16 DSPLLE::DSP_ReadMailBoxLow(bool cpu_mailbox)
 {
+  m_mailbox_accessed = true;
   return m_dsp_core.ReadMailboxLow(cpu_mailbox ? Mailbox::CPU : Mailbox::DSP);
 }
 
 void DSPLLE::DSP_WriteMailBoxHigh(bool cpu_mailbox, u16 value)
 {
+  m_mailbox_accessed = true;
   if (cpu_mailbox)
   {
     if ((m_dsp_core.PeekMailbox(Mailbox::CPU) & 0x80000000) != 0)
@@ -240,6 +246,7 @@ void DSPLLE::DSP_WriteMailBoxHigh(bool cpu_mailbox, u16 value)
 
 void DSPLLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
 {
+  m_mailbox_accessed = true;
   if (cpu_mailbox)
   {
     m_dsp_core.WriteMailboxLow(Mailbox::CPU, value);
@@ -261,6 +268,9 @@ void DSPLLE::DSP_Update(int cycles)
   {
     if (m_request_disable_thread || Core::WantsDeterminism())
     {
+      // Let the DSP thread finish the cycles it's still behind on before running them here
+      while (m_cycle_count.load() != 0)
+        m_ppc_event.Wait();
       DSP_StopSoundStream();
       m_is_dsp_on_thread = false;
       m_request_disable_thread = false;
@@ -276,8 +286,20 @@ void DSPLLE::DSP_Update(int cycles)
   }
   else
   {
-    // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
-    m_ppc_event.Wait();
+    // Without mailbox traffic, let the DSP thread fall further behind, up to 8 updates, so that
+    // neither thread has to wait for the other after every update.
+    if (m_mailbox_accessed)
+      m_allowed_backlog = 0;
+    else if (m_allowed_backlog == 0)
+      m_allowed_backlog = dsp_cycles;
+    else
+      m_allowed_backlog = std::min<u32>(m_allowed_backlog * 2, dsp_cycles * 8);
+    m_mailbox_accessed = false;
+
+    // The DSP thread signals m_ppc_event whenever it has run out of cycles
+    while (m_cycle_count.load() > m_allowed_backlog)
+      m_ppc_event.Wait();
+
     m_cycle_count.fetch_add(dsp_cycles);
     m_dsp_event.Set();
   }
@@ -301,7 +323,6 @@ void DSPLLE::PauseAndLock(bool do_lock, bool unpause_on_unlock)
     if (m_is_dsp_on_thread)
     {
       // Signal the DSP thread so it can perform any outstanding work now (if any)
-      m_ppc_event.Wait();
       m_dsp_event.Set();
     }
   }
@@ -51,5 +51,11 @@ private:
   Common::Event m_dsp_event;
   Common::Event m_ppc_event;
   bool m_request_disable_thread = false;
+
+  // How many granted cycles the DSP thread may still have left when more are handed to it. This
+  // grows while the CPU leaves the mailboxes alone, and drops back to 0 (lockstep) whenever it
+  // touches them, since that's when the two sides need to see each other's progress.
+  u32 m_allowed_backlog = 0;
+  bool m_mailbox_accessed = false;
 };
 }  // namespace DSP::LLE
@@ -7,24 +7,31 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
+#include "Common/FileUtil.h"
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/SPSCQueue.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
+#include "Common/Trace.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DVD/DVDInterface.h"
+#include "Core/HW/DVD/DiscAccessTrace.h"
 #include "Core/HW/DVD/FileMonitor.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
@@ -36,6 +43,11 @@
 
 namespace DVDThread
 {
+// How much data following the last request to prefetch
+constexpr u32 READAHEAD_SIZE = 0x80000;
+// How far ahead of a read to prefetch what followed it last time, going by the access trace
+constexpr u32 TRACE_PREFETCH_SIZE = 0x100000;
+
 struct ReadRequest
 {
   bool copy_to_ram = false;
@@ -74,6 +86,9 @@ static void StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_offs
 
 static void FinishRead(Core::System& system, u64 id, s64 cycles_late);
 
+static void LoadAccessTrace(DVDThreadState::Data& state);
+static void SaveAccessTrace(DVDThreadState::Data& state);
+
 struct DVDThreadState::Data
 {
   CoreTiming::EventType* finish_read;
@@ -92,6 +107,11 @@ struct DVDThreadState::Data
   std::unique_ptr<DiscIO::Volume> disc;
 
   FileMonitor::FileLogger file_logger;
+
+  DiscAccessTrace access_trace;
+  std::string access_trace_path;
+
+  ReadLatencyHistogram read_latency{READ_LATENCY_BUCKETS_US};
 };
 
 DVDThreadState::DVDThreadState() : m_data(std::make_unique<Data>())
@@ -116,6 +136,8 @@ void Start()
   // much, because this will never get exposed to the emulated game.
   state.next_id = 0;
 
+  state.read_latency.Reset();
+
   StartDVDThread(state);
 }
 
@@ -130,6 +152,7 @@ void Stop()
 {
   auto& state = Core::System::GetInstance().GetDVDThreadState().GetData();
   StopDVDThread(state);
+  SaveAccessTrace(state);
   state.disc.reset();
 }
 
@@ -192,12 +215,46 @@ void DoState(PointerWrap& p)
   // was made. Handling that properly may be more effort than it's worth.
 }
 
+const ReadLatencyHistogram& GetReadLatencyHistogram()
+{
+  return Core::System::GetInstance().GetDVDThreadState().GetData().read_latency;
+}
+
 void SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   auto& state = Core::System::GetInstance().GetDVDThreadState().GetData();
 
   WaitUntilIdle();
+  SaveAccessTrace(state);
   state.disc = std::move(disc);
+  LoadAccessTrace(state);
+}
+
+static void LoadAccessTrace(DVDThreadState::Data& state)
+{
+  state.access_trace.Clear();
+  state.access_trace_path.clear();
+
+  if (!state.disc || !Config::Get(Config::MAIN_DISC_ACCESS_TRACE))
+    return;
+
+  const std::string game_id = state.disc->GetGameID();
+  if (game_id.empty())
+    return;
+
+  state.access_trace_path =
+      fmt::format("{}DiscAccessTraces/{}_{}_{}.trace", File::GetUserPath(D_CACHE_IDX), game_id,
+                  state.disc->GetRevision().value_or(0), state.disc->GetDiscNumber().value_or(0));
+  state.access_trace.Load(state.access_trace_path);
+}
+
+static void SaveAccessTrace(DVDThreadState::Data& state)
+{
+  if (!state.access_trace_path.empty())
+    state.access_trace.Save(state.access_trace_path);
+
+  state.access_trace.Clear();
+  state.access_trace_path.clear();
 }
 
 bool HasDisc()
@@ -379,6 +436,10 @@ static void FinishRead(Core::System& system, u64 id, s64 cycles_late)
                 (system.GetCoreTiming().GetTicks() - request.time_started_ticks) /
                     (SystemTimers::GetTicksPerSecond() / 1000000));
 
+  // Requests restored from a savestate can carry times from a different run, see DoState.
+  if (request.realtime_done_us >= request.realtime_started_us)
+    state.read_latency.Add(request.realtime_done_us - request.realtime_started_us);
+
   DVDInterface::DIInterruptType interrupt;
   if (buffer.size() != request.length)
   {
@@ -408,6 +469,7 @@ static void DVDThread()
   auto& state = Core::System::GetInstance().GetDVDThreadState().GetData();
 
   Common::SetCurrentThreadName("DVD thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
 
   while (true)
   {
@@ -416,23 +478,59 @@ static void DVDThread()
     if (state.dvd_thread_exiting.IsSet())
       return;
 
+    // Take every request which is already queued and hint all of them to the disc up front, so
+    // that readers which support it can have several of them in flight at once. The whole batch
+    // must be finished before checking dvd_thread_exiting, since WaitUntilIdle only waits for
+    // the request queue to be empty.
+    std::vector<ReadRequest> requests;
     ReadRequest request;
     while (state.request_queue.Pop(request))
+      requests.push_back(std::move(request));
+
+    if (requests.empty())
+      continue;
+
+    const bool use_access_trace = !state.access_trace_path.empty();
+    for (const ReadRequest& queued : requests)
     {
-      state.file_logger.Log(*state.disc, request.partition, request.dvd_offset);
+      state.disc->Prefetch(queued.dvd_offset, queued.length, queued.partition);
+
+      // If this read was seen before, start on what the game read after it last time
+      if (use_access_trace)
+      {
+        for (const DiscAccessTrace::Entry& entry : state.access_trace.Predict(
+                 queued.partition.offset, queued.dvd_offset, TRACE_PREFETCH_SIZE))
+        {
+          state.disc->Prefetch(entry.offset, entry.length, DiscIO::Partition(entry.partition));
+        }
+      }
+    }
 
-      std::vector<u8> buffer(request.length);
-      if (!state.disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+    for (ReadRequest& queued : requests)
+    {
+      TRACE_ZONE("DVDThread::Read");
+
+      state.file_logger.Log(*state.disc, queued.partition, queued.dvd_offset);
+      if (use_access_trace)
+        state.access_trace.Record(queued.partition.offset, queued.dvd_offset, queued.length);
+
+      std::vector<u8> buffer(queued.length);
+      if (!state.disc->Read(queued.dvd_offset, queued.length, buffer.data(), queued.partition))
         buffer.resize(0);
 
-      request.realtime_done_us = Common::Timer::NowUs();
+      queued.realtime_done_us = Common::Timer::NowUs();
 
-      state.result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
+      state.result_queue.Push(ReadResult(std::move(queued), std::move(buffer)));
       state.result_queue_expanded.Set();
-
-      if (state.dvd_thread_exiting.IsSet())
-        return;
     }
+
+    // Games mostly read sequentially, so start on the data after the last read while the
+    // emulated software processes what it got
+    const ReadRequest& last = requests.back();
+    state.disc->Prefetch(last.dvd_offset + last.length, READAHEAD_SIZE, last.partition);
+
+    if (state.dvd_thread_exiting.IsSet())
+      return;
   }
 }
 }  // namespace DVDThread
@@ -3,11 +3,13 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <optional>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Histogram.h"
 
 class PointerWrap;
 namespace DiscIO
@@ -34,6 +36,11 @@ class TicketReader;
 
 namespace DVDThread
 {
+// Upper bounds of the read latency histogram buckets, in microseconds.
+constexpr std::array<u64, 10> READ_LATENCY_BUCKETS_US = {100,   500,   1000,   2000,  5000,
+                                                         10000, 20000, 50000, 100000, 500000};
+using ReadLatencyHistogram = Common::Histogram<READ_LATENCY_BUCKETS_US.size()>;
+
 class DVDThreadState
 {
 public:
@@ -55,6 +62,10 @@ void Start();
 void Stop();
 void DoState(PointerWrap& p);
 
+// The real time the DVD thread took to finish each read since the last Start, not including the
+// emulated delay. Can be read from any thread.
+const ReadLatencyHistogram& GetReadLatencyHistogram();
+
 void SetDisc(std::unique_ptr<DiscIO::Volume> disc);
 bool HasDisc();
 
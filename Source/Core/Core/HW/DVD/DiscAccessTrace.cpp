@@ -0,0 +1,156 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DVD/DiscAccessTrace.h"
+
+#include <algorithm>
+
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace DVDThread
+{
+namespace
+{
+constexpr u32 TRACE_MAGIC = 0x43525444;  // "DTRC"
+constexpr u32 TRACE_VERSION = 1;
+
+struct TraceHeader
+{
+  u32 magic;
+  u32 version;
+  u64 entry_count;
+};
+}  // namespace
+
+void DiscAccessTrace::Load(const std::string& path)
+{
+  Clear();
+
+  File::IOFile file(path, "rb");
+  TraceHeader header;
+  if (!file.ReadArray(&header, 1))
+    return;
+
+  if (header.magic != TRACE_MAGIC || header.version != TRACE_VERSION ||
+      header.entry_count > MAX_ENTRIES)
+  {
+    WARN_LOG_FMT(DVDINTERFACE, "Ignoring disc access trace {} with unknown format", path);
+    return;
+  }
+
+  std::vector<Entry> entries(header.entry_count);
+  if (!file.ReadArray(entries.data(), entries.size()))
+    return;
+
+  m_loaded = std::move(entries);
+  for (size_t i = 0; i < m_loaded.size(); ++i)
+    m_loaded_index.emplace(std::pair(m_loaded[i].partition, m_loaded[i].offset), i);
+
+  INFO_LOG_FMT(DVDINTERFACE, "Loaded disc access trace {} with {} entries", path,
+               m_loaded.size());
+}
+
+void DiscAccessTrace::Save(const std::string& path) const
+{
+  if (m_recorded.empty() || m_recorded.size() < m_loaded.size())
+    return;
+
+  if (!File::CreateFullPath(path))
+    return;
+
+  File::IOFile file(path, "wb");
+  const TraceHeader header{TRACE_MAGIC, TRACE_VERSION, m_recorded.size()};
+  if (!file.WriteArray(&header, 1) || !file.WriteArray(m_recorded.data(), m_recorded.size()))
+    WARN_LOG_FMT(DVDINTERFACE, "Failed to write disc access trace {}", path);
+}
+
+void DiscAccessTrace::Clear()
+{
+  m_loaded.clear();
+  m_loaded_index.clear();
+  m_cursor = 0;
+  m_predicted_until = 0;
+  m_recorded.clear();
+}
+
+void DiscAccessTrace::Record(u64 partition, u64 offset, u32 length)
+{
+  if (length == 0)
+    return;
+
+  if (!m_recorded.empty())
+  {
+    Entry& last = m_recorded.back();
+    if (last.partition == partition && last.offset + last.length == offset &&
+        last.length + u64(length) <= MAX_ENTRY_LENGTH)
+    {
+      last.length += length;
+      return;
+    }
+  }
+
+  if (m_recorded.size() < MAX_ENTRIES)
+    m_recorded.push_back(Entry{partition, offset, std::min(length, MAX_ENTRY_LENGTH), 0});
+}
+
+std::optional<size_t> DiscAccessTrace::FindLoadedEntry(u64 partition, u64 offset) const
+{
+  const auto contains = [&](size_t i) {
+    const Entry& entry = m_loaded[i];
+    return entry.partition == partition && offset >= entry.offset &&
+           offset < entry.offset + entry.length;
+  };
+
+  // Reads which continue the current entry (or go on to the next one) are the common case
+  if (m_cursor < m_loaded.size() && contains(m_cursor))
+    return m_cursor;
+  if (m_cursor + 1 < m_loaded.size() && contains(m_cursor + 1))
+    return m_cursor + 1;
+
+  // Otherwise, go by where an entry starts, preferring the first occurrence after the cursor
+  const auto [begin, end] = m_loaded_index.equal_range(std::pair(partition, offset));
+  if (begin == end)
+    return std::nullopt;
+
+  for (auto it = begin; it != end; ++it)
+  {
+    if (it->second > m_cursor)
+      return it->second;
+  }
+  return begin->second;
+}
+
+std::vector<DiscAccessTrace::Entry> DiscAccessTrace::Predict(u64 partition, u64 offset,
+                                                             u32 max_length)
+{
+  const std::optional<size_t> index = FindLoadedEntry(partition, offset);
+  if (!index)
+    return {};
+
+  // After a jump, whatever was predicted before doesn't apply anymore
+  if (*index < m_cursor || *index >= m_predicted_until)
+    m_predicted_until = *index + 1;
+  m_cursor = *index;
+
+  // Only look max_length bytes ahead of the current read, so that predictions don't run so far
+  // ahead of the game that the prefetched data gets evicted before it's used
+  std::vector<Entry> prediction;
+  u64 total_length = 0;
+  for (size_t i = *index + 1; i < m_loaded.size() && total_length < max_length; ++i)
+  {
+    Entry entry = m_loaded[i];
+    entry.length = static_cast<u32>(std::min<u64>(entry.length, max_length - total_length));
+    total_length += entry.length;
+
+    if (i >= m_predicted_until)
+    {
+      prediction.push_back(entry);
+      m_predicted_until = i + 1;
+    }
+  }
+
+  return prediction;
+}
+}  // namespace DVDThread
@@ -0,0 +1,64 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace DVDThread
+{
+// Records the order in which a game reads the disc, so that the next time the game runs, the
+// reads which followed a given read last time can be prefetched as soon as it shows up again.
+// Games mostly load the same files in the same order (boot, menus, levels), so this tends to
+// predict well beyond what sequential readahead can.
+//
+// Consecutive reads are merged into one entry, up to MAX_ENTRY_LENGTH bytes, which keeps the
+// trace small when a game streams a file in small pieces.
+class DiscAccessTrace final
+{
+public:
+  struct Entry
+  {
+    u64 partition;
+    u64 offset;
+    u32 length;
+    u32 padding;
+  };
+  static_assert(sizeof(Entry) == 24);
+
+  static constexpr u32 MAX_ENTRY_LENGTH = 0x100000;
+  static constexpr size_t MAX_ENTRIES = 0x10000;
+
+  // Replaces the trace used for predictions with the one in the file, if there's a valid one.
+  // Recording starts over either way.
+  void Load(const std::string& path);
+  // Saves what has been recorded, unless the loaded trace is longer (for instance because the
+  // game was only played for a short while this time).
+  void Save(const std::string& path) const;
+  void Clear();
+
+  void Record(u64 partition, u64 offset, u32 length);
+
+  // Returns the reads which followed this read in the loaded trace, looking up to max_length
+  // bytes ahead, leaving out those which have already been predicted.
+  std::vector<Entry> Predict(u64 partition, u64 offset, u32 max_length);
+
+  const std::vector<Entry>& GetRecorded() const { return m_recorded; }
+
+private:
+  std::optional<size_t> FindLoadedEntry(u64 partition, u64 offset) const;
+
+  std::vector<Entry> m_loaded;
+  std::multimap<std::pair<u64, u64>, size_t> m_loaded_index;
+  size_t m_cursor = 0;
+  size_t m_predicted_until = 0;
+
+  std::vector<Entry> m_recorded;
+};
+}  // namespace DVDThread
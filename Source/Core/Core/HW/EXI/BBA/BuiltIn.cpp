@@ -27,21 +27,21 @@ u64 GetTickCountStd()
   return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
 }
 
-std::vector<u8> BuildFINFrame(StackRef* ref)
+void BuildFINFrame(StackRef* ref, std::vector<u8>* frame)
 {
   const Common::TCPPacket result(ref->bba_mac, ref->my_mac, ref->from, ref->to, ref->seq_num,
                                  ref->ack_num, TCP_FLAG_FIN | TCP_FLAG_ACK | TCP_FLAG_RST);
 
   for (auto& tcp_buf : ref->tcp_buffers)
     tcp_buf.used = false;
-  return result.Build();
+  result.Build(frame);
 }
 
-std::vector<u8> BuildAckFrame(StackRef* ref)
+void BuildAckFrame(StackRef* ref, std::vector<u8>* frame)
 {
   const Common::TCPPacket result(ref->bba_mac, ref->my_mac, ref->from, ref->to, ref->seq_num,
                                  ref->ack_num, TCP_FLAG_ACK);
-  return result.Build();
+  result.Build(frame);
 }
 
 // Change the IP identification and recompute the checksum
@@ -72,7 +72,8 @@ bool CEXIETHERNET::BuiltInBBAInterface::Activate()
 
   m_active = true;
   for (auto& buf : m_queue_data)
-    buf.reserve(2048);
+    buf.reserve(BBA_RECV_SIZE);
+  m_recv_payload.reserve(MAX_UDP_LENGTH);
 
   // Workaround to get the host IP (might not be accurate)
   // TODO: Fix the JNI crash and use GetSystemDefaultInterface()
@@ -133,10 +134,66 @@ bool CEXIETHERNET::BuiltInBBAInterface::IsActivated()
 
 void CEXIETHERNET::BuiltInBBAInterface::WriteToQueue(const std::vector<u8>& data)
 {
-  m_queue_data[m_queue_write] = data;
-  const u8 next_write_index = (m_queue_write + 1) & 15;
-  if (next_write_index != m_queue_read)
-    m_queue_write = next_write_index;
+  *GetQueueWriteSlot() = data;
+  CommitQueueWriteSlot();
+}
+
+bool CEXIETHERNET::BuiltInBBAInterface::IsQueueFull() const
+{
+  return ((m_queue_write + 1) % QUEUE_SIZE) == m_queue_read;
+}
+
+std::vector<u8>* CEXIETHERNET::BuiltInBBAInterface::GetQueueWriteSlot()
+{
+  return &m_queue_data[m_queue_write];
+}
+
+void CEXIETHERNET::BuiltInBBAInterface::CommitQueueWriteSlot()
+{
+  // When the queue is full, the frame is dropped and the slot gets overwritten by the next one.
+  if (!IsQueueFull())
+    m_queue_write = (m_queue_write + 1) % QUEUE_SIZE;
+}
+
+bool CEXIETHERNET::BuiltInBBAInterface::DeliverQueuedFrame()
+{
+  if (m_queue_read == m_queue_write)
+    return false;
+
+  u8 wp = m_eth_ref->page_ptr(BBA_RWP);
+  const u8 rp = m_eth_ref->page_ptr(BBA_RRP);
+  if (rp > wp)
+    wp += 16;
+
+  if ((wp - rp) >= 8)
+    return false;
+
+  const std::vector<u8>& frame = m_queue_data[m_queue_read];
+  size_t datasize = frame.size();
+  if (datasize > BBA_RECV_SIZE)
+  {
+    ERROR_LOG_FMT(SP1, "Frame size is exceiding BBA capacity, frame stack might be corrupted"
+                       "Killing Dolphin...");
+    std::exit(0);
+  }
+  u8* buffer = m_eth_ref->mRecvBuffer.get();
+  std::memcpy(buffer, frame.data(), datasize);
+  m_queue_read = (m_queue_read + 1) % QUEUE_SIZE;
+
+  Common::PacketView packet(buffer, datasize);
+  const auto packet_type = packet.GetEtherType();
+  if (packet_type.has_value() && packet_type == IP_PROTOCOL)
+  {
+    SetIPIdentification(buffer, datasize, ++m_ip_frame_id);
+  }
+  if (datasize < 64)
+  {
+    std::fill(buffer + datasize, buffer + 64, 0);
+    datasize = 64;
+  }
+  m_eth_ref->mRecvBufferLength = static_cast<u32>(datasize);
+  m_eth_ref->RecvHandlePacket();
+  return true;
 }
 
 void CEXIETHERNET::BuiltInBBAInterface::HandleARP(const Common::ARPPacket& packet)
@@ -222,8 +279,8 @@ StackRef* CEXIETHERNET::BuiltInBBAInterface::GetTCPSlot(u16 src_port, u16 dst_po
   return nullptr;
 }
 
-std::optional<std::vector<u8>>
-CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref)
+bool CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref,
+                                                             std::vector<u8>* frame)
 {
   size_t datasize = 0;  // Set by socket.receive using a non-const reference
   unsigned short remote_port;
@@ -232,17 +289,23 @@ CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref)
   {
   case IPPROTO_UDP:
   {
-    std::array<u8, MAX_UDP_LENGTH> buffer;
-    ref->udp_socket.receive(buffer.data(), MAX_UDP_LENGTH, datasize, ref->target, remote_port);
+    m_recv_payload.resize(MAX_UDP_LENGTH);
+    ref->udp_socket.receive(m_recv_payload.data(), MAX_UDP_LENGTH, datasize, ref->target,
+                            remote_port);
     if (datasize > 0)
     {
       ref->from.sin_port = htons(remote_port);
       const u32 remote_ip = htonl(ref->target.toInteger());
       ref->from.sin_addr.s_addr = remote_ip;
       ref->my_mac = ResolveAddress(remote_ip);
-      const std::vector<u8> udp_data(buffer.begin(), buffer.begin() + datasize);
-      const Common::UDPPacket packet(ref->bba_mac, ref->my_mac, ref->from, ref->to, udp_data);
-      return packet.Build();
+
+      // Lend the payload buffer to the packet instead of copying the data into it
+      Common::UDPPacket packet(ref->bba_mac, ref->my_mac, ref->from, ref->to, {});
+      m_recv_payload.resize(datasize);
+      packet.data.swap(m_recv_payload);
+      packet.Build(frame);
+      packet.data.swap(m_recv_payload);
+      return true;
     }
     break;
   }
@@ -261,25 +324,28 @@ CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref)
     // set default size to 0 to avoid issue
     datasize = 0;
     const bool can_go = (GetTickCountStd() - ref->poke_time > 100 || ref->window_size > 2000);
-    std::array<u8, MAX_TCP_LENGTH> buffer;
+    m_recv_payload.resize(MAX_TCP_LENGTH);
     if (tcp_buffer != nullptr && ref->ready && can_go)
-      st = ref->tcp_socket.receive(buffer.data(), MAX_TCP_LENGTH, datasize);
+      st = ref->tcp_socket.receive(m_recv_payload.data(), MAX_TCP_LENGTH, datasize);
 
     if (datasize > 0)
     {
       Common::TCPPacket packet(ref->bba_mac, ref->my_mac, ref->from, ref->to, ref->seq_num,
                                ref->ack_num, TCP_FLAG_ACK);
-      packet.data = std::vector<u8>(buffer.begin(), buffer.begin() + datasize);
+      m_recv_payload.resize(datasize);
+      packet.data.swap(m_recv_payload);
 
       // build buffer
       tcp_buffer->seq_id = ref->seq_num;
       tcp_buffer->tick = GetTickCountStd();
-      tcp_buffer->data = packet.Build();
+      packet.Build(&tcp_buffer->data);
       tcp_buffer->seq_id = ref->seq_num;
       tcp_buffer->used = true;
+      packet.data.swap(m_recv_payload);
       ref->seq_num += static_cast<u32>(datasize);
       ref->poke_time = GetTickCountStd();
-      return tcp_buffer->data;
+      *frame = tcp_buffer->data;
+      return true;
     }
     if (GetTickCountStd() - ref->delay > 3000)
     {
@@ -287,13 +353,14 @@ CEXIETHERNET::BuiltInBBAInterface::TryGetDataFromSocket(StackRef* ref)
       {
         ref->ip = 0;
         ref->tcp_socket.disconnect();
-        return BuildFINFrame(ref);
+        BuildFINFrame(ref, frame);
+        return true;
       }
     }
     break;
   }
 
-  return std::nullopt;
+  return false;
 }
 
 void CEXIETHERNET::BuiltInBBAInterface::HandleTCPFrame(const Common::TCPPacket& packet)
@@ -309,7 +376,8 @@ void CEXIETHERNET::BuiltInBBAInterface::HandleTCPFrame(const Common::TCPPacket&
       return;  // not found
 
     ref->ack_num += 1 + static_cast<u32>(data.size());
-    WriteToQueue(BuildFINFrame(ref));
+    BuildFINFrame(ref, GetQueueWriteSlot());
+    CommitQueueWriteSlot();
     ref->ip = 0;
     if (!data.empty())
       ref->tcp_socket.send(data.data(), data.size());
@@ -323,7 +391,8 @@ void CEXIETHERNET::BuiltInBBAInterface::HandleTCPFrame(const Common::TCPPacket&
     ref->seq_num++;
     ref->ack_num = ntohl(tcp_header.sequence_number) + 1;
     ref->ready = true;
-    WriteToQueue(BuildAckFrame(ref));
+    BuildAckFrame(ref, GetQueueWriteSlot());
+    CommitQueueWriteSlot();
   }
   else if (flags & TCP_FLAG_SIN)
   {
@@ -391,7 +460,8 @@ void CEXIETHERNET::BuiltInBBAInterface::HandleTCPFrame(const Common::TCPPacket&
       }
 
       // send ack
-      WriteToQueue(BuildAckFrame(ref));
+      BuildAckFrame(ref, GetQueueWriteSlot());
+      CommitQueueWriteSlot();
     }
     // update windows size
     ref->window_size = ntohs(tcp_header.window_size);
@@ -424,7 +494,7 @@ void CEXIETHERNET::BuiltInBBAInterface::HandleTCPFrame(const Common::TCPPacket&
 
         tcp_buf.seq_id += ack_size;
         tcp_packet->tcp_header.sequence_number = htonl(tcp_buf.seq_id);
-        tcp_buf.data = tcp_packet->Build();
+        tcp_packet->Build(&tcp_buf.data);
       }
     }
   }
@@ -668,52 +738,34 @@ bool CEXIETHERNET::BuiltInBBAInterface::SendFrame(const u8* frame, u32 size)
 
 void CEXIETHERNET::BuiltInBBAInterface::ReadThreadHandler(CEXIETHERNET::BuiltInBBAInterface* self)
 {
+  bool delivered = false;
   while (!self->m_read_thread_shutdown.IsSet())
   {
-    // make thread less cpu hungry
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // make thread less cpu hungry, but only when idle so that bursts of packets don't get
+    // delivered one frame per sleep
+    if (!delivered)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    delivered = false;
 
     if (!self->m_read_enabled.IsSet())
       continue;
-    size_t datasize = 0;
-
-    u8 wp = self->m_eth_ref->page_ptr(BBA_RWP);
-    const u8 rp = self->m_eth_ref->page_ptr(BBA_RRP);
-    if (rp > wp)
-      wp += 16;
-
-    if ((wp - rp) >= 8)
-      continue;
 
     std::lock_guard<std::mutex> lock(self->m_mtx);
-    // process queue file first
-    if (self->m_queue_read != self->m_queue_write)
-    {
-      datasize = self->m_queue_data[self->m_queue_read].size();
-      if (datasize > BBA_RECV_SIZE)
-      {
-        ERROR_LOG_FMT(SP1, "Frame size is exceiding BBA capacity, frame stack might be corrupted"
-                           "Killing Dolphin...");
-        std::exit(0);
-      }
-      std::memcpy(self->m_eth_ref->mRecvBuffer.get(), self->m_queue_data[self->m_queue_read].data(),
-                  datasize);
-      self->m_queue_read++;
-      self->m_queue_read &= 15;
-    }
-    else
+
+    // Queue everything the connections have ready, taking one packet from each in turn so that a
+    // busy connection can't starve the others
+    bool received = true;
+    while (received && !self->IsQueueFull())
     {
-      // test connections data
+      received = false;
       for (auto& net_ref : self->network_ref)
       {
-        if (net_ref.ip == 0)
+        if (net_ref.ip == 0 || self->IsQueueFull())
           continue;
-        const auto socket_data = self->TryGetDataFromSocket(&net_ref);
-        if (socket_data.has_value())
+        if (self->TryGetDataFromSocket(&net_ref, self->GetQueueWriteSlot()))
         {
-          datasize = socket_data->size();
-          std::memcpy(self->m_eth_ref->mRecvBuffer.get(), socket_data->data(), datasize);
-          break;
+          self->CommitQueueWriteSlot();
+          received = true;
         }
       }
     }
@@ -730,7 +782,7 @@ void CEXIETHERNET::BuiltInBBAInterface::ReadThreadHandler(CEXIETHERNET::BuiltInB
 
         tcp_buf.tick = GetTickCountStd();
         // timmed out packet, resend
-        if (((self->m_queue_write + 1) & 15) != self->m_queue_read)
+        if (!self->IsQueueFull())
         {
           self->WriteToQueue(tcp_buf.data);
         }
@@ -740,23 +792,9 @@ void CEXIETHERNET::BuiltInBBAInterface::ReadThreadHandler(CEXIETHERNET::BuiltInB
     // Check for new UPnP client
     self->HandleUPnPClient();
 
-    if (datasize > 0)
-    {
-      u8* buffer = reinterpret_cast<u8*>(self->m_eth_ref->mRecvBuffer.get());
-      Common::PacketView packet(buffer, datasize);
-      const auto packet_type = packet.GetEtherType();
-      if (packet_type.has_value() && packet_type == IP_PROTOCOL)
-      {
-        SetIPIdentification(buffer, datasize, ++self->m_ip_frame_id);
-      }
-      if (datasize < 64)
-      {
-        std::fill(buffer + datasize, buffer + 64, 0);
-        datasize = 64;
-      }
-      self->m_eth_ref->mRecvBufferLength = static_cast<u32>(datasize);
-      self->m_eth_ref->RecvHandlePacket();
-    }
+    // Give the BBA as many frames as it has room for
+    while (self->DeliverQueuedFrame())
+      delivered = true;
   }
 }
 
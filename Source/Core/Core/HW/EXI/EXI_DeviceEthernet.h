@@ -439,9 +439,14 @@ private:
     std::string m_dns_ip;
     bool m_active = false;
     u16 m_ip_frame_id = 0;
+    // Frames waiting to be delivered to the BBA. The slots keep their capacity, so frames can be
+    // built directly into them without allocating.
+    static constexpr u8 QUEUE_SIZE = 32;
     u8 m_queue_read = 0;
     u8 m_queue_write = 0;
-    std::array<std::vector<u8>, 16> m_queue_data;
+    std::array<std::vector<u8>, QUEUE_SIZE> m_queue_data;
+    // Payload of the packet currently being received from a host socket.
+    std::vector<u8> m_recv_payload;
     std::mutex m_mtx;
     std::string m_local_ip;
     u32 m_current_ip = 0;
@@ -460,9 +465,13 @@ private:
     static void ReadThreadHandler(BuiltInBBAInterface* self);
 #endif
     void WriteToQueue(const std::vector<u8>& data);
+    bool IsQueueFull() const;
+    std::vector<u8>* GetQueueWriteSlot();
+    void CommitQueueWriteSlot();
+    bool DeliverQueuedFrame();
     StackRef* GetAvailableSlot(u16 port);
     StackRef* GetTCPSlot(u16 src_port, u16 dst_port, u32 ip);
-    std::optional<std::vector<u8>> TryGetDataFromSocket(StackRef* ref);
+    bool TryGetDataFromSocket(StackRef* ref, std::vector<u8>* frame);
 
     void HandleARP(const Common::ARPPacket& packet);
     void HandleDHCP(const Common::UDPPacket& packet);
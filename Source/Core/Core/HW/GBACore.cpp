@@ -243,7 +243,7 @@ bool Core::Start(u64 gc_ticks)
 
   if (Config::Get(Config::MAIN_GBA_THREADS))
   {
-    m_idle = true;
+    m_pending_commands = 0;
     m_exit_loop = false;
     m_thread = std::make_unique<std::thread>([this] { ThreadLoop(); });
   }
@@ -257,10 +257,7 @@ void Core::Stop()
   {
     Flush();
     m_exit_loop = true;
-    {
-      std::lock_guard<std::mutex> lock(m_queue_mutex);
-      m_command_cv.notify_one();
-    }
+    m_command_event.Set();
     m_thread->join();
     m_thread.reset();
   }
@@ -435,9 +432,10 @@ void Core::SetAVStream()
     auto core = static_cast<AVStream*>(stream)->core;
     core->SetVideoBuffer();
   };
+  m_audio_buffer.resize(SAMPLES * 2);
   m_stream.postAudioBuffer = [](mAVStream* stream, blip_t* left, blip_t* right) {
     auto core = static_cast<AVStream*>(stream)->core;
-    std::vector<s16> buffer(SAMPLES * 2);
+    std::vector<s16>& buffer = core->m_audio_buffer;
     blip_read_samples(left, &buffer[0], SAMPLES, 1);
     blip_read_samples(right, &buffer[1], SAMPLES, 1);
 
@@ -478,10 +476,9 @@ void Core::SendJoybusCommand(u64 gc_ticks, int transfer_time, u8* buffer, u16 ke
 
   if (m_thread)
   {
-    std::lock_guard<std::mutex> lock(m_queue_mutex);
-    m_command_queue.push(command);
-    m_idle = false;
-    m_command_cv.notify_one();
+    m_pending_commands.fetch_add(1, std::memory_order_relaxed);
+    m_command_queue.Push(command);
+    m_command_event.Set();
   }
   else
   {
@@ -496,10 +493,10 @@ std::vector<u8> Core::GetJoybusResponse()
 
   if (m_thread)
   {
-    std::unique_lock<std::mutex> lock(m_response_mutex);
-    m_response_cv.wait(lock, [&] { return m_response_ready; });
+    while (!m_response_ready.load(std::memory_order_acquire))
+      m_response_event.Wait();
   }
-  m_response_ready = false;
+  m_response_ready.store(false, std::memory_order_relaxed);
   return m_response;
 }
 
@@ -507,29 +504,26 @@ void Core::Flush()
 {
   if (!IsStarted() || !m_thread)
     return;
-  std::unique_lock<std::mutex> lock(m_queue_mutex);
-  m_response_cv.wait(lock, [&] { return m_idle; });
+  while (m_pending_commands.load(std::memory_order_acquire) != 0)
+    m_idle_event.Wait();
 }
 
 void Core::ThreadLoop()
 {
   Common::SetCurrentThreadName(fmt::format("GBA{}", m_device_number + 1).c_str());
-  std::unique_lock<std::mutex> queue_lock(m_queue_mutex);
   while (true)
   {
-    m_command_cv.wait(queue_lock, [&] { return !m_command_queue.empty() || m_exit_loop; });
+    m_command_event.Wait();
     if (m_exit_loop)
       break;
-    Command command{m_command_queue.front()};
-    m_command_queue.pop();
-    queue_lock.unlock();
 
-    RunCommand(command);
-
-    queue_lock.lock();
-    if (m_command_queue.empty())
-      m_idle = true;
-    m_response_cv.notify_one();
+    Command command;
+    while (m_command_queue.Pop(command))
+    {
+      RunCommand(command);
+      if (m_pending_commands.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        m_idle_event.Set();
+    }
   }
 }
 
@@ -548,16 +542,9 @@ void Core::RunCommand(Command& command)
                 std::back_inserter(m_response));
     }
 
-    if (m_thread && !m_response_ready)
-    {
-      std::lock_guard<std::mutex> response_lock(m_response_mutex);
-      m_response_ready = true;
-      m_response_cv.notify_one();
-    }
-    else
-    {
-      m_response_ready = true;
-    }
+    m_response_ready.store(true, std::memory_order_release);
+    if (m_thread)
+      m_response_event.Set();
   }
   if (command.transfer_time)
     RunFor(command.transfer_time);
@@ -4,10 +4,8 @@
 #pragma once
 
 #include <array>
-#include <condition_variable>
+#include <atomic>
 #include <memory>
-#include <mutex>
-#include <queue>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -20,6 +18,8 @@
 #include <mgba/gba/interface.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/PooledSPSCQueue.h"
 
 class GBAHostInterface;
 class PointerWrap;
@@ -115,6 +115,7 @@ private:
   SIODriver m_sio_driver{};
   AVStream m_stream{};
   std::vector<u32> m_video_buffer;
+  std::vector<s16> m_audio_buffer;
 
   u64 m_last_gc_ticks = 0;
   u64 m_gc_ticks_remainder = 0;
@@ -124,16 +125,17 @@ private:
 
   std::weak_ptr<GBAHostInterface> m_host;
 
+  // Commands are handed to the core thread without locking, so that the emulated SI never waits on
+  // a core that is busy running ahead to its next sync point.
   std::unique_ptr<std::thread> m_thread;
-  bool m_exit_loop = false;
-  bool m_idle = false;
-  std::mutex m_queue_mutex;
-  std::condition_variable m_command_cv;
-  std::queue<Command> m_command_queue;
-
-  std::mutex m_response_mutex;
-  std::condition_variable m_response_cv;
-  bool m_response_ready = false;
+  std::atomic<bool> m_exit_loop = false;
+  Common::PooledSPSCQueue<Command, false> m_command_queue;
+  Common::Event m_command_event;
+  std::atomic<u32> m_pending_commands = 0;
+  Common::Event m_idle_event;
+
+  std::atomic<bool> m_response_ready = false;
+  Common::Event m_response_event;
   std::vector<u8> m_response;
 };
 }  // namespace HW::GBA
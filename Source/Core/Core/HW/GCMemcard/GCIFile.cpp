@@ -62,6 +62,7 @@ bool GCIFile::LoadSaveBlocks()
       m_save_data.clear();
       return false;
     }
+    m_dirty_blocks.assign(num_blocks, false);
   }
   return true;
 }
@@ -85,6 +86,13 @@ int GCIFile::UsesBlock(u16 block_num)
   return -1;
 }
 
+void GCIFile::MarkBlockDirty(u16 index)
+{
+  m_dirty = true;
+  if (index < m_dirty_blocks.size())
+    m_dirty_blocks[index] = true;
+}
+
 void GCIFile::DoState(PointerWrap& p)
 {
   p.Do(m_gci_header);
@@ -92,5 +100,9 @@ void GCIFile::DoState(PointerWrap& p)
   p.Do(m_filename);
   p.Do(m_save_data);
   p.Do(m_used_blocks);
+
+  // The loaded blocks may all differ from the file.
+  if (p.IsReadMode())
+    m_dirty_blocks.assign(m_save_data.size(), true);
 }
 }  // namespace Memcard
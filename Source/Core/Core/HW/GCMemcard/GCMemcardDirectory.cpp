@@ -112,6 +112,9 @@ bool GCMemcardDirectory::LoadGCI(Memcard::GCIFile gci)
   {
     Memcard::GCMemcard::PSO_MakeSaveGameValid(m_hdr, gci.m_gci_header, gci.m_save_data);
     Memcard::GCMemcard::FZEROGX_MakeSaveGameValid(m_hdr, gci.m_gci_header, gci.m_save_data);
+
+    // Keep the fixed up blocks if the save is ever flushed.
+    gci.m_dirty_blocks.assign(gci.m_save_data.size(), true);
   }
 
   // actually load save file into memory card
@@ -267,6 +270,7 @@ void GCMemcardDirectory::FlushThread()
   }
 
   Common::SetCurrentThreadName(fmt::format("Memcard {} flushing thread", m_card_slot).c_str());
+  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
 
   constexpr std::chrono::seconds flush_interval{1};
   while (true)
@@ -413,6 +417,10 @@ s32 GCMemcardDirectory::Write(u32 dest_address, s32 length, const u8* src_addres
 
   memcpy(m_last_block_address + offset, src_address, length);
 
+  // The block may have been looked up by a read, or flushed since it was looked up.
+  if (m_last_block >= static_cast<s32>(Memcard::MC_FST_BLOCKS))
+    m_saves[m_last_save_index].MarkBlockDirty(m_last_save_block_index);
+
   l.unlock();
   if (extra)
     extra = Write(dest_address + length, extra, src_address + length);
@@ -547,13 +555,16 @@ inline s32 GCMemcardDirectory::SaveAreaRW(u32 block, bool writing)
             m_saves[i].m_save_data.emplace_back();
             num_blocks--;
           }
+          m_saves[i].m_dirty_blocks.clear();
         }
 
         if (writing)
         {
-          m_saves[i].m_dirty = true;
+          m_saves[i].MarkBlockDirty(static_cast<u16>(idx));
         }
 
+        m_last_save_index = i;
+        m_last_save_block_index = static_cast<u16>(idx);
         m_last_block = block;
         m_last_block_address = m_saves[i].m_save_data[idx].m_block.data();
         return m_last_block;
@@ -638,7 +649,8 @@ void GCMemcardDirectory::FlushToFile()
                         "GCI header modified without corresponding save data changes");
           continue;
         }
-        if (save.m_filename.empty())
+        const bool new_file = save.m_filename.empty();
+        if (new_file)
         {
           std::string default_save_name =
               m_save_directory + GenerateDefaultGCIFilename(save.m_gci_header, m_hdr.IsShiftJIS());
@@ -657,12 +669,30 @@ void GCMemcardDirectory::FlushToFile()
           }
           save.m_filename = default_save_name;
         }
-        File::IOFile gci(save.m_filename, "wb");
+
+        // If the file already holds this save, only the header and the blocks which were
+        // written to need to be updated.
+        const u64 file_size =
+            Memcard::DENTRY_SIZE + u64(save.m_save_data.size()) * Memcard::BLOCK_SIZE;
+        const bool in_place = !new_file &&
+                              save.m_dirty_blocks.size() == save.m_save_data.size() &&
+                              File::GetSize(save.m_filename) == file_size;
+
+        File::IOFile gci(save.m_filename, in_place ? "r+b" : "wb");
         if (gci)
         {
           gci.WriteBytes(&save.m_gci_header, Memcard::DENTRY_SIZE);
-          for (const Memcard::GCMBlock& block : save.m_save_data)
-            gci.WriteBytes(block.m_block.data(), Memcard::BLOCK_SIZE);
+          for (size_t i = 0; i < save.m_save_data.size(); ++i)
+          {
+            if (in_place)
+            {
+              if (!save.m_dirty_blocks[i])
+                continue;
+              gci.Seek(Memcard::DENTRY_SIZE + i * Memcard::BLOCK_SIZE, File::SeekOrigin::Begin);
+            }
+            gci.WriteBytes(save.m_save_data[i].m_block.data(), Memcard::BLOCK_SIZE);
+          }
+          save.m_dirty_blocks.assign(save.m_save_data.size(), false);
 
           if (gci.IsGood())
           {
@@ -709,6 +739,9 @@ void GCMemcardDirectory::FlushToFile()
       save.m_save_data.clear();
     }
   }
+
+  // Writes after this have to mark their block as dirty again.
+  m_last_block = -1;
 #if _WRITE_MC_HEADER
   u8 mc[BLOCK_SIZE * MC_FST_BLOCKS];
   Read(0, BLOCK_SIZE * MC_FST_BLOCKS, mc);
@@ -52,6 +52,9 @@ private:
   u32 m_game_id;
   s32 m_last_block;
   u8* m_last_block_address;
+  // The save and index within it of m_last_block, if that is a save block.
+  u16 m_last_save_index = 0;
+  u16 m_last_save_block_index = 0;
 
   Memcard::Header m_hdr;
   Memcard::Directory m_dir1;
@@ -3,12 +3,15 @@
 
 #include "Core/HW/GCMemcard/GCMemcardRaw.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -79,6 +82,8 @@ MemoryCard::MemoryCard(const std::string& filename, ExpansionInterface::Slot car
   // Class members (including inherited ones) have now been initialized, so
   // it's safe to startup the flush thread (which reads them).
   m_flush_buffer = std::make_unique<u8[]>(m_memory_card_size);
+  m_dirty_blocks.assign((m_memory_card_size + Memcard::BLOCK_SIZE - 1) / Memcard::BLOCK_SIZE,
+                        false);
   m_flush_thread = std::thread(&MemoryCard::FlushThread, this);
 }
 
@@ -100,6 +105,7 @@ void MemoryCard::FlushThread()
   }
 
   Common::SetCurrentThreadName(fmt::format("Memcard {} flushing thread", m_card_slot).c_str());
+  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
 
   const auto flush_interval = std::chrono::seconds(15);
 
@@ -147,11 +153,34 @@ void MemoryCard::FlushThread()
       return;
     }
 
+    // Only the blocks which have changed are written back, unless the file doesn't hold a full
+    // image of the card yet. Neighbouring dirty blocks are written together.
+    const bool write_all = file.GetSize() != m_memory_card_size;
+    std::vector<std::pair<u32, u32>> runs;
     {
       std::unique_lock l(m_flush_mutex);
-      memcpy(&m_flush_buffer[0], &m_memcard_data[0], m_memory_card_size);
+      const u32 num_blocks = static_cast<u32>(m_dirty_blocks.size());
+      for (u32 block = 0; block < num_blocks; ++block)
+      {
+        if (!write_all && !m_dirty_blocks[block])
+          continue;
+
+        m_dirty_blocks[block] = false;
+        const u32 offset = block * Memcard::BLOCK_SIZE;
+        const u32 size = std::min<u32>(Memcard::BLOCK_SIZE, m_memory_card_size - offset);
+        if (!runs.empty() && runs.back().first + runs.back().second == offset)
+          runs.back().second += size;
+        else
+          runs.emplace_back(offset, size);
+        memcpy(&m_flush_buffer[offset], &m_memcard_data[offset], size);
+      }
+    }
+    for (const auto& [offset, size] : runs)
+    {
+      file.Seek(offset, File::SeekOrigin::Begin);
+      file.WriteBytes(&m_flush_buffer[offset], size);
     }
-    file.WriteBytes(&m_flush_buffer[0], m_memory_card_size);
+    file.Flush();
 
     if (do_exit)
       return;
@@ -191,6 +220,7 @@ s32 MemoryCard::Write(u32 dest_address, s32 length, const u8* src_address)
   {
     std::unique_lock l(m_flush_mutex);
     memcpy(&m_memcard_data[dest_address], src_address, length);
+    MarkBlocksDirty(dest_address, length);
   }
   MakeDirty();
   return length;
@@ -207,6 +237,7 @@ void MemoryCard::ClearBlock(u32 address)
   {
     std::unique_lock l(m_flush_mutex);
     memset(&m_memcard_data[address], 0xFF, Memcard::BLOCK_SIZE);
+    MarkBlocksDirty(address, Memcard::BLOCK_SIZE);
   }
   MakeDirty();
 }
@@ -216,13 +247,33 @@ void MemoryCard::ClearAll()
   {
     std::unique_lock l(m_flush_mutex);
     memset(&m_memcard_data[0], 0xFF, m_memory_card_size);
+    MarkBlocksDirty(0, m_memory_card_size);
   }
   MakeDirty();
 }
 
+void MemoryCard::MarkBlocksDirty(u32 address, u32 length)
+{
+  if (length == 0 || m_dirty_blocks.empty())
+    return;
+
+  const u32 first_block = address / Memcard::BLOCK_SIZE;
+  const u32 last_block = std::min<u32>((address + length - 1) / Memcard::BLOCK_SIZE,
+                                       static_cast<u32>(m_dirty_blocks.size()) - 1);
+  for (u32 block = first_block; block <= last_block; ++block)
+    m_dirty_blocks[block] = true;
+}
+
 void MemoryCard::DoState(PointerWrap& p)
 {
   p.Do(m_card_slot);
   p.Do(m_memory_card_size);
   p.DoArray(&m_memcard_data[0], m_memory_card_size);
+
+  // The whole card may differ from the file now, so the next flush has to write all of it.
+  if (p.IsReadMode())
+  {
+    std::unique_lock l(m_flush_mutex);
+    MarkBlocksDirty(0, m_memory_card_size);
+  }
 }
@@ -7,6 +7,8 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
+
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Core/HW/GCMemcard/GCMemcard.h"
@@ -32,9 +34,14 @@ public:
 private:
   bool IsAddressInBounds(u32 address) const { return address <= (m_memory_card_size - 1); }
 
+  // Must be called with m_flush_mutex held.
+  void MarkBlocksDirty(u32 address, u32 length);
+
   std::string m_filename;
   std::unique_ptr<u8[]> m_memcard_data;
   std::unique_ptr<u8[]> m_flush_buffer;
+  // Blocks which have changed since they were last flushed, guarded by m_flush_mutex.
+  std::vector<bool> m_dirty_blocks;
   std::thread m_flush_thread;
   std::mutex m_flush_mutex;
   Common::Event m_flush_trigger;
@@ -3,6 +3,7 @@
 
 #include "Core/HW/GPFifo.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 
@@ -89,28 +90,43 @@ void GPFifoManager::UpdateGatherPipe()
   auto& processor_interface = system.GetProcessorInterface();
 
   size_t pipe_count = GetGatherPipeCount();
-  size_t processed;
-  u8* cur_mem = memory.GetPointer(processor_interface.m_fifo_cpu_write_pointer);
-  for (processed = 0; pipe_count >= GATHER_PIPE_SIZE; processed += GATHER_PIPE_SIZE)
+  const u32 num_bursts = static_cast<u32>(pipe_count / GATHER_PIPE_SIZE);
+  if (num_bursts == 0)
+    return;
+
+  // Copy the bursts in runs which are contiguous in memory. The write pointer only wraps back to
+  // the base after a burst has been written at the end address.
+  size_t processed = 0;
+  u32 bursts_left = num_bursts;
+  while (bursts_left != 0)
   {
-    // copy the GatherPipe
-    memcpy(cur_mem, m_gather_pipe + processed, GATHER_PIPE_SIZE);
-    pipe_count -= GATHER_PIPE_SIZE;
+    const u32 write_pointer = processor_interface.m_fifo_cpu_write_pointer;
+    const u32 end = processor_interface.m_fifo_cpu_end;
 
-    // increase the CPUWritePointer
-    if (processor_interface.m_fifo_cpu_write_pointer == processor_interface.m_fifo_cpu_end)
+    u32 run = bursts_left;
+    bool wrap = false;
+    if (write_pointer <= end && (end - write_pointer) % GATHER_PIPE_SIZE == 0)
     {
-      processor_interface.m_fifo_cpu_write_pointer = processor_interface.m_fifo_cpu_base;
-      cur_mem = memory.GetPointer(processor_interface.m_fifo_cpu_write_pointer);
-    }
-    else
-    {
-      cur_mem += GATHER_PIPE_SIZE;
-      processor_interface.m_fifo_cpu_write_pointer += GATHER_PIPE_SIZE;
+      const u32 bursts_to_end = (end - write_pointer) / GATHER_PIPE_SIZE + 1;
+      if (bursts_to_end <= run)
+      {
+        run = bursts_to_end;
+        wrap = true;
+      }
     }
 
-    system.GetCommandProcessor().GatherPipeBursted(system);
+    const u32 run_size = run * GATHER_PIPE_SIZE;
+    memcpy(memory.GetPointer(write_pointer), m_gather_pipe + processed, run_size);
+    memory.MarkWritten(write_pointer, run_size);
+    processed += run_size;
+    bursts_left -= run;
+
+    processor_interface.m_fifo_cpu_write_pointer =
+        wrap ? processor_interface.m_fifo_cpu_base : write_pointer + run_size;
   }
+  pipe_count -= processed;
+
+  system.GetCommandProcessor().GatherPipeBursted(system, num_bursts);
 
   // move back the spill bytes
   memmove(m_gather_pipe, m_gather_pipe + processed, pipe_count);
@@ -160,6 +176,21 @@ void GPFifoManager::Write64(const u64 value)
   CheckGatherPipe();
 }
 
+void GPFifoManager::WriteBlock(const u8* data, u32 size)
+{
+  auto& ppc_state = m_system.GetPPCState();
+  while (size != 0)
+  {
+    const u32 chunk =
+        std::min(size, static_cast<u32>(GATHER_PIPE_EXTRA_SIZE - GetGatherPipeCount()));
+    std::memcpy(ppc_state.gather_pipe_ptr, data, chunk);
+    ppc_state.gather_pipe_ptr += chunk;
+    data += chunk;
+    size -= chunk;
+    CheckGatherPipe();
+  }
+}
+
 void GPFifoManager::FastWrite8(const u8 value)
 {
   auto& ppc_state = m_system.GetPPCState();
@@ -21,6 +21,14 @@ constexpr u32 GATHER_PIPE_PHYSICAL_ADDRESS = 0x0C008000;
 constexpr u32 GATHER_PIPE_SIZE = 32;
 constexpr u32 GATHER_PIPE_EXTRA_SIZE = GATHER_PIPE_SIZE * 16;
 
+// The JITs let this many bytes pile up in the gather pipe before flushing it mid-block, so that
+// the bursts are handed to the command processor in batches instead of one at a time.
+constexpr u32 GATHER_PIPE_BATCH_SIZE = GATHER_PIPE_SIZE * 4;
+
+// A partial burst, a full batch and the largest single store must fit in the gather pipe.
+static_assert(GATHER_PIPE_SIZE - 1 + GATHER_PIPE_BATCH_SIZE + sizeof(u64) <=
+              GATHER_PIPE_EXTRA_SIZE);
+
 class GPFifoManager final
 {
 public:
@@ -44,6 +52,9 @@ public:
   void Write32(u32 value);
   void Write64(u64 value);
 
+  // Writes size bytes which are already in big endian order, flushing full bursts as needed.
+  void WriteBlock(const u8* data, u32 size);
+
   // These expect pre-byteswapped values
   // Also there's an upper limit of about 512 per batch
   // Most likely these should be inlined into JIT instead
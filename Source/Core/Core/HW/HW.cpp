@@ -57,7 +57,7 @@ void Init(const Sram* override_sram)
 
   if (SConfig::GetInstance().bWii)
   {
-    IOS::Init();
+    system.GetWiiIPC().Init();
     IOS::HLE::Init();  // Depends on Memory
   }
 }
@@ -68,7 +68,7 @@ void Shutdown()
 
   // IOS should always be shut down regardless of bWii because it can be running in GC mode (MIOS).
   IOS::HLE::Shutdown();  // Depends on Memory
-  IOS::Shutdown();
+  system.GetWiiIPC().Shutdown();
 
   SystemTimers::Shutdown();
   CPU::Shutdown();
@@ -114,7 +114,7 @@ void DoState(PointerWrap& p)
 
   if (SConfig::GetInstance().bWii)
   {
-    IOS::DoState(p);
+    system.GetWiiIPC().DoState(p);
     p.DoMarker("IOS");
     IOS::HLE::GetIOS()->DoState(p);
     p.DoMarker("IOS::HLE");
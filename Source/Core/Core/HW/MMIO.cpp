@@ -167,6 +167,49 @@ WriteHandlingMethod<T>* ComplexWrite(std::function<void(Core::System&, u32, T)>
   return new ComplexHandlingMethod<T>(lambda);
 }
 
+// Function: holds a function pointer and the pointer that is passed to it. Unlike Complex, the
+// JITs can emit a direct call to the function.
+template <typename T>
+class FunctionHandlingMethod : public ReadHandlingMethod<T>, public WriteHandlingMethod<T>
+{
+public:
+  FunctionHandlingMethod(ReadFunction<T> read_function, void* context)
+      : read_function_(read_function), context_(context)
+  {
+  }
+
+  FunctionHandlingMethod(WriteFunction<T> write_function, void* context)
+      : write_function_(write_function), context_(context)
+  {
+  }
+
+  virtual ~FunctionHandlingMethod() = default;
+  void AcceptReadVisitor(ReadHandlingMethodVisitor<T>& v) const override
+  {
+    v.VisitFunction(read_function_, context_);
+  }
+
+  void AcceptWriteVisitor(WriteHandlingMethodVisitor<T>& v) const override
+  {
+    v.VisitFunction(write_function_, context_);
+  }
+
+private:
+  ReadFunction<T> read_function_ = nullptr;
+  WriteFunction<T> write_function_ = nullptr;
+  void* context_;
+};
+template <typename T>
+ReadHandlingMethod<T>* FunctionRead(ReadFunction<T> function, void* context)
+{
+  return new FunctionHandlingMethod<T>(function, context);
+}
+template <typename T>
+WriteHandlingMethod<T>* FunctionWrite(WriteFunction<T> function, void* context)
+{
+  return new FunctionHandlingMethod<T>(function, context);
+}
+
 // Invalid: specialization of the complex handling type with lambdas that
 // display error messages.
 template <typename T>
@@ -328,6 +371,13 @@ void ReadHandler<T>::ResetMethod(ReadHandlingMethod<T>* method)
     {
       ret = *lambda;
     }
+
+    void VisitFunction(ReadFunction<T> function, void* context) override
+    {
+      ret = [function, context](Core::System& system, u32 addr) {
+        return function(system, context, addr);
+      };
+    }
   };
 
   FuncCreatorVisitor v;
@@ -403,6 +453,13 @@ void WriteHandler<T>::ResetMethod(WriteHandlingMethod<T>* method)
     {
       ret = *lambda;
     }
+
+    void VisitFunction(WriteFunction<T> function, void* context) override
+    {
+      ret = [function, context](Core::System& system, u32 addr, T val) {
+        function(system, context, addr, val);
+      };
+    }
   };
 
   FuncCreatorVisitor v;
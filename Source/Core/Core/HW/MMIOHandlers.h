@@ -59,6 +59,19 @@ ReadHandlingMethod<T>* ComplexRead(std::function<T(Core::System&, u32)>);
 template <typename T>
 WriteHandlingMethod<T>* ComplexWrite(std::function<void(Core::System&, u32, T)>);
 
+// Function: like Complex, but takes a plain function and a pointer that is passed to it, which
+// usually points to the state of the hardware module. The JITs can call these directly instead
+// of going through a std::function, which makes them the better choice for registers that games
+// poll in tight loops.
+template <typename T>
+using ReadFunction = T (*)(Core::System& system, void* context, u32 addr);
+template <typename T>
+using WriteFunction = void (*)(Core::System& system, void* context, u32 addr, T val);
+template <typename T>
+ReadHandlingMethod<T>* FunctionRead(ReadFunction<T> function, void* context);
+template <typename T>
+WriteHandlingMethod<T>* FunctionWrite(WriteFunction<T> function, void* context);
+
 // Invalid: log an error and return -1 in case of a read. These are the default
 // handlers set for all MMIO types.
 template <typename T>
@@ -102,6 +115,7 @@ public:
   virtual void VisitConstant(T value) = 0;
   virtual void VisitDirect(const T* addr, u32 mask) = 0;
   virtual void VisitComplex(const std::function<T(Core::System&, u32)>* lambda) = 0;
+  virtual void VisitFunction(ReadFunction<T> function, void* context) = 0;
 };
 template <typename T>
 class WriteHandlingMethodVisitor
@@ -110,6 +124,7 @@ public:
   virtual void VisitNop() = 0;
   virtual void VisitDirect(T* addr, u32 mask) = 0;
   virtual void VisitComplex(const std::function<void(Core::System&, u32, T)>* lambda) = 0;
+  virtual void VisitFunction(WriteFunction<T> function, void* context) = 0;
 };
 
 // These classes are INTERNAL. Do not use outside of the MMIO implementation
@@ -190,6 +205,8 @@ private:
       std::function<T(Core::System&, u32)>);                                                       \
   MaybeExtern template WriteHandlingMethod<T>* ComplexWrite<T>(                                    \
       std::function<void(Core::System&, u32, T)>);                                                 \
+  MaybeExtern template ReadHandlingMethod<T>* FunctionRead<T>(ReadFunction<T>, void*);             \
+  MaybeExtern template WriteHandlingMethod<T>* FunctionWrite<T>(WriteFunction<T>, void*);          \
   MaybeExtern template ReadHandlingMethod<T>* InvalidRead<T>();                                    \
   MaybeExtern template WriteHandlingMethod<T>* InvalidWrite<T>();                                  \
   MaybeExtern template class ReadHandler<T>;                                                       \
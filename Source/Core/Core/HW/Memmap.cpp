@@ -12,14 +12,20 @@
 #include <array>
 #include <cstring>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <tuple>
+#include <utility>
 
+#include "Common/Align.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
+#include "Core/Config/GraphicsSettings.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -61,7 +67,7 @@ void MemoryManager::InitMMIO(bool is_wii)
   AudioInterface::RegisterMMIO(m_mmio_mapping.get(), 0x0C006C00);
   if (is_wii)
   {
-    IOS::RegisterMMIO(m_mmio_mapping.get(), 0x0D000000);
+    system.GetWiiIPC().RegisterMMIO(m_mmio_mapping.get(), 0x0D000000);
     DVDInterface::RegisterMMIO(m_mmio_mapping.get(), 0x0D006000, true);
     SerialInterface::RegisterMMIO(m_mmio_mapping.get(), 0x0D006400);
     ExpansionInterface::RegisterMMIO(m_mmio_mapping.get(), 0x0D006800);
@@ -107,6 +113,11 @@ void MemoryManager::Init()
   // If MMU is turned off in GameCube mode, turn on fake VMEM hack.
   const bool fake_vmem = !wii && !mmu;
 
+  // Huge pages are only used where both the offset in the segment and the address of a view are
+  // aligned, so start every region on a huge page boundary.
+  const bool huge_pages = Config::Get(Config::MAIN_HUGE_PAGES);
+  const u32 region_alignment = huge_pages ? static_cast<u32>(m_arena.GetHugePageSize()) : 0;
+
   u32 mem_size = 0;
   for (PhysicalMemoryRegion& region : m_physical_regions)
   {
@@ -115,11 +126,13 @@ void MemoryManager::Init()
     if (!fake_vmem && (region.flags & PhysicalMemoryRegion::FAKE_VMEM))
       continue;
 
+    if (region_alignment != 0)
+      mem_size = Common::AlignUp(mem_size, region_alignment);
     region.shm_position = mem_size;
     region.active = true;
     mem_size += region.size;
   }
-  m_arena.GrabSHMSegment(mem_size);
+  m_arena.GrabSHMSegment(mem_size, huge_pages);
 
   m_physical_page_mappings.fill(nullptr);
 
@@ -221,12 +234,27 @@ bool MemoryManager::InitFastmemArena()
     }
   }
 
+  InitWriteTracking();
+
+  // Page table mappings are done at the granularity of emulated pages, which the host has to be
+  // able to map individually. They aren't write protected by write tracking, so the two can't be
+  // used together.
+  m_page_table_mappings_supported = Config::Get(Config::MAIN_PAGE_TABLE_FASTMEM) &&
+                                    m_arena.GetMappingGranularity() <= PowerPC::HW_PAGE_SIZE &&
+                                    !m_write_tracking_enabled;
+
   m_is_fastmem_arena_initialized = true;
   return true;
 }
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // The new views aren't write protected, so stop watching everything.
+  std::lock_guard lock(m_write_tracking_mutex);
+  UnwatchAllPages();
+
+  RemovePageTableMappings();
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -271,7 +299,7 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, intersection_start});
           }
 
           m_logical_page_mappings[i] =
@@ -280,6 +308,80 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
       }
     }
   }
+
+  // Pages containing code have to stay write protected in the new views as well.
+  if (m_code_write_protection_enabled)
+  {
+    for (u32 i = 0; i < m_write_tracking_page_count; ++i)
+    {
+      if (m_write_tracking_code[i].load(std::memory_order_relaxed))
+        SetWriteProtection(i, true);
+    }
+  }
+}
+
+bool MemoryManager::AddPageTableMapping(u32 logical_address, u32 translated_address)
+{
+  if (!m_page_table_mappings_supported || !m_is_fastmem_arena_initialized)
+    return false;
+
+  const u32 logical_page = logical_address >> PowerPC::HW_PAGE_INDEX_SHIFT;
+  if (m_page_table_mapped_entries.find(logical_page) != m_page_table_mapped_entries.end())
+    return false;
+
+  translated_address &= ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+  for (const auto& physical_region : m_physical_regions)
+  {
+    if (!physical_region.active)
+      continue;
+
+    const u32 mapping_address = physical_region.physical_address;
+    if (translated_address < mapping_address ||
+        translated_address - mapping_address >= physical_region.size)
+    {
+      continue;
+    }
+
+    // Every mapping is a separate host VMA, so keep their number bounded. Games which touch more
+    // pages than this through the page table just start over from scratch.
+    if (m_page_table_mapped_entries.size() >= MAX_PAGE_TABLE_MAPPINGS)
+      RemovePageTableMappings();
+
+    const u32 position = physical_region.shm_position + translated_address - mapping_address;
+    u8* base = m_logical_base + (logical_page << PowerPC::HW_PAGE_INDEX_SHIFT);
+    void* mapped_pointer = m_arena.MapInMemoryRegion(position, PowerPC::HW_PAGE_SIZE, base);
+    if (mapped_pointer != base)
+    {
+      ERROR_LOG_FMT(MEMMAP, "Failed to map page 0x{:08X} at logical address 0x{:08X}",
+                    translated_address, logical_address);
+      if (mapped_pointer)
+        m_arena.UnmapFromMemoryRegion(mapped_pointer, PowerPC::HW_PAGE_SIZE);
+      return false;
+    }
+
+    m_page_table_mapped_entries.emplace(
+        logical_page, LogicalMemoryView{mapped_pointer, static_cast<u32>(PowerPC::HW_PAGE_SIZE),
+                                        translated_address});
+    return true;
+  }
+
+  return false;
+}
+
+void MemoryManager::RemovePageTableMappings(u32 mask, u32 match)
+{
+  for (auto it = m_page_table_mapped_entries.begin(); it != m_page_table_mapped_entries.end();)
+  {
+    if ((it->first & mask) == match)
+    {
+      m_arena.UnmapFromMemoryRegion(it->second.mapped_pointer, it->second.mapped_size);
+      it = m_page_table_mapped_entries.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
 }
 
 void MemoryManager::DoState(PointerWrap& p)
@@ -329,6 +431,14 @@ void MemoryManager::DoState(PointerWrap& p)
   if (current_have_exram)
     p.DoArray(m_exram, current_exram_size);
   p.DoMarker("Memory EXRAM");
+
+  if (p.IsReadMode())
+  {
+    // The JIT cache gets cleared when loading a state, so no page contains code anymore.
+    std::lock_guard lock(m_write_tracking_mutex);
+    UnwatchAllPages();
+    UnwatchAllCode();
+  }
 }
 
 void MemoryManager::Shutdown()
@@ -363,6 +473,9 @@ void MemoryManager::ShutdownFastmemArena()
     m_arena.UnmapFromMemoryRegion(base, region.size);
   }
 
+  RemovePageTableMappings();
+  m_page_table_mappings_supported = false;
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -374,9 +487,325 @@ void MemoryManager::ShutdownFastmemArena()
   m_physical_base = nullptr;
   m_logical_base = nullptr;
 
+  m_write_tracking_enabled = false;
+  m_write_tracking_stamps.reset();
+  m_code_write_protection_enabled = false;
+  m_write_tracking_code.reset();
+
   m_is_fastmem_arena_initialized = false;
 }
 
+void MemoryManager::InitWriteTracking()
+{
+  m_write_tracking_enabled = false;
+  m_write_tracking_stamps.reset();
+  m_code_write_protection_enabled = false;
+  m_write_tracking_code.reset();
+  m_write_tracking_page_shift = PowerPC::HW_PAGE_INDEX_SHIFT;
+
+  // On this platform WriteProtectMemory() doesn't do anything.
+#if !(defined(_M_ARM_64) && defined(__APPLE__))
+  const bool protect_code = Config::Get(Config::MAIN_CODE_WRITE_PROTECTION);
+  if (!Config::Get(Config::GFX_TRACK_TEXTURE_MEMORY_WRITES) && !protect_code)
+    return;
+
+  // Pages can't be smaller than what the host can protect individually.
+  m_write_tracking_page_shift = std::max<u32>(PowerPC::HW_PAGE_INDEX_SHIFT,
+                                              IntLog2(Common::MemPageSize()));
+  const u32 page_size = 1U << m_write_tracking_page_shift;
+  m_write_tracking_mem1_pages = (GetRamSizeReal() + page_size - 1) >> m_write_tracking_page_shift;
+  m_write_tracking_page_count = m_write_tracking_mem1_pages;
+  if (m_exram)
+  {
+    m_write_tracking_page_count +=
+        (GetExRamSizeReal() + page_size - 1) >> m_write_tracking_page_shift;
+  }
+
+  m_write_tracking_stamps = std::make_unique<std::atomic<u64>[]>(m_write_tracking_page_count);
+  m_write_tracking_last_stamp = 0;
+  m_write_tracking_enabled = true;
+
+  m_write_tracking_code = std::make_unique<std::atomic<bool>[]>(m_write_tracking_page_count);
+  m_code_write_protection_enabled = protect_code;
+#endif
+}
+
+std::optional<u32> MemoryManager::GetWriteTrackingPageIndex(u32 address) const
+{
+  if (address < GetRamSizeReal())
+    return address >> m_write_tracking_page_shift;
+
+  if (m_exram && (address >> 28) == 0x1 && (address & 0x0FFFFFFF) < GetExRamSizeReal())
+    return m_write_tracking_mem1_pages + ((address & 0x0FFFFFFF) >> m_write_tracking_page_shift);
+
+  return std::nullopt;
+}
+
+u32 MemoryManager::GetWriteTrackingPageAddress(u32 index) const
+{
+  if (index < m_write_tracking_mem1_pages)
+    return index << m_write_tracking_page_shift;
+
+  return 0x10000000 | ((index - m_write_tracking_mem1_pages) << m_write_tracking_page_shift);
+}
+
+void MemoryManager::SetWriteProtection(u32 index, bool write_protected)
+{
+  const u32 physical_address = GetWriteTrackingPageAddress(index);
+  const size_t page_size = size_t(1) << m_write_tracking_page_shift;
+
+  const auto set_protection = [&](void* pointer) {
+    if (write_protected)
+      Common::WriteProtectMemory(pointer, page_size);
+    else
+      Common::UnWriteProtectMemory(pointer, page_size);
+  };
+
+  set_protection(m_physical_base + physical_address);
+  for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+  {
+    const u32 offset = physical_address - entry.physical_address;
+    if (offset < entry.mapped_size)
+      set_protection(static_cast<u8*>(entry.mapped_pointer) + offset);
+  }
+}
+
+void MemoryManager::UnwatchPage(u32 index)
+{
+  if (m_write_tracking_stamps[index].load(std::memory_order_relaxed) == 0)
+    return;
+
+  m_write_tracking_stamps[index].store(0, std::memory_order_seq_cst);
+  if (!m_write_tracking_code[index].load(std::memory_order_relaxed))
+    SetWriteProtection(index, false);
+}
+
+void MemoryManager::UnwatchAllPages()
+{
+  if (!m_write_tracking_enabled)
+    return;
+
+  for (u32 i = 0; i < m_write_tracking_page_count; ++i)
+    UnwatchPage(i);
+}
+
+bool MemoryManager::UnwatchCodePage(u32 index)
+{
+  if (!m_write_tracking_code[index].load(std::memory_order_relaxed))
+    return false;
+
+  m_write_tracking_code[index].store(false, std::memory_order_seq_cst);
+  if (m_write_tracking_stamps[index].load(std::memory_order_relaxed) == 0)
+    SetWriteProtection(index, false);
+  return true;
+}
+
+void MemoryManager::UnwatchAllCode()
+{
+  if (!m_write_tracking_enabled)
+    return;
+
+  for (u32 i = 0; i < m_write_tracking_page_count; ++i)
+    UnwatchCodePage(i);
+}
+
+bool MemoryManager::IsPageWatched(u32 index) const
+{
+  return m_write_tracking_stamps[index].load(std::memory_order_relaxed) != 0 ||
+         m_write_tracking_code[index].load(std::memory_order_relaxed);
+}
+
+void MemoryManager::NotifyCodeWritten(u32 index)
+{
+  if (m_code_written_callback)
+    m_code_written_callback(GetWriteTrackingPageAddress(index), 1U << m_write_tracking_page_shift);
+}
+
+u64 MemoryManager::WatchRange(u32 address, u32 size)
+{
+  if (!m_write_tracking_enabled || size == 0)
+    return 0;
+
+  const u32 last_address = address + size - 1;
+  const std::optional<u32> first_page = GetWriteTrackingPageIndex(address);
+  const std::optional<u32> last_page = GetWriteTrackingPageIndex(last_address);
+  if (!first_page || !last_page || last_address < address ||
+      *last_page - *first_page != (last_address >> m_write_tracking_page_shift) -
+                                      (address >> m_write_tracking_page_shift))
+  {
+    return 0;
+  }
+
+  std::lock_guard lock(m_write_tracking_mutex);
+
+  const u64 stamp = ++m_write_tracking_last_stamp;
+  for (u32 i = *first_page; i <= *last_page; ++i)
+  {
+    if (m_write_tracking_stamps[i].load(std::memory_order_relaxed) != 0)
+      continue;
+
+    if (!m_write_tracking_code[i].load(std::memory_order_relaxed))
+      SetWriteProtection(i, true);
+    m_write_tracking_stamps[i].store(stamp, std::memory_order_seq_cst);
+  }
+
+  // The caller's reads of the range must not happen before the stamps are visible, or writes by
+  // MarkWritten() callers in between could go unnoticed.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  return stamp;
+}
+
+void MemoryManager::SetCodeWrittenCallback(
+    std::function<void(u32 physical_address, u32 size)> callback)
+{
+  m_code_written_callback = std::move(callback);
+}
+
+void MemoryManager::WatchCode(u32 physical_address, u32 size)
+{
+  if (!m_code_write_protection_enabled || size == 0)
+    return;
+
+  const u32 page_size = 1U << m_write_tracking_page_shift;
+  const u64 end_address = u64(physical_address) + size;
+  for (u64 page_address = physical_address & ~(page_size - 1); page_address < end_address;
+       page_address += page_size)
+  {
+    const std::optional<u32> index = GetWriteTrackingPageIndex(static_cast<u32>(page_address));
+    if (!index || m_write_tracking_code[*index].load(std::memory_order_relaxed))
+      continue;
+
+    std::lock_guard lock(m_write_tracking_mutex);
+    if (m_write_tracking_stamps[*index].load(std::memory_order_relaxed) == 0)
+      SetWriteProtection(*index, true);
+    m_write_tracking_code[*index].store(true, std::memory_order_seq_cst);
+  }
+}
+
+bool MemoryManager::IsRangeUnchanged(u32 address, u32 size, u64 stamp) const
+{
+  if (!m_write_tracking_enabled || stamp == 0 || size == 0)
+    return false;
+
+  const std::optional<u32> first_page = GetWriteTrackingPageIndex(address);
+  const std::optional<u32> last_page = GetWriteTrackingPageIndex(address + size - 1);
+  if (!first_page || !last_page || *last_page < *first_page)
+    return false;
+
+  for (u32 i = *first_page; i <= *last_page; ++i)
+  {
+    const u64 page_stamp = m_write_tracking_stamps[i].load(std::memory_order_acquire);
+    if (page_stamp == 0 || page_stamp > stamp)
+      return false;
+  }
+
+  return true;
+}
+
+void MemoryManager::GetWrittenPages(u32 address, u32 size, u64 stamp,
+                                    std::vector<u32>* pages) const
+{
+  if (size == 0)
+    return;
+
+  const u32 page_size = GetWriteTrackingPageSize();
+  const u64 end_address = u64(address) + size;
+  for (u64 page_address = address & ~(page_size - 1); page_address < end_address;
+       page_address += page_size)
+  {
+    if (m_write_tracking_enabled && stamp != 0)
+    {
+      const std::optional<u32> index = GetWriteTrackingPageIndex(static_cast<u32>(page_address));
+      if (index)
+      {
+        const u64 page_stamp = m_write_tracking_stamps[*index].load(std::memory_order_acquire);
+        if (page_stamp != 0 && page_stamp <= stamp)
+          continue;
+      }
+    }
+
+    pages->push_back(static_cast<u32>(page_address));
+  }
+}
+
+void MemoryManager::MarkWrittenImpl(u32 address, size_t size)
+{
+  if (size == 0)
+    return;
+
+  // Callers have already written to the range, make sure that a concurrent WatchRange() either
+  // sees the page as unwatched here or its caller sees the written data.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  // Same masking as GetPointer().
+  address &= 0x3FFFFFFF;
+
+  const u32 page_size = 1U << m_write_tracking_page_shift;
+  const u64 end_address = u64(address) + size;
+  for (u64 page_address = address & ~(page_size - 1); page_address < end_address;
+       page_address += page_size)
+  {
+    const std::optional<u32> index = GetWriteTrackingPageIndex(static_cast<u32>(page_address));
+    if (!index || !IsPageWatched(*index))
+      continue;
+
+    bool contained_code;
+    {
+      std::lock_guard lock(m_write_tracking_mutex);
+      UnwatchPage(*index);
+      contained_code = UnwatchCodePage(*index);
+    }
+    if (contained_code)
+      NotifyCodeWritten(*index);
+  }
+}
+
+bool MemoryManager::HandleWriteTrackingFault(uintptr_t fault_address)
+{
+  if (!m_write_tracking_enabled)
+    return false;
+
+  std::optional<u32> physical_address;
+  const uintptr_t physical_offset = fault_address - reinterpret_cast<uintptr_t>(m_physical_base);
+  if (physical_offset < 0x1'0000'0000)
+  {
+    physical_address = static_cast<u32>(physical_offset);
+  }
+  else
+  {
+    for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+    {
+      const uintptr_t offset = fault_address - reinterpret_cast<uintptr_t>(entry.mapped_pointer);
+      if (offset < entry.mapped_size)
+      {
+        physical_address = entry.physical_address + static_cast<u32>(offset);
+        break;
+      }
+    }
+  }
+
+  if (!physical_address)
+    return false;
+
+  // Only RAM pages ever get write protected, and they're always mapped, so any fault in them is
+  // ours. The page may have been unwatched by another thread since, in which case retrying the
+  // access is all there is to do.
+  const std::optional<u32> index = GetWriteTrackingPageIndex(*physical_address);
+  if (!index)
+    return false;
+
+  bool contained_code;
+  {
+    std::lock_guard lock(m_write_tracking_mutex);
+    UnwatchPage(*index);
+    contained_code = UnwatchCodePage(*index);
+  }
+  if (contained_code)
+    NotifyCodeWritten(*index);
+  return true;
+}
+
 void MemoryManager::Clear()
 {
   if (m_ram)
@@ -409,6 +838,22 @@ u8* MemoryManager::GetPointerForRange(u32 address, size_t size) const
   return pointer;
 }
 
+std::span<u8> MemoryManager::GetSpanForAddress(u32 address) const
+{
+  address &= 0x3FFFFFFF;
+  if (address < GetRamSizeReal())
+    return std::span(m_ram + address, GetRamSizeReal() - address);
+
+  if (m_exram)
+  {
+    const u32 exram_offset = address & 0x0fffffff;
+    if ((address >> 28) == 0x1 && exram_offset < GetExRamSizeReal())
+      return std::span(m_exram + exram_offset, GetExRamSizeReal() - exram_offset);
+  }
+
+  return {};
+}
+
 void MemoryManager::CopyFromEmu(void* data, u32 address, size_t size) const
 {
   if (size == 0)
@@ -435,6 +880,7 @@ void MemoryManager::CopyToEmu(u32 address, const void* data, size_t size)
     return;
   }
   memcpy(pointer, data, size);
+  MarkWritten(address, size);
 }
 
 void MemoryManager::Memset(u32 address, u8 value, size_t size)
@@ -449,6 +895,7 @@ void MemoryManager::Memset(u32 address, u8 value, size_t size)
     return;
   }
   memset(pointer, value, size);
+  MarkWritten(address, size);
 }
 
 std::string MemoryManager::GetString(u32 em_address, size_t size)
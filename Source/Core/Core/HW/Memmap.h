@@ -4,8 +4,14 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -49,6 +55,7 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 physical_address;
 };
 
 class MemoryManager
@@ -95,6 +102,55 @@ public:
 
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+  // Page table translations can't be mapped up front like BATs, since the page table lives in
+  // emulated memory and can change at any time. Instead, single 4 KiB pages get mapped into the
+  // logical fastmem region when a fastmem access to them faults, and unmapped again when the
+  // emulated software invalidates the translation.
+  bool ArePageTableMappingsSupported() const { return m_page_table_mappings_supported; }
+  bool AddPageTableMapping(u32 logical_address, u32 translated_address);
+  // Removes the mappings of all logical pages for which (page_index & mask) == match holds.
+  void RemovePageTableMappings(u32 mask = 0, u32 match = 0);
+
+  // Write tracking of MEM1 and MEM2, which lets code outside the CPU find out whether a range of
+  // memory has been written to since it last looked at it without having to hash it. Watched pages
+  // are write protected in the fastmem views, so the first write to them from JIT code faults into
+  // HandleWriteTrackingFault(). Everything else which writes to RAM directly instead of going
+  // through the functions below has to call MarkWritten() after doing so.
+  //
+  // Only available when the fastmem arena is in use, since otherwise the JITs may access RAM
+  // through pointers we can't protect.
+  bool IsWriteTrackingEnabled() const { return m_write_tracking_enabled; }
+  // Starts watching the range if it isn't watched already, and returns a stamp for
+  // IsRangeUnchanged(). Has to be called before reading the range. Returns 0 if the range can't be
+  // watched.
+  u64 WatchRange(u32 address, u32 size);
+  // Whether the range hasn't been written to since the WatchRange() call which returned the stamp.
+  bool IsRangeUnchanged(u32 address, u32 size, u64 stamp) const;
+  // Appends the address of each page overlapping the range which may have been written to since
+  // the WatchRange() call which returned the stamp. This lets consumers watching large ranges
+  // only revisit what changed: each one keeps its own stamp as a generation counter, and calls
+  // WatchRange() again before looking at the written pages to start the next generation. Every
+  // page is reported if write tracking is disabled or the stamp is 0.
+  void GetWrittenPages(u32 address, u32 size, u64 stamp, std::vector<u32>* pages) const;
+  u32 GetWriteTrackingPageSize() const { return 1U << m_write_tracking_page_shift; }
+  void MarkWritten(u32 address, size_t size)
+  {
+    if (m_write_tracking_enabled)
+      MarkWrittenImpl(address, size);
+  }
+  // Returns true if the fault was a write to a watched page, in which case the page is no longer
+  // write protected and the access can be retried.
+  bool HandleWriteTrackingFault(uintptr_t fault_address);
+
+  // Code write protection, built on top of write tracking. Pages containing code compiled by the
+  // JIT stay write protected, and the first write to one of them calls the code written callback
+  // with the physical range of the page, from whichever thread did the write. Unlike icbi, this
+  // also catches software which modifies code without invalidating the instruction cache.
+  bool IsCodeWriteProtectionEnabled() const { return m_code_write_protection_enabled; }
+  void SetCodeWrittenCallback(std::function<void(u32 physical_address, u32 size)> callback);
+  // Protects the pages overlapping the physical range until they're written to.
+  void WatchCode(u32 physical_address, u32 size);
+
   void Clear();
 
   // Routines to access physically addressed memory, designed for use by
@@ -102,6 +158,9 @@ public:
   std::string GetString(u32 em_address, size_t size = 0);
   u8* GetPointer(u32 address) const;
   u8* GetPointerForRange(u32 address, size_t size) const;
+  // Returns the memory from address to the end of the RAM bank it is in, or an empty span if the
+  // address isn't in RAM. Unlike GetPointer, this doesn't raise a panic alert.
+  std::span<u8> GetSpanForAddress(u32 address) const;
   void CopyFromEmu(void* data, u32 address, size_t size) const;
   void CopyToEmu(u32 address, const void* data, size_t size);
   void Memset(u32 address, u8 value, size_t size);
@@ -139,6 +198,8 @@ public:
 
     for (size_t i = 0; i < size / sizeof(T); i++)
       dest[i] = Common::FromBigEndian(data[i]);
+
+    MarkWritten(address, size);
   }
 
 private:
@@ -233,9 +294,43 @@ private:
 
   std::vector<LogicalMemoryView> m_logical_mapped_entries;
 
+  // Mappings made by AddPageTableMapping(), indexed by logical page index.
+  static constexpr size_t MAX_PAGE_TABLE_MAPPINGS = 8192;
+  std::unordered_map<u32, LogicalMemoryView> m_page_table_mapped_entries;
+  bool m_page_table_mappings_supported = false;
+
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
+  // Write tracking state. A page is watched if its stamp is non-zero, in which case the stamp is
+  // the one returned by the WatchRange() call which started watching it. The stamps are only
+  // changed with m_write_tracking_mutex held, but can be read at any time.
+  bool m_write_tracking_enabled = false;
+  u32 m_write_tracking_page_shift = PowerPC::HW_PAGE_INDEX_SHIFT;
+  u32 m_write_tracking_mem1_pages = 0;
+  u32 m_write_tracking_page_count = 0;
+  std::unique_ptr<std::atomic<u64>[]> m_write_tracking_stamps;
+  u64 m_write_tracking_last_stamp = 0;
+  std::mutex m_write_tracking_mutex;
+
+  // Whether each page contains compiled code. A page is write protected while it's either watched
+  // or contains code. Changed with m_write_tracking_mutex held, like the stamps.
+  bool m_code_write_protection_enabled = false;
+  std::unique_ptr<std::atomic<bool>[]> m_write_tracking_code;
+  std::function<void(u32 physical_address, u32 size)> m_code_written_callback;
+
   void InitMMIO(bool is_wii);
+
+  void InitWriteTracking();
+  std::optional<u32> GetWriteTrackingPageIndex(u32 address) const;
+  u32 GetWriteTrackingPageAddress(u32 index) const;
+  void SetWriteProtection(u32 index, bool write_protected);
+  void UnwatchPage(u32 index);
+  void UnwatchAllPages();
+  bool UnwatchCodePage(u32 index);
+  void UnwatchAllCode();
+  bool IsPageWatched(u32 index) const;
+  void NotifyCodeWritten(u32 index);
+  void MarkWrittenImpl(u32 address, size_t size);
 };
 }  // namespace Memory
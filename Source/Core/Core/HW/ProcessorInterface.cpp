@@ -61,19 +61,26 @@ void ProcessorInterfaceManager::Init()
 
 void ProcessorInterfaceManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 {
+  // Interrupt handlers acknowledge interrupts here, so these are Function handlers.
   mmio->Register(base | PI_INTERRUPT_CAUSE, MMIO::DirectRead<u32>(&m_interrupt_cause),
-                 MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
-                   auto& processor_interface = system.GetProcessorInterface();
-                   processor_interface.m_interrupt_cause &= ~val;
-                   processor_interface.UpdateException(system);
-                 }));
+                 MMIO::FunctionWrite<u32>(
+                     [](Core::System& system, void* context, u32, u32 val) {
+                       auto& processor_interface =
+                           *static_cast<ProcessorInterfaceManager*>(context);
+                       processor_interface.m_interrupt_cause &= ~val;
+                       processor_interface.UpdateException(system);
+                     },
+                     this));
 
   mmio->Register(base | PI_INTERRUPT_MASK, MMIO::DirectRead<u32>(&m_interrupt_mask),
-                 MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
-                   auto& processor_interface = system.GetProcessorInterface();
-                   processor_interface.m_interrupt_mask = val;
-                   processor_interface.UpdateException(system);
-                 }));
+                 MMIO::FunctionWrite<u32>(
+                     [](Core::System& system, void* context, u32, u32 val) {
+                       auto& processor_interface =
+                           *static_cast<ProcessorInterfaceManager*>(context);
+                       processor_interface.m_interrupt_mask = val;
+                       processor_interface.UpdateException(system);
+                     },
+                     this));
 
   mmio->Register(base | PI_FIFO_BASE, MMIO::DirectRead<u32>(&m_fifo_cpu_base),
                  MMIO::DirectWrite<u32>(&m_fifo_cpu_base, 0xFFFFFFE0));
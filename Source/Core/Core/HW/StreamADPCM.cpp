@@ -6,41 +6,42 @@
 #include "Core/HW/StreamADPCM.h"
 
 #include <algorithm>
+#include <array>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 
 namespace StreamADPCM
 {
-static s16 ADPDecodeSample(s32 bits, s32 q, s32& hist1, s32& hist2)
-{
-  s32 hist = 0;
-  switch (q >> 4)
-  {
-  case 0:
-    hist = 0;
-    break;
-  case 1:
-    hist = (hist1 * 0x3c);
-    break;
-  case 2:
-    hist = (hist1 * 0x73) - (hist2 * 0x34);
-    break;
-  case 3:
-    hist = (hist1 * 0x62) - (hist2 * 0x37);
-    break;
-  }
-  hist = std::clamp((hist + 0x20) >> 6, -0x200000, 0x1fffff);
+// Prediction filters selected by the high nibble of a channel's header byte. Filters 4-15
+// predict silence.
+static constexpr std::array<std::array<s32, 2>, 16> FILTER_COEFS = {{
+    {0, 0},
+    {0x3c, 0},
+    {0x73, -0x34},
+    {0x62, -0x37},
+}};
 
-  s32 cur = (((s16)(bits << 12) >> (q & 0xf)) << 6) + hist;
+// Decodes the 28 samples of one channel of a block. shift selects the low or high nibbles and
+// header is the channel's header byte, which applies to the whole block.
+static void DecodeChannel(s16* pcm, const u8* adpcm, int shift, u8 header, s32& hist1,
+                          s32& hist2)
+{
+  const s32 coef1 = FILTER_COEFS[header >> 4][0];
+  const s32 coef2 = FILTER_COEFS[header >> 4][1];
+  const int scale = header & 0xf;
 
-  hist2 = hist1;
-  hist1 = cur;
+  for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
+  {
+    const s32 bits = adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] >> shift;
+    const s32 hist = std::clamp((hist1 * coef1 + hist2 * coef2 + 0x20) >> 6, -0x200000, 0x1fffff);
+    const s32 cur = ((static_cast<s16>(bits << 12) >> scale) << 6) + hist;
 
-  cur >>= 6;
-  cur = std::clamp(cur, -0x8000, 0x7fff);
+    hist2 = hist1;
+    hist1 = cur;
 
-  return (s16)cur;
+    pcm[i * 2] = static_cast<s16>(std::clamp(cur >> 6, -0x8000, 0x7fff));
+  }
 }
 
 void ADPCMDecoder::ResetFilter()
@@ -61,12 +62,7 @@ void ADPCMDecoder::DoState(PointerWrap& p)
 
 void ADPCMDecoder::DecodeBlock(s16* pcm, const u8* adpcm)
 {
-  for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
-  {
-    pcm[i * 2] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] & 0xf, adpcm[0],
-                                 m_histl1, m_histl2);
-    pcm[i * 2 + 1] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] >> 4, adpcm[1],
-                                     m_histr1, m_histr2);
-  }
+  DecodeChannel(pcm, adpcm, 0, adpcm[0], m_histl1, m_histl2);
+  DecodeChannel(pcm + 1, adpcm, 4, adpcm[1], m_histr1, m_histr2);
 }
 }  // namespace StreamADPCM
@@ -291,14 +291,20 @@ void Init()
   core_timing.SetFakeDecStartValue(0xFFFFFFFF);
   core_timing.SetFakeDecStartTicks(core_timing.GetTicks());
 
+  // A bit more than one half-line. Events which the game can't observe with cycle precision may run
+  // this late, which lets them run together with the next VI update instead of needing an extra
+  // exit from JIT code of their own.
+  const s64 coalesce_delay = GetTicksPerSecond() / 30000;
+
   et_Dec = core_timing.RegisterEvent("DecCallback", DecrementerCallback);
   et_VI = core_timing.RegisterEvent("VICallback", VICallback);
   et_DSP = core_timing.RegisterEvent("DSPCallback", DSPCallback);
   et_AudioDMA = core_timing.RegisterEvent("AudioDMACallback", AudioDMACallback);
-  et_IPC_HLE = core_timing.RegisterEvent("IPC_HLE_UpdateCallback", IPC_HLE_UpdateCallback);
-  et_GPU_sleeper = core_timing.RegisterEvent("GPUSleeper", GPUSleepCallback);
-  et_perf_tracker = core_timing.RegisterEvent("PerfTracker", PerfTrackerCallback);
-  et_PatchEngine = core_timing.RegisterEvent("PatchEngine", PatchEngineCallback);
+  et_IPC_HLE = core_timing.RegisterEvent("IPC_HLE_UpdateCallback", IPC_HLE_UpdateCallback,
+                                         coalesce_delay);
+  et_GPU_sleeper = core_timing.RegisterEvent("GPUSleeper", GPUSleepCallback, coalesce_delay);
+  et_perf_tracker = core_timing.RegisterEvent("PerfTracker", PerfTrackerCallback, coalesce_delay);
+  et_PatchEngine = core_timing.RegisterEvent("PatchEngine", PatchEngineCallback, coalesce_delay);
 
   core_timing.ScheduleEvent(0, et_perf_tracker);
   core_timing.ScheduleEvent(0, et_GPU_sleeper);
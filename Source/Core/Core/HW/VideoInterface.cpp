@@ -27,6 +27,7 @@
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/Movie.h"
+#include "Core/State.h"
 #include "Core/System.h"
 
 #include "DiscIO/Enums.h"
@@ -305,25 +306,32 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                  }));
 
   // MMIOs with unimplemented writes that trigger warnings.
+  // Games poll the beam position in tight loops, so the reads are Function handlers.
   mmio->Register(
-      base | VI_VERTICAL_BEAM_POSITION, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
-        auto& state = system.GetVideoInterfaceState().GetData();
-        return 1 + (state.half_line_count) / 2;
-      }),
+      base | VI_VERTICAL_BEAM_POSITION,
+      MMIO::FunctionRead<u16>(
+          [](Core::System&, void* context, u32) -> u16 {
+            auto& vi_state = *static_cast<VideoInterfaceState::Data*>(context);
+            return 1 + (vi_state.half_line_count) / 2;
+          },
+          &state),
       MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
         WARN_LOG_FMT(
             VIDEOINTERFACE,
             "Changing vertical beam position to {:#06x} - not documented or implemented yet", val);
       }));
   mmio->Register(
-      base | VI_HORIZONTAL_BEAM_POSITION, MMIO::ComplexRead<u16>([](Core::System& system, u32) {
-        auto& state = system.GetVideoInterfaceState().GetData();
-        u16 value = static_cast<u16>(
-            1 + state.h_timing_0.HLW *
-                    (system.GetCoreTiming().GetTicks() - state.ticks_last_line_start) /
-                    (GetTicksPerHalfLine()));
-        return std::clamp<u16>(value, 1, state.h_timing_0.HLW * 2);
-      }),
+      base | VI_HORIZONTAL_BEAM_POSITION,
+      MMIO::FunctionRead<u16>(
+          [](Core::System& system, void* context, u32) -> u16 {
+            auto& vi_state = *static_cast<VideoInterfaceState::Data*>(context);
+            u16 value = static_cast<u16>(
+                1 + vi_state.h_timing_0.HLW *
+                        (system.GetCoreTiming().GetTicks() - vi_state.ticks_last_line_start) /
+                        (GetTicksPerHalfLine()));
+            return std::clamp<u16>(value, 1, vi_state.h_timing_0.HLW * 2);
+          },
+          &state),
       MMIO::ComplexWrite<u16>([](Core::System& system, u32, u16 val) {
         WARN_LOG_FMT(
             VIDEOINTERFACE,
@@ -450,6 +458,15 @@ u32 GetXFBAddressTop()
     return state.xfb_info_top.FBB;
 }
 
+u32 GetXFBSize()
+{
+  auto& state = Core::System::GetInstance().GetVideoInterfaceState().GetData();
+
+  // The stride is in units of 16 pixels of 2 bytes each, and spans both fields' lines when
+  // the XFB is interlaced, so this covers every line of the last field pair.
+  return state.picture_configuration.STD * 32 * state.vertical_timing_register.ACV;
+}
+
 u32 GetXFBAddressBottom()
 {
   auto& state = Core::System::GetInstance().GetVideoInterfaceState().GetData();
@@ -853,7 +870,7 @@ static void OutputField(FieldType field, u64 ticks)
   // Outputting the entire frame using a single set of VI register values isn't accurate, as games
   // can change the register values during scanout. To correctly emulate the scanout process, we
   // would need to collate all changes to the VI registers during scanout.
-  if (xfbAddr)
+  if (xfbAddr && State::ShouldOutputField())
     g_video_backend->Video_OutputXFB(xfbAddr, fbWidth, fbStride, fbHeight, ticks);
 }
 
@@ -875,6 +892,7 @@ static void EndField(FieldType field, u64 ticks)
     OutputField(field, ticks);
 
   g_perf_metrics.CountVBlank();
+  Core::System::GetInstance().GetCoreTiming().CountField();
   Core::OnFrameEnd();
 }
 
@@ -371,6 +371,8 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base);
 // returns a pointer to the current visible xfb
 u32 GetXFBAddressTop();
 u32 GetXFBAddressBottom();
+// Size in bytes of the XFB the visible fields are read from, both fields included
+u32 GetXFBSize();
 
 // Update and draw framebuffer
 void Update(u64 ticks);
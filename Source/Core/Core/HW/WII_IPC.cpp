@@ -10,7 +10,9 @@
 #include "Core/HW/DVD/DVDInterface.h"
 #include "Core/HW/MMIO.h"
 #include "Core/HW/ProcessorInterface.h"
+#include "Core/HW/SystemTimers.h"
 #include "Core/IOS/IOS.h"
+#include "Core/System.h"
 
 // This is the intercommunication between ARM and PPC. Currently only PPC actually uses it, because
 // of the IOS HLE
@@ -54,164 +56,122 @@ enum
   UNK_1D0 = 0x1d0,
 };
 
-struct CtrlRegister
-{
-  u8 X1 : 1;
-  u8 X2 : 1;
-  u8 Y1 : 1;
-  u8 Y2 : 1;
-  u8 IX1 : 1;
-  u8 IX2 : 1;
-  u8 IY1 : 1;
-  u8 IY2 : 1;
-
-  CtrlRegister() { X1 = X2 = Y1 = Y2 = IX1 = IX2 = IY1 = IY2 = 0; }
-  inline u8 ppc() { return (IY2 << 5) | (IY1 << 4) | (X2 << 3) | (Y1 << 2) | (Y2 << 1) | X1; }
-  inline u8 arm() { return (IX2 << 5) | (IX1 << 4) | (Y2 << 3) | (X1 << 2) | (X2 << 1) | Y1; }
-  inline void ppc(u32 v)
-  {
-    X1 = v & 1;
-    X2 = (v >> 3) & 1;
-    if ((v >> 2) & 1)
-      Y1 = 0;
-    if ((v >> 1) & 1)
-      Y2 = 0;
-    IY1 = (v >> 4) & 1;
-    IY2 = (v >> 5) & 1;
-  }
-
-  inline void arm(u32 v)
-  {
-    Y1 = v & 1;
-    Y2 = (v >> 3) & 1;
-    if ((v >> 2) & 1)
-      X1 = 0;
-    if ((v >> 1) & 1)
-      X2 = 0;
-    IX1 = (v >> 4) & 1;
-    IX2 = (v >> 5) & 1;
-  }
-};
-
-// STATE_TO_SAVE
-static u32 ppc_msg;
-static u32 arm_msg;
-static CtrlRegister ctrl;
-
-static u32 ppc_irq_flags;
-static u32 ppc_irq_masks;
-static u32 arm_irq_flags;
-static u32 arm_irq_masks;
-
 // Indicates which pins are accessible by broadway.  Writable by starlet only.
 static constexpr Common::Flags<GPIO> gpio_owner = {GPIO::SLOT_LED, GPIO::SLOT_IN, GPIO::SENSOR_BAR,
                                                    GPIO::DO_EJECT, GPIO::AVE_SCL, GPIO::AVE_SDA};
-static Common::Flags<GPIO> gpio_dir;
-Common::Flags<GPIO> g_gpio_out;
 
-static u32 resets;
+WiiIPC::WiiIPC(Core::System& system) : m_system(system)
+{
+}
 
-static CoreTiming::EventType* updateInterrupts;
-static void UpdateInterrupts(Core::System& system, u64 userdata, s64 cyclesLate);
+WiiIPC::~WiiIPC() = default;
 
-void DoState(PointerWrap& p)
+void WiiIPC::DoState(PointerWrap& p)
 {
-  p.Do(ppc_msg);
-  p.Do(arm_msg);
-  p.Do(ctrl);
-  p.Do(ppc_irq_flags);
-  p.Do(ppc_irq_masks);
-  p.Do(arm_irq_flags);
-  p.Do(arm_irq_masks);
-  p.Do(g_gpio_out);
+  p.Do(m_ppc_msg);
+  p.Do(m_arm_msg);
+  p.Do(m_ctrl);
+  p.Do(m_ppc_irq_flags);
+  p.Do(m_ppc_irq_masks);
+  p.Do(m_arm_irq_flags);
+  p.Do(m_arm_irq_masks);
+  p.Do(m_gpio_out);
 }
 
-static void InitState()
+void WiiIPC::InitState()
 {
-  ctrl = CtrlRegister();
-  ppc_msg = 0;
-  arm_msg = 0;
+  m_ctrl = CtrlRegister();
+  m_ppc_msg = 0;
+  m_arm_msg = 0;
 
-  ppc_irq_flags = 0;
-  ppc_irq_masks = 0;
-  arm_irq_flags = 0;
-  arm_irq_masks = 0;
+  m_ppc_irq_flags = 0;
+  m_ppc_irq_masks = 0;
+  m_arm_irq_flags = 0;
+  m_arm_irq_masks = 0;
 
   // The only inputs are POWER, EJECT_BTN, SLOT_IN, and EEP_MISO; Broadway only has access to
   // SLOT_IN
-  gpio_dir = {
+  m_gpio_dir = {
       GPIO::POWER,      GPIO::SHUTDOWN, GPIO::FAN,    GPIO::DC_DC,   GPIO::DI_SPIN,  GPIO::SLOT_LED,
       GPIO::SENSOR_BAR, GPIO::DO_EJECT, GPIO::EEP_CS, GPIO::EEP_CLK, GPIO::EEP_MOSI, GPIO::AVE_SCL,
       GPIO::AVE_SDA,    GPIO::DEBUG0,   GPIO::DEBUG1, GPIO::DEBUG2,  GPIO::DEBUG3,   GPIO::DEBUG4,
       GPIO::DEBUG5,     GPIO::DEBUG6,   GPIO::DEBUG7,
   };
-  g_gpio_out = {};
+  m_gpio_out = {};
 
   // A cleared bit indicates the device is reset/off, so set everything to 1 (this may not exactly
   // match hardware)
-  resets = 0xffffffff;
+  m_resets = 0xffffffff;
 
-  ppc_irq_masks |= INT_CAUSE_IPC_BROADWAY;
+  m_ppc_irq_masks |= INT_CAUSE_IPC_BROADWAY;
 }
 
-void Init()
+void WiiIPC::Init()
 {
   InitState();
-  updateInterrupts =
-      Core::System::GetInstance().GetCoreTiming().RegisterEvent("IPCInterrupt", UpdateInterrupts);
+  m_event_type_update_interrupts =
+      m_system.GetCoreTiming().RegisterEvent("IPCInterrupt", UpdateInterrupts);
 }
 
-void Reset()
+void WiiIPC::Reset()
 {
   INFO_LOG_FMT(WII_IPC, "Resetting ...");
   InitState();
 }
 
-void Shutdown()
+void WiiIPC::Shutdown()
 {
 }
 
-void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
+void WiiIPC::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 {
-  mmio->Register(base | IPC_PPCMSG, MMIO::InvalidRead<u32>(), MMIO::DirectWrite<u32>(&ppc_msg));
+  mmio->Register(base | IPC_PPCMSG, MMIO::InvalidRead<u32>(), MMIO::DirectWrite<u32>(&m_ppc_msg));
 
-  mmio->Register(base | IPC_PPCCTRL,
-                 MMIO::ComplexRead<u32>([](Core::System&, u32) { return ctrl.ppc(); }),
+  mmio->Register(base | IPC_PPCCTRL, MMIO::ComplexRead<u32>([](Core::System& system, u32) {
+                   return system.GetWiiIPC().m_ctrl.ppc();
+                 }),
                  MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
-                   ctrl.ppc(val);
+                   auto& wii_ipc = system.GetWiiIPC();
+                   wii_ipc.m_ctrl.ppc(val);
                    // The IPC interrupt is triggered when IY1/IY2 is set and
                    // Y1/Y2 is written to -- even when this results in clearing the bit.
-                   if ((val >> 2 & 1 && ctrl.IY1) || (val >> 1 & 1 && ctrl.IY2))
-                     ppc_irq_flags |= INT_CAUSE_IPC_BROADWAY;
-                   if (ctrl.X1)
-                     HLE::GetIOS()->EnqueueIPCRequest(ppc_msg);
+                   if ((val >> 2 & 1 && wii_ipc.m_ctrl.IY1) || (val >> 1 & 1 && wii_ipc.m_ctrl.IY2))
+                     wii_ipc.m_ppc_irq_flags |= INT_CAUSE_IPC_BROADWAY;
+                   if (wii_ipc.m_ctrl.X1)
+                     HLE::GetIOS()->EnqueueIPCRequest(wii_ipc.m_ppc_msg);
                    HLE::GetIOS()->UpdateIPC();
-                   system.GetCoreTiming().ScheduleEvent(0, updateInterrupts, 0);
+                   system.GetCoreTiming().ScheduleEvent(0, wii_ipc.m_event_type_update_interrupts,
+                                                        0);
                  }));
 
-  mmio->Register(base | IPC_ARMMSG, MMIO::DirectRead<u32>(&arm_msg), MMIO::InvalidWrite<u32>());
+  mmio->Register(base | IPC_ARMMSG, MMIO::DirectRead<u32>(&m_arm_msg), MMIO::InvalidWrite<u32>());
 
   mmio->Register(base | PPC_IRQFLAG, MMIO::InvalidRead<u32>(),
                  MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
-                   ppc_irq_flags &= ~val;
+                   auto& wii_ipc = system.GetWiiIPC();
+                   wii_ipc.m_ppc_irq_flags &= ~val;
                    HLE::GetIOS()->UpdateIPC();
-                   system.GetCoreTiming().ScheduleEvent(0, updateInterrupts, 0);
+                   system.GetCoreTiming().ScheduleEvent(0, wii_ipc.m_event_type_update_interrupts,
+                                                        0);
                  }));
 
   mmio->Register(base | PPC_IRQMASK, MMIO::InvalidRead<u32>(),
                  MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
-                   ppc_irq_masks = val;
-                   if (ppc_irq_masks & INT_CAUSE_IPC_BROADWAY)  // wtf?
-                     Reset();
+                   auto& wii_ipc = system.GetWiiIPC();
+                   wii_ipc.m_ppc_irq_masks = val;
+                   if (wii_ipc.m_ppc_irq_masks & INT_CAUSE_IPC_BROADWAY)  // wtf?
+                     wii_ipc.Reset();
                    HLE::GetIOS()->UpdateIPC();
-                   system.GetCoreTiming().ScheduleEvent(0, updateInterrupts, 0);
+                   system.GetCoreTiming().ScheduleEvent(0, wii_ipc.m_event_type_update_interrupts,
+                                                        0);
                  }));
 
-  mmio->Register(base | GPIOB_OUT, MMIO::DirectRead<u32>(&g_gpio_out.m_hex),
-                 MMIO::ComplexWrite<u32>([](Core::System&, u32, u32 val) {
-                   g_gpio_out.m_hex =
-                       (val & gpio_owner.m_hex) | (g_gpio_out.m_hex & ~gpio_owner.m_hex);
-                   if (g_gpio_out[GPIO::DO_EJECT])
+  mmio->Register(base | GPIOB_OUT, MMIO::DirectRead<u32>(&m_gpio_out.m_hex),
+                 MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
+                   auto& wii_ipc = system.GetWiiIPC();
+                   wii_ipc.m_gpio_out.m_hex =
+                       (val & gpio_owner.m_hex) | (wii_ipc.m_gpio_out.m_hex & ~gpio_owner.m_hex);
+                   if (wii_ipc.m_gpio_out[GPIO::DO_EJECT])
                    {
                      INFO_LOG_FMT(WII_IPC, "Ejecting disc due to GPIO write");
                      DVDInterface::EjectDisc(DVDInterface::EjectCause::Software);
@@ -219,9 +179,11 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    // SENSOR_BAR is checked by WiimoteEmu::CameraLogic
                    // TODO: AVE, SLOT_LED
                  }));
-  mmio->Register(base | GPIOB_DIR, MMIO::DirectRead<u32>(&gpio_dir.m_hex),
-                 MMIO::ComplexWrite<u32>([](Core::System&, u32, u32 val) {
-                   gpio_dir.m_hex = (val & gpio_owner.m_hex) | (gpio_dir.m_hex & ~gpio_owner.m_hex);
+  mmio->Register(base | GPIOB_DIR, MMIO::DirectRead<u32>(&m_gpio_dir.m_hex),
+                 MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
+                   auto& wii_ipc = system.GetWiiIPC();
+                   wii_ipc.m_gpio_dir.m_hex =
+                       (val & gpio_owner.m_hex) | (wii_ipc.m_gpio_dir.m_hex & ~gpio_owner.m_hex);
                  }));
   mmio->Register(base | GPIOB_IN, MMIO::ComplexRead<u32>([](Core::System&, u32) {
                    Common::Flags<GPIO> gpio_in;
@@ -240,11 +202,12 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // Also: The HW_GPIO registers always have read access to all pins, but any writes (changes) must
   // go through the HW_GPIOB registers if the corresponding bit is set in the HW_GPIO_OWNER
   // register.
-  mmio->Register(base | GPIO_OUT, MMIO::DirectRead<u32>(&g_gpio_out.m_hex),
-                 MMIO::ComplexWrite<u32>([](Core::System&, u32, u32 val) {
-                   g_gpio_out.m_hex =
-                       (g_gpio_out.m_hex & gpio_owner.m_hex) | (val & ~gpio_owner.m_hex);
-                   if (g_gpio_out[GPIO::DO_EJECT])
+  mmio->Register(base | GPIO_OUT, MMIO::DirectRead<u32>(&m_gpio_out.m_hex),
+                 MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
+                   auto& wii_ipc = system.GetWiiIPC();
+                   wii_ipc.m_gpio_out.m_hex =
+                       (wii_ipc.m_gpio_out.m_hex & gpio_owner.m_hex) | (val & ~gpio_owner.m_hex);
+                   if (wii_ipc.m_gpio_out[GPIO::DO_EJECT])
                    {
                      INFO_LOG_FMT(WII_IPC, "Ejecting disc due to GPIO write");
                      DVDInterface::EjectDisc(DVDInterface::EjectCause::Software);
@@ -252,9 +215,11 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    // SENSOR_BAR is checked by WiimoteEmu::CameraLogic
                    // TODO: AVE, SLOT_LED
                  }));
-  mmio->Register(base | GPIO_DIR, MMIO::DirectRead<u32>(&gpio_dir.m_hex),
-                 MMIO::ComplexWrite<u32>([](Core::System&, u32, u32 val) {
-                   gpio_dir.m_hex = (gpio_dir.m_hex & gpio_owner.m_hex) | (val & ~gpio_owner.m_hex);
+  mmio->Register(base | GPIO_DIR, MMIO::DirectRead<u32>(&m_gpio_dir.m_hex),
+                 MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
+                   auto& wii_ipc = system.GetWiiIPC();
+                   wii_ipc.m_gpio_dir.m_hex =
+                       (wii_ipc.m_gpio_dir.m_hex & gpio_owner.m_hex) | (val & ~gpio_owner.m_hex);
                  }));
   mmio->Register(base | GPIO_IN, MMIO::ComplexRead<u32>([](Core::System&, u32) {
                    Common::Flags<GPIO> gpio_in;
@@ -263,15 +228,16 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                  }),
                  MMIO::Nop<u32>());
 
-  mmio->Register(base | HW_RESETS, MMIO::DirectRead<u32>(&resets),
-                 MMIO::ComplexWrite<u32>([](Core::System&, u32, u32 val) {
+  mmio->Register(base | HW_RESETS, MMIO::DirectRead<u32>(&m_resets),
+                 MMIO::ComplexWrite<u32>([](Core::System& system, u32, u32 val) {
+                   auto& wii_ipc = system.GetWiiIPC();
                    // A reset occurs when the corresponding bit is cleared
-                   const bool di_reset_triggered = (resets & 0x400) && !(val & 0x400);
-                   resets = val;
+                   const bool di_reset_triggered = (wii_ipc.m_resets & 0x400) && !(val & 0x400);
+                   wii_ipc.m_resets = val;
                    if (di_reset_triggered)
                    {
                      // The GPIO *disables* spinning up the drive
-                     const bool spinup = !g_gpio_out[GPIO::DI_SPIN];
+                     const bool spinup = !wii_ipc.m_gpio_out[GPIO::DI_SPIN];
                      INFO_LOG_FMT(WII_IPC, "Resetting DI {} spinup", spinup ? "with" : "without");
                      DVDInterface::ResetDrive(spinup);
                    }
@@ -285,53 +251,56 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   mmio->Register(base | UNK_1D0, MMIO::Constant<u32>(0), MMIO::Nop<u32>());
 }
 
-static void UpdateInterrupts(Core::System& system, u64 userdata, s64 cyclesLate)
+void WiiIPC::UpdateInterrupts(Core::System& system, u64 userdata, s64 cyclesLate)
 {
-  if ((ctrl.Y1 & ctrl.IY1) || (ctrl.Y2 & ctrl.IY2))
+  auto& wii_ipc = system.GetWiiIPC();
+  if ((wii_ipc.m_ctrl.Y1 & wii_ipc.m_ctrl.IY1) || (wii_ipc.m_ctrl.Y2 & wii_ipc.m_ctrl.IY2))
   {
-    ppc_irq_flags |= INT_CAUSE_IPC_BROADWAY;
+    wii_ipc.m_ppc_irq_flags |= INT_CAUSE_IPC_BROADWAY;
   }
 
-  if ((ctrl.X1 & ctrl.IX1) || (ctrl.X2 & ctrl.IX2))
+  if ((wii_ipc.m_ctrl.X1 & wii_ipc.m_ctrl.IX1) || (wii_ipc.m_ctrl.X2 & wii_ipc.m_ctrl.IX2))
   {
-    ppc_irq_flags |= INT_CAUSE_IPC_STARLET;
+    wii_ipc.m_ppc_irq_flags |= INT_CAUSE_IPC_STARLET;
   }
 
   // Generate interrupt on PI if any of the devices behind starlet have an interrupt and mask is set
-  system.GetProcessorInterface().SetInterrupt(ProcessorInterface::INT_CAUSE_WII_IPC,
-                                              !!(ppc_irq_flags & ppc_irq_masks));
+  system.GetProcessorInterface().SetInterrupt(
+      ProcessorInterface::INT_CAUSE_WII_IPC,
+      !!(wii_ipc.m_ppc_irq_flags & wii_ipc.m_ppc_irq_masks));
 }
 
-void ClearX1()
+void WiiIPC::ClearX1()
 {
-  ctrl.X1 = 0;
+  m_ctrl.X1 = 0;
 }
 
-void GenerateAck(u32 address)
+void WiiIPC::GenerateAck(u32 address)
 {
-  ctrl.Y2 = 1;
-  DEBUG_LOG_FMT(WII_IPC, "GenerateAck: {:08x} | {:08x} [R:{} A:{} E:{}]", ppc_msg, address, ctrl.Y1,
-                ctrl.Y2, ctrl.X1);
+  m_ctrl.Y2 = 1;
+  DEBUG_LOG_FMT(WII_IPC, "GenerateAck: {:08x} | {:08x} [R:{} A:{} E:{}]", m_ppc_msg, address,
+                m_ctrl.Y1, m_ctrl.Y2, m_ctrl.X1);
   // Based on a hardware test, the IPC interrupt takes approximately 100 TB ticks to fire
   // after Y2 is seen in the control register.
-  Core::System::GetInstance().GetCoreTiming().ScheduleEvent(100 * SystemTimers::TIMER_RATIO,
-                                                            updateInterrupts);
+  m_system.GetCoreTiming().ScheduleEvent(100 * SystemTimers::TIMER_RATIO,
+                                         m_event_type_update_interrupts);
 }
 
-void GenerateReply(u32 address)
+void WiiIPC::GenerateReply(u32 address)
 {
-  arm_msg = address;
-  ctrl.Y1 = 1;
-  DEBUG_LOG_FMT(WII_IPC, "GenerateReply: {:08x} | {:08x} [R:{} A:{} E:{}]", ppc_msg, address,
-                ctrl.Y1, ctrl.Y2, ctrl.X1);
+  m_arm_msg = address;
+  m_ctrl.Y1 = 1;
+  DEBUG_LOG_FMT(WII_IPC, "GenerateReply: {:08x} | {:08x} [R:{} A:{} E:{}]", m_ppc_msg, address,
+                m_ctrl.Y1, m_ctrl.Y2, m_ctrl.X1);
   // Based on a hardware test, the IPC interrupt takes approximately 100 TB ticks to fire
   // after Y1 is seen in the control register.
-  Core::System::GetInstance().GetCoreTiming().ScheduleEvent(100 * SystemTimers::TIMER_RATIO,
-                                                            updateInterrupts);
+  m_system.GetCoreTiming().ScheduleEvent(100 * SystemTimers::TIMER_RATIO,
+                                         m_event_type_update_interrupts);
 }
 
-bool IsReady()
+bool WiiIPC::IsReady() const
 {
-  return ((ctrl.Y1 == 0) && (ctrl.Y2 == 0) && ((ppc_irq_flags & INT_CAUSE_IPC_BROADWAY) == 0));
+  return ((m_ctrl.Y1 == 0) && (m_ctrl.Y2 == 0) &&
+          ((m_ppc_irq_flags & INT_CAUSE_IPC_BROADWAY) == 0));
 }
 }  // namespace IOS
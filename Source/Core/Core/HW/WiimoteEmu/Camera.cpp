@@ -13,6 +13,7 @@
 
 #include "Core/HW/WII_IPC.h"
 #include "Core/HW/WiimoteCommon/WiimoteReport.h"
+#include "Core/System.h"
 
 namespace WiimoteEmu
 {
@@ -112,7 +113,7 @@ void CameraLogic::Update(const std::array<CameraPoint, NUM_POINTS>& camera_point
     return;
 
   // If the sensor bar is off the camera will see no LEDs and return 0xFFs.
-  if (!IOS::g_gpio_out[IOS::GPIO::SENSOR_BAR])
+  if (!Core::System::GetInstance().GetWiiIPC().GetGPIOOut()[IOS::GPIO::SENSOR_BAR])
     return;
 
   switch (m_reg_data.mode)
@@ -3,10 +3,14 @@
 
 #include "Core/HW/WiimoteReal/IOLinux.h"
 
+#include <array>
+#include <cerrno>
+
 #include <bluetooth/bluetooth.h>
 #include <bluetooth/hci.h>
 #include <bluetooth/hci_lib.h>
 #include <bluetooth/l2cap.h>
+#include <fcntl.h>
 #include <sys/poll.h>
 #include <unistd.h>
 
@@ -117,8 +121,10 @@ WiimoteLinux::WiimoteLinux(bdaddr_t bdaddr) : m_bdaddr(bdaddr)
   m_cmd_sock = -1;
   m_int_sock = -1;
 
+  // The pipe is non-blocking so that IORead can drain all pending wakeups at once, and so that
+  // IOWakeup never blocks when plenty of wakeups are pending already.
   int fds[2];
-  if (pipe(fds))
+  if (pipe2(fds, O_NONBLOCK))
   {
     ERROR_LOG_FMT(WIIMOTE, "pipe failed");
     abort();
@@ -216,7 +222,8 @@ bool WiimoteLinux::IsConnected() const
 void WiimoteLinux::IOWakeup()
 {
   char c = 0;
-  if (write(m_wakeup_pipe_w, &c, 1) != 1)
+  // If the pipe is full, the thread is going to wake up anyway.
+  if (write(m_wakeup_pipe_w, &c, 1) != 1 && errno != EAGAIN)
   {
     ERROR_LOG_FMT(WIIMOTE, "Unable to write to wakeup pipe.");
   }
@@ -245,14 +252,14 @@ int WiimoteLinux::IORead(u8* buf)
 
   if (poll_wakeup.revents & POLLIN)
   {
-    char c;
-    if (read(m_wakeup_pipe_r, &c, 1) != 1)
+    // All pending wakeups are handled by the same trip around the thread loop.
+    std::array<char, 64> wakeups;
+    while (read(m_wakeup_pipe_r, wakeups.data(), wakeups.size()) > 0)
     {
-      ERROR_LOG_FMT(WIIMOTE, "Unable to read from wakeup pipe.");
     }
-    return -1;
   }
 
+  // If a report arrived together with the wakeup, it is read now rather than after another poll.
   if (!(poll_sock.revents & POLLIN))
     return -1;
 
@@ -325,25 +325,28 @@ void Wiimote::Read()
 
 bool Wiimote::Write()
 {
-  // nothing written, but this is not an error
-  if (m_write_reports.Empty())
-    return true;
-
-  Report const& rpt = m_write_reports.Front();
-
-  if (m_balance_board_dump_port > 0 && m_index == WIIMOTE_BALANCE_BOARD)
+  // Send everything that has been queued before waiting for input again. Otherwise each report of
+  // a burst (such as speaker data) would need its own trip around the thread loop, and on backends
+  // whose reads can't be woken up, it would have to wait for the next input report.
+  while (!m_write_reports.Empty())
   {
-    static sf::UdpSocket Socket;
-    Socket.send((char*)rpt.data(), rpt.size(), sf::IpAddress::LocalHost, m_balance_board_dump_port);
-  }
-  int ret = IOWrite(rpt.data(), rpt.size());
+    Report const& rpt = m_write_reports.Front();
+
+    if (m_balance_board_dump_port > 0 && m_index == WIIMOTE_BALANCE_BOARD)
+    {
+      static sf::UdpSocket Socket;
+      Socket.send((char*)rpt.data(), rpt.size(), sf::IpAddress::LocalHost,
+                  m_balance_board_dump_port);
+    }
+    const int ret = IOWrite(rpt.data(), rpt.size());
 
-  m_write_reports.Pop();
+    m_write_reports.Pop();
 
-  if (!m_write_reports.Empty())
-    IOWakeup();
+    if (ret == 0)
+      return false;
+  }
 
-  return ret != 0;
+  return true;
 }
 
 bool Wiimote::IsBalanceBoard()
@@ -0,0 +1,62 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/BufferView.h"
+
+#include "Core/HW/Memmap.h"
+
+namespace IOS::HLE
+{
+BufferView::BufferView(Memory::MemoryManager& memory, u32 address, u32 size)
+{
+  // Empty buffers are always valid, as their address is never used.
+  const std::span<u8> memory_span = memory.GetSpanForAddress(address);
+  if (size != 0 && memory_span.size() < size)
+    return;
+
+  m_memory = &memory;
+  m_address = address;
+  m_span = memory_span.first(size);
+}
+
+BufferView BufferView::GetSubview(u32 offset, u32 size) const
+{
+  if (!IsValid() || !Contains(offset, size))
+    return {};
+
+  BufferView view;
+  view.m_memory = m_memory;
+  view.m_address = m_address + offset;
+  view.m_span = m_span.subspan(offset, size);
+  return view;
+}
+
+bool BufferView::CopyTo(void* data, u32 offset, u32 size) const
+{
+  if (!Contains(offset, size))
+    return false;
+
+  if (size != 0)
+    std::memcpy(data, m_span.data() + offset, size);
+  return true;
+}
+
+bool BufferView::CopyFrom(u32 offset, const void* data, u32 size) const
+{
+  if (!Contains(offset, size))
+    return false;
+
+  if (size != 0)
+  {
+    std::memcpy(m_span.data() + offset, data, size);
+    MarkWritten(offset, size);
+  }
+  return true;
+}
+
+void BufferView::MarkWritten(u32 offset, u32 size) const
+{
+  if (m_memory && size != 0)
+    m_memory->MarkWritten(m_address + offset, size);
+}
+}  // namespace IOS::HLE
@@ -0,0 +1,90 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstring>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+
+namespace Memory
+{
+class MemoryManager;
+}
+
+namespace IOS::HLE
+{
+// A view of a buffer in emulated memory which was passed to IOS in a request, such as the buffer
+// of a read or write request or one of the vectors of an ioctlv.
+//
+// This lets devices work on request data in place instead of copying it out of emulated memory
+// and back. The range is checked once when the view is created, and a view of a buffer which is
+// not entirely in MEM1 or MEM2 is invalid and empty. Values are read and written as big endian.
+//
+// Write() reports what it writes to the write tracking of the memory manager. Code which writes
+// through GetSpan() directly has to call MarkWritten() afterwards instead.
+class BufferView final
+{
+public:
+  BufferView() = default;
+  BufferView(Memory::MemoryManager& memory, u32 address, u32 size);
+
+  bool IsValid() const { return m_memory != nullptr; }
+  explicit operator bool() const { return IsValid(); }
+
+  u32 GetAddress() const { return m_address; }
+  u32 GetSize() const { return static_cast<u32>(m_span.size()); }
+  std::span<u8> GetSpan() const { return m_span; }
+  u8* GetPointer() const { return m_span.data(); }
+
+  // Returns an invalid view if the range doesn't lie within this view.
+  BufferView GetSubview(u32 offset, u32 size) const;
+
+  template <typename T>
+  std::optional<T> Read(u32 offset) const
+  {
+    static_assert(std::is_arithmetic_v<T>);
+    if (!Contains(offset, sizeof(T)))
+      return std::nullopt;
+
+    T value;
+    std::memcpy(&value, m_span.data() + offset, sizeof(T));
+    return Common::FromBigEndian(value);
+  }
+
+  template <typename T>
+  bool Write(u32 offset, T value) const
+  {
+    static_assert(std::is_arithmetic_v<T>);
+    if (!Contains(offset, sizeof(T)))
+      return false;
+
+    value = Common::FromBigEndian(value);
+    std::memcpy(m_span.data() + offset, &value, sizeof(T));
+    MarkWritten(offset, sizeof(T));
+    return true;
+  }
+
+  // Copies size bytes at offset into data, or returns false if they are not all in the view.
+  bool CopyTo(void* data, u32 offset, u32 size) const;
+  // Copies size bytes from data to offset, or returns false if they don't all fit in the view.
+  bool CopyFrom(u32 offset, const void* data, u32 size) const;
+
+  void MarkWritten() const { MarkWritten(0, GetSize()); }
+  void MarkWritten(u32 offset, u32 size) const;
+
+private:
+  bool Contains(u32 offset, u32 size) const
+  {
+    return offset <= m_span.size() && size <= m_span.size() - offset;
+  }
+
+  Memory::MemoryManager* m_memory = nullptr;
+  u32 m_address = 0;
+  std::span<u8> m_span;
+};
+}  // namespace IOS::HLE
@@ -5,7 +5,9 @@
 
 #include <array>
 #include <map>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -387,8 +389,21 @@ private:
   using ContentTable = std::array<OpenedContent, 16>;
   ContentTable m_content_table;
 
+  // Title metadata which has been read from the NAND. It is read lazily and discarded whenever the
+  // file system reports that titles or tickets may have changed.
+  struct TitleMetadataCache
+  {
+    u64 fs_version = 0;
+    std::optional<std::vector<u64>> installed_titles;
+    std::optional<std::vector<u64>> titles_with_tickets;
+    std::map<u64, ES::TMDReader> installed_tmds;
+    std::map<std::pair<u64, std::optional<u8>>, ES::TicketReader> tickets;
+  };
+  TitleMetadataCache& GetTitleMetadataCache() const;
+
   ContextArray m_contexts;
   TitleContext m_title_context{};
   std::string m_pending_ppc_boot_content_path;
+  mutable TitleMetadataCache m_title_metadata_cache;
 };
 }  // namespace IOS::HLE
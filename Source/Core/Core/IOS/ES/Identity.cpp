@@ -12,6 +12,7 @@
 #include "Common/StringUtil.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/Memmap.h"
+#include "Core/IOS/BufferView.h"
 #include "Core/IOS/ES/Formats.h"
 #include "Core/IOS/IOSC.h"
 #include "Core/IOS/Uids.h"
@@ -50,14 +51,19 @@ IPCReply ESDevice::Encrypt(u32 uid, const IOCtlVRequest& request)
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
   u32 keyIndex = memory.Read_U32(request.in_vectors[0].address);
-  u8* source = memory.GetPointer(request.in_vectors[2].address);
-  u32 size = request.in_vectors[2].size;
-  u8* iv = memory.GetPointer(request.io_vectors[0].address);
-  u8* destination = memory.GetPointer(request.io_vectors[1].address);
+  const BufferView source(memory, request.in_vectors[2].address, request.in_vectors[2].size);
+  const BufferView iv(memory, request.io_vectors[0].address, request.io_vectors[0].size);
+  const BufferView destination(memory, request.io_vectors[1].address, request.io_vectors[1].size);
+  if (!source || iv.GetSize() < 16 || destination.GetSize() < source.GetSize())
+    return IPCReply(ES_EINVAL);
 
   // TODO: Check whether the active title is allowed to encrypt.
 
-  const ReturnCode ret = m_ios.GetIOSC().Encrypt(keyIndex, iv, source, size, destination, PID_ES);
+  const ReturnCode ret =
+      m_ios.GetIOSC().Encrypt(keyIndex, iv.GetPointer(), source.GetPointer(), source.GetSize(),
+                             destination.GetPointer(), PID_ES);
+  iv.MarkWritten();
+  destination.MarkWritten();
   return IPCReply(ret);
 }
 
@@ -69,14 +75,19 @@ IPCReply ESDevice::Decrypt(u32 uid, const IOCtlVRequest& request)
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
   u32 keyIndex = memory.Read_U32(request.in_vectors[0].address);
-  u8* source = memory.GetPointer(request.in_vectors[2].address);
-  u32 size = request.in_vectors[2].size;
-  u8* iv = memory.GetPointer(request.io_vectors[0].address);
-  u8* destination = memory.GetPointer(request.io_vectors[1].address);
+  const BufferView source(memory, request.in_vectors[2].address, request.in_vectors[2].size);
+  const BufferView iv(memory, request.io_vectors[0].address, request.io_vectors[0].size);
+  const BufferView destination(memory, request.io_vectors[1].address, request.io_vectors[1].size);
+  if (!source || iv.GetSize() < 16 || destination.GetSize() < source.GetSize())
+    return IPCReply(ES_EINVAL);
 
   // TODO: Check whether the active title is allowed to decrypt.
 
-  const ReturnCode ret = m_ios.GetIOSC().Decrypt(keyIndex, iv, source, size, destination, PID_ES);
+  const ReturnCode ret =
+      m_ios.GetIOSC().Decrypt(keyIndex, iv.GetPointer(), source.GetPointer(), source.GetSize(),
+                             destination.GetPointer(), PID_ES);
+  iv.MarkWritten();
+  destination.MarkWritten();
   return IPCReply(ret);
 }
 
@@ -115,15 +126,22 @@ IPCReply ESDevice::Sign(const IOCtlVRequest& request)
   INFO_LOG_FMT(IOS_ES, "IOCTL_ES_SIGN");
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
-  u8* ap_cert_out = memory.GetPointer(request.io_vectors[1].address);
-  u8* data = memory.GetPointer(request.in_vectors[0].address);
-  u32 data_size = request.in_vectors[0].size;
-  u8* sig_out = memory.GetPointer(request.io_vectors[0].address);
+  const BufferView sig_out(memory, request.io_vectors[0].address, request.io_vectors[0].size);
+  const BufferView ap_cert_out(memory, request.io_vectors[1].address, request.io_vectors[1].size);
+  const BufferView data(memory, request.in_vectors[0].address, request.in_vectors[0].size);
+  if (sig_out.GetSize() < sizeof(Common::ec::Signature) ||
+      ap_cert_out.GetSize() < sizeof(IOS::CertECC) || !data)
+  {
+    return IPCReply(ES_EINVAL);
+  }
 
   if (!m_title_context.active)
     return IPCReply(ES_EINVAL);
 
-  m_ios.GetIOSC().Sign(sig_out, ap_cert_out, m_title_context.tmd.GetTitleId(), data, data_size);
+  m_ios.GetIOSC().Sign(sig_out.GetPointer(), ap_cert_out.GetPointer(),
+                       m_title_context.tmd.GetTitleId(), data.GetPointer(), data.GetSize());
+  sig_out.MarkWritten();
+  ap_cert_out.MarkWritten();
   return IPCReply(IPC_SUCCESS);
 }
 
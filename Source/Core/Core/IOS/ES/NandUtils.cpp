@@ -7,8 +7,10 @@
 #include <array>
 #include <cctype>
 #include <functional>
+#include <optional>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -38,6 +40,29 @@ static ES::TMDReader FindTMD(FSDevice& fs, const std::string& tmd_path, Ticks ti
   return ES::TMDReader{std::move(tmd_bytes)};
 }
 
+// Unlike FindTMD, this does not go through the emulated FS device, so it has no effect on the
+// emulated state and can be skipped entirely when the result is already known.
+static std::optional<std::vector<u8>> ReadFile(FS::FileSystem& fs, const std::string& path)
+{
+  const auto file = fs.OpenFile(PID_KERNEL, PID_KERNEL, path, FS::Mode::Read);
+  if (!file)
+    return std::nullopt;
+
+  std::vector<u8> bytes(file->GetStatus()->size);
+  if (!file->Read(bytes.data(), bytes.size()))
+    return std::vector<u8>{};
+
+  return bytes;
+}
+
+ESDevice::TitleMetadataCache& ESDevice::GetTitleMetadataCache() const
+{
+  const u64 fs_version = m_ios.GetFS()->GetTitleMetadataVersion();
+  if (m_title_metadata_cache.fs_version != fs_version)
+    m_title_metadata_cache = {.fs_version = fs_version};
+  return m_title_metadata_cache;
+}
+
 ES::TMDReader ESDevice::FindImportTMD(u64 title_id, Ticks ticks) const
 {
   return FindTMD(*m_ios.GetFSDevice(), Common::GetImportTitlePath(title_id) + "/content/title.tmd",
@@ -46,33 +71,41 @@ ES::TMDReader ESDevice::FindImportTMD(u64 title_id, Ticks ticks) const
 
 ES::TMDReader ESDevice::FindInstalledTMD(u64 title_id, Ticks ticks) const
 {
-  return FindTMD(*m_ios.GetFSDevice(), Common::GetTMDFileName(title_id), ticks);
+  // Reads which are timed have to go through the FS device every time, so that the emulated
+  // timing doesn't depend on what has been cached.
+  if (ticks.IsCounting())
+    return FindTMD(*m_ios.GetFSDevice(), Common::GetTMDFileName(title_id), ticks);
+
+  auto& tmds = GetTitleMetadataCache().installed_tmds;
+  auto it = tmds.find(title_id);
+  if (it == tmds.end())
+  {
+    std::vector<u8> tmd_bytes =
+        ReadFile(*m_ios.GetFS(), Common::GetTMDFileName(title_id)).value_or(std::vector<u8>{});
+    it = tmds.emplace(title_id, ES::TMDReader{std::move(tmd_bytes)}).first;
+  }
+  return it->second;
 }
 
 ES::TicketReader ESDevice::FindSignedTicket(u64 title_id, std::optional<u8> desired_version) const
 {
-  std::string path = desired_version == 1 ? Common::GetV1TicketFileName(title_id) :
-                                            Common::GetTicketFileName(title_id);
-  auto ticket_file = m_ios.GetFS()->OpenFile(PID_KERNEL, PID_KERNEL, path, FS::Mode::Read);
-  if (!ticket_file)
-  {
-    if (desired_version)
-      // Desired ticket does not exist.
-      return {};
+  auto& tickets = GetTitleMetadataCache().tickets;
+  const auto it = tickets.find({title_id, desired_version});
+  if (it != tickets.end())
+    return it->second;
 
-    // Check if we are dealing with a v1 ticket
-    path = Common::GetV1TicketFileName(title_id);
-    ticket_file = m_ios.GetFS()->OpenFile(PID_KERNEL, PID_KERNEL, path, FS::Mode::Read);
+  const auto fs = m_ios.GetFS();
+  const std::string path = desired_version == 1 ? Common::GetV1TicketFileName(title_id) :
+                                                  Common::GetTicketFileName(title_id);
+  auto signed_ticket = ReadFile(*fs, path);
 
-    if (!ticket_file)
-      return {};
-  }
+  // Check if we are dealing with a v1 ticket, unless a specific version was requested.
+  if (!signed_ticket && !desired_version)
+    signed_ticket = ReadFile(*fs, Common::GetV1TicketFileName(title_id));
 
-  std::vector<u8> signed_ticket(ticket_file->GetStatus()->size);
-  if (!ticket_file->Read(signed_ticket.data(), signed_ticket.size()))
-    return {};
-
-  return ES::TicketReader{std::move(signed_ticket)};
+  ES::TicketReader ticket{std::move(signed_ticket).value_or(std::vector<u8>{})};
+  tickets.emplace(std::pair{title_id, desired_version}, ticket);
+  return ticket;
 }
 
 static bool IsValidPartOfTitleID(const std::string& string)
@@ -127,7 +160,10 @@ static std::vector<u64> GetTitlesInTitleOrImport(FS::FileSystem* fs, const std::
 
 std::vector<u64> ESDevice::GetInstalledTitles() const
 {
-  return GetTitlesInTitleOrImport(m_ios.GetFS().get(), "/title");
+  auto& installed_titles = GetTitleMetadataCache().installed_titles;
+  if (!installed_titles)
+    installed_titles = GetTitlesInTitleOrImport(m_ios.GetFS().get(), "/title");
+  return *installed_titles;
 }
 
 std::vector<u64> ESDevice::GetTitleImports() const
@@ -135,9 +171,8 @@ std::vector<u64> ESDevice::GetTitleImports() const
   return GetTitlesInTitleOrImport(m_ios.GetFS().get(), "/import");
 }
 
-std::vector<u64> ESDevice::GetTitlesWithTickets() const
+static std::vector<u64> ReadTitlesWithTickets(FS::FileSystem* fs)
 {
-  const auto fs = m_ios.GetFS();
   const auto entries = fs->ReadDirectory(PID_KERNEL, PID_KERNEL, "/ticket");
   if (!entries)
   {
@@ -178,6 +213,14 @@ std::vector<u64> ESDevice::GetTitlesWithTickets() const
   return title_ids;
 }
 
+std::vector<u64> ESDevice::GetTitlesWithTickets() const
+{
+  auto& titles_with_tickets = GetTitleMetadataCache().titles_with_tickets;
+  if (!titles_with_tickets)
+    titles_with_tickets = ReadTitlesWithTickets(m_ios.GetFS().get());
+  return *titles_with_tickets;
+}
+
 std::vector<ES::Content>
 ESDevice::GetStoredContentsFromTMD(const ES::TMDReader& tmd,
                                    CheckContentHashes check_content_hashes) const
@@ -7,6 +7,7 @@
 
 #include "Common/Logging/Log.h"
 #include "Core/HW/Memmap.h"
+#include "Core/IOS/BufferView.h"
 #include "Core/IOS/ES/Formats.h"
 #include "Core/IOS/FS/FileSystemProxy.h"
 #include "Core/IOS/Uids.h"
@@ -122,7 +123,13 @@ IPCReply ESDevice::ReadContent(u32 uid, const IOCtlVRequest& request)
 
     INFO_LOG_FMT(IOS_ES, "ReadContent(uid={:#x}, cfd={}, size={}, addr={:08x})", uid, cfd, size,
                  addr);
-    return ReadContent(cfd, memory.GetPointer(addr), size, uid, ticks);
+    const BufferView buffer(memory, addr, size);
+    if (!buffer)
+      return ES_EINVAL;
+
+    const s32 result = ReadContent(cfd, buffer.GetPointer(), buffer.GetSize(), uid, ticks);
+    buffer.MarkWritten();
+    return result;
   });
 }
 
@@ -250,6 +250,19 @@ public:
   virtual Result<DirectoryStats> GetDirectoryStats(const std::string& path) = 0;
 
   virtual void SetNandRedirects(std::vector<NandRedirect> nand_redirects) = 0;
+
+  /// Get a counter which changes whenever installed titles, tickets or title contents may have
+  /// been modified. This lets ES cache title metadata without rereading it for every request.
+  u64 GetTitleMetadataVersion() const { return m_title_metadata_version; }
+
+protected:
+  /// Should be called after modifying the file or directory at path.
+  void OnModified(std::string_view path);
+  /// Should be called after any change that can affect every path.
+  void InvalidateTitleMetadata() { ++m_title_metadata_version; }
+
+private:
+  u64 m_title_metadata_version = 0;
 };
 
 template <typename T>
@@ -28,6 +28,37 @@ SplitPathResult SplitPathAndBasename(std::string_view path)
           std::string(path.substr(last_separator + 1))};
 }
 
+// Whether modifying a path can affect the titles, tickets or contents that ES knows about.
+// Title data directories are written to a lot, so they are excluded.
+static bool IsTitleMetadataPath(std::string_view path)
+{
+  if (path == "/ticket" || path.starts_with("/ticket/") || path == "/import" ||
+      path.starts_with("/import/") || path == "/shared1" || path.starts_with("/shared1/"))
+  {
+    return true;
+  }
+
+  if (path != "/title" && !path.starts_with("/title/"))
+    return false;
+
+  // /title/<type>/<identifier>/<subdirectory>
+  size_t position = 0;
+  for (int i = 0; i < 3; ++i)
+  {
+    position = path.find('/', position + 1);
+    if (position == std::string_view::npos)
+      return true;
+  }
+  const std::string_view subdirectory = path.substr(position + 1);
+  return subdirectory == "content" || subdirectory.starts_with("content/");
+}
+
+void FileSystem::OnModified(std::string_view path)
+{
+  if (IsTitleMetadataPath(path))
+    InvalidateTitleMetadata();
+}
+
 std::unique_ptr<FileSystem> MakeFileSystem(Location location,
                                            std::vector<NandRedirect> nand_redirects)
 {
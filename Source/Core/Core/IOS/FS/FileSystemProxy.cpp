@@ -14,6 +14,7 @@
 #include "Common/Swap.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
+#include "Core/IOS/BufferView.h"
 #include "Core/IOS/FS/FileSystem.h"
 #include "Core/IOS/Uids.h"
 #include "Core/System.h"
@@ -314,8 +315,14 @@ std::optional<IPCReply> FSDevice::Read(const ReadWriteRequest& request)
 {
   return MakeIPCReply([&](Ticks t) {
     auto& system = Core::System::GetInstance();
-    auto& memory = system.GetMemory();
-    return Read(request.fd, memory.GetPointer(request.buffer), request.size, request.buffer, t);
+    const BufferView buffer(system.GetMemory(), request.buffer, request.size);
+    if (!buffer)
+      return static_cast<s32>(IPC_EINVAL);
+
+    // The data is read straight into emulated memory.
+    const s32 result = Read(request.fd, buffer.GetPointer(), buffer.GetSize(), request.buffer, t);
+    buffer.MarkWritten();
+    return result;
   });
 }
 
@@ -344,8 +351,11 @@ std::optional<IPCReply> FSDevice::Write(const ReadWriteRequest& request)
 {
   return MakeIPCReply([&](Ticks t) {
     auto& system = Core::System::GetInstance();
-    auto& memory = system.GetMemory();
-    return Write(request.fd, memory.GetPointer(request.buffer), request.size, request.buffer, t);
+    const BufferView buffer(system.GetMemory(), request.buffer, request.size);
+    if (!buffer)
+      return static_cast<s32>(IPC_EINVAL);
+
+    return Write(request.fd, buffer.GetPointer(), buffer.GetSize(), request.buffer, t);
   });
 }
 
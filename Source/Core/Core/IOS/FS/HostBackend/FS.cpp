@@ -47,21 +47,6 @@ HostFileSystem::HostFilename HostFileSystem::BuildFilename(const std::string& wi
   return HostFilename{m_root_path, false};
 }
 
-// Get total filesize of contents of a directory (recursive)
-// Only used for ES_GetUsage atm, could be useful elsewhere?
-static u64 ComputeTotalFileSize(const File::FSTEntry& parent_entry)
-{
-  u64 sizeOfFiles = 0;
-  for (const File::FSTEntry& entry : parent_entry.children)
-  {
-    if (entry.isDirectory)
-      sizeOfFiles += ComputeTotalFileSize(entry);
-    else
-      sizeOfFiles += entry.size;
-  }
-  return sizeOfFiles;
-}
-
 namespace
 {
 struct SerializedFstEntry
@@ -124,12 +109,21 @@ HostFileSystem::HostFileSystem(const std::string& root_path,
   while (m_root_path.ends_with('/'))
     m_root_path.pop_back();
   File::CreateFullPath(m_root_path + '/');
+  ResetMetadataCache();
   ResetFst();
   LoadFst();
 }
 
 HostFileSystem::~HostFileSystem() = default;
 
+void HostFileSystem::ResetMetadataCache()
+{
+  std::vector<std::string> roots{m_root_path};
+  for (const NandRedirect& redirect : m_nand_redirects)
+    roots.push_back(redirect.target_path);
+  m_metadata_cache.SetRoots(roots);
+}
+
 std::string HostFileSystem::GetFstFilePath() const
 {
   return fmt::format("{}/fst.bin", m_root_path);
@@ -206,7 +200,11 @@ void HostFileSystem::SaveFst()
     }
   }
   if (!File::Rename(temp_path, dest_path))
+  {
     PanicAlertFmt("IOS_FS: Failed to rename temporary FST file");
+    return;
+  }
+  m_metadata_cache.OnCreated(dest_path, true, to_write.size() * sizeof(SerializedFstEntry));
 }
 
 HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string& path)
@@ -218,8 +216,8 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
     return nullptr;
 
   auto host_file = BuildFilename(path);
-  const File::FileInfo host_file_info{host_file.host_path};
-  if (!host_file_info.Exists())
+  const auto host_file_info = m_metadata_cache.GetInfo(host_file.host_path);
+  if (!host_file_info)
     return nullptr;
 
   FstEntry* entry = host_file.is_redirect ? &m_redirect_fst : &m_root_entry;
@@ -246,7 +244,7 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
     }
   }
 
-  entry->data.is_file = host_file_info.IsFile();
+  entry->data.is_file = host_file_info->is_file;
   if (entry->data.is_file && !entry->children.empty())
   {
     WARN_LOG_FMT(IOS_FS, "{} is a file but also has children; clearing children", path);
@@ -299,6 +297,8 @@ void HostFileSystem::DoStateRead(PointerWrap& p, std::string start_directory_pat
     }
     }
   }
+
+  m_metadata_cache.Clear();
 }
 
 void HostFileSystem::DoStateWriteOrMeasure(PointerWrap& p, std::string start_directory_path)
@@ -349,6 +349,7 @@ void HostFileSystem::DoState(PointerWrap& p)
   // Temporarily close the file, to prevent any issues with the savestating of files/folders.
   for (Handle& handle : m_handles)
     handle.host_file.reset();
+  CloseCachedHostFiles();
 
   // The format for the next part of the save state is follows:
   // 1. bool Movie::WasMovieActiveWhenStateSaved() &&
@@ -401,6 +402,7 @@ void HostFileSystem::DoState(PointerWrap& p)
       if (Movie::IsMovieActive() && Core::WiiRootIsTemporary())
         DoStateRead(p, "/");
     }
+    InvalidateTitleMetadata();
   }
 
   for (Handle& handle : m_handles)
@@ -421,7 +423,11 @@ ResultCode HostFileSystem::Format(Uid uid)
   if (m_root_path.empty())
     return ResultCode::AccessDenied;
   const std::string root = BuildFilename("/").host_path;
-  if (!File::DeleteDirRecursively(root) || !File::CreateDir(root))
+  CloseCachedHostFiles();
+  const bool recreated = File::DeleteDirRecursively(root) && File::CreateDir(root);
+  m_metadata_cache.Clear();
+  InvalidateTitleMetadata();
+  if (!recreated)
     return ResultCode::UnknownError;
   ResetFst();
   SaveFst();
@@ -449,7 +455,7 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
   if (!parent->CheckPermission(uid, gid, Mode::Write))
     return ResultCode::AccessDenied;
 
-  if (File::Exists(host_path))
+  if (m_metadata_cache.GetInfo(host_path))
     return ResultCode::AlreadyExists;
 
   const bool ok = is_file ? File::CreateEmptyFile(host_path) : File::CreateDir(host_path);
@@ -458,6 +464,8 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
     ERROR_LOG_FMT(IOS_FS, "Failed to create file or directory: {}", host_path);
     return ResultCode::UnknownError;
   }
+  m_metadata_cache.OnCreated(host_path, is_file);
+  OnModified(path);
 
   FstEntry* child = GetFstEntryForPath(path);
   *child = {};
@@ -512,15 +520,20 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
   if (!parent->CheckPermission(uid, gid, Mode::Write))
     return ResultCode::AccessDenied;
 
-  if (!File::Exists(host_path))
+  const auto host_info = m_metadata_cache.GetInfo(host_path);
+  if (!host_info)
     return ResultCode::NotFound;
 
-  if (File::IsFile(host_path) && !IsFileOpened(path))
+  if (host_info->is_file ? IsFileOpened(path) : IsDirectoryInUse(path))
+    return ResultCode::InUse;
+
+  CloseCachedHostFiles(host_path);
+  if (host_info->is_file)
     File::Delete(host_path);
-  else if (File::IsDirectory(host_path) && !IsDirectoryInUse(path))
-    File::DeleteDirRecursively(host_path);
   else
-    return ResultCode::InUse;
+    File::DeleteDirRecursively(host_path);
+  m_metadata_cache.OnDeleted(host_path);
+  OnModified(path);
 
   const auto it = std::find_if(parent->children.begin(), parent->children.end(),
                                GetNamePredicate(split_path.file_name));
@@ -569,18 +582,23 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
   const auto host_new_info = BuildFilename(new_path);
   const std::string& host_old_path = host_old_info.host_path;
   const std::string& host_new_path = host_new_info.host_path;
+  CloseCachedHostFiles(host_old_path);
+  CloseCachedHostFiles(host_new_path);
 
   // If there is already something of the same type at the new path, delete it.
-  if (File::Exists(host_new_path))
+  if (const auto host_new_info = m_metadata_cache.GetInfo(host_new_path))
   {
-    const bool old_is_file = File::IsFile(host_old_path);
-    const bool new_is_file = File::IsFile(host_new_path);
+    const auto host_old_file_info = m_metadata_cache.GetInfo(host_old_path);
+    const bool old_is_file = host_old_file_info && host_old_file_info->is_file;
+    const bool new_is_file = host_new_info->is_file;
     if (old_is_file && new_is_file)
       File::Delete(host_new_path);
     else if (!old_is_file && !new_is_file)
       File::DeleteDirRecursively(host_new_path);
     else
       return ResultCode::Invalid;
+    m_metadata_cache.OnDeleted(host_new_path);
+    OnModified(new_path);
   }
 
   if (!File::Rename(host_old_path, host_new_path))
@@ -607,6 +625,9 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
       return ResultCode::NotFound;
     }
   }
+  m_metadata_cache.OnRenamed(host_old_path, host_new_path);
+  OnModified(old_path);
+  OnModified(new_path);
 
   FstEntry* new_entry = GetFstEntryForPath(new_path);
   new_entry->name = split_new_path.file_name;
@@ -644,12 +665,13 @@ Result<std::vector<std::string>> HostFileSystem::ReadDirectory(Uid uid, Gid gid,
     return ResultCode::Invalid;
 
   const std::string host_path = BuildFilename(path).host_path;
-  File::FSTEntry host_entry = File::ScanDirectoryTree(host_path, false);
-  for (File::FSTEntry& child : host_entry.children)
+  std::vector<std::string> output =
+      m_metadata_cache.ReadDirectory(host_path).value_or(std::vector<std::string>{});
+  for (std::string& child : output)
   {
     // Decode escaped invalid file system characters so that games (such as
     // Harry Potter and the Half-Blood Prince) can find what they expect.
-    child.virtualName = Common::UnescapeFileName(child.virtualName);
+    child = Common::UnescapeFileName(child);
   }
 
   // Sort files according to their order in the FST tree (issue 10234).
@@ -668,21 +690,18 @@ Result<std::vector<std::string>> HostFileSystem::ReadDirectory(Uid uid, Gid gid,
 
   // Now sort in reverse order because Nintendo traverses a linked list
   // in which new elements are inserted at the front.
-  std::sort(host_entry.children.begin(), host_entry.children.end(),
-            [&get_key](const File::FSTEntry& one, const File::FSTEntry& two) {
-              const int key1 = get_key(one.virtualName);
-              const int key2 = get_key(two.virtualName);
+  std::sort(output.begin(), output.end(),
+            [&get_key](const std::string& one, const std::string& two) {
+              const int key1 = get_key(one);
+              const int key2 = get_key(two);
               if (key1 != key2)
                 return key1 > key2;
 
               // For files that are not in the FST, sort lexicographically to ensure that
               // results are consistent no matter what the underlying filesystem is.
-              return one.virtualName > two.virtualName;
+              return one > two;
             });
 
-  std::vector<std::string> output;
-  for (const File::FSTEntry& child : host_entry.children)
-    output.emplace_back(child.virtualName);
   return output;
 }
 
@@ -711,7 +730,8 @@ Result<Metadata> HostFileSystem::GetMetadata(Uid uid, Gid gid, const std::string
     return ResultCode::NotFound;
 
   Metadata metadata = entry->data;
-  metadata.size = File::GetSize(BuildFilename(path).host_path);
+  const auto host_info = m_metadata_cache.GetInfo(BuildFilename(path).host_path);
+  metadata.size = host_info && host_info->is_file ? host_info->size : 0;
   return metadata;
 }
 
@@ -730,7 +750,8 @@ ResultCode HostFileSystem::SetMetadata(Uid caller_uid, const std::string& path,
   if (caller_uid != 0 && uid != entry->data.uid)
     return ResultCode::AccessDenied;
 
-  const bool is_empty = File::GetSize(BuildFilename(path).host_path) == 0;
+  const auto host_info = m_metadata_cache.GetInfo(BuildFilename(path).host_path);
+  const bool is_empty = !host_info || !host_info->is_file || host_info->size == 0;
   if (entry->data.uid != uid && entry->data.is_file && !is_empty)
     return ResultCode::FileNotEmpty;
 
@@ -771,15 +792,13 @@ Result<DirectoryStats> HostFileSystem::GetDirectoryStats(const std::string& wii_
 
   DirectoryStats stats{};
   std::string path(BuildFilename(wii_path).host_path);
-  if (File::IsDirectory(path))
+  if (const auto usage = m_metadata_cache.GetDirectoryUsage(path))
   {
-    File::FSTEntry parent_dir = File::ScanDirectoryTree(path, true);
     // add one for the folder itself
-    stats.used_inodes = 1 + (u32)parent_dir.size;
-
-    u64 total_size = ComputeTotalFileSize(parent_dir);  // "Real" size to convert to nand blocks
+    stats.used_inodes = 1 + (u32)usage->entry_count;
 
-    stats.used_clusters = (u32)(total_size / (16 * 1024));  // one block is 16kb
+    // "Real" size to convert to nand blocks
+    stats.used_clusters = (u32)(usage->file_size / (16 * 1024));  // one block is 16kb
   }
   else
   {
@@ -791,5 +810,8 @@ Result<DirectoryStats> HostFileSystem::GetDirectoryStats(const std::string& wii_
 void HostFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
 {
   m_nand_redirects = std::move(nand_redirects);
+  CloseCachedHostFiles();
+  ResetMetadataCache();
+  InvalidateTitleMetadata();
 }
 }  // namespace IOS::HLE::FS
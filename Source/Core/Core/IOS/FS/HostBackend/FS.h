@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <list>
 #include <map>
 #include <memory>
 #include <string>
@@ -12,6 +13,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
 #include "Core/IOS/FS/FileSystem.h"
+#include "Core/IOS/FS/HostBackend/MetadataCache.h"
 
 namespace IOS::HLE::FS
 {
@@ -94,12 +96,20 @@ private:
   };
   HostFilename BuildFilename(const std::string& wii_path) const;
   std::shared_ptr<File::IOFile> OpenHostFile(const std::string& host_path);
+  /// Keeps a host file open after its last handle was closed, since games often open the same
+  /// files again right away and opening host files can be slow (e.g. with antivirus scanning).
+  void CacheClosedHostFile(std::string host_path, std::shared_ptr<File::IOFile> file);
+  /// Closes the cached host files at host_path or below it, or all of them if it is empty.
+  /// Must be called before the host file is modified other than through a handle.
+  void CloseCachedHostFiles(const std::string& host_path = {});
 
   ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
                                    FileAttribute attribute, Modes modes, bool is_file);
   bool IsFileOpened(const std::string& path) const;
   bool IsDirectoryInUse(const std::string& path) const;
 
+  void ResetMetadataCache();
+
   std::string GetFstFilePath() const;
   void ResetFst();
   void LoadFst();
@@ -113,14 +123,18 @@ private:
   ///
   /// Note that unlike a real Wii's FST, ours is the single source of truth only for
   /// filesystem metadata and ordering. File existence must be checked by querying
-  /// the host filesystem.
+  /// the host filesystem (through m_metadata_cache).
   /// The reasons for this design are twofold: existing users do not have a FST
   /// and we do not want FS to break if the user adds or removes files in their
   /// filesystem root manually.
   FstEntry m_root_entry{};
   std::string m_root_path;
   std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
+  /// Recently closed host files, most recently closed first. Must be destroyed before
+  /// m_open_files, which the files remove themselves from.
+  std::list<std::pair<std::string, std::shared_ptr<File::IOFile>>> m_closed_files;
   std::array<Handle, 16> m_handles{};
+  HostMetadataCache m_metadata_cache;
 
   FstEntry m_redirect_fst{};
   std::vector<NandRedirect> m_nand_redirects;
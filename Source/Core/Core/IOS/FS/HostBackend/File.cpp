@@ -74,6 +74,38 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
   return file_ptr;
 }
 
+void HostFileSystem::CacheClosedHostFile(std::string host_path, std::shared_ptr<File::IOFile> file)
+{
+  constexpr size_t MAX_CLOSED_FILES = 8;
+
+  // Only keep files which no other handle has open.
+  if (!file || file.use_count() != 1)
+    return;
+
+  // Anything reading the host file directly (e.g. savestates) should see what was written.
+  file->Flush();
+
+  m_closed_files.emplace_front(std::move(host_path), std::move(file));
+  if (m_closed_files.size() > MAX_CLOSED_FILES)
+    m_closed_files.pop_back();
+}
+
+void HostFileSystem::CloseCachedHostFiles(const std::string& host_path)
+{
+  if (host_path.empty())
+  {
+    m_closed_files.clear();
+    return;
+  }
+
+  m_closed_files.remove_if([&host_path](const auto& entry) {
+    const std::string& path = entry.first;
+    return path == host_path ||
+           (path.starts_with(host_path) && path.size() > host_path.size() &&
+            path[host_path.size()] == '/');
+  });
+}
+
 Result<FileHandle> HostFileSystem::OpenFile(Uid, Gid, const std::string& path, Mode mode)
 {
   Handle* handle = AssignFreeHandle();
@@ -81,7 +113,8 @@ Result<FileHandle> HostFileSystem::OpenFile(Uid, Gid, const std::string& path, M
     return ResultCode::NoFreeHandle;
 
   const std::string host_path = BuildFilename(path).host_path;
-  if (!File::IsFile(host_path))
+  const auto host_info = m_metadata_cache.GetInfo(host_path);
+  if (!host_info || !host_info->is_file)
   {
     *handle = Handle{};
     return ResultCode::NotFound;
@@ -94,6 +127,9 @@ Result<FileHandle> HostFileSystem::OpenFile(Uid, Gid, const std::string& path, M
     return ResultCode::AccessDenied;
   }
 
+  // The handle holds the file open now.
+  m_closed_files.remove_if([&host_path](const auto& entry) { return entry.first == host_path; });
+
   handle->wii_path = path;
   handle->mode = mode;
   handle->file_offset = 0;
@@ -106,8 +142,9 @@ ResultCode HostFileSystem::Close(Fd fd)
   if (!handle)
     return ResultCode::Invalid;
 
-  // Let go of our pointer to the file, it will automatically close if we are the last handle
-  // accessing it.
+  // Let go of our pointer to the file. If we are the last handle accessing it, it is kept open for
+  // a while in case it gets opened again.
+  CacheClosedHostFile(BuildFilename(handle->wii_path).host_path, std::move(handle->host_file));
   *handle = Handle{};
   return ResultCode::Success;
 }
@@ -154,6 +191,8 @@ Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
     return ResultCode::AccessDenied;
 
   handle->file_offset += count;
+  m_metadata_cache.OnWritten(BuildFilename(handle->wii_path).host_path, handle->file_offset);
+  OnModified(handle->wii_path);
   return count;
 }
 
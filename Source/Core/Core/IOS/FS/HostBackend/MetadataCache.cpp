@@ -0,0 +1,312 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/FS/HostBackend/MetadataCache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+
+namespace IOS::HLE::FS
+{
+static auto GetNodeNamePredicate(std::string_view name)
+{
+  return [name](const auto& node) { return node.name == name; };
+}
+
+static u64 ComputeTotalFileSize(const File::FSTEntry& parent_entry)
+{
+  u64 size = 0;
+  for (const File::FSTEntry& entry : parent_entry.children)
+    size += entry.isDirectory ? ComputeTotalFileSize(entry) : entry.size;
+  return size;
+}
+
+void HostMetadataCache::SetRoots(const std::vector<std::string>& root_paths)
+{
+  m_roots.clear();
+  for (std::string path : root_paths)
+  {
+    while (path.ends_with('/'))
+      path.pop_back();
+    m_roots.push_back(Root{std::move(path)});
+  }
+}
+
+void HostMetadataCache::Clear()
+{
+  for (Root& root : m_roots)
+  {
+    root.loaded = false;
+    root.node = {};
+  }
+}
+
+HostMetadataCache::Root* HostMetadataCache::FindRoot(std::string_view host_path,
+                                                     std::string_view* relative_path)
+{
+  // Redirected paths may be inside another root, so the most specific root has to be used.
+  Root* best_root = nullptr;
+  for (Root& root : m_roots)
+  {
+    if (!host_path.starts_with(root.path))
+      continue;
+    if (host_path.size() != root.path.size() && host_path[root.path.size()] != '/')
+      continue;
+    if (!best_root || root.path.size() > best_root->path.size())
+      best_root = &root;
+  }
+
+  if (best_root)
+    *relative_path = host_path.substr(best_root->path.size());
+  return best_root;
+}
+
+HostMetadataCache::Node* HostMetadataCache::FindNode(Root& root, std::string_view relative_path,
+                                                     bool load)
+{
+  if (!root.loaded)
+  {
+    if (!load || !File::IsDirectory(root.path))
+      return nullptr;
+    root.loaded = true;
+    root.node = {};
+  }
+
+  Node* node = &root.node;
+  std::string path = root.path;
+  for (const std::string& component : SplitString(std::string(relative_path), '/'))
+  {
+    if (component.empty())
+      continue;
+    if (node->is_file)
+      return nullptr;
+
+    if (!node->children_loaded)
+    {
+      if (!load)
+        return nullptr;
+      LoadChildren(*node, path);
+    }
+
+    const auto it = std::find_if(node->children.begin(), node->children.end(),
+                                 GetNodeNamePredicate(component));
+    if (it == node->children.end())
+      return nullptr;
+
+    node = &*it;
+    path += '/';
+    path += component;
+  }
+
+  return node;
+}
+
+HostMetadataCache::Node* HostMetadataCache::FindNode(const std::string& host_path, bool load)
+{
+  std::string_view relative_path;
+  Root* root = FindRoot(host_path, &relative_path);
+  return root ? FindNode(*root, relative_path, load) : nullptr;
+}
+
+HostMetadataCache::Node* HostMetadataCache::FindLoadedParent(const std::string& host_path,
+                                                             std::string_view* name)
+{
+  const size_t separator = host_path.rfind('/');
+  if (separator == std::string::npos)
+    return nullptr;
+
+  Node* parent = FindNode(host_path.substr(0, separator), false);
+  if (!parent || parent->is_file || !parent->children_loaded)
+    return nullptr;
+
+  *name = std::string_view(host_path).substr(separator + 1);
+  return parent;
+}
+
+void HostMetadataCache::LoadChildren(Node& node, const std::string& host_path)
+{
+  const File::FSTEntry host_entry = File::ScanDirectoryTree(host_path, false);
+
+  node.children.clear();
+  node.children.reserve(host_entry.children.size());
+  for (const File::FSTEntry& host_child : host_entry.children)
+  {
+    Node& child = node.children.emplace_back();
+    child.name = host_child.virtualName;
+    child.is_file = !host_child.isDirectory;
+    child.size = child.is_file ? host_child.size : 0;
+  }
+  node.children_loaded = true;
+}
+
+std::optional<HostMetadataCache::EntryInfo>
+HostMetadataCache::GetInfo(const std::string& host_path)
+{
+  std::string_view relative_path;
+  Root* root = FindRoot(host_path, &relative_path);
+  if (!root)
+  {
+    const File::FileInfo info{host_path};
+    if (!info.Exists())
+      return std::nullopt;
+    return EntryInfo{info.IsFile(), info.IsFile() ? info.GetSize() : 0};
+  }
+
+  const Node* node = FindNode(*root, relative_path, true);
+  if (!node)
+    return std::nullopt;
+  return EntryInfo{node->is_file, node->size};
+}
+
+std::optional<std::vector<std::string>>
+HostMetadataCache::ReadDirectory(const std::string& host_path)
+{
+  std::vector<std::string> names;
+
+  std::string_view relative_path;
+  Root* root = FindRoot(host_path, &relative_path);
+  if (!root)
+  {
+    if (!File::IsDirectory(host_path))
+      return std::nullopt;
+    for (const File::FSTEntry& child : File::ScanDirectoryTree(host_path, false).children)
+      names.push_back(child.virtualName);
+    return names;
+  }
+
+  Node* node = FindNode(*root, relative_path, true);
+  if (!node || node->is_file)
+    return std::nullopt;
+  if (!node->children_loaded)
+    LoadChildren(*node, host_path);
+
+  names.reserve(node->children.size());
+  for (const Node& child : node->children)
+    names.push_back(child.name);
+  return names;
+}
+
+HostMetadataCache::DirectoryUsage HostMetadataCache::ComputeUsage(Node& node,
+                                                                  const std::string& host_path)
+{
+  if (!node.children_loaded)
+    LoadChildren(node, host_path);
+
+  DirectoryUsage usage;
+  for (Node& child : node.children)
+  {
+    ++usage.entry_count;
+    if (child.is_file)
+    {
+      usage.file_size += child.size;
+    }
+    else
+    {
+      const DirectoryUsage child_usage = ComputeUsage(child, host_path + '/' + child.name);
+      usage.entry_count += child_usage.entry_count;
+      usage.file_size += child_usage.file_size;
+    }
+  }
+  return usage;
+}
+
+std::optional<HostMetadataCache::DirectoryUsage>
+HostMetadataCache::GetDirectoryUsage(const std::string& host_path)
+{
+  std::string_view relative_path;
+  Root* root = FindRoot(host_path, &relative_path);
+  if (!root)
+  {
+    if (!File::IsDirectory(host_path))
+      return std::nullopt;
+    const File::FSTEntry host_entry = File::ScanDirectoryTree(host_path, true);
+    return DirectoryUsage{host_entry.size, ComputeTotalFileSize(host_entry)};
+  }
+
+  Node* node = FindNode(*root, relative_path, true);
+  if (!node || node->is_file)
+    return std::nullopt;
+  return ComputeUsage(*node, host_path);
+}
+
+void HostMetadataCache::OnCreated(const std::string& host_path, bool is_file, u64 size)
+{
+  std::string_view name;
+  Node* parent = FindLoadedParent(host_path, &name);
+  if (!parent)
+    return;
+
+  const auto it = std::find_if(parent->children.begin(), parent->children.end(),
+                               GetNodeNamePredicate(name));
+  Node& node = it != parent->children.end() ? *it : parent->children.emplace_back();
+  node = {};
+  node.name = name;
+  node.is_file = is_file;
+  node.size = is_file ? size : 0;
+  // A new directory is known to be empty.
+  node.children_loaded = !is_file;
+}
+
+void HostMetadataCache::OnDeleted(const std::string& host_path)
+{
+  std::string_view name;
+  Node* parent = FindLoadedParent(host_path, &name);
+  if (!parent)
+    return;
+
+  const auto it = std::find_if(parent->children.begin(), parent->children.end(),
+                               GetNodeNamePredicate(name));
+  if (it != parent->children.end())
+    parent->children.erase(it);
+}
+
+void HostMetadataCache::OnRenamed(const std::string& old_host_path,
+                                  const std::string& new_host_path)
+{
+  std::optional<Node> node;
+
+  std::string_view old_name;
+  if (Node* old_parent = FindLoadedParent(old_host_path, &old_name))
+  {
+    const auto it = std::find_if(old_parent->children.begin(), old_parent->children.end(),
+                                 GetNodeNamePredicate(old_name));
+    if (it != old_parent->children.end())
+    {
+      node = std::move(*it);
+      old_parent->children.erase(it);
+    }
+  }
+
+  std::string_view new_name;
+  Node* new_parent = FindLoadedParent(new_host_path, &new_name);
+  if (!new_parent)
+    return;
+
+  const auto it = std::find_if(new_parent->children.begin(), new_parent->children.end(),
+                               GetNodeNamePredicate(new_name));
+  if (it != new_parent->children.end())
+    new_parent->children.erase(it);
+
+  if (node)
+  {
+    node->name = new_name;
+    new_parent->children.push_back(std::move(*node));
+  }
+  else
+  {
+    // Whatever was renamed wasn't known, so the new parent has to be scanned again.
+    new_parent->children.clear();
+    new_parent->children_loaded = false;
+  }
+}
+
+void HostMetadataCache::OnWritten(const std::string& host_path, u64 end_offset)
+{
+  Node* node = FindNode(host_path, false);
+  if (node && node->is_file)
+    node->size = std::max(node->size, end_offset);
+}
+}  // namespace IOS::HLE::FS
@@ -0,0 +1,89 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace IOS::HLE::FS
+{
+/// Cache of which host files and directories exist and how large the files are.
+///
+/// Listing or stat'ing host files is slow on some systems (for example on Windows with
+/// antivirus software installed), and the emulated software tends to do it a lot. So each host
+/// directory is only scanned the first time it is looked at, and the HostFileSystem reports every
+/// change it makes to the host file system instead.
+///
+/// Only paths under one of the roots are cached; anything else is always looked up on the host.
+class HostMetadataCache final
+{
+public:
+  struct EntryInfo
+  {
+    bool is_file = false;
+    /// Only valid for files.
+    u64 size = 0;
+  };
+
+  struct DirectoryUsage
+  {
+    /// Number of files and directories in the directory, recursively.
+    u64 entry_count = 0;
+    /// Total size of the files in the directory, recursively.
+    u64 file_size = 0;
+  };
+
+  /// Also forgets everything that has been cached.
+  void SetRoots(const std::vector<std::string>& root_paths);
+  void Clear();
+
+  std::optional<EntryInfo> GetInfo(const std::string& host_path);
+  /// Returns the host names of the files and directories in a directory.
+  std::optional<std::vector<std::string>> ReadDirectory(const std::string& host_path);
+  std::optional<DirectoryUsage> GetDirectoryUsage(const std::string& host_path);
+
+  void OnCreated(const std::string& host_path, bool is_file, u64 size = 0);
+  void OnDeleted(const std::string& host_path);
+  void OnRenamed(const std::string& old_host_path, const std::string& new_host_path);
+  /// Should be called after writing a file up to end_offset.
+  void OnWritten(const std::string& host_path, u64 end_offset);
+
+private:
+  struct Node
+  {
+    std::string name;
+    bool is_file = false;
+    u64 size = 0;
+    /// Whether children has been filled in by scanning the directory. Only valid for directories.
+    bool children_loaded = false;
+    std::vector<Node> children;
+  };
+
+  struct Root
+  {
+    std::string path;
+    /// Whether node has been filled in by looking the root up. This only happens once the root
+    /// exists.
+    bool loaded = false;
+    Node node;
+  };
+
+  Root* FindRoot(std::string_view host_path, std::string_view* relative_path);
+  /// Returns nullptr if the path doesn't exist, or if load is false and finding out whether it
+  /// does would require scanning a host directory.
+  Node* FindNode(Root& root, std::string_view relative_path, bool load);
+  Node* FindNode(const std::string& host_path, bool load);
+  /// Returns the parent directory of host_path if its children are known, and sets name to the
+  /// last component of host_path.
+  Node* FindLoadedParent(const std::string& host_path, std::string_view* name);
+  static void LoadChildren(Node& node, const std::string& host_path);
+  static DirectoryUsage ComputeUsage(Node& node, const std::string& host_path);
+
+  std::vector<Root> m_roots;
+};
+}  // namespace IOS::HLE::FS
@@ -519,7 +519,7 @@ void Kernel::InitIPC()
     return;
 
   INFO_LOG_FMT(IOS, "IPC initialised.");
-  GenerateAck(0);
+  Core::System::GetInstance().GetWiiIPC().GenerateAck(0);
 }
 
 void Kernel::AddDevice(std::unique_ptr<Device> device)
@@ -787,13 +787,14 @@ void Kernel::HandleIPCEvent(u64 userdata)
 
 void Kernel::UpdateIPC()
 {
-  if (m_ipc_paused || !IsReady())
+  auto& wii_ipc = Core::System::GetInstance().GetWiiIPC();
+  if (m_ipc_paused || !wii_ipc.IsReady())
     return;
 
   if (!m_request_queue.empty())
   {
-    ClearX1();
-    GenerateAck(m_request_queue.front());
+    wii_ipc.ClearX1();
+    wii_ipc.GenerateAck(m_request_queue.front());
     u32 command = m_request_queue.front();
     m_request_queue.pop_front();
     ExecuteIPCCommand(command);
@@ -802,7 +803,7 @@ void Kernel::UpdateIPC()
 
   if (!m_reply_queue.empty())
   {
-    GenerateReply(m_reply_queue.front());
+    wii_ipc.GenerateReply(m_reply_queue.front());
     DEBUG_LOG_FMT(IOS, "<<-- Reply to IPC Request @ {:#010x}", m_reply_queue.front());
     m_reply_queue.pop_front();
     return;
@@ -939,6 +940,9 @@ void Init()
   DIDevice::s_finish_executing_di_command =
       core_timing.RegisterEvent("FinishDICommand", DIDevice::FinishDICommandCallback);
 
+  WiiSockMan::s_event_sockets_ready =
+      core_timing.RegisterEvent("IOSNetSocketsReady", WiiSockMan::SocketsReadyCallback);
+
   // Start with IOS80 to simulate part of the Wii boot process.
   s_ios = std::make_unique<EmulationKernel>(Titles::SYSTEM_MENU_IOS);
   // On a Wii, boot2 launches the system menu IOS, which then launches the system menu
@@ -951,6 +955,8 @@ void Init()
 
 void Shutdown()
 {
+  // Stop waiting on host sockets, whose readiness would otherwise schedule events.
+  WiiSockMan::GetInstance().Clean();
   s_ios.reset();
   ESDevice::FinalizeEmulationState();
 }
@@ -54,6 +54,8 @@ class Ticks
 public:
   Ticks(u64* ticks = nullptr) : m_ticks(ticks) {}
 
+  bool IsCounting() const { return m_ticks != nullptr; }
+
   void Add(u64 ticks)
   {
     if (m_ticks != nullptr)
@@ -3,8 +3,10 @@
 
 #include "Core/IOS/Network/SSL.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -15,6 +17,7 @@
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/HW/Memmap.h"
@@ -80,6 +83,97 @@ int SSLRecv(void* ctx, unsigned char* buf, size_t len)
 
   return ret;
 }
+
+constexpr size_t MAX_CACHED_SESSIONS = 16;
+
+// Sessions of completed handshakes, by hostname. Games tend to connect to the same servers over
+// and over, and resuming a session skips the certificate exchange and key agreement.
+class SSLSessionCache
+{
+public:
+  ~SSLSessionCache() { Clear(); }
+
+  void Clear()
+  {
+    for (Entry& entry : m_entries)
+      mbedtls_ssl_session_free(&entry.session);
+    m_entries.clear();
+  }
+
+  void Restore(const std::string& hostname, mbedtls_ssl_context* ctx)
+  {
+    const auto it = Find(hostname);
+    if (it != m_entries.end() && mbedtls_ssl_set_session(ctx, &it->session) == 0)
+      INFO_LOG_FMT(IOS_SSL, "Resuming SSL session for {}", hostname);
+  }
+
+  void Save(const std::string& hostname, const mbedtls_ssl_context* ctx)
+  {
+    if (hostname.empty())
+      return;
+
+    const auto it = Find(hostname);
+    if (it != m_entries.end())
+    {
+      mbedtls_ssl_session_free(&it->session);
+      m_entries.erase(it);
+    }
+    else if (m_entries.size() >= MAX_CACHED_SESSIONS)
+    {
+      mbedtls_ssl_session_free(&m_entries.front().session);
+      m_entries.pop_front();
+    }
+
+    Entry& entry = m_entries.emplace_back();
+    entry.hostname = hostname;
+    mbedtls_ssl_session_init(&entry.session);
+    if (mbedtls_ssl_get_session(ctx, &entry.session) != 0)
+    {
+      mbedtls_ssl_session_free(&entry.session);
+      m_entries.pop_back();
+    }
+  }
+
+private:
+  struct Entry
+  {
+    std::string hostname;
+    mbedtls_ssl_session session;
+  };
+
+  std::deque<Entry>::iterator Find(const std::string& hostname)
+  {
+    return std::find_if(m_entries.begin(), m_entries.end(),
+                        [&hostname](const Entry& entry) { return entry.hostname == hostname; });
+  }
+
+  // Oldest first.
+  std::deque<Entry> m_entries;
+};
+
+SSLSessionCache s_session_cache;
+Common::WorkQueueThread<WII_SSL*> s_handshake_thread;
+
+void RunHandshakeStep(WII_SSL* ssl)
+{
+  const int result = mbedtls_ssl_handshake(&ssl->ctx);
+  {
+    std::lock_guard lock(ssl->handshake_mutex);
+    ssl->handshake_result = result;
+    ssl->handshake_state = SSLHandshakeState::Done;
+  }
+  ssl->handshake_done.notify_all();
+  WiiSockMan::GetInstance().NotifyWorkDone();
+}
+
+// Must be called before the context of an instance is freed.
+void WaitForHandshake(WII_SSL* ssl)
+{
+  std::unique_lock lock(ssl->handshake_mutex);
+  ssl->handshake_done.wait(
+      lock, [ssl] { return ssl->handshake_state != SSLHandshakeState::Running; });
+  ssl->handshake_state = SSLHandshakeState::Idle;
+}
 }  // namespace
 
 NetSSLDevice::NetSSLDevice(Kernel& ios, const std::string& device_name) : Device(ios, device_name)
@@ -88,6 +182,7 @@ NetSSLDevice::NetSSLDevice(Kernel& ios, const std::string& device_name) : Device
   {
     ssl.active = false;
   }
+  s_handshake_thread.Reset(RunHandshakeStep);
 }
 
 NetSSLDevice::~NetSSLDevice()
@@ -97,6 +192,7 @@ NetSSLDevice::~NetSSLDevice()
   {
     if (ssl.active)
     {
+      WaitForHandshake(&ssl);
       mbedtls_ssl_close_notify(&ssl.ctx);
 
       mbedtls_x509_crt_free(&ssl.cacert);
@@ -113,6 +209,7 @@ NetSSLDevice::~NetSSLDevice()
       ssl.active = false;
     }
   }
+  s_handshake_thread.Shutdown();
 }
 
 int NetSSLDevice::GetSSLFreeID() const
@@ -127,6 +224,28 @@ int NetSSLDevice::GetSSLFreeID() const
   return 0;
 }
 
+std::optional<int> NetSSLDevice::StepHandshake(int ssl_id)
+{
+  WII_SSL* ssl = &_SSL[ssl_id];
+  switch (ssl->handshake_state)
+  {
+  case SSLHandshakeState::Idle:
+    ssl->handshake_state = SSLHandshakeState::Running;
+    s_handshake_thread.EmplaceItem(ssl);
+    return std::nullopt;
+  case SSLHandshakeState::Running:
+    return std::nullopt;
+  case SSLHandshakeState::Done:
+    break;
+  }
+
+  ssl->handshake_state = SSLHandshakeState::Idle;
+  const int result = ssl->handshake_result;
+  if (result == 0)
+    s_session_cache.Save(ssl->hostname, &ssl->ctx);
+  return result;
+}
+
 std::optional<IPCReply> NetSSLDevice::IOCtl(const IOCtlRequest& request)
 {
   request.Log(GetDeviceName(), Common::Log::LogType::IOS_SSL, Common::Log::LogLevel::LINFO);
@@ -299,6 +418,7 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     {
       WII_SSL* ssl = &_SSL[sslID];
 
+      WaitForHandshake(ssl);
       mbedtls_ssl_close_notify(&ssl->ctx);
 
       mbedtls_x509_crt_free(&ssl->cacert);
@@ -494,6 +614,7 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
       ssl->hostfd = sm.GetHostSocket(ssl->sockfd);
       INFO_LOG_FMT(IOS_SSL, "IOCTLV_NET_SSL_CONNECT socket = {}", ssl->sockfd);
       mbedtls_ssl_set_bio(&ssl->ctx, ssl, SSLSendWithoutSNI, SSLRecv, nullptr);
+      s_session_cache.Restore(ssl->hostname, &ssl->ctx);
       WriteReturnValue(SSL_OK, BufferIn);
     }
     else
@@ -13,6 +13,10 @@
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl.h>
 #include <mbedtls/x509_crt.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
 #include <string>
 
 // clang-format on
@@ -63,6 +67,13 @@ enum SSL_IOCTL
   IOCTLV_NET_SSL_DEBUGGETTIME = 0x15,
 };
 
+enum class SSLHandshakeState
+{
+  Idle,
+  Running,
+  Done,
+};
+
 struct WII_SSL
 {
   mbedtls_ssl_context ctx{};
@@ -77,6 +88,13 @@ struct WII_SSL
   int hostfd = -1;
   std::string hostname;
   bool active = false;
+
+  // Handshake steps run on the handshake thread, as verifying certificates and exchanging keys can
+  // take long enough to stall emulation. The context must not be touched while one is running.
+  std::atomic<SSLHandshakeState> handshake_state{SSLHandshakeState::Idle};
+  int handshake_result = 0;
+  std::mutex handshake_mutex;
+  std::condition_variable handshake_done;
 };
 
 class NetSSLDevice : public Device
@@ -91,6 +109,10 @@ public:
 
   int GetSSLFreeID() const;
 
+  // Starts a handshake step for the given instance if none is running, and returns the result of
+  // the previous step once it is done. Completion wakes up socket updates.
+  static std::optional<int> StepHandshake(int ssl_id);
+
   static WII_SSL _SSL[NET_SSL_MAXINSTANCES];
 
 private:
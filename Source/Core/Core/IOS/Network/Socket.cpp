@@ -39,6 +39,8 @@
 
 namespace IOS::HLE
 {
+CoreTiming::EventType* WiiSockMan::s_event_sockets_ready;
+
 // The following functions can return
 //  - EAGAIN / EWOULDBLOCK: send(to), recv(from), accept
 //  - EINPROGRESS: connect, bind
@@ -243,7 +245,7 @@ s32 WiiSocket::FCntl(u32 cmd, u32 arg)
   return ret;
 }
 
-void WiiSocket::Update(bool read, bool write, bool except)
+void WiiSocket::Update()
 {
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
@@ -404,8 +406,18 @@ void WiiSocket::Update(bool read, bool write, bool except)
               break;
             }
 
+            const std::optional<int> result = NetSSLDevice::StepHandshake(sslID);
+            if (!result)
+            {
+              // Still running on the handshake thread.
+              WriteReturnValue(SSL_ERR_RAGAIN, BufferIn);
+              if (!nonBlock)
+                ReturnValue = SSL_ERR_RAGAIN;
+              break;
+            }
+
             mbedtls_ssl_context* ctx = &NetSSLDevice::_SSL[sslID].ctx;
-            const int ret = mbedtls_ssl_handshake(ctx);
+            const int ret = *result;
             if (ret != 0)
             {
               char error_buffer[256] = "";
@@ -521,6 +533,7 @@ void WiiSocket::Update(bool read, bool write, bool except)
 
             if (ret >= 0)
             {
+              memory.MarkWritten(BufferIn2, ret);
               PowerPC::debug_interface.NetworkLogger()->LogSSLRead(memory.GetPointer(BufferIn2),
                                                                    ret, ssl->hostfd);
               // Return bytes read or SSL_ERR_ZERO if none
@@ -809,6 +822,51 @@ bool WiiSocket::IsTCP() const
          socket_type == SOCK_STREAM;
 }
 
+s16 WiiSocket::GetPendingEvents() const
+{
+  s16 events = 0;
+  for (const sockop& op : pending_sockops)
+  {
+    if (op.is_ssl)
+    {
+      switch (op.ssl_type)
+      {
+      case IOCTLV_NET_SSL_READ:
+        events |= POLLIN;
+        break;
+      case IOCTLV_NET_SSL_WRITE:
+        events |= POLLOUT;
+        break;
+      case IOCTLV_NET_SSL_DOHANDSHAKE:
+        // The handshake first waits for the connection to be established.
+        events |= connecting_state == ConnectingState::Connecting ? POLLOUT : POLLIN;
+        break;
+      default:
+        events |= POLLIN | POLLOUT;
+        break;
+      }
+    }
+    else
+    {
+      switch (op.net_type)
+      {
+      case IOCTL_SO_ACCEPT:
+      case IOCTLV_SO_RECVFROM:
+        events |= POLLIN;
+        break;
+      case IOCTL_SO_CONNECT:
+      case IOCTLV_SO_SENDTO:
+        events |= POLLOUT;
+        break;
+      default:
+        events |= POLLIN | POLLOUT;
+        break;
+      }
+    }
+  }
+  return events;
+}
+
 const WiiSocket::Timeout& WiiSocket::GetTimeout()
 {
   if (!timeout.has_value())
@@ -867,6 +925,9 @@ s32 WiiSockMan::AddSocket(s32 fd, bool is_rw)
     sock.SetWiiFd(wii_fd);
     PowerPC::debug_interface.NetworkLogger()->OnNewSocket(fd);
 
+    if (!m_watcher.IsRunning())
+      m_watcher.Start([this] { OnSocketsReady(); });
+
 #ifdef __APPLE__
     int opt_no_sigpipe = 1;
     if (setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &opt_no_sigpipe, sizeof(opt_no_sigpipe)) < 0)
@@ -944,25 +1005,41 @@ s32 WiiSockMan::DeleteSocket(s32 wii_fd)
 
 void WiiSockMan::Update()
 {
-  s32 nfds = 0;
-  fd_set read_fds, write_fds, except_fds;
-  struct timeval t = {0, 0};
-  FD_ZERO(&read_fds);
-  FD_ZERO(&write_fds);
-  FD_ZERO(&except_fds);
+  m_early_update_scheduled.Clear();
+  UpdateSockets();
+}
 
-  auto socket_iter = WiiSockets.begin();
-  auto end_socks = WiiSockets.end();
+void WiiSockMan::SocketsReadyCallback(Core::System& system, u64 userdata, s64 cycles_late)
+{
+  if (GetIOS())
+    GetInstance().UpdateSockets();
+}
 
-  while (socket_iter != end_socks)
+void WiiSockMan::NotifyWorkDone()
+{
+  m_work_done.Set();
+  OnSocketsReady();
+}
+
+void WiiSockMan::OnSocketsReady()
+{
+  // Called on the socket watcher's thread. Wake up IOS instead of waiting for its next update.
+  if (!Core::WantsDeterminism() && m_early_update_scheduled.TestAndSet())
   {
-    const WiiSocket& sock = socket_iter->second;
-    if (sock.IsValid())
+    Core::System::GetInstance().GetCoreTiming().ScheduleEvent(0, s_event_sockets_ready, 0,
+                                                              CoreTiming::FromThread::NON_CPU);
+  }
+}
+
+void WiiSockMan::UpdateSockets()
+{
+  bool has_pending_sockops = false;
+  auto socket_iter = WiiSockets.begin();
+  while (socket_iter != WiiSockets.end())
+  {
+    if (socket_iter->second.IsValid())
     {
-      FD_SET(sock.fd, &read_fds);
-      FD_SET(sock.fd, &write_fds);
-      FD_SET(sock.fd, &except_fds);
-      nfds = std::max(nfds, sock.fd + 1);
+      has_pending_sockops |= !socket_iter->second.pending_sockops.empty();
       ++socket_iter;
     }
     else
@@ -972,25 +1049,77 @@ void WiiSockMan::Update()
     }
   }
 
-  const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
+  if (!has_pending_sockops && pending_polls.empty())
+    return;
 
-  if (ret >= 0)
+  // Operations which would block are only retried once one of the sockets they wait on is ready
+  // or they may have timed out, rather than on every update. Without the watcher, they have to
+  // be retried every time.
+  const bool sockets_ready = m_watcher.TakeReady();
+  const bool work_done = m_work_done.TestAndClear();
+  if (m_watcher.IsRunning() && !m_has_new_work && !sockets_ready && !work_done &&
+      !HasExpiredTimeout())
+    return;
+  m_has_new_work = false;
+
+  for (auto& pair : WiiSockets)
+    pair.second.Update();
+  UpdatePollCommands();
+
+  WatchPendingSockets();
+}
+
+bool WiiSockMan::HasExpiredTimeout() const
+{
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::high_resolution_clock::now() - last_time)
+                           .count();
+  for (const PollCommand& pcmd : pending_polls)
   {
-    for (auto& pair : WiiSockets)
-    {
-      WiiSocket& sock = pair.second;
-      sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
-                  FD_ISSET(sock.fd, &except_fds) != 0);
-    }
+    // Negative timeouts never expire
+    if (pcmd.timeout >= 0 && pcmd.timeout <= elapsed)
+      return true;
   }
-  else
+
+  const auto now = std::chrono::steady_clock::now();
+  return std::any_of(WiiSockets.begin(), WiiSockets.end(), [now](const auto& pair) {
+    const WiiSocket& socket = pair.second;
+    return !socket.pending_sockops.empty() && socket.timeout && now > *socket.timeout;
+  });
+}
+
+void WiiSockMan::WatchPendingSockets()
+{
+  if (!m_watcher.IsRunning())
+    return;
+
+  std::vector<SocketWatcher::WatchedSocket> sockets;
+  for (const auto& pair : WiiSockets)
   {
-    for (auto& elem : WiiSockets)
+    const WiiSocket& socket = pair.second;
+    const s16 events = socket.GetPendingEvents();
+    if (events != 0)
+      sockets.push_back({socket.fd, events});
+  }
+
+  for (const PollCommand& pcmd : pending_polls)
+  {
+    for (const pollfd_t& pfd : pcmd.wii_fds)
     {
-      elem.second.Update(false, false, false);
+      // Errors and hangups are reported even without asking for any events.
+      const s32 fd = static_cast<s32>(pfd.fd);
+      if (fd >= 0)
+        sockets.push_back({fd, static_cast<s16>(pfd.events)});
     }
   }
-  UpdatePollCommands();
+
+  m_watcher.Watch(std::move(sockets));
+}
+
+void WiiSockMan::Clean()
+{
+  WiiSockets.clear();
+  m_watcher.Stop();
 }
 
 void WiiSockMan::UpdatePollCommands()
@@ -1154,11 +1283,16 @@ void WiiSockMan::DoState(PointerWrap& p)
     for (auto& wfd : pcmd.wii_fds)
       wfd.revents = (POLLHUP | POLLERR);
   }
+  m_has_new_work = true;
 }
 
 void WiiSockMan::AddPollCommand(const PollCommand& cmd)
 {
+  // The time polls have been waiting for is only tracked while there are any.
+  if (pending_polls.empty())
+    last_time = std::chrono::high_resolution_clock::now();
   pending_polls.push_back(cmd);
+  m_has_new_work = true;
 }
 
 void WiiSockMan::UpdateWantDeterminism(bool want)
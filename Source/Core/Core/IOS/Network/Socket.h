@@ -52,11 +52,18 @@ typedef struct pollfd pollfd_t;
 #include <utility>
 
 #include "Common/CommonTypes.h"
+#include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 #include "Core/HW/Memmap.h"
 #include "Core/IOS/IOS.h"
 #include "Core/IOS/Network/IP/Top.h"
 #include "Core/IOS/Network/SSL.h"
+#include "Core/IOS/Network/SocketWatcher.h"
+
+namespace Core
+{
+class System;
+}
 
 namespace IOS::HLE
 {
@@ -219,7 +226,9 @@ private:
 
   void DoSock(Request request, NET_IOCTL type);
   void DoSock(Request request, SSL_IOCTL type);
-  void Update(bool read, bool write, bool except);
+  void Update();
+  // Native poll events that the pending operations wait for.
+  s16 GetPendingEvents() const;
   void UpdateConnectingState(s32 connect_rv);
   ConnectingState GetConnectingState() const;
   bool IsValid() const { return fd >= 0; }
@@ -276,7 +285,7 @@ public:
   s32 DeleteSocket(s32 wii_fd);
   s32 GetLastNetError() const { return errno_last; }
   void SetLastNetError(s32 error) { errno_last = error; }
-  void Clean() { WiiSockets.clear(); }
+  void Clean();
   template <typename T>
   void DoSock(s32 sock, const Request& request, T type)
   {
@@ -290,10 +299,17 @@ public:
     else
     {
       socket_entry->second.DoSock(request, type);
+      m_has_new_work = true;
     }
   }
 
   void UpdateWantDeterminism(bool want);
+  // Called from other threads when work done for an operation on their behalf has completed, so
+  // that the operation gets retried.
+  void NotifyWorkDone();
+
+  static void SocketsReadyCallback(Core::System& system, u64 userdata, s64 cycles_late);
+  static CoreTiming::EventType* s_event_sockets_ready;
 
 private:
   WiiSockMan() = default;
@@ -302,12 +318,24 @@ private:
   WiiSockMan(WiiSockMan&&) = delete;
   WiiSockMan& operator=(WiiSockMan&&) = delete;
 
+  void UpdateSockets();
   void UpdatePollCommands();
+  bool HasExpiredTimeout() const;
+  void WatchPendingSockets();
+  void OnSocketsReady();
 
   std::unordered_map<s32, WiiSocket> WiiSockets;
   s32 errno_last = 0;
   std::vector<PollCommand> pending_polls;
   std::chrono::time_point<std::chrono::high_resolution_clock> last_time =
       std::chrono::high_resolution_clock::now();
+
+  SocketWatcher m_watcher;
+  // Whether operations were started since sockets were last watched.
+  bool m_has_new_work = false;
+  // Only one update is run early per IOS update, to bound how often sockets which are ready without
+  // their operations making progress get retried.
+  Common::Flag m_early_update_scheduled;
+  Common::Flag m_work_done;
 };
 }  // namespace IOS::HLE
@@ -0,0 +1,163 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/Network/SocketWatcher.h"
+
+#include <algorithm>
+#include <utility>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Core/IOS/Network/Socket.h"
+
+#ifndef _WIN32
+#define closesocket close
+#endif
+
+namespace IOS::HLE
+{
+static s32 CreateWakeSocket()
+{
+  const s32 fd = static_cast<s32>(socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP));
+  if (fd < 0)
+    return -1;
+
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  socklen_t address_size = sizeof(address);
+  if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+      getsockname(fd, reinterpret_cast<sockaddr*>(&address), &address_size) != 0 ||
+      connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+  {
+    closesocket(fd);
+    return -1;
+  }
+
+#ifdef _WIN32
+  u_long non_blocking = 1;
+  ioctlsocket(fd, FIONBIO, &non_blocking);
+#else
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+#endif
+
+  return fd;
+}
+
+SocketWatcher::~SocketWatcher()
+{
+  Stop();
+}
+
+bool SocketWatcher::Start(std::function<void()> on_ready)
+{
+  if (IsRunning())
+    return true;
+
+  m_wake_fd = CreateWakeSocket();
+  if (m_wake_fd < 0)
+  {
+    ERROR_LOG_FMT(IOS_NET, "Failed to create the socket watcher's wake socket");
+    return false;
+  }
+
+  m_on_ready = std::move(on_ready);
+  m_ready.Clear();
+  m_sockets.clear();
+  m_running.Set();
+  m_thread = std::thread(&SocketWatcher::ThreadFunc, this);
+  return true;
+}
+
+void SocketWatcher::Stop()
+{
+  if (!m_running.TestAndClear())
+    return;
+
+  Wake();
+  m_thread.join();
+  closesocket(m_wake_fd);
+  m_wake_fd = -1;
+  m_on_ready = nullptr;
+}
+
+void SocketWatcher::Watch(std::vector<WatchedSocket> sockets)
+{
+  if (!IsRunning())
+    return;
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_sockets = std::move(sockets);
+    ++m_generation;
+  }
+  Wake();
+}
+
+void SocketWatcher::Wake()
+{
+  const char byte = 0;
+  send(m_wake_fd, &byte, 1, 0);
+}
+
+void SocketWatcher::ThreadFunc()
+{
+  Common::SetCurrentThreadName("IOS Socket Watcher");
+
+  std::vector<pollfd_t> fds;
+  while (m_running.IsSet())
+  {
+    u64 generation;
+    {
+      std::lock_guard lk(m_mutex);
+      fds.clear();
+      for (const WatchedSocket& socket : m_sockets)
+      {
+        pollfd_t& fd = fds.emplace_back();
+        fd.fd = socket.fd;
+        fd.events = socket.events;
+        fd.revents = 0;
+      }
+      generation = m_generation;
+    }
+    pollfd_t& wake_fd = fds.emplace_back();
+    wake_fd.fd = m_wake_fd;
+    wake_fd.events = POLLIN;
+    wake_fd.revents = 0;
+
+    if (poll(fds.data(), static_cast<u32>(fds.size()), -1) < 0)
+    {
+      // Most likely a socket was closed while being watched. The new set of sockets is on its way.
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      continue;
+    }
+
+    if (fds.back().revents != 0)
+    {
+      char buffer[64];
+      while (recv(m_wake_fd, buffer, sizeof(buffer), 0) > 0)
+      {
+      }
+    }
+
+    fds.pop_back();
+    if (std::none_of(fds.begin(), fds.end(), [](const pollfd_t& fd) { return fd.revents != 0; }))
+      continue;
+
+    {
+      std::lock_guard lk(m_mutex);
+      // Stop waiting on sockets which are ready until they are watched again, so that this thread
+      // doesn't spin while IOS gets around to handling them.
+      if (m_generation == generation)
+        m_sockets.clear();
+    }
+    m_ready.Set();
+    m_on_ready();
+  }
+}
+}  // namespace IOS::HLE
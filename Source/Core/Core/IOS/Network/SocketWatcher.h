@@ -0,0 +1,61 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Flag.h"
+
+namespace IOS::HLE
+{
+// Waits on a network thread for host sockets to become ready, so that operations which would
+// block don't have to be retried on every IOS update.
+class SocketWatcher final
+{
+public:
+  struct WatchedSocket
+  {
+    s32 fd;
+    // Native poll events.
+    s16 events;
+  };
+
+  SocketWatcher() = default;
+  ~SocketWatcher();
+  SocketWatcher(const SocketWatcher&) = delete;
+  SocketWatcher& operator=(const SocketWatcher&) = delete;
+
+  // on_ready is called on the network thread once one of the watched sockets is ready.
+  // Returns false if the watcher couldn't be started, in which case sockets have to be polled.
+  bool Start(std::function<void()> on_ready);
+  void Stop();
+  bool IsRunning() const { return m_running.IsSet(); }
+
+  // Replaces the sockets to wait for. Once any of them is ready, nothing is waited for until
+  // Watch is called again.
+  void Watch(std::vector<WatchedSocket> sockets);
+  // Returns whether a watched socket has become ready since the last call.
+  bool TakeReady() { return m_ready.TestAndClear(); }
+
+private:
+  void ThreadFunc();
+  void Wake();
+
+  std::thread m_thread;
+  Common::Flag m_running;
+  Common::Flag m_ready;
+  std::function<void()> m_on_ready;
+
+  std::mutex m_mutex;
+  std::vector<WatchedSocket> m_sockets;
+  u64 m_generation = 0;
+
+  // A UDP socket connected to itself, which interrupts the poll when written to.
+  s32 m_wake_fd = -1;
+};
+}  // namespace IOS::HLE
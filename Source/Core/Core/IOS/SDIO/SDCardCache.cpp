@@ -0,0 +1,247 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/SDIO/SDCardCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/Logging/Log.h"
+
+namespace IOS::HLE
+{
+SDCardCache::~SDCardCache()
+{
+  Close();
+}
+
+bool SDCardCache::Open(const std::string& filename)
+{
+  Close();
+
+  if (!m_file.Open(filename, "r+b"))
+    return false;
+
+  m_size = m_file.GetSize();
+  m_next_sequential_read = 0;
+  return true;
+}
+
+void SDCardCache::Close()
+{
+  if (!m_file.IsOpen())
+    return;
+
+  Flush();
+  m_blocks.clear();
+  m_dirty_count = 0;
+  m_file.Close();
+  m_size = 0;
+}
+
+bool SDCardCache::Read(u64 offset, u8* data, u64 size)
+{
+  if (!m_file.IsOpen() || offset > m_size || size > m_size - offset)
+    return false;
+
+  const bool sequential = offset == m_next_sequential_read;
+  m_next_sequential_read = offset + size;
+
+  while (size != 0)
+  {
+    const u64 index = offset / BLOCK_SIZE;
+    Block* block = FindBlock(index);
+    if (!block)
+    {
+      // Fetch the rest of this access in one go, and what is likely to be read next with it.
+      const u64 count = (offset + size - 1) / BLOCK_SIZE - index + 1;
+      if (!LoadBlocks(index, sequential ? count + READAHEAD_BLOCKS : count))
+        return false;
+      block = FindBlock(index);
+    }
+
+    const u64 block_offset = offset % BLOCK_SIZE;
+    const u64 length = std::min<u64>(size, block->data.size() - block_offset);
+    std::memcpy(data, block->data.data() + block_offset, length);
+
+    data += length;
+    offset += length;
+    size -= length;
+  }
+
+  return true;
+}
+
+bool SDCardCache::Write(u64 offset, const u8* data, u64 size)
+{
+  if (!m_file.IsOpen() || offset > m_size || size > m_size - offset)
+    return false;
+
+  while (size != 0)
+  {
+    const u64 index = offset / BLOCK_SIZE;
+    const u64 block_offset = offset % BLOCK_SIZE;
+    const u64 length = std::min(size, GetBlockSize(index) - block_offset);
+
+    Block* block = FindBlock(index);
+    if (!block)
+    {
+      // Blocks which are overwritten entirely don't need to be read first.
+      if (block_offset == 0 && length == GetBlockSize(index))
+        block = CreateBlock(index);
+      else if (LoadBlocks(index, 1))
+        block = FindBlock(index);
+      else
+        return false;
+    }
+
+    std::memcpy(block->data.data() + block_offset, data, length);
+    if (!block->dirty)
+    {
+      block->dirty = true;
+      ++m_dirty_count;
+    }
+
+    data += length;
+    offset += length;
+    size -= length;
+  }
+
+  if (m_dirty_count > MAX_DIRTY_BLOCKS)
+    return Flush();
+
+  return true;
+}
+
+bool SDCardCache::Flush()
+{
+  if (!m_file.IsOpen())
+    return false;
+
+  bool success = true;
+  for (auto it = m_blocks.begin(); it != m_blocks.end() && m_dirty_count != 0;)
+  {
+    if (!it->second.dirty)
+    {
+      ++it;
+      continue;
+    }
+
+    const u64 first_index = it->first;
+    u64 count = 0;
+    while (it != m_blocks.end() && it->first == first_index + count && it->second.dirty)
+    {
+      ++count;
+      ++it;
+    }
+
+    success &= WriteBack(first_index, count);
+  }
+
+  return m_file.Flush() && success;
+}
+
+SDCardCache::Block* SDCardCache::FindBlock(u64 index)
+{
+  const auto it = m_blocks.find(index);
+  if (it == m_blocks.end())
+    return nullptr;
+
+  it->second.last_use = ++m_use_counter;
+  return &it->second;
+}
+
+SDCardCache::Block* SDCardCache::CreateBlock(u64 index)
+{
+  if (m_blocks.size() >= MAX_CACHED_BLOCKS)
+    EvictBlock();
+
+  Block& block = m_blocks[index];
+  block.data.resize(GetBlockSize(index));
+  block.last_use = ++m_use_counter;
+  return &block;
+}
+
+bool SDCardCache::LoadBlocks(u64 first_index, u64 count)
+{
+  // Only load up to the next block which is already cached, as it may have pending writes.
+  const u64 block_count = (m_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  count = std::min({count, block_count - first_index, static_cast<u64>(MAX_CACHED_BLOCKS)});
+  const auto next_cached = m_blocks.lower_bound(first_index);
+  if (next_cached != m_blocks.end())
+    count = std::min(count, next_cached->first - first_index);
+
+  const u64 offset = first_index * BLOCK_SIZE;
+  const u64 size = std::min(count * BLOCK_SIZE, m_size - offset);
+  std::vector<u8> buffer(size);
+  if (!m_file.Seek(offset, File::SeekOrigin::Begin) || !m_file.ReadBytes(buffer.data(), size))
+  {
+    ERROR_LOG_FMT(IOS_SD, "Failed to read {} bytes from the SD card image at {:#x}", size, offset);
+    m_file.ClearError();
+    return false;
+  }
+
+  while (m_blocks.size() + count > MAX_CACHED_BLOCKS)
+    EvictBlock();
+
+  for (u64 i = 0; i < count; ++i)
+  {
+    Block& block = m_blocks[first_index + i];
+    const auto begin = buffer.begin() + i * BLOCK_SIZE;
+    block.data.assign(begin, begin + GetBlockSize(first_index + i));
+    block.last_use = ++m_use_counter;
+  }
+
+  return true;
+}
+
+bool SDCardCache::WriteBack(u64 first_index, u64 count)
+{
+  const u64 offset = first_index * BLOCK_SIZE;
+  bool success = m_file.Seek(offset, File::SeekOrigin::Begin);
+
+  // The blocks are adjacent in the image, so they are written without seeking in between.
+  for (u64 i = 0; i < count && success; ++i)
+  {
+    const Block& block = m_blocks.at(first_index + i);
+    success = m_file.WriteBytes(block.data.data(), block.data.size());
+  }
+
+  if (!success)
+  {
+    ERROR_LOG_FMT(IOS_SD, "Failed to write {} blocks to the SD card image at {:#x}", count, offset);
+    m_file.ClearError();
+    return false;
+  }
+
+  for (u64 i = 0; i < count; ++i)
+    m_blocks.at(first_index + i).dirty = false;
+  m_dirty_count -= count;
+  return true;
+}
+
+void SDCardCache::EvictBlock()
+{
+  auto oldest = m_blocks.begin();
+  for (auto it = m_blocks.begin(); it != m_blocks.end(); ++it)
+  {
+    if (it->second.last_use < oldest->second.last_use)
+      oldest = it;
+  }
+
+  if (oldest == m_blocks.end())
+    return;
+
+  if (oldest->second.dirty)
+  {
+    if (!WriteBack(oldest->first, 1))
+      --m_dirty_count;
+  }
+  m_blocks.erase(oldest);
+}
+
+u64 SDCardCache::GetBlockSize(u64 index) const
+{
+  return std::min(BLOCK_SIZE, m_size - index * BLOCK_SIZE);
+}
+}  // namespace IOS::HLE
@@ -0,0 +1,78 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+
+namespace IOS::HLE
+{
+// Accesses the SD card image through an in-memory cache of large blocks.
+//
+// Software reads and writes the card a few sectors at a time, which would otherwise turn into as
+// many seeks and small accesses of the host file. Reads which continue where the previous one
+// ended also fetch the blocks after them in the same host read. Writes stay in the cache until
+// they are flushed, and are then written back in runs of adjacent blocks. Flushing happens when
+// too much data is waiting to be written, when the image is closed, and when the device's state
+// is saved or loaded.
+class SDCardCache final
+{
+public:
+  static constexpr u64 BLOCK_SIZE = 0x10000;
+  static constexpr size_t MAX_CACHED_BLOCKS = 128;
+  static constexpr size_t MAX_DIRTY_BLOCKS = 32;
+  static constexpr size_t READAHEAD_BLOCKS = 8;
+
+  SDCardCache() = default;
+  ~SDCardCache();
+
+  SDCardCache(const SDCardCache&) = delete;
+  SDCardCache& operator=(const SDCardCache&) = delete;
+
+  bool Open(const std::string& filename);
+  // Writes back all pending writes before closing the image.
+  void Close();
+
+  bool IsOpen() const { return m_file.IsOpen(); }
+  explicit operator bool() const { return static_cast<bool>(m_file); }
+
+  u64 GetSize() const { return m_size; }
+
+  // Accesses outside of the image fail, as the size of a card can't change.
+  bool Read(u64 offset, u8* data, u64 size);
+  bool Write(u64 offset, const u8* data, u64 size);
+
+  bool Flush();
+
+private:
+  struct Block
+  {
+    std::vector<u8> data;
+    u64 last_use = 0;
+    bool dirty = false;
+  };
+
+  Block* FindBlock(u64 index);
+  Block* CreateBlock(u64 index);
+  bool LoadBlocks(u64 first_index, u64 count);
+  bool WriteBack(u64 first_index, u64 count);
+  void EvictBlock();
+
+  u64 GetBlockSize(u64 index) const;
+
+  File::IOFile m_file;
+  u64 m_size = 0;
+
+  // Ordered by index, so that dirty blocks can be written back in runs.
+  std::map<u64, Block> m_blocks;
+  size_t m_dirty_count = 0;
+  u64 m_use_counter = 0;
+  u64 m_next_sequential_read = 0;
+};
+}  // namespace IOS::HLE
@@ -9,9 +9,9 @@
 #include <string>
 
 #include "Common/CommonTypes.h"
-#include "Common/IOFile.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/IOS.h"
+#include "Core/IOS/SDIO/SDCardCache.h"
 
 class PointerWrap;
 
@@ -164,7 +164,7 @@ private:
 
   std::array<u32, 0x200 / sizeof(u32)> m_registers{};
 
-  File::IOFile m_card;
+  SDCardCache m_card;
 
   size_t m_config_callback_id;
   bool m_sd_card_inserted = false;
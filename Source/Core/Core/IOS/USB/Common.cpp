@@ -15,6 +15,12 @@
 
 namespace IOS::HLE::USB
 {
+BufferView TransferCommand::GetBuffer(const u32 size) const
+{
+  auto& system = Core::System::GetInstance();
+  return BufferView(system.GetMemory(), data_address, size);
+}
+
 std::unique_ptr<u8[]> TransferCommand::MakeBuffer(const size_t size) const
 {
   ASSERT_MSG(IOS_USB, data_address != 0, "Invalid data_address");
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Core/IOS/BufferView.h"
 #include "Core/IOS/Device.h"
 
 namespace IOS::HLE::USB
@@ -110,6 +111,8 @@ struct TransferCommand
   // This can be overridden for additional processing before replying.
   virtual void OnTransferComplete(s32 return_value) const;
   void ScheduleTransferCompletion(s32 return_value, u32 expected_time_us) const;
+  // Returns a view of the transfer buffer, for devices which can work on it in place.
+  BufferView GetBuffer(u32 size) const;
   std::unique_ptr<u8[]> MakeBuffer(size_t size) const;
   void FillBuffer(const u8* src, size_t size) const;
 
@@ -11,7 +11,6 @@
 #include "Common/StringUtil.h"
 #include "Common/Timer.h"
 #include "Core/Core.h"
-#include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
 namespace IOS::HLE::USB
@@ -146,13 +145,13 @@ int SkylanderUSB::SubmitTransfer(std::unique_ptr<CtrlMessage> cmd)
   {
     // Skylander Portal Requests
     auto& system = Core::System::GetInstance();
-    auto& memory = system.GetMemory();
-    u8* buf = memory.GetPointerForRange(cmd->data_address, cmd->length);
-    if (cmd->length == 0 || buf == nullptr)
+    const BufferView buffer = cmd->GetBuffer(cmd->length);
+    if (cmd->length == 0 || !buffer)
     {
       ERROR_LOG_FMT(IOS_USB, "Skylander command invalid");
       return IPC_EINVAL;
     }
+    const u8* const buf = buffer.GetPointer();
     // Data to be queued to be sent back via the Interrupt Transfer (if needed)
     std::array<u8, 64> interrupt_response = {};
 
@@ -438,13 +437,13 @@ int SkylanderUSB::SubmitTransfer(std::unique_ptr<IntrMessage> cmd)
                 m_active_interface, cmd->length, cmd->endpoint);
 
   auto& system = Core::System::GetInstance();
-  auto& memory = system.GetMemory();
-  u8* buf = memory.GetPointerForRange(cmd->data_address, cmd->length);
-  if (cmd->length == 0 || buf == nullptr)
+  const BufferView buffer = cmd->GetBuffer(cmd->length);
+  if (cmd->length == 0 || !buffer)
   {
     ERROR_LOG_FMT(IOS_USB, "Skylander command invalid");
     return IPC_EINVAL;
   }
+  const u8* const buf = buffer.GetPointer();
   std::array<u8, 64> interrupt_response = {};
   s32 expected_count;
   u64 expected_time_us;
@@ -4,6 +4,7 @@
 #include "Core/IOS/USB/Host.h"
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -17,6 +18,7 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
 #include "Core/Config/MainSettings.h"
@@ -225,13 +227,23 @@ void USBHost::ScanThread::Start()
   }
   if (m_thread_running.TestAndSet())
   {
+    // Only rescan when a device may have been plugged in or removed, or when the emulated devices
+    // or the passthrough whitelist may have changed. Systems on which libusb can't report hotplug
+    // events still have to be polled.
+    const auto on_devices_changed = [this] { m_devices_changed_event.Set(); };
+    m_hotplug_handle = m_host->m_context.RegisterHotplugCallback(on_devices_changed);
+    m_config_callback_id = Config::AddConfigChangedCallback(on_devices_changed);
+
     m_thread = std::thread([this] {
       Common::SetCurrentThreadName("USB Scan Thread");
       while (m_thread_running.IsSet())
       {
         if (m_host->UpdateDevices())
           m_first_scan_complete_event.Set();
-        Common::SleepCurrentThread(50);
+        if (m_hotplug_handle)
+          m_devices_changed_event.Wait();
+        else
+          m_devices_changed_event.WaitFor(std::chrono::milliseconds(50));
       }
     });
   }
@@ -240,8 +252,16 @@ void USBHost::ScanThread::Start()
 void USBHost::ScanThread::Stop()
 {
   if (m_thread_running.TestAndClear())
+  {
+    m_devices_changed_event.Set();
     m_thread.join();
 
+    Config::RemoveConfigChangedCallback(m_config_callback_id);
+    if (m_hotplug_handle)
+      m_host->m_context.DeregisterHotplugCallback(*m_hotplug_handle);
+    m_hotplug_handle.reset();
+  }
+
   // Clear all devices and dispatch removal hooks.
   DeviceChangeHooks hooks;
   m_host->DetectRemovedDevices(std::set<u64>(), hooks);
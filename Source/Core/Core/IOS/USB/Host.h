@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <string>
 #include <thread>
@@ -59,6 +60,10 @@ protected:
     Common::Flag m_thread_running;
     std::thread m_thread;
     Common::Event m_first_scan_complete_event;
+    // Set whenever devices may have been plugged in or removed, or the settings changed.
+    Common::Event m_devices_changed_event;
+    std::optional<int> m_hotplug_handle;
+    size_t m_config_callback_id = 0;
     Common::Flag m_is_initialized;
   };
 
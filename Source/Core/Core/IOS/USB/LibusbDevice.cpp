@@ -171,10 +171,15 @@ int LibusbDevice::CancelTransfer(const u8 endpoint)
 {
   INFO_LOG_FMT(IOS_USB, "[{:04x}:{:04x} {}] Cancelling transfers (endpoint {:#x})", m_vid, m_pid,
                m_active_interface, endpoint);
-  const auto iterator = m_transfer_endpoints.find(endpoint);
-  if (iterator == m_transfer_endpoints.cend())
-    return IPC_ENOENT;
-  iterator->second.CancelTransfers();
+  TransferEndpoint* transfer_endpoint;
+  {
+    std::lock_guard lk{m_transfer_endpoints_mutex};
+    const auto iterator = m_transfer_endpoints.find(endpoint);
+    if (iterator == m_transfer_endpoints.cend())
+      return IPC_ENOENT;
+    transfer_endpoint = &iterator->second;
+  }
+  transfer_endpoint->CancelTransfers();
   return IPC_SUCCESS;
 }
 
@@ -249,17 +254,31 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<CtrlMessage> cmd)
   libusb_fill_control_setup(buffer.get(), cmd->request_type, cmd->request, cmd->value, cmd->index,
                             cmd->length);
 
-  auto& system = Core::System::GetInstance();
-  auto& memory = system.GetMemory();
-  memory.CopyFromEmu(buffer.get() + LIBUSB_CONTROL_SETUP_SIZE, cmd->data_address, cmd->length);
+  // The data stage of device-to-host requests is only written by the device.
+  if ((cmd->request_type & LIBUSB_ENDPOINT_IN) == 0)
+  {
+    auto& system = Core::System::GetInstance();
+    auto& memory = system.GetMemory();
+    memory.CopyFromEmu(buffer.get() + LIBUSB_CONTROL_SETUP_SIZE, cmd->data_address, cmd->length);
+  }
 
   libusb_transfer* transfer = libusb_alloc_transfer(0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
   libusb_fill_control_transfer(transfer, m_handle, buffer.release(), CtrlTransferCallback, this, 0);
-  m_transfer_endpoints[0].AddTransfer(std::move(cmd), transfer);
+  GetTransferEndpoint(0).AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
 }
 
+// Buffers for transfers from the device are only written to by the device, so they don't need
+// to be filled with the contents of emulated memory.
+static std::unique_ptr<u8[]> MakeTransferBuffer(const TransferCommand& cmd, u8 endpoint,
+                                                size_t size)
+{
+  if (endpoint & LIBUSB_ENDPOINT_IN)
+    return std::make_unique_for_overwrite<u8[]>(size);
+  return cmd.MakeBuffer(size);
+}
+
 int LibusbDevice::SubmitTransfer(std::unique_ptr<BulkMessage> cmd)
 {
   if (!m_device_attached)
@@ -270,10 +289,10 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<BulkMessage> cmd)
 
   libusb_transfer* transfer = libusb_alloc_transfer(0);
   libusb_fill_bulk_transfer(transfer, m_handle, cmd->endpoint,
-                            cmd->MakeBuffer(cmd->length).release(), cmd->length, TransferCallback,
-                            this, 0);
+                            MakeTransferBuffer(*cmd, cmd->endpoint, cmd->length).release(),
+                            cmd->length, TransferCallback, this, 0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
+  GetTransferEndpoint(transfer->endpoint).AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
 }
 
@@ -287,10 +306,10 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IntrMessage> cmd)
 
   libusb_transfer* transfer = libusb_alloc_transfer(0);
   libusb_fill_interrupt_transfer(transfer, m_handle, cmd->endpoint,
-                                 cmd->MakeBuffer(cmd->length).release(), cmd->length,
-                                 TransferCallback, this, 0);
+                                 MakeTransferBuffer(*cmd, cmd->endpoint, cmd->length).release(),
+                                 cmd->length, TransferCallback, this, 0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
+  GetTransferEndpoint(transfer->endpoint).AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
 }
 
@@ -304,7 +323,7 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
                 m_vid, m_pid, m_active_interface, cmd->length, cmd->endpoint, cmd->num_packets);
 
   libusb_transfer* transfer = libusb_alloc_transfer(cmd->num_packets);
-  transfer->buffer = cmd->MakeBuffer(cmd->length).release();
+  transfer->buffer = MakeTransferBuffer(*cmd, cmd->endpoint, cmd->length).release();
   transfer->callback = TransferCallback;
   transfer->dev_handle = m_handle;
   transfer->endpoint = cmd->endpoint;
@@ -316,15 +335,16 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
   transfer->timeout = 0;
   transfer->type = LIBUSB_TRANSFER_TYPE_ISOCHRONOUS;
   transfer->user_data = this;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
+  GetTransferEndpoint(transfer->endpoint).AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
 }
 
 void LibusbDevice::CtrlTransferCallback(libusb_transfer* transfer)
 {
   auto* device = static_cast<LibusbDevice*>(transfer->user_data);
-  device->m_transfer_endpoints[0].HandleTransfer(transfer, [&](const auto& cmd) {
-    cmd.FillBuffer(libusb_control_transfer_get_data(transfer), transfer->actual_length);
+  device->GetTransferEndpoint(0).HandleTransfer(transfer, [&](const auto& cmd) {
+    if (libusb_control_transfer_get_setup(transfer)->bmRequestType & LIBUSB_ENDPOINT_IN)
+      cmd.FillBuffer(libusb_control_transfer_get_data(transfer), transfer->actual_length);
     // The return code is the total transfer length -- *including* the setup packet.
     return transfer->length;
   });
@@ -333,13 +353,16 @@ void LibusbDevice::CtrlTransferCallback(libusb_transfer* transfer)
 void LibusbDevice::TransferCallback(libusb_transfer* transfer)
 {
   auto* device = static_cast<LibusbDevice*>(transfer->user_data);
-  device->m_transfer_endpoints[transfer->endpoint].HandleTransfer(transfer, [&](const auto& cmd) {
+  device->GetTransferEndpoint(transfer->endpoint).HandleTransfer(transfer, [&](const auto& cmd) {
+    // Only data from the device has to be copied back to emulated memory.
+    const bool is_in = (transfer->endpoint & LIBUSB_ENDPOINT_IN) != 0;
     switch (transfer->type)
     {
     case LIBUSB_TRANSFER_TYPE_ISOCHRONOUS:
     {
       auto& iso_msg = static_cast<const IsoMessage&>(cmd);
-      cmd.FillBuffer(transfer->buffer, iso_msg.length);
+      if (is_in)
+        cmd.FillBuffer(transfer->buffer, iso_msg.length);
       for (size_t i = 0; i < iso_msg.num_packets; ++i)
         iso_msg.SetPacketReturnValue(i, transfer->iso_packet_desc[i].actual_length);
       // Note: isochronous transfers *must* return 0 as the return value. Anything else
@@ -347,7 +370,8 @@ void LibusbDevice::TransferCallback(libusb_transfer* transfer)
       return static_cast<s32>(IPC_SUCCESS);
     }
     default:
-      cmd.FillBuffer(transfer->buffer, transfer->actual_length);
+      if (is_in)
+        cmd.FillBuffer(transfer->buffer, transfer->actual_length);
       return static_cast<s32>(transfer->actual_length);
     }
   });
@@ -360,6 +384,12 @@ static const std::map<u8, const char*> s_transfer_types = {
     {LIBUSB_TRANSFER_TYPE_INTERRUPT, "Interrupt"},
 };
 
+LibusbDevice::TransferEndpoint& LibusbDevice::GetTransferEndpoint(u8 endpoint)
+{
+  std::lock_guard lk{m_transfer_endpoints_mutex};
+  return m_transfer_endpoints[endpoint];
+}
+
 void LibusbDevice::TransferEndpoint::AddTransfer(std::unique_ptr<TransferCommand> command,
                                                  libusb_transfer* transfer)
 {
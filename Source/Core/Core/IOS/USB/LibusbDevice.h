@@ -68,7 +68,11 @@ private:
     std::mutex m_transfers_mutex;
     std::map<libusb_transfer*, std::unique_ptr<TransferCommand>> m_transfers;
   };
+  // Transfers complete on the libusb event thread, so the map is guarded by a mutex. Its entries
+  // are never removed, which keeps references to them valid without holding the lock.
   std::map<u8, TransferEndpoint> m_transfer_endpoints;
+  std::mutex m_transfer_endpoints_mutex;
+  TransferEndpoint& GetTransferEndpoint(u8 endpoint);
   static void CtrlTransferCallback(libusb_transfer* transfer);
   static void TransferCallback(libusb_transfer* transfer);
 
@@ -517,6 +517,7 @@ std::optional<IPCReply> WFSIDevice::IOCtl(const IOCtlRequest& request)
     else
     {
       fp.ReadBytes(memory.GetPointer(dol_addr), max_dol_size);
+      memory.MarkWritten(dol_addr, max_dol_size);
     }
     memory.Write_U32(real_dol_size, request.buffer_out);
     break;
@@ -567,6 +568,7 @@ u32 WFSIDevice::GetTmd(u16 group_id, u32 title_id, u64 subtitle_id, u32 address,
     auto& system = Core::System::GetInstance();
     auto& memory = system.GetMemory();
     fp.ReadBytes(memory.GetPointer(address), fp.GetSize());
+    memory.MarkWritten(address, fp.GetSize());
   }
   *size = fp.GetSize();
   return IPC_SUCCESS;
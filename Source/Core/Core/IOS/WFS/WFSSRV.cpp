@@ -297,6 +297,7 @@ std::optional<IPCReply> WFSSRVDevice::IOCtl(const IOCtlRequest& request)
     }
     size_t read_bytes;
     fd_obj->file.ReadArray(memory.GetPointer(addr), size, &read_bytes);
+    memory.MarkWritten(addr, read_bytes);
     // TODO(wfs): Handle read errors.
     if (absolute)
     {
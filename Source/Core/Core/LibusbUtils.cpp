@@ -3,7 +3,9 @@
 
 #include "Core/LibusbUtils.h"
 
+#include <map>
 #include <mutex>
+#include <optional>
 #include <thread>
 
 #if defined(__LIBUSB__)
@@ -67,7 +69,47 @@ public:
     return LIBUSB_SUCCESS;
   }
 
+  std::optional<int> RegisterHotplugCallback(HotplugCallback callback)
+  {
+    if (!m_context || !libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG))
+      return std::nullopt;
+
+    // The callback is owned by m_hotplug_callbacks so that its address stays valid for libusb.
+    auto owned_callback = std::make_unique<HotplugCallback>(std::move(callback));
+    libusb_hotplug_callback_handle handle;
+    const int ret = libusb_hotplug_register_callback(
+        m_context, LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT,
+        LIBUSB_HOTPLUG_NO_FLAGS, LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY,
+        LIBUSB_HOTPLUG_MATCH_ANY, &Impl::OnHotplugEvent, owned_callback.get(), &handle);
+    if (ret != LIBUSB_SUCCESS)
+    {
+      WARN_LOG_FMT(IOS_USB, "Failed to register hotplug callback: {}", ErrorWrap(ret));
+      return std::nullopt;
+    }
+
+    std::lock_guard lock{m_hotplug_mutex};
+    m_hotplug_callbacks.emplace(handle, std::move(owned_callback));
+    return handle;
+  }
+
+  void DeregisterHotplugCallback(int handle)
+  {
+    // Once this returns, libusb won't call the callback anymore.
+    libusb_hotplug_deregister_callback(m_context, handle);
+
+    std::lock_guard lock{m_hotplug_mutex};
+    m_hotplug_callbacks.erase(handle);
+  }
+
 private:
+  static int LIBUSB_CALL OnHotplugEvent(libusb_context*, libusb_device*, libusb_hotplug_event,
+                                        void* user_data)
+  {
+    (*static_cast<HotplugCallback*>(user_data))();
+    // Keep the callback registered.
+    return 0;
+  }
+
   void EventThread()
   {
     Common::SetCurrentThreadName("libusb thread");
@@ -82,6 +124,8 @@ private:
 
   libusb_context* m_context = nullptr;
   mutable std::mutex m_device_list_mutex;
+  std::mutex m_hotplug_mutex;
+  std::map<int, std::unique_ptr<HotplugCallback>> m_hotplug_callbacks;
   Common::Flag m_event_thread_running;
   std::thread m_event_thread;
 };
@@ -91,6 +135,8 @@ class Context::Impl
 public:
   libusb_context* GetContext() const { return nullptr; }
   int GetDeviceList(GetDeviceListCallback callback) const { return -1; }
+  std::optional<int> RegisterHotplugCallback(HotplugCallback callback) { return std::nullopt; }
+  void DeregisterHotplugCallback(int handle) {}
 };
 #endif
 
@@ -115,6 +161,16 @@ int Context::GetDeviceList(GetDeviceListCallback callback) const
   return m_impl->GetDeviceList(std::move(callback));
 }
 
+std::optional<int> Context::RegisterHotplugCallback(HotplugCallback callback)
+{
+  return m_impl->RegisterHotplugCallback(std::move(callback));
+}
+
+void Context::DeregisterHotplugCallback(int handle)
+{
+  m_impl->DeregisterHotplugCallback(handle);
+}
+
 std::pair<int, ConfigDescriptor> MakeConfigDescriptor(libusb_device* device, u8 config_num)
 {
 #if defined(__LIBUSB__)
@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "Common/CommonTypes.h"
@@ -21,6 +22,8 @@ using UniquePtr = std::unique_ptr<T, void (*)(T*)>;
 
 // Return false to stop iterating the device list.
 using GetDeviceListCallback = std::function<bool(libusb_device* device)>;
+// Called on the libusb event thread. Must not make any calls that require handling events.
+using HotplugCallback = std::function<void()>;
 
 class Context
 {
@@ -34,6 +37,12 @@ public:
   // Only valid if the context is valid.
   int GetDeviceList(GetDeviceListCallback callback) const;
 
+  // Registers a callback for whenever a device is plugged in or removed. Returns std::nullopt if
+  // hotplug events are not supported on this platform, in which case the device list has to be
+  // polled instead.
+  std::optional<int> RegisterHotplugCallback(HotplugCallback callback);
+  void DeregisterHotplugCallback(int handle);
+
 private:
   class Impl;
   std::unique_ptr<Impl> m_impl;
@@ -10,8 +10,10 @@
 #include <unistd.h>
 
 #include "Common/FileUtil.h"
+#include "Common/Swap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
 
 MemoryWatcher::MemoryWatcher()
 {
@@ -20,6 +22,7 @@ MemoryWatcher::MemoryWatcher()
     return;
   if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
     return;
+  m_sender.Reset([this](std::string message) { SendMessage(message); });
   m_running = true;
 }
 
@@ -29,6 +32,7 @@ MemoryWatcher::~MemoryWatcher()
     return;
 
   m_running = false;
+  m_sender.Shutdown();
   close(m_fd);
 }
 
@@ -43,19 +47,19 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   while (std::getline(locations, line))
     ParseLine(line);
 
-  return !m_values.empty();
+  return !m_addresses.empty();
 }
 
 void MemoryWatcher::ParseLine(const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  WatchedAddress& watched = m_addresses[line];
+  watched = WatchedAddress();
 
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    watched.offsets.push_back(offset);
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -67,13 +71,46 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const std::string& line)
+u8* MemoryWatcher::GetPagePointer(u32 address)
+{
+  // Reading host memory directly would skip the emulated dcache.
+  if (PowerPC::ppcState.m_enable_dcache)
+    return nullptr;
+
+  const u32 page = address & ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+  const auto it = m_page_pointers.find(page);
+  if (it != m_page_pointers.end())
+    return it->second;
+
+  return m_page_pointers.emplace(page, PowerPC::HostGetRAMPointer(page)).first->second;
+}
+
+std::optional<u32> MemoryWatcher::ReadU32(u32 address)
+{
+  const u32 offset_in_page = address & PowerPC::HW_PAGE_MASK;
+  if (offset_in_page + sizeof(u32) <= PowerPC::HW_PAGE_SIZE)
+  {
+    if (const u8* page = GetPagePointer(address))
+      return Common::swap32(page + offset_in_page);
+  }
+
+  const auto result = PowerPC::HostTryReadU32(address);
+  if (!result)
+    return std::nullopt;
+  return result->value;
+}
+
+u32 MemoryWatcher::ChasePointer(const std::vector<u32>& offsets)
 {
   u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (size_t i = 0; i < offsets.size(); ++i)
   {
-    value = PowerPC::HostRead_U32(value + offset);
-    if (!PowerPC::HostIsRAMAddress(value))
+    value = ReadU32(value + offsets[i]).value_or(0);
+
+    // There is nothing left to dereference after the last offset.
+    if (i + 1 == offsets.size())
+      break;
+    if (!GetPagePointer(value) && !PowerPC::HostIsRAMAddress(value))
       break;
   }
   return value;
@@ -84,16 +121,13 @@ std::string MemoryWatcher::ComposeMessages()
   std::ostringstream message_stream;
   message_stream << std::hex;
 
-  for (auto& entry : m_values)
+  for (auto& [address, watched] : m_addresses)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(address);
-    if (new_value != current_value)
+    const u32 new_value = ChasePointer(watched.offsets);
+    if (new_value != watched.value)
     {
       // Update the value
-      current_value = new_value;
+      watched.value = new_value;
       message_stream << address << '\n' << new_value << '\n';
     }
   }
@@ -101,12 +135,19 @@ std::string MemoryWatcher::ComposeMessages()
   return message_stream.str();
 }
 
+void MemoryWatcher::SendMessage(const std::string& message)
+{
+  sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
+         sizeof(m_addr));
+}
+
 void MemoryWatcher::Step()
 {
   if (!m_running)
     return;
 
+  m_page_pointers.clear();
   std::string message = ComposeMessages();
-  sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
-         sizeof(m_addr));
+  if (!message.empty())
+    m_sender.EmplaceItem(std::move(message));
 }
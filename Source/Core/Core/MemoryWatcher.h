@@ -4,11 +4,14 @@
 #pragma once
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 
 #include <map>
+#include <optional>
 #include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
+#include <unordered_map>
 #include <vector>
 
 // MemoryWatcher reads a file containing in-game memory addresses and outputs
@@ -19,6 +22,10 @@
 // "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
 // The output to the socket is two lines. The first is the address from the
 // input file, and the second is the new value in hex.
+//
+// All changes of one frame are sent as a single message, and nothing is sent
+// for frames in which no value changed. Messages are sent from a separate
+// thread so that a slow reader doesn't stall emulation.
 class MemoryWatcher final
 {
 public:
@@ -31,16 +38,30 @@ private:
   bool OpenSocket(const std::string& path);
 
   void ParseLine(const std::string& line);
-  u32 ChasePointer(const std::string& line);
+  u8* GetPagePointer(u32 address);
+  std::optional<u32> ReadU32(u32 address);
+  u32 ChasePointer(const std::vector<u32>& offsets);
   std::string ComposeMessages();
+  void SendMessage(const std::string& message);
+
+  struct WatchedAddress
+  {
+    // Offsets to follow
+    std::vector<u32> offsets;
+    u32 value = 0;
+  };
 
   bool m_running = false;
 
   int m_fd;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  // Address as stored in the file -> offsets and current value
+  std::map<std::string, WatchedAddress> m_addresses;
+
+  // Host pointers of the pages read during the current step, or nullptr for pages which aren't
+  // plain RAM. The MMU state may change between frames, so this is cleared on every step.
+  std::unordered_map<u32, u8*> m_page_pointers;
+
+  Common::WorkQueueThread<std::string> m_sender;
 };
@@ -0,0 +1,258 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/MetricsExporter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/FileUtil.h"
+#include "Common/Histogram.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Core/HW/DVD/DVDThread.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "VideoCommon/FrameTimeBreakdown.h"
+#include "VideoCommon/PerformanceMetrics.h"
+#include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/Statistics.h"
+
+namespace MetricsExporter
+{
+namespace
+{
+struct VideoMetrics
+{
+  int draw_calls = 0;
+  int prims = 0;
+  int textures_alive = 0;
+  size_t texture_memory = 0;
+  size_t texture_copy_memory = 0;
+  size_t texture_pool_memory = 0;
+  int pixel_shaders_alive = 0;
+  int vertex_shaders_alive = 0;
+  int pipelines_created = 0;
+  int uber_pipelines_created = 0;
+  size_t shader_compile_queue = 0;
+};
+
+std::thread s_thread;
+Common::Event s_stop_event;
+std::atomic<bool> s_running = false;
+
+std::mutex s_video_metrics_mutex;
+VideoMetrics s_video_metrics;
+
+void AppendMetric(std::string& out, std::string_view name, std::string_view type,
+                  std::string_view help, double value)
+{
+  fmt::format_to(std::back_inserter(out), "# HELP {0} {1}\n# TYPE {0} {2}\n{0} {3}\n", name, help,
+                 type, value);
+}
+
+void AppendLabeledMetric(std::string& out, std::string_view name, std::string_view type,
+                         std::string_view help, std::string_view label,
+                         std::initializer_list<std::pair<std::string_view, double>> values)
+{
+  fmt::format_to(std::back_inserter(out), "# HELP {0} {1}\n# TYPE {0} {2}\n", name, help, type);
+  for (const auto& [label_value, value] : values)
+  {
+    fmt::format_to(std::back_inserter(out), "{}{{{}=\"{}\"}} {}\n", name, label, label_value,
+                   value);
+  }
+}
+
+// Writes a histogram whose values were counted in microseconds, converted to seconds as
+// Prometheus expects.
+template <size_t NumBounds>
+void AppendHistogram(std::string& out, std::string_view name, std::string_view help,
+                     const Common::Histogram<NumBounds>& histogram)
+{
+  const auto snapshot = histogram.GetSnapshot();
+  const auto& bounds = histogram.GetUpperBounds();
+
+  fmt::format_to(std::back_inserter(out), "# HELP {0} {1}\n# TYPE {0} histogram\n", name, help);
+  u64 cumulative_count = 0;
+  for (size_t i = 0; i < NumBounds; ++i)
+  {
+    cumulative_count += snapshot.counts[i];
+    fmt::format_to(std::back_inserter(out), "{}_bucket{{le=\"{}\"}} {}\n", name,
+                   bounds[i] / 1000000.0, cumulative_count);
+  }
+  cumulative_count += snapshot.counts[NumBounds];
+  fmt::format_to(std::back_inserter(out), "{0}_bucket{{le=\"+Inf\"}} {1}\n{0}_sum {2}\n",
+                 name, cumulative_count, snapshot.sum / 1000000.0);
+  fmt::format_to(std::back_inserter(out), "{}_count {}\n", name, cumulative_count);
+}
+
+std::string FormatMetrics()
+{
+  VideoMetrics video;
+  {
+    std::lock_guard lock(s_video_metrics_mutex);
+    video = s_video_metrics;
+  }
+  const JitInterface::CacheStats jit = JitInterface::GetCacheStats();
+
+  std::string out;
+  AppendMetric(out, "dolphin_fps", "gauge", "Frames presented per second.",
+               g_perf_metrics.GetFPS());
+  AppendMetric(out, "dolphin_vps", "gauge", "VBlanks per second.", g_perf_metrics.GetVPS());
+  AppendMetric(out, "dolphin_emulation_speed_ratio", "gauge",
+               "Emulation speed relative to the real console.", g_perf_metrics.GetSpeed());
+  AppendHistogram(out, "dolphin_frame_time_seconds", "Time between presented frames.",
+                  g_perf_metrics.GetFrameTimeHistogram());
+  AppendHistogram(out, "dolphin_vblank_time_seconds", "Time between VBlanks.",
+                  g_perf_metrics.GetVBlankTimeHistogram());
+
+  const FrameTimeBreakdown::PhaseTimes phase_times = FrameTimeBreakdown::GetTotals();
+  out += "# HELP dolphin_frame_phase_seconds_total Time of the emulation threads spent in each "
+         "phase of the frames.\n# TYPE dolphin_frame_phase_seconds_total counter\n";
+  for (size_t i = 0; i < FrameTimeBreakdown::NUM_PHASES; ++i)
+  {
+    fmt::format_to(std::back_inserter(out),
+                   "dolphin_frame_phase_seconds_total{{phase=\"{}\"}} {}\n",
+                   FrameTimeBreakdown::GetPhaseLabel(static_cast<FrameTimeBreakdown::Phase>(i)),
+                   phase_times[i] / 1000000000.0);
+  }
+
+  AppendMetric(out, "dolphin_jit_blocks", "gauge", "Blocks in the JIT cache.", jit.block_count);
+  AppendMetric(out, "dolphin_jit_average_block_bytes", "gauge",
+               "Average size of the near code of the blocks in the JIT cache.",
+               jit.block_count != 0 ? static_cast<double>(jit.code_bytes) / jit.block_count : 0.0);
+  AppendLabeledMetric(out, "dolphin_jit_code_bytes", "gauge",
+                      "Host code of the blocks in the JIT cache per code region, in bytes.",
+                      "region",
+                      {{"near", static_cast<double>(jit.code_bytes)},
+                       {"far", static_cast<double>(jit.far_code_bytes)},
+                       {"trampolines", static_cast<double>(jit.trampoline_bytes)}});
+  AppendLabeledMetric(out, "dolphin_jit_code_capacity_bytes", "gauge",
+                      "Size of each code region of the JIT, in bytes.", "region",
+                      {{"near", static_cast<double>(jit.code_capacity)},
+                       {"far", static_cast<double>(jit.far_code_capacity)},
+                       {"trampolines", static_cast<double>(jit.trampoline_capacity)}});
+  AppendMetric(out, "dolphin_jit_invalidations_total", "counter",
+               "Instruction cache invalidations which had to look for JIT blocks to destroy.",
+               static_cast<double>(jit.invalidations));
+  AppendMetric(out, "dolphin_jit_invalidated_blocks_total", "counter",
+               "JIT blocks destroyed by instruction cache invalidations.",
+               static_cast<double>(jit.invalidated_blocks));
+  AppendMetric(out, "dolphin_jit_evicted_generations_total", "counter",
+               "Times the oldest blocks were evicted to make room in the JIT code space.",
+               static_cast<double>(jit.evicted_generations));
+  AppendLabeledMetric(out, "dolphin_jit_cache_flushes_total", "counter",
+                      "Times the whole JIT cache was cleared, by cause.", "cause",
+                      {{"code_space_full", static_cast<double>(jit.code_space_full_flushes)},
+                       {"trampolines_full", static_cast<double>(jit.trampolines_full_flushes)},
+                       {"stack_fault", static_cast<double>(jit.stack_fault_flushes)},
+                       {"no_block_cache", static_cast<double>(jit.no_block_cache_flushes)},
+                       {"requested", static_cast<double>(jit.requested_flushes)}});
+
+  AppendMetric(out, "dolphin_draw_calls", "gauge", "Draw calls in the last frame.",
+               video.draw_calls);
+  AppendMetric(out, "dolphin_primitives", "gauge", "Primitives in the last frame.", video.prims);
+  AppendMetric(out, "dolphin_textures", "gauge", "Textures in the texture cache.",
+               video.textures_alive);
+  AppendMetric(out, "dolphin_texture_memory_bytes", "gauge",
+               "Video memory used by textures in the texture cache.",
+               static_cast<double>(video.texture_memory));
+  AppendMetric(out, "dolphin_texture_copy_memory_bytes", "gauge",
+               "Video memory used by EFB copies in the texture cache.",
+               static_cast<double>(video.texture_copy_memory));
+  AppendMetric(out, "dolphin_texture_pool_memory_bytes", "gauge",
+               "Video memory used by unused textures kept for reuse.",
+               static_cast<double>(video.texture_pool_memory));
+  AppendMetric(out, "dolphin_pixel_shaders", "gauge", "Pixel shaders alive.",
+               video.pixel_shaders_alive);
+  AppendMetric(out, "dolphin_vertex_shaders", "gauge", "Vertex shaders alive.",
+               video.vertex_shaders_alive);
+  AppendMetric(out, "dolphin_pipelines_created", "gauge",
+               "Specialized pipelines created since the shader cache was cleared.",
+               video.pipelines_created);
+  AppendMetric(out, "dolphin_uber_pipelines_created", "gauge",
+               "Ubershader pipelines created since the shader cache was cleared.",
+               video.uber_pipelines_created);
+  AppendMetric(out, "dolphin_shader_compile_queue", "gauge",
+               "Shaders and pipelines queued for or being compiled in the background.",
+               static_cast<double>(video.shader_compile_queue));
+
+  AppendHistogram(out, "dolphin_dvd_read_latency_seconds",
+                  "Real time taken to read the data of DVD commands from the disc image.",
+                  DVDThread::GetReadLatencyHistogram());
+  return out;
+}
+
+void WriteMetrics(const std::string& path)
+{
+  // Readers must never see a partially written file.
+  const std::string temp_path = path + ".tmp";
+  if (!File::WriteStringToFile(temp_path, FormatMetrics()) || !File::Rename(temp_path, path))
+    WARN_LOG_FMT(CORE, "Failed to write the metrics to {}", path);
+}
+
+void ExporterThread(std::string path, std::chrono::milliseconds interval)
+{
+  Common::SetCurrentThreadName("Metrics Exporter");
+
+  while (!s_stop_event.WaitFor(interval))
+    WriteMetrics(path);
+}
+}  // namespace
+
+void Start(const std::string& path, std::chrono::milliseconds interval)
+{
+  Stop();
+
+  {
+    std::lock_guard lock(s_video_metrics_mutex);
+    s_video_metrics = {};
+  }
+  s_running.store(true, std::memory_order_relaxed);
+
+  s_stop_event.Reset();
+  s_thread = std::thread(ExporterThread, path, std::max(interval, std::chrono::milliseconds(100)));
+}
+
+void Stop()
+{
+  if (!s_thread.joinable())
+    return;
+
+  s_running.store(false, std::memory_order_relaxed);
+  s_stop_event.Set();
+  s_thread.join();
+}
+
+void UpdateVideoMetrics()
+{
+  if (!s_running.load(std::memory_order_relaxed))
+    return;
+
+  VideoMetrics video;
+  video.draw_calls = g_stats.this_frame.num_draw_calls;
+  video.prims = g_stats.this_frame.num_prims + g_stats.this_frame.num_dl_prims;
+  video.textures_alive = g_stats.num_textures_alive;
+  video.texture_memory = g_stats.texture_memory;
+  video.texture_copy_memory = g_stats.texture_copy_memory;
+  video.texture_pool_memory = g_stats.texture_pool_memory;
+  video.pixel_shaders_alive = g_stats.num_pixel_shaders_alive;
+  video.vertex_shaders_alive = g_stats.num_vertex_shaders_alive;
+  video.pipelines_created = g_stats.num_pipelines_created;
+  video.uber_pipelines_created = g_stats.num_uber_pipelines_created;
+  video.shader_compile_queue = g_shader_cache->GetPendingAsyncCompileCount();
+
+  std::lock_guard lock(s_video_metrics_mutex);
+  s_video_metrics = video;
+}
+}  // namespace MetricsExporter
@@ -0,0 +1,22 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+// Periodically writes the performance metrics of the running emulation to a file, in the
+// Prometheus text exposition format. The file is replaced atomically, so it can be picked up by
+// the textfile collector of node_exporter or scraped by any other tool that reads it.
+namespace MetricsExporter
+{
+// Starts writing the metrics to path every interval. Must be called on the emulation thread,
+// after the video backend has been initialized.
+void Start(const std::string& path, std::chrono::milliseconds interval);
+void Stop();
+
+// Takes a snapshot of the per-frame video statistics. Called on the GPU thread at the end of the
+// frame, just before they are reset.
+void UpdateVideoMetrics();
+}  // namespace MetricsExporter
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
 #include <cstring>
 #include <iomanip>
@@ -32,6 +33,7 @@
 #include "Common/StringUtil.h"
 #include "Common/Timer.h"
 #include "Common/Version.h"
+#include "Common/WorkQueueThread.h"
 
 #include "Core/Boot/Boot.h"
 #include "Core/Config/MainSettings.h"
@@ -61,6 +63,7 @@
 
 #include "Core/IOS/USB/Bluetooth/BTEmu.h"
 #include "Core/IOS/USB/Bluetooth/WiimoteDevice.h"
+#include "Core/MovieInputLog.h"
 #include "Core/NetPlayProto.h"
 #include "Core/State.h"
 #include "Core/System.h"
@@ -73,9 +76,6 @@
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoConfig.h"
 
-// The chunk to allocate movie data in multiples of.
-#define DTM_BASE_LENGTH (1024)
-
 namespace Movie
 {
 using namespace WiimoteCommon;
@@ -96,7 +96,7 @@ static std::array<ControllerType, 4> s_controllers{};
 static std::array<bool, 4> s_wiimotes{};
 static ControllerState s_padState;
 static DTMHeader tmpHeader;
-static std::vector<u8> s_temp_input;
+static InputLog s_input_log;
 static u64 s_currentByte = 0;
 static u64 s_currentFrame = 0, s_totalFrames = 0;  // VI
 static u64 s_currentLagCount = 0;
@@ -125,10 +125,35 @@ static std::string s_InputDisplay[8];
 
 static std::string s_current_file_name;
 
+struct CheckpointCapture
+{
+  u32 generation;
+  u64 frame;
+  u64 position;
+  std::vector<u8> state;
+};
+
+static Common::WorkQueueThread<CheckpointCapture> s_checkpoint_thread;
+static std::atomic<bool> s_checkpoint_capture_queued;
+
+static FrameCallback s_frame_callback;
+
 static void GetSettings();
+// The last byte of the file type identifies the version of the format
+static u32 GetMovieVersion(const std::array<u8, 4>& magic)
+{
+  if (magic[0] != 'D' || magic[1] != 'T' || magic[2] != 'M')
+    return 0;
+  if (magic[3] == 0x1A)
+    return 1;
+  if (magic[3] == 0x1B)
+    return 2;
+  return 0;
+}
+
 static bool IsMovieHeader(const std::array<u8, 4>& magic)
 {
-  return magic[0] == 'D' && magic[1] == 'T' && magic[2] == 'M' && magic[3] == 0x1A;
+  return GetMovieVersion(magic) != 0;
 }
 
 static std::array<u8, 20> ConvertGitRevisionToBytes(const std::string& revision)
@@ -218,6 +243,39 @@ std::string GetRerecords()
   return "Rerecords: N/A";
 }
 
+// NOTE: CPU Thread
+static void QueueCheckpointCapture()
+{
+  // If the previous checkpoint still hasn't been stored, skip this one rather than piling up
+  // savestates in memory.
+  if (s_checkpoint_capture_queued.exchange(true))
+    return;
+
+  // This is called in the middle of a CoreTiming event, where the state can't be saved. Go through
+  // the host so that the CPU thread gets paused at a point where it can be.
+  Core::QueueHostJob([] {
+    if (!Core::IsRunning())
+    {
+      s_checkpoint_capture_queued = false;
+      return;
+    }
+
+    Core::RunOnCPUThread(
+        [] {
+          if (!IsRecordingInput())
+          {
+            s_checkpoint_capture_queued = false;
+            return;
+          }
+
+          CheckpointCapture capture{s_input_log.GetGeneration(), s_currentFrame, s_currentByte};
+          State::SaveToBuffer(capture.state);
+          s_checkpoint_thread.EmplaceItem(std::move(capture));
+        },
+        false);
+  });
+}
+
 void FrameUpdate()
 {
   s_currentFrame++;
@@ -228,9 +286,24 @@ void FrameUpdate()
   {
     s_totalFrames = s_currentFrame;
     s_totalLagCount = s_currentLagCount;
+
+    const u32 interval = Config::Get(Config::MAIN_MOVIE_CHECKPOINT_INTERVAL);
+    if (Config::Get(Config::MAIN_MOVIE_COMPACT_FORMAT) && interval != 0 &&
+        s_currentFrame % interval == 0)
+    {
+      QueueCheckpointCapture();
+    }
   }
 
   s_bPolled = false;
+
+  if (s_frame_callback)
+    s_frame_callback(s_currentFrame);
+}
+
+void SetFrameCallback(FrameCallback callback)
+{
+  s_frame_callback = std::move(callback);
 }
 
 static void CheckMD5();
@@ -274,6 +347,12 @@ void Init(const BootParameters& boot)
   for (auto& disp : s_InputDisplay)
     disp.clear();
 
+  s_checkpoint_capture_queued = false;
+  s_checkpoint_thread.Reset([](CheckpointCapture capture) {
+    s_input_log.AddCheckpoint(capture.generation, capture.frame, capture.position, capture.state);
+    s_checkpoint_capture_queued = false;
+  });
+
   if (!IsMovieActive())
   {
     s_bRecordingFromSaveState = false;
@@ -597,7 +676,7 @@ bool BeginRecordingInput(const ControllerTypeArray& controllers,
 
     s_playMode = PlayMode::Recording;
     s_author = Config::Get(Config::MAIN_MOVIE_MOVIE_AUTHOR);
-    s_temp_input.clear();
+    s_input_log.Clear();
 
     s_currentByte = 0;
 
@@ -879,6 +958,15 @@ void CheckPadStatus(const GCPadStatus* PadStatus, int controllerID)
   SetInputDisplayString(s_padState, controllerID);
 }
 
+// NOTE: CPU Thread
+static void WriteInput(const void* data, size_t size)
+{
+  // Recording continues from the current position, dropping whatever came after it
+  s_input_log.Truncate(s_currentByte);
+  s_input_log.Append(data, size);
+  s_currentByte += size;
+}
+
 // NOTE: CPU Thread
 void RecordInput(const GCPadStatus* PadStatus, int controllerID)
 {
@@ -887,9 +975,7 @@ void RecordInput(const GCPadStatus* PadStatus, int controllerID)
 
   CheckPadStatus(PadStatus, controllerID);
 
-  s_temp_input.resize(s_currentByte + sizeof(ControllerState));
-  memcpy(&s_temp_input[s_currentByte], &s_padState, sizeof(ControllerState));
-  s_currentByte += sizeof(ControllerState);
+  WriteInput(&s_padState, sizeof(ControllerState));
 }
 
 // NOTE: CPU Thread
@@ -908,10 +994,8 @@ void RecordWiimote(int wiimote, const u8* data, u8 size)
     return;
 
   InputUpdate();
-  s_temp_input.resize(s_currentByte + size + 1);
-  s_temp_input[s_currentByte++] = size;
-  memcpy(&s_temp_input[s_currentByte], data, size);
-  s_currentByte += size;
+  WriteInput(&size, sizeof(size));
+  WriteInput(data, size);
 }
 
 // NOTE: EmuThread / Host Thread
@@ -985,10 +1069,10 @@ bool PlayInput(const std::string& movie_path, std::optional<std::string>* savest
 
   Core::UpdateWantDeterminism();
 
-  s_temp_input.resize(recording_file.GetSize() - 256);
-  recording_file.ReadBytes(s_temp_input.data(), s_temp_input.size());
-  s_currentByte = 0;
   recording_file.Close();
+  if (!s_input_log.Load(movie_path, GetMovieVersion(tmpHeader.filetype)))
+    PanicAlertFmtT("Failed to read {0}", movie_path);
+  s_currentByte = 0;
 
   // Load savestate (and skip to frame data)
   if (tmpHeader.bFromSaveState && savestate_path)
@@ -1025,6 +1109,52 @@ void DoState(PointerWrap& p)
   // other variables (such as s_totalBytes and s_totalFrames) are set in LoadInput
 }
 
+// Returns the first position before end at which the input log differs from other
+static std::optional<u64> FindInputMismatch(InputLog& other, u64 end)
+{
+  std::vector<u8> ours(InputLog::BLOCK_SIZE);
+  std::vector<u8> theirs(InputLog::BLOCK_SIZE);
+  for (u64 position = 0; position < end; position += InputLog::BLOCK_SIZE)
+  {
+    const size_t length = static_cast<size_t>(std::min<u64>(InputLog::BLOCK_SIZE, end - position));
+    if (!s_input_log.Read(position, ours.data(), length) ||
+        !other.Read(position, theirs.data(), length))
+    {
+      return position;
+    }
+
+    const auto result = std::mismatch(ours.begin(), ours.begin() + length, theirs.begin());
+    if (result.first != ours.begin() + length)
+      return position + std::distance(ours.begin(), result.first);
+  }
+  return std::nullopt;
+}
+
+// Makes the input log from start to end identical to source, keeping whatever comes after end
+static void OverwriteInput(InputLog& source, u64 start, u64 end)
+{
+  std::vector<u8> rest;
+  const u64 size = s_input_log.GetSize();
+  if (size > end)
+  {
+    rest.resize(static_cast<size_t>(size - end));
+    s_input_log.Read(end, rest.data(), rest.size());
+  }
+
+  s_input_log.Truncate(start);
+
+  std::vector<u8> buffer(InputLog::BLOCK_SIZE);
+  for (u64 position = start; position < end; position += InputLog::BLOCK_SIZE)
+  {
+    const size_t length = static_cast<size_t>(std::min<u64>(InputLog::BLOCK_SIZE, end - position));
+    if (!source.Read(position, buffer.data(), length))
+      break;
+    s_input_log.Append(buffer.data(), length);
+  }
+
+  s_input_log.Append(rest.data(), rest.size());
+}
+
 // NOTE: Host Thread
 void LoadInput(const std::string& movie_path)
 {
@@ -1057,7 +1187,17 @@ void LoadInput(const std::string& movie_path)
   if (SConfig::GetInstance().bWii)
     ChangeWiiPads(true);
 
-  u64 totalSavedBytes = t_record.GetSize() - 256;
+  t_record.Close();
+
+  InputLog saved_log;
+  if (!saved_log.Load(movie_path, GetMovieVersion(tmpHeader.filetype)))
+  {
+    PanicAlertFmtT("Failed to read {0}", movie_path);
+    EndPlayInput(false);
+    return;
+  }
+
+  const u64 totalSavedBytes = saved_log.GetSize();
 
   bool afterEnd = false;
   // This can only happen if the user manually deletes data from the dtm.
@@ -1070,48 +1210,49 @@ void LoadInput(const std::string& movie_path)
     afterEnd = true;
   }
 
-  if (!s_bReadOnly || s_temp_input.empty())
+  if (!s_bReadOnly || s_input_log.IsEmpty())
   {
     s_totalFrames = tmpHeader.frameCount;
     s_totalLagCount = tmpHeader.lagCount;
     s_totalInputCount = tmpHeader.inputCount;
     s_totalTickCount = s_tickCountAtLastInput = tmpHeader.tickCount;
 
-    s_temp_input.resize(static_cast<size_t>(totalSavedBytes));
-    t_record.ReadBytes(s_temp_input.data(), s_temp_input.size());
+    // Only replace what differs, so that checkpoints from before that stay usable
+    const u64 common_size = std::min(s_input_log.GetSize(), totalSavedBytes);
+    const u64 mismatch = FindInputMismatch(saved_log, common_size).value_or(common_size);
+    s_input_log.Truncate(mismatch);
+    OverwriteInput(saved_log, mismatch, totalSavedBytes);
   }
   else if (s_currentByte > 0)
   {
     if (s_currentByte > totalSavedBytes)
     {
     }
-    else if (s_currentByte > s_temp_input.size())
+    else if (s_currentByte > s_input_log.GetSize())
     {
       afterEnd = true;
       PanicAlertFmtT(
           "Warning: You loaded a save that's after the end of the current movie. (byte {0} "
           "> {1}) (input {2} > {3}). You should load another save before continuing, or load "
           "this state with read-only mode off.",
-          s_currentByte + 256, s_temp_input.size() + 256, s_currentInputCount, s_totalInputCount);
+          s_currentByte + 256, s_input_log.GetSize() + 256, s_currentInputCount,
+          s_totalInputCount);
     }
-    else if (s_currentByte > 0 && !s_temp_input.empty())
+    else if (s_currentByte > 0 && !s_input_log.IsEmpty())
     {
       // verify identical from movie start to the save's current frame
-      std::vector<u8> movInput(s_currentByte);
-      t_record.ReadArray(movInput.data(), movInput.size());
-
-      const auto result = std::mismatch(movInput.begin(), movInput.end(), s_temp_input.begin());
+      const std::optional<u64> mismatch = FindInputMismatch(saved_log, s_currentByte);
 
-      if (result.first != movInput.end())
+      if (mismatch)
       {
-        const ptrdiff_t mismatch_index = std::distance(movInput.begin(), result.first);
+        const u64 mismatch_index = *mismatch;
 
         // this is a "you did something wrong" alert for the user's benefit.
         // we'll try to say what's going on in excruciating detail, otherwise the user might not
         // believe us.
         if (IsUsingWiimote(0))
         {
-          const size_t byte_offset = static_cast<size_t>(mismatch_index) + sizeof(DTMHeader);
+          const u64 byte_offset = mismatch_index + sizeof(DTMHeader);
 
           // TODO: more detail
           PanicAlertFmtT("Warning: You loaded a save whose movie mismatches on byte {0} ({1:#x}). "
@@ -1119,16 +1260,15 @@ void LoadInput(const std::string& movie_path)
                          "read-only mode off. Otherwise you'll probably get a desync.",
                          byte_offset, byte_offset);
 
-          std::copy(movInput.begin(), movInput.end(), s_temp_input.begin());
+          OverwriteInput(saved_log, mismatch_index, s_currentByte);
         }
         else
         {
-          const ptrdiff_t frame = mismatch_index / sizeof(ControllerState);
-          ControllerState curPadState;
-          memcpy(&curPadState, &s_temp_input[frame * sizeof(ControllerState)],
-                 sizeof(ControllerState));
-          ControllerState movPadState;
-          memcpy(&movPadState, &movInput[frame * sizeof(ControllerState)], sizeof(ControllerState));
+          const u64 frame = mismatch_index / sizeof(ControllerState);
+          ControllerState curPadState{};
+          s_input_log.Read(frame * sizeof(ControllerState), &curPadState, sizeof(ControllerState));
+          ControllerState movPadState{};
+          saved_log.Read(frame * sizeof(ControllerState), &movPadState, sizeof(ControllerState));
           PanicAlertFmtT(
               "Warning: You loaded a save whose movie mismatches on frame {0}. You should load "
               "another save before continuing, or load this state with read-only mode off. "
@@ -1159,7 +1299,6 @@ void LoadInput(const std::string& movie_path)
       }
     }
   }
-  t_record.Close();
 
   s_bSaveConfig = tmpHeader.bSaveConfig;
 
@@ -1193,7 +1332,7 @@ void LoadInput(const std::string& movie_path)
 // NOTE: CPU Thread
 static void CheckInputEnd()
 {
-  if (s_currentByte >= s_temp_input.size() ||
+  if (s_currentByte >= s_input_log.GetSize() ||
       (Core::System::GetInstance().GetCoreTiming().GetTicks() > s_totalTickCount &&
        !IsRecordingInputFromSaveState()))
   {
@@ -1206,18 +1345,17 @@ void PlayController(GCPadStatus* PadStatus, int controllerID)
 {
   // Correct playback is entirely dependent on the emulator polling the controllers
   // in the same order done during recording
-  if (!IsPlayingInput() || !IsUsingPad(controllerID) || s_temp_input.empty())
+  if (!IsPlayingInput() || !IsUsingPad(controllerID) || s_input_log.IsEmpty())
     return;
 
-  if (s_currentByte + sizeof(ControllerState) > s_temp_input.size())
+  if (!s_input_log.Read(s_currentByte, &s_padState, sizeof(ControllerState)))
   {
     PanicAlertFmtT("Premature movie end in PlayController. {0} + {1} > {2}", s_currentByte,
-                   sizeof(ControllerState), s_temp_input.size());
+                   sizeof(ControllerState), s_input_log.GetSize());
     EndPlayInput(!s_bReadOnly);
     return;
   }
 
-  memcpy(&s_padState, &s_temp_input[s_currentByte], sizeof(ControllerState));
   s_currentByte += sizeof(ControllerState);
 
   PadStatus->isConnected = s_padState.is_connected;
@@ -1295,19 +1433,19 @@ void PlayController(GCPadStatus* PadStatus, int controllerID)
 bool PlayWiimote(int wiimote, WiimoteCommon::DataReportBuilder& rpt, int ext,
                  const EncryptionKey& key)
 {
-  if (!IsPlayingInput() || !IsUsingWiimote(wiimote) || s_temp_input.empty())
+  if (!IsPlayingInput() || !IsUsingWiimote(wiimote) || s_input_log.IsEmpty())
     return false;
 
-  if (s_currentByte > s_temp_input.size())
+  u8 sizeInMovie;
+  if (!s_input_log.Read(s_currentByte, &sizeInMovie, sizeof(sizeInMovie)))
   {
     PanicAlertFmtT("Premature movie end in PlayWiimote. {0} > {1}", s_currentByte,
-                   s_temp_input.size());
+                   s_input_log.GetSize());
     EndPlayInput(!s_bReadOnly);
     return false;
   }
 
   const u8 size = rpt.GetDataSize();
-  const u8 sizeInMovie = s_temp_input[s_currentByte];
 
   if (size != sizeInMovie)
   {
@@ -1324,15 +1462,14 @@ bool PlayWiimote(int wiimote, WiimoteCommon::DataReportBuilder& rpt, int ext,
 
   s_currentByte++;
 
-  if (s_currentByte + size > s_temp_input.size())
+  if (!s_input_log.Read(s_currentByte, rpt.GetDataPtr(), size))
   {
     PanicAlertFmtT("Premature movie end in PlayWiimote. {0} + {1} > {2}", s_currentByte, size,
-                   s_temp_input.size());
+                   s_input_log.GetSize());
     EndPlayInput(!s_bReadOnly);
     return false;
   }
 
-  memcpy(rpt.GetDataPtr(), &s_temp_input[s_currentByte], size);
   s_currentByte += size;
 
   s_currentInputCount++;
@@ -1374,10 +1511,34 @@ void EndPlayInput(bool cont)
   }
 }
 
+// NOTE: Host Thread
+void JumpToCheckpoint(u64 frame)
+{
+  if (!IsMovieActive())
+    return;
+
+  std::vector<u8> state;
+  const std::optional<u64> checkpoint_frame = s_input_log.LoadCheckpoint(frame, &state);
+  if (!checkpoint_frame)
+  {
+    Core::DisplayMessage(fmt::format("The movie has no checkpoint at or before frame {}", frame),
+                         2000);
+    return;
+  }
+
+  // The checkpoint restores the position in the movie along with everything else
+  State::LoadFromBuffer(state);
+  if (!s_bReadOnly)
+    s_rerecords++;
+
+  Core::DisplayMessage(fmt::format("Jumped to checkpoint at frame {}", *checkpoint_frame), 2000);
+}
+
 // NOTE: Save State + Host Thread
-void SaveRecording(const std::string& filename)
+void SaveRecording(const std::string& filename, bool include_checkpoints)
 {
-  File::IOFile save_record(filename, "wb");
+  const u32 version = Config::Get(Config::MAIN_MOVIE_COMPACT_FORMAT) ? 2 : 1;
+
   // Create the real header now and write it
   DTMHeader header;
   memset(&header, 0, sizeof(DTMHeader));
@@ -1385,7 +1546,7 @@ void SaveRecording(const std::string& filename)
   header.filetype[0] = 'D';
   header.filetype[1] = 'T';
   header.filetype[2] = 'M';
-  header.filetype[3] = 0x1A;
+  header.filetype[3] = version == 2 ? 0x1B : 0x1A;
   strncpy(header.gameID.data(), SConfig::GetInstance().GetGameID().c_str(), 6);
   header.bWii = SConfig::GetInstance().bWii;
   header.controllers = 0;
@@ -1425,9 +1586,7 @@ void SaveRecording(const std::string& filename)
   header.uniqueID = 0;
   // header.audioEmulator;
 
-  save_record.WriteArray(&header, 1);
-
-  bool success = save_record.WriteBytes(s_temp_input.data(), s_temp_input.size());
+  bool success = s_input_log.Save(filename, header, version, include_checkpoints);
 
   if (success && s_bRecordingFromSaveState)
   {
@@ -1569,7 +1728,8 @@ static void GetMD5()
 // NOTE: EmuThread
 void Shutdown()
 {
+  s_checkpoint_thread.Shutdown();
   s_currentInputCount = s_totalInputCount = s_totalFrames = s_tickCountAtLastInput = 0;
-  s_temp_input.clear();
+  s_input_log.Clear();
 }
 }  // namespace Movie
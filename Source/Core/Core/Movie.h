@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstring>
+#include <functional>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -67,6 +68,7 @@ static_assert(sizeof(ControllerState) == 8, "ControllerState should be 8 bytes")
 
 // When making changes to the DTM format, keep in mind that there are programs other
 // than Dolphin that parse DTM files. The format is expected to be relatively stable.
+// Version 2 only changes how the input log after the header is stored (see InputLog).
 #pragma pack(push, 1)
 struct DTMHeader
 {
@@ -75,7 +77,7 @@ struct DTMHeader
     return {gameID.data(), strnlen(gameID.data(), gameID.size())};
   }
 
-  std::array<u8, 4> filetype;  // Unique Identifier (always "DTM"0x1A)
+  std::array<u8, 4> filetype;  // Unique Identifier ("DTM"0x1A, or "DTM"0x1B for version 2)
 
   std::array<char, 6> gameID;  // The Game ID
   bool bWii;                   // Wii game
@@ -137,6 +139,10 @@ static_assert(sizeof(DTMHeader) == 256, "DTMHeader should be 256 bytes");
 
 void FrameUpdate();
 void InputUpdate();
+// Called on the CPU thread by FrameUpdate with the number of the frame that just started, for
+// frontends which inspect the emulated state as a movie plays. Pass nullptr to remove it.
+using FrameCallback = std::function<void(u64 frame)>;
+void SetFrameCallback(FrameCallback callback);
 void Init(const BootParameters& boot);
 
 void SetPolledDevice();
@@ -188,7 +194,10 @@ void PlayController(GCPadStatus* PadStatus, int controllerID);
 bool PlayWiimote(int wiimote, WiimoteCommon::DataReportBuilder& rpt, int ext,
                  const WiimoteEmu::EncryptionKey& key);
 void EndPlayInput(bool cont);
-void SaveRecording(const std::string& filename);
+// Loads the newest savestate checkpoint of the movie which isn't after the given frame.
+void JumpToCheckpoint(u64 frame);
+// Checkpoints are only worth including in movies which are exported, not in those of savestates.
+void SaveRecording(const std::string& filename, bool include_checkpoints = false);
 void DoState(PointerWrap& p);
 void Shutdown();
 void CheckPadStatus(const GCPadStatus* PadStatus, int controllerID);
@@ -0,0 +1,619 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/MovieInputLog.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include <zstd.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Core/Movie.h"
+
+// Version 2 movies consist of the same header as version 1 movies, followed by chunks which each
+// start with a ChunkHeader. Input blocks must be in order and cover the log without gaps, while
+// checkpoints can be anywhere. Chunks of unknown types are skipped, so that new types can be added
+// without breaking older versions of Dolphin.
+
+namespace Movie
+{
+namespace
+{
+enum class ChunkType : u32
+{
+  InputBlock = 1,
+  Checkpoint = 2,
+};
+
+#pragma pack(push, 1)
+struct ChunkHeader
+{
+  ChunkType type;
+  u32 size;  // Size of the chunk, excluding this header
+};
+
+struct InputBlockHeader
+{
+  u64 start;  // Position of the block in the log
+  u32 size;   // Uncompressed size of the block
+};
+
+struct CheckpointHeader
+{
+  u64 frame;
+  u64 position;  // Position in the log that the savestate was captured at
+  u32 size;      // Uncompressed size of the savestate
+};
+#pragma pack(pop)
+
+// Input compresses so well that the default level is both fast and close to the best ratio.
+// Savestates are big, so checkpoints use the fastest level to not fall behind while recording.
+constexpr int BLOCK_COMPRESSION_LEVEL = ZSTD_CLEVEL_DEFAULT;
+constexpr int CHECKPOINT_COMPRESSION_LEVEL = 1;
+
+std::vector<u8> Compress(const u8* data, size_t size, int level)
+{
+  std::vector<u8> compressed(ZSTD_compressBound(size));
+  const size_t compressed_size =
+      ZSTD_compress(compressed.data(), compressed.size(), data, size, level);
+  if (ZSTD_isError(compressed_size))
+  {
+    PanicAlertFmtT("Internal Zstandard Error - compression failed");
+    return {};
+  }
+
+  compressed.resize(compressed_size);
+  return compressed;
+}
+
+bool Decompress(const std::vector<u8>& compressed, std::vector<u8>* data, size_t size)
+{
+  data->resize(size);
+  const size_t result = ZSTD_decompress(data->data(), size, compressed.data(), compressed.size());
+  return !ZSTD_isError(result) && result == size;
+}
+
+std::string GetSpoolFilePath()
+{
+  return File::GetUserPath(D_STATESAVES_IDX) + "dtm.checkpoints";
+}
+}  // namespace
+
+InputLog::InputLog() = default;
+
+InputLog::~InputLog()
+{
+  ClearLocked();
+}
+
+void InputLog::Clear()
+{
+  std::lock_guard lk(m_mutex);
+  ClearLocked();
+}
+
+void InputLog::ClearLocked()
+{
+  m_blocks.clear();
+  m_tail.clear();
+  m_checkpoints.clear();
+  ++m_generation;
+
+  m_file.Close();
+  m_file_path.clear();
+  if (m_spool_file.IsOpen())
+  {
+    m_spool_file.Close();
+    File::Delete(GetSpoolFilePath());
+  }
+
+  m_cached_block = SIZE_MAX;
+  m_cache.clear();
+  m_saved_path.clear();
+}
+
+bool InputLog::Load(const std::string& path, u32 version)
+{
+  std::lock_guard lk(m_mutex);
+  ClearLocked();
+
+  if (!m_file.Open(path, "rb"))
+    return false;
+  m_file_path = path;
+
+  const u64 file_size = m_file.GetSize();
+  if (file_size < sizeof(DTMHeader))
+  {
+    ClearLocked();
+    return false;
+  }
+
+  if (version >= 2)
+  {
+    if (!LoadVersion2(file_size))
+    {
+      ERROR_LOG_FMT(CORE, "Movie {} has a corrupted input log", path);
+      ClearLocked();
+      return false;
+    }
+
+    // The file already contains everything, so saving to it again can just append.
+    m_saved_path = path;
+    m_saved_file_size = file_size;
+    m_saved_chunks_end = file_size;
+    m_saved_block_count = m_blocks.size();
+    m_saved_checkpoint_count = m_checkpoints.size();
+    return true;
+  }
+
+  for (u64 start = 0; start < file_size - sizeof(DTMHeader); start += BLOCK_SIZE)
+  {
+    Block& block = m_blocks.emplace_back();
+    block.start = start;
+    block.size = static_cast<u32>(std::min<u64>(BLOCK_SIZE, file_size - sizeof(DTMHeader) - start));
+    block.in_file = true;
+    block.file_offset = sizeof(DTMHeader) + start;
+    block.file_size = block.size;
+  }
+  return true;
+}
+
+bool InputLog::LoadVersion2(u64 file_size)
+{
+  u64 offset = sizeof(DTMHeader);
+  u64 end = 0;
+  while (offset < file_size)
+  {
+    ChunkHeader chunk;
+    if (file_size - offset < sizeof(chunk) || !m_file.Seek(offset, File::SeekOrigin::Begin) ||
+        !m_file.ReadArray(&chunk, 1))
+    {
+      return false;
+    }
+
+    const u64 data_offset = offset + sizeof(chunk);
+    if (file_size - data_offset < chunk.size)
+      return false;
+
+    switch (chunk.type)
+    {
+    case ChunkType::InputBlock:
+    {
+      InputBlockHeader header;
+      if (chunk.size < sizeof(header) || !m_file.ReadArray(&header, 1) || header.start != end ||
+          header.size == 0 || header.size > BLOCK_SIZE)
+      {
+        return false;
+      }
+
+      Block& block = m_blocks.emplace_back();
+      block.start = header.start;
+      block.size = header.size;
+      block.in_file = true;
+      block.compressed_in_file = true;
+      block.file_offset = data_offset + sizeof(header);
+      block.file_size = chunk.size - sizeof(header);
+      end += header.size;
+      break;
+    }
+    case ChunkType::Checkpoint:
+    {
+      CheckpointHeader header;
+      if (chunk.size < sizeof(header) || !m_file.ReadArray(&header, 1))
+        return false;
+
+      m_checkpoints.push_back({header.frame, header.position, header.size, true,
+                               data_offset + sizeof(header),
+                               static_cast<u32>(chunk.size - sizeof(header))});
+      break;
+    }
+    default:
+      break;
+    }
+
+    offset = data_offset + chunk.size;
+  }
+
+  std::erase_if(m_checkpoints, [end](const Checkpoint& checkpoint) {
+    return checkpoint.position > end;
+  });
+  return true;
+}
+
+bool InputLog::Save(const std::string& path, const DTMHeader& header, u32 version,
+                    bool include_checkpoints)
+{
+  std::lock_guard lk(m_mutex);
+
+  File::IOFile file;
+  if (version < 2)
+  {
+    if (path == m_file_path)
+      DetachFromFile();
+
+    m_saved_path.clear();
+    return file.Open(path, "wb") && file.WriteArray(&header, 1) && WriteVersion1(file);
+  }
+
+  size_t first_block = 0;
+  size_t first_checkpoint = 0;
+  const bool append = path == m_saved_path && File::GetSize(path) == m_saved_file_size &&
+                      file.Open(path, "r+b") && file.Resize(m_saved_chunks_end) &&
+                      file.Seek(0, File::SeekOrigin::End);
+  if (append)
+  {
+    // Only the chunk holding the tail of the log is replaced.
+    first_block = m_saved_block_count;
+    first_checkpoint = m_saved_checkpoint_count;
+  }
+  else
+  {
+    file.Close();
+    if (path == m_file_path)
+      DetachFromFile();
+
+    m_saved_path.clear();
+    if (!file.Open(path, "wb") || !file.WriteArray(&header, 1))
+      return false;
+  }
+
+  if (!WriteChunks(file, first_block, first_checkpoint, include_checkpoints))
+  {
+    m_saved_path.clear();
+    return false;
+  }
+  m_saved_chunks_end = file.Tell();
+
+  if (!WriteTail(file) || !file.Seek(0, File::SeekOrigin::Begin) || !file.WriteArray(&header, 1) ||
+      !file.Flush())
+  {
+    m_saved_path.clear();
+    return false;
+  }
+
+  m_saved_path = path;
+  m_saved_file_size = file.GetSize();
+  m_saved_block_count = m_blocks.size();
+  if (include_checkpoints)
+    m_saved_checkpoint_count = m_checkpoints.size();
+  else if (!append)
+    m_saved_checkpoint_count = 0;
+  return true;
+}
+
+bool InputLog::WriteVersion1(File::IOFile& file)
+{
+  for (size_t i = 0; i < m_blocks.size(); ++i)
+  {
+    const std::vector<u8>* data = GetBlockData(i);
+    if (!data || !file.WriteBytes(data->data(), data->size()))
+      return false;
+  }
+  return file.WriteBytes(m_tail.data(), m_tail.size());
+}
+
+bool InputLog::WriteChunks(File::IOFile& file, size_t first_block, size_t first_checkpoint,
+                           bool include_checkpoints)
+{
+  std::vector<u8> stored;
+  for (size_t i = first_block; i < m_blocks.size(); ++i)
+  {
+    const Block& block = m_blocks[i];
+    const std::vector<u8>* compressed = &block.data;
+    if (block.in_file)
+    {
+      if (!ReadStoredBlock(block, &stored))
+        return false;
+      if (!block.compressed_in_file)
+        stored = Compress(stored.data(), stored.size(), BLOCK_COMPRESSION_LEVEL);
+      compressed = &stored;
+    }
+
+    const InputBlockHeader header{block.start, block.size};
+    const ChunkHeader chunk{ChunkType::InputBlock,
+                            static_cast<u32>(sizeof(header) + compressed->size())};
+    if (!file.WriteArray(&chunk, 1) || !file.WriteArray(&header, 1) ||
+        !file.WriteBytes(compressed->data(), compressed->size()))
+    {
+      return false;
+    }
+  }
+
+  if (!include_checkpoints)
+    return true;
+
+  for (size_t i = first_checkpoint; i < m_checkpoints.size(); ++i)
+  {
+    const Checkpoint& checkpoint = m_checkpoints[i];
+    if (!ReadStoredCheckpoint(checkpoint, &stored))
+      return false;
+
+    const CheckpointHeader header{checkpoint.frame, checkpoint.position, checkpoint.size};
+    const ChunkHeader chunk{ChunkType::Checkpoint,
+                            static_cast<u32>(sizeof(header) + stored.size())};
+    if (!file.WriteArray(&chunk, 1) || !file.WriteArray(&header, 1) ||
+        !file.WriteBytes(stored.data(), stored.size()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool InputLog::WriteTail(File::IOFile& file)
+{
+  if (m_tail.empty())
+    return true;
+
+  const std::vector<u8> compressed =
+      Compress(m_tail.data(), m_tail.size(), BLOCK_COMPRESSION_LEVEL);
+  const InputBlockHeader header{GetSizeLocked() - m_tail.size(), static_cast<u32>(m_tail.size())};
+  const ChunkHeader chunk{ChunkType::InputBlock,
+                          static_cast<u32>(sizeof(header) + compressed.size())};
+  return file.WriteArray(&chunk, 1) && file.WriteArray(&header, 1) &&
+         file.WriteBytes(compressed.data(), compressed.size());
+}
+
+void InputLog::DetachFromFile()
+{
+  // The file is about to be overwritten, so everything still read from it has to be moved
+  // somewhere else first.
+  std::vector<u8> stored;
+  for (Block& block : m_blocks)
+  {
+    if (!block.in_file)
+      continue;
+
+    ReadStoredBlock(block, &stored);
+    if (block.compressed_in_file)
+      block.data = std::move(stored);
+    else
+      block.data = Compress(stored.data(), stored.size(), BLOCK_COMPRESSION_LEVEL);
+    block.in_file = false;
+  }
+
+  for (Checkpoint& checkpoint : m_checkpoints)
+  {
+    if (!checkpoint.in_file)
+      continue;
+
+    ReadStoredCheckpoint(checkpoint, &stored);
+    if (!m_spool_file.IsOpen())
+      m_spool_file.Open(GetSpoolFilePath(), "w+b");
+    m_spool_file.Seek(0, File::SeekOrigin::End);
+    checkpoint.file_offset = m_spool_file.Tell();
+    checkpoint.file_size = static_cast<u32>(stored.size());
+    checkpoint.in_file = false;
+    m_spool_file.WriteBytes(stored.data(), stored.size());
+  }
+
+  m_file.Close();
+  m_file_path.clear();
+}
+
+u64 InputLog::GetSize() const
+{
+  std::lock_guard lk(m_mutex);
+  return GetSizeLocked();
+}
+
+u64 InputLog::GetSizeLocked() const
+{
+  const u64 blocks_end = m_blocks.empty() ? 0 : m_blocks.back().start + m_blocks.back().size;
+  return blocks_end + m_tail.size();
+}
+
+bool InputLog::Read(u64 position, void* data, size_t size)
+{
+  std::lock_guard lk(m_mutex);
+
+  const u64 total_size = GetSizeLocked();
+  if (position > total_size || total_size - position < size)
+    return false;
+
+  u8* out = static_cast<u8*>(data);
+  const u64 tail_start = total_size - m_tail.size();
+  while (size > 0)
+  {
+    if (position >= tail_start)
+    {
+      std::memcpy(out, m_tail.data() + (position - tail_start), size);
+      return true;
+    }
+
+    const auto it = std::upper_bound(m_blocks.begin(), m_blocks.end(), position,
+                                     [](u64 pos, const Block& block) { return pos < block.start; });
+    const size_t index = std::distance(m_blocks.begin(), it) - 1;
+    const std::vector<u8>* block_data = GetBlockData(index);
+    if (!block_data)
+      return false;
+
+    const size_t offset = static_cast<size_t>(position - m_blocks[index].start);
+    const size_t length = std::min(size, block_data->size() - offset);
+    std::memcpy(out, block_data->data() + offset, length);
+    out += length;
+    position += length;
+    size -= length;
+  }
+  return true;
+}
+
+void InputLog::Append(const void* data, size_t size)
+{
+  std::lock_guard lk(m_mutex);
+
+  const u8* in = static_cast<const u8*>(data);
+  while (size > 0)
+  {
+    const size_t length = std::min(size, BLOCK_SIZE - m_tail.size());
+    m_tail.insert(m_tail.end(), in, in + length);
+    in += length;
+    size -= length;
+
+    if (m_tail.size() == BLOCK_SIZE)
+      SealTail();
+  }
+}
+
+void InputLog::SealTail()
+{
+  const u64 start = GetSizeLocked() - m_tail.size();
+  Block& block = m_blocks.emplace_back();
+  block.start = start;
+  block.size = static_cast<u32>(m_tail.size());
+  block.data = Compress(m_tail.data(), m_tail.size(), BLOCK_COMPRESSION_LEVEL);
+  m_tail.clear();
+}
+
+void InputLog::Truncate(u64 position)
+{
+  std::lock_guard lk(m_mutex);
+
+  const u64 total_size = GetSizeLocked();
+  if (position >= total_size)
+    return;
+
+  ++m_generation;
+
+  const u64 tail_start = total_size - m_tail.size();
+  if (position >= tail_start)
+  {
+    m_tail.resize(static_cast<size_t>(position - tail_start));
+  }
+  else
+  {
+    const auto it = std::upper_bound(m_blocks.begin(), m_blocks.end(), position,
+                                     [](u64 pos, const Block& block) { return pos < block.start; });
+    const size_t index = std::distance(m_blocks.begin(), it) - 1;
+
+    // The part of the block before position becomes the new tail.
+    const std::vector<u8>* block_data = GetBlockData(index);
+    const size_t kept = static_cast<size_t>(position - m_blocks[index].start);
+    if (block_data && block_data->size() >= kept)
+      m_tail.assign(block_data->begin(), block_data->begin() + kept);
+    else
+      m_tail.clear();
+
+    m_blocks.erase(m_blocks.begin() + index, m_blocks.end());
+    m_cached_block = SIZE_MAX;
+    if (index < m_saved_block_count)
+      m_saved_path.clear();
+  }
+
+  for (size_t i = 0; i < m_checkpoints.size();)
+  {
+    if (m_checkpoints[i].position <= position)
+    {
+      ++i;
+      continue;
+    }
+
+    m_checkpoints.erase(m_checkpoints.begin() + i);
+    if (i < m_saved_checkpoint_count)
+      m_saved_path.clear();
+  }
+}
+
+const std::vector<u8>* InputLog::GetBlockData(size_t index)
+{
+  if (m_cached_block == index)
+    return &m_cache;
+
+  m_cached_block = SIZE_MAX;
+  const Block& block = m_blocks[index];
+  if (!block.in_file)
+  {
+    if (!Decompress(block.data, &m_cache, block.size))
+      return nullptr;
+  }
+  else if (block.compressed_in_file)
+  {
+    std::vector<u8> stored;
+    if (!ReadStoredBlock(block, &stored) || !Decompress(stored, &m_cache, block.size))
+      return nullptr;
+  }
+  else if (!ReadStoredBlock(block, &m_cache))
+  {
+    return nullptr;
+  }
+
+  m_cached_block = index;
+  return &m_cache;
+}
+
+bool InputLog::ReadStoredBlock(const Block& block, std::vector<u8>* data)
+{
+  data->resize(block.file_size);
+  return m_file.Seek(block.file_offset, File::SeekOrigin::Begin) &&
+         m_file.ReadBytes(data->data(), data->size());
+}
+
+bool InputLog::ReadStoredCheckpoint(const Checkpoint& checkpoint, std::vector<u8>* data)
+{
+  File::IOFile& file = checkpoint.in_file ? m_file : m_spool_file;
+  data->resize(checkpoint.file_size);
+  return file.Seek(checkpoint.file_offset, File::SeekOrigin::Begin) &&
+         file.ReadBytes(data->data(), data->size());
+}
+
+u32 InputLog::GetGeneration() const
+{
+  std::lock_guard lk(m_mutex);
+  return m_generation;
+}
+
+void InputLog::AddCheckpoint(u32 generation, u64 frame, u64 position, const std::vector<u8>& state)
+{
+  const std::vector<u8> compressed =
+      Compress(state.data(), state.size(), CHECKPOINT_COMPRESSION_LEVEL);
+  if (compressed.empty())
+    return;
+
+  std::lock_guard lk(m_mutex);
+  if (generation != m_generation || position > GetSizeLocked())
+    return;
+
+  if (!m_spool_file.IsOpen() && !m_spool_file.Open(GetSpoolFilePath(), "w+b"))
+  {
+    WARN_LOG_FMT(CORE, "Failed to create {}, not storing movie checkpoints", GetSpoolFilePath());
+    return;
+  }
+
+  m_spool_file.Seek(0, File::SeekOrigin::End);
+  const u64 offset = m_spool_file.Tell();
+  if (!m_spool_file.WriteBytes(compressed.data(), compressed.size()))
+    return;
+
+  m_checkpoints.push_back({frame, position, static_cast<u32>(state.size()), false, offset,
+                           static_cast<u32>(compressed.size())});
+}
+
+std::optional<u64> InputLog::LoadCheckpoint(u64 frame, std::vector<u8>* state)
+{
+  std::lock_guard lk(m_mutex);
+
+  const Checkpoint* best = nullptr;
+  for (const Checkpoint& checkpoint : m_checkpoints)
+  {
+    if (checkpoint.frame <= frame && (!best || checkpoint.frame > best->frame))
+      best = &checkpoint;
+  }
+
+  std::vector<u8> stored;
+  if (!best || !ReadStoredCheckpoint(*best, &stored) || !Decompress(stored, state, best->size))
+    return std::nullopt;
+
+  return best->frame;
+}
+
+size_t InputLog::GetCheckpointCount() const
+{
+  std::lock_guard lk(m_mutex);
+  return m_checkpoints.size();
+}
+}  // namespace Movie
@@ -0,0 +1,124 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+
+namespace Movie
+{
+struct DTMHeader;
+
+// The input log of a movie: the controller and Wiimote data of every poll, in order.
+//
+// Version 1 movies store the log uncompressed after the header. Version 2 movies store it as a
+// sequence of chunks instead: input blocks compressed with Zstandard, and savestate checkpoints
+// which allow jumping to a frame without replaying everything before it.
+//
+// A log loaded from a file reads its blocks and checkpoints from the file as they are needed, so
+// even a very long movie doesn't have to be kept in memory. Recorded input is kept in compressed
+// blocks, and recorded checkpoints are kept in a temporary file. Saving a version 2 movie to the
+// file it was last saved to only appends what was added since.
+class InputLog final
+{
+public:
+  static constexpr size_t BLOCK_SIZE = 0x10000;
+
+  InputLog();
+  ~InputLog();
+  InputLog(const InputLog&) = delete;
+  InputLog& operator=(const InputLog&) = delete;
+
+  void Clear();
+
+  // Replaces the log with the one of the movie file at path, whose header must have the given
+  // format version.
+  bool Load(const std::string& path, u32 version);
+  bool Save(const std::string& path, const DTMHeader& header, u32 version,
+            bool include_checkpoints);
+
+  u64 GetSize() const;
+  bool IsEmpty() const { return GetSize() == 0; }
+
+  // Returns false if any of the requested data is past the end of the log.
+  bool Read(u64 position, void* data, size_t size);
+  void Append(const void* data, size_t size);
+  // Removes everything from position on, along with checkpoints from after it.
+  void Truncate(u64 position);
+
+  // Changes whenever data is removed from the log, so that a checkpoint captured before then can
+  // be recognized as no longer belonging to it.
+  u32 GetGeneration() const;
+  void AddCheckpoint(u32 generation, u64 frame, u64 position, const std::vector<u8>& state);
+  // Loads the newest checkpoint at or before frame, and returns the frame it was captured on.
+  std::optional<u64> LoadCheckpoint(u64 frame, std::vector<u8>* state);
+  size_t GetCheckpointCount() const;
+
+private:
+  struct Block
+  {
+    u64 start;
+    u32 size;
+    // Compressed data, if the block isn't read from m_file.
+    std::vector<u8> data;
+    bool in_file = false;
+    bool compressed_in_file = false;
+    u64 file_offset = 0;
+    u32 file_size = 0;
+  };
+
+  struct Checkpoint
+  {
+    u64 frame;
+    u64 position;
+    u32 size;
+    // Checkpoints are either read from m_file or from m_spool_file.
+    bool in_file;
+    u64 file_offset;
+    u32 file_size;
+  };
+
+  void ClearLocked();
+  u64 GetSizeLocked() const;
+  void SealTail();
+  const std::vector<u8>* GetBlockData(size_t index);
+  bool ReadStoredBlock(const Block& block, std::vector<u8>* data);
+  bool ReadStoredCheckpoint(const Checkpoint& checkpoint, std::vector<u8>* data);
+  bool LoadVersion2(u64 file_size);
+  void DetachFromFile();
+  bool WriteVersion1(File::IOFile& file);
+  bool WriteChunks(File::IOFile& file, size_t first_block, size_t first_checkpoint,
+                   bool include_checkpoints);
+  bool WriteTail(File::IOFile& file);
+
+  mutable std::mutex m_mutex;
+
+  std::vector<Block> m_blocks;
+  // Data after the last block, which doesn't fill a block yet.
+  std::vector<u8> m_tail;
+  std::vector<Checkpoint> m_checkpoints;
+  u32 m_generation = 0;
+
+  File::IOFile m_file;
+  std::string m_file_path;
+  File::IOFile m_spool_file;
+
+  size_t m_cached_block = SIZE_MAX;
+  std::vector<u8> m_cache;
+
+  // What the file at m_saved_path contained after the last save, for appending to it.
+  std::string m_saved_path;
+  u64 m_saved_file_size = 0;
+  u64 m_saved_chunks_end = 0;
+  size_t m_saved_block_count = 0;
+  size_t m_saved_checkpoint_count = 0;
+};
+}  // namespace Movie
@@ -10,6 +10,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <sstream>
 #include <thread>
@@ -25,6 +26,7 @@
 #include "Common/Crypto/SHA1.h"
 #include "Common/ENetUtil.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
@@ -66,6 +68,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayCommon.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/StateDelta.h"
 #include "Core/SyncIdentifier.h"
 #include "DiscIO/Blob.h"
 
@@ -448,6 +451,10 @@ void NetPlayClient::OnData(sf::Packet& packet)
     OnSyncCodes(packet);
     break;
 
+  case MessageID::SyncState:
+    OnSyncState(packet);
+    break;
+
   case MessageID::ComputeGameDigest:
     OnComputeGameDigest(packet);
     break;
@@ -855,12 +862,14 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
     packet >> m_net_settings.efb_emulate_format_changes;
     packet >> m_net_settings.safe_texture_cache_color_samples;
     packet >> m_net_settings.perf_queries_enable;
+    packet >> m_net_settings.perf_queries_async;
     packet >> m_net_settings.float_exceptions;
     packet >> m_net_settings.divide_by_zero_exceptions;
     packet >> m_net_settings.fprf;
     packet >> m_net_settings.accurate_nans;
     packet >> m_net_settings.disable_icache;
     packet >> m_net_settings.sync_on_skip_idle;
+    packet >> m_net_settings.coalesce_events;
     packet >> m_net_settings.sync_gpu;
     packet >> m_net_settings.sync_gpu_max_distance;
     packet >> m_net_settings.sync_gpu_min_distance;
@@ -906,6 +915,7 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
     packet >> m_net_settings.golf_mode;
     packet >> m_net_settings.use_fma;
     packet >> m_net_settings.hide_remote_gbas;
+    packet >> m_load_synced_state;
 
     for (size_t i = 0; i < sizeof(m_net_settings.sram); ++i)
       packet >> m_net_settings.sram[i];
@@ -947,12 +957,27 @@ void NetPlayClient::OnPlayerPingData(sf::Packet& packet)
   PlayerId pid;
   packet >> pid;
 
+  std::optional<u32> auto_buffer_size;
   {
     std::lock_guard lkp(m_crit.players);
     Player& player = m_players[pid];
     packet >> player.ping;
+    player.latency.AddSample(player.ping);
+
+    // With host input authority, the buffer only has to absorb packets from the host arriving
+    // bunched up, so it depends on how much this client's own ping varies. The golfer doesn't
+    // use a buffer at all.
+    if (m_host_input_authority && pid == m_pid && pid != m_current_golfer &&
+        Config::Get(Config::NETPLAY_AUTO_BUFFER_SIZE))
+    {
+      auto_buffer_size =
+          m_pad_buffer_controller.Update(player.latency.GetJitterBound(), m_target_buffer_size);
+    }
   }
 
+  if (auto_buffer_size)
+    AdjustPadBufferSize(*auto_buffer_size);
+
   DisplayPlayersPing();
   m_dialog->Update();
 }
@@ -993,19 +1018,27 @@ void NetPlayClient::OnSyncSaveData(sf::Packet& packet)
     OnSyncSaveDataNotify(packet);
     break;
 
+  case SyncSaveDataID::Offer:
+    OnSyncSaveDataOffer(packet);
+    break;
+
   case SyncSaveDataID::RawData:
+    StoreSaveDataInCache(packet);
     OnSyncSaveDataRaw(packet);
     break;
 
   case SyncSaveDataID::GCIData:
+    StoreSaveDataInCache(packet);
     OnSyncSaveDataGCI(packet);
     break;
 
   case SyncSaveDataID::WiiData:
+    StoreSaveDataInCache(packet);
     OnSyncSaveDataWii(packet);
     break;
 
   case SyncSaveDataID::GBAData:
+    StoreSaveDataInCache(packet);
     OnSyncSaveDataGBA(packet);
     break;
 
@@ -1028,6 +1061,40 @@ void NetPlayClient::OnSyncSaveDataNotify(sf::Packet& packet)
     m_dialog->AppendChat(Common::GetStringT("Synchronizing save data..."));
 }
 
+void NetPlayClient::OnSyncSaveDataOffer(sf::Packet& packet)
+{
+  u32 offer_id;
+  packet >> offer_id;
+  const u64 hash = Common::PacketReadU64(packet);
+  const u64 size = Common::PacketReadU64(packet);
+
+  std::string cached_data;
+  if (File::ReadFileToString(GetSaveDataCachePath(hash), cached_data) &&
+      cached_data.size() == size)
+  {
+    sf::Packet cached_packet;
+    cached_packet.append(cached_data.data(), cached_data.size());
+
+    MessageID mid;
+    cached_packet >> mid;
+    if (mid == MessageID::SyncSaveData && GetSaveDataHash(cached_packet) == hash)
+    {
+      INFO_LOG_FMT(NETPLAY, "Using cached save data {:016x}.", hash);
+      OnSyncSaveData(cached_packet);
+      return;
+    }
+  }
+
+  INFO_LOG_FMT(NETPLAY, "Requesting save data {:016x}.", hash);
+
+  sf::Packet request_packet;
+  request_packet << MessageID::SyncSaveData;
+  request_packet << SyncSaveDataID::Request;
+  request_packet << offer_id;
+
+  Send(request_packet);
+}
+
 void NetPlayClient::OnSyncSaveDataRaw(sf::Packet& packet)
 {
   bool is_slot_a;
@@ -1452,6 +1519,52 @@ void NetPlayClient::OnSyncCodesDataAR(sf::Packet& packet)
   ActionReplay::UpdateSyncedCodes(synced_codes);
 }
 
+void NetPlayClient::OnSyncState(sf::Packet& packet)
+{
+  SyncStateID sub_id;
+  packet >> sub_id;
+
+  if (sub_id != SyncStateID::Data)
+  {
+    PanicAlertFmtT("Unknown SYNC_STATE message received with id: {0}", static_cast<u8>(sub_id));
+    return;
+  }
+
+  const u64 base_hash = Common::PacketReadU64(packet);
+  const u64 state_hash = Common::PacketReadU64(packet);
+
+  // A hash of 0 means the delta is against an empty state, so it contains the whole state.
+  if (base_hash != 0 && base_hash != m_state_baseline_hash)
+  {
+    WARN_LOG_FMT(NETPLAY, "Received a state delta against {:016x}, but have {:016x}.", base_hash,
+                 m_state_baseline_hash);
+    SyncStateResponse(false);
+    return;
+  }
+  const std::span<const u8> base =
+      base_hash != 0 ? std::span<const u8>(m_state_baseline) : std::span<const u8>();
+
+  const std::optional<std::vector<u8>> data = DecompressPacketIntoBuffer(packet);
+  const std::optional<State::StateDelta> delta =
+      data ? State::StateDelta::Deserialize(*data) : std::nullopt;
+  std::vector<u8> state;
+  if (!delta || !delta->Apply(base, &state) ||
+      Common::GetXXH3Hash64(state.data(), static_cast<u32>(state.size()), 0) != state_hash)
+  {
+    WARN_LOG_FMT(NETPLAY, "Received an invalid state.");
+    SyncStateResponse(false);
+    return;
+  }
+
+  INFO_LOG_FMT(NETPLAY, "Received state {:016x} ({} bytes, {} bytes transferred).", state_hash,
+               state.size(), data->size());
+
+  m_state_baseline = state;
+  m_state_baseline_hash = state_hash;
+  SetSyncedState(std::move(state));
+  SyncStateResponse(true, state_hash);
+}
+
 void NetPlayClient::OnComputeGameDigest(sf::Packet& packet)
 {
   SyncIdentifier sync_identifier;
@@ -1556,6 +1669,14 @@ void NetPlayClient::SendAsync(sf::Packet&& packet, const u8 channel_id)
   ENetUtil::WakeupThread(m_client);
 }
 
+// called from ---CPU--- thread
+void NetPlayClient::SendPadDataAsync(const sf::Packet& packet)
+{
+  // Copying the packet into a reused element keeps the buffer that element already has.
+  m_pad_data_queue.Push(packet);
+  ENetUtil::WakeupThread(m_client);
+}
+
 // called from ---NETPLAY--- thread
 void NetPlayClient::ThreadFunc()
 {
@@ -1575,6 +1696,7 @@ void NetPlayClient::ThreadFunc()
     }
   }
 
+  sf::Packet rpac;
   while (m_do_loop.IsSet())
   {
     ENetEvent netEvent;
@@ -1590,12 +1712,17 @@ void NetPlayClient::ThreadFunc()
       }
       m_async_queue.Pop();
     }
+    while (!m_pad_data_queue.Empty())
+    {
+      Send(m_pad_data_queue.Front());
+      m_pad_data_queue.Pop();
+    }
     if (net > 0)
     {
-      sf::Packet rpac;
       switch (netEvent.type)
       {
       case ENET_EVENT_TYPE_RECEIVE:
+        rpac.clear();
         rpac.append(netEvent.packet->data, netEvent.packet->dataLength);
         OnData(rpac);
 
@@ -1760,6 +1887,15 @@ bool NetPlayClient::StartGame(const std::string& path)
                                     });
   boot_session_data->SetNetplaySettings(std::make_unique<NetPlay::NetSettings>(m_net_settings));
 
+  if (m_load_synced_state)
+  {
+    if (m_synced_state)
+      boot_session_data->SetNetplayState(std::move(*m_synced_state));
+    else
+      PanicAlertFmtT("The host resumed the game from a state which wasn't received.");
+  }
+  m_synced_state.reset();
+
   m_dialog->BootGame(path, std::move(boot_session_data));
 
   UpdateDevices();
@@ -1821,6 +1957,21 @@ void NetPlayClient::SyncCodeResponse(const bool success)
   }
 }
 
+void NetPlayClient::SyncStateResponse(const bool success, const u64 state_hash)
+{
+  m_dialog->AppendChat(success ? Common::GetStringT("State received!") :
+                                 Common::GetStringT("Error processing the state."));
+
+  sf::Packet response_packet;
+  response_packet << MessageID::SyncState;
+  if (success)
+    response_packet << SyncStateID::Success << sf::Uint64{state_hash};
+  else
+    response_packet << SyncStateID::Failure;
+
+  Send(response_packet);
+}
+
 // called from ---GUI--- thread
 bool NetPlayClient::ChangeGame(const std::string&)
 {
@@ -1990,7 +2141,8 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
 
   if (IsFirstInGamePad(pad_nb) && batching)
   {
-    sf::Packet packet;
+    sf::Packet& packet = m_pad_data_packet;
+    packet.clear();
     packet << MessageID::PadData;
 
     bool send_packet = false;
@@ -2001,7 +2153,7 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     }
 
     if (send_packet)
-      SendAsync(std::move(packet));
+      SendPadDataAsync(packet);
 
     if (m_host_input_authority)
       SendPadHostPoll(-1);
@@ -2012,10 +2164,11 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     const int local_pad = InGamePadToLocalPad(pad_nb);
     if (local_pad < 4)
     {
-      sf::Packet packet;
+      sf::Packet& packet = m_pad_data_packet;
+      packet.clear();
       packet << MessageID::PadData;
       if (PollLocalPad(local_pad, packet))
-        SendAsync(std::move(packet));
+        SendPadDataAsync(packet);
     }
 
     if (m_host_input_authority)
@@ -2093,10 +2246,11 @@ bool NetPlayClient::WiimoteUpdate(const std::span<WiimoteDataBatchEntry>& entrie
                   fmt::join(std::span(entry.state->data.data(), entry.state->length), ", "));
     if (local_wiimote < 4)
     {
-      sf::Packet packet;
+      sf::Packet& packet = m_pad_data_packet;
+      packet.clear();
       packet << MessageID::WiimoteData;
       if (AddLocalWiimoteToBuffer(local_wiimote, *entry.state, packet))
-        SendAsync(std::move(packet));
+        SendPadDataAsync(packet);
     }
 
     // Now, we either use the data pushed earlier, or wait for the
@@ -2212,7 +2366,8 @@ void NetPlayClient::SendPadHostPoll(const PadIndex pad_num)
   if (m_local_player->pid != m_current_golfer)
     return;
 
-  sf::Packet packet;
+  sf::Packet& packet = m_pad_data_packet;
+  packet.clear();
   packet << MessageID::PadHostData;
 
   if (pad_num < 0)
@@ -2259,7 +2414,7 @@ void NetPlayClient::SendPadHostPoll(const PadIndex pad_num)
     }
   }
 
-  SendAsync(std::move(packet));
+  SendPadDataAsync(packet);
 }
 
 void NetPlayClient::InvokeStop()
@@ -2593,6 +2748,12 @@ void NetPlayClient::SetWiiSyncData(std::unique_ptr<IOS::HLE::FS::FileSystem> fs,
   m_wii_sync_redirect_folder = std::move(redirect_folder);
 }
 
+void NetPlayClient::SetSyncedState(std::vector<u8> state)
+{
+  std::lock_guard lkg(m_crit.game);
+  m_synced_state = std::move(state);
+}
+
 SyncIdentifier NetPlayClient::GetSDCardIdentifier()
 {
   return SyncIdentifier{{}, "sd", {}, {}, {}, {}};
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <string>
 #include <thread>
@@ -18,8 +19,10 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
+#include "Common/PooledSPSCQueue.h"
 #include "Common/SPSCQueue.h"
 #include "Common/TraversalClient.h"
+#include "Core/NetPlayPadBuffer.h"
 #include "Core/NetPlayProto.h"
 #include "Core/SyncIdentifier.h"
 #include "InputCommon/GCPadStatus.h"
@@ -93,6 +96,7 @@ public:
   virtual void SetChunkedProgress(int pid, u64 progress) = 0;
 
   virtual void SetHostWiiSyncData(std::vector<u64> titles, std::string redirect_folder) = 0;
+  virtual void SetHostSyncedState(std::vector<u8> state) = 0;
 };
 
 class Player
@@ -102,6 +106,7 @@ public:
   std::string name;
   std::string revision;
   u32 ping = 0;
+  LatencyEstimator latency;
   SyncIdentifierComparison game_status = SyncIdentifierComparison::Unknown;
 
   bool IsHost() const { return pid == 1; }
@@ -174,6 +179,7 @@ public:
 
   void SetWiiSyncData(std::unique_ptr<IOS::HLE::FS::FileSystem> fs, std::vector<u64> titles,
                       std::string redirect_folder);
+  void SetSyncedState(std::vector<u8> state);
 
   static SyncIdentifier GetSDCardIdentifier();
 
@@ -196,8 +202,14 @@ protected:
 
   Common::SPSCQueue<AsyncQueueEntry, false> m_async_queue;
 
-  std::array<Common::SPSCQueue<GCPadStatus>, 4> m_pad_buffer;
-  std::array<Common::SPSCQueue<WiimoteEmu::SerializedWiimoteState>, 4> m_wiimote_buffer;
+  // The pad and Wii Remote data is sent from the CPU thread through its own queue, so that it
+  // neither waits for the GUI thread on the lock of m_async_queue nor allocates once the queue has
+  // warmed up. m_pad_data_packet is reused to build the packets.
+  Common::PooledSPSCQueue<sf::Packet, false> m_pad_data_queue;
+  sf::Packet m_pad_data_packet;
+
+  std::array<Common::PooledSPSCQueue<GCPadStatus>, 4> m_pad_buffer;
+  std::array<Common::PooledSPSCQueue<WiimoteEmu::SerializedWiimoteState>, 4> m_wiimote_buffer;
 
   std::array<GCPadStatus, 4> m_last_pad_status{};
   std::array<bool, 4> m_first_pad_status_received{};
@@ -219,6 +231,7 @@ protected:
   // many incoming input packets need to be queued up before the client starts
   // speeding up the game to drain the buffer.
   unsigned int m_target_buffer_size = 20;
+  PadBufferController m_pad_buffer_controller;
   bool m_host_input_authority = false;
   PlayerId m_current_golfer = 1;
 
@@ -253,6 +266,7 @@ private:
 
   void SyncSaveDataResponse(bool success);
   void SyncCodeResponse(bool success);
+  void SyncStateResponse(bool success, u64 state_hash = 0);
 
   bool PollLocalPad(int local_pad, sf::Packet& packet);
   void SendPadHostPoll(PadIndex pad_num);
@@ -265,6 +279,7 @@ private:
   void AddWiimoteStateToPacket(int in_game_pad, const WiimoteEmu::SerializedWiimoteState& np,
                                sf::Packet& packet);
   void Send(const sf::Packet& packet, u8 channel_id = DEFAULT_CHANNEL);
+  void SendPadDataAsync(const sf::Packet& packet);
   void Disconnect();
   bool Connect();
   void SendGameStatus();
@@ -300,6 +315,7 @@ private:
   void OnDesyncDetected(sf::Packet& packet);
   void OnSyncSaveData(sf::Packet& packet);
   void OnSyncSaveDataNotify(sf::Packet& packet);
+  void OnSyncSaveDataOffer(sf::Packet& packet);
   void OnSyncSaveDataRaw(sf::Packet& packet);
   void OnSyncSaveDataGCI(sf::Packet& packet);
   void OnSyncSaveDataWii(sf::Packet& packet);
@@ -310,6 +326,7 @@ private:
   void OnSyncCodesDataGecko(sf::Packet& packet);
   void OnSyncCodesNotifyAR(sf::Packet& packet);
   void OnSyncCodesDataAR(sf::Packet& packet);
+  void OnSyncState(sf::Packet& packet);
   void OnComputeGameDigest(sf::Packet& packet);
   void OnGameDigestProgress(sf::Packet& packet);
   void OnGameDigestResult(sf::Packet& packet);
@@ -348,6 +365,13 @@ private:
   std::unique_ptr<IOS::HLE::FS::FileSystem> m_wii_sync_fs;
   std::vector<u64> m_wii_sync_titles;
   std::string m_wii_sync_redirect_folder;
+
+  // The last state received from the host, which the next one can be sent as a delta against,
+  // and the state to load when the game is started.
+  std::vector<u8> m_state_baseline;
+  u64 m_state_baseline_hash = 0;
+  std::optional<std::vector<u8>> m_synced_state;
+  bool m_load_synced_state = false;
 };
 
 void NetPlay_Enable(NetPlayClient* const np);
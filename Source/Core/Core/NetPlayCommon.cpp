@@ -4,19 +4,90 @@
 #include "Core/NetPlayCommon.h"
 
 #include <algorithm>
+#include <memory>
+#include <string_view>
 
 #include <fmt/format.h>
-#include <lzo/lzo1x.h>
+#include <zstd.h>
 
+#include "Common/CommonPaths.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/SFMLHelper.h"
 
 namespace NetPlay
 {
-constexpr u32 LZO_IN_LEN = 1024 * 64;
-constexpr u32 LZO_OUT_LEN = LZO_IN_LEN + (LZO_IN_LEN / 16) + 64 + 3;
+// Data is compressed in independent chunks of this size, so that neither side has to hold a whole
+// file in memory. Save data compresses well, and larger chunks compress better.
+constexpr size_t CHUNK_SIZE = 1024 * 1024;
+constexpr int COMPRESSION_LEVEL = ZSTD_CLEVEL_DEFAULT;
+
+constexpr size_t MAX_CACHED_SAVE_DATA = 32;
+
+namespace
+{
+class ChunkCompressor
+{
+public:
+  ChunkCompressor() : m_out_buffer(ZSTD_compressBound(CHUNK_SIZE)) {}
+
+  bool CompressChunkIntoPacket(const u8* data, size_t size, sf::Packet& packet)
+  {
+    if (!m_context)
+    {
+      PanicAlertFmtT("Internal Zstandard Error - compression failed");
+      return false;
+    }
+
+    const size_t out_len = ZSTD_compressCCtx(m_context.get(), m_out_buffer.data(),
+                                             m_out_buffer.size(), data, size, COMPRESSION_LEVEL);
+    if (ZSTD_isError(out_len))
+    {
+      PanicAlertFmtT("Internal Zstandard Error - compression failed");
+      return false;
+    }
+
+    packet << static_cast<u32>(out_len);
+    packet.append(m_out_buffer.data(), out_len);
+    return true;
+  }
+
+private:
+  std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> m_context{ZSTD_createCCtx(),
+                                                                 ZSTD_freeCCtx};
+  std::vector<u8> m_out_buffer;
+};
+
+// Reads the next compressed chunk. The end of the data is marked by a chunk of size 0.
+bool ReadChunkFromPacket(sf::Packet& packet, std::vector<u8>& in_buffer, size_t* in_len)
+{
+  u32 cur_len = 0;
+  packet >> cur_len;
+  if (!packet || cur_len > in_buffer.size())
+    return false;
+
+  for (size_t j = 0; j < cur_len; j++)
+    packet >> in_buffer[j];
+
+  *in_len = cur_len;
+  return static_cast<bool>(packet);
+}
+
+bool DecompressChunk(const std::vector<u8>& in_buffer, size_t in_len, u8* out, size_t out_capacity,
+                     size_t* out_len)
+{
+  *out_len = ZSTD_decompress(out, out_capacity, in_buffer.data(), in_len);
+  if (ZSTD_isError(*out_len))
+  {
+    PanicAlertFmtT("Internal Zstandard Error - decompression failed");
+    return false;
+  }
+  return true;
+}
+}  // namespace
 
 bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
 {
@@ -33,27 +104,12 @@ bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
   if (size == 0)
     return true;
 
-  std::vector<u8> in_buffer(LZO_IN_LEN);
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
+  std::vector<u8> in_buffer(CHUNK_SIZE);
+  ChunkCompressor compressor;
 
-  lzo_uint i = 0;
-  while (true)
+  for (u64 i = 0; i < size; i += CHUNK_SIZE)
   {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
-
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
-    {
-      cur_len = LZO_IN_LEN;
-    }
-
-    if (cur_len <= 0)
-      break;  // EOF
+    const size_t cur_len = static_cast<size_t>(std::min<u64>(CHUNK_SIZE, size - i));
 
     if (!file.ReadBytes(in_buffer.data(), cur_len))
     {
@@ -61,24 +117,8 @@ bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
       return false;
     }
 
-    if (lzo1x_1_compress(in_buffer.data(), cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
+    if (!compressor.CompressChunkIntoPacket(in_buffer.data(), cur_len, packet))
       return false;
-    }
-
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
-
-    if (cur_len != LZO_IN_LEN)
-      break;
-
-    i += cur_len;
   }
 
   // Mark end of data
@@ -124,45 +164,13 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
   if (size == 0)
     return true;
 
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
+  ChunkCompressor compressor;
 
-  lzo_uint i = 0;
-  while (true)
+  for (size_t i = 0; i < in_buffer.size(); i += CHUNK_SIZE)
   {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
-
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
-    {
-      cur_len = LZO_IN_LEN;
-    }
-
-    if (cur_len <= 0)
-      break;  // end of buffer
-
-    if (lzo1x_1_compress(&in_buffer[i], cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
+    const size_t cur_len = std::min(CHUNK_SIZE, in_buffer.size() - i);
+    if (!compressor.CompressChunkIntoPacket(&in_buffer[i], cur_len, packet))
       return false;
-    }
-
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
-
-    if (cur_len != LZO_IN_LEN)
-      break;
-
-    i += cur_len;
   }
 
   // Mark end of data
@@ -185,29 +193,20 @@ bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
     return false;
   }
 
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
-  std::vector<u8> out_buffer(LZO_IN_LEN);
+  std::vector<u8> in_buffer(ZSTD_compressBound(CHUNK_SIZE));
+  std::vector<u8> out_buffer(CHUNK_SIZE);
 
   while (true)
   {
-    u32 cur_len = 0;       // number of bytes to read
-    lzo_uint new_len = 0;  // number of bytes to write
-
-    packet >> cur_len;
-    if (!cur_len)
+    size_t cur_len;
+    if (!ReadChunkFromPacket(packet, in_buffer, &cur_len))
+      return false;
+    if (cur_len == 0)
       break;  // We reached the end of the data stream
 
-    for (size_t j = 0; j < cur_len; j++)
-    {
-      packet >> in_buffer[j];
-    }
-
-    if (lzo1x_decompress(in_buffer.data(), cur_len, out_buffer.data(), &new_len, nullptr) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
+    size_t new_len;
+    if (!DecompressChunk(in_buffer, cur_len, out_buffer.data(), out_buffer.size(), &new_len))
       return false;
-    }
 
     if (!file.WriteBytes(out_buffer.data(), new_len))
     {
@@ -269,26 +268,21 @@ std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
   if (size == 0)
     return out_buffer;
 
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
+  std::vector<u8> in_buffer(ZSTD_compressBound(CHUNK_SIZE));
 
-  lzo_uint i = 0;
+  size_t i = 0;
   while (true)
   {
-    u32 cur_len = 0;       // number of bytes to read
-    lzo_uint new_len = 0;  // number of bytes to write
-
-    packet >> cur_len;
-    if (!cur_len)
+    size_t cur_len;
+    if (!ReadChunkFromPacket(packet, in_buffer, &cur_len))
+      return {};
+    if (cur_len == 0)
       break;  // We reached the end of the data stream
 
-    for (size_t j = 0; j < cur_len; j++)
+    size_t new_len;
+    if (!DecompressChunk(in_buffer, cur_len, out_buffer.data() + i, out_buffer.size() - i,
+                         &new_len))
     {
-      packet >> in_buffer[j];
-    }
-
-    if (lzo1x_decompress(in_buffer.data(), cur_len, &out_buffer[i], &new_len, nullptr) != LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
       return {};
     }
 
@@ -297,4 +291,42 @@ std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
 
   return out_buffer;
 }
+
+u64 GetSaveDataHash(const sf::Packet& packet)
+{
+  return Common::GetXXH3Hash64(static_cast<const u8*>(packet.getData()),
+                               static_cast<u32>(packet.getDataSize()), 0);
+}
+
+std::string GetSaveDataCachePath(u64 hash)
+{
+  return fmt::format("{}NetPlaySaves" DIR_SEP "{:016x}.bin", File::GetUserPath(D_CACHE_IDX), hash);
+}
+
+void StoreSaveDataInCache(const sf::Packet& packet)
+{
+  const std::string path = GetSaveDataCachePath(GetSaveDataHash(packet));
+  if (File::Exists(path))
+    return;
+
+  const std::string_view data(static_cast<const char*>(packet.getData()), packet.getDataSize());
+  if (!File::CreateFullPath(path) || !File::WriteStringToFile(path, data))
+  {
+    WARN_LOG_FMT(NETPLAY, "Failed to cache save data at {}", path);
+    File::Delete(path);
+    return;
+  }
+
+  // Keep only the most recently received data.
+  const std::string directory = File::GetUserPath(D_CACHE_IDX) + "NetPlaySaves";
+  std::vector<File::FSTEntry> entries = File::ScanDirectoryTree(directory, false).children;
+  if (entries.size() <= MAX_CACHED_SAVE_DATA)
+    return;
+
+  std::sort(entries.begin(), entries.end(), [](const File::FSTEntry& a, const File::FSTEntry& b) {
+    return a.modificationTime < b.modificationTime;
+  });
+  for (size_t i = 0; i < entries.size() - MAX_CACHED_SAVE_DATA; ++i)
+    File::Delete(entries[i].physicalName);
+}
 }  // namespace NetPlay
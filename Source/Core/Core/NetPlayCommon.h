@@ -26,4 +26,11 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
 bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path);
 bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path);
 std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet);
+
+// Save data is offered to clients by the hash of the packet that contains it, so that clients
+// which received the same data in an earlier session can use their cached copy instead of
+// downloading it again.
+u64 GetSaveDataHash(const sf::Packet& packet);
+std::string GetSaveDataCachePath(u64 hash);
+void StoreSaveDataInCache(const sf::Packet& packet);
 }  // namespace NetPlay
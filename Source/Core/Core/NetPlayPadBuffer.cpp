@@ -0,0 +1,54 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayPadBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace NetPlay
+{
+void LatencyEstimator::AddSample(u32 rtt_ms)
+{
+  const double rtt = rtt_ms;
+  if (!m_has_samples)
+  {
+    m_smoothed_rtt = rtt;
+    m_rtt_variation = rtt / 2;
+    m_has_samples = true;
+    return;
+  }
+
+  m_rtt_variation = 0.75 * m_rtt_variation + 0.25 * std::abs(m_smoothed_rtt - rtt);
+  m_smoothed_rtt = 0.875 * m_smoothed_rtt + 0.125 * rtt;
+}
+
+u32 PadBufferController::GetBufferSizeForRTT(double rtt_ms)
+{
+  // Inputs only have to travel one way, but most games poll pads twice per frame, so there is
+  // one buffer entry per 1000 / 120 ms. The extra entry covers the time spent between receiving
+  // a packet and the next poll.
+  constexpr double MS_PER_ENTRY = 1000.0 / 120.0;
+  const u32 entries = static_cast<u32>(std::ceil(std::max(rtt_ms, 0.0) / 2 / MS_PER_ENTRY)) + 1;
+  return std::clamp(entries, MIN_BUFFER_SIZE, MAX_BUFFER_SIZE);
+}
+
+std::optional<u32> PadBufferController::Update(double rtt_ms, u32 current_size)
+{
+  const u32 target = GetBufferSizeForRTT(rtt_ms);
+
+  if (target >= current_size)
+  {
+    m_updates_below_current = 0;
+    if (target == current_size)
+      return std::nullopt;
+    return target;
+  }
+
+  if (++m_updates_below_current < SHRINK_DELAY)
+    return std::nullopt;
+
+  m_updates_below_current = 0;
+  return current_size - 1;
+}
+}  // namespace NetPlay
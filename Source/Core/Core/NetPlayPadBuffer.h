@@ -0,0 +1,55 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+
+#include "Common/CommonTypes.h"
+
+namespace NetPlay
+{
+// Estimates the round trip time of a connection and how much it varies from ping samples, the
+// same way TCP does for its retransmission timeout (RFC 6298).
+class LatencyEstimator final
+{
+public:
+  void AddSample(u32 rtt_ms);
+
+  bool HasSamples() const { return m_has_samples; }
+  double GetSmoothedRTT() const { return m_smoothed_rtt; }
+  double GetRTTVariation() const { return m_rtt_variation; }
+
+  // A round trip time which the connection rarely exceeds, accounting for jitter.
+  double GetRTTBound() const { return m_smoothed_rtt + 4 * m_rtt_variation; }
+  // How much later than usual a packet rarely arrives.
+  double GetJitterBound() const { return 4 * m_rtt_variation; }
+
+private:
+  double m_smoothed_rtt = 0;
+  double m_rtt_variation = 0;
+  bool m_has_samples = false;
+};
+
+// Picks a pad buffer size for a round trip time. The buffer grows as soon as the connection gets
+// worse, so that it doesn't stutter, but only shrinks one step at a time once the connection has
+// stayed better for a while, so that a single fast ping doesn't cause stutter either.
+class PadBufferController final
+{
+public:
+  static constexpr u32 MIN_BUFFER_SIZE = 1;
+  static constexpr u32 MAX_BUFFER_SIZE = 40;
+  // Number of consecutive updates which must allow a smaller buffer before it shrinks.
+  static constexpr u32 SHRINK_DELAY = 5;
+
+  static u32 GetBufferSizeForRTT(double rtt_ms);
+
+  // Returns the new buffer size if it should change from current_size.
+  std::optional<u32> Update(double rtt_ms, u32 current_size);
+
+  void Reset() { m_updates_below_current = 0; }
+
+private:
+  u32 m_updates_below_current = 0;
+};
+}  // namespace NetPlay
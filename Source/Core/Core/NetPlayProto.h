@@ -61,12 +61,14 @@ struct NetSettings
   bool efb_emulate_format_changes = false;
   int safe_texture_cache_color_samples = 0;
   bool perf_queries_enable = false;
+  bool perf_queries_async = false;
   bool float_exceptions = false;
   bool divide_by_zero_exceptions = false;
   bool fprf = false;
   bool accurate_nans = false;
   bool disable_icache = false;
   bool sync_on_skip_idle = false;
+  bool coalesce_events = false;
   bool sync_gpu = false;
   int sync_gpu_max_distance = 0;
   int sync_gpu_min_distance = 0;
@@ -185,6 +187,7 @@ enum class MessageID : u8
 
   SyncSaveData = 0xF1,
   SyncCodes = 0xF2,
+  SyncState = 0xF3,
 };
 
 enum class ConnectionError : u8
@@ -204,7 +207,9 @@ enum class SyncSaveDataID : u8
   RawData = 3,
   GCIData = 4,
   WiiData = 5,
-  GBAData = 6
+  GBAData = 6,
+  Offer = 7,
+  Request = 8
 };
 
 enum class SyncCodeID : u8
@@ -218,6 +223,13 @@ enum class SyncCodeID : u8
   Failure = 6,
 };
 
+enum class SyncStateID : u8
+{
+  Data = 0,
+  Success = 1,
+  Failure = 2,
+};
+
 constexpr u32 MAX_NAME_LENGTH = 30;
 constexpr size_t CHUNKED_DATA_UNIT_SIZE = 16384;
 
@@ -10,6 +10,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <thread>
 #include <type_traits>
@@ -22,6 +23,7 @@
 #include "Common/CommonPaths.h"
 #include "Common/ENetUtil.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/HttpRequest.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
@@ -39,6 +41,7 @@
 #include "Core/Config/SessionSettings.h"
 #include "Core/ConfigLoaders/GameConfigLoader.h"
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
 #include "Core/GeckoCode.h"
 #include "Core/GeckoCodeConfig.h"
 #include "Core/HW/EXI/EXI.h"
@@ -61,6 +64,8 @@
 #include "Core/IOS/Uids.h"
 #include "Core/NetPlayClient.h"  //for NetPlayUI
 #include "Core/NetPlayCommon.h"
+#include "Core/State.h"
+#include "Core/StateDelta.h"
 #include "Core/SyncIdentifier.h"
 
 #include "DiscIO/Enums.h"
@@ -251,6 +256,8 @@ void NetPlayServer::ThreadFunc()
       spac << MessageID::Ping;
       spac << m_ping_key;
 
+      UpdateAutoPadBufferSize();
+
       m_ping_timer.Start();
       SendToClients(spac);
 
@@ -615,6 +622,36 @@ void NetPlayServer::UpdateWiimoteMapping()
   SendToClients(spac);
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayServer::UpdateAutoPadBufferSize()
+{
+  // With host input authority, every client picks its own buffer size instead
+  if (!Config::Get(Config::NETPLAY_AUTO_BUFFER_SIZE) || m_host_input_authority)
+    return;
+
+  // Inputs are relayed through the host, so the slowest path is between the two players with the
+  // highest latency to it. The host's own latency is zero.
+  double slowest = 0;
+  double second_slowest = 0;
+  for (const auto& [pid, player] : m_players)
+  {
+    if (player.IsHost() || !player.latency.HasSamples())
+      continue;
+
+    const double rtt = player.latency.GetRTTBound();
+    if (rtt > slowest)
+      second_slowest = std::exchange(slowest, rtt);
+    else if (rtt > second_slowest)
+      second_slowest = rtt;
+  }
+
+  if (const std::optional<u32> size =
+          m_pad_buffer_controller.Update(slowest + second_slowest, m_target_buffer_size))
+  {
+    AdjustPadBufferSize(*size);
+  }
+}
+
 // called from ---GUI--- thread and ---NETPLAY--- thread
 void NetPlayServer::AdjustPadBufferSize(unsigned int size)
 {
@@ -927,6 +964,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     if (m_ping_key == ping_key)
     {
       player.ping = ping;
+      player.latency.AddSample(ping);
     }
 
     sf::Packet spac;
@@ -1095,6 +1133,11 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
         {
           m_dialog->AppendChat(Common::GetStringT("All players' saves synchronized."));
 
+          {
+            std::lock_guard lk(m_offered_save_data_mutex);
+            m_offered_save_data.clear();
+          }
+
           // Saves are synced, check if codes are as well and attempt to start the game
           m_saves_synced = true;
           CheckSyncAndStartGame();
@@ -1103,6 +1146,21 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     }
     break;
 
+    case SyncSaveDataID::Request:
+    {
+      u32 offer_id;
+      packet >> offer_id;
+
+      std::lock_guard lk(m_offered_save_data_mutex);
+      if (offer_id < m_offered_save_data.size())
+      {
+        const OfferedSaveData& offer = m_offered_save_data[offer_id];
+        INFO_LOG_FMT(NETPLAY, "Sending save data {} to player {}.", offer_id, player.pid);
+        SendChunked(sf::Packet(offer.packet), player.pid, offer.title);
+      }
+    }
+    break;
+
     case SyncSaveDataID::Failure:
     {
       m_dialog->AppendChat(Common::FmtFormatT("{0} failed to synchronize.", player.name));
@@ -1121,6 +1179,47 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
   }
   break;
 
+  case MessageID::SyncState:
+  {
+    SyncStateID sub_id;
+    packet >> sub_id;
+
+    switch (sub_id)
+    {
+    case SyncStateID::Success:
+    {
+      player.synced_state_hash = Common::PacketReadU64(packet);
+      if (m_start_pending)
+      {
+        if (++m_state_synced_players >= m_players.size() - 1)
+        {
+          m_dialog->AppendChat(Common::GetStringT("All players' states synchronized."));
+
+          m_state_synced = true;
+          CheckSyncAndStartGame();
+        }
+      }
+    }
+    break;
+
+    case SyncStateID::Failure:
+    {
+      m_dialog->AppendChat(Common::FmtFormatT("{0} failed to synchronize the state.", player.name));
+      m_dialog->OnGameStartAborted();
+      ChunkedDataAbort();
+      m_start_pending = false;
+    }
+    break;
+
+    default:
+      PanicAlertFmtT(
+          "Unknown SYNC_STATE message with id:{0} received from player:{1} Kicking player!",
+          static_cast<u8>(sub_id), player.pid);
+      return 1;
+    }
+  }
+  break;
+
   case MessageID::SyncCodes:
   {
     // Receive Status of Code Sync
@@ -1314,12 +1413,14 @@ bool NetPlayServer::SetupNetSettings()
   settings.safe_texture_cache_color_samples =
       Config::Get(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES);
   settings.perf_queries_enable = Config::Get(Config::GFX_PERF_QUERIES_ENABLE);
+  settings.perf_queries_async = Config::Get(Config::GFX_PERF_QUERIES_ASYNC);
   settings.float_exceptions = Config::Get(Config::MAIN_FLOAT_EXCEPTIONS);
   settings.divide_by_zero_exceptions = Config::Get(Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS);
   settings.fprf = Config::Get(Config::MAIN_FPRF);
   settings.accurate_nans = Config::Get(Config::MAIN_ACCURATE_NANS);
   settings.disable_icache = Config::Get(Config::MAIN_DISABLE_ICACHE);
   settings.sync_on_skip_idle = Config::Get(Config::MAIN_SYNC_ON_SKIP_IDLE);
+  settings.coalesce_events = Config::Get(Config::MAIN_COALESCE_EVENTS);
   settings.sync_gpu = Config::Get(Config::MAIN_SYNC_GPU);
   settings.sync_gpu_max_distance = Config::Get(Config::MAIN_SYNC_GPU_MAX_DISTANCE);
   settings.sync_gpu_min_distance = Config::Get(Config::MAIN_SYNC_GPU_MIN_DISTANCE);
@@ -1447,6 +1548,18 @@ bool NetPlayServer::RequestStartGame()
     }
   }
 
+  if (m_captured_state && m_players.size() > 1)
+  {
+    start_now = false;
+    m_start_pending = true;
+    if (!SyncState())
+    {
+      PanicAlertFmtT("Error synchronizing the state!");
+      m_start_pending = false;
+      return false;
+    }
+  }
+
   if (start_now)
   {
     return StartGame();
@@ -1480,6 +1593,14 @@ bool NetPlayServer::StartGame()
   SConfig::GetInstance().m_strSRAM = File::GetUserPath(F_GCSRAM_IDX);
   InitSRAM(&m_settings.sram, SConfig::GetInstance().m_strSRAM);
 
+  // The host's client boots with the captured state directly, the others already received it.
+  const bool load_synced_state = m_captured_state.has_value();
+  if (load_synced_state)
+  {
+    m_dialog->SetHostSyncedState(std::move(*m_captured_state));
+    m_captured_state.reset();
+  }
+
   // tell clients to start game
   sf::Packet spac;
   spac << MessageID::StartGame;
@@ -1517,12 +1638,14 @@ bool NetPlayServer::StartGame()
   spac << m_settings.efb_emulate_format_changes;
   spac << m_settings.safe_texture_cache_color_samples;
   spac << m_settings.perf_queries_enable;
+  spac << m_settings.perf_queries_async;
   spac << m_settings.float_exceptions;
   spac << m_settings.divide_by_zero_exceptions;
   spac << m_settings.fprf;
   spac << m_settings.accurate_nans;
   spac << m_settings.disable_icache;
   spac << m_settings.sync_on_skip_idle;
+  spac << m_settings.coalesce_events;
   spac << m_settings.sync_gpu;
   spac << m_settings.sync_gpu_max_distance;
   spac << m_settings.sync_gpu_min_distance;
@@ -1561,6 +1684,7 @@ bool NetPlayServer::StartGame()
   spac << m_settings.golf_mode;
   spac << m_settings.use_fma;
   spac << m_settings.hide_remote_gbas;
+  spac << load_synced_state;
 
   for (size_t i = 0; i < sizeof(m_settings.sram); ++i)
     spac << m_settings.sram[i];
@@ -1573,6 +1697,30 @@ bool NetPlayServer::StartGame()
   return true;
 }
 
+// called from ---GUI--- thread
+bool NetPlayServer::CaptureStateForResync()
+{
+  if (!m_is_running || !Core::IsRunning())
+    return false;
+
+  std::vector<u8> state;
+  State::SaveToBuffer(state);
+  if (state.empty())
+    return false;
+  m_captured_state = std::move(state);
+
+  m_dialog->AppendChat(
+      Common::GetStringT("Captured the host's state. Start the game to resume from it."));
+
+  // tell clients to stop game
+  sf::Packet spac;
+  spac << MessageID::StopGame;
+  SendAsyncToClients(std::move(spac));
+  m_is_running = false;
+
+  return true;
+}
+
 void NetPlayServer::AbortGameStart()
 {
   if (m_start_pending)
@@ -1674,6 +1822,11 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
 
   m_save_data_synced_players = 0;
 
+  {
+    std::lock_guard lk(m_offered_save_data_mutex);
+    m_offered_save_data.clear();
+  }
+
   {
     sf::Packet pac;
     pac << MessageID::SyncSaveData;
@@ -1724,8 +1877,8 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
         pac << sf::Uint64{0};
       }
 
-      SendChunkedToClients(std::move(pac), 1,
-                           fmt::format("Memory Card {} Synchronization", is_slot_a ? 'A' : 'B'));
+      OfferSaveData(std::move(pac),
+                    fmt::format("Memory Card {} Synchronization", is_slot_a ? 'A' : 'B'));
     }
     else if (Config::Get(Config::GetInfoForEXIDevice(slot)) ==
              ExpansionInterface::EXIDeviceType::MemoryCardFolder)
@@ -1764,8 +1917,8 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
         pac << static_cast<u8>(0);
       }
 
-      SendChunkedToClients(std::move(pac), 1,
-                           fmt::format("GCI Folder {} Synchronization", is_slot_a ? 'A' : 'B'));
+      OfferSaveData(std::move(pac),
+                    fmt::format("GCI Folder {} Synchronization", is_slot_a ? 'A' : 'B'));
     }
   }
 
@@ -1867,7 +2020,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       pac << false;  // no redirected save
     }
 
-    SendChunkedToClients(std::move(pac), 1, "Wii Save Synchronization");
+    OfferSaveData(std::move(pac), "Wii Save Synchronization");
   }
 
   for (size_t i = 0; i < m_gba_config.size(); ++i)
@@ -1897,11 +2050,89 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
         pac << sf::Uint64{0};
       }
 
-      SendChunkedToClients(std::move(pac), 1,
-                           fmt::format("GBA{} Save File Synchronization", i + 1));
+      OfferSaveData(std::move(pac), fmt::format("GBA{} Save File Synchronization", i + 1));
+    }
+  }
+
+  return true;
+}
+
+void NetPlayServer::OfferSaveData(sf::Packet&& packet, std::string title)
+{
+  const u64 hash = GetSaveDataHash(packet);
+  const u64 size = packet.getDataSize();
+
+  u32 offer_id;
+  {
+    std::lock_guard lk(m_offered_save_data_mutex);
+    offer_id = static_cast<u32>(m_offered_save_data.size());
+    m_offered_save_data.push_back(OfferedSaveData{std::move(packet), std::move(title)});
+  }
+
+  sf::Packet pac;
+  pac << MessageID::SyncSaveData;
+  pac << SyncSaveDataID::Offer;
+  pac << offer_id << sf::Uint64{hash} << sf::Uint64{size};
+
+  // send this on the chunked data channel to ensure it's sequenced after the notification
+  SendAsyncToClients(std::move(pac), 1, CHUNKED_DATA_CHANNEL);
+}
+
+// called from ---GUI--- thread
+bool NetPlayServer::SyncState()
+{
+  m_state_synced = false;
+  m_state_synced_players = 0;
+
+  const std::vector<u8>& state = *m_captured_state;
+  const u64 state_hash = Common::GetXXH3Hash64(state.data(), static_cast<u32>(state.size()), 0);
+
+  // Players who received the previous synchronized state are only sent the pages which changed
+  // since then, everyone else gets the whole state.
+  std::vector<std::pair<PlayerId, bool>> targets;
+  {
+    std::lock_guard lkp(m_crit.players);
+    for (const auto& [pid, player] : m_players)
+    {
+      if (!player.IsHost())
+      {
+        targets.emplace_back(pid, m_synced_state_hash != 0 &&
+                                      player.synced_state_hash == m_synced_state_hash);
+      }
+    }
+  }
+
+  const auto make_packet = [&](std::span<const u8> base,
+                               u64 base_hash) -> std::optional<sf::Packet> {
+    sf::Packet pac;
+    pac << MessageID::SyncState;
+    pac << SyncStateID::Data;
+    pac << sf::Uint64{base_hash} << sf::Uint64{state_hash};
+    if (!CompressBufferIntoPacket(State::StateDelta::Create(base, state).Serialize(), pac))
+      return std::nullopt;
+    return pac;
+  };
+
+  std::optional<sf::Packet> delta_packet;
+  std::optional<sf::Packet> full_packet;
+  for (const auto& [pid, has_base] : targets)
+  {
+    std::optional<sf::Packet>& packet = has_base ? delta_packet : full_packet;
+    if (!packet)
+    {
+      packet = has_base ? make_packet(m_synced_state, m_synced_state_hash) : make_packet({}, 0);
+      if (!packet)
+        return false;
     }
+
+    INFO_LOG_FMT(NETPLAY, "Sending {} state to player {}.", has_base ? "the changes of the" : "the",
+                 pid);
+    SendChunked(sf::Packet(*packet), pid, "State Synchronization");
   }
 
+  m_synced_state = state;
+  m_synced_state_hash = state_hash;
+
   return true;
 }
 
@@ -2043,7 +2274,7 @@ bool NetPlayServer::SyncCodes()
 
 void NetPlayServer::CheckSyncAndStartGame()
 {
-  if (m_saves_synced && m_codes_synced)
+  if (m_saves_synced && m_codes_synced && m_state_synced)
   {
     StartGame();
   }
@@ -15,12 +15,14 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "Common/Event.h"
 #include "Common/QoSSession.h"
 #include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
 #include "Common/TraversalClient.h"
+#include "Core/NetPlayPadBuffer.h"
 #include "Core/NetPlayProto.h"
 #include "Core/SyncIdentifier.h"
 #include "InputCommon/GCPadStatus.h"
@@ -56,6 +58,9 @@ public:
   bool StartGame();
   bool RequestStartGame();
   void AbortGameStart();
+  // Captures the state of the running game and stops it. When the game is next started, every
+  // player resumes from that state instead of booting the game from the start.
+  bool CaptureStateForResync();
 
   PadMappingArray GetPadMapping() const;
   void SetPadMapping(const PadMappingArray& mappings);
@@ -88,9 +93,13 @@ private:
     SyncIdentifierComparison game_status = SyncIdentifierComparison::Unknown;
     bool has_ipl_dump = false;
     bool has_hardware_fma = false;
+    // Hash of the last synchronized state the player received, which the next one can be sent
+    // as a delta against.
+    u64 synced_state_hash = 0;
 
     ENetPeer* socket = nullptr;
     u32 ping = 0;
+    LatencyEstimator latency;
     u32 current_game = 0;
 
     Common::QoSSession qos_session;
@@ -121,10 +130,18 @@ private:
     std::string title;
   };
 
+  struct OfferedSaveData
+  {
+    sf::Packet packet;
+    std::string title;
+  };
+
   bool SetupNetSettings();
   std::optional<SaveSyncInfo> CollectSaveSyncInfo();
   bool SyncSaveData(const SaveSyncInfo& sync_info);
+  void OfferSaveData(sf::Packet&& packet, std::string title);
   bool SyncCodes();
+  bool SyncState();
   void CheckSyncAndStartGame();
 
   u64 GetInitialNetPlayRTC() const;
@@ -147,6 +164,7 @@ private:
   void UpdatePadMapping();
   void UpdateGBAConfig();
   void UpdateWiimoteMapping();
+  void UpdateAutoPadBufferSize();
   std::vector<std::pair<std::string, std::string>> GetInterfaceListInternal() const;
   void ChunkedDataThreadFunc();
   void ChunkedDataSend(sf::Packet&& packet, PlayerId pid, const TargetMode target_mode);
@@ -170,13 +188,16 @@ private:
   bool m_update_pings = false;
   u32 m_current_game = 0;
   unsigned int m_target_buffer_size = 0;
+  PadBufferController m_pad_buffer_controller;
   PadMappingArray m_pad_map;
   GBAConfigArray m_gba_config;
   PadMappingArray m_wiimote_map;
   unsigned int m_save_data_synced_players = 0;
   unsigned int m_codes_synced_players = 0;
+  unsigned int m_state_synced_players = 0;
   bool m_saves_synced = true;
   bool m_codes_synced = true;
+  bool m_state_synced = true;
   bool m_start_pending = false;
   bool m_host_input_authority = false;
   PlayerId m_current_golfer = 1;
@@ -199,6 +220,16 @@ private:
   Common::SPSCQueue<AsyncQueueEntry, false> m_async_queue;
   Common::SPSCQueue<ChunkedDataQueueEntry, false> m_chunked_data_queue;
 
+  // Save data packets of the current sync, which clients request unless they have them cached.
+  std::mutex m_offered_save_data_mutex;
+  std::vector<OfferedSaveData> m_offered_save_data;
+
+  // The state all players resume from when the game is next started, and the last state that was
+  // sent to the players, which they only need the changes against.
+  std::optional<std::vector<u8>> m_captured_state;
+  std::vector<u8> m_synced_state;
+  u64 m_synced_state_hash = 0;
+
   SyncIdentifier m_selected_game_identifier;
   std::string m_selected_game_name;
   std::thread m_thread;
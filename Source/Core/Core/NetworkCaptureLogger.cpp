@@ -91,6 +91,7 @@ PCAPSSLCaptureLogger::~PCAPSSLCaptureLogger() = default;
 
 void PCAPSSLCaptureLogger::OnNewSocket(s32 socket)
 {
+  std::lock_guard lock(m_mutex);
   m_read_sequence_number[socket] = 0;
   m_write_sequence_number[socket] = 0;
 }
@@ -123,12 +124,14 @@ void PCAPSSLCaptureLogger::LogBBA(const void* data, std::size_t length)
 {
   if (!Config::Get(Config::MAIN_NETWORK_DUMP_BBA))
     return;
+  std::lock_guard lock(m_mutex);
   m_file->AddPacket(static_cast<const u8*>(data), length);
 }
 
 void PCAPSSLCaptureLogger::Log(LogType log_type, const void* data, std::size_t length, s32 socket,
                                sockaddr* other)
 {
+  std::lock_guard lock(m_mutex);
   const auto state = Common::SaveNetworkErrorState();
   Common::ScopeGuard guard([&state] { Common::RestoreNetworkErrorState(state); });
   sockaddr_in sock;
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
 
 #ifdef _WIN32
 #include <WinSock2.h>
@@ -110,6 +111,8 @@ private:
   void LogIPv4(LogType log_type, const u8* data, u16 length, s32 socket, const sockaddr_in& from,
                const sockaddr_in& to);
 
+  // SSL handshakes log their packets from the handshake thread.
+  std::mutex m_mutex;
   std::unique_ptr<Common::PCAP> m_file;
   std::map<s32, u32> m_read_sequence_number;
   std::map<s32, u32> m_write_sequence_number;
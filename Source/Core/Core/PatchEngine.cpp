@@ -19,6 +19,7 @@
 
 #include <fmt/format.h>
 
+#include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/Debug/MemoryPatches.h"
 #include "Common/IniFile.h"
@@ -31,6 +32,7 @@
 #include "Core/Debugger/PPCDebugInterface.h"
 #include "Core/GeckoCode.h"
 #include "Core/GeckoCodeConfig.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -44,6 +46,8 @@ constexpr std::array<const char*, 3> s_patch_type_strings{{
 }};
 
 static std::vector<Patch> s_on_frame;
+// The entries of all enabled patches in s_on_frame, flattened when the patches are loaded.
+static std::vector<PatchEntry> s_on_frame_entries;
 static std::vector<std::size_t> s_on_frame_memory;
 static std::mutex s_on_frame_memory_mutex;
 static std::map<u32, int> s_speed_hacks;
@@ -215,6 +219,16 @@ void LoadPatches()
 
   LoadPatchSection("OnFrame", &s_on_frame, globalIni, localIni);
 
+  s_on_frame_entries.clear();
+  for (const Patch& patch : s_on_frame)
+  {
+    if (patch.enabled)
+    {
+      s_on_frame_entries.insert(s_on_frame_entries.end(), patch.entries.begin(),
+                                patch.entries.end());
+    }
+  }
+
   // Check if I'm syncing Codes
   if (Config::Get(Config::SESSION_CODE_SYNC_OVERRIDE))
   {
@@ -230,38 +244,126 @@ void LoadPatches()
   LoadSpeedhacks("Speedhacks", merged);
 }
 
-static void ApplyPatches(const std::vector<Patch>& patches)
+static void ApplyPatchEntry(const PatchEntry& entry)
 {
-  for (const Patch& patch : patches)
+  u32 addr = entry.address;
+  u32 value = entry.value;
+  u32 comparand = entry.comparand;
+  switch (entry.type)
   {
-    if (patch.enabled)
+  case PatchType::Patch8Bit:
+    if (!entry.conditional || PowerPC::HostRead_U8(addr) == static_cast<u8>(comparand))
+      PowerPC::HostWrite_U8(static_cast<u8>(value), addr);
+    break;
+  case PatchType::Patch16Bit:
+    if (!entry.conditional || PowerPC::HostRead_U16(addr) == static_cast<u16>(comparand))
+      PowerPC::HostWrite_U16(static_cast<u16>(value), addr);
+    break;
+  case PatchType::Patch32Bit:
+    if (!entry.conditional || PowerPC::HostRead_U32(addr) == comparand)
+      PowerPC::HostWrite_U32(value, addr);
+    break;
+  default:
+    // unknown patchtype
+    break;
+  }
+}
+
+static u32 GetPatchEntrySize(PatchType type)
+{
+  switch (type)
+  {
+  case PatchType::Patch8Bit:
+    return 1;
+  case PatchType::Patch16Bit:
+    return 2;
+  default:
+    return 4;
+  }
+}
+
+// Patches are applied straight to the RAM backing them, translating each page only once. Only
+// entries which actually change memory write to it, and the instruction cache lines they touch are
+// invalidated together at the end, so that patched code which has already been compiled picks up
+// the change. Entries outside of RAM, and all entries while the data cache is emulated (which the
+// RAM pointers would bypass), go through the regular host accessors instead.
+static void ApplyPatches(const std::vector<PatchEntry>& entries)
+{
+  auto& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
+  auto& ppc_state = system.GetPPCState();
+
+  if (ppc_state.m_enable_dcache)
+  {
+    for (const PatchEntry& entry : entries)
+      ApplyPatchEntry(entry);
+    return;
+  }
+
+  static std::vector<u32> s_changed_lines;
+  s_changed_lines.clear();
+
+  u32 cached_page = 0;
+  u8* cached_page_pointer = nullptr;
+  bool cached_page_valid = false;
+
+  for (const PatchEntry& entry : entries)
+  {
+    const u32 size = GetPatchEntrySize(entry.type);
+    const u32 page = entry.address & ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+    if (page != ((entry.address + size - 1) & ~static_cast<u32>(PowerPC::HW_PAGE_MASK)))
     {
-      for (const PatchEntry& entry : patch.entries)
-      {
-        u32 addr = entry.address;
-        u32 value = entry.value;
-        u32 comparand = entry.comparand;
-        switch (entry.type)
-        {
-        case PatchType::Patch8Bit:
-          if (!entry.conditional || PowerPC::HostRead_U8(addr) == static_cast<u8>(comparand))
-            PowerPC::HostWrite_U8(static_cast<u8>(value), addr);
-          break;
-        case PatchType::Patch16Bit:
-          if (!entry.conditional || PowerPC::HostRead_U16(addr) == static_cast<u16>(comparand))
-            PowerPC::HostWrite_U16(static_cast<u16>(value), addr);
-          break;
-        case PatchType::Patch32Bit:
-          if (!entry.conditional || PowerPC::HostRead_U32(addr) == comparand)
-            PowerPC::HostWrite_U32(value, addr);
-          break;
-        default:
-          // unknown patchtype
-          break;
-        }
-      }
+      ApplyPatchEntry(entry);
+      continue;
+    }
+
+    if (!cached_page_valid || page != cached_page)
+    {
+      cached_page = page;
+      cached_page_pointer = PowerPC::HostGetRAMPointer(page);
+      cached_page_valid = true;
+    }
+    if (!cached_page_pointer)
+    {
+      ApplyPatchEntry(entry);
+      continue;
+    }
+
+    // Memory is big endian
+    u8* const pointer = cached_page_pointer + (entry.address & PowerPC::HW_PAGE_MASK);
+    const u32 mask = size == 4 ? 0xFFFFFFFF : (1U << (size * 8)) - 1;
+    u32 current = 0;
+    for (u32 i = 0; i < size; ++i)
+      current = (current << 8) | pointer[i];
+
+    if (entry.conditional && current != (entry.comparand & mask))
+      continue;
+    if (current == (entry.value & mask))
+      continue;
+
+    for (u32 i = 0; i < size; ++i)
+      pointer[i] = static_cast<u8>(entry.value >> ((size - 1 - i) * 8));
+
+    const u8* const ram = memory.GetRAM();
+    if (pointer >= ram && pointer < ram + memory.GetRamSize())
+      memory.MarkWritten(static_cast<u32>(pointer - ram), size);
+    else
+      memory.MarkWritten(static_cast<u32>(pointer - memory.GetEXRAM()) | 0x10000000, size);
+
+    const u32 first_line = Common::AlignDown(entry.address, 32);
+    const u32 last_line = Common::AlignDown(entry.address + size - 1, 32);
+    for (u32 line = first_line; line <= last_line; line += 32)
+    {
+      if (s_changed_lines.empty() || s_changed_lines.back() != line)
+        s_changed_lines.push_back(line);
     }
   }
+
+  std::sort(s_changed_lines.begin(), s_changed_lines.end());
+  s_changed_lines.erase(std::unique(s_changed_lines.begin(), s_changed_lines.end()),
+                        s_changed_lines.end());
+  for (const u32 line : s_changed_lines)
+    ppc_state.iCache.Invalidate(line);
 }
 
 static void ApplyMemoryPatches(std::span<const std::size_t> memory_patch_indices)
@@ -331,7 +433,7 @@ bool ApplyFramePatches()
     return false;
   }
 
-  ApplyPatches(s_on_frame);
+  ApplyPatches(s_on_frame_entries);
   ApplyMemoryPatches(s_on_frame_memory);
 
   // Run the Gecko code handler
@@ -344,6 +446,7 @@ bool ApplyFramePatches()
 void Shutdown()
 {
   s_on_frame.clear();
+  s_on_frame_entries.clear();
   s_speed_hacks.clear();
   ActionReplay::ApplyCodes({});
   Gecko::Shutdown();
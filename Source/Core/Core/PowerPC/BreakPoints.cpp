@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -19,32 +20,40 @@
 
 bool BreakPoints::IsAddressBreakPoint(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(),
-                     [address](const auto& bp) { return bp.address == address; });
+  return m_breakpoint_indices.count(address) != 0;
 }
 
 bool BreakPoints::IsBreakPointEnable(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(),
-                     [address](const auto& bp) { return bp.is_enabled && bp.address == address; });
+  const TBreakPoint* bp = GetBreakpoint(address);
+  return bp && bp->is_enabled;
 }
 
 bool BreakPoints::IsTempBreakPoint(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(), [address](const auto& bp) {
-    return bp.address == address && bp.is_temporary;
-  });
+  const TBreakPoint* bp = GetBreakpoint(address);
+  return bp && bp->is_temporary;
 }
 
 const TBreakPoint* BreakPoints::GetBreakpoint(u32 address) const
 {
-  auto bp = std::find_if(m_breakpoints.begin(), m_breakpoints.end(),
-                         [address](const auto& bp) { return bp.address == address; });
-
-  if (bp == m_breakpoints.end())
+  const auto iter = m_breakpoint_indices.find(address);
+  if (iter == m_breakpoint_indices.end())
     return nullptr;
 
-  return &*bp;
+  return &m_breakpoints[iter->second];
+}
+
+TBreakPoint* BreakPoints::FindBreakPoint(u32 address)
+{
+  return const_cast<TBreakPoint*>(std::as_const(*this).GetBreakpoint(address));
+}
+
+void BreakPoints::RebuildIndex()
+{
+  m_breakpoint_indices.clear();
+  for (size_t i = 0; i < m_breakpoints.size(); ++i)
+    m_breakpoint_indices.emplace(m_breakpoints[i].address, i);
 }
 
 BreakPoints::TBreakPointsStr BreakPoints::GetStrings() const
@@ -107,6 +116,7 @@ void BreakPoints::Add(TBreakPoint bp)
 
   JitInterface::InvalidateICache(bp.address, 4, true);
 
+  m_breakpoint_indices.emplace(bp.address, m_breakpoints.size());
   m_breakpoints.emplace_back(std::move(bp));
 }
 
@@ -120,8 +130,7 @@ void BreakPoints::Add(u32 address, bool temp, bool break_on_hit, bool log_on_hit
 {
   // Check for existing breakpoint, and overwrite with new info.
   // This is assuming we usually want the new breakpoint over an old one.
-  auto iter = std::find_if(m_breakpoints.begin(), m_breakpoints.end(),
-                           [address](const auto& bp) { return bp.address == address; });
+  TBreakPoint* existing_bp = FindBreakPoint(address);
 
   TBreakPoint bp;  // breakpoint settings
   bp.is_enabled = true;
@@ -131,13 +140,14 @@ void BreakPoints::Add(u32 address, bool temp, bool break_on_hit, bool log_on_hit
   bp.address = address;
   bp.condition = std::move(condition);
 
-  if (iter != m_breakpoints.end())  // We found an existing breakpoint
+  if (existing_bp)  // We found an existing breakpoint
   {
-    bp.is_enabled = iter->is_enabled;
-    *iter = std::move(bp);
+    bp.is_enabled = existing_bp->is_enabled;
+    *existing_bp = std::move(bp);
   }
   else
   {
+    m_breakpoint_indices.emplace(address, m_breakpoints.size());
     m_breakpoints.emplace_back(std::move(bp));
   }
 
@@ -146,25 +156,22 @@ void BreakPoints::Add(u32 address, bool temp, bool break_on_hit, bool log_on_hit
 
 bool BreakPoints::ToggleBreakPoint(u32 address)
 {
-  auto iter = std::find_if(m_breakpoints.begin(), m_breakpoints.end(),
-                           [address](const auto& bp) { return bp.address == address; });
-
-  if (iter == m_breakpoints.end())
+  TBreakPoint* bp = FindBreakPoint(address);
+  if (!bp)
     return false;
 
-  iter->is_enabled = !iter->is_enabled;
+  bp->is_enabled = !bp->is_enabled;
   return true;
 }
 
 void BreakPoints::Remove(u32 address)
 {
-  const auto iter = std::find_if(m_breakpoints.begin(), m_breakpoints.end(),
-                                 [address](const auto& bp) { return bp.address == address; });
-
-  if (iter == m_breakpoints.cend())
+  const auto iter = m_breakpoint_indices.find(address);
+  if (iter == m_breakpoint_indices.end())
     return;
 
-  m_breakpoints.erase(iter);
+  m_breakpoints.erase(m_breakpoints.begin() + iter->second);
+  RebuildIndex();
   JitInterface::InvalidateICache(address, 4, true);
 }
 
@@ -176,6 +183,7 @@ void BreakPoints::Clear()
   }
 
   m_breakpoints.clear();
+  m_breakpoint_indices.clear();
 }
 
 void BreakPoints::ClearAllTemporary()
@@ -193,6 +201,7 @@ void BreakPoints::ClearAllTemporary()
       ++bp;
     }
   }
+  RebuildIndex();
 }
 
 MemChecks::TMemChecksStr MemChecks::GetStrings() const
@@ -256,7 +265,6 @@ void MemChecks::AddFromStrings(const TMemChecksStr& mc_strings)
 
 void MemChecks::Add(TMemCheck memory_check)
 {
-  bool had_any = HasAny();
   Core::RunAsCPUThread([&] {
     // Check for existing breakpoint, and overwrite with new info.
     // This is assuming we usually want the new breakpoint over an old one.
@@ -275,10 +283,11 @@ void MemChecks::Add(TMemCheck memory_check)
     {
       m_mem_checks.emplace_back(std::move(memory_check));
     }
-    // If this is the first one, clear the JIT cache so it can switch to
-    // watchpoint-compatible code.
-    if (!had_any)
-      JitInterface::ClearCache();
+    RebuildPageMap();
+    // Clear the JIT cache so it can switch to watchpoint-compatible code. Even if there already
+    // were memchecks, code for the newly covered pages may have been compiled to access them
+    // directly.
+    JitInterface::ClearCache();
     PowerPC::DBATUpdated();
   });
 }
@@ -306,6 +315,7 @@ void MemChecks::Remove(u32 address)
 
   Core::RunAsCPUThread([&] {
     m_mem_checks.erase(iter);
+    RebuildPageMap();
     if (!HasAny())
       JitInterface::ClearCache();
     PowerPC::DBATUpdated();
@@ -316,6 +326,7 @@ void MemChecks::Clear()
 {
   Core::RunAsCPUThread([&] {
     m_mem_checks.clear();
+    RebuildPageMap();
     JitInterface::ClearCache();
     PowerPC::DBATUpdated();
   });
@@ -323,6 +334,12 @@ void MemChecks::Clear()
 
 TMemCheck* MemChecks::GetMemCheck(u32 address, size_t size)
 {
+  if (!HasAny())
+    return nullptr;
+
+  if (!OverlapsPages(address, static_cast<u32>(address + size - 1)))
+    return nullptr;
+
   const auto iter =
       std::find_if(m_mem_checks.begin(), m_mem_checks.end(), [address, size](const auto& mc) {
         return mc.end_address >= address && address + size - 1 >= mc.start_address;
@@ -343,6 +360,13 @@ bool MemChecks::OverlapsMemcheck(u32 address, u32 length) const
   const u32 page_end_suffix = length - 1;
   const u32 page_end_address = address | page_end_suffix;
 
+  // The page map is exact for blocks made of whole HW pages, which is what DBATUpdated and the
+  // JIT ask about.
+  if (!OverlapsPages(address & ~page_end_suffix, page_end_address))
+    return false;
+  if (length >= PowerPC::HW_PAGE_SIZE)
+    return true;
+
   return std::any_of(m_mem_checks.cbegin(), m_mem_checks.cend(), [&](const auto& mc) {
     return ((mc.start_address | page_end_suffix) == page_end_address ||
             (mc.end_address | page_end_suffix) == page_end_address) ||
@@ -351,6 +375,41 @@ bool MemChecks::OverlapsMemcheck(u32 address, u32 length) const
   });
 }
 
+bool MemChecks::OverlapsPages(u32 start_address, u32 end_address) const
+{
+  // Let the caller do the full check for ranges wrapping around the address space.
+  if (end_address < start_address)
+    return true;
+
+  const u32 first_page = start_address >> PowerPC::HW_PAGE_INDEX_SHIFT;
+  const u32 last_page = end_address >> PowerPC::HW_PAGE_INDEX_SHIFT;
+  for (u32 page = first_page; page <= last_page; ++page)
+  {
+    if (m_pages_with_mem_checks[page])
+      return true;
+  }
+  return false;
+}
+
+void MemChecks::RebuildPageMap()
+{
+  if (m_mem_checks.empty())
+  {
+    // Don't hold on to the map when memchecks aren't in use.
+    m_pages_with_mem_checks = {};
+    return;
+  }
+
+  m_pages_with_mem_checks.assign(size_t(1) << (32 - PowerPC::HW_PAGE_INDEX_SHIFT), false);
+  for (const TMemCheck& mc : m_mem_checks)
+  {
+    const u32 first_page = mc.start_address >> PowerPC::HW_PAGE_INDEX_SHIFT;
+    const u32 last_page = mc.end_address >> PowerPC::HW_PAGE_INDEX_SHIFT;
+    for (u32 page = first_page; page <= last_page; ++page)
+      m_pages_with_mem_checks[page] = true;
+  }
+}
+
 bool TMemCheck::Action(Common::DebugInterface* debug_interface, u64 value, u32 addr, bool write,
                        size_t size, u32 pc)
 {
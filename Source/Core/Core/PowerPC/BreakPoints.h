@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -81,7 +82,13 @@ public:
   void ClearAllTemporary();
 
 private:
+  TBreakPoint* FindBreakPoint(u32 address);
+  void RebuildIndex();
+
   TBreakPoints m_breakpoints;
+  // Address -> index into m_breakpoints, so that the per-instruction checks don't have to scan
+  // every breakpoint.
+  std::unordered_map<u32, size_t> m_breakpoint_indices;
 };
 
 // Memory breakpoints
@@ -108,5 +115,12 @@ public:
   bool HasAny() const { return !m_mem_checks.empty(); }
 
 private:
+  // Whether any HW page between the two addresses (inclusive) overlaps a memcheck.
+  bool OverlapsPages(u32 start_address, u32 end_address) const;
+  void RebuildPageMap();
+
   TMemChecks m_mem_checks;
+  // Whether each HW page overlaps a memcheck. This lets GetMemCheck, which is called for every
+  // slow memory access while there are memchecks, reject most addresses without a scan.
+  std::vector<bool> m_pages_with_mem_checks;
 };
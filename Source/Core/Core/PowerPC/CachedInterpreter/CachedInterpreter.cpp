@@ -3,6 +3,9 @@
 
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 
+#include <bit>
+#include <type_traits>
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Core/ConfigManager.h"
@@ -11,10 +14,25 @@
 #include "Core/HW/CPU.h"
 #include "Core/PowerPC/Gekko.h"
 #include "Core/PowerPC/Jit64Common/Jit64Constants.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
+// Operands of an instruction which are decoded when its block is compiled rather than every time
+// the instruction runs.
+struct DecodedOperands
+{
+  u32 imm;     // Immediate (already shifted), rotation mask, or count
+  u32 target;  // Target of a fused branch, or a second count
+  u8 d;        // Destination register, or the CR bit tested by a fused branch
+  u8 a;
+  u8 b;  // Second source register, or rotation amount
+  u8 crf;
+};
+
+using DecodedCallback = void (*)(const DecodedOperands&);
+
 struct CachedInterpreter::Instruction
 {
   using CommonCallback = void (*)(UGeckoInstruction);
@@ -31,20 +49,31 @@ struct CachedInterpreter::Instruction
   {
   }
 
+  Instruction(const DecodedCallback c, const DecodedOperands& o)
+      : decoded_callback(c), operands(o), type(Type::Decoded)
+  {
+  }
+
   enum class Type
   {
     Abort,
     Common,
     Conditional,
+    Decoded,
   };
 
   union
   {
     const CommonCallback common_callback;
     const ConditionalCallback conditional_callback;
+    const DecodedCallback decoded_callback;
   };
 
-  u32 data = 0;
+  union
+  {
+    u32 data = 0;
+    DecodedOperands operands;
+  };
   Type type = Type::Abort;
 };
 
@@ -100,6 +129,10 @@ void CachedInterpreter::ExecuteOneBlock()
         return;
       break;
 
+    case Instruction::Type::Decoded:
+      code->decoded_callback(code->operands);
+      break;
+
     default:
       ERROR_LOG_FMT(POWERPC, "Unknown CachedInterpreter Instruction: {}",
                     static_cast<int>(code->type));
@@ -141,14 +174,217 @@ static void EndBlock(UGeckoInstruction data)
   PowerPC::UpdatePerformanceMonitor(data.hex, 0, 0, PowerPC::ppcState);
 }
 
-static void UpdateNumLoadStoreInstructions(UGeckoInstruction data)
+// Ends the block and updates the performance monitor with the downcount in imm, and the number of
+// load/store and floating point instructions in the low and high halves of target.
+static void EndBlockWithCounts(const DecodedOperands& operands)
+{
+  PowerPC::ppcState.pc = PowerPC::ppcState.npc;
+  PowerPC::ppcState.downcount -= operands.imm;
+  PowerPC::UpdatePerformanceMonitor(operands.imm, operands.target & 0xffff, operands.target >> 16,
+                                    PowerPC::ppcState);
+}
+
+// Pre-decoded forms of the most common instructions. Only forms which don't update CR0 or XER are
+// decoded, everything else goes through the regular interpreter functions.
+
+static void LoadImmediate(const DecodedOperands& operands)
+{
+  PowerPC::ppcState.gpr[operands.d] = operands.imm;
+}
+
+static void AddImmediate(const DecodedOperands& operands)
+{
+  PowerPC::ppcState.gpr[operands.d] = PowerPC::ppcState.gpr[operands.a] + operands.imm;
+}
+
+static void OrImmediate(const DecodedOperands& operands)
+{
+  PowerPC::ppcState.gpr[operands.d] = PowerPC::ppcState.gpr[operands.a] | operands.imm;
+}
+
+static void XorImmediate(const DecodedOperands& operands)
+{
+  PowerPC::ppcState.gpr[operands.d] = PowerPC::ppcState.gpr[operands.a] ^ operands.imm;
+}
+
+static void RotateAndMask(const DecodedOperands& operands)
+{
+  PowerPC::ppcState.gpr[operands.d] =
+      std::rotl(PowerPC::ppcState.gpr[operands.a], operands.b) & operands.imm;
+}
+
+static void Move(const DecodedOperands& operands)
 {
-  PowerPC::UpdatePerformanceMonitor(0, data.hex, 0, PowerPC::ppcState);
+  PowerPC::ppcState.gpr[operands.d] = PowerPC::ppcState.gpr[operands.a];
 }
 
-static void UpdateNumFloatingPointInstructions(UGeckoInstruction data)
+static void Add(const DecodedOperands& operands)
 {
-  PowerPC::UpdatePerformanceMonitor(0, 0, data.hex, PowerPC::ppcState);
+  PowerPC::ppcState.gpr[operands.d] =
+      PowerPC::ppcState.gpr[operands.a] + PowerPC::ppcState.gpr[operands.b];
+}
+
+static void LoadWord(const DecodedOperands& operands)
+{
+  const u32 address = (operands.a ? PowerPC::ppcState.gpr[operands.a] : 0) + operands.imm;
+  const u32 value = PowerPC::Read_U32(address);
+  if (!(PowerPC::ppcState.Exceptions & EXCEPTION_DSI))
+    PowerPC::ppcState.gpr[operands.d] = value;
+}
+
+static void StoreWord(const DecodedOperands& operands)
+{
+  const u32 address = (operands.a ? PowerPC::ppcState.gpr[operands.a] : 0) + operands.imm;
+  PowerPC::Write_U32(PowerPC::ppcState.gpr[operands.d], address);
+}
+
+template <typename T>
+static void SetCompareResult(u32 crf, T a, T b)
+{
+  u32 cr_field;
+
+  if (a < b)
+    cr_field = PowerPC::CR_LT;
+  else if (a > b)
+    cr_field = PowerPC::CR_GT;
+  else
+    cr_field = PowerPC::CR_EQ;
+
+  if (PowerPC::ppcState.GetXER_SO())
+    cr_field |= PowerPC::CR_SO;
+
+  PowerPC::ppcState.cr.SetField(crf, cr_field);
+}
+
+template <bool is_signed, bool is_immediate>
+static void Compare(const DecodedOperands& operands)
+{
+  using T = std::conditional_t<is_signed, s32, u32>;
+  const u32 b = is_immediate ? operands.imm : PowerPC::ppcState.gpr[operands.b];
+  SetCompareResult(operands.crf, static_cast<T>(PowerPC::ppcState.gpr[operands.a]),
+                   static_cast<T>(b));
+}
+
+// A compare followed by a conditional branch which only tests a CR bit. npc has already been set
+// to the instruction after the branch.
+template <bool is_signed, bool is_immediate>
+static void CompareAndBranch(const DecodedOperands& operands)
+{
+  Compare<is_signed, is_immediate>(operands);
+
+  const u32 bit = operands.d & 0x1f;
+  const u32 branch_if_true = operands.d >> 5;
+  if (PowerPC::ppcState.cr.GetBit(bit) == branch_if_true)
+    PowerPC::ppcState.npc = operands.target;
+}
+
+// Returns the pre-decoded form of the instruction, or nullptr if it has none.
+static DecodedCallback DecodeInstruction(UGeckoInstruction inst, DecodedOperands* operands)
+{
+  *operands = {};
+
+  switch (inst.OPCD)
+  {
+  case 10:  // cmpli
+    *operands = {
+        .imm = inst.UIMM, .a = static_cast<u8>(inst.RA), .crf = static_cast<u8>(inst.CRFD)};
+    return Compare<false, true>;
+  case 11:  // cmpi
+    *operands = {.imm = static_cast<u32>(s32{inst.SIMM_16}),
+                 .a = static_cast<u8>(inst.RA),
+                 .crf = static_cast<u8>(inst.CRFD)};
+    return Compare<true, true>;
+  case 14:  // addi
+  case 15:  // addis
+  {
+    const u32 imm = static_cast<u32>(s32{inst.SIMM_16});
+    *operands = {.imm = inst.OPCD == 15 ? imm << 16 : imm,
+                 .d = static_cast<u8>(inst.RD),
+                 .a = static_cast<u8>(inst.RA)};
+    return inst.RA ? AddImmediate : LoadImmediate;
+  }
+  case 21:  // rlwinmx
+    if (inst.Rc)
+      return nullptr;
+    *operands = {.imm = MakeRotationMask(inst.MB, inst.ME),
+                 .d = static_cast<u8>(inst.RA),
+                 .a = static_cast<u8>(inst.RS),
+                 .b = static_cast<u8>(inst.SH)};
+    return RotateAndMask;
+  case 24:  // ori
+  case 25:  // oris
+  case 26:  // xori
+  case 27:  // xoris
+  {
+    const bool shifted = inst.OPCD == 25 || inst.OPCD == 27;
+    *operands = {.imm = shifted ? u32{inst.UIMM} << 16 : u32{inst.UIMM},
+                 .d = static_cast<u8>(inst.RA),
+                 .a = static_cast<u8>(inst.RS)};
+    return inst.OPCD <= 25 ? OrImmediate : XorImmediate;
+  }
+  case 32:  // lwz
+  case 36:  // stw
+    *operands = {.imm = static_cast<u32>(s32{inst.SIMM_16}),
+                 .d = static_cast<u8>(inst.RD),
+                 .a = static_cast<u8>(inst.RA)};
+    return inst.OPCD == 32 ? LoadWord : StoreWord;
+  case 31:
+    switch (inst.SUBOP10)
+    {
+    case 0:   // cmp
+    case 32:  // cmpl
+      *operands = {.a = static_cast<u8>(inst.RA),
+                   .b = static_cast<u8>(inst.RB),
+                   .crf = static_cast<u8>(inst.CRFD)};
+      return inst.SUBOP10 == 0 ? Compare<true, false> : Compare<false, false>;
+    case 266:  // addx without OE
+      if (inst.Rc)
+        return nullptr;
+      *operands = {.d = static_cast<u8>(inst.RD),
+                   .a = static_cast<u8>(inst.RA),
+                   .b = static_cast<u8>(inst.RB)};
+      return Add;
+    case 444:  // orx, when used as mr
+      if (inst.Rc || inst.RS != inst.RB)
+        return nullptr;
+      *operands = {.d = static_cast<u8>(inst.RA), .a = static_cast<u8>(inst.RS)};
+      return Move;
+    default:
+      return nullptr;
+    }
+  default:
+    return nullptr;
+  }
+}
+
+// Returns the fused form of a decoded compare, or nullptr if the instruction isn't a compare.
+static DecodedCallback GetCompareAndBranch(DecodedCallback compare)
+{
+  if (compare == Compare<true, true>)
+    return CompareAndBranch<true, true>;
+  if (compare == Compare<false, true>)
+    return CompareAndBranch<false, true>;
+  if (compare == Compare<true, false>)
+    return CompareAndBranch<true, false>;
+  if (compare == Compare<false, false>)
+    return CompareAndBranch<false, false>;
+  return nullptr;
+}
+
+// Whether a compare right before the branch can be fused into it. This is the case for conditional
+// branches which only test a CR bit.
+static bool CanFuseIntoBranch(const PPCAnalyst::CodeOp& branch, bool debugging)
+{
+  const UGeckoInstruction inst = branch.inst;
+  if (inst.OPCD != 16 || inst.AA || inst.LK || branch.skip)
+    return false;
+  if (!(inst.BO & BO_DONT_DECREMENT_FLAG) || (inst.BO & BO_DONT_CHECK_CONDITION))
+    return false;
+
+  // The branch must run as a regular instruction of the block.
+  if (debugging && PowerPC::breakpoints.IsAddressBreakPoint(branch.address))
+    return false;
+  return HLE::GetHookByFunctionAddress(branch.address) == 0;
 }
 
 static void WritePC(UGeckoInstruction data)
@@ -264,6 +500,17 @@ void CachedInterpreter::Jit(u32 address)
   b->checkedEntry = GetCodePtr();
   b->normalEntry = GetCodePtr();
 
+  // The performance monitor counts are packed into 16 bits each when the block ends.
+  static_assert(code_buffer_size <= 0x10000);
+  const auto get_block_counts = [this] {
+    return DecodedOperands{.imm = static_cast<u32>(js.downcountAmount),
+                           .target = js.numLoadStoreInst | (js.numFloatingPointInst << 16)};
+  };
+
+  // A compare which is going to be run by the conditional branch after it.
+  DecodedCallback fused_branch = nullptr;
+  DecodedOperands fused_operands{};
+
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
     PPCAnalyst::CodeOp& op = m_code_buffer[i];
@@ -299,7 +546,35 @@ void CachedInterpreter::Jit(u32 address)
         js.firstFPInstructionFound = true;
       }
 
-      m_code.emplace_back(PPCTables::GetInterpreterOp(op.inst), op.inst);
+      DecodedOperands operands;
+      const DecodedCallback decoded = DecodeInstruction(op.inst, &operands);
+      const DecodedCallback compare_and_branch = GetCompareAndBranch(decoded);
+
+      if (fused_branch)
+      {
+        // npc has been set to the next instruction by WritePC, as branches end the block.
+        m_code.emplace_back(fused_branch, fused_operands);
+        fused_branch = nullptr;
+      }
+      else if (compare_and_branch && i + 1 < code_block.m_num_instructions &&
+               CanFuseIntoBranch(m_code_buffer[i + 1], m_enable_debugging))
+      {
+        const PPCAnalyst::CodeOp& branch = m_code_buffer[i + 1];
+        fused_branch = compare_and_branch;
+        fused_operands = operands;
+        fused_operands.d = static_cast<u8>(branch.inst.BI | (((branch.inst.BO >> 3) & 1) << 5));
+        fused_operands.target =
+            branch.address + static_cast<u32>(SignExt16(s16(branch.inst.BD << 2)));
+      }
+      else if (decoded)
+      {
+        m_code.emplace_back(decoded, operands);
+      }
+      else
+      {
+        m_code.emplace_back(PPCTables::GetInterpreterOp(op.inst), op.inst);
+      }
+
       if (memcheck)
         m_code.emplace_back(CheckDSI, js.downcountAmount);
       if (check_program_exception)
@@ -307,19 +582,13 @@ void CachedInterpreter::Jit(u32 address)
       if (idle_loop)
         m_code.emplace_back(CheckIdle, js.blockStart);
       if (endblock)
-      {
-        m_code.emplace_back(EndBlock, js.downcountAmount);
-        m_code.emplace_back(UpdateNumLoadStoreInstructions, js.numLoadStoreInst);
-        m_code.emplace_back(UpdateNumFloatingPointInstructions, js.numFloatingPointInst);
-      }
+        m_code.emplace_back(EndBlockWithCounts, get_block_counts());
     }
   }
   if (code_block.m_broken)
   {
     m_code.emplace_back(WriteBrokenBlockNPC, nextPC);
-    m_code.emplace_back(EndBlock, js.downcountAmount);
-    m_code.emplace_back(UpdateNumLoadStoreInstructions, js.numLoadStoreInst);
-    m_code.emplace_back(UpdateNumFloatingPointInstructions, js.numFloatingPointInst);
+    m_code.emplace_back(EndBlockWithCounts, get_block_counts());
   }
   m_code.emplace_back();
 
@@ -853,6 +853,7 @@ static void WriteMemory()
   auto& memory = system.GetMemory();
   u8* dst = memory.GetPointer(addr);
   Hex2mem(dst, s_cmd_bfr + i + 1, len);
+  memory.MarkWritten(addr, len);
   SendReply("OK");
 }
 
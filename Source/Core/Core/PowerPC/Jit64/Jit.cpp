@@ -23,6 +23,7 @@
 #include "Common/PerformanceCounter.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/Trace.h"
 #include "Common/x64ABI.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -234,7 +235,20 @@ bool Jit64::HandleFault(uintptr_t access_address, SContext* ctx)
 
   const auto logical_base_ptr = reinterpret_cast<uintptr_t>(memory.GetLogicalBase());
   if (access_address >= logical_base_ptr && access_address < logical_base_ptr + 0x100010000)
-    return BackPatch(static_cast<u32>(access_address - logical_base_ptr), ctx);
+  {
+    const u32 em_address = static_cast<u32>(access_address - logical_base_ptr);
+
+    // If the address has a page table translation, map it and retry the access. This way, the
+    // access stays on the fast path instead of being backpatched to the slow path for good.
+    const auto it = m_back_patch_info.find(reinterpret_cast<u8*>(ctx->CTX_PC));
+    if (it != m_back_patch_info.end() &&
+        PowerPC::MapPageTableTranslation(em_address, !it->second.read))
+    {
+      return true;
+    }
+
+    return BackPatch(em_address, ctx);
+  }
 
   return false;
 }
@@ -255,6 +269,9 @@ bool Jit64::BackPatch(u32 emAddress, SContext* ctx)
 
   TrampolineInfo& info = it->second;
 
+  if (m_event_counters_enabled)
+    m_event_counters.Increment(Profiler::JitEvent::Backpatch, info.pc);
+
   u8* exceptionHandler = nullptr;
   if (jo.memcheck)
   {
@@ -277,6 +294,7 @@ bool Jit64::BackPatch(u32 emAddress, SContext* ctx)
   // Generate the trampoline.
   const u8* trampoline = trampolines.GenerateTrampoline(info);
   js.generatingTrampoline = false;
+  m_trampoline_code_used = m_trampoline_code_size - trampolines.GetSpaceLeft();
   js.trampolineExceptionHandler = nullptr;
 
   u8* start = info.start;
@@ -356,6 +374,10 @@ void Jit64::Init()
   AddChildCodeSpace(&m_far_code, farcode_size);
   m_const_pool.Init(AllocChildCodeSpace(constpool_size), constpool_size);
   ResetCodePtr();
+  m_near_code_size = region_size;
+  m_far_code_size = farcode_size;
+  m_trampoline_code_size = trampolines_size;
+  m_trampoline_code_used = 0;
 
   // BLR optimization has the same consequences as block linking, as well as
   // depending on the fault handler to be safe in the event of excessive BL.
@@ -388,6 +410,7 @@ void Jit64::ClearCache()
   blocks.Clear();
   blocks.ClearRangesToFree();
   trampolines.ClearCodeSpace();
+  m_trampoline_code_used = 0;
   m_far_code.ClearCodeSpace();
   m_const_pool.Clear();
   ClearCodeSpace();
@@ -424,6 +447,8 @@ void Jit64::FallBackToInterpreter(UGeckoInstruction inst)
   gpr.Flush();
   fpr.Flush();
 
+  CountJitEvent(Profiler::JitEvent::InterpreterFallback, RSCRATCH);
+
   if (js.op->opinfo->flags & FL_ENDBLOCK)
   {
     MOV(32, PPCSTATE(pc), Imm32(js.compilerPC));
@@ -575,6 +600,8 @@ void Jit64::FakeBLCall(u32 after)
   PUSH(RSCRATCH2);
   FixupBranch skip_exit = CALL();
   POP(RSCRATCH2);
+  // We only get here after returning from other blocks, which may have changed any register.
+  gpr.ClearResidentRegisters();
   JustWriteExit(after, false, 0);
   SetJumpTarget(skip_exit);
 }
@@ -605,6 +632,7 @@ void Jit64::JustWriteExit(u32 destination, bool bl, u32 after)
   linkData.exitAddress = destination;
   linkData.linkStatus = false;
   linkData.call = bl;
+  linkData.resident_gprs = gpr.GetResidentRegisters();
 
   MOV(32, PPCSTATE(pc), Imm32(destination));
 
@@ -623,6 +651,7 @@ void Jit64::JustWriteExit(u32 destination, bool bl, u32 after)
 
     SetJumpTarget(after_fixup);
     POP(RSCRATCH);
+    gpr.ClearResidentRegisters();
     JustWriteExit(after, false, 0);
   }
   else
@@ -640,6 +669,7 @@ void Jit64::WriteExitDestInRSCRATCH(bool bl, u32 after)
 {
   if (!m_enable_blr_optimization)
     bl = false;
+  CountJitEvent(Profiler::JitEvent::DispatcherExit, RSCRATCH2);
   MOV(32, PPCSTATE(pc), R(RSCRATCH));
   Cleanup();
 
@@ -654,6 +684,7 @@ void Jit64::WriteExitDestInRSCRATCH(bool bl, u32 after)
   {
     CALL(asm_routines.dispatcher);
     POP(RSCRATCH);
+    gpr.ClearResidentRegisters();
     JustWriteExit(after, false, 0);
   }
   else
@@ -682,6 +713,7 @@ void Jit64::WriteBLRExit()
 
 void Jit64::WriteRfiExitDestInRSCRATCH()
 {
+  CountJitEvent(Profiler::JitEvent::DispatcherExit, RSCRATCH2);
   MOV(32, PPCSTATE(pc), R(RSCRATCH));
   MOV(32, PPCSTATE(npc), R(RSCRATCH));
   Cleanup();
@@ -692,6 +724,15 @@ void Jit64::WriteRfiExitDestInRSCRATCH()
   JMP(asm_routines.dispatcher, true);
 }
 
+void Jit64::CountJitEvent(Profiler::JitEvent event, X64Reg scratch)
+{
+  if (!m_event_counters_enabled)
+    return;
+
+  MOV(64, R(scratch), ImmPtr(m_event_counters.GetCounter(event, js.compilerPC)));
+  ADD(64, MatR(scratch), Imm8(1));
+}
+
 void Jit64::WriteIdleExit(u32 destination)
 {
   ABI_PushRegistersAndAdjustStack({}, 0);
@@ -771,8 +812,11 @@ void Jit64::Jit(u32 em_address)
 
 void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 {
+  TRACE_ZONE("Jit64::Jit");
+
   if (m_cleanup_after_stackfault)
   {
+    CountCacheFlush(JitCacheFlushCause::StackFault);
     ClearCache();
     m_cleanup_after_stackfault = false;
 #ifdef _WIN32
@@ -786,6 +830,11 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     if (!SConfig::GetInstance().bJITNoBlockCache)
     {
       WARN_LOG_FMT(POWERPC, "flushing trampoline code cache, please report if this happens a lot");
+      CountCacheFlush(JitCacheFlushCause::TrampolinesFull);
+    }
+    else
+    {
+      CountCacheFlush(JitCacheFlushCause::NoBlockCache);
     }
     ClearCache();
   }
@@ -819,11 +868,31 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+        analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_SUCCESSOR_CARRY);
       }
       Trace();
     }
   }
 
+  // With tiered compilation, blocks start out without the analyzer optimizations, which make
+  // compilation noticeably slower, and get recompiled with them once they turn out to be hot.
+  // The options have to stay in effect until the block has been emitted, since the instruction
+  // implementations check them as well.
+  js.baselineTier = ShouldCompileBaselineTier(em_address);
+  if (js.baselineTier)
+  {
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_SUCCESSOR_CARRY);
+  }
+  else if (!m_enable_debugging)
+  {
+    EnableOptimization();
+  }
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
@@ -867,13 +936,24 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
       return;
     }
+
+    blocks.DiscardBlock(*b);
   }
 
   if (clear_cache_and_retry_on_failure)
   {
     // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+    // Make room by evicting the oldest blocks if possible, otherwise clear the entire JIT cache,
+    // and retry.
+    if (m_generational_code_space_enabled && blocks.EvictOldestGeneration())
+    {
+      INFO_LOG_FMT(POWERPC, "Evicted the oldest generation of blocks from the code caches");
+      Jit(em_address, true);
+      return;
+    }
+
     WARN_LOG_FMT(POWERPC, "flushing code caches, please report if this happens a lot");
+    CountCacheFlush(JitCacheFlushCause::CodeSpaceFull);
     ClearCache();
     Jit(em_address, false);
     return;
@@ -918,9 +998,10 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   js.curBlock = b;
   js.numLoadStoreInst = 0;
   js.numFloatingPointInst = 0;
+  js.sourceLines.clear();
 
-  // TODO: Test if this or AlignCode16 make a difference from GetCodePtr
-  u8* const start = AlignCode4();
+  // Aligning the entry keeps the first instructions of the block within one fetch block.
+  u8* const start = AlignCodeTo(m_block_alignment);
   b->checkedEntry = start;
   b->normalEntry = start;
 
@@ -942,16 +1023,46 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     ADD(64, MDisp(ABI_PARAM1, offset), Imm8(1));
     ABI_CallFunction(QueryPerformanceCounter);
   }
-#if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
-  // should help logged stack-traces become more accurate
-  MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
-#endif
 
   // Start up the register allocators
   // They use the information in gpa/fpa to preload commonly used registers.
   gpr.Start();
   fpr.Start();
 
+  // Load the guest registers of the register contract. Linked blocks which exit with these
+  // registers still in place enter at residentEntry and skip the loads.
+  b->resident_gprs = ComputeRegisterContract();
+  if (b->resident_gprs != JitBlock::NO_RESIDENT_REGISTERS)
+  {
+    gpr.BindResidentRegisters(b->resident_gprs);
+    b->residentEntry = GetWritableCodePtr();
+  }
+
+  if (js.baselineTier)
+  {
+    // Count down the executions of this block and recompile it with the full optimizing tier
+    // once the counter runs out.
+    b->tier_up_counter = TIER_UP_THRESHOLD;
+
+    SwitchToFarCode();
+    const u8* tier_up = GetCodePtr();
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionC(JitInterface::CompileExceptionCheck,
+                      static_cast<u32>(JitInterface::ExceptionType::HotBlock));
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    JMP(asm_routines.dispatcher_no_check, true);
+    SwitchToNearCode();
+
+    MOV(64, R(RSCRATCH), ImmPtr(&b->tier_up_counter));
+    SUB(32, MatR(RSCRATCH), Imm8(1));
+    J_CC(CC_Z, tier_up);
+  }
+#if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
+  // should help logged stack-traces become more accurate
+  MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+#endif
+
   js.downcountAmount = 0;
   js.skipInstructions = 0;
   js.carryFlag = CarryFlag::InPPCState;
@@ -1002,6 +1113,8 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     PPCAnalyst::CodeOp& op = m_code_buffer[i];
 
     js.compilerPC = op.address;
+    if (JitRegister::IsJitDumpEnabled())
+      js.sourceLines.push_back({GetCodePtr(), op.address});
     js.op = &op;
     js.fpr_is_store_safe = op.fprIsStoreSafeBeforeInst;
     js.instructionNumber = i;
@@ -1011,6 +1124,10 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     js.fastmemLoadStore = nullptr;
     js.fixupExceptionHandler = false;
 
+    // Only trust copies of flushed registers within the instruction which flushed them, as there
+    // is no telling what e.g. an interpreter fallback did with the guest registers since.
+    gpr.ClearResidentRegisters();
+
     if (!m_enable_debugging)
       js.downcountAmount += PatchEngine::GetSpeedhackCycles(js.compilerPC);
 
@@ -1024,7 +1141,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
     // Gather pipe writes using an immediate address are explicitly tracked.
     if (jo.optimizeGatherPipe &&
-        (js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_SIZE || js.mustCheckFifo))
+        (js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_BATCH_SIZE || js.mustCheckFifo))
     {
       js.fifoBytesSinceCheck = 0;
       js.mustCheckFifo = false;
@@ -1211,6 +1328,8 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     js.skipInstructions = 0;
   }
 
+  gpr.ClearResidentRegisters();
+
   if (code_block.m_broken)
   {
     gpr.Flush();
@@ -1263,6 +1382,44 @@ void Jit64::EnableOptimization()
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_SUCCESSOR_CARRY);
+}
+
+static bool IsSpeculativeConstant(u32 value)
+{
+  return PowerPC::IsOptimizableGatherPipeWrite(value) ||
+         PowerPC::IsOptimizableGatherPipeWrite(value - 0x8000) || value == 0xCC000000;
+}
+
+ResidentRegisters Jit64::ComputeRegisterContract() const
+{
+  ResidentRegisters contract;
+  contract.fill(-1);
+
+  // Code emitted before the contract loads would get skipped when entering at residentEntry.
+  if (!m_register_contracts_enabled || m_enable_debugging || jo.profile_blocks || ImHereDebug)
+    return contract;
+
+  const bool speculative_constants = js.noSpeculativeConstantsAddresses.find(js.blockStart) ==
+                                     js.noSpeculativeConstantsAddresses.end();
+
+  // Pick the inputs of the block in the order in which they are first read, since those are the
+  // ones that would get loaded right away anyway.
+  BitSet32 inputs;
+  BitSet32 remaining = code_block.m_gpr_inputs;
+  for (u32 i = 0; i < code_block.m_num_instructions && remaining; i++)
+  {
+    for (auto reg : m_code_buffer[i].regsIn & remaining)
+    {
+      remaining[reg] = false;
+      if (speculative_constants && IsSpeculativeConstant(PowerPC::ppcState.gpr[reg]))
+        continue;
+      if (inputs.Count() < MAX_REGISTER_CONTRACT_SIZE)
+        inputs[reg] = true;
+    }
+  }
+
+  return gpr.MakeResidentContract(inputs);
 }
 
 void Jit64::IntializeSpeculativeConstants()
@@ -1277,9 +1434,7 @@ void Jit64::IntializeSpeculativeConstants()
   for (auto i : code_block.m_gpr_inputs)
   {
     u32 compileTimeValue = PowerPC::ppcState.gpr[i];
-    if (PowerPC::IsOptimizableGatherPipeWrite(compileTimeValue) ||
-        PowerPC::IsOptimizableGatherPipeWrite(compileTimeValue - 0x8000) ||
-        compileTimeValue == 0xCC000000)
+    if (IsSpeculativeConstant(compileTimeValue))
     {
       if (!target)
       {
@@ -70,6 +70,11 @@ public:
   BitSet8 ComputeStaticGQRs(const PPCAnalyst::CodeBlock&) const;
 
   void IntializeSpeculativeConstants();
+  ResidentRegisters ComputeRegisterContract() const;
+
+  // The maximum number of guest registers a block expects to be kept in host registers by the
+  // blocks linking to it.
+  static constexpr u32 MAX_REGISTER_CONTRACT_SIZE = 4;
 
   JitBlockCache* GetBlockCache() override { return &blocks; }
   void Trace();
@@ -94,6 +99,8 @@ public:
   void WriteRfiExitDestInRSCRATCH();
   void WriteIdleExit(u32 destination);
   bool Cleanup();
+  // Increments the counter of the event at the current instruction if event counting is enabled.
+  void CountJitEvent(Profiler::JitEvent event, Gen::X64Reg scratch);
 
   void GenerateConstantOverflow(bool overflow);
   void GenerateConstantOverflow(s64 val);
@@ -116,7 +116,9 @@ void Jit64AsmRoutineManager::Generate()
     // Keep a copy for later.
     MOV(32, R(RSCRATCH_EXTRA), R(RSCRATCH));
     u64 icache = reinterpret_cast<u64>(m_jit.GetBlockCache()->GetFastBlockMap());
-    AND(32, R(RSCRATCH), Imm32(JitBaseBlockCache::FAST_BLOCK_MAP_MASK << 2));
+    // A map covering the whole address space is indexed by the PC without masking.
+    if (!m_jit.GetBlockCache()->IsFastBlockMapFull())
+      AND(32, R(RSCRATCH), Imm32(JitBaseBlockCache::FAST_BLOCK_MAP_MASK << 2));
     if (icache <= INT_MAX)
     {
       MOV(64, R(RSCRATCH), MScaled(RSCRATCH, SCALE_2, static_cast<s32>(icache)));
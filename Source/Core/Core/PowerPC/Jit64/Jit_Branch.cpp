@@ -111,21 +111,46 @@ void Jit64::bcx(UGeckoInstruction inst)
 
   // USES_CR
 
+  // Baseline tier blocks always end at conditional branches, so the profile counters can be
+  // updated right before the exits, where the flags are about to be clobbered anyway.
+  PPCAnalyst::BranchProfile::Counts* profile_counts = nullptr;
+  if (js.baselineTier && m_branch_profiling_enabled &&
+      ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0 || (inst.BO & BO_DONT_CHECK_CONDITION) == 0))
+  {
+    profile_counts = &js.branchProfile.GetCounts(js.compilerPC);
+  }
+
+  const bool check_ctr = (inst.BO & BO_DONT_DECREMENT_FLAG) == 0;
+  const bool check_condition = (inst.BO & BO_DONT_CHECK_CONDITION) == 0;
+
+  // The exit of a branch which is almost never taken goes to the far code, so that the code after
+  // the branch follows without a jump. The last test jumps there if the branch is taken, while a
+  // CTR test before it still skips over it if the branch is not taken. Exits which call the next
+  // block need the far code themselves, so they stay where they are.
+  const bool cold = js.op->branchIsCold && !inst.LK && (check_ctr || check_condition);
+
   FixupBranch pCTRDontBranch;
-  if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)  // Decrement and test CTR
+  if (check_ctr)  // Decrement and test CTR
   {
     SUB(32, PPCSTATE_CTR, Imm8(1));
-    if (inst.BO & BO_BRANCH_IF_CTR_0)
+    const bool jump_if_taken = cold && !check_condition;
+    if (!!(inst.BO & BO_BRANCH_IF_CTR_0) != jump_if_taken)
       pCTRDontBranch = J_CC(CC_NZ, true);
     else
       pCTRDontBranch = J_CC(CC_Z, true);
   }
 
   FixupBranch pConditionDontBranch;
-  if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)  // Test a CR bit
+  if (check_condition)  // Test a CR bit
   {
-    pConditionDontBranch =
-        JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), !(inst.BO_2 & BO_BRANCH_IF_TRUE));
+    const bool jump_if_set = !!(inst.BO_2 & BO_BRANCH_IF_TRUE) == cold;
+    pConditionDontBranch = JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), jump_if_set);
+  }
+
+  if (cold)
+  {
+    SwitchToFarCode();
+    SetJumpTarget(check_condition ? pConditionDontBranch : pCTRDontBranch);
   }
 
   if (inst.LK)
@@ -153,6 +178,12 @@ void Jit64::bcx(UGeckoInstruction inst)
     gpr.Flush();
     fpr.Flush();
 
+    if (profile_counts)
+    {
+      MOV(64, R(RSCRATCH), ImmPtr(&profile_counts->taken));
+      ADD(32, MatR(RSCRATCH), Imm8(1));
+    }
+
     if (js.op->branchIsIdleLoop)
     {
       WriteIdleExit(js.op->branchTo);
@@ -163,15 +194,31 @@ void Jit64::bcx(UGeckoInstruction inst)
     }
   }
 
-  if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
-    SetJumpTarget(pConditionDontBranch);
-  if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
-    SetJumpTarget(pCTRDontBranch);
+  if (cold)
+  {
+    SwitchToNearCode();
+    if (check_ctr && check_condition)
+      SetJumpTarget(pCTRDontBranch);
+  }
+  else
+  {
+    if (check_condition)
+      SetJumpTarget(pConditionDontBranch);
+    if (check_ctr)
+      SetJumpTarget(pCTRDontBranch);
+  }
 
   if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE))
   {
     gpr.Flush();
     fpr.Flush();
+
+    if (profile_counts)
+    {
+      MOV(64, R(RSCRATCH), ImmPtr(&profile_counts->not_taken));
+      ADD(32, MatR(RSCRATCH), Imm8(1));
+    }
+
     WriteExit(js.compilerPC + 4);
   }
 }
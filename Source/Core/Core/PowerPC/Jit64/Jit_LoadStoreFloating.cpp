@@ -109,7 +109,7 @@ void Jit64::stfXXX(UGeckoInstruction inst)
     {
       RCOpArg Rs = fpr.Use(s, RCMode::Read);
       RegCache::Realize(Rs);
-      CVTSD2SS(XMM0, Rs);
+      ConvertDoubleToSingleScalar(XMM0, Rs);
       MOVD_xmm(R(RSCRATCH), XMM0);
     }
     else
@@ -48,7 +48,7 @@ void Jit64::psq_stXX(UGeckoInstruction inst)
     MOV(32, Ra, R(RSCRATCH_EXTRA));
 
   if (w)
-    CVTSD2SS(XMM0, Rs);  // one
+    ConvertDoubleToSingleScalar(XMM0, Rs);  // one
   else
     CVTPD2PS(XMM0, Rs);  // pair
 
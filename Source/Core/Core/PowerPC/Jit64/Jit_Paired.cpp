@@ -114,10 +114,14 @@ void Jit64::ps_muls(UGeckoInstruction inst)
     PanicAlertFmt("ps_muls WTF!!!");
   }
   if (round_input)
+  {
     Force25BitPrecision(XMM1, R(Rc_duplicated), XMM0);
-  else if (XMM1 != Rc_duplicated)
-    MOVAPD(XMM1, Rc_duplicated);
-  MULPD(XMM1, Ra);
+    MULPD(XMM1, Ra);
+  }
+  else
+  {
+    avx_op(&XEmitter::VMULPD, &XEmitter::MULPD, XMM1, R(Rc_duplicated), Ra, true, true);
+  }
   HandleNaNs(inst, XMM1, XMM0, Ra, std::nullopt, Rc_duplicated);
   FinalizeSingleResult(Rd, R(XMM1));
 }
@@ -14,6 +14,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 #include "Common/VariantUtil.h"
+#include "Common/x64ABI.h"
 #include "Common/x64Emitter.h"
 #include "Core/PowerPC/Jit64/Jit.h"
 #include "Core/PowerPC/Jit64/RegCache/CachedReg.h"
@@ -265,13 +266,15 @@ void RCX64Reg::Unlock()
   contents = std::monostate{};
 }
 
-RCForkGuard::RCForkGuard(RegCache& rc_) : rc(&rc_), m_regs(rc_.m_regs), m_xregs(rc_.m_xregs)
+RCForkGuard::RCForkGuard(RegCache& rc_)
+    : rc(&rc_), m_regs(rc_.m_regs), m_xregs(rc_.m_xregs), m_resident(rc_.m_resident)
 {
   ASSERT(!rc->IsAnyConstraintActive());
 }
 
 RCForkGuard::RCForkGuard(RCForkGuard&& other) noexcept
-    : rc(other.rc), m_regs(std::move(other.m_regs)), m_xregs(std::move(other.m_xregs))
+    : rc(other.rc), m_regs(std::move(other.m_regs)), m_xregs(std::move(other.m_xregs)),
+      m_resident(other.m_resident)
 {
   other.rc = nullptr;
 }
@@ -284,6 +287,7 @@ void RCForkGuard::EndFork()
   ASSERT(!rc->IsAnyConstraintActive());
   rc->m_regs = m_regs;
   rc->m_xregs = m_xregs;
+  rc->m_resident = m_resident;
   rc = nullptr;
 }
 
@@ -298,6 +302,7 @@ void RegCache::Start()
   {
     m_regs[i] = PPCCachedReg{GetDefaultLocation(i)};
   }
+  ClearResidentRegisters();
 }
 
 void RegCache::SetEmitter(XEmitter* emitter)
@@ -399,6 +404,7 @@ void RegCache::Discard(BitSet32 pregs)
       m_xregs[xr].Unbind();
     }
 
+    InvalidateResident(i);
     m_regs[i].SetDiscarded();
   }
 }
@@ -429,7 +435,16 @@ void RegCache::Flush(BitSet32 pregs)
       m_regs[i].SetFlushed();
       break;
     case PPCCachedReg::LocationType::Bound:
+    {
+      // The host register keeps its copy of the value until it gets reused.
+      const X64Reg xr = RX(i);
+      StoreFromRegister(i);
+      if (ABI_ALL_CALLEE_SAVED[xr])
+        m_resident[xr] = static_cast<s8>(i);
+      break;
+    }
     case PPCCachedReg::LocationType::Immediate:
+      InvalidateResident(i);
       StoreFromRegister(i);
       break;
     }
@@ -442,6 +457,7 @@ void RegCache::Reset(BitSet32 pregs)
   {
     ASSERT_MSG(DYNA_REC, !m_regs[i].IsAway(),
                "Attempted to reset a loaded register (did you mean to flush it?)");
+    InvalidateResident(i);
     m_regs[i].SetFlushed();
   }
 }
@@ -484,6 +500,53 @@ void RegCache::PreloadRegisters(BitSet32 to_preload)
   }
 }
 
+void RegCache::BindResidentRegisters(const ResidentRegisters& contract)
+{
+  for (size_t xr = 0; xr < contract.size(); xr++)
+  {
+    if (contract[xr] < 0)
+      continue;
+
+    const preg_t preg = static_cast<preg_t>(contract[xr]);
+    ASSERT_MSG(DYNA_REC, m_xregs[xr].IsFree(), "Xreg {} is not free", xr);
+    ASSERT_MSG(DYNA_REC, !m_regs[preg].IsAway(), "PPC reg {} is not in its default location",
+               preg);
+
+    m_xregs[xr].SetBoundTo(preg, false);
+    LoadRegister(preg, static_cast<X64Reg>(xr));
+    m_regs[preg].SetBoundTo(static_cast<X64Reg>(xr));
+  }
+}
+
+ResidentRegisters RegCache::MakeResidentContract(BitSet32 pregs) const
+{
+  ResidentRegisters contract;
+  contract.fill(-1);
+
+  size_t count;
+  const X64Reg* order = GetAllocationOrder(&count);
+  auto preg = pregs.begin();
+  for (size_t i = 0; i < count && preg != pregs.end(); i++)
+  {
+    if (!ABI_ALL_CALLEE_SAVED[order[i]])
+      continue;
+
+    contract[order[i]] = static_cast<s8>(*preg);
+    ++preg;
+  }
+  return contract;
+}
+
+void RegCache::ClearResidentRegisters()
+{
+  m_resident.fill(-1);
+}
+
+void RegCache::InvalidateResident(preg_t preg)
+{
+  std::replace(m_resident.begin(), m_resident.end(), static_cast<s8>(preg), s8{-1});
+}
+
 BitSet32 RegCache::RegistersInUse() const
 {
   BitSet32 result;
@@ -507,6 +570,7 @@ void RegCache::FlushX(X64Reg reg)
 
 void RegCache::DiscardRegContentsIfCached(preg_t preg)
 {
+  InvalidateResident(preg);
   if (m_regs[preg].IsBound())
   {
     X64Reg xr = m_regs[preg].Location()->GetSimpleReg();
@@ -517,9 +581,11 @@ void RegCache::DiscardRegContentsIfCached(preg_t preg)
 
 void RegCache::BindToRegister(preg_t i, bool doLoad, bool makeDirty)
 {
+  InvalidateResident(i);
   if (!m_regs[i].IsBound())
   {
     X64Reg xr = GetFreeXReg();
+    m_resident[xr] = -1;
 
     ASSERT_MSG(DYNA_REC, !m_xregs[xr].IsDirty(), "Xreg {} already dirty", static_cast<u32>(xr));
     ASSERT_MSG(DYNA_REC, !m_xregs[xr].IsLocked(), "GetFreeXReg returned locked register");
@@ -702,6 +768,7 @@ void RegCache::Unlock(preg_t preg)
 
 void RegCache::LockX(X64Reg xr)
 {
+  m_resident[xr] = -1;
   m_xregs[xr].Lock();
 }
 
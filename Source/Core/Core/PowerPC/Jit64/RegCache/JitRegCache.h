@@ -22,6 +22,9 @@ class RegCache;
 using preg_t = size_t;
 static constexpr size_t NUM_XREGS = 16;
 
+// For every host register, the guest register it holds an up-to-date copy of, or -1.
+using ResidentRegisters = std::array<s8, NUM_XREGS>;
+
 class RCOpArg
 {
 public:
@@ -117,6 +120,7 @@ private:
   RegCache* rc;
   std::array<PPCCachedReg, 32> m_regs;
   std::array<X64CachedReg, NUM_XREGS> m_xregs;
+  ResidentRegisters m_resident;
 };
 
 class RegCache
@@ -178,6 +182,16 @@ public:
   void PreloadRegisters(BitSet32 pregs);
   BitSet32 RegistersInUse() const;
 
+  // Binds guest registers to the given host registers and loads them, for the block entry of
+  // a register contract. All host registers must be free.
+  void BindResidentRegisters(const ResidentRegisters& contract);
+  // Assigns the given guest registers to callee-saved host registers, as far as they go.
+  ResidentRegisters MakeResidentContract(BitSet32 pregs) const;
+  // The guest registers which have been flushed but whose values are still around in callee-saved
+  // host registers, which survive the calls made on the way out of a block.
+  const ResidentRegisters& GetResidentRegisters() const { return m_resident; }
+  void ClearResidentRegisters();
+
 protected:
   friend class RCOpArg;
   friend class RCX64Reg;
@@ -214,9 +228,12 @@ protected:
 
   bool IsAnyConstraintActive() const;
 
+  void InvalidateResident(preg_t preg);
+
   Jit64& m_jit;
   std::array<PPCCachedReg, 32> m_regs;
   std::array<X64CachedReg, NUM_XREGS> m_xregs;
   std::array<RCConstraint, 32> m_constraints;
+  ResidentRegisters m_resident{};
   Gen::XEmitter* m_emitter = nullptr;
 };
@@ -11,11 +11,29 @@ JitBlockCache::JitBlockCache(JitBase& jit) : JitBaseBlockCache{jit}
 {
 }
 
+static bool SatisfiesRegisterContract(const JitBlock::LinkData& source, const JitBlock& dest)
+{
+  if (!dest.residentEntry)
+    return false;
+
+  for (size_t i = 0; i < dest.resident_gprs.size(); i++)
+  {
+    if (dest.resident_gprs[i] >= 0 && source.resident_gprs[i] != dest.resident_gprs[i])
+      return false;
+  }
+  return true;
+}
+
 void JitBlockCache::WriteLinkBlock(const JitBlock::LinkData& source, const JitBlock* dest)
 {
   u8* location = source.exitPtrs;
-  const u8* address =
-      dest ? dest->checkedEntry : m_jit.GetAsmRoutines()->dispatcher_no_timing_check;
+  const u8* address;
+  if (!dest)
+    address = m_jit.GetAsmRoutines()->dispatcher_no_timing_check;
+  else if (SatisfiesRegisterContract(source, *dest))
+    address = dest->residentEntry;
+  else
+    address = dest->checkedEntry;
   if (source.call)
   {
     Gen::XEmitter emit(location, location + 5);
@@ -25,9 +43,10 @@ void JitBlockCache::WriteLinkBlock(const JitBlock::LinkData& source, const JitBl
   {
     // If we're going to link with the next block, there is no need
     // to emit JMP. So just NOP out the gap to the next block.
-    // Support up to 3 additional bytes because of alignment.
+    // Support up to 15 additional bytes because of alignment. Jumping over a larger gap is
+    // cheaper than running through it.
     s64 offset = address - location;
-    if (offset > 0 && offset <= 5 + 3)
+    if (offset > 0 && offset <= 5 + 15)
     {
       Gen::XEmitter emit(location, location + offset);
       emit.NOP(offset);
@@ -47,6 +66,11 @@ void JitBlockCache::WriteDestroyBlock(const JitBlock& block)
   emit.INT3();
   Gen::XEmitter emit2(block.normalEntry, block.normalEntry + 1);
   emit2.INT3();
+  if (block.residentEntry)
+  {
+    Gen::XEmitter emit3(block.residentEntry, block.residentEntry + 1);
+    emit3.INT3();
+  }
 }
 
 void JitBlockCache::Init()
@@ -225,6 +225,10 @@ public:
   {
     CallLambda(8 * sizeof(T), lambda);
   }
+  void VisitFunction(MMIO::ReadFunction<T> function, void* context) override
+  {
+    CallFunction(8 * sizeof(T), function, context);
+  }
 
 private:
   // Generates code to load a constant to the destination register. In
@@ -278,6 +282,15 @@ private:
     MoveOpArgToReg(sbits, R(ABI_RETURN));
   }
 
+  // Same as CallLambda, minus the trampoline and the std::function indirection.
+  void CallFunction(int sbits, MMIO::ReadFunction<T> function, void* context)
+  {
+    m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+    m_code->ABI_CallFunctionPPC(function, &Core::System::GetInstance(), context, m_address);
+    m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
+    MoveOpArgToReg(sbits, R(ABI_RETURN));
+  }
+
   Gen::X64CodeBlock* m_code;
   BitSet32 m_registers_in_use;
   Gen::X64Reg m_dst_reg;
@@ -807,6 +820,16 @@ void EmuCodeBlock::avx_op(void (XEmitter::*avxOp)(X64Reg, X64Reg, const OpArg&,
   }
 }
 
+void EmuCodeBlock::ConvertDoubleToSingleScalar(X64Reg dst, const OpArg& src)
+{
+  // The SSE form merges the result into dst, so it has to wait for the last write to dst. The
+  // VEX form takes the upper elements from a register of our choosing instead.
+  if (src.IsSimpleReg() && cpu_info.bAVX)
+    VCVTSD2SS(dst, src.GetSimpleReg(), src);
+  else
+    CVTSD2SS(dst, src);
+}
+
 alignas(16) static const u64 psMantissaTruncate[2] = {0xFFFFFFFFF8000000ULL, 0xFFFFFFFFF8000000ULL};
 alignas(16) static const u64 psRoundBit[2] = {0x8000000, 0x8000000};
 
@@ -121,6 +121,9 @@ public:
   // RSCRATCH might get trashed
   void ConvertSingleToDouble(Gen::X64Reg dst, Gen::X64Reg src, bool src_is_gpr = false);
   void ConvertDoubleToSingle(Gen::X64Reg dst, Gen::X64Reg src);
+  // CVTSD2SS, for when only the low element of dst is used afterwards. Avoids depending on the
+  // previous contents of dst where possible.
+  void ConvertDoubleToSingleScalar(Gen::X64Reg dst, const Gen::OpArg& src);
   void SetFPRF(Gen::X64Reg xmm, bool single);
   void Clear();
 
@@ -605,6 +605,9 @@ void QuantizedMemoryRoutines::GenQuantizedLoad(bool single, EQuantizeType type,
 
   if (single)
   {
+    // CVTSI2SS only writes the low element, so clear XMM0 first to avoid a false dependency on
+    // whatever was last done with it.
+    XORPS(XMM0, R(XMM0));
     CVTSI2SS(XMM0, R(RSCRATCH_EXTRA));
 
     if (quantize == -1)
@@ -4,6 +4,7 @@
 #include "Core/PowerPC/JitArm64/Jit.h"
 
 #include <cstdio>
+#include <vector>
 
 #include "Common/Arm64Emitter.h"
 #include "Common/CommonTypes.h"
@@ -12,6 +13,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/PerformanceCounter.h"
 #include "Common/StringUtil.h"
+#include "Common/Trace.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -54,6 +56,8 @@ void JitArm64::Init()
   const size_t child_code_size = m_mmu_enabled ? FARCODE_SIZE_MMU : FARCODE_SIZE;
   AllocCodeSpace(CODE_SIZE + child_code_size);
   AddChildCodeSpace(&m_far_code, child_code_size);
+  m_near_code_size = CODE_SIZE;
+  m_far_code_size = child_code_size;
 
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
@@ -92,12 +96,14 @@ void JitArm64::SetOptimizationEnabled(bool enabled)
     analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
     analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
     analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+    analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_SUCCESSOR_CARRY);
   }
   else
   {
     analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
     analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
     analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_SUCCESSOR_CARRY);
   }
 }
 
@@ -192,6 +198,8 @@ void JitArm64::FallBackToInterpreter(UGeckoInstruction inst)
   gpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
   fpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
 
+  CountJitEvent(Profiler::JitEvent::InterpreterFallback, ARM64Reg::X0, ARM64Reg::X1);
+
   if (js.op->opinfo->flags & FL_ENDBLOCK)
   {
     // also flush the program counter
@@ -437,6 +445,7 @@ void JitArm64::WriteExit(Arm64Gen::ARM64Reg dest, bool LK, u32 exit_address_afte
   if (dest != DISPATCHER_PC)
     MOV(DISPATCHER_PC, dest);
 
+  CountJitEvent(Profiler::JitEvent::DispatcherExit, ARM64Reg::X0, ARM64Reg::X1);
   Cleanup();
   EndTimeProfile(js.curBlock);
   DoDownCount();
@@ -648,6 +657,17 @@ void JitArm64::BeginTimeProfile(JitBlock* b)
       offsetof(JitBlock::ProfileData, runCount));
 }
 
+void JitArm64::CountJitEvent(Profiler::JitEvent event, ARM64Reg xa, ARM64Reg xb)
+{
+  if (!m_event_counters_enabled)
+    return;
+
+  MOVP2R(xa, m_event_counters.GetCounter(event, js.compilerPC));
+  LDR(IndexType::Unsigned, xb, xa, 0);
+  ADD(xb, xb, 1);
+  STR(IndexType::Unsigned, xb, xa, 0);
+}
+
 void JitArm64::EndTimeProfile(JitBlock* b)
 {
   if (!jo.profile_blocks)
@@ -718,8 +738,11 @@ void JitArm64::Jit(u32 em_address)
 
 void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 {
+  TRACE_ZONE("JitArm64::Jit");
+
   if (m_cleanup_after_stackfault)
   {
+    CountCacheFlush(JitCacheFlushCause::StackFault);
     ClearCache();
     m_cleanup_after_stackfault = false;
 #ifdef _WIN32
@@ -729,7 +752,10 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   }
 
   if (SConfig::GetInstance().bJITNoBlockCache)
+  {
+    CountCacheFlush(JitCacheFlushCause::NoBlockCache);
     ClearCache();
+  }
 
   // Check if any code blocks have been freed in the block cache and transfer this information to
   // the local rangesets to allow overwriting them with new code.
@@ -774,6 +800,16 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  // With tiered compilation, blocks start out without the analyzer optimizations, which make
+  // compilation noticeably slower, and get recompiled with them once they turn out to be hot.
+  // The options have to stay in effect until the block has been emitted, since the instruction
+  // implementations check them as well.
+  js.baselineTier = ShouldCompileBaselineTier(em_address);
+  if (js.baselineTier)
+    SetOptimizationEnabled(false);
+  else if (!m_enable_debugging)
+    SetOptimizationEnabled(true);
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
@@ -817,13 +853,27 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
       return;
     }
+
+    blocks.DiscardBlock(*b);
+    // Forget the fastmem areas of the code which was emitted before running out of space.
+    m_fault_to_handler.erase(m_fault_to_handler.upper_bound(near_start),
+                             m_fault_to_handler.upper_bound(GetWritableCodePtr()));
   }
 
   if (clear_cache_and_retry_on_failure)
   {
     // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+    // Make room by evicting the oldest blocks if possible, otherwise clear the entire JIT cache,
+    // and retry.
+    if (m_generational_code_space_enabled && blocks.EvictOldestGeneration())
+    {
+      INFO_LOG_FMT(POWERPC, "Evicted the oldest generation of blocks from the code caches");
+      Jit(em_address, true);
+      return;
+    }
+
     WARN_LOG_FMT(POWERPC, "flushing code caches, please report if this happens a lot");
+    CountCacheFlush(JitCacheFlushCause::CodeSpaceFull);
     ClearCache();
     Jit(em_address, false);
     return;
@@ -862,8 +912,9 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 {
   js.isLastInstruction = false;
   js.firstFPInstructionFound = false;
-  js.assumeNoPairedQuantize = false;
+  js.constantGqrValid = BitSet8();
   js.blockStart = em_address;
+  js.sourceLines.clear();
   js.fifoBytesSinceCheck = 0;
   js.mustCheckFifo = false;
   js.downcountAmount = 0;
@@ -894,27 +945,73 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     BeginTimeProfile(b);
   }
 
-  if (code_block.m_gqr_used.Count() == 1 &&
+  if (js.baselineTier)
+  {
+    // Count down the executions of this block and recompile it with the full optimizing tier
+    // once the counter runs out.
+    b->tier_up_counter = TIER_UP_THRESHOLD;
+
+    MOVP2R(ARM64Reg::X0, &b->tier_up_counter);
+    LDR(IndexType::Unsigned, ARM64Reg::W1, ARM64Reg::X0, 0);
+    SUBS(ARM64Reg::W1, ARM64Reg::W1, 1);
+    STR(IndexType::Unsigned, ARM64Reg::W1, ARM64Reg::X0, 0);
+    FixupBranch not_hot = B(CC_NEQ);
+    FixupBranch hot = B();
+    SwitchToFarCode();
+    SetJumpTarget(hot);
+    MOVI2R(DISPATCHER_PC, js.blockStart);
+    STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
+    MOVI2R(ARM64Reg::W0, static_cast<u32>(JitInterface::ExceptionType::HotBlock));
+    MOVP2R(ARM64Reg::X1, &JitInterface::CompileExceptionCheck);
+    BLR(ARM64Reg::X1);
+    B(dispatcher_no_check);
+    SwitchToNearCode();
+    SetJumpTarget(not_hot);
+  }
+
+  // Assume that GQR values don't change often at runtime. GQRs which are used but not set by the
+  // block are treated as constant, which lets psq_l and psq_st (de)quantize inline and use
+  // fastmem instead of going through the quantized load and store routines.
+  const BitSet8 gqr_static = code_block.m_gqr_used & ~code_block.m_gqr_modified;
+  if (gqr_static &&
       js.pairedQuantizeAddresses.find(js.blockStart) == js.pairedQuantizeAddresses.end())
   {
-    int gqr = *code_block.m_gqr_used.begin();
-    if (!code_block.m_gqr_modified[gqr] && !GQR(PowerPC::ppcState, gqr))
+    // Check that the GQRs still have the values we expect at the start of the block, in case
+    // our guess turns out wrong.
+    std::vector<FixupBranch> fails;
+    for (int gqr : gqr_static)
     {
+      const u32 value = GQR(PowerPC::ppcState, gqr);
+      js.constantGqr[gqr] = value;
+
       LDR(IndexType::Unsigned, ARM64Reg::W0, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + gqr));
-      FixupBranch no_fail = CBZ(ARM64Reg::W0);
-      FixupBranch fail = B();
-      SwitchToFarCode();
-      SetJumpTarget(fail);
-      MOVI2R(DISPATCHER_PC, js.blockStart);
-      STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
-      MOVI2R(ARM64Reg::W0, static_cast<u32>(JitInterface::ExceptionType::PairedQuantize));
-      MOVP2R(ARM64Reg::X1, &JitInterface::CompileExceptionCheck);
-      BLR(ARM64Reg::X1);
-      B(dispatcher_no_check);
-      SwitchToNearCode();
+      FixupBranch no_fail;
+      if (value == 0)
+      {
+        no_fail = CBZ(ARM64Reg::W0);
+      }
+      else
+      {
+        MOVI2R(ARM64Reg::W1, value);
+        CMP(ARM64Reg::W0, ARM64Reg::W1);
+        no_fail = B(CC_EQ);
+      }
+      fails.push_back(B());
       SetJumpTarget(no_fail);
-      js.assumeNoPairedQuantize = true;
     }
+
+    SwitchToFarCode();
+    for (const FixupBranch& fail : fails)
+      SetJumpTarget(fail);
+    MOVI2R(DISPATCHER_PC, js.blockStart);
+    STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
+    MOVI2R(ARM64Reg::W0, static_cast<u32>(JitInterface::ExceptionType::PairedQuantize));
+    MOVP2R(ARM64Reg::X1, &JitInterface::CompileExceptionCheck);
+    BLR(ARM64Reg::X1);
+    B(dispatcher_no_check);
+    SwitchToNearCode();
+
+    js.constantGqrValid = gqr_static;
   }
 
   gpr.Start(js.gpa);
@@ -932,6 +1029,8 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     PPCAnalyst::CodeOp& op = m_code_buffer[i];
 
     js.compilerPC = op.address;
+    if (JitRegister::IsJitDumpEnabled())
+      js.sourceLines.push_back({GetCodePtr(), op.address});
     js.op = &op;
     js.fpr_is_store_safe = op.fprIsStoreSafeBeforeInst;
     js.instructionNumber = i;
@@ -956,7 +1055,7 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     bool gatherPipeIntCheck = js.fifoWriteAddresses.find(op.address) != js.fifoWriteAddresses.end();
 
     if (jo.optimizeGatherPipe &&
-        (js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_SIZE || js.mustCheckFifo))
+        (js.fifoBytesSinceCheck >= GPFifo::GATHER_PIPE_BATCH_SIZE || js.mustCheckFifo))
     {
       js.fifoBytesSinceCheck = 0;
       js.mustCheckFifo = false;
@@ -188,6 +188,8 @@ protected:
   {
     const u8* fastmem_code;
     const u8* slowmem_code;
+    bool is_store;
+    u32 guest_pc;
   };
 
   void SetBlockLinkingEnabled(bool enabled);
@@ -309,6 +311,8 @@ protected:
   // Profiling
   void BeginTimeProfile(JitBlock* b);
   void EndTimeProfile(JitBlock* b);
+  // Increments the counter of the event at the current instruction if event counting is enabled.
+  void CountJitEvent(Profiler::JitEvent event, Arm64Gen::ARM64Reg xa, Arm64Gen::ARM64Reg xb);
 
   // Exits
   void WriteExit(u32 destination, bool LK = false, u32 exit_address_after_return = 0);
@@ -165,6 +165,8 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, MemAccessMode mode, ARM64Reg RS,
         FastmemArea* fastmem_area = &m_fault_to_handler[fastmem_end];
         fastmem_area->fastmem_code = fastmem_start;
         fastmem_area->slowmem_code = GetCodePtr();
+        fastmem_area->is_store = !(flags & BackPatchInfo::FLAG_LOAD);
+        fastmem_area->guest_pc = js.compilerPC;
       }
     }
 
@@ -334,6 +336,16 @@ bool JitArm64::HandleFastmemFault(uintptr_t access_address, SContext* ctx)
   if (pc < fastmem_area_start)
     return false;
 
+  // If the address has a page table translation, map it and retry the access. This way, the
+  // access stays on the fast path instead of being backpatched to the slow path for good.
+  const auto logical_base = reinterpret_cast<uintptr_t>(memory.GetLogicalBase());
+  if (access_address >= logical_base && access_address < logical_base + 0x100010000 &&
+      PowerPC::MapPageTableTranslation(static_cast<u32>(access_address - logical_base),
+                                       slow_handler_iter->second.is_store))
+  {
+    return true;
+  }
+
   const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
   ARM64XEmitter emitter(const_cast<u8*>(fastmem_area_start), const_cast<u8*>(fastmem_area_end));
 
@@ -342,6 +354,9 @@ bool JitArm64::HandleFastmemFault(uintptr_t access_address, SContext* ctx)
   while (emitter.GetCodePtr() < fastmem_area_end)
     emitter.NOP();
 
+  if (m_event_counters_enabled)
+    m_event_counters.Increment(Profiler::JitEvent::Backpatch, slow_handler_iter->second.guest_pc);
+
   m_fault_to_handler.erase(slow_handler_iter);
 
   emitter.FlushIcache();
@@ -67,6 +67,7 @@ void JitArm64::rfi(UGeckoInstruction inst)
   LDR(IndexType::Unsigned, WA, PPC_REG, PPCSTATE_OFF_SPR(SPR_SRR0));
   gpr.Unlock(WB, WC);
 
+  CountJitEvent(Profiler::JitEvent::DispatcherExit, ARM64Reg::X0, ARM64Reg::X1);
   WriteExceptionExit(WA);
   gpr.Unlock(WA);
 }
@@ -121,7 +122,24 @@ void JitArm64::bcx(UGeckoInstruction inst)
   INSTRUCTION_START
   JITDISABLE(bJITBranchOff);
 
+  // Baseline tier blocks always end at conditional branches, so the profile counters can be
+  // updated right before the exits.
+  PPCAnalyst::BranchProfile::Counts* profile_counts = nullptr;
+  if (js.baselineTier && m_branch_profiling_enabled &&
+      ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0 || (inst.BO & BO_DONT_CHECK_CONDITION) == 0))
+  {
+    profile_counts = &js.branchProfile.GetCounts(js.compilerPC);
+  }
+
   ARM64Reg WA = gpr.GetReg();
+  ARM64Reg WB = profile_counts ? gpr.GetReg() : ARM64Reg::INVALID_REG;
+  const auto increment_counter = [&](u32* counter) {
+    MOVP2R(EncodeRegTo64(WB), counter);
+    LDR(IndexType::Unsigned, WA, EncodeRegTo64(WB), 0);
+    ADD(WA, WA, 1);
+    STR(IndexType::Unsigned, WA, EncodeRegTo64(WB), 0);
+  };
+
   FixupBranch pCTRDontBranch;
   if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)  // Decrement and test CTR
   {
@@ -156,6 +174,9 @@ void JitArm64::bcx(UGeckoInstruction inst)
   gpr.Flush(FlushMode::MaintainState, WA);
   fpr.Flush(FlushMode::MaintainState, ARM64Reg::INVALID_REG);
 
+  if (profile_counts)
+    increment_counter(&profile_counts->taken);
+
   if (js.op->branchIsIdleLoop)
   {
     // make idle loops go faster
@@ -182,10 +203,16 @@ void JitArm64::bcx(UGeckoInstruction inst)
   {
     gpr.Flush(FlushMode::All, WA);
     fpr.Flush(FlushMode::All, ARM64Reg::INVALID_REG);
+
+    if (profile_counts)
+      increment_counter(&profile_counts->not_taken);
+
     WriteExit(js.compilerPC + 4);
   }
 
   gpr.Unlock(WA);
+  if (profile_counts)
+    gpr.Unlock(WB);
 }
 
 void JitArm64::bcctrx(UGeckoInstruction inst)
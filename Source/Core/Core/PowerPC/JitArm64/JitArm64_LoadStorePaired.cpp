@@ -12,18 +12,58 @@
 #include "Core/CoreTiming.h"
 #include "Core/PowerPC/Gekko.h"
 #include "Core/PowerPC/JitArm64/JitArm64_RegCache.h"
+#include "Core/PowerPC/JitCommon/JitAsmCommon.h"
 #include "Core/PowerPC/PPCTables.h"
 #include "Core/PowerPC/PowerPC.h"
 
 using namespace Arm64Gen;
 
+namespace
+{
+bool IsValidQuantizeType(EQuantizeType type)
+{
+  return type == QUANTIZE_FLOAT || type >= QUANTIZE_U8;
+}
+
+bool IsSignedQuantizeType(EQuantizeType type)
+{
+  return type == QUANTIZE_S8 || type == QUANTIZE_S16;
+}
+
+u32 GetQuantizeSizeFlag(EQuantizeType type)
+{
+  switch (type)
+  {
+  case QUANTIZE_U8:
+  case QUANTIZE_S8:
+    return BackPatchInfo::FLAG_SIZE_8;
+  case QUANTIZE_U16:
+  case QUANTIZE_S16:
+    return BackPatchInfo::FLAG_SIZE_16;
+  default:
+    return BackPatchInfo::FLAG_SIZE_32;
+  }
+}
+}  // namespace
+
 void JitArm64::psq_lXX(UGeckoInstruction inst)
 {
   INSTRUCTION_START
   JITDISABLE(bJITLoadStorePairedOff);
 
+  const s32 offset = inst.SIMM_12;
+  const bool indexed = inst.OPCD == 4;
+  const bool update = inst.OPCD == 57 || (inst.OPCD == 4 && !!(inst.SUBOP6 & 32));
+  const int i = indexed ? inst.Ix : inst.I;
+  const int w = indexed ? inst.Wx : inst.W;
+
+  // If the GQR is known at compile time, the load and the dequantization for its type and scale
+  // are emitted inline. Otherwise, the quantized load routine for the type is looked up at runtime.
+  const UGQR gqr(js.constantGqr[i]);
+  const bool constant_gqr = js.constantGqrValid[i] && IsValidQuantizeType(gqr.ld_type);
+
   // If we have a fastmem arena, the asm routines assume address translation is on.
-  FALLBACK_IF(!js.assumeNoPairedQuantize && jo.fastmem_arena && !PowerPC::ppcState.msr.DR);
+  FALLBACK_IF(!constant_gqr && jo.fastmem_arena && !PowerPC::ppcState.msr.DR);
 
   // X30 is LR
   // X0 is the address
@@ -31,15 +71,9 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
   // X2 is a temporary
   // Q0 is the return register
   // Q1 is a temporary
-  const s32 offset = inst.SIMM_12;
-  const bool indexed = inst.OPCD == 4;
-  const bool update = inst.OPCD == 57 || (inst.OPCD == 4 && !!(inst.SUBOP6 & 32));
-  const int i = indexed ? inst.Ix : inst.I;
-  const int w = indexed ? inst.Wx : inst.W;
-
   gpr.Lock(ARM64Reg::W0, ARM64Reg::W30);
   fpr.Lock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize)
+  if (!constant_gqr)
   {
     gpr.Lock(ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W3);
     fpr.Lock(ARM64Reg::Q1);
@@ -78,7 +112,7 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
     MOV(gpr.R(inst.RA), addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize)
+  if (constant_gqr)
   {
     BitSet32 gprs_in_use = gpr.GetCallerSavedUsed();
     BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
@@ -92,12 +126,58 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
     if (!jo.memcheck)
       fprs_in_use[DecodeReg(VS)] = 0;
 
-    u32 flags = BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_32;
+    const EQuantizeType type = gqr.ld_type;
+    u32 flags = BackPatchInfo::FLAG_LOAD | BackPatchInfo::FLAG_FLOAT | GetQuantizeSizeFlag(type);
     if (!w)
       flags |= BackPatchInfo::FLAG_PAIR;
 
     EmitBackpatchRoutine(flags, MemAccessMode::Auto, VS, EncodeRegTo64(addr_reg), gprs_in_use,
                          fprs_in_use);
+
+    if (type != QUANTIZE_FLOAT)
+    {
+      const ARM64Reg VD = EncodeRegToDouble(VS);
+      const bool is_signed = IsSignedQuantizeType(type);
+      if (flags & BackPatchInfo::FLAG_SIZE_8)
+      {
+        if (is_signed)
+          m_float_emit.SXTL(8, VD, VD);
+        else
+          m_float_emit.UXTL(8, VD, VD);
+      }
+      if (is_signed)
+        m_float_emit.SXTL(16, VD, VD);
+      else
+        m_float_emit.UXTL(16, VD, VD);
+
+      // Dequantizing with a positive scale divides by a power of two, which the fixed-point
+      // conversion does by itself. Negative scales are stored as 64 - scale.
+      const u32 scale = gqr.ld_scale;
+      if (scale == 0 || scale >= 32)
+      {
+        if (is_signed)
+          m_float_emit.SCVTF(32, VD, VD);
+        else
+          m_float_emit.UCVTF(32, VD, VD);
+      }
+      else
+      {
+        if (is_signed)
+          m_float_emit.SCVTF(32, VD, VD, scale);
+        else
+          m_float_emit.UCVTF(32, VD, VD, scale);
+      }
+
+      if (scale >= 32)
+      {
+        const ARM64Reg factor = fpr.GetReg();
+        const s32 load_offset = MOVPage2R(ARM64Reg::X30, &m_dequantizeTableS[scale * 2]);
+        m_float_emit.LDR(32, IndexType::Unsigned, EncodeRegToDouble(factor), ARM64Reg::X30,
+                         load_offset);
+        m_float_emit.FMUL(32, VD, VD, EncodeRegToDouble(factor), 0);
+        fpr.Unlock(factor);
+      }
+    }
   }
   else
   {
@@ -131,7 +211,7 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
 
   gpr.Unlock(ARM64Reg::W0, ARM64Reg::W30);
   fpr.Unlock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize)
+  if (!constant_gqr)
   {
     gpr.Unlock(ARM64Reg::W1, ARM64Reg::W2, ARM64Reg::W3);
     fpr.Unlock(ARM64Reg::Q1);
@@ -147,35 +227,45 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
   INSTRUCTION_START
   JITDISABLE(bJITLoadStorePairedOff);
 
+  const s32 offset = inst.SIMM_12;
+  const bool indexed = inst.OPCD == 4;
+  const bool update = inst.OPCD == 61 || (inst.OPCD == 4 && !!(inst.SUBOP6 & 32));
+  const int i = indexed ? inst.Ix : inst.I;
+  const int w = indexed ? inst.Wx : inst.W;
+
+  // If the GQR is known at compile time, the quantization for its type and scale and the store
+  // are emitted inline. Otherwise, the store routine for the type is looked up at runtime.
+  const UGQR gqr(js.constantGqr[i]);
+  const bool constant_gqr = js.constantGqrValid[i] && IsValidQuantizeType(gqr.st_type);
+  const EQuantizeType type = gqr.st_type;
+
   // If we have a fastmem arena, the asm routines assume address translation is on.
-  FALLBACK_IF(!js.assumeNoPairedQuantize && jo.fastmem_arena && !PowerPC::ppcState.msr.DR);
+  FALLBACK_IF(!constant_gqr && jo.fastmem_arena && !PowerPC::ppcState.msr.DR);
 
   // X30 is LR
   // X0 contains the scale
   // X1 is the address
   // Q0 is the store register
 
-  const s32 offset = inst.SIMM_12;
-  const bool indexed = inst.OPCD == 4;
-  const bool update = inst.OPCD == 61 || (inst.OPCD == 4 && !!(inst.SUBOP6 & 32));
-  const int i = indexed ? inst.Ix : inst.I;
-  const int w = indexed ? inst.Wx : inst.W;
-
   fpr.Lock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize)
+  if (!constant_gqr)
     fpr.Lock(ARM64Reg::Q1);
 
   const bool have_single = fpr.IsSingle(inst.RS);
 
   ARM64Reg VS = fpr.R(inst.RS, have_single ? RegType::Single : RegType::Register);
 
-  if (js.assumeNoPairedQuantize)
+  // Quantized values are always built in a temporary register.
+  const bool use_temp_reg = constant_gqr && (!have_single || type != QUANTIZE_FLOAT);
+  if (constant_gqr)
   {
-    if (!have_single)
+    if (use_temp_reg)
     {
       const ARM64Reg single_reg = fpr.GetReg();
 
-      if (w)
+      if (have_single)
+        m_float_emit.ORR(EncodeRegToDouble(single_reg), VS, VS);
+      else if (w)
         m_float_emit.FCVT(32, 64, EncodeRegToDouble(single_reg), EncodeRegToDouble(VS));
       else
         m_float_emit.FCVTN(32, EncodeRegToDouble(single_reg), EncodeRegToDouble(VS));
@@ -199,9 +289,9 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
   }
 
   gpr.Lock(ARM64Reg::W0, ARM64Reg::W1, ARM64Reg::W30);
-  if (!js.assumeNoPairedQuantize || !jo.fastmem_arena)
+  if (!constant_gqr || !jo.fastmem_arena)
     gpr.Lock(ARM64Reg::W2);
-  if (!js.assumeNoPairedQuantize && !jo.fastmem_arena)
+  if (!constant_gqr && !jo.fastmem_arena)
     gpr.Lock(ARM64Reg::W3);
 
   constexpr ARM64Reg scale_reg = ARM64Reg::W0;
@@ -232,8 +322,54 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
     MOV(gpr.R(inst.RA), addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize)
+  if (constant_gqr)
   {
+    if (type != QUANTIZE_FLOAT)
+    {
+      const ARM64Reg VD = EncodeRegToDouble(VS);
+      const bool is_signed = IsSignedQuantizeType(type);
+
+      // Quantizing with a positive scale multiplies by a power of two, which the fixed-point
+      // conversion does by itself. Negative scales are stored as 64 - scale.
+      const u32 scale = gqr.st_scale;
+      if (scale >= 32)
+      {
+        const ARM64Reg factor = fpr.GetReg();
+        const s32 load_offset = MOVPage2R(ARM64Reg::X30, &m_quantizeTableS[scale * 2]);
+        m_float_emit.LDR(32, IndexType::Unsigned, EncodeRegToDouble(factor), ARM64Reg::X30,
+                         load_offset);
+        m_float_emit.FMUL(32, VD, VD, EncodeRegToDouble(factor), 0);
+        fpr.Unlock(factor);
+      }
+
+      if (scale == 0 || scale >= 32)
+      {
+        if (is_signed)
+          m_float_emit.FCVTZS(32, VD, VD);
+        else
+          m_float_emit.FCVTZU(32, VD, VD);
+      }
+      else
+      {
+        if (is_signed)
+          m_float_emit.FCVTZS(32, VD, VD, scale);
+        else
+          m_float_emit.FCVTZU(32, VD, VD, scale);
+      }
+
+      if (is_signed)
+        m_float_emit.SQXTN(16, VD, VD);
+      else
+        m_float_emit.UQXTN(16, VD, VD);
+      if (GetQuantizeSizeFlag(type) == BackPatchInfo::FLAG_SIZE_8)
+      {
+        if (is_signed)
+          m_float_emit.SQXTN(8, VD, VD);
+        else
+          m_float_emit.UQXTN(8, VD, VD);
+      }
+    }
+
     BitSet32 gprs_in_use = gpr.GetCallerSavedUsed();
     BitSet32 fprs_in_use = fpr.GetCallerSavedUsed();
 
@@ -243,8 +379,10 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
       gprs_in_use[DecodeReg(ARM64Reg::W1)] = false;
     if (!jo.fastmem_arena)
       gprs_in_use[DecodeReg(ARM64Reg::W2)] = false;
+    if (use_temp_reg)
+      fprs_in_use[DecodeReg(VS)] = false;
 
-    u32 flags = BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT | BackPatchInfo::FLAG_SIZE_32;
+    u32 flags = BackPatchInfo::FLAG_STORE | BackPatchInfo::FLAG_FLOAT | GetQuantizeSizeFlag(type);
     if (!w)
       flags |= BackPatchInfo::FLAG_PAIR;
 
@@ -270,15 +408,15 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
     MOV(gpr.R(inst.RA), addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize && !have_single)
+  if (use_temp_reg)
     fpr.Unlock(VS);
 
   gpr.Unlock(ARM64Reg::W0, ARM64Reg::W1, ARM64Reg::W30);
   fpr.Unlock(ARM64Reg::Q0);
-  if (!js.assumeNoPairedQuantize || !jo.fastmem_arena)
+  if (!constant_gqr || !jo.fastmem_arena)
     gpr.Unlock(ARM64Reg::W2);
-  if (!js.assumeNoPairedQuantize && !jo.fastmem_arena)
+  if (!constant_gqr && !jo.fastmem_arena)
     gpr.Unlock(ARM64Reg::W3);
-  if (!js.assumeNoPairedQuantize)
+  if (!constant_gqr)
     fpr.Unlock(ARM64Reg::Q1);
 }
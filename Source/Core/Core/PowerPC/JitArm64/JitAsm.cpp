@@ -4,6 +4,7 @@
 #include "Core/PowerPC/JitArm64/Jit.h"
 
 #include <limits>
+#include <optional>
 
 #include "Common/Arm64Emitter.h"
 #include "Common/BitUtils.h"
@@ -122,18 +123,32 @@ void JitArm64::GenerateAsm()
     ARM64Reg pc_masked = ARM64Reg::W25;
     ARM64Reg cache_base = ARM64Reg::X27;
     ARM64Reg block = ARM64Reg::X30;
-    ORR(pc_masked, ARM64Reg::WZR, LogicalImm(JitBaseBlockCache::FAST_BLOCK_MAP_MASK << 3, 32));
-    AND(pc_masked, pc_masked, DISPATCHER_PC, ArithOption(DISPATCHER_PC, ShiftType::LSL, 1));
+    const bool full_block_map = GetBlockCache()->IsFastBlockMapFull();
+    if (full_block_map)
+    {
+      // A map covering the whole address space is indexed by the PC without masking.
+      UBFIZ(EncodeRegTo64(pc_masked), EncodeRegTo64(DISPATCHER_PC), 1, 32);
+    }
+    else
+    {
+      ORR(pc_masked, ARM64Reg::WZR, LogicalImm(JitBaseBlockCache::FAST_BLOCK_MAP_MASK << 3, 32));
+      AND(pc_masked, pc_masked, DISPATCHER_PC, ArithOption(DISPATCHER_PC, ShiftType::LSL, 1));
+    }
     MOVP2R(cache_base, GetBlockCache()->GetFastBlockMap());
     LDR(block, cache_base, EncodeRegTo64(pc_masked));
     FixupBranch not_found = CBZ(block);
 
     // b.effectiveAddress != addr || b.msrBits != msr
+    // Entries of the full map only ever hold blocks starting at their address.
     ARM64Reg pc_and_msr = ARM64Reg::W25;
     ARM64Reg pc_and_msr2 = ARM64Reg::W24;
-    LDR(IndexType::Unsigned, pc_and_msr, block, offsetof(JitBlockData, effectiveAddress));
-    CMP(pc_and_msr, DISPATCHER_PC);
-    FixupBranch pc_missmatch = B(CC_NEQ);
+    std::optional<FixupBranch> pc_missmatch;
+    if (!full_block_map)
+    {
+      LDR(IndexType::Unsigned, pc_and_msr, block, offsetof(JitBlockData, effectiveAddress));
+      CMP(pc_and_msr, DISPATCHER_PC);
+      pc_missmatch = B(CC_NEQ);
+    }
 
     LDR(IndexType::Unsigned, pc_and_msr2, PPC_REG, PPCSTATE_OFF(msr));
     AND(pc_and_msr2, pc_and_msr2, LogicalImm(JitBaseBlockCache::JIT_CACHE_MSR_MASK, 32));
@@ -145,7 +160,8 @@ void JitArm64::GenerateAsm()
     LDR(IndexType::Unsigned, block, block, offsetof(JitBlockData, normalEntry));
     BR(block);
     SetJumpTarget(not_found);
-    SetJumpTarget(pc_missmatch);
+    if (pc_missmatch)
+      SetJumpTarget(*pc_missmatch);
     SetJumpTarget(msr_missmatch);
   }
 
@@ -32,6 +32,10 @@ public:
   {
     CallLambda(8 * sizeof(T), lambda);
   }
+  void VisitFunction(MMIO::WriteFunction<T> function, void* context) override
+  {
+    CallFunction(function, context);
+  }
 
 private:
   void StoreFromRegister(int sbits, ARM64Reg reg, s32 offset)
@@ -87,6 +91,25 @@ private:
     m_emit->ABI_PopRegisters(m_gprs_in_use);
   }
 
+  // Same as CallLambda, minus the trampoline and the std::function indirection.
+  void CallFunction(MMIO::WriteFunction<T> function, void* context)
+  {
+    ARM64FloatEmitter float_emit(m_emit);
+
+    m_emit->ABI_PushRegisters(m_gprs_in_use);
+    float_emit.ABI_PushRegisters(m_fprs_in_use, ARM64Reg::X1);
+    // The value goes first, as the source register may be one of the other argument registers.
+    m_emit->MOV(ARM64Reg::W3, m_src_reg);
+    m_emit->MOVP2R(ARM64Reg::X0, &Core::System::GetInstance());
+    m_emit->MOVP2R(ARM64Reg::X1, context);
+    m_emit->MOVI2R(ARM64Reg::W2, m_address);
+    m_emit->MOVP2R(ARM64Reg::X8, function);
+    m_emit->BLR(ARM64Reg::X8);
+
+    float_emit.ABI_PopRegisters(m_fprs_in_use, ARM64Reg::X1);
+    m_emit->ABI_PopRegisters(m_gprs_in_use);
+  }
+
   ARM64XEmitter* m_emit;
   BitSet32 m_gprs_in_use;
   BitSet32 m_fprs_in_use;
@@ -114,6 +137,10 @@ public:
   {
     CallLambda(8 * sizeof(T), lambda);
   }
+  void VisitFunction(MMIO::ReadFunction<T> function, void* context) override
+  {
+    CallFunction(8 * sizeof(T), function, context);
+  }
 
 private:
   void LoadConstantToReg(int sbits, u32 value)
@@ -187,6 +214,27 @@ private:
     m_emit->ABI_PopRegisters(m_gprs_in_use);
   }
 
+  // Same as CallLambda, minus the trampoline and the std::function indirection.
+  void CallFunction(int sbits, MMIO::ReadFunction<T> function, void* context)
+  {
+    ARM64FloatEmitter float_emit(m_emit);
+
+    m_emit->ABI_PushRegisters(m_gprs_in_use);
+    float_emit.ABI_PushRegisters(m_fprs_in_use, ARM64Reg::X1);
+    m_emit->MOVP2R(ARM64Reg::X0, &Core::System::GetInstance());
+    m_emit->MOVP2R(ARM64Reg::X1, context);
+    m_emit->MOVI2R(ARM64Reg::W2, m_address);
+    m_emit->MOVP2R(ARM64Reg::X8, function);
+    m_emit->BLR(ARM64Reg::X8);
+    if (m_sign_extend)
+      m_emit->SBFM(m_dst_reg, ARM64Reg::W0, 0, sbits - 1);
+    else
+      m_emit->UBFM(m_dst_reg, ARM64Reg::W0, 0, sbits - 1);
+
+    float_emit.ABI_PopRegisters(m_fprs_in_use, ARM64Reg::X1);
+    m_emit->ABI_PopRegisters(m_gprs_in_use);
+  }
+
   ARM64XEmitter* m_emit;
   BitSet32 m_gprs_in_use;
   BitSet32 m_fprs_in_use;
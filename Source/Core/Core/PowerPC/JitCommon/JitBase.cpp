@@ -3,11 +3,16 @@
 
 #include "Core/PowerPC/JitCommon/JitBase.h"
 
+#include <algorithm>
+#include <string>
+
 #include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/HW/CPU.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -19,7 +24,9 @@ const u8* JitBase::Dispatch(JitBase& jit)
 
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
+  jit.PrecompilePersistedBlocks(em_address);
   jit.Jit(em_address);
+  jit.RecordPersistedBlock(em_address);
 }
 
 JitBase::JitBase() : m_code_buffer(code_buffer_size)
@@ -59,6 +66,17 @@ void JitBase::RefreshConfig()
   m_mmu_enabled = Core::System::GetInstance().IsMMUMode();
   m_pause_on_panic_enabled = Core::System::GetInstance().IsPauseOnPanicMode();
   m_accurate_cpu_cache_enabled = Config::Get(Config::MAIN_ACCURATE_CPU_CACHE);
+  m_persistent_block_cache_enabled = Config::Get(Config::MAIN_JIT_PERSISTENT_BLOCK_CACHE);
+  m_tiered_compilation_enabled = Config::Get(Config::MAIN_JIT_TIERED_COMPILATION);
+  // Branch profiles are collected by the baseline tier, so they need tiered compilation.
+  m_branch_profiling_enabled =
+      m_tiered_compilation_enabled && Config::Get(Config::MAIN_JIT_BRANCH_PROFILING);
+  m_register_contracts_enabled = Config::Get(Config::MAIN_JIT_REGISTER_CONTRACTS);
+  m_generational_code_space_enabled = Config::Get(Config::MAIN_JIT_GENERATIONAL_CODE_SPACE);
+  m_event_counters_enabled = Config::Get(Config::MAIN_DEBUG_JIT_EVENT_COUNTERS);
+  const int block_alignment = Config::Get(Config::MAIN_JIT_BLOCK_ALIGNMENT);
+  m_block_alignment =
+      MathUtil::IsPow2(block_alignment) ? static_cast<u32>(std::clamp(block_alignment, 4, 64)) : 4;
   if (m_accurate_cpu_cache_enabled)
   {
     m_fastmem_enabled = false;
@@ -70,6 +88,97 @@ void JitBase::RefreshConfig()
   analyzer.SetBranchFollowingEnabled(Config::Get(Config::MAIN_JIT_FOLLOW_BRANCH));
   analyzer.SetFloatExceptionsEnabled(m_enable_float_exceptions);
   analyzer.SetDivByZeroExceptionsEnabled(m_enable_div_by_zero_exceptions);
+  analyzer.SetBranchProfile(m_branch_profiling_enabled ? &js.branchProfile : nullptr);
+}
+
+u64 JitBase::GetBlockDiskCacheConfigHash() const
+{
+  u64 hash = 0;
+  hash |= static_cast<u64>(Config::Get(Config::MAIN_JIT_FOLLOW_BRANCH)) << 0;
+  hash |= static_cast<u64>(m_enable_float_exceptions) << 1;
+  hash |= static_cast<u64>(m_enable_div_by_zero_exceptions) << 2;
+  hash |= static_cast<u64>(m_mmu_enabled) << 3;
+  hash |= static_cast<u64>(m_accurate_cpu_cache_enabled) << 4;
+  hash |= static_cast<u64>(m_fprf) << 5;
+  hash |= static_cast<u64>(m_accurate_nans) << 6;
+  hash |= static_cast<u64>(bJITOff) << 7;
+  hash |= static_cast<u64>(bJITLoadStoreOff) << 8;
+  hash |= static_cast<u64>(bJITLoadStorelXzOff) << 9;
+  hash |= static_cast<u64>(bJITLoadStorelwzOff) << 10;
+  hash |= static_cast<u64>(bJITLoadStorelbzxOff) << 11;
+  hash |= static_cast<u64>(bJITLoadStoreFloatingOff) << 12;
+  hash |= static_cast<u64>(bJITLoadStorePairedOff) << 13;
+  hash |= static_cast<u64>(bJITFloatingPointOff) << 14;
+  hash |= static_cast<u64>(bJITIntegerOff) << 15;
+  hash |= static_cast<u64>(bJITPairedOff) << 16;
+  hash |= static_cast<u64>(bJITSystemRegistersOff) << 17;
+  hash |= static_cast<u64>(bJITBranchOff) << 18;
+  hash |= static_cast<u64>(bJITRegisterCacheOff) << 19;
+  hash |= static_cast<u64>(m_fastmem_enabled) << 20;
+  hash |= static_cast<u64>(m_low_dcbz_hack) << 21;
+  hash |= static_cast<u64>(m_pause_on_panic_enabled) << 22;
+  hash |= static_cast<u64>(m_tiered_compilation_enabled) << 23;
+  hash |= static_cast<u64>(m_branch_profiling_enabled) << 24;
+  hash |= static_cast<u64>(m_register_contracts_enabled) << 25;
+  hash |= static_cast<u64>(m_event_counters_enabled) << 26;
+  hash |= static_cast<u64>(m_generational_code_space_enabled) << 27;
+  hash |= static_cast<u64>(Config::Get(Config::MAIN_JIT_FULL_BLOCK_MAP)) << 28;
+  hash |= static_cast<u64>(m_block_alignment) << 32;
+  return hash;
+}
+
+void JitBase::PrecompilePersistedBlocks(u32 em_address)
+{
+  // Debugging needs blocks to be compiled exactly when they are reached, e.g. for stepping.
+  if (!m_persistent_block_cache_enabled || m_enable_debugging ||
+      SConfig::GetInstance().bJITNoBlockCache)
+  {
+    return;
+  }
+
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  const u64 config_hash = GetBlockDiskCacheConfigHash();
+  if (game_id != m_block_disk_cache.GetGameID() ||
+      config_hash != m_block_disk_cache.GetConfigHash())
+  {
+    m_block_disk_cache.Open(game_id, config_hash);
+  }
+
+  if (m_block_disk_cache.GetPendingCount() == 0)
+    return;
+
+  const auto translated = PowerPC::JitCache_TranslateAddress(em_address);
+  if (!translated.valid)
+    return;
+
+  const u32 msr = PowerPC::ppcState.msr.Hex;
+  const u32 msr_bits = msr & JitBaseBlockCache::JIT_CACHE_MSR_MASK;
+  JitBaseBlockCache* block_cache = GetBlockCache();
+  for (const auto& [address, physical_address] :
+       m_block_disk_cache.TakeValidBlocksOnPage(translated.address, msr_bits))
+  {
+    if (address == em_address || block_cache->GetBlockFromStartAddress(address, msr))
+      continue;
+
+    // The hash check only covers the physical memory, so make sure the block is still mapped at
+    // the same place. This also guarantees that compiling it can't raise an ISI.
+    const auto block_translated = PowerPC::JitCache_TranslateAddress(address);
+    if (!block_translated.valid || block_translated.address != physical_address)
+      continue;
+
+    Jit(address);
+  }
+}
+
+void JitBase::RecordPersistedBlock(u32 em_address)
+{
+  if (!m_persistent_block_cache_enabled || !m_block_disk_cache.IsOpen())
+    return;
+
+  const JitBlock* block =
+      GetBlockCache()->GetBlockFromStartAddress(em_address, PowerPC::ppcState.msr.Hex);
+  if (block)
+    m_block_disk_cache.Record(*block);
 }
 
 bool JitBase::CanMergeNextInstructions(int count) const
@@ -87,6 +196,13 @@ bool JitBase::CanMergeNextInstructions(int count) const
   return true;
 }
 
+bool JitBase::ShouldCompileBaselineTier(u32 em_address) const
+{
+  // Debugging relies on blocks being compiled predictably, so tiering is disabled there.
+  return m_tiered_compilation_enabled && !m_enable_debugging && !jo.profile_blocks &&
+         js.hotBlockAddresses.find(em_address) == js.hotBlockAddresses.end();
+}
+
 void JitBase::UpdateMemoryAndExceptionOptions()
 {
   bool any_watchpoints = PowerPC::memchecks.HasAny();
@@ -3,19 +3,26 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <unordered_set>
+#include <vector>
 
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
+#include "Common/JitRegister.h"
 #include "Common/x64Emitter.h"
 #include "Core/ConfigManager.h"
 #include "Core/MachineContext.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitEventCounters.h"
 #include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/SamplingProfiler.h"
 
 //#define JIT_LOG_GENERATED_CODE  // Enables logging of generated code
 //#define JIT_LOG_GPR             // Enables logging of the PPC general purpose regs
@@ -38,6 +45,22 @@
 
 #define JITDISABLE(setting) FALLBACK_IF(bJITOff || setting)
 
+// Why the whole JIT cache was thrown away.
+enum class JitCacheFlushCause : u8
+{
+  // The near or far code region had no room left for a block.
+  CodeSpaceFull,
+  // The trampoline region of Jit64 was about to run out of space.
+  TrampolinesFull,
+  // The guest stack overflowed the BLR optimization stack.
+  StackFault,
+  // The block cache is disabled, so the JIT starts over for every block.
+  NoBlockCache,
+  // Something outside of the JIT asked for it, e.g. breakpoints, cheats or loading a state.
+  Requested,
+};
+constexpr size_t NUM_JIT_CACHE_FLUSH_CAUSES = 5;
+
 class JitBase : public CPUCoreBase
 {
 protected:
@@ -82,7 +105,6 @@ protected:
     bool fixupExceptionHandler;
     Gen::FixupBranch exceptionHandler;
 
-    bool assumeNoPairedQuantize;
     BitSet8 constantGqrValid;
     std::array<u32, 8> constantGqr;
     bool firstFPInstructionFound;
@@ -96,6 +118,9 @@ protected:
     bool mustCheckFifo;
     u32 fifoBytesSinceCheck;
 
+    // Set while compiling a block with the baseline tier of tiered compilation.
+    bool baselineTier;
+
     PPCAnalyst::BlockStats st;
     PPCAnalyst::BlockRegStats gpa;
     PPCAnalyst::BlockRegStats fpa;
@@ -107,6 +132,13 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    // Blocks which have been executed often enough to be compiled with all optimizations.
+    std::unordered_set<u32> hotBlockAddresses;
+    // Collected by baseline tier blocks if branch profiling is enabled.
+    PPCAnalyst::BranchProfile branchProfile;
+    // The start of the host code of each instruction of the block being compiled. Only collected
+    // for the jitdump output.
+    std::vector<JitRegister::SourceLine> sourceLines;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -137,11 +169,39 @@ protected:
   bool m_mmu_enabled = false;
   bool m_pause_on_panic_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
+  bool m_persistent_block_cache_enabled = false;
+  bool m_tiered_compilation_enabled = false;
+  bool m_branch_profiling_enabled = false;
+  bool m_register_contracts_enabled = false;
+  bool m_generational_code_space_enabled = false;
+  bool m_event_counters_enabled = false;
+  // The alignment of block entry points in bytes, always a power of two.
+  u32 m_block_alignment = 4;
+
+  JitBlockDiskCache m_block_disk_cache;
+  Profiler::SamplingProfiler m_sampling_profiler;
+  Profiler::JitEventCounters m_event_counters;
+
+  // The sizes of the code regions are set by the JITs when they allocate their code space, the
+  // space used in the near and far code regions is tracked by the block cache.
+  std::atomic<size_t> m_near_code_size = 0;
+  std::atomic<size_t> m_far_code_size = 0;
+  std::atomic<size_t> m_trampoline_code_size = 0;
+  std::atomic<size_t> m_trampoline_code_used = 0;
+  std::array<std::atomic<u64>, NUM_JIT_CACHE_FLUSH_CAUSES> m_cache_flush_counts{};
 
   void RefreshConfig();
 
+  // Identifies the settings which influence how guest code is split into blocks and compiled.
+  // Every setting that affects code generation has to be part of it.
+  u64 GetBlockDiskCacheConfigHash() const;
+
   bool CanMergeNextInstructions(int count) const;
 
+  // Whether the block at em_address should be compiled with the baseline tier, i.e. without the
+  // analyzer optimizations and with a counter that triggers a recompilation once it is hot.
+  bool ShouldCompileBaselineTier(u32 em_address) const;
+
   void UpdateMemoryAndExceptionOptions();
 
   bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op);
@@ -154,9 +214,39 @@ public:
 
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
+  Profiler::SamplingProfiler& GetSamplingProfiler() { return m_sampling_profiler; }
+  Profiler::JitEventCounters& GetEventCounters() { return m_event_counters; }
+
+  // Must be called before each ClearCache which throws away compiled blocks.
+  void CountCacheFlush(JitCacheFlushCause cause)
+  {
+    m_cache_flush_counts[static_cast<size_t>(cause)].fetch_add(1, std::memory_order_relaxed);
+  }
+  u64 GetCacheFlushCount(JitCacheFlushCause cause) const
+  {
+    return m_cache_flush_counts[static_cast<size_t>(cause)].load(std::memory_order_relaxed);
+  }
+
+  // These can be read from any thread.
+  size_t GetNearCodeSize() const { return m_near_code_size.load(std::memory_order_relaxed); }
+  size_t GetFarCodeSize() const { return m_far_code_size.load(std::memory_order_relaxed); }
+  size_t GetTrampolineCodeSize() const
+  {
+    return m_trampoline_code_size.load(std::memory_order_relaxed);
+  }
+  size_t GetTrampolineCodeUsed() const
+  {
+    return m_trampoline_code_used.load(std::memory_order_relaxed);
+  }
 
   virtual void Jit(u32 em_address) = 0;
 
+  // Compiles the blocks recorded in the persistent block cache which live on the same physical
+  // page as em_address, provided their guest code hasn't changed since they were recorded.
+  void PrecompilePersistedBlocks(u32 em_address);
+  // Adds the block which was just compiled for em_address to the persistent block cache.
+  void RecordPersistedBlock(u32 em_address);
+
   virtual const CommonAsmRoutinesBase* GetAsmRoutines() = 0;
 
   virtual bool HandleFault(uintptr_t access_address, SContext* ctx) = 0;
@@ -164,6 +254,9 @@ public:
 
   static constexpr std::size_t code_buffer_size = 32000;
 
+  // Number of executions after which a baseline tier block gets recompiled.
+  static constexpr u32 TIER_UP_THRESHOLD = 64;
+
   // This should probably be removed from public:
   JitOptions jo{};
   JitState js{};
@@ -0,0 +1,192 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
+
+#include <utility>
+
+#include <xxhash.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/System.h"
+
+class JitBlockDiskCache::Reader final : public LinearDiskCacheReader<Key, u32>
+{
+public:
+  explicit Reader(JitBlockDiskCache& cache) : m_cache(cache) {}
+
+  void Read(const Key& key, const u32* value, u32 value_size) override
+  {
+    // Value layout: code hash (2 words), followed by (address, count) pairs.
+    if (key.version != VERSION || key.config_hash != m_cache.m_config_hash || value_size < 4 ||
+        value_size % 2 != 0 || (value[0] == 0 && value[1] == 0))
+    {
+      return;
+    }
+
+    if (!m_cache.m_known_blocks.emplace(key.effective_address, key.physical_address, key.msr_bits)
+             .second)
+    {
+      return;
+    }
+
+    Entry entry;
+    entry.effective_address = key.effective_address;
+    entry.physical_address = key.physical_address;
+    entry.msr_bits = key.msr_bits;
+    entry.code_hash = static_cast<u64>(value[0]) | (static_cast<u64>(value[1]) << 32);
+    entry.runs.reserve((value_size - 2) / 2);
+    for (u32 i = 2; i < value_size; i += 2)
+      entry.runs.emplace_back(value[i], value[i + 1]);
+
+    m_cache.AddPending(std::move(entry));
+  }
+
+private:
+  JitBlockDiskCache& m_cache;
+};
+
+JitBlockDiskCache::~JitBlockDiskCache()
+{
+  Close();
+}
+
+void JitBlockDiskCache::Open(const std::string& game_id, u64 config_hash)
+{
+  Close();
+
+  m_game_id = game_id;
+  m_config_hash = config_hash;
+  if (game_id.empty())
+    return;
+
+  const std::string path = File::GetUserPath(D_CACHE_IDX) + "JIT" DIR_SEP;
+  if (!File::IsDirectory(path))
+    File::CreateDir(path);
+
+  Reader reader(*this);
+  const u32 count = m_file.OpenAndRead(path + game_id + ".jitcache", reader);
+  m_is_open = true;
+
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} of {} persisted JIT blocks for {}", m_pending_count, count,
+               game_id);
+}
+
+void JitBlockDiskCache::Close()
+{
+  if (!m_is_open)
+    return;
+
+  m_file.Sync();
+  m_file.Close();
+  m_is_open = false;
+  m_known_blocks.clear();
+  m_pending.clear();
+  m_pending_count = 0;
+}
+
+void JitBlockDiskCache::Record(const JitBlock& block)
+{
+  if (!m_is_open || block.physical_addresses.empty())
+    return;
+
+  if (!m_known_blocks.emplace(block.effectiveAddress, block.physicalAddress, block.msrBits).second)
+    return;
+
+  std::vector<std::pair<u32, u32>> runs;
+  for (u32 address : block.physical_addresses)
+  {
+    if (!runs.empty() && runs.back().first + runs.back().second * 4 == address)
+      runs.back().second++;
+    else
+      runs.emplace_back(address, 1);
+  }
+
+  const u64 code_hash = HashGuestCode(runs);
+  if (code_hash == 0)
+    return;
+
+  std::vector<u32> value;
+  value.reserve(2 + runs.size() * 2);
+  value.push_back(static_cast<u32>(code_hash));
+  value.push_back(static_cast<u32>(code_hash >> 32));
+  for (const auto& [address, count] : runs)
+  {
+    value.push_back(address);
+    value.push_back(count);
+  }
+
+  const Key key{block.effectiveAddress, block.physicalAddress, block.msrBits, VERSION,
+                m_config_hash};
+  m_file.Append(key, value.data(), static_cast<u32>(value.size()));
+}
+
+std::vector<std::pair<u32, u32>> JitBlockDiskCache::TakeValidBlocksOnPage(u32 physical_address,
+                                                                         u32 msr_bits)
+{
+  std::vector<std::pair<u32, u32>> result;
+
+  const auto it = m_pending.find(physical_address >> PAGE_SHIFT);
+  if (it == m_pending.end())
+    return result;
+
+  std::vector<Entry>& entries = it->second;
+  for (auto entry = entries.begin(); entry != entries.end();)
+  {
+    if (entry->msr_bits == msr_bits && HashGuestCode(entry->runs) == entry->code_hash)
+    {
+      result.emplace_back(entry->effective_address, entry->physical_address);
+      entry = entries.erase(entry);
+      m_pending_count--;
+    }
+    else
+    {
+      ++entry;
+    }
+  }
+
+  if (entries.empty())
+    m_pending.erase(it);
+
+  return result;
+}
+
+u64 JitBlockDiskCache::HashGuestCode(const std::vector<std::pair<u32, u32>>& runs)
+{
+  auto& memory = Core::System::GetInstance().GetMemory();
+
+  XXH64_state_t* state = XXH64_createState();
+  XXH64_reset(state, 0);
+  for (const auto& [address, count] : runs)
+  {
+    const u32 last_address = address + (count - 1) * 4;
+    if (!PowerPC::HostIsInstructionRAMAddress(address, PowerPC::RequestedAddressSpace::Physical) ||
+        !PowerPC::HostIsInstructionRAMAddress(last_address,
+                                              PowerPC::RequestedAddressSpace::Physical))
+    {
+      XXH64_freeState(state);
+      return 0;
+    }
+
+    XXH64_update(state, &address, sizeof(address));
+    XXH64_update(state, memory.GetPointerForRange(address, count * 4), count * 4);
+  }
+  const u64 hash = XXH64_digest(state);
+  XXH64_freeState(state);
+
+  // Zero is reserved for code that isn't in RAM.
+  return hash != 0 ? hash : 1;
+}
+
+void JitBlockDiskCache::AddPending(Entry entry)
+{
+  const u32 page = entry.physical_address >> PAGE_SHIFT;
+  m_pending[page].push_back(std::move(entry));
+  m_pending_count++;
+}
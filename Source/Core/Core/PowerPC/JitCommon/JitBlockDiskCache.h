@@ -0,0 +1,93 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+
+struct JitBlock;
+
+// Persists the entry points of compiled blocks across sessions of the same title.
+//
+// Host code can't be stored as-is, since it embeds absolute pointers into the code space, the
+// asm routines and PowerPCState. Instead we store where the blocks were and a hash of the guest
+// code they were made from. On the next boot, the first time execution reaches a physical page,
+// every recorded block on that page whose guest code still matches gets compiled in one go,
+// instead of trickling in through the dispatcher as execution happens to reach each of them.
+class JitBlockDiskCache final
+{
+public:
+  // Bump this when the layout of the key or value changes.
+  static constexpr u32 VERSION = 1;
+
+  static constexpr u32 PAGE_SHIFT = 12;
+
+  JitBlockDiskCache() = default;
+  ~JitBlockDiskCache();
+
+  JitBlockDiskCache(const JitBlockDiskCache&) = delete;
+  JitBlockDiskCache& operator=(const JitBlockDiskCache&) = delete;
+
+  void Open(const std::string& game_id, u64 config_hash);
+  void Close();
+
+  bool IsOpen() const { return m_is_open; }
+  const std::string& GetGameID() const { return m_game_id; }
+  u64 GetConfigHash() const { return m_config_hash; }
+
+  // Stores a newly compiled block. Blocks which are already known are ignored.
+  void Record(const JitBlock& block);
+
+  // Returns the (effective, physical) addresses of all recorded blocks with the given MSR bits on
+  // the same physical page as physical_address whose guest code is unchanged, and forgets about
+  // them. Blocks whose code doesn't match are kept, since the page may get reloaded with it later.
+  std::vector<std::pair<u32, u32>> TakeValidBlocksOnPage(u32 physical_address, u32 msr_bits);
+
+  size_t GetPendingCount() const { return m_pending_count; }
+
+private:
+  struct Key
+  {
+    u32 effective_address;
+    u32 physical_address;
+    u32 msr_bits;
+    u32 version;
+    u64 config_hash;
+  };
+
+  struct Entry
+  {
+    u32 effective_address;
+    u32 physical_address;
+    u32 msr_bits;
+    u64 code_hash;
+    // Runs of consecutive instructions, as (physical address, instruction count) pairs.
+    std::vector<std::pair<u32, u32>> runs;
+  };
+
+  class Reader;
+
+  static u64 HashGuestCode(const std::vector<std::pair<u32, u32>>& runs);
+
+  void AddPending(Entry entry);
+
+  LinearDiskCache<Key, u32> m_file;
+  bool m_is_open = false;
+  std::string m_game_id;
+  u64 m_config_hash = 0;
+
+  // (effective address, physical address, msr bits) of every block in the file.
+  std::set<std::tuple<u32, u32, u32>> m_known_blocks;
+
+  // Recorded blocks which haven't been compiled in this session yet, indexed by physical page.
+  std::unordered_map<u32, std::vector<Entry>> m_pending;
+  size_t m_pending_count = 0;
+};
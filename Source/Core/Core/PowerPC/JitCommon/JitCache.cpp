@@ -7,7 +7,7 @@
 #include <array>
 #include <cstring>
 #include <functional>
-#include <map>
+#include <memory>
 #include <set>
 #include <utility>
 
@@ -15,10 +15,12 @@
 #include "Common/JitRegister.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -40,7 +42,22 @@ JitBaseBlockCache::~JitBaseBlockCache() = default;
 
 void JitBaseBlockCache::Init()
 {
-  JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR));
+  JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR), Config::Get(Config::MAIN_PERF_JITDUMP));
+
+  m_full_fast_block_map_region.Release();
+  fast_block_map = m_fast_block_map_fallback.data();
+  m_fast_block_map_full = false;
+  if (Config::Get(Config::MAIN_JIT_FULL_BLOCK_MAP))
+  {
+    // Falls back to the masked map if the host can't reserve this much memory.
+    void* full_map =
+        m_full_fast_block_map_region.Create(FULL_FAST_BLOCK_MAP_ELEMENTS * sizeof(JitBlock*));
+    if (full_map)
+    {
+      fast_block_map = static_cast<JitBlock**>(full_map);
+      m_fast_block_map_full = true;
+    }
+  }
 
   Clear();
 }
@@ -48,6 +65,10 @@ void JitBaseBlockCache::Init()
 void JitBaseBlockCache::Shutdown()
 {
   JitRegister::Shutdown();
+
+  m_full_fast_block_map_region.Release();
+  fast_block_map = m_fast_block_map_fallback.data();
+  m_fast_block_map_full = false;
 }
 
 // This clears the JIT cache. It's called from JitCache.cpp when the JIT cache
@@ -60,17 +81,34 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
-  for (auto& e : block_map)
-  {
-    DestroyBlock(e.second);
-  }
-  block_map.clear();
-  links_to.clear();
-  block_range_map.clear();
+  m_jit.js.hotBlockAddresses.clear();
+  m_jit.js.branchProfile.Clear();
+  block_map.ForEach([this](u32, JitBlock* block) {
+    for (; block; block = block->next_at_physical_address)
+      DestroyBlock(*block);
+  });
+  block_map.ForEach([this](u32, JitBlock* block) {
+    while (block)
+    {
+      JitBlock* next = block->next_at_physical_address;
+      ReturnBlockToPool(block);
+      block = next;
+    }
+  });
+  block_map.Clear();
+  links_to.Clear();
+  block_range_map.Clear();
 
   valid_block.ClearAll();
 
-  fast_block_map.fill(nullptr);
+  ClearFastBlockMap();
+
+  m_generation = 0;
+  m_generation_code_bytes = 0;
+
+  m_block_count.store(0, std::memory_order_relaxed);
+  m_code_bytes.store(0, std::memory_order_relaxed);
+  m_far_code_bytes.store(0, std::memory_order_relaxed);
 }
 
 void JitBaseBlockCache::Reset()
@@ -81,24 +119,75 @@ void JitBaseBlockCache::Reset()
 
 JitBlock** JitBaseBlockCache::GetFastBlockMap()
 {
-  return fast_block_map.data();
+  return fast_block_map;
 }
 
 void JitBaseBlockCache::RunOnBlocks(std::function<void(const JitBlock&)> f)
 {
-  for (const auto& e : block_map)
-    f(e.second);
+  block_map.ForEach([&f](u32, const JitBlock* block) {
+    for (; block; block = block->next_at_physical_address)
+      f(*block);
+  });
+}
+
+JitBlock* JitBaseBlockCache::NewBlockFromPool()
+{
+  if (m_free_blocks.empty())
+  {
+    auto& slab = m_block_pool.emplace_back(std::make_unique<JitBlock[]>(BLOCK_POOL_SLAB_SIZE));
+    for (size_t i = BLOCK_POOL_SLAB_SIZE; i > 0; --i)
+      m_free_blocks.push_back(&slab[i - 1]);
+  }
+
+  JitBlock* block = m_free_blocks.back();
+  m_free_blocks.pop_back();
+  return block;
+}
+
+void JitBaseBlockCache::ReturnBlockToPool(JitBlock* block)
+{
+  // Keep the allocations of the containers around for the next user of this block.
+  static_cast<JitBlockData&>(*block) = {};
+  block->linkData.clear();
+  block->physical_addresses.clear();
+  block->next_at_physical_address = nullptr;
+  block->tier_up_counter = 0;
+  block->generation = 0;
+  block->residentEntry = nullptr;
+  block->resident_gprs = JitBlock::NO_RESIDENT_REGISTERS;
+  block->profile_data = {};
+  m_free_blocks.push_back(block);
+}
+
+void JitBaseBlockCache::EraseFromBlockMap(JitBlock* block)
+{
+  JitBlock** link = block_map.Find(block->physicalAddress);
+  if (!link)
+    return;
+
+  for (; *link; link = &(*link)->next_at_physical_address)
+  {
+    if (*link == block)
+    {
+      *link = block->next_at_physical_address;
+      return;
+    }
+  }
 }
 
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
   const u32 physical_address = PowerPC::JitCache_TranslateAddress(em_address).address;
-  JitBlock& b = block_map.emplace(physical_address, JitBlock())->second;
+  JitBlock& b = *NewBlockFromPool();
   b.effectiveAddress = em_address;
   b.physicalAddress = physical_address;
   b.msrBits = PowerPC::ppcState.msr.Hex & JIT_CACHE_MSR_MASK;
   b.linkData.clear();
   b.fast_block_map_index = 0;
+
+  JitBlock*& head = block_map.GetOrInsert(physical_address);
+  b.next_at_physical_address = head;
+  head = &b;
   return &b;
 }
 
@@ -106,39 +195,80 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
                                       const std::set<u32>& physical_addresses)
 {
   size_t index = FastLookupIndexForAddress(block.effectiveAddress);
-  fast_block_map[index] = &block;
+  SetFastBlockMapEntry(index, &block);
   block.fast_block_map_index = index;
 
   block.physical_addresses = physical_addresses;
 
-  u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
+  u32 last_page = 0;
+  bool first = true;
   for (u32 addr : physical_addresses)
   {
     valid_block.Set(addr / 32);
-    block_range_map[addr & range_mask].insert(&block);
+
+    // physical_addresses is sorted, so each page only needs to be checked once.
+    const u32 page = addr >> BLOCK_RANGE_MAP_SHIFT;
+    if (first || page != last_page)
+      block_range_map.GetOrInsert(page).push_back(&block);
+    last_page = page;
+    first = false;
+  }
+
+  // Writes to the block's code by anything which doesn't invalidate the instruction cache
+  // afterwards are caught by write protecting the pages it was compiled from.
+  Memory::MemoryManager& memory = Core::System::GetInstance().GetMemory();
+  if (memory.IsCodeWriteProtectionEnabled())
+  {
+    u32 last_watched_page = 0;
+    bool first_watched = true;
+    for (u32 addr : physical_addresses)
+    {
+      const u32 page = addr >> PowerPC::HW_PAGE_INDEX_SHIFT;
+      if (first_watched || page != last_watched_page)
+        memory.WatchCode(page << PowerPC::HW_PAGE_INDEX_SHIFT, PowerPC::HW_PAGE_SIZE);
+      last_watched_page = page;
+      first_watched = false;
+    }
   }
 
   if (block_link)
   {
     for (const auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      std::vector<JitBlock*>& sources = links_to.GetOrInsert(e.exitAddress);
+      if (std::find(sources.begin(), sources.end(), &block) == sources.end())
+        sources.push_back(&block);
     }
 
     LinkBlock(block);
   }
 
+  block.generation = m_generation;
+  m_generation_code_bytes += block.codeSize;
+  if (m_generation_code_bytes >= m_jit.GetNearCodeSize() / NUM_CODE_GENERATIONS)
+  {
+    ++m_generation;
+    m_generation_code_bytes = 0;
+  }
+
+  m_block_count.fetch_add(1, std::memory_order_relaxed);
+  m_code_bytes.fetch_add(block.codeSize, std::memory_order_relaxed);
+  m_far_code_bytes.fetch_add(block.far_end - block.far_begin, std::memory_order_relaxed);
+
   Common::Symbol* symbol = nullptr;
   if (JitRegister::IsEnabled() &&
       (symbol = g_symbolDB.GetSymbolFromAddr(block.effectiveAddress)) != nullptr)
   {
-    JitRegister::Register(block.checkedEntry, block.codeSize, "JIT_PPC_{}_{:08x}",
-                          symbol->function_name.c_str(), block.physicalAddress);
+    JitRegister::RegisterWithSourceLines(
+        block.checkedEntry, block.codeSize,
+        fmt::format("JIT_PPC_{}_{:08x}", symbol->function_name, block.physicalAddress),
+        m_jit.js.sourceLines);
   }
   else
   {
-    JitRegister::Register(block.checkedEntry, block.codeSize, "JIT_PPC_{:08x}",
-                          block.physicalAddress);
+    JitRegister::RegisterWithSourceLines(block.checkedEntry, block.codeSize,
+                                         fmt::format("JIT_PPC_{:08x}", block.physicalAddress),
+                                         m_jit.js.sourceLines);
   }
 }
 
@@ -155,12 +285,14 @@ JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, u32 msr)
     translated_addr = translated.address;
   }
 
-  auto iter = block_map.equal_range(translated_addr);
-  for (; iter.first != iter.second; iter.first++)
+  JitBlock* const* head = block_map.Find(translated_addr);
+  if (!head)
+    return nullptr;
+
+  for (JitBlock* b = *head; b; b = b->next_at_physical_address)
   {
-    JitBlock& b = iter.first->second;
-    if (b.effectiveAddress == addr && b.msrBits == (msr & JIT_CACHE_MSR_MASK))
-      return &b;
+    if (b->effectiveAddress == addr && b->msrBits == (msr & JIT_CACHE_MSR_MASK))
+      return b;
   }
 
   return nullptr;
@@ -247,6 +379,8 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
 
   if (destroy_block)
   {
+    m_invalidation_count.fetch_add(1, std::memory_order_relaxed);
+
     // destroy JIT blocks
     ErasePhysicalRange(physical_address, length);
 
@@ -261,6 +395,7 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
         m_jit.js.noSpeculativeConstantsAddresses.erase(i);
+        m_jit.js.hotBlockAddresses.erase(i);
       }
     }
   }
@@ -268,51 +403,110 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
-  // Iterate over all macro blocks which overlap the given range.
-  u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
-  auto start = block_range_map.lower_bound(address & range_mask);
-  auto end = block_range_map.lower_bound(address + length);
-  while (start != end)
+  if (length == 0)
+    return;
+
+  // Iterate over all pages which overlap the given range.
+  const u32 first_page = address >> BLOCK_RANGE_MAP_SHIFT;
+  const u32 last_page = (address + (length - 1)) >> BLOCK_RANGE_MAP_SHIFT;
+  for (u32 page = first_page; page <= last_page; ++page)
   {
-    // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
+    std::vector<JitBlock*>* blocks = block_range_map.Find(page);
+    if (!blocks)
+      continue;
+
+    // Iterate over all blocks in the page.
+    size_t i = 0;
+    while (i < blocks->size())
+    {
+      JitBlock* block = (*blocks)[i];
+      if (!block->OverlapsPhysicalRange(address, length))
+      {
+        i++;
+        continue;
+      }
+
+      // If the block overlaps, remove it from all the pages it occupies, including this one.
+      // This swaps the last block of this page into slot i, so i must not be advanced.
+      EraseBlock(block);
+      m_invalidated_block_count.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+bool JitBaseBlockCache::EvictOldestGeneration()
+{
+  std::vector<JitBlock*> evicted_blocks;
+  u32 oldest_generation = m_generation;
+  block_map.ForEach([&](u32, JitBlock* block) {
+    for (; block; block = block->next_at_physical_address)
     {
-      JitBlock* block = *iter;
-      if (block->OverlapsPhysicalRange(address, length))
+      // The block is still in the fast block map, so it has been entered through the dispatcher
+      // since the last eviction cleared it.
+      if (fast_block_map[block->fast_block_map_index] == block)
       {
-        // If the block overlaps, also remove all other occupied slots in the other macro blocks.
-        // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (u32 addr : block->physical_addresses)
-          if ((addr & range_mask) != start->first)
-            block_range_map[addr & range_mask].erase(block);
-
-        // And remove the block.
-        DestroyBlock(*block);
-        auto block_map_iter = block_map.equal_range(block->physicalAddress);
-        while (block_map_iter.first != block_map_iter.second)
-        {
-          if (&block_map_iter.first->second == block)
-          {
-            block_map.erase(block_map_iter.first);
-            break;
-          }
-          block_map_iter.first++;
-        }
-        iter = start->second.erase(iter);
+        block->generation = m_generation;
+        continue;
       }
-      else
+
+      if (block->generation < oldest_generation)
       {
-        iter++;
+        oldest_generation = block->generation;
+        evicted_blocks.clear();
       }
+      if (block->generation == oldest_generation && oldest_generation != m_generation)
+        evicted_blocks.push_back(block);
     }
+  });
 
-    // If the macro block is empty, drop it.
-    if (start->second.empty())
-      start = block_range_map.erase(start);
-    else
-      start++;
+  // Blocks get back into the fast block map when they are entered through the dispatcher, so
+  // the next eviction can tell which blocks are still in use.
+  ClearFastBlockMap();
+
+  if (evicted_blocks.empty())
+    return false;
+
+  for (JitBlock* block : evicted_blocks)
+    EraseBlock(block);
+
+  m_evicted_generation_count.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void JitBaseBlockCache::DiscardBlock(JitBlock& block)
+{
+  EraseFromBlockMap(&block);
+  ReturnBlockToPool(&block);
+}
+
+void JitBaseBlockCache::EraseBlock(JitBlock* block)
+{
+  // Remove the block from all the pages it occupies.
+  u32 last_erased_page = 0;
+  bool first = true;
+  for (u32 addr : block->physical_addresses)
+  {
+    const u32 block_page = addr >> BLOCK_RANGE_MAP_SHIFT;
+    if (!first && block_page == last_erased_page)
+      continue;
+    last_erased_page = block_page;
+    first = false;
+
+    std::vector<JitBlock*>* page_blocks = block_range_map.Find(block_page);
+    if (!page_blocks)
+      continue;
+    const auto it = std::find(page_blocks->begin(), page_blocks->end(), block);
+    if (it != page_blocks->end())
+    {
+      *it = page_blocks->back();
+      page_blocks->pop_back();
+    }
   }
+
+  // And remove the block.
+  DestroyBlock(*block);
+  EraseFromBlockMap(block);
+  ReturnBlockToPool(block);
 }
 
 u32* JitBaseBlockCache::GetBlockBitSet() const
@@ -349,11 +543,11 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
 void JitBaseBlockCache::LinkBlock(JitBlock& block)
 {
   LinkBlockExits(block);
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
+  const std::vector<JitBlock*>* sources = links_to.Find(block.effectiveAddress);
+  if (!sources)
     return;
 
-  for (JitBlock* b2 : it->second)
+  for (JitBlock* b2 : *sources)
   {
     if (block.msrBits == b2->msrBits)
       LinkBlockExits(*b2);
@@ -369,10 +563,10 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
   }
 
   // Unlink all exits of other blocks which points to this block
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
+  const std::vector<JitBlock*>* sources = links_to.Find(block.effectiveAddress);
+  if (!sources)
     return;
-  for (JitBlock* sourceBlock : it->second)
+  for (JitBlock* sourceBlock : *sources)
   {
     if (sourceBlock->msrBits != block.msrBits)
       continue;
@@ -390,6 +584,11 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
 
 void JitBaseBlockCache::DestroyBlock(JitBlock& block)
 {
+  // The host code of the block is going to be reused, so its samples have to be collected now.
+  Profiler::SamplingProfiler& sampling_profiler = m_jit.GetSamplingProfiler();
+  if (sampling_profiler.IsRunning())
+    sampling_profiler.ResolveBlock(block);
+
   if (fast_block_map[block.fast_block_map_index] == &block)
     fast_block_map[block.fast_block_map_index] = nullptr;
 
@@ -398,16 +597,22 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
   // Delete linking addresses
   for (const auto& e : block.linkData)
   {
-    auto it = links_to.find(e.exitAddress);
-    if (it == links_to.end())
+    std::vector<JitBlock*>* sources = links_to.Find(e.exitAddress);
+    if (!sources)
       continue;
-    it->second.erase(&block);
-    if (it->second.empty())
-      links_to.erase(it);
+    const auto it = std::find(sources->begin(), sources->end(), &block);
+    if (it == sources->end())
+      continue;
+    *it = sources->back();
+    sources->pop_back();
   }
 
   // Raise an signal if we are going to call this block again
   WriteDestroyBlock(block);
+
+  m_block_count.fetch_sub(1, std::memory_order_relaxed);
+  m_code_bytes.fetch_sub(block.codeSize, std::memory_order_relaxed);
+  m_far_code_bytes.fetch_sub(block.far_end - block.far_begin, std::memory_order_relaxed);
 }
 
 JitBlock* JitBaseBlockCache::MoveBlockIntoFastCache(u32 addr, u32 msr)
@@ -423,7 +628,7 @@ JitBlock* JitBaseBlockCache::MoveBlockIntoFastCache(u32 addr, u32 msr)
 
   // And create a new one
   size_t index = FastLookupIndexForAddress(addr);
-  fast_block_map[index] = block;
+  SetFastBlockMapEntry(index, block);
   block->fast_block_map_index = index;
 
   return block;
@@ -431,5 +636,23 @@ JitBlock* JitBaseBlockCache::MoveBlockIntoFastCache(u32 addr, u32 msr)
 
 size_t JitBaseBlockCache::FastLookupIndexForAddress(u32 address)
 {
+  if (m_fast_block_map_full)
+    return address >> 2;
   return (address >> 2) & FAST_BLOCK_MAP_MASK;
 }
+
+void JitBaseBlockCache::SetFastBlockMapEntry(size_t index, JitBlock* block)
+{
+  // Clearing an entry doesn't need this, as only entries that have been set are ever cleared.
+  if (m_fast_block_map_full)
+    m_full_fast_block_map_region.EnsureMemoryPageWritable(index * sizeof(JitBlock*));
+  fast_block_map[index] = block;
+}
+
+void JitBaseBlockCache::ClearFastBlockMap()
+{
+  if (m_fast_block_map_full)
+    m_full_fast_block_map_region.Clear();
+  else
+    m_fast_block_map_fallback.fill(nullptr);
+}
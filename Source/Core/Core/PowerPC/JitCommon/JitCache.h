@@ -4,18 +4,19 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <bit>
 #include <bitset>
 #include <cstring>
 #include <functional>
-#include <map>
 #include <memory>
 #include <set>
 #include <type_traits>
-#include <unordered_map>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/MemArena.h"
 
 class JitBase;
 
@@ -67,6 +68,11 @@ struct JitBlock : public JitBlockData
 {
   bool OverlapsPhysicalRange(u32 address, u32 length) const;
 
+  // For every host register, the guest GPR it holds an up-to-date copy of, or -1.
+  using ResidentRegisters = std::array<s8, 16>;
+  static constexpr ResidentRegisters NO_RESIDENT_REGISTERS = {-1, -1, -1, -1, -1, -1, -1, -1,
+                                                              -1, -1, -1, -1, -1, -1, -1, -1};
+
   // Information about exits to a known address from this block.
   // This is used to implement block linking.
   struct LinkData
@@ -75,12 +81,30 @@ struct JitBlock : public JitBlockData
     u32 exitAddress;
     bool linkStatus;  // is it already linked?
     bool call;
+    // The guest registers still held in host registers when the exit is taken.
+    ResidentRegisters resident_gprs = NO_RESIDENT_REGISTERS;
   };
   std::vector<LinkData> linkData;
 
   // This set stores all physical addresses of all occupied instructions.
   std::set<u32> physical_addresses;
 
+  // The next block in block_map with the same physical address.
+  JitBlock* next_at_physical_address = nullptr;
+
+  // For blocks compiled with the baseline tier, the number of executions left until the block
+  // gets recompiled with all optimizations. Decremented by the compiled code.
+  u32 tier_up_counter = 0;
+
+  // The generation of the code space the block belongs to, see EvictOldestGeneration.
+  u32 generation = 0;
+
+  // Register contract of the block: the guest registers it expects in host registers when entered
+  // through residentEntry, which skips loading them. Linked exits which satisfy the contract jump
+  // there instead of to checkedEntry. Only used by Jit64.
+  u8* residentEntry = nullptr;
+  ResidentRegisters resident_gprs = NO_RESIDENT_REGISTERS;
+
   // Block profiling data, structure is inlined in Jit.cpp
   struct ProfileData
   {
@@ -124,6 +148,112 @@ public:
   bool Test(u32 bit) const { return (m_valid_block[bit / 32] & (1u << (bit % 32))) != 0; }
 };
 
+// Open-addressed hash table with u32 keys, used for the address indexes of the block cache.
+// Keys are never removed individually, only all at once with Clear(). Values of keys which
+// have become unused are kept around and get reused, which avoids heap traffic when a region
+// of code is invalidated and recompiled over and over.
+template <typename T>
+class AddressHashTable final
+{
+public:
+  AddressHashTable() { Clear(); }
+
+  T* Find(u32 key)
+  {
+    for (size_t i = Hash(key);; i = (i + 1) & m_mask)
+    {
+      Slot& slot = m_slots[i];
+      if (!slot.used)
+        return nullptr;
+      if (slot.key == key)
+        return &slot.value;
+    }
+  }
+
+  const T* Find(u32 key) const { return const_cast<AddressHashTable*>(this)->Find(key); }
+
+  // The returned reference is invalidated by the next call to this function.
+  T& GetOrInsert(u32 key)
+  {
+    if (T* value = Find(key))
+      return *value;
+
+    if ((m_size + 1) * 2 > m_slots.size())
+      Grow();
+
+    size_t i = Hash(key);
+    while (m_slots[i].used)
+      i = (i + 1) & m_mask;
+
+    Slot& slot = m_slots[i];
+    slot.used = true;
+    slot.key = key;
+    m_size++;
+    return slot.value;
+  }
+
+  void Clear()
+  {
+    m_slots.clear();
+    m_slots.resize(INITIAL_CAPACITY);
+    m_mask = INITIAL_CAPACITY - 1;
+    m_shift = 64 - std::countr_zero(INITIAL_CAPACITY);
+    m_size = 0;
+  }
+
+  template <typename F>
+  void ForEach(F f) const
+  {
+    for (const Slot& slot : m_slots)
+    {
+      if (slot.used)
+        f(slot.key, slot.value);
+    }
+  }
+
+private:
+  static constexpr size_t INITIAL_CAPACITY = 0x1000;
+
+  struct Slot
+  {
+    u32 key = 0;
+    bool used = false;
+    T value{};
+  };
+
+  size_t Hash(u32 key) const
+  {
+    // Fibonacci hashing. The top bits of the product depend on all bits of the key, so aligned
+    // addresses still spread over the whole table.
+    return static_cast<size_t>((u64(key) * 0x9E3779B97F4A7C15) >> m_shift);
+  }
+
+  void Grow()
+  {
+    std::vector<Slot> old_slots = std::move(m_slots);
+    m_slots.clear();
+    m_slots.resize(old_slots.size() * 2);
+    m_mask = m_slots.size() - 1;
+    m_shift--;
+    for (Slot& old_slot : old_slots)
+    {
+      if (!old_slot.used)
+        continue;
+
+      size_t i = Hash(old_slot.key);
+      while (m_slots[i].used)
+        i = (i + 1) & m_mask;
+      m_slots[i] = std::move(old_slot);
+    }
+  }
+
+  std::vector<Slot> m_slots;
+  size_t m_mask = 0;
+  // 64 minus the number of bits in a slot index
+  int m_shift = 64;
+  size_t m_size = 0;
+};
+
 class JitBaseBlockCache
 {
 public:
@@ -131,8 +261,12 @@ public:
   // is valid (MSR.IR and MSR.DR, the address translation bits).
   static constexpr u32 JIT_CACHE_MSR_MASK = 0x30;
 
+  // The size of the fast block map when it can't cover the whole address space.
   static constexpr u32 FAST_BLOCK_MAP_ELEMENTS = 0x10000;
   static constexpr u32 FAST_BLOCK_MAP_MASK = FAST_BLOCK_MAP_ELEMENTS - 1;
+  // The size of the fast block map covering the whole address space, which has one entry for every
+  // possible instruction address.
+  static constexpr u64 FULL_FAST_BLOCK_MAP_ELEMENTS = 0x1'0000'0000 / 4;
 
   explicit JitBaseBlockCache(JitBase& jit);
   virtual ~JitBaseBlockCache();
@@ -144,6 +278,9 @@ public:
 
   // Code Cache
   JitBlock** GetFastBlockMap();
+  // Whether the fast block map is indexed by (address >> 2) without masking, in which case the
+  // entry for an address only ever holds blocks starting at that address.
+  bool IsFastBlockMapFull() const { return m_fast_block_map_full; }
   void RunOnBlocks(std::function<void(const JitBlock&)> f);
 
   JitBlock* AllocateBlock(u32 em_address);
@@ -164,8 +301,35 @@ public:
   void InvalidateICacheLine(u32 address);
   void ErasePhysicalRange(u32 address, u32 length);
 
+  // Blocks are assigned to generations in the order they are compiled, each generation covering
+  // a fraction of the near code space. When the code space is full, destroying the oldest
+  // generation makes room for new blocks without throwing away the whole cache. Blocks which have
+  // been entered through the dispatcher since the previous eviction are moved to the current
+  // generation instead of being destroyed. Returns false if there was no generation older than
+  // the current one, in which case the whole cache has to be cleared.
+  bool EvictOldestGeneration();
+  // Removes a block which was allocated but never finalized, because generating its code failed.
+  void DiscardBlock(JitBlock& block);
+
   u32* GetBlockBitSet() const;
 
+  // The number of blocks in the cache and the size of their near code. Can be read from any thread.
+  u32 GetBlockCount() const { return m_block_count.load(std::memory_order_relaxed); }
+  u64 GetCodeBytes() const { return m_code_bytes.load(std::memory_order_relaxed); }
+  u64 GetFarCodeBytes() const { return m_far_code_bytes.load(std::memory_order_relaxed); }
+
+  // The icache invalidations which had to look for blocks to destroy, and the number of blocks
+  // they destroyed. These are not reset by Clear. Can be read from any thread.
+  u64 GetInvalidationCount() const { return m_invalidation_count.load(std::memory_order_relaxed); }
+  u64 GetInvalidatedBlockCount() const
+  {
+    return m_invalidated_block_count.load(std::memory_order_relaxed);
+  }
+  u64 GetEvictedGenerationCount() const
+  {
+    return m_evicted_generation_count.load(std::memory_order_relaxed);
+  }
+
 protected:
   virtual void DestroyBlock(JitBlock& block);
 
@@ -179,25 +343,38 @@ private:
   void LinkBlock(JitBlock& block);
   void UnlinkBlock(const JitBlock& block);
   void InvalidateICacheInternal(u32 physical_address, u32 address, u32 length, bool forced);
+  void EraseBlock(JitBlock* block);
 
   JitBlock* MoveBlockIntoFastCache(u32 em_address, u32 msr);
 
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address);
+  void SetFastBlockMapEntry(size_t index, JitBlock* block);
+  void ClearFastBlockMap();
+
+  JitBlock* NewBlockFromPool();
+  void ReturnBlockToPool(JitBlock* block);
+  void EraseFromBlockMap(JitBlock* block);
 
   // links_to hold all exit points of all valid blocks in a reverse way.
   // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
+  AddressHashTable<std::vector<JitBlock*>> links_to;  // destination_PC -> blocks
 
   // Map indexed by the physical address of the entry point.
   // This is used to query the block based on the current PC in a slow way.
-  std::multimap<u32, JitBlock> block_map;  // start_addr -> block
+  // All blocks with the same physical address are chained through next_at_physical_address.
+  AddressHashTable<JitBlock*> block_map;  // start_addr -> first block
+
+  // Range of overlapping code indexed by physical page.
+  // This is used for invalidation of memory regions.
+  static constexpr u32 BLOCK_RANGE_MAP_SHIFT = 12;
+  AddressHashTable<std::vector<JitBlock*>> block_range_map;  // physical_addr >> shift -> blocks
 
-  // Range of overlapping code indexed by a masked physical address.
-  // This is used for invalidation of memory regions. The range is grouped
-  // in macro blocks of each 0x100 bytes.
-  static constexpr u32 BLOCK_RANGE_MAP_ELEMENTS = 0x100;
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  // Blocks are allocated in slabs so that their addresses stay stable, and recycled
+  // through a free list instead of going back to the heap.
+  static constexpr size_t BLOCK_POOL_SLAB_SIZE = 1024;
+  std::vector<std::unique_ptr<JitBlock[]>> m_block_pool;
+  std::vector<JitBlock*> m_free_blocks;
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
@@ -205,5 +382,21 @@ private:
 
   // This array is indexed with the masked PC and likely holds the correct block id.
   // This is used as a fast cache of block_map used in the assembly dispatcher.
-  std::array<JitBlock*, FAST_BLOCK_MAP_ELEMENTS> fast_block_map{};  // start_addr & mask -> number
+  // If the host can reserve enough memory for it, it covers the whole address space instead, and
+  // only the pages of the table which hold blocks get committed.
+  JitBlock** fast_block_map = nullptr;  // start_addr & mask -> number
+  bool m_fast_block_map_full = false;
+  Common::LazyMemoryRegion m_full_fast_block_map_region;
+  std::array<JitBlock*, FAST_BLOCK_MAP_ELEMENTS> m_fast_block_map_fallback{};
+
+  static constexpr u32 NUM_CODE_GENERATIONS = 4;
+  u32 m_generation = 0;
+  u64 m_generation_code_bytes = 0;
+
+  std::atomic<u32> m_block_count = 0;
+  std::atomic<u64> m_code_bytes = 0;
+  std::atomic<u64> m_far_code_bytes = 0;
+  std::atomic<u64> m_invalidation_count = 0;
+  std::atomic<u64> m_invalidated_block_count = 0;
+  std::atomic<u64> m_evicted_generation_count = 0;
 };
@@ -0,0 +1,38 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitEventCounters.h"
+
+#include <algorithm>
+#include <array>
+
+namespace Profiler
+{
+const char* GetJitEventName(JitEvent event)
+{
+  static constexpr std::array<const char*, NUM_JIT_EVENTS> names = {
+      "Interpreter fallbacks", "Backpatches", "Dispatcher exits"};
+  return names[static_cast<size_t>(event)];
+}
+
+u64* JitEventCounters::GetCounter(JitEvent event, u32 guest_pc)
+{
+  // Nodes of a std::map never move, so the address of the count stays valid.
+  return &m_counters[{event, guest_pc}];
+}
+
+std::vector<JitEventCount> JitEventCounters::GetCounts() const
+{
+  std::vector<JitEventCount> counts;
+  for (const auto& [key, count] : m_counters)
+  {
+    if (count != 0)
+      counts.push_back({key.first, key.second, count});
+  }
+  std::stable_sort(counts.begin(), counts.end(),
+                   [](const JitEventCount& a, const JitEventCount& b) {
+                     return a.count > b.count;
+                   });
+  return counts;
+}
+}  // namespace Profiler
@@ -0,0 +1,53 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Profiler
+{
+// The slow paths of the JITs which are worth counting to find out which instructions are missing
+// a proper JIT implementation or are handled badly by it.
+enum class JitEvent : u8
+{
+  // An instruction was run by calling the interpreter from JIT code.
+  InterpreterFallback,
+  // A fastmem access faulted and was patched to use the slow memory path.
+  Backpatch,
+  // A block was left through an indirect jump to the dispatcher.
+  DispatcherExit,
+};
+constexpr size_t NUM_JIT_EVENTS = 3;
+
+const char* GetJitEventName(JitEvent event);
+
+struct JitEventCount
+{
+  JitEvent event;
+  u32 guest_pc;
+  u64 count;
+};
+
+// Counts the slow path events of the JITs per guest address. The JITs embed the addresses of the
+// counters in the code they generate, so the counters have to stay alive as long as the JIT.
+// Only to be used on the CPU thread.
+class JitEventCounters final
+{
+public:
+  // The returned pointer stays valid for the lifetime of this object.
+  u64* GetCounter(JitEvent event, u32 guest_pc);
+  void Increment(JitEvent event, u32 guest_pc) { ++*GetCounter(event, guest_pc); }
+
+  // The counters which were hit at least once, most hit first.
+  std::vector<JitEventCount> GetCounts() const;
+
+private:
+  std::map<std::pair<JitEvent, u32>, u64> m_counters;
+};
+}  // namespace Profiler
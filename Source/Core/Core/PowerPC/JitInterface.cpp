@@ -6,7 +6,9 @@
 #include <algorithm>
 #include <cstdio>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -19,16 +21,22 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
+#include "Core/PowerPC/JitEventCounters.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
+#include "Core/PowerPC/PPCTables.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/PowerPC/Profiler.h"
+#include "Core/PowerPC/SamplingProfiler.h"
+#include "Core/System.h"
 
 #if _M_X86
 #include "Core/PowerPC/Jit64/Jit.h"
@@ -48,7 +56,10 @@ void SetJit(JitBase* jit)
 void DoState(PointerWrap& p)
 {
   if (g_jit && p.IsReadMode())
+  {
+    g_jit->CountCacheFlush(JitCacheFlushCause::Requested);
     g_jit->ClearCache();
+  }
 }
 CPUCoreBase* InitJitCore(PowerPC::CPUCore core)
 {
@@ -104,9 +115,16 @@ void WriteProfileResults(const std::string& filename)
   }
   f.WriteString("origAddr\tblkName\trunCount\tcost\ttimeCost\tpercent\ttimePercent\tOvAllinBlkTime("
                 "ms)\tblkCodeSize\n");
-  for (auto& stat : prof_stats.block_stats)
+  std::vector<u32> addresses;
+  addresses.reserve(prof_stats.block_stats.size());
+  for (const auto& stat : prof_stats.block_stats)
+    addresses.push_back(stat.addr);
+  const std::vector<Common::Symbol*> symbols = g_symbolDB.GetSymbolsFromAddrs(addresses);
+
+  for (size_t i = 0; i < prof_stats.block_stats.size(); ++i)
   {
-    std::string name = g_symbolDB.GetDescription(stat.addr);
+    const auto& stat = prof_stats.block_stats[i];
+    const std::string& name = symbols[i] ? symbols[i]->name : " --- ";
     double percent = 100.0 * (double)stat.cost / (double)prof_stats.cost_sum;
     double timePercent = 100.0 * (double)stat.tick_counter / (double)prof_stats.timecost_sum;
     f.WriteString(fmt::format("{0:08x}\t{1}\t{2}\t{3}\t{4}\t{5:.2f}\t{6:.2f}\t{7:.2f}\t{8}\n",
@@ -146,6 +164,180 @@ void GetProfileResults(Profiler::ProfileStats* prof_stats)
   });
 }
 
+void StartSamplingProfiler()
+{
+  if (!g_jit)
+    return;
+
+  g_jit->GetSamplingProfiler().Clear();
+  if (!g_jit->GetSamplingProfiler().Start())
+    WARN_LOG_FMT(POWERPC, "The sampling profiler is not supported on this platform");
+}
+
+void StopSamplingProfiler()
+{
+  if (g_jit)
+    g_jit->GetSamplingProfiler().Stop();
+}
+
+void WriteSampledProfile(const std::string& filename)
+{
+  if (!g_jit)
+    return;
+
+  Profiler::SampledProfile profile;
+  Core::RunAsCPUThread([&profile] {
+    Profiler::SamplingProfiler& sampling_profiler = g_jit->GetSamplingProfiler();
+    g_jit->GetBlockCache()->RunOnBlocks(
+        [&sampling_profiler](const JitBlock& block) { sampling_profiler.ResolveBlock(block); });
+    profile = sampling_profiler.GetProfile();
+  });
+
+  File::IOFile f(filename, "w");
+  if (!f)
+  {
+    PanicAlertFmt("Failed to open {}", filename);
+    return;
+  }
+
+  const auto percent = [&profile](u64 samples) {
+    if (profile.total_samples == 0)
+      return 0.0;
+    return 100.0 * static_cast<double>(samples) / static_cast<double>(profile.total_samples);
+  };
+  f.WriteString(fmt::format("{} samples, {} ({:.2f}%) outside of JIT blocks\n\n",
+                            profile.total_samples, profile.unattributed_samples,
+                            percent(profile.unattributed_samples)));
+
+  std::vector<u32> addresses;
+  addresses.reserve(profile.blocks.size());
+  for (const Profiler::SampledBlock& block : profile.blocks)
+    addresses.push_back(block.addr);
+  const std::vector<Common::Symbol*> symbols = g_symbolDB.GetSymbolsFromAddrs(addresses);
+
+  struct FunctionSamples
+  {
+    u32 address;
+    const Common::Symbol* symbol;
+    u64 samples;
+  };
+
+  // Blocks without a symbol are listed as functions of their own.
+  std::vector<FunctionSamples> functions;
+  std::unordered_map<u32, size_t> function_indices;
+  for (size_t i = 0; i < profile.blocks.size(); ++i)
+  {
+    const u32 address = symbols[i] ? symbols[i]->address : profile.blocks[i].addr;
+    const auto [it, inserted] = function_indices.try_emplace(address, functions.size());
+    if (inserted)
+      functions.push_back({address, symbols[i], 0});
+    functions[it->second].samples += profile.blocks[i].samples;
+  }
+  std::stable_sort(functions.begin(), functions.end(),
+                   [](const FunctionSamples& a, const FunctionSamples& b) {
+                     return a.samples > b.samples;
+                   });
+
+  f.WriteString("funcAddr\tfuncName\tsamples\tpercent\n");
+  for (const FunctionSamples& function : functions)
+  {
+    const std::string& name = function.symbol ? function.symbol->name : " --- ";
+    f.WriteString(fmt::format("{:08x}\t{}\t{}\t{:.2f}\n", function.address, name,
+                              function.samples, percent(function.samples)));
+  }
+
+  f.WriteString("\norigAddr\tblkName\tsamples\tpercent\n");
+  for (size_t i = 0; i < profile.blocks.size(); ++i)
+  {
+    const Profiler::SampledBlock& block = profile.blocks[i];
+    const std::string& name = symbols[i] ? symbols[i]->name : " --- ";
+    f.WriteString(fmt::format("{:08x}\t{}\t{}\t{:.2f}\n", block.addr, name, block.samples,
+                              percent(block.samples)));
+  }
+}
+
+void WriteJitEventCounters(const std::string& filename)
+{
+  if (!g_jit)
+    return;
+
+  // The opcodes are looked up on the CPU thread as well, while the memory is still mapped.
+  std::vector<Profiler::JitEventCount> counts;
+  std::vector<const char*> opnames;
+  Core::RunAsCPUThread([&counts, &opnames] {
+    counts = g_jit->GetEventCounters().GetCounts();
+    opnames.reserve(counts.size());
+    for (const Profiler::JitEventCount& count : counts)
+    {
+      const GekkoOPInfo* info = nullptr;
+      if (PowerPC::HostIsInstructionRAMAddress(count.guest_pc))
+        info = PPCTables::GetOpInfo(PowerPC::HostRead_Instruction(count.guest_pc));
+      opnames.push_back(info ? info->opname : "unknown");
+    }
+  });
+
+  File::IOFile f(filename, "w");
+  if (!f)
+  {
+    PanicAlertFmt("Failed to open {}", filename);
+    return;
+  }
+
+  std::vector<u32> addresses;
+  addresses.reserve(counts.size());
+  for (const Profiler::JitEventCount& count : counts)
+    addresses.push_back(count.guest_pc);
+  const std::vector<Common::Symbol*> symbols = g_symbolDB.GetSymbolsFromAddrs(addresses);
+
+  // Only the addresses which matter the most are listed, the opcodes sum up all of them.
+  constexpr size_t MAX_ADDRESSES_PER_EVENT = 50;
+
+  for (size_t event = 0; event < Profiler::NUM_JIT_EVENTS; ++event)
+  {
+    struct OpcodeCount
+    {
+      const char* opname;
+      u64 count;
+    };
+
+    std::vector<OpcodeCount> opcodes;
+    std::unordered_map<const char*, size_t> opcode_indices;
+    u64 total = 0;
+    for (size_t i = 0; i < counts.size(); ++i)
+    {
+      if (static_cast<size_t>(counts[i].event) != event)
+        continue;
+      const auto [it, inserted] = opcode_indices.try_emplace(opnames[i], opcodes.size());
+      if (inserted)
+        opcodes.push_back({opnames[i], 0});
+      opcodes[it->second].count += counts[i].count;
+      total += counts[i].count;
+    }
+    std::stable_sort(opcodes.begin(), opcodes.end(),
+                     [](const OpcodeCount& a, const OpcodeCount& b) { return a.count > b.count; });
+
+    f.WriteString(fmt::format("{}: {}\n\nopcode\tcount\n",
+                              Profiler::GetJitEventName(static_cast<Profiler::JitEvent>(event)),
+                              total));
+    for (const OpcodeCount& opcode : opcodes)
+      f.WriteString(fmt::format("{}\t{}\n", opcode.opname, opcode.count));
+
+    // The counts are sorted, so the first addresses of each event are the most hit ones.
+    f.WriteString("\naddr\topcode\tfuncName\tcount\n");
+    size_t addresses_written = 0;
+    for (size_t i = 0; i < counts.size() && addresses_written < MAX_ADDRESSES_PER_EVENT; ++i)
+    {
+      if (static_cast<size_t>(counts[i].event) != event)
+        continue;
+      const std::string& name = symbols[i] ? symbols[i]->name : " --- ";
+      f.WriteString(fmt::format("{:08x}\t{}\t{}\t{}\n", counts[i].guest_pc, opnames[i], name,
+                                counts[i].count));
+      ++addresses_written;
+    }
+    f.WriteString("\n");
+  }
+}
+
 std::variant<GetHostCodeError, GetHostCodeResult> GetHostCode(u32 address)
 {
   if (!g_jit)
@@ -186,6 +378,31 @@ std::variant<GetHostCodeError, GetHostCodeResult> GetHostCode(u32 address)
   return result;
 }
 
+CacheStats GetCacheStats()
+{
+  if (!g_jit)
+    return {};
+
+  const JitBaseBlockCache* block_cache = g_jit->GetBlockCache();
+  CacheStats stats;
+  stats.block_count = block_cache->GetBlockCount();
+  stats.code_bytes = block_cache->GetCodeBytes();
+  stats.code_capacity = g_jit->GetNearCodeSize();
+  stats.far_code_bytes = block_cache->GetFarCodeBytes();
+  stats.far_code_capacity = g_jit->GetFarCodeSize();
+  stats.trampoline_bytes = g_jit->GetTrampolineCodeUsed();
+  stats.trampoline_capacity = g_jit->GetTrampolineCodeSize();
+  stats.invalidations = block_cache->GetInvalidationCount();
+  stats.invalidated_blocks = block_cache->GetInvalidatedBlockCount();
+  stats.evicted_generations = block_cache->GetEvictedGenerationCount();
+  stats.code_space_full_flushes = g_jit->GetCacheFlushCount(JitCacheFlushCause::CodeSpaceFull);
+  stats.trampolines_full_flushes = g_jit->GetCacheFlushCount(JitCacheFlushCause::TrampolinesFull);
+  stats.stack_fault_flushes = g_jit->GetCacheFlushCount(JitCacheFlushCause::StackFault);
+  stats.no_block_cache_flushes = g_jit->GetCacheFlushCount(JitCacheFlushCause::NoBlockCache);
+  stats.requested_flushes = g_jit->GetCacheFlushCount(JitCacheFlushCause::Requested);
+  return stats;
+}
+
 bool HandleFault(uintptr_t access_address, SContext* ctx)
 {
   // Prevent nullptr dereference on a crash with no JIT present
@@ -194,6 +411,10 @@ bool HandleFault(uintptr_t access_address, SContext* ctx)
     return false;
   }
 
+  // Writes to pages watched by write tracking just have to be allowed and retried.
+  if (Core::System::GetInstance().GetMemory().HandleWriteTrackingFault(access_address))
+    return true;
+
   return g_jit->HandleFault(access_address, ctx);
 }
 
@@ -210,7 +431,10 @@ bool HandleStackFault()
 void ClearCache()
 {
   if (g_jit)
+  {
+    g_jit->CountCacheFlush(JitCacheFlushCause::Requested);
     g_jit->ClearCache();
+  }
 }
 void ClearSafe()
 {
@@ -246,6 +470,12 @@ void InvalidateICacheLines(u32 address, u32 count)
     InvalidateICache(address & ~0x1f, 32 * count, false);
 }
 
+void InvalidatePhysicalRange(u32 physical_address, u32 size)
+{
+  if (g_jit)
+    g_jit->GetBlockCache()->ErasePhysicalRange(physical_address, size);
+}
+
 void CompileExceptionCheck(ExceptionType type)
 {
   if (!g_jit)
@@ -264,6 +494,9 @@ void CompileExceptionCheck(ExceptionType type)
   case ExceptionType::SpeculativeConstants:
     exception_addresses = &g_jit->js.noSpeculativeConstantsAddresses;
     break;
+  case ExceptionType::HotBlock:
+    exception_addresses = &g_jit->js.hotBlockAddresses;
+    break;
   }
 
   if (PowerPC::ppcState.pc != 0 &&
@@ -29,7 +29,8 @@ enum class ExceptionType
 {
   FIFOWrite,
   PairedQuantize,
-  SpeculativeConstants
+  SpeculativeConstants,
+  HotBlock
 };
 
 void DoState(PointerWrap& p);
@@ -56,10 +57,44 @@ struct GetHostCodeResult
   u32 entry_address;
 };
 
+struct CacheStats
+{
+  u32 block_count = 0;
+
+  // The space used by blocks in each code region, and the size of the region.
+  u64 code_bytes = 0;
+  u64 code_capacity = 0;
+  u64 far_code_bytes = 0;
+  u64 far_code_capacity = 0;
+  u64 trampoline_bytes = 0;
+  u64 trampoline_capacity = 0;
+
+  u64 invalidations = 0;
+  u64 invalidated_blocks = 0;
+  u64 evicted_generations = 0;
+
+  // The number of times the whole cache was cleared, by cause.
+  u64 code_space_full_flushes = 0;
+  u64 trampolines_full_flushes = 0;
+  u64 stack_fault_flushes = 0;
+  u64 no_block_cache_flushes = 0;
+  u64 requested_flushes = 0;
+};
+
 void SetProfilingState(ProfilingState state);
 void WriteProfileResults(const std::string& filename);
 void GetProfileResults(Profiler::ProfileStats* prof_stats);
+
+// The sampling profiler samples the thread it was started on, which should be the CPU thread.
+void StartSamplingProfiler();
+void StopSamplingProfiler();
+void WriteSampledProfile(const std::string& filename);
+// Writes how often the JIT took its slow paths, per opcode and for the most affected addresses.
+void WriteJitEventCounters(const std::string& filename);
 std::variant<GetHostCodeError, GetHostCodeResult> GetHostCode(u32 address);
+// The occupancy of the block cache, or zeros if no JIT is active. Can be called from any thread
+// while the emulation is running.
+CacheStats GetCacheStats();
 
 // Memory Utilities
 bool HandleFault(uintptr_t access_address, SContext* ctx);
@@ -77,6 +112,8 @@ void ClearSafe();
 void InvalidateICache(u32 address, u32 size, bool forced);
 void InvalidateICacheLine(u32 address);
 void InvalidateICacheLines(u32 address, u32 count);
+// Erases all blocks containing code from the physical range, which has been written to.
+void InvalidatePhysicalRange(u32 physical_address, u32 size);
 
 void CompileExceptionCheck(ExceptionType type);
 
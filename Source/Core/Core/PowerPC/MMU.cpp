@@ -3,10 +3,12 @@
 
 #include "Core/PowerPC/MMU.h"
 
+#include <algorithm>
 #include <bit>
 #include <cstddef>
 #include <cstring>
 #include <string>
+#include <vector>
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
@@ -428,7 +430,10 @@ static void WriteToHardware(Core::System& system, Memory::MemoryManager& memory,
       ppcState.dCache.Write(em_address, &swapped_data, size, HID0(PowerPC::ppcState).DLOCK);
 
     if (!ppcState.m_enable_dcache || wi || flag != XCheckTLBFlag::Write)
+    {
       std::memcpy(&memory.GetRAM()[em_address], &swapped_data, size);
+      memory.MarkWritten(em_address, size);
+    }
 
     return;
   }
@@ -445,7 +450,10 @@ static void WriteToHardware(Core::System& system, Memory::MemoryManager& memory,
     }
 
     if (!ppcState.m_enable_dcache || wi || flag != XCheckTLBFlag::Write)
+    {
       std::memcpy(&memory.GetEXRAM()[em_address], &swapped_data, size);
+      memory.MarkWritten(em_address | 0x10000000, size);
+    }
 
     return;
   }
@@ -975,9 +983,19 @@ std::optional<ReadResult<std::string>> HostTryReadString(u32 address, size_t siz
   return ReadResult<std::string>(c->translated, std::move(s));
 }
 
+// The JIT compiles accesses to the addresses accepted by the IsOptimizable functions without the
+// memcheck code, so those must not be used for pages with memchecks. 32 bytes covers the largest
+// access done this way. Adding a memcheck clears the JIT cache.
+static bool MayHitMemCheck(u32 address)
+{
+  return PowerPC::memchecks.HasAny() &&
+         (PowerPC::memchecks.OverlapsMemcheck(address, HW_PAGE_SIZE) ||
+          PowerPC::memchecks.OverlapsMemcheck(address + 31, HW_PAGE_SIZE));
+}
+
 bool IsOptimizableRAMAddress(const u32 address)
 {
-  if (PowerPC::memchecks.HasAny())
+  if (MayHitMemCheck(address))
     return false;
 
   if (!PowerPC::ppcState.msr.DR)
@@ -1045,6 +1063,42 @@ bool HostIsRAMAddress(u32 address, RequestedAddressSpace space)
   return false;
 }
 
+u8* HostGetRAMPointer(u32 address, RequestedAddressSpace space)
+{
+  auto& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
+
+  bool translate = false;
+  switch (space)
+  {
+  case RequestedAddressSpace::Effective:
+    translate = PowerPC::ppcState.msr.DR;
+    break;
+  case RequestedAddressSpace::Physical:
+    break;
+  case RequestedAddressSpace::Virtual:
+    if (!PowerPC::ppcState.msr.DR)
+      return nullptr;
+    translate = true;
+    break;
+  }
+
+  if (translate)
+  {
+    auto translate_address = TranslateAddress<XCheckTLBFlag::NoException>(address);
+    if (!translate_address.Success())
+      return nullptr;
+    address = translate_address.address;
+  }
+
+  const u32 segment = address >> 28;
+  if (memory.GetRAM() && segment == 0x0 && (address & 0x0FFFFFFF) < memory.GetRamSizeReal())
+    return &memory.GetRAM()[address & memory.GetRamMask()];
+  if (memory.GetEXRAM() && segment == 0x1 && (address & 0x0FFFFFFF) < memory.GetExRamSizeReal())
+    return &memory.GetEXRAM()[address & 0x0FFFFFFF];
+  return nullptr;
+}
+
 bool HostIsInstructionRAMAddress(u32 address, RequestedAddressSpace space)
 {
   // Instructions are always 32bit aligned.
@@ -1109,6 +1163,7 @@ void DMA_LCToMemory(const u32 mem_address, const u32 cache_address, const u32 nu
     return;
 
   memcpy(dst, src, 32 * num_blocks);
+  memory.MarkWritten(mem_address, 32 * num_blocks);
 }
 
 void DMA_MemoryToLC(const u32 cache_address, const u32 mem_address, const u32 num_blocks)
@@ -1174,6 +1229,14 @@ void ClearDCacheLine(u32 address)
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
 
+  // Zeroing a line of the gather pipe pushes 32 zero bytes at once, which fills a whole burst.
+  if ((address & 0xFFFFF000) == GPFifo::GATHER_PIPE_PHYSICAL_ADDRESS)
+  {
+    static constexpr u8 zeroes[32]{};
+    system.GetGPFifo().WriteBlock(zeroes, sizeof(zeroes));
+    return;
+  }
+
   // TODO: This isn't precisely correct for non-RAM regions, but the difference
   // is unlikely to matter.
   for (u32 i = 0; i < 32; i += 4)
@@ -1276,7 +1339,7 @@ void TouchDCacheLine(u32 address, bool store)
 
 u32 IsOptimizableMMIOAccess(u32 address, u32 access_size)
 {
-  if (PowerPC::memchecks.HasAny())
+  if (MayHitMemCheck(address))
     return 0;
 
   if (!PowerPC::ppcState.msr.DR)
@@ -1299,7 +1362,7 @@ u32 IsOptimizableMMIOAccess(u32 address, u32 access_size)
 
 bool IsOptimizableGatherPipeWrite(u32 address)
 {
-  if (PowerPC::memchecks.HasAny())
+  if (MayHitMemCheck(address))
     return false;
 
   if (!PowerPC::ppcState.msr.DR)
@@ -1415,6 +1478,89 @@ void SDRUpdated()
 
   ppcState.pagetable_base = htaborg << 16;
   ppcState.pagetable_hashmask = ((htabmask << 10) | 0x3ff);
+
+  InvalidateTranslationCache();
+
+  Core::System::GetInstance().GetMemory().RemovePageTableMappings();
+}
+
+struct TranslationCacheEntry
+{
+  static constexpr u32 INVALID_TAG = 0xffffffff;
+
+  u32 tag = INVALID_TAG;
+  u32 pte2 = 0;
+};
+
+// Direct-mapped and indexed by effective page number, separately for data and instructions.
+static std::array<std::vector<TranslationCacheEntry>, NUM_TLBS> s_translation_cache;
+static u32 s_translation_cache_mask = 0;
+
+static TLBStatistics s_tlb_statistics;
+
+void InitTranslationCache(u32 size)
+{
+  // The size has to be a multiple of the number of TLB congruence classes, so that the entries of
+  // a class can be found quickly when it gets invalidated.
+  constexpr u32 min_size = HW_PAGE_INDEX_MASK + 1;
+  constexpr u32 max_size = 0x10000;
+  size = size == 0 ? 0 : std::bit_floor(std::clamp(size, min_size, max_size));
+
+  for (auto& cache : s_translation_cache)
+    cache.assign(size, TranslationCacheEntry{});
+  s_translation_cache_mask = size - 1;
+}
+
+void InvalidateTranslationCache()
+{
+  for (auto& cache : s_translation_cache)
+    std::fill(cache.begin(), cache.end(), TranslationCacheEntry{});
+}
+
+static void InvalidateTranslationCacheClass(u32 entry_index)
+{
+  for (auto& cache : s_translation_cache)
+  {
+    for (size_t i = entry_index; i < cache.size(); i += HW_PAGE_INDEX_MASK + 1)
+      cache[i] = TranslationCacheEntry{};
+  }
+}
+
+static bool LookupTranslationCache(const XCheckTLBFlag flag, const u32 vpa, UPTE_Hi* pte2)
+{
+  auto& cache = s_translation_cache[IsOpcodeFlag(flag)];
+  if (cache.empty())
+    return false;
+
+  const u32 tag = vpa >> HW_PAGE_INDEX_SHIFT;
+  const TranslationCacheEntry& entry = cache[tag & s_translation_cache_mask];
+  if (entry.tag != tag)
+    return false;
+
+  // The page table has to be walked anyway if the C bit needs updating.
+  pte2->Hex = entry.pte2;
+  return flag != XCheckTLBFlag::Write || pte2->C != 0;
+}
+
+static void UpdateTranslationCache(const XCheckTLBFlag flag, UPTE_Hi pte2, const u32 vpa)
+{
+  // Lookups without exceptions don't update the R bit, so they can't be cached.
+  auto& cache = s_translation_cache[IsOpcodeFlag(flag)];
+  if (IsNoExceptionFlag(flag) || cache.empty())
+    return;
+
+  const u32 tag = vpa >> HW_PAGE_INDEX_SHIFT;
+  cache[tag & s_translation_cache_mask] = TranslationCacheEntry{tag, pte2.Hex};
+}
+
+const TLBStatistics& GetTLBStatistics()
+{
+  return s_tlb_statistics;
+}
+
+void ResetTLBStatistics()
+{
+  s_tlb_statistics = {};
 }
 
 enum class TLBLookupResult
@@ -1446,7 +1592,10 @@ static TLBLookupResult LookupTLBPageAddress(const XCheckTLBFlag flag, const u32
     }
 
     if (!IsNoExceptionFlag(flag))
+    {
       tlbe.recent = 0;
+      s_tlb_statistics.tlb_way_hits[0]++;
+    }
 
     *paddr = tlbe.paddr[0] | (vpa & 0xfff);
     *wi = (pte2.WIMG & 0b1100) != 0;
@@ -1469,7 +1618,10 @@ static TLBLookupResult LookupTLBPageAddress(const XCheckTLBFlag flag, const u32
     }
 
     if (!IsNoExceptionFlag(flag))
+    {
       tlbe.recent = 1;
+      s_tlb_statistics.tlb_way_hits[1]++;
+    }
 
     *paddr = tlbe.paddr[1] | (vpa & 0xfff);
     *wi = (pte2.WIMG & 0b1100) != 0;
@@ -1499,6 +1651,10 @@ void InvalidateTLBEntry(u32 address)
 
   ppcState.tlb[0][entry_index].Invalidate();
   ppcState.tlb[1][entry_index].Invalidate();
+  InvalidateTranslationCacheClass(entry_index);
+
+  // tlbie invalidates the whole congruence class, so do the same with the host mappings.
+  Core::System::GetInstance().GetMemory().RemovePageTableMappings(HW_PAGE_INDEX_MASK, entry_index);
 }
 
 union EffectiveAddress
@@ -1542,6 +1698,25 @@ static TranslateAddressResult TranslatePageAddress(const EffectiveAddress addres
     return TranslateAddressResult{TranslateAddressResultEnum::PAGE_FAULT, 0};
   }
 
+  if (res == TLBLookupResult::NotFound)
+  {
+    UPTE_Hi pte2;
+    if (LookupTranslationCache(flag, address.Hex, &pte2))
+    {
+      if (!IsNoExceptionFlag(flag))
+        s_tlb_statistics.translation_cache_hits++;
+
+      UpdateTLBEntry(flag, pte2, address.Hex);
+      *wi = (pte2.WIMG & 0b1100) != 0;
+
+      return TranslateAddressResult{TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED,
+                                    (pte2.RPN << 12) | address.offset};
+    }
+  }
+
+  if (!IsNoExceptionFlag(flag))
+    s_tlb_statistics.page_table_walks++;
+
   const u32 offset = address.offset;          // 12 bit
   const u32 page_index = address.page_index;  // 16 bit
   const u32 VSID = sr.VSID;                   // 24 bit
@@ -1604,6 +1779,7 @@ static TranslateAddressResult TranslatePageAddress(const EffectiveAddress addres
         // We already updated the TLB entry if this was caused by a C bit.
         if (res != TLBLookupResult::UpdateC)
           UpdateTLBEntry(flag, pte2, address.Hex);
+        UpdateTranslationCache(flag, pte2, address.Hex);
 
         *wi = (pte2.WIMG & 0b1100) != 0;
 
@@ -1799,4 +1975,50 @@ std::optional<u32> GetTranslatedAddress(u32 address)
   return std::optional<u32>(result.address);
 }
 
+static bool IsPageChanged(u32 address)
+{
+  const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
+  const TLBEntry& tlbe = ppcState.tlb[0][tag & HW_PAGE_INDEX_MASK];
+  for (u32 i = 0; i < TLB_WAYS; ++i)
+  {
+    if (tlbe.tag[i] == tag)
+      return UPTE_Hi{tlbe.pte[i]}.C != 0;
+  }
+  return false;
+}
+
+bool MapPageTableTranslation(u32 address, bool write)
+{
+  auto& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
+
+  if (!memory.ArePageTableMappingsSupported() || !ppcState.msr.DR)
+    return false;
+
+  // BAT translations take priority, and if they aren't mapped already there's a reason for it.
+  u32 bat_address = address;
+  bool wi = false;
+  if (TranslateBatAddess(dbat_table, &bat_address, &wi))
+    return false;
+
+  // Fastmem doesn't support memchecks.
+  const u32 page_address = address & ~static_cast<u32>(HW_PAGE_MASK);
+  if (PowerPC::memchecks.OverlapsMemcheck(page_address, HW_PAGE_SIZE))
+    return false;
+
+  // This updates the R and C bits exactly like the access itself would have. Since host mappings
+  // can't tell reads from writes, reads only get a mapping once the C bit is already set.
+  // Otherwise, a later write through the mapping would skip setting it.
+  const TranslateAddressResult result =
+      write ? TranslatePageAddress(EffectiveAddress{address}, XCheckTLBFlag::Write, &wi) :
+              TranslatePageAddress(EffectiveAddress{address}, XCheckTLBFlag::Read, &wi);
+  if (result.result != TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED || wi)
+    return false;
+
+  if (!write && !IsPageChanged(address))
+    return false;
+
+  return memory.AddPageTableMapping(address, result.address);
+}
+
 }  // namespace PowerPC
@@ -120,6 +120,11 @@ HostTryWriteF64(double var, const u32 address,
 // address space.
 bool HostIsRAMAddress(u32 address, RequestedAddressSpace space = RequestedAddressSpace::Effective);
 
+// Returns a pointer to the MEM1 or MEM2 memory backing the given address in the given address
+// space, or nullptr if the address doesn't resolve to either of them. The pointer stays valid up to
+// the end of the HW page containing the address. Accesses through it bypass the emulated dcache.
+u8* HostGetRAMPointer(u32 address, RequestedAddressSpace space = RequestedAddressSpace::Effective);
+
 // Same as HostIsRAMAddress, but uses IBAT instead of DBAT.
 bool HostIsInstructionRAMAddress(u32 address,
                                  RequestedAddressSpace space = RequestedAddressSpace::Effective);
@@ -177,6 +182,34 @@ void InvalidateTLBEntry(u32 address);
 void DBATUpdated();
 void IBATUpdated();
 
+// The host-side translation cache holds the results of page table walks, so that translations
+// which got evicted from the emulated TLB can be reloaded without walking the page table again.
+// A size of 0 disables it. Other sizes get rounded to a power of two.
+void InitTranslationCache(u32 size);
+void InvalidateTranslationCache();
+
+struct TLBStatistics
+{
+  // Lookups which hit in each way of the emulated TLB.
+  std::array<u64, 2> tlb_way_hits{};
+  // TLB misses which hit in the translation cache.
+  u64 translation_cache_hits = 0;
+  // TLB misses which had to walk the page table.
+  u64 page_table_walks = 0;
+
+  u64 GetTotalLookups() const
+  {
+    return tlb_way_hits[0] + tlb_way_hits[1] + translation_cache_hits + page_table_walks;
+  }
+};
+
+const TLBStatistics& GetTLBStatistics();
+void ResetTLBStatistics();
+
+// Called when a fastmem access to an address without a BAT translation faults. Maps the page the
+// address is in if it has a page table translation, in which case the access can be retried.
+bool MapPageTableTranslation(u32 address, bool write);
+
 // Result changes based on the BAT registers and MSR.DR.  Returns whether
 // it's safe to optimize a read or write to this address to an unguarded
 // memory access.  Does not consider page tables.
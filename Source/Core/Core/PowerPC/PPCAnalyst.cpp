@@ -667,6 +667,64 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
   }
 }
 
+// Instructions which don't affect the state of the emulated system besides their register
+// outputs, and whose results can only change through the passage of time or through CoreTiming
+// events. These are found in spin-waits on the time base (like OSSleep-style delays) and in polls
+// of hardware registers, which often use barriers to order the MMIO accesses.
+static bool IsWaitLoopSystemOp(const CodeOp& op)
+{
+  const UGeckoInstruction inst = op.inst;
+  if (inst.OPCD == 19)
+    return inst.SUBOP10 == 150;  // isync
+
+  if (inst.OPCD != 31)
+    return false;
+
+  switch (inst.SUBOP10)
+  {
+  case 598:  // sync
+  case 854:  // eieio
+    return true;
+  case 339:  // mfspr
+  case 371:  // mftb
+  {
+    const u32 index = (inst.SPRU << 5) | (inst.SPRL & 0x1F);
+    return index == SPR_TL || index == SPR_TU || index == SPR_DEC;
+  }
+  default:
+    return false;
+  }
+}
+
+// Looks at the straight-line code starting at the given address to find out whether it can read
+// the carry flag before overwriting it. Like within blocks, anything that can end a block or cause
+// an exception is assumed to need it.
+bool PPCAnalyzer::IsCarryWantedAt(CodeBlock* block, u32 address) const
+{
+  constexpr u32 MAX_INSTRUCTIONS = 16;
+
+  for (u32 i = 0; i < MAX_INSTRUCTIONS; ++i, address += 4)
+  {
+    const auto result = PowerPC::TryReadInstruction(address);
+    if (!result.valid)
+      return true;
+
+    // The block depends on this code now, so it has to be invalidated when the code changes.
+    block->m_physical_addresses.insert(result.physical_address);
+
+    const UGeckoInstruction inst = result.hex;
+    const GekkoOPInfo* opinfo = PPCTables::GetOpInfo(inst);
+    if (opinfo->flags & (FL_ENDBLOCK | FL_LOADSTORE | FL_PROGRAMEXCEPTION | FL_USE_FPU))
+      return true;
+    if (opinfo->flags & FL_READ_CA)
+      return true;
+    if (opinfo->flags & FL_SET_CA)
+      return false;
+  }
+
+  return true;
+}
+
 bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const
 {
   // Very basic algorithm to detect busy wait loops:
@@ -675,10 +733,13 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
   //   * It only reads from registers it wrote to earlier in the loop, or it
   //     does not write to these registers.
   //
+  // Besides integer instructions and loads (which includes polling MMIO registers), reads of the
+  // time base and decrementer and memory barriers are allowed too, see IsWaitLoopSystemOp.
+  //
   // Would benefit a lot from basic inlining support - a lot of the most
   // used busy loops are DSP register interactions, which are bl/cmp/bne
   // (with the bl target a pure function that follows the above rules). We
-  // don't detect these at the moment.
+  // only detect these when the call got inlined by branch following.
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
   for (size_t i = 0; i <= instructions; ++i)
@@ -690,7 +751,8 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
       if (code[i].branchTo == block->m_address && i == instructions)
         return true;
     }
-    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
+    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load &&
+             !IsWaitLoopSystemOp(code[i]))
     {
       // In the future, some subsets of other instruction types might get
       // supported. Right now, only try loops that have this very
@@ -777,6 +839,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     bool follow = false;
 
     bool conditional_continue = false;
+    bool cold_branch = false;
 
     // TODO: Find the optimal value for BRANCH_FOLLOWING_THRESHOLD.
     //       If it is small, the performance will be down.
@@ -864,10 +927,26 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
         // Seen in NES games
         conditional_continue = true;
       }
+
+      const BranchProfile::Counts* counts =
+          (m_branch_profile && conditional_continue && inst.OPCD == 16) ?
+              m_branch_profile->FindCounts(address) :
+              nullptr;
+      const u32 samples = counts ? counts->taken + counts->not_taken : 0;
+      if (samples >= BranchProfile::MIN_SAMPLES)
+      {
+        // The code after a branch which is almost always taken is cold,
+        // so end the block here instead of compiling it.
+        if (counts->taken * 16 >= samples * 15)
+          conditional_continue = false;
+        else if (counts->taken * 16 <= samples)
+          cold_branch = true;
+      }
     }
 
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
+    code[i].branchIsCold = cold_branch;
 
     if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
     {
@@ -884,10 +963,12 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
         found_exit = true;
         break;
       }
-      if (conditional_continue)
+      if (conditional_continue && !cold_branch)
       {
         // If we skip any conditional branch, we can't garantee to get the matching CALL/RET pair.
         // So we stop inling the RET here and let the BLR optitmization handle this case.
+        // Branches which are known to be almost never taken are the exception, since leaving
+        // the callee early only costs a mispredicted BLR stack entry.
         found_call = false;
       }
     }
@@ -907,11 +988,35 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   // Scan for flag dependencies; assume the next block (or any branch that can leave the block)
   // wants flags, to be safe.
   bool wantsCR0 = true, wantsCR1 = true, wantsFPRF = true, wantsCA = true;
+
+  // Unless we know where the block continues, in which case the carry flag only needs to be kept
+  // if the code there can read it. The flags are only observed by the code after the block, and
+  // by interrupts at block boundaries, which save and restore them around code that doesn't
+  // depend on them.
+  bool known_exit = false;
+  if (HasOption(OPTION_SUCCESSOR_CARRY) && !m_is_debugging_enabled && num_inst > 0)
+  {
+    const CodeOp& last_op = code[num_inst - 1];
+    if (block->m_broken && block_size != 1)
+    {
+      wantsCA = IsCarryWantedAt(block, address);
+    }
+    else if (found_exit && last_op.inst.OPCD == 18)
+    {
+      known_exit = true;
+      wantsCA = IsCarryWantedAt(block, last_op.branchTo);
+    }
+  }
+
   BitSet32 fprInUse, gprInUse, gprDiscardable, fprDiscardable, fprInXmm;
   for (int i = block->m_num_instructions - 1; i >= 0; i--)
   {
     CodeOp& op = code[i];
 
+    // An unconditional branch to a known address doesn't need any flags itself.
+    const bool exit_needs_carry =
+        op.canEndBlock && !(known_exit && i == static_cast<int>(num_inst) - 1);
+
     const bool opWantsCR0 = op.wantsCR0;
     const bool opWantsCR1 = op.wantsCR1;
     const bool opWantsFPRF = op.wantsFPRF;
@@ -919,11 +1024,11 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     op.wantsCR0 = wantsCR0 || op.canEndBlock || op.canCauseException;
     op.wantsCR1 = wantsCR1 || op.canEndBlock || op.canCauseException;
     op.wantsFPRF = wantsFPRF || op.canEndBlock || op.canCauseException;
-    op.wantsCA = wantsCA || op.canEndBlock || op.canCauseException;
+    op.wantsCA = wantsCA || exit_needs_carry || op.canCauseException;
     wantsCR0 |= opWantsCR0 || op.canEndBlock || op.canCauseException;
     wantsCR1 |= opWantsCR1 || op.canEndBlock || op.canCauseException;
     wantsFPRF |= opWantsFPRF || op.canEndBlock || op.canCauseException;
-    wantsCA |= opWantsCA || op.canEndBlock || op.canCauseException;
+    wantsCA |= opWantsCA || exit_needs_carry || op.canCauseException;
     wantsCR0 &= !op.outputCR0 || opWantsCR0;
     wantsCR1 &= !op.outputCR1 || opWantsCR1;
     wantsFPRF &= !op.outputFPRF || opWantsFPRF;
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -34,6 +35,8 @@ struct CodeOp  // 16B
   bool isBranchTarget = false;
   bool branchUsesCtr = false;
   bool branchIsIdleLoop = false;
+  // Whether the branch profile shows that this conditional branch is almost never taken.
+  bool branchIsCold = false;
   bool wantsCR0 = false;
   bool wantsCR1 = false;
   bool wantsFPRF = false;
@@ -126,6 +129,33 @@ struct CodeBlock
   std::set<u32> m_physical_addresses;
 };
 
+// How often conditional branches were taken at runtime, indexed by the address of the branch.
+// The counters are incremented directly by compiled code, so entries must stay at the same
+// address for as long as that code exists, which the node-based map guarantees.
+class BranchProfile
+{
+public:
+  struct Counts
+  {
+    u32 taken = 0;
+    u32 not_taken = 0;
+  };
+
+  // Below this number of samples, a branch is treated as if it had no profile.
+  static constexpr u32 MIN_SAMPLES = 32;
+
+  Counts& GetCounts(u32 address) { return m_counts[address]; }
+  const Counts* FindCounts(u32 address) const
+  {
+    const auto it = m_counts.find(address);
+    return it != m_counts.end() ? &it->second : nullptr;
+  }
+  void Clear() { m_counts.clear(); }
+
+private:
+  std::unordered_map<u32, Counts> m_counts;
+};
+
 class PPCAnalyzer
 {
 public:
@@ -165,6 +195,10 @@ public:
 
     // Reorder cror instructions next to their associated fcmp.
     OPTION_CROR_MERGE = (1 << 6),
+
+    // Look at the code a block branches to or runs into at its end, to find out whether it needs
+    // the carry flag which the block leaves behind.
+    OPTION_SUCCESSOR_CARRY = (1 << 7),
   };
 
   // Option setting/getting
@@ -175,6 +209,10 @@ public:
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
+  // If set, conditional branches with enough samples in the profile decide where blocks end:
+  // blocks end at branches which are almost always taken, since the code after them is cold,
+  // and calls can be inlined across branches which are almost never taken.
+  void SetBranchProfile(const BranchProfile* profile) { m_branch_profile = profile; }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
 
 private:
@@ -191,6 +229,7 @@ private:
   void ReorderInstructions(u32 instructions, CodeOp* code) const;
   void SetInstructionStats(CodeBlock* block, CodeOp* code, const GekkoOPInfo* opinfo) const;
   bool IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const;
+  bool IsCarryWantedAt(CodeBlock* block, u32 address) const;
 
   // Options
   u32 m_options = 0;
@@ -199,6 +238,7 @@ private:
   bool m_enable_branch_following = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
+  const BranchProfile* m_branch_profile = nullptr;
 };
 
 void FindFunctions(u32 startAddr, u32 endAddr, PPCSymbolDB* func_db);
@@ -126,6 +126,15 @@ void InstructionCache::Init()
   Cache::Init();
 }
 
+u8& Cache::GetLookupEntry(u32 addr)
+{
+  if (addr & CACHE_VMEM_BIT)
+    return lookup_table_vmem[(addr >> 5) & 0xfffff];
+  if (addr & CACHE_EXRAM_BIT)
+    return lookup_table_ex[(addr >> 5) & 0x1fffff];
+  return lookup_table[(addr >> 5) & 0xfffff];
+}
+
 void Cache::Store(u32 addr)
 {
   auto& system = Core::System::GetInstance();
@@ -167,12 +176,7 @@ void Cache::Invalidate(u32 addr)
 
   if (valid[set] & (1U << way))
   {
-    if (addrs[set][way] & CACHE_VMEM_BIT)
-      lookup_table_vmem[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
-    else if (addrs[set][way] & CACHE_EXRAM_BIT)
-      lookup_table_ex[(addrs[set][way] >> 5) & 0x1fffff] = 0xff;
-    else
-      lookup_table[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
+    GetLookupEntry(addrs[set][way]) = 0xff;
 
     valid[set] &= ~(1U << way);
     modified[set] &= ~(1U << way);
@@ -194,12 +198,7 @@ void Cache::Flush(u32 addr)
     if (modified[set] & (1U << way))
       memory.CopyToEmu((addr & ~0x1f), reinterpret_cast<u8*>(data[set][way].data()), 32);
 
-    if (addrs[set][way] & CACHE_VMEM_BIT)
-      lookup_table_vmem[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
-    else if (addrs[set][way] & CACHE_EXRAM_BIT)
-      lookup_table_ex[(addrs[set][way] >> 5) & 0x1fffff] = 0xff;
-    else
-      lookup_table[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
+    GetLookupEntry(addrs[set][way]) = 0xff;
 
     valid[set] &= ~(1U << way);
     modified[set] &= ~(1U << way);
@@ -218,20 +217,7 @@ std::pair<u32, u32> Cache::GetCache(u32 addr, bool locked)
 
   addr &= ~31;
   u32 set = (addr >> 5) & 0x7f;
-  u32 way;
-
-  if (addr & CACHE_VMEM_BIT)
-  {
-    way = lookup_table_vmem[(addr >> 5) & 0xfffff];
-  }
-  else if (addr & CACHE_EXRAM_BIT)
-  {
-    way = lookup_table_ex[(addr >> 5) & 0x1fffff];
-  }
-  else
-  {
-    way = lookup_table[(addr >> 5) & 0xfffff];
-  }
+  u32 way = GetLookupEntry(addr);
 
   // load to the cache
   if (!locked && way == 0xff)
@@ -248,23 +234,13 @@ std::pair<u32, u32> Cache::GetCache(u32 addr, bool locked)
       if (modified[set] & (1 << way))
         memory.CopyToEmu(addrs[set][way], reinterpret_cast<u8*>(data[set][way].data()), 32);
 
-      if (addrs[set][way] & CACHE_VMEM_BIT)
-        lookup_table_vmem[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
-      else if (addrs[set][way] & CACHE_EXRAM_BIT)
-        lookup_table_ex[(addrs[set][way] >> 5) & 0x1fffff] = 0xff;
-      else
-        lookup_table[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
+      GetLookupEntry(addrs[set][way]) = 0xff;
     }
 
     // load
     memory.CopyFromEmu(reinterpret_cast<u8*>(data[set][way].data()), (addr & ~0x1f), 32);
 
-    if (addr & CACHE_VMEM_BIT)
-      lookup_table_vmem[(addr >> 5) & 0xfffff] = way;
-    else if (addr & CACHE_EXRAM_BIT)
-      lookup_table_ex[(addr >> 5) & 0x1fffff] = way;
-    else
-      lookup_table[(addr >> 5) & 0xfffff] = way;
+    GetLookupEntry(addr) = way;
 
     addrs[set][way] = addr;
     valid[set] |= (1 << way);
@@ -350,14 +326,7 @@ void Cache::DoState(PointerWrap& p)
       for (u32 way = 0; way < CACHE_WAYS; way++)
       {
         if ((valid[set] & (1 << way)) != 0)
-        {
-          if (addrs[set][way] & CACHE_VMEM_BIT)
-            lookup_table_vmem[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
-          else if (addrs[set][way] & CACHE_EXRAM_BIT)
-            lookup_table_ex[(addrs[set][way] >> 5) & 0x1fffff] = 0xff;
-          else
-            lookup_table[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
-        }
+          GetLookupEntry(addrs[set][way]) = 0xff;
       }
     }
   }
@@ -376,14 +345,7 @@ void Cache::DoState(PointerWrap& p)
       for (u32 way = 0; way < CACHE_WAYS; way++)
       {
         if ((valid[set] & (1 << way)) != 0)
-        {
-          if (addrs[set][way] & CACHE_VMEM_BIT)
-            lookup_table_vmem[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
-          else if (addrs[set][way] & CACHE_EXRAM_BIT)
-            lookup_table_ex[(addrs[set][way] >> 5) & 0x1fffff] = 0xff;
-          else
-            lookup_table[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
-        }
+          GetLookupEntry(addrs[set][way]) = way;
       }
     }
   }
@@ -391,11 +353,14 @@ void Cache::DoState(PointerWrap& p)
 
 u32 InstructionCache::ReadInstruction(u32 addr)
 {
-  auto& system = Core::System::GetInstance();
-  auto& memory = system.GetMemory();
-
   if (!HID0(PowerPC::ppcState).ICE || m_disable_icache)  // instruction cache is disabled
-    return memory.Read_U32(addr);
+    return Core::System::GetInstance().GetMemory().Read_U32(addr);
+
+  // Nearly all fetches hit, and those only need the lookup table. GetCache() doesn't update the
+  // PLRU bits on hits either.
+  const u32 way = GetLookupEntry(addr);
+  if (way != 0xff)
+    return Common::swap32(data[(addr >> 5) & 0x7f][way][(addr >> 2) & (CACHE_BLOCK_SIZE - 1)]);
 
   u32 value;
   Read(addr, &value, sizeof(value), HID0(PowerPC::ppcState).ILOCK);
@@ -412,14 +377,7 @@ void InstructionCache::Invalidate(u32 addr)
   for (size_t way = 0; way < 8; way++)
   {
     if (valid[set] & (1U << way))
-    {
-      if (addrs[set][way] & CACHE_VMEM_BIT)
-        lookup_table_vmem[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
-      else if (addrs[set][way] & CACHE_EXRAM_BIT)
-        lookup_table_ex[(addrs[set][way] >> 5) & 0x1fffff] = 0xff;
-      else
-        lookup_table[(addrs[set][way] >> 5) & 0xfffff] = 0xff;
-    }
+      GetLookupEntry(addrs[set][way]) = 0xff;
   }
   valid[set] = 0;
   modified[set] = 0;
@@ -56,6 +56,10 @@ struct Cache
   void Reset();
 
   void DoState(PointerWrap& p);
+
+protected:
+  // The entry of lookup_table, lookup_table_ex or lookup_table_vmem for the block containing addr.
+  u8& GetLookupEntry(u32 addr);
 };
 
 struct InstructionCache : public Cache
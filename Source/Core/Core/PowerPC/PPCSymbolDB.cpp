@@ -43,6 +43,7 @@ Common::Symbol* PPCSymbolDB::AddFunction(u32 start_addr)
     return nullptr;
 
   m_functions[start_addr] = std::move(symbol);
+  m_functions_changed = true;
   Common::Symbol* ptr = &m_functions[start_addr];
   ptr->type = Common::Symbol::Type::Function;
   m_checksum_to_function[ptr->hash].insert(ptr);
@@ -86,28 +87,81 @@ void PPCSymbolDB::AddKnownSymbol(u32 startAddr, u32 size, const std::string& nam
       tf.size = size;
     }
     m_functions[startAddr] = tf;
+    m_functions_changed = true;
   }
 }
 
+void PPCSymbolDB::UpdateAddressIndex()
+{
+  if (!m_functions_changed)
+    return;
+
+  m_address_index.clear();
+  m_address_index.reserve(m_functions.size());
+  for (auto& [address, symbol] : m_functions)
+    m_address_index.push_back({address, &symbol});
+  m_last_hit = 0;
+  m_functions_changed = false;
+}
+
+// Returns the symbol containing addr, given the index of the first symbol starting after addr.
+Common::Symbol* PPCSymbolDB::FindSymbol(u32 addr, size_t index) const
+{
+  if (index == 0)
+    return nullptr;
+
+  // If the address is exactly the start address of a symbol, we're done. Otherwise, check
+  // whether the address is within the bounds of the symbol.
+  Common::Symbol* symbol = m_address_index[index - 1].symbol;
+  if (addr == symbol->address || addr - symbol->address < symbol->size)
+    return symbol;
+  return nullptr;
+}
+
 Common::Symbol* PPCSymbolDB::GetSymbolFromAddr(u32 addr)
 {
-  auto it = m_functions.lower_bound(addr);
+  std::lock_guard lk(m_address_index_mutex);
+  UpdateAddressIndex();
 
-  if (it != m_functions.end())
+  // Consecutive lookups tend to be for the same function.
+  if (m_last_hit < m_address_index.size() && addr >= m_address_index[m_last_hit].address &&
+      (m_last_hit + 1 == m_address_index.size() || addr < m_address_index[m_last_hit + 1].address))
   {
-    // If the address is exactly the start address of a symbol, we're done.
-    if (it->second.address == addr)
-      return &it->second;
+    return FindSymbol(addr, m_last_hit + 1);
   }
-  if (it != m_functions.begin())
+
+  const auto it = std::upper_bound(
+      m_address_index.begin(), m_address_index.end(), addr,
+      [](u32 address, const AddressIndexEntry& entry) { return address < entry.address; });
+  const size_t index = it - m_address_index.begin();
+  Common::Symbol* symbol = FindSymbol(addr, index);
+  if (symbol)
+    m_last_hit = index - 1;
+  return symbol;
+}
+
+std::vector<Common::Symbol*> PPCSymbolDB::GetSymbolsFromAddrs(const std::vector<u32>& addresses)
+{
+  std::vector<size_t> order(addresses.size());
+  for (size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  std::sort(order.begin(), order.end(),
+            [&](size_t a, size_t b) { return addresses[a] < addresses[b]; });
+
+  std::lock_guard lk(m_address_index_mutex);
+  UpdateAddressIndex();
+
+  // Walk the sorted addresses and the symbols side by side.
+  std::vector<Common::Symbol*> symbols(addresses.size());
+  size_t index = 0;
+  for (size_t i : order)
   {
-    // Otherwise, check whether the address is within the bounds of a symbol.
-    --it;
-    if (addr >= it->second.address && addr < it->second.address + it->second.size)
-      return &it->second;
+    const u32 addr = addresses[i];
+    while (index < m_address_index.size() && m_address_index[index].address <= addr)
+      ++index;
+    symbols[i] = FindSymbol(addr, index);
   }
-
-  return nullptr;
+  return symbols;
 }
 
 std::string PPCSymbolDB::GetDescription(u32 addr)
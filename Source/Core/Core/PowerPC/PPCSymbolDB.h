@@ -4,6 +4,7 @@
 #pragma once
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,9 @@ public:
                       Common::Symbol::Type type = Common::Symbol::Type::Function);
 
   Common::Symbol* GetSymbolFromAddr(u32 addr) override;
+  // Looks up the symbols containing each of the given addresses at once, which is faster than
+  // calling GetSymbolFromAddr for each of them. Entries are nullptr where there is no symbol.
+  std::vector<Common::Symbol*> GetSymbolsFromAddrs(const std::vector<u32>& addresses);
 
   std::string GetDescription(u32 addr);
 
@@ -38,7 +42,23 @@ public:
   void LogFunctionCall(u32 addr);
 
 private:
+  struct AddressIndexEntry
+  {
+    u32 address;
+    Common::Symbol* symbol;
+  };
+
+  void UpdateAddressIndex();
+  Common::Symbol* FindSymbol(u32 addr, size_t index) const;
+
   Common::DebugInterface* debugger;
+
+  // A flat copy of m_functions for address lookups, which are done for every JIT block when
+  // JitRegister is enabled and for every line of profiling and call stack output. Sizes are read
+  // from the symbols themselves since they can be changed through the pointers handed out.
+  std::vector<AddressIndexEntry> m_address_index;
+  size_t m_last_hit = 0;
+  std::mutex m_address_index_mutex;
 };
 
 extern PPCSymbolDB g_symbolDB;
@@ -23,6 +23,7 @@
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/Host.h"
 #include "Core/PowerPC/CPUCoreBase.h"
@@ -48,6 +49,7 @@ MemChecks memchecks;
 PPCDebugInterface debug_interface(Core::System::GetInstance());
 
 static CoreTiming::EventType* s_invalidate_cache_thread_safe;
+static CoreTiming::EventType* s_invalidate_written_code;
 
 double PairedSingle::PS0AsDouble() const
 {
@@ -74,6 +76,27 @@ static void InvalidateCacheThreadSafe(Core::System& system, u64 userdata, s64 cy
   ppcState.iCache.Invalidate(static_cast<u32>(userdata));
 }
 
+static void InvalidateWrittenCode(Core::System& system, u64 userdata, s64 cyclesLate)
+{
+  JitInterface::InvalidatePhysicalRange(static_cast<u32>(userdata),
+                                        static_cast<u32>(userdata >> 32));
+}
+
+// Called by the memory manager when a page containing compiled code has been written to.
+static void ScheduleInvalidateWrittenCode(u32 physical_address, u32 size)
+{
+  if (CPU::GetState() == CPU::State::Running && !Core::IsCPUThread())
+  {
+    Core::System::GetInstance().GetCoreTiming().ScheduleEvent(
+        0, s_invalidate_written_code, (u64(size) << 32) | physical_address,
+        CoreTiming::FromThread::NON_CPU);
+  }
+  else
+  {
+    JitInterface::InvalidatePhysicalRange(physical_address, size);
+  }
+}
+
 std::istream& operator>>(std::istream& is, CPUCore& core)
 {
   std::underlying_type_t<CPUCore> val{};
@@ -147,6 +170,7 @@ void DoState(PointerWrap& p)
     }
 
     RoundingModeUpdated();
+    InvalidateTranslationCache();
     IBATUpdated();
     DBATUpdated();
   }
@@ -272,7 +296,12 @@ void Init(CPUCore cpu_core)
 {
   s_invalidate_cache_thread_safe = Core::System::GetInstance().GetCoreTiming().RegisterEvent(
       "invalidateEmulatedCache", InvalidateCacheThreadSafe);
+  s_invalidate_written_code = Core::System::GetInstance().GetCoreTiming().RegisterEvent(
+      "invalidateWrittenCode", InvalidateWrittenCode);
+  Core::System::GetInstance().GetMemory().SetCodeWrittenCallback(ScheduleInvalidateWrittenCode);
 
+  InitTranslationCache(
+      static_cast<u32>(std::max(Config::Get(Config::MAIN_MMU_TRANSLATION_CACHE_SIZE), 0)));
   Reset();
 
   InitializeCPUCore(cpu_core);
@@ -290,6 +319,8 @@ void Reset()
   ppcState.pagetable_base = 0;
   ppcState.pagetable_hashmask = 0;
   ppcState.tlb = {};
+  InvalidateTranslationCache();
+  ResetTLBStatistics();
 
   ResetRegisters();
   ppcState.iCache.Reset();
@@ -312,6 +343,7 @@ void ScheduleInvalidateCacheThreadSafe(u32 address)
 void Shutdown()
 {
   InjectExternalCPUCore(nullptr);
+  Core::System::GetInstance().GetMemory().SetCodeWrittenCallback(nullptr);
   JitInterface::Shutdown();
   s_interpreter->Shutdown();
   s_cpu_core_base = nullptr;
@@ -660,6 +692,10 @@ void PowerPCState::SetSR(u32 index, u32 value)
 {
   DEBUG_LOG_FMT(POWERPC, "{:08x}: MMU: Segment register {} set to {:08x}", pc, index, value);
   sr[index] = value;
+
+  // Which page table entries the segment uses depends on its VSID.
+  InvalidateTranslationCache();
+  Core::System::GetInstance().GetMemory().RemovePageTableMappings(0xf0000, index << 16);
 }
 
 // FPSCR update functions
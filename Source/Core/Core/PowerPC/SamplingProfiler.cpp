@@ -0,0 +1,236 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/SamplingProfiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <signal.h>
+#endif
+
+#include "Common/Thread.h"
+#include "Core/MachineContext.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+
+#if _M_X86_64
+#define CTX_HOST_PC CTX_RIP
+#elif _M_ARM_64
+#define CTX_HOST_PC CTX_PC
+#endif
+
+namespace Profiler
+{
+#if !defined(_WIN32) && !defined(__APPLE__) && !defined(_M_GENERIC)
+namespace
+{
+// The sampled thread is interrupted with SIGPROF, and the handler running on it hands the host PC
+// to the sampler thread through this ring buffer. Nothing else is safe to do in a signal handler.
+constexpr u32 SAMPLE_RING_SIZE = 256;
+uintptr_t s_sample_ring[SAMPLE_RING_SIZE];
+std::atomic<u32> s_sample_ring_write = 0;
+std::atomic<u32> s_sample_ring_read = 0;
+
+struct sigaction s_old_sigprof;
+
+void SigprofHandler(int, siginfo_t*, void* raw_context)
+{
+  ucontext_t* context = static_cast<ucontext_t*>(raw_context);
+#ifdef __OpenBSD__
+  ucontext_t* ctx = context;
+#else
+  mcontext_t* ctx = &context->uc_mcontext;
+#endif
+
+  const u32 write = s_sample_ring_write.load(std::memory_order_relaxed);
+  if (write - s_sample_ring_read.load(std::memory_order_acquire) >= SAMPLE_RING_SIZE)
+    return;
+
+  s_sample_ring[write % SAMPLE_RING_SIZE] = static_cast<uintptr_t>(ctx->CTX_HOST_PC);
+  s_sample_ring_write.store(write + 1, std::memory_order_release);
+}
+
+template <typename F>
+void DrainSampleRing(F f)
+{
+  u32 read = s_sample_ring_read.load(std::memory_order_relaxed);
+  const u32 write = s_sample_ring_write.load(std::memory_order_acquire);
+  for (; read != write; ++read)
+    f(s_sample_ring[read % SAMPLE_RING_SIZE]);
+  s_sample_ring_read.store(read, std::memory_order_release);
+}
+}  // namespace
+#endif
+
+SamplingProfiler::~SamplingProfiler()
+{
+  Stop();
+}
+
+bool SamplingProfiler::Start()
+{
+  if (m_running)
+    return true;
+
+#if defined(_M_GENERIC)
+  return false;
+#else
+#if defined(_WIN32)
+  m_target_thread = OpenThread(THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT, FALSE,
+                               GetCurrentThreadId());
+  if (!m_target_thread)
+    return false;
+#elif defined(__APPLE__)
+  m_target_thread = mach_thread_self();
+#else
+  m_target_thread = pthread_self();
+
+  struct sigaction sa{};
+  sa.sa_sigaction = &SigprofHandler;
+  sa.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&sa.sa_mask);
+  if (sigaction(SIGPROF, &sa, &s_old_sigprof) != 0)
+    return false;
+#endif
+
+  m_stop_event.Reset();
+  m_running = true;
+  m_thread = std::thread(&SamplingProfiler::SamplerThread, this);
+  return true;
+#endif
+}
+
+void SamplingProfiler::Stop()
+{
+  if (!m_running)
+    return;
+
+  m_stop_event.Set();
+  m_thread.join();
+  m_running = false;
+
+#if defined(_WIN32)
+  CloseHandle(m_target_thread);
+  m_target_thread = nullptr;
+#elif defined(__APPLE__)
+  mach_port_deallocate(mach_task_self(), m_target_thread);
+  m_target_thread = 0;
+#elif !defined(_M_GENERIC)
+  sigaction(SIGPROF, &s_old_sigprof, nullptr);
+  DrainSampleRing([this](uintptr_t host_pc) { AddSample(host_pc); });
+#endif
+}
+
+void SamplingProfiler::SamplerThread()
+{
+  Common::SetCurrentThreadName("JIT sampling profiler");
+
+  while (!m_stop_event.WaitFor(SAMPLE_INTERVAL))
+    TakeSample();
+}
+
+void SamplingProfiler::TakeSample()
+{
+#if defined(_WIN32)
+  if (SuspendThread(m_target_thread) == static_cast<DWORD>(-1))
+    return;
+  CONTEXT context{};
+  context.ContextFlags = CONTEXT_CONTROL;
+  const bool success = GetThreadContext(m_target_thread, &context) != FALSE;
+  ResumeThread(m_target_thread);
+
+  // The thread could have been suspended while holding the heap lock, so the sample is only
+  // recorded once it is running again.
+  if (success)
+    AddSample(static_cast<uintptr_t>(context.CTX_HOST_PC));
+#elif defined(__APPLE__)
+#if _M_X86_64
+  x86_thread_state64_t state;
+  mach_msg_type_number_t count = x86_THREAD_STATE64_COUNT;
+  constexpr thread_state_flavor_t flavor = x86_THREAD_STATE64;
+#else
+  arm_thread_state64_t state;
+  mach_msg_type_number_t count = ARM_THREAD_STATE64_COUNT;
+  constexpr thread_state_flavor_t flavor = ARM_THREAD_STATE64;
+#endif
+  if (thread_suspend(m_target_thread) != KERN_SUCCESS)
+    return;
+  const kern_return_t result = thread_get_state(
+      m_target_thread, flavor, reinterpret_cast<thread_state_t>(&state), &count);
+  thread_resume(m_target_thread);
+
+  if (result == KERN_SUCCESS)
+  {
+#if _M_X86_64
+    AddSample(static_cast<uintptr_t>(state.__rip));
+#else
+    AddSample(static_cast<uintptr_t>(arm_thread_state64_get_pc(state)));
+#endif
+  }
+#elif !defined(_M_GENERIC)
+  // Collect what the previous signals delivered before sending the next one.
+  DrainSampleRing([this](uintptr_t host_pc) { AddSample(host_pc); });
+  pthread_kill(m_target_thread, SIGPROF);
+#endif
+}
+
+void SamplingProfiler::AddSample(uintptr_t host_pc)
+{
+  std::lock_guard lock(m_mutex);
+  ++m_pending_samples[host_pc];
+  ++m_total_samples;
+}
+
+void SamplingProfiler::ResolveBlock(const JitBlock& block)
+{
+  std::lock_guard lock(m_mutex);
+  if (m_pending_samples.empty())
+    return;
+
+  u64 samples = 0;
+  for (const auto& [begin, end] : {std::pair(block.near_begin, block.near_end),
+                                   std::pair(block.far_begin, block.far_end)})
+  {
+    const auto first = m_pending_samples.lower_bound(reinterpret_cast<uintptr_t>(begin));
+    const auto last = m_pending_samples.lower_bound(reinterpret_cast<uintptr_t>(end));
+    for (auto it = first; it != last; ++it)
+      samples += it->second;
+    m_pending_samples.erase(first, last);
+  }
+
+  if (samples != 0)
+    m_block_samples[block.effectiveAddress] += samples;
+}
+
+SampledProfile SamplingProfiler::GetProfile() const
+{
+  std::lock_guard lock(m_mutex);
+
+  SampledProfile profile;
+  profile.total_samples = m_total_samples;
+  profile.blocks.reserve(m_block_samples.size());
+  for (const auto& [addr, samples] : m_block_samples)
+    profile.blocks.push_back({addr, samples});
+  for (const auto& [host_pc, samples] : m_pending_samples)
+    profile.unattributed_samples += samples;
+
+  std::stable_sort(
+      profile.blocks.begin(), profile.blocks.end(),
+      [](const SampledBlock& a, const SampledBlock& b) { return a.samples > b.samples; });
+  return profile;
+}
+
+void SamplingProfiler::Clear()
+{
+  std::lock_guard lock(m_mutex);
+  m_pending_samples.clear();
+  m_block_samples.clear();
+  m_total_samples = 0;
+}
+}  // namespace Profiler
@@ -0,0 +1,92 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+
+struct JitBlock;
+
+namespace Profiler
+{
+struct SampledBlock
+{
+  u32 addr;
+  u64 samples;
+};
+
+struct SampledProfile
+{
+  // Sorted by number of samples, most sampled first.
+  std::vector<SampledBlock> blocks;
+  u64 total_samples = 0;
+  // Samples which were not in the code of any JIT block, e.g. in the dispatcher, in interpreter
+  // fallbacks or in the rest of the emulator.
+  u64 unattributed_samples = 0;
+};
+
+// Periodically samples the host program counter of one thread from a separate thread, and
+// attributes the samples to the JIT blocks whose host code contains them. Unlike the block
+// profiling built into the JITs, this doesn't add anything to the generated code, so it doesn't
+// change the timings it is measuring.
+class SamplingProfiler final
+{
+public:
+  static constexpr std::chrono::microseconds SAMPLE_INTERVAL{1000};
+
+  SamplingProfiler() = default;
+  ~SamplingProfiler();
+
+  SamplingProfiler(const SamplingProfiler&) = delete;
+  SamplingProfiler& operator=(const SamplingProfiler&) = delete;
+
+  // Starts sampling the calling thread. Returns false if sampling isn't supported here.
+  bool Start();
+  // Must be called on the sampled thread before it exits.
+  void Stop();
+  bool IsRunning() const { return m_running; }
+
+  // Attributes the pending samples which fall into the host code of the block. This must be
+  // called before the code of the block is freed, since the memory can be reused for other blocks.
+  void ResolveBlock(const JitBlock& block);
+
+  // Only includes the samples which have been resolved to a block so far.
+  SampledProfile GetProfile() const;
+  void Clear();
+
+private:
+  void SamplerThread();
+  void TakeSample();
+  void AddSample(uintptr_t host_pc);
+
+  std::thread m_thread;
+  Common::Event m_stop_event;
+  bool m_running = false;
+
+#if defined(_WIN32)
+  void* m_target_thread = nullptr;
+#elif defined(__APPLE__)
+  unsigned int m_target_thread = 0;
+#else
+  pthread_t m_target_thread{};
+#endif
+
+  mutable std::mutex m_mutex;
+  // Samples which haven't been attributed to a block yet, by host address.
+  std::map<uintptr_t, u64> m_pending_samples;
+  std::map<u32, u64> m_block_samples;
+  u64 m_total_samples = 0;
+};
+}  // namespace Profiler
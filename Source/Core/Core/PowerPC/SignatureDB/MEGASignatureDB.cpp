@@ -3,12 +3,15 @@
 
 #include "Core/PowerPC/SignatureDB/MEGASignatureDB.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
 #include <fstream>
 #include <limits>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include "Common/FileUtil.h"
@@ -21,6 +24,7 @@
 namespace
 {
 constexpr size_t INSTRUCTION_HEXSTRING_LENGTH = 8;
+constexpr size_t MAX_MATCH_THREADS = 8;
 
 bool GetCode(MEGASignature* sig, std::istringstream* iss)
 {
@@ -101,15 +105,14 @@ bool GetRefs(MEGASignature* sig, std::istringstream* iss)
   return true;
 }
 
-bool Compare(u32 address, u32 size, const MEGASignature& sig)
+bool Compare(const std::vector<u32>& code, const MEGASignature& sig)
 {
-  if (size != sig.code.size() * sizeof(u32))
+  if (code.size() != sig.code.size())
     return false;
 
   for (size_t i = 0; i < sig.code.size(); ++i)
   {
-    if (sig.code[i] != 0 &&
-        PowerPC::HostRead_U32(static_cast<u32>(address + i * sizeof(u32))) != sig.code[i])
+    if (sig.code[i] != 0 && code[i] != sig.code[i])
       return false;
   }
   return true;
@@ -122,6 +125,7 @@ MEGASignatureDB::~MEGASignatureDB() = default;
 void MEGASignatureDB::Clear()
 {
   m_signatures.clear();
+  m_index.clear();
 }
 
 bool MEGASignatureDB::Load(const std::string& file_path)
@@ -140,6 +144,11 @@ bool MEGASignatureDB::Load(const std::string& file_path)
 
     if (GetCode(&sig, &iss) && GetName(&sig, &iss) && GetRefs(&sig, &iss))
     {
+      SizeBucket& bucket = m_index[static_cast<u32>(sig.code.size() * sizeof(u32))];
+      if (sig.code.empty() || sig.code[0] == 0)
+        bucket.wildcard_first.push_back(m_signatures.size());
+      else
+        bucket.by_first_instruction[sig.code[0]].push_back(m_signatures.size());
       m_signatures.push_back(std::move(sig));
     }
     else
@@ -156,21 +165,81 @@ bool MEGASignatureDB::Save(const std::string& file_path) const
   return false;
 }
 
+const MEGASignature* MEGASignatureDB::FindMatch(const std::vector<u32>& code) const
+{
+  const auto bucket = m_index.find(static_cast<u32>(code.size() * sizeof(u32)));
+  if (bucket == m_index.end())
+    return nullptr;
+
+  static const std::vector<size_t> no_candidates;
+  const std::vector<size_t>* exact = &no_candidates;
+  if (!code.empty())
+  {
+    const auto it = bucket->second.by_first_instruction.find(code[0]);
+    if (it != bucket->second.by_first_instruction.end())
+      exact = &it->second;
+  }
+  const std::vector<size_t>& wildcard = bucket->second.wildcard_first;
+
+  // Walk both candidate lists in file order.
+  auto exact_it = exact->begin();
+  auto wildcard_it = wildcard.begin();
+  while (exact_it != exact->end() || wildcard_it != wildcard.end())
+  {
+    size_t index;
+    if (wildcard_it == wildcard.end() || (exact_it != exact->end() && *exact_it < *wildcard_it))
+      index = *exact_it++;
+    else
+      index = *wildcard_it++;
+
+    if (Compare(code, m_signatures[index]))
+      return &m_signatures[index];
+  }
+  return nullptr;
+}
+
 void MEGASignatureDB::Apply(PPCSymbolDB* symbol_db) const
 {
+  // Reading emulated memory isn't thread safe, so the code of every symbol which could match a
+  // signature is read up front, and only the comparisons are spread across threads.
+  std::vector<Common::Symbol*> symbols;
+  std::vector<std::vector<u32>> codes;
   for (auto& it : symbol_db->AccessSymbols())
   {
     auto& symbol = it.second;
-    for (const auto& sig : m_signatures)
-    {
-      if (Compare(symbol.address, symbol.size, sig))
-      {
-        symbol.name = sig.name;
-        INFO_LOG_FMT(SYMBOLS, "Found {} at {:08x} (size: {:08x})!", sig.name, symbol.address,
-                     symbol.size);
-        break;
-      }
-    }
+    if (symbol.size % sizeof(u32) != 0 || m_index.find(symbol.size) == m_index.end())
+      continue;
+
+    std::vector<u32>& code = codes.emplace_back(symbol.size / sizeof(u32));
+    for (size_t i = 0; i < code.size(); ++i)
+      code[i] = PowerPC::HostRead_U32(static_cast<u32>(symbol.address + i * sizeof(u32)));
+    symbols.push_back(&symbol);
+  }
+
+  std::vector<const MEGASignature*> matches(symbols.size());
+  std::atomic<size_t> next_symbol = 0;
+  const auto match = [&] {
+    for (size_t i = next_symbol++; i < symbols.size(); i = next_symbol++)
+      matches[i] = FindMatch(codes[i]);
+  };
+  const size_t num_threads =
+      std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MAX_MATCH_THREADS);
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < std::min(num_threads, symbols.size()); ++i)
+    threads.emplace_back(match);
+  match();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  for (size_t i = 0; i < symbols.size(); ++i)
+  {
+    if (!matches[i])
+      continue;
+
+    Common::Symbol& symbol = *symbols[i];
+    symbol.name = matches[i]->name;
+    INFO_LOG_FMT(SYMBOLS, "Found {} at {:08x} (size: {:08x})!", symbol.name, symbol.address,
+                 symbol.size);
   }
   symbol_db->Index();
 }
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -52,5 +53,18 @@ public:
   bool Add(u32 startAddr, u32 size, const std::string& name) override;
 
 private:
+  // Signatures of one code size, indexed by their first instruction.
+  struct SizeBucket
+  {
+    std::unordered_map<u32, std::vector<size_t>> by_first_instruction;
+    // Signatures starting with a wildcard, or without any code.
+    std::vector<size_t> wildcard_first;
+  };
+
+  const MEGASignature* FindMatch(const std::vector<u32>& code) const;
+
   std::vector<MEGASignature> m_signatures;
+  // Code size in bytes -> signatures of that size. The index lists are in ascending order, so the
+  // first matching signature in the file still wins.
+  std::unordered_map<u32, SizeBucket> m_index;
 };
@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/RewindBuffer.h"
+
+#include <utility>
+
+#include "Common/Assert.h"
+
+namespace State
+{
+RewindBuffer::RewindBuffer(size_t max_size) : m_max_size(max_size)
+{
+}
+
+void RewindBuffer::Push(std::vector<u8> state)
+{
+  if (m_has_newest)
+  {
+    StateDelta delta = StateDelta::Create(state, m_newest);
+    m_memory_usage += delta.GetMemoryUsage();
+    m_deltas.push_back(std::move(delta));
+    m_memory_usage -= m_newest.size();
+  }
+
+  m_newest = std::move(state);
+  m_has_newest = true;
+  m_memory_usage += m_newest.size();
+
+  TrimToBudget();
+}
+
+bool RewindBuffer::Pop(std::vector<u8>* state)
+{
+  if (!m_has_newest)
+    return false;
+
+  m_memory_usage -= m_newest.size();
+  if (m_deltas.empty())
+  {
+    *state = std::move(m_newest);
+    m_newest.clear();
+    m_has_newest = false;
+    return true;
+  }
+
+  std::vector<u8> older;
+  const bool applied = m_deltas.back().Apply(m_newest, &older);
+  ASSERT(applied);
+  m_memory_usage -= m_deltas.back().GetMemoryUsage();
+  m_deltas.pop_back();
+
+  *state = std::exchange(m_newest, std::move(older));
+  m_memory_usage += m_newest.size();
+  return true;
+}
+
+void RewindBuffer::Clear()
+{
+  m_newest.clear();
+  m_has_newest = false;
+  m_deltas.clear();
+  m_memory_usage = 0;
+}
+
+size_t RewindBuffer::GetCount() const
+{
+  return m_has_newest ? m_deltas.size() + 1 : 0;
+}
+
+void RewindBuffer::TrimToBudget()
+{
+  // The newest state is always kept, even if it alone is over budget.
+  while (m_memory_usage > m_max_size && !m_deltas.empty())
+  {
+    m_memory_usage -= m_deltas.front().GetMemoryUsage();
+    m_deltas.pop_front();
+  }
+}
+}  // namespace State
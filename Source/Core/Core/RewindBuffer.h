@@ -0,0 +1,46 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/StateDelta.h"
+
+namespace State
+{
+// Holds recent savestates for rewinding within a memory budget.
+//
+// Consecutive savestates are mostly identical, so only the newest state is kept in full. Every
+// older state is kept as the pages which differ from the state after it (a reverse delta), so
+// stepping back one state means patching the newest one, and dropping the oldest state when over
+// budget is free.
+class RewindBuffer final
+{
+public:
+  explicit RewindBuffer(size_t max_size);
+
+  void Push(std::vector<u8> state);
+
+  // Removes the newest state and moves it into state. Returns false if there are no states.
+  bool Pop(std::vector<u8>* state);
+
+  void Clear();
+
+  size_t GetCount() const;
+  size_t GetMemoryUsage() const { return m_memory_usage; }
+
+private:
+  void TrimToBudget();
+
+  size_t m_max_size;
+  size_t m_memory_usage = 0;
+  std::vector<u8> m_newest;
+  bool m_has_newest = false;
+  // Ordered from oldest to newest.
+  std::deque<StateDelta> m_deltas;
+};
+}  // namespace State
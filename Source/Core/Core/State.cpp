@@ -3,12 +3,17 @@
 
 #include "Core/State.h"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <thread>
 #include <utility>
@@ -17,18 +22,25 @@
 #include <fmt/format.h>
 
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
+#include "AudioCommon/Mixer.h"
+#include "AudioCommon/SoundStream.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
+#include "Common/Trace.h"
 #include "Common/Version.h"
 #include "Common/WorkQueueThread.h"
 
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -40,6 +52,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RewindBuffer.h"
 #include "Core/System.h"
 
 #include "VideoCommon/FrameDump.h"
@@ -60,10 +73,15 @@ static const u32 OUT_LEN = IN_LEN + (IN_LEN / 16) + 64 + 3;
 
 static unsigned char __LZO_MMODEL out[OUT_LEN];
 
-#define HEAP_ALLOC(var, size)                                                                      \
-  lzo_align_t __LZO_MMODEL var[((size) + (sizeof(lzo_align_t) - 1)) / sizeof(lzo_align_t)]
+// New states are split into frames of this size which are compressed independently, so that they
+// can be compressed and decompressed on several threads.
+constexpr size_t ZSTD_FRAME_SIZE = 0x400000;
 
-static HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
+struct ZstdFrameHeader
+{
+  u32 compressed_size;
+  u32 decompressed_size;
+};
 
 static AfterLoadCallbackFunc s_on_after_load_callback;
 
@@ -87,6 +105,17 @@ static std::mutex s_save_thread_mutex;
 // Queue for compressing and writing savestates to disk.
 static Common::WorkQueueThread<CompressAndDumpState_args> s_save_thread;
 
+// Savestates are tens of megabytes, and a good part of the time emulation is paused for when
+// saving goes to faulting in the pages of a freshly allocated buffer. The save thread hands its
+// buffer back here once the state has been written, so that the next save can reuse it. Loading
+// compressed states decompresses into the same buffer.
+static std::mutex s_save_buffer_pool_mutex;
+static std::vector<u8> s_save_buffer_pool;
+
+// Size of the last state that was saved. Buffers are sized from it, so that a state can usually
+// be written in a single pass instead of measuring it first.
+static std::atomic<size_t> s_last_state_size{0};
+
 // Keeps track of savestate writes that are currently happening, so we don't load a state while
 // another one is still saving. This is particularly important so if you save to a slot and then
 // immediately load from the same one, you don't accidentally load the state that's still at that
@@ -95,8 +124,58 @@ static std::mutex s_state_writes_in_queue_mutex;
 static size_t s_state_writes_in_queue;
 static std::condition_variable s_state_write_queue_is_empty;
 
+struct RewindPush_args
+{
+  std::vector<u8> buffer_vector;
+  u32 generation;
+};
+
+static std::mutex s_rewind_buffer_mutex;
+static std::unique_ptr<RewindBuffer> s_rewind_buffer;
+
+// Queue for diffing rewind states against the previous one, which is too slow for the CPU thread.
+static Common::WorkQueueThread<RewindPush_args> s_rewind_thread;
+
+// Bumped on every rewind, so that states which were captured before the rewind but haven't been
+// pushed yet don't end up on top of the state that was rewound to.
+static std::atomic<u32> s_rewind_generation;
+static std::atomic<bool> s_rewind_capture_queued;
+// Only accessed on the CPU thread.
+static int s_fields_since_rewind_capture;
+
+// Run-ahead hides input latency: after every real field, the state is saved, the next fields are
+// emulated ahead with the current input, the last of them is shown, and the saved state is loaded
+// again. What's shown thus reacts to input as many fields earlier as were emulated ahead.
+//
+// Saving and loading can't happen in the middle of the CoreTiming event that reports a new field,
+// so both go through the host like rewind captures, and happen a little into the next field.
+enum class RunAheadPhase
+{
+  // Emulating a real field, which isn't shown.
+  Real,
+  // Done with the real field, waiting for the state to be saved.
+  Saving,
+  // Emulating the fields ahead of the real one.
+  Ahead,
+  // Done with the fields ahead, waiting for the saved state to be loaded.
+  Loading,
+};
+
+constexpr int MAX_RUN_AHEAD_FIELDS = 6;
+
+// Only accessed on the CPU thread.
+static bool s_run_ahead_active;
+static RunAheadPhase s_run_ahead_phase;
+static int s_run_ahead_fields;
+static int s_run_ahead_fields_done;
+static std::vector<u8> s_run_ahead_buffer;
+static TimePoint s_run_ahead_throttle_deadline;
+// Bumped whenever run-ahead is interrupted, so that saves and loads that have already been queued
+// are ignored.
+static u32 s_run_ahead_generation;
+
 // Don't forget to increase this after doing changes on the savestate system
-constexpr u32 STATE_VERSION = 157;  // Last changed in PR 11183
+constexpr u32 STATE_VERSION = 159;  // Last changed to save the async perf query results
 
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
@@ -243,37 +322,287 @@ static void DoState(PointerWrap& p)
   p.DoMarker("Gecko");
 }
 
-void LoadFromBuffer(std::vector<u8>& buffer)
+static void SetRunningAhead(bool running_ahead)
 {
-  if (NetPlay::IsNetPlayRunning())
-  {
-    OSD::AddMessage("Loading savestates is disabled in Netplay to prevent desyncs");
-    return;
-  }
+  auto& system = Core::System::GetInstance();
+  system.GetCoreTiming().SetThrottleSuspended(running_ahead);
+  if (SoundStream* sound_stream = system.GetSoundStream())
+    sound_stream->GetMixer()->SetDiscardingSamples(running_ahead);
+}
+
+static void ResetRunAhead()
+{
+  ++s_run_ahead_generation;
+  s_run_ahead_active = false;
+  s_run_ahead_phase = RunAheadPhase::Real;
+  std::vector<u8>().swap(s_run_ahead_buffer);
+}
 
+// Called on the CPU thread when any other state is loaded, since loading the run-ahead state
+// afterwards would undo that.
+static void CancelRunAhead()
+{
+  ++s_run_ahead_generation;
+  if (s_run_ahead_phase == RunAheadPhase::Ahead || s_run_ahead_phase == RunAheadPhase::Loading)
+    SetRunningAhead(false);
+  s_run_ahead_phase = RunAheadPhase::Real;
+}
+
+static bool LoadFromBufferUnchecked(std::vector<u8>& buffer)
+{
+  bool loaded = false;
   Core::RunOnCPUThread(
       [&] {
+        CancelRunAhead();
         u8* ptr = buffer.data();
         PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
         DoState(p);
+        loaded = p.IsReadMode();
       },
       true);
+  return loaded;
+}
+
+void LoadFromBuffer(std::vector<u8>& buffer)
+{
+  if (NetPlay::IsNetPlayRunning())
+  {
+    OSD::AddMessage("Loading savestates is disabled in Netplay to prevent desyncs");
+    return;
+  }
+
+  LoadFromBufferUnchecked(buffer);
+}
+
+bool LoadNetPlaySyncedState(std::vector<u8>& buffer)
+{
+  return LoadFromBufferUnchecked(buffer);
+}
+
+// Writes the state into the buffer and resizes it to fit. Must be called on the CPU thread.
+static bool DoStateToBuffer(std::vector<u8>& buffer)
+{
+  // Leave some room for the state to grow since the last save, e.g. from new textures in the
+  // texture cache. If it still doesn't fit, PointerWrap switches to measuring when it runs out of
+  // space, and the state is written again into a buffer of the measured size.
+  const size_t expected_size = s_last_state_size.load(std::memory_order_relaxed);
+  const size_t min_size = expected_size + expected_size / 16;
+  if (buffer.size() < min_size)
+    buffer.resize(min_size);
+
+  u8* ptr = buffer.data();
+  PointerWrap p_try(&ptr, buffer.size(), PointerWrap::Mode::Write);
+  DoState(p_try);
+  const size_t state_size =
+      reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(buffer.data());
+  buffer.resize(state_size);
+  if (!p_try.IsMeasureMode())
+  {
+    s_last_state_size.store(state_size, std::memory_order_relaxed);
+    return p_try.IsWriteMode();
+  }
+
+  ptr = buffer.data();
+  PointerWrap p(&ptr, state_size, PointerWrap::Mode::Write);
+  DoState(p);
+  s_last_state_size.store(state_size, std::memory_order_relaxed);
+  return p.IsWriteMode();
 }
 
 void SaveToBuffer(std::vector<u8>& buffer)
 {
-  Core::RunOnCPUThread(
-      [&] {
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  Core::RunOnCPUThread([&] { DoStateToBuffer(buffer); }, true);
+}
+
+static int GetRunAheadFields()
+{
+  // Wii software writes to the NAND directly, which would keep the writes made by the fields that
+  // get thrown away. Immediate XFB presents frames without going through the VI, so they couldn't
+  // be hidden.
+  if (SConfig::GetInstance().bWii || NetPlay::IsNetPlayRunning() || Movie::IsMovieActive() ||
+      Config::Get(Config::GFX_HACK_IMMEDIATE_XFB))
+  {
+    return 0;
+  }
+
+  return std::clamp(Config::Get(Config::MAIN_RUN_AHEAD_FIELDS), 0, MAX_RUN_AHEAD_FIELDS);
+}
 
-        DoState(p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-        buffer.resize(buffer_size);
+static void QueueRunAheadJob(void (*job)(u32 generation))
+{
+  Core::QueueHostJob([job, generation = s_run_ahead_generation] {
+    if (Core::IsRunning())
+      Core::RunOnCPUThread([job, generation] { job(generation); }, false);
+  });
+}
+
+static void StartRunningAhead(u32 generation)
+{
+  if (generation != s_run_ahead_generation)
+    return;
+
+  SaveToBuffer(s_run_ahead_buffer);
+
+  auto& core_timing = Core::System::GetInstance().GetCoreTiming();
+  s_run_ahead_throttle_deadline = core_timing.GetThrottleDeadline();
+  SetRunningAhead(true);
 
-        ptr = buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
+  s_run_ahead_fields_done = 0;
+  s_run_ahead_phase = RunAheadPhase::Ahead;
+}
+
+static void StopRunningAhead(u32 generation)
+{
+  if (generation != s_run_ahead_generation)
+    return;
+
+  u8* ptr = s_run_ahead_buffer.data();
+  PointerWrap p(&ptr, s_run_ahead_buffer.size(), PointerWrap::Mode::Read);
+  DoState(p);
+
+  SetRunningAhead(false);
+  if (!p.IsReadMode())
+  {
+    // The state was made by this session moments ago, so this shouldn't happen.
+    Core::DisplayMessage("The run-ahead state could not be loaded", OSD::Duration::NORMAL);
+    ResetRunAhead();
+    return;
+  }
+
+  // Loading the state reset the throttle. Keep pacing the real fields from where they left off,
+  // so that the time spent emulating ahead is made up for by throttling less.
+  Core::System::GetInstance().GetCoreTiming().SetThrottleDeadline(s_run_ahead_throttle_deadline);
+
+  s_run_ahead_phase = RunAheadPhase::Real;
+}
+
+static void UpdateRunAhead()
+{
+  switch (s_run_ahead_phase)
+  {
+  case RunAheadPhase::Real:
+    s_run_ahead_fields = GetRunAheadFields();
+    s_run_ahead_active = s_run_ahead_fields != 0;
+    if (!s_run_ahead_active)
+    {
+      if (!s_run_ahead_buffer.empty())
+        ResetRunAhead();
+      return;
+    }
+
+    s_run_ahead_phase = RunAheadPhase::Saving;
+    QueueRunAheadJob(StartRunningAhead);
+    break;
+
+  case RunAheadPhase::Ahead:
+    if (++s_run_ahead_fields_done < s_run_ahead_fields)
+      return;
+
+    s_run_ahead_phase = RunAheadPhase::Loading;
+    QueueRunAheadJob(StopRunningAhead);
+    break;
+
+  case RunAheadPhase::Saving:
+  case RunAheadPhase::Loading:
+    break;
+  }
+}
+
+bool ShouldOutputField()
+{
+  return !s_run_ahead_active || (s_run_ahead_phase == RunAheadPhase::Ahead &&
+                                 s_run_ahead_fields_done == s_run_ahead_fields - 1);
+}
+
+void OnNewField()
+{
+  UpdateRunAhead();
+
+  // Rewinding to a state saved while running ahead would skip ahead instead.
+  if (!Config::Get(Config::MAIN_REWIND_ENABLED) || NetPlay::IsNetPlayRunning() ||
+      Movie::IsMovieActive() || s_run_ahead_active)
+  {
+    return;
+  }
+
+  if (++s_fields_since_rewind_capture < std::max(Config::Get(Config::MAIN_REWIND_INTERVAL), 1))
+    return;
+
+  // If the previous capture still hasn't happened, the host is too busy for another one.
+  if (s_rewind_capture_queued.exchange(true))
+    return;
+  s_fields_since_rewind_capture = 0;
+
+  // This is called in the middle of a CoreTiming event, where the state can't be saved. Go through
+  // the host so that the CPU thread gets paused at a point where it can be.
+  Core::QueueHostJob([] {
+    if (!Core::IsRunning())
+    {
+      s_rewind_capture_queued = false;
+      return;
+    }
+
+    Core::RunOnCPUThread(
+        [] {
+          s_rewind_capture_queued = false;
+          std::vector<u8> buffer;
+          SaveToBuffer(buffer);
+          s_rewind_thread.EmplaceItem(RewindPush_args{std::move(buffer), s_rewind_generation});
+        },
+        false);
+  });
+}
+
+void Rewind()
+{
+  if (!Core::IsRunning())
+    return;
+
+  if (NetPlay::IsNetPlayRunning())
+  {
+    OSD::AddMessage("Rewinding is disabled in Netplay to prevent desyncs");
+    return;
+  }
+
+  if (Movie::IsMovieActive())
+  {
+    OSD::AddMessage("Rewinding is disabled while recording or playing back input");
+    return;
+  }
+
+  std::unique_lock lk(s_load_or_save_in_progress_mutex, std::try_to_lock);
+  if (!lk)
+    return;
+
+  Core::RunOnCPUThread(
+      [] {
+        std::vector<u8> buffer;
+        {
+          std::lock_guard lk2(s_rewind_buffer_mutex);
+          ++s_rewind_generation;
+          if (!s_rewind_buffer || !s_rewind_buffer->Pop(&buffer))
+          {
+            Core::DisplayMessage("There is nothing to rewind to", 2000);
+            return;
+          }
+        }
+
+        CancelRunAhead();
+        u8* ptr = buffer.data();
+        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
         DoState(p);
+        if (!p.IsReadMode())
+        {
+          // Every state in the buffer was made by this session, so this shouldn't happen.
+          Core::DisplayMessage("The rewind state could not be loaded", OSD::Duration::NORMAL);
+          std::lock_guard lk2(s_rewind_buffer_mutex);
+          s_rewind_buffer->Clear();
+        }
+
+        s_fields_since_rewind_capture = 0;
+
+        if (s_on_after_load_callback)
+          s_on_after_load_callback();
       },
       true);
 }
@@ -354,8 +683,81 @@ static std::map<double, int> GetSavedStates()
   return m;
 }
 
+// Calls function for every index in [0, count), spread out over the available hardware threads.
+static void RunInParallel(size_t count, const std::function<void(size_t)>& function)
+{
+  const size_t threads =
+      std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+
+  std::atomic<size_t> next_index = 0;
+  const auto worker = [&] {
+    for (size_t i = next_index++; i < count; i = next_index++)
+      function(i);
+  };
+
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < threads; ++i)
+    workers.emplace_back(worker);
+  worker();
+  for (std::thread& thread : workers)
+    thread.join();
+}
+
+static void WriteZstdFrames(File::IOFile& f, const u8* data, size_t size)
+{
+  const int level = std::clamp(Config::Get(Config::MAIN_SAVESTATE_COMPRESSION_LEVEL),
+                               ZSTD_minCLevel(), ZSTD_maxCLevel());
+
+  const size_t frame_count = (size + ZSTD_FRAME_SIZE - 1) / ZSTD_FRAME_SIZE;
+  std::vector<std::vector<u8>> frames(frame_count);
+  std::atomic<bool> failed = false;
+
+  RunInParallel(frame_count, [&](size_t i) {
+    const size_t offset = i * ZSTD_FRAME_SIZE;
+    const size_t length = std::min(ZSTD_FRAME_SIZE, size - offset);
+
+    std::vector<u8>& frame = frames[i];
+    frame.resize(sizeof(ZstdFrameHeader) + ZSTD_compressBound(length));
+    const size_t compressed_size =
+        ZSTD_compress(frame.data() + sizeof(ZstdFrameHeader),
+                      frame.size() - sizeof(ZstdFrameHeader), data + offset, length, level);
+    if (ZSTD_isError(compressed_size))
+    {
+      failed = true;
+      return;
+    }
+
+    const ZstdFrameHeader header{static_cast<u32>(compressed_size), static_cast<u32>(length)};
+    std::memcpy(frame.data(), &header, sizeof(header));
+    frame.resize(sizeof(ZstdFrameHeader) + compressed_size);
+  });
+
+  if (failed)
+    PanicAlertFmtT("Internal Zstandard Error - compression failed");
+
+  for (const std::vector<u8>& frame : frames)
+    f.WriteBytes(frame.data(), frame.size());
+}
+
+static std::vector<u8> TakeSaveBuffer()
+{
+  std::vector<u8> buffer;
+  std::lock_guard lk(s_save_buffer_pool_mutex);
+  buffer.swap(s_save_buffer_pool);
+  return buffer;
+}
+
+static void ReturnSaveBuffer(std::vector<u8> buffer)
+{
+  std::lock_guard lk(s_save_buffer_pool_mutex);
+  if (buffer.capacity() > s_save_buffer_pool.capacity())
+    s_save_buffer_pool.swap(buffer);
+}
+
 static void CompressAndDumpState(CompressAndDumpState_args& save_args)
 {
+  TRACE_ZONE("State::CompressAndDumpState");
+
   const u8* const buffer_data = save_args.buffer_vector.data();
   const size_t buffer_size = save_args.buffer_vector.size();
   const std::string& filename = save_args.filename;
@@ -382,39 +784,14 @@ static void CompressAndDumpState(CompressAndDumpState_args& save_args)
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.gameID, std::size(header.gameID));
   header.size = s_use_compression ? (u32)buffer_size : 0;
+  header.compression = StateCompression::Zstd;
   header.time = GetSystemTimeAsDouble();
 
   f.WriteArray(&header, 1);
 
   if (header.size != 0)  // non-zero header size means the state is compressed
   {
-    lzo_uint i = 0;
-    while (true)
-    {
-      lzo_uint32 cur_len = 0;
-      lzo_uint out_len = 0;
-
-      if ((i + IN_LEN) >= buffer_size)
-      {
-        cur_len = (lzo_uint32)(buffer_size - i);
-      }
-      else
-      {
-        cur_len = IN_LEN;
-      }
-
-      if (lzo1x_1_compress(buffer_data + i, cur_len, out, &out_len, wrkmem) != LZO_E_OK)
-        PanicAlertFmtT("Internal LZO Error - compression failed");
-
-      // The size of the data to write is 'out_len'
-      f.WriteArray((lzo_uint32*)&out_len, 1);
-      f.WriteBytes(out, out_len);
-
-      if (cur_len != IN_LEN)
-        break;
-
-      i += cur_len;
-    }
+    WriteZstdFrames(f, buffer_data, buffer_size);
   }
   else  // uncompressed
   {
@@ -466,6 +843,8 @@ static void CompressAndDumpState(CompressAndDumpState_args& save_args)
 
 void SaveAs(const std::string& filename, bool wait)
 {
+  TRACE_ZONE("State::SaveAs");
+
   std::unique_lock lk(s_load_or_save_in_progress_mutex, std::try_to_lock);
   if (!lk)
     return;
@@ -477,20 +856,9 @@ void SaveAs(const std::string& filename, bool wait)
           ++s_state_writes_in_queue;
         }
 
-        // Measure the size of the buffer.
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-        DoState(p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-        // Then actually do the write.
-        std::vector<u8> current_buffer;
-        current_buffer.resize(buffer_size);
-        ptr = current_buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(p);
-
-        if (p.IsWriteMode())
+        // Only the part that wasn't used by the previous save gets initialized here.
+        std::vector<u8> current_buffer = TakeSaveBuffer();
+        if (DoStateToBuffer(current_buffer))
         {
           Core::DisplayMessage("Saving State...", 1000);
 
@@ -519,6 +887,7 @@ void SaveAs(const std::string& filename, bool wait)
             if (--s_state_writes_in_queue == 0)
               s_state_write_queue_is_empty.notify_all();
           }
+          ReturnSaveBuffer(std::move(current_buffer));
           Core::DisplayMessage("Unable to save: Internal DoState Error", 4000);
         }
       },
@@ -557,7 +926,61 @@ u64 GetUnixTimeOfSlot(int slot)
   return static_cast<u64>(header.time * MS_PER_SEC) + (DOUBLE_TIME_OFFSET * MS_PER_SEC);
 }
 
-static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_data)
+static bool ReadZstdFrames(File::IOFile& f, std::vector<u8>& buffer)
+{
+  std::vector<u8> compressed(f.GetSize() - f.Tell());
+  if (!f.ReadBytes(compressed.data(), compressed.size()))
+    return false;
+
+  struct Frame
+  {
+    size_t compressed_offset;
+    size_t decompressed_offset;
+    ZstdFrameHeader header;
+  };
+
+  // The frames can only be found by walking through them in order, but decompressing them is
+  // independent.
+  std::vector<Frame> frames;
+  size_t compressed_offset = 0;
+  size_t decompressed_offset = 0;
+  while (compressed_offset < compressed.size())
+  {
+    Frame& frame = frames.emplace_back();
+    if (compressed.size() - compressed_offset < sizeof(ZstdFrameHeader))
+      return false;
+    std::memcpy(&frame.header, compressed.data() + compressed_offset, sizeof(ZstdFrameHeader));
+    compressed_offset += sizeof(ZstdFrameHeader);
+
+    frame.compressed_offset = compressed_offset;
+    frame.decompressed_offset = decompressed_offset;
+    compressed_offset += frame.header.compressed_size;
+    decompressed_offset += frame.header.decompressed_size;
+    if (compressed_offset > compressed.size() || decompressed_offset > buffer.size())
+      return false;
+  }
+  if (decompressed_offset != buffer.size())
+    return false;
+
+  std::atomic<bool> failed = false;
+  RunInParallel(frames.size(), [&](size_t i) {
+    const Frame& frame = frames[i];
+    const size_t result = ZSTD_decompress(
+        buffer.data() + frame.decompressed_offset, frame.header.decompressed_size,
+        compressed.data() + frame.compressed_offset, frame.header.compressed_size);
+    if (result != frame.header.decompressed_size)
+      failed = true;
+  });
+
+  return !failed;
+}
+
+// Compressed states are decompressed into ret_data. Uncompressed states are used in place from
+// ret_mapping instead of being read into a buffer first, which matters when the same state gets
+// loaded over and over and is already in the page cache. Returns an empty span on failure.
+static std::span<const u8> LoadFileStateData(const std::string& filename,
+                                             std::vector<u8>& ret_data,
+                                             File::MappedFile& ret_mapping)
 {
   File::IOFile f;
 
@@ -571,7 +994,7 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
       {
         Core::DisplayMessage(
             "A previous state saving operation is still in progress, cancelling load.", 2000);
-        return;
+        return {};
       }
     }
     f.Open(filename, "rb");
@@ -581,7 +1004,7 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
   if (!f.ReadArray(&header, 1))
   {
     Core::DisplayMessage("State not found", 2000);
-    return;
+    return {};
   }
 
   if (strncmp(SConfig::GetInstance().GetGameID().c_str(), header.gameID, 6))
@@ -589,7 +1012,7 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
     Core::DisplayMessage(fmt::format("State belongs to a different game (ID {})",
                                      std::string_view{header.gameID, std::size(header.gameID)}),
                          2000);
-    return;
+    return {};
   }
 
   std::vector<u8> buffer;
@@ -598,49 +1021,71 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
   {
     Core::DisplayMessage("Decompressing State...", 500);
 
+    buffer = TakeSaveBuffer();
     buffer.resize(header.size);
 
-    lzo_uint i = 0;
-    while (true)
+    if (header.compression == StateCompression::Zstd)
     {
-      lzo_uint32 cur_len = 0;  // number of bytes to read
-      lzo_uint new_len = 0;    // number of bytes to write
-
-      if (!f.ReadArray(&cur_len, 1))
-        break;
-
-      f.ReadBytes(out, cur_len);
-      const int res = lzo1x_decompress(out, cur_len, &buffer[i], &new_len, nullptr);
-      if (res != LZO_E_OK)
+      if (!ReadZstdFrames(f, buffer))
       {
-        // This doesn't seem to happen anymore.
-        PanicAlertFmtT("Internal LZO Error - decompression failed ({0}) ({1}, {2}) \n"
-                       "Try loading the state again",
-                       res, i, new_len);
-        return;
+        PanicAlertFmtT("Internal Zstandard Error - decompression failed\n"
+                       "The state is likely damaged.");
+        return {};
       }
+    }
+    else if (header.compression == StateCompression::LZO)
+    {
+      lzo_uint i = 0;
+      while (true)
+      {
+        lzo_uint32 cur_len = 0;  // number of bytes to read
+        lzo_uint new_len = 0;    // number of bytes to write
+
+        if (!f.ReadArray(&cur_len, 1))
+          break;
 
-      i += new_len;
+        f.ReadBytes(out, cur_len);
+        const int res = lzo1x_decompress(out, cur_len, &buffer[i], &new_len, nullptr);
+        if (res != LZO_E_OK)
+        {
+          // This doesn't seem to happen anymore.
+          PanicAlertFmtT("Internal LZO Error - decompression failed ({0}) ({1}, {2}) \n"
+                         "Try loading the state again",
+                         res, i, new_len);
+          return {};
+        }
+
+        i += new_len;
+      }
+    }
+    else
+    {
+      Core::DisplayMessage("State uses an unknown compression format", 2000);
+      return {};
     }
   }
   else  // uncompressed
   {
-    const auto size = static_cast<size_t>(f.GetSize() - sizeof(StateHeader));
-    buffer.resize(size);
-
-    if (!f.ReadBytes(&buffer[0], size))
+    f.Close();
+    if (!ret_mapping.Open(filename) || ret_mapping.GetSize() <= sizeof(StateHeader))
     {
-      PanicAlertFmt("Error reading bytes: {0}", size);
-      return;
+      PanicAlertFmt("Error mapping {0}", filename);
+      return {};
     }
+
+    return {ret_mapping.GetData() + sizeof(StateHeader),
+            ret_mapping.GetSize() - sizeof(StateHeader)};
   }
 
   // all good
   ret_data.swap(buffer);
+  return ret_data;
 }
 
 void LoadAs(const std::string& filename)
 {
+  TRACE_ZONE("State::LoadAs");
+
   if (!Core::IsRunning())
     return;
 
@@ -674,16 +1119,22 @@ void LoadAs(const std::string& filename)
         // brackets here are so buffer gets freed ASAP
         {
           std::vector<u8> buffer;
-          LoadFileStateData(filename, buffer);
+          File::MappedFile mapping;
+          const std::span<const u8> data = LoadFileStateData(filename, buffer, mapping);
 
-          if (!buffer.empty())
+          if (!data.empty())
           {
-            u8* ptr = buffer.data();
-            PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
+            CancelRunAhead();
+            // PointerWrap never writes through the pointer in read mode.
+            u8* ptr = const_cast<u8*>(data.data());
+            PointerWrap p(&ptr, data.size(), PointerWrap::Mode::Read);
             DoState(p);
             loaded = true;
             loadedSuccessfully = p.IsReadMode();
           }
+
+          if (!buffer.empty())
+            ReturnSaveBuffer(std::move(buffer));
         }
 
         if (loaded)
@@ -726,6 +1177,7 @@ void Init()
 
   s_save_thread.Reset([](CompressAndDumpState_args args) {
     CompressAndDumpState(args);
+    ReturnSaveBuffer(std::move(args.buffer_vector));
 
     {
       std::lock_guard lk(s_state_writes_in_queue_mutex);
@@ -736,12 +1188,39 @@ void Init()
     if (args.state_write_done_event)
       args.state_write_done_event->Set();
   });
+
+  {
+    std::lock_guard lk(s_rewind_buffer_mutex);
+    const size_t rewind_buffer_size =
+        static_cast<size_t>(std::max(Config::Get(Config::MAIN_REWIND_BUFFER_SIZE), 0)) << 20;
+    s_rewind_buffer = std::make_unique<RewindBuffer>(rewind_buffer_size);
+  }
+  s_rewind_capture_queued = false;
+  s_fields_since_rewind_capture = 0;
+  ResetRunAhead();
+
+  s_rewind_thread.Reset([](RewindPush_args args) {
+    std::lock_guard lk(s_rewind_buffer_mutex);
+    if (s_rewind_buffer && args.generation == s_rewind_generation)
+      s_rewind_buffer->Push(std::move(args.buffer_vector));
+  });
 }
 
 void Shutdown()
 {
   s_save_thread.Shutdown();
 
+  s_rewind_thread.Shutdown();
+  {
+    std::lock_guard lk(s_rewind_buffer_mutex);
+    s_rewind_buffer.reset();
+  }
+
+  {
+    std::lock_guard lk(s_save_buffer_pool_mutex);
+    std::vector<u8>().swap(s_save_buffer_pool);
+  }
+
   // swapping with an empty vector, rather than clear()ing
   // this gives a better guarantee to free the allocated memory right NOW (as opposed to, actually,
   // never)
@@ -749,6 +1228,8 @@ void Shutdown()
     std::lock_guard lk(s_undo_load_buffer_mutex);
     std::vector<u8>().swap(s_undo_load_buffer);
   }
+
+  ResetRunAhead();
 }
 
 static std::string MakeStateFilename(int number)
@@ -17,12 +17,20 @@ namespace State
 // number of states
 static const u32 NUM_STATES = 10;
 
+enum class StateCompression : u32
+{
+  // Blocks of LZO1X data, each preceded by its compressed size. Used by all older versions.
+  LZO = 0,
+  // Independent Zstandard frames, each preceded by its compressed and decompressed sizes.
+  Zstd = 1,
+};
+
 struct StateHeader
 {
   char gameID[6];
   u16 reserved1;
-  u32 size;
-  u32 reserved2;
+  u32 size;  // Size of the decompressed state, or 0 if the state is stored uncompressed
+  StateCompression compression;
   double time;
 };
 constexpr size_t STATE_HEADER_SIZE = sizeof(StateHeader);
@@ -58,6 +66,19 @@ void LoadAs(const std::string& filename);
 
 void SaveToBuffer(std::vector<u8>& buffer);
 void LoadFromBuffer(std::vector<u8>& buffer);
+// Loads a state that every NetPlay player loads right after booting. Unlike loading a state
+// during a NetPlay session, this can't make the players desync. Returns whether it was loaded.
+bool LoadNetPlaySyncedState(std::vector<u8>& buffer);
+
+// Called on the CPU thread at every emulated field. Periodically captures a state for rewinding
+// when rewinding is enabled, and drives run-ahead.
+void OnNewField();
+// Whether the video output of the field being emulated should be shown. While run-ahead is
+// active, only the last of the fields emulated ahead is.
+bool ShouldOutputField();
+// Loads the most recent state captured for rewinding, and forgets it so that the next call goes
+// further back.
+void Rewind();
 
 void LoadLastSaved(int i = 1);
 void SaveFirstSaved();
@@ -0,0 +1,201 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/StateDelta.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace State
+{
+namespace
+{
+template <typename T>
+void Write(std::vector<u8>& out, const T& value)
+{
+  const u8* bytes = reinterpret_cast<const u8*>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+bool Read(std::span<const u8>& in, T* value)
+{
+  if (in.size() < sizeof(T))
+    return false;
+
+  std::memcpy(value, in.data(), sizeof(T));
+  in = in.subspan(sizeof(T));
+  return true;
+}
+}  // namespace
+
+StateDelta StateDelta::Create(std::span<const u8> base, std::span<const u8> target)
+{
+  StateDelta delta;
+  delta.m_size = target.size();
+
+  // Where a page of the target state would be in the base state if only data before it changed
+  // size. Only usable if the page lies entirely within the base state.
+  const ptrdiff_t end_shift =
+      static_cast<ptrdiff_t>(base.size()) - static_cast<ptrdiff_t>(target.size());
+
+  const auto add_page = [&delta](PageSource source) {
+    if (!delta.m_runs.empty() && delta.m_runs.back().source == source)
+      ++delta.m_runs.back().page_count;
+    else
+      delta.m_runs.push_back({source, 1});
+  };
+
+  for (size_t offset = 0; offset < target.size(); offset += PAGE_SIZE)
+  {
+    const size_t length = std::min(PAGE_SIZE, target.size() - offset);
+    const u8* page = target.data() + offset;
+
+    if (offset + length <= base.size() && std::memcmp(page, base.data() + offset, length) == 0)
+    {
+      add_page(PageSource::SameOffset);
+      continue;
+    }
+
+    const ptrdiff_t shifted = static_cast<ptrdiff_t>(offset) + end_shift;
+    if (end_shift != 0 && shifted >= 0 && static_cast<size_t>(shifted) + length <= base.size() &&
+        std::memcmp(page, base.data() + shifted, length) == 0)
+    {
+      add_page(PageSource::SameOffsetFromEnd);
+      continue;
+    }
+
+    add_page(PageSource::Literal);
+    delta.m_literals.insert(delta.m_literals.end(), page, page + length);
+  }
+
+  delta.m_runs.shrink_to_fit();
+  delta.m_literals.shrink_to_fit();
+  return delta;
+}
+
+bool StateDelta::Apply(std::span<const u8> base, std::vector<u8>* target) const
+{
+  const ptrdiff_t end_shift =
+      static_cast<ptrdiff_t>(base.size()) - static_cast<ptrdiff_t>(m_size);
+
+  // Copies the pages to out, or only checks that the base state and the literals cover all of them
+  // if out is null.
+  const auto process_runs = [&](u8* out) {
+    size_t offset = 0;
+    size_t literal_offset = 0;
+    for (const Run& run : m_runs)
+    {
+      const size_t length =
+          std::min(static_cast<size_t>(run.page_count) * PAGE_SIZE, m_size - offset);
+
+      const u8* source = nullptr;
+      switch (run.source)
+      {
+      case PageSource::SameOffset:
+        if (offset + length > base.size())
+          return false;
+        source = base.data() + offset;
+        break;
+      case PageSource::SameOffsetFromEnd:
+      {
+        const ptrdiff_t shifted = static_cast<ptrdiff_t>(offset) + end_shift;
+        if (shifted < 0 || static_cast<size_t>(shifted) + length > base.size())
+          return false;
+        source = base.data() + shifted;
+        break;
+      }
+      case PageSource::Literal:
+        if (literal_offset + length > m_literals.size())
+          return false;
+        source = m_literals.data() + literal_offset;
+        literal_offset += length;
+        break;
+      }
+
+      if (out)
+        std::memcpy(out + offset, source, length);
+      offset += length;
+    }
+
+    return offset == m_size && literal_offset == m_literals.size();
+  };
+
+  // Don't allocate the target state before knowing that the delta can produce all of it.
+  if (!process_runs(nullptr))
+    return false;
+
+  target->resize(m_size);
+  return process_runs(target->data());
+}
+
+size_t StateDelta::GetMemoryUsage() const
+{
+  return sizeof(StateDelta) + m_runs.size() * sizeof(Run) + m_literals.size();
+}
+
+std::vector<u8> StateDelta::Serialize() const
+{
+  std::vector<u8> out;
+  out.reserve(sizeof(u64) * 3 + m_runs.size() * (sizeof(u8) + sizeof(u32)) + m_literals.size());
+
+  Write(out, static_cast<u64>(m_size));
+  Write(out, static_cast<u64>(m_runs.size()));
+  for (const Run& run : m_runs)
+  {
+    Write(out, run.source);
+    Write(out, run.page_count);
+  }
+  Write(out, static_cast<u64>(m_literals.size()));
+  out.insert(out.end(), m_literals.begin(), m_literals.end());
+
+  return out;
+}
+
+std::optional<StateDelta> StateDelta::Deserialize(std::span<const u8> data)
+{
+  StateDelta delta;
+
+  u64 size;
+  u64 run_count;
+  if (!Read(data, &size) || !Read(data, &run_count) || size > MAX_SIZE)
+    return std::nullopt;
+
+  // Every run takes up at least one page, and at least 5 bytes of data.
+  const u64 page_count = size / PAGE_SIZE + (size % PAGE_SIZE != 0);
+  if (run_count > page_count || run_count > data.size() / (sizeof(u8) + sizeof(u32)))
+    return std::nullopt;
+
+  delta.m_size = static_cast<size_t>(size);
+  delta.m_runs.resize(static_cast<size_t>(run_count));
+  u64 pages_left = page_count;
+  u64 offset = 0;
+  u64 expected_literals_size = 0;
+  for (Run& run : delta.m_runs)
+  {
+    if (!Read(data, &run.source) || !Read(data, &run.page_count))
+      return std::nullopt;
+    if (run.source > PageSource::Literal || run.page_count == 0 || run.page_count > pages_left)
+      return std::nullopt;
+    pages_left -= run.page_count;
+
+    const u64 length = std::min<u64>(u64(run.page_count) * PAGE_SIZE, size - offset);
+    if (run.source == PageSource::Literal)
+      expected_literals_size += length;
+    offset += length;
+  }
+  if (pages_left != 0)
+    return std::nullopt;
+
+  // The literal pages must be exactly the literal bytes that follow.
+  u64 literals_size;
+  if (!Read(data, &literals_size) || literals_size != data.size() ||
+      literals_size != expected_literals_size)
+  {
+    return std::nullopt;
+  }
+  delta.m_literals.assign(data.begin(), data.end());
+
+  return delta;
+}
+}  // namespace State
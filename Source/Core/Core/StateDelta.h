@@ -0,0 +1,62 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace State
+{
+// A savestate expressed as the pages which differ from another savestate (the base).
+//
+// Savestates of the same game taken close to each other are mostly identical, so this is much
+// smaller than the state itself. Sections of a savestate can change size, which shifts
+// everything after them, so pages are compared both at the same offset and at the same offset
+// from the end.
+class StateDelta final
+{
+public:
+  static constexpr size_t PAGE_SIZE = 0x1000;
+  // Deltas of larger states are rejected when deserializing. This is several times the size of the
+  // largest savestate, even with the emulated memory sizes overridden.
+  static constexpr size_t MAX_SIZE = 0x20000000;
+
+  StateDelta() = default;
+
+  static StateDelta Create(std::span<const u8> base, std::span<const u8> target);
+
+  // Reconstructs the target state from the base state that the delta was created from.
+  // Returns false if the delta doesn't fit the given base state.
+  bool Apply(std::span<const u8> base, std::vector<u8>* target) const;
+
+  // The size of the target state.
+  size_t GetSize() const { return m_size; }
+  size_t GetMemoryUsage() const;
+
+  std::vector<u8> Serialize() const;
+  static std::optional<StateDelta> Deserialize(std::span<const u8> data);
+
+private:
+  enum class PageSource : u8
+  {
+    SameOffset,
+    SameOffsetFromEnd,
+    Literal,
+  };
+
+  struct Run
+  {
+    PageSource source;
+    u32 page_count;
+  };
+
+  size_t m_size = 0;
+  std::vector<Run> m_runs;
+  std::vector<u8> m_literals;
+};
+}  // namespace State
@@ -20,6 +20,7 @@
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/Sram.h"
 #include "Core/HW/VideoInterface.h"
+#include "Core/HW/WII_IPC.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "IOS/USB/Emulated/Skylander.h"
 #include "VideoCommon/CommandProcessor.h"
@@ -34,7 +35,8 @@ namespace Core
 struct System::Impl
 {
   explicit Impl(System& system)
-      : m_core_timing(system), m_gp_fifo(system), m_ppc_state(PowerPC::ppcState)
+      : m_core_timing(system), m_gp_fifo(system), m_ppc_state(PowerPC::ppcState),
+        m_wii_ipc(system)
   {
   }
 
@@ -63,6 +65,7 @@ struct System::Impl
   Sram m_sram;
   VertexShaderManager m_vertex_shader_manager;
   VideoInterface::VideoInterfaceState m_video_interface_state;
+  IOS::WiiIPC m_wii_ipc;
 };
 
 System::System() : m_impl{std::make_unique<Impl>(*this)}
@@ -212,4 +215,9 @@ VideoInterface::VideoInterfaceState& System::GetVideoInterfaceState() const
 {
   return m_impl->m_video_interface_state;
 }
+
+IOS::WiiIPC& System::GetWiiIPC() const
+{
+  return m_impl->m_wii_ipc;
+}
 }  // namespace Core
@@ -3,9 +3,11 @@
 
 #include "Core/TitleDatabase.h"
 
+#include <algorithm>
 #include <cstddef>
-#include <fstream>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -30,31 +32,61 @@ static Map LoadMap(const std::string& file_path)
 {
   Map map;
 
-  std::ifstream txt;
-  File::OpenFStream(txt, file_path, std::ios::in);
+  std::string contents;
+  if (!File::ReadFileToString(file_path, contents))
+    return map;
+  map.reserve(std::count(contents.begin(), contents.end(), '\n'));
 
-  std::string line;
-  while (std::getline(txt, line))
+  std::string_view remaining(contents);
+  while (!remaining.empty())
   {
+    const size_t line_end = remaining.find('\n');
+    const std::string_view line = remaining.substr(0, line_end);
+    remaining.remove_prefix(line_end == std::string_view::npos ? remaining.size() : line_end + 1);
     if (line.empty())
       continue;
 
     const size_t equals_index = line.find('=');
     if (equals_index != std::string::npos)
     {
-      const std::string_view line_view(line);
-      const std::string_view game_id = StripWhitespace(line_view.substr(0, equals_index));
+      const std::string_view game_id = StripWhitespace(line.substr(0, equals_index));
       if (game_id.length() >= 4)
-        map.emplace(game_id, StripWhitespace(line_view.substr(equals_index + 1)));
+        map.emplace(game_id, StripWhitespace(line.substr(equals_index + 1)));
     }
   }
   return map;
 }
 
+// A TitleDatabase gets created for every boot and game list refresh, so parsed files are shared
+// between them. A file only gets parsed again if it has changed on disk.
+static std::shared_ptr<const Map> GetMap(const std::string& file_path)
+{
+  struct CachedMap
+  {
+    s64 modification_time = 0;
+    u64 size = 0;
+    std::shared_ptr<const Map> map;
+  };
+  static std::mutex s_cache_mutex;
+  static std::unordered_map<std::string, CachedMap> s_cache;
+
+  const File::FileInfo file_info(file_path);
+  std::lock_guard lk(s_cache_mutex);
+  CachedMap& cached = s_cache[file_path];
+  if (!cached.map || cached.modification_time != file_info.GetModificationTime() ||
+      cached.size != file_info.GetSize())
+  {
+    cached.modification_time = file_info.GetModificationTime();
+    cached.size = file_info.GetSize();
+    cached.map = std::make_shared<const Map>(LoadMap(file_path));
+  }
+  return cached.map;
+}
+
 void TitleDatabase::AddLazyMap(DiscIO::Language language, const std::string& language_code)
 {
-  m_title_maps[language] = [language_code]() -> Map {
-    return LoadMap(File::GetSysDirectory() + "wiitdb-" + language_code + ".txt");
+  m_title_maps[language] = [language_code] {
+    return GetMap(File::GetSysDirectory() + "wiitdb-" + language_code + ".txt");
   };
 }
 
@@ -62,9 +94,9 @@ TitleDatabase::TitleDatabase()
 {
   // User database
   const std::string& load_directory = File::GetUserPath(D_LOAD_IDX);
-  m_user_title_map = LoadMap(load_directory + "wiitdb.txt");
-  if (m_user_title_map.empty())
-    m_user_title_map = LoadMap(load_directory + "titles.txt");
+  m_user_title_map = GetMap(load_directory + "wiitdb.txt");
+  if (m_user_title_map->empty())
+    m_user_title_map = GetMap(load_directory + "titles.txt");
 
   // Pre-defined databases (one per language)
   AddLazyMap(DiscIO::Language::Japanese, "ja");
@@ -77,7 +109,7 @@ TitleDatabase::TitleDatabase()
   AddLazyMap(DiscIO::Language::SimplifiedChinese, "zh_CN");
   AddLazyMap(DiscIO::Language::TraditionalChinese, "zh_TW");
   AddLazyMap(DiscIO::Language::Korean, "ko");
-  m_title_maps[DiscIO::Language::Unknown] = [] { return Map(); };
+  m_title_maps[DiscIO::Language::Unknown] = [] { return std::make_shared<const Map>(); };
 
   // Titles that aren't part of the Wii TDB, but common enough to justify having entries for them.
 
@@ -93,21 +125,21 @@ TitleDatabase::~TitleDatabase() = default;
 const std::string& TitleDatabase::GetTitleName(const std::string& gametdb_id,
                                                DiscIO::Language language) const
 {
-  auto it = m_user_title_map.find(gametdb_id);
-  if (it != m_user_title_map.end())
+  auto it = m_user_title_map->find(gametdb_id);
+  if (it != m_user_title_map->end())
     return it->second;
 
   if (!Config::Get(Config::MAIN_USE_BUILT_IN_TITLE_DATABASE))
     return EMPTY_STRING;
 
-  const Map& map = *m_title_maps.at(language);
+  const Map& map = **m_title_maps.at(language);
   it = map.find(gametdb_id);
   if (it != map.end())
     return it->second;
 
   if (language != DiscIO::Language::English)
   {
-    const Map& english_map = *m_title_maps.at(DiscIO::Language::English);
+    const Map& english_map = **m_title_maps.at(DiscIO::Language::English);
     it = english_map.find(gametdb_id);
     if (it != english_map.end())
       return it->second;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -34,11 +35,12 @@ public:
   std::string Describe(const std::string& gametdb_id, DiscIO::Language language) const;
 
 private:
+  using Map = std::unordered_map<std::string, std::string>;
+
   void AddLazyMap(DiscIO::Language language, const std::string& language_code);
 
-  std::unordered_map<DiscIO::Language, Common::Lazy<std::unordered_map<std::string, std::string>>>
-      m_title_maps;
-  std::unordered_map<std::string, std::string> m_base_map;
-  std::unordered_map<std::string, std::string> m_user_title_map;
+  std::unordered_map<DiscIO::Language, Common::Lazy<std::shared_ptr<const Map>>> m_title_maps;
+  Map m_base_map;
+  std::shared_ptr<const Map> m_user_title_map;
 };
 }  // namespace Core
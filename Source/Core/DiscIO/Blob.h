@@ -85,6 +85,11 @@ public:
     return Common::FromBigEndian(temp);
   }
 
+  // Hints that the given range is likely to be read soon. Readers which can do so start reading
+  // it in the background, so that the Read call for it doesn't have to wait for the storage.
+  // NOT thread-safe, same as Read.
+  virtual void Prefetch(u64 offset, u64 size) {}
+
   virtual bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const
   {
     return false;
@@ -95,6 +100,9 @@ public:
     return false;
   }
 
+  // Like Prefetch, for data which is going to be read using ReadWiiDecrypted.
+  virtual void PrefetchWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) {}
+
 protected:
   BlobReader() {}
 };
@@ -192,14 +200,16 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename);
 
 using CompressCB = std::function<bool(const std::string& text, float percent)>;
 
+// For the compressing conversions, threads is the number of compression threads to use, or 0 to
+// use one for each hardware thread.
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
-                  const std::string& outfile_path, u32 sub_type, int sector_size,
+                  const std::string& outfile_path, u32 sub_type, int sector_size, int threads,
                   CompressCB callback);
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, CompressCB callback);
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback);
+                       int chunk_size, bool zstd_dictionary, int threads, CompressCB callback);
 
 }  // namespace DiscIO
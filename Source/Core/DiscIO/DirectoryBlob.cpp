@@ -27,6 +27,7 @@
 #include "Core/Boot/DolReader.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/Blob.h"
+#include "DiscIO/DirectoryBlobLayoutCache.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/VolumeDisc.h"
 #include "DiscIO/VolumeWii.h"
@@ -97,6 +98,8 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer) const
     if (std::holds_alternative<ContentFile>(m_content_source))
     {
       const auto& content = std::get<ContentFile>(m_content_source);
+      if (content.m_cache_check)
+        content.m_cache_check->Check(content.m_filename);
       File::IOFile file(content.m_filename, "rb");
       if (!file.Seek(content.m_offset + offset_in_content, File::SeekOrigin::Begin) ||
           !file.ReadBytes(*buffer, bytes_to_read))
@@ -1053,32 +1056,9 @@ u64 DirectoryBlobPartition::SetDOL(FSTBuilderNode dol_node, u64 dol_address)
   return Common::AlignUp(dol_address + dol_node.m_size + 0x20, 0x20ull);
 }
 
-static std::vector<FSTBuilderNode> ConvertFSTEntriesToBuilderNodes(const File::FSTEntry& parent)
-{
-  std::vector<FSTBuilderNode> nodes;
-  nodes.reserve(parent.children.size());
-  for (const File::FSTEntry& entry : parent.children)
-  {
-    std::variant<std::vector<BuilderContentSource>, std::vector<FSTBuilderNode>> content;
-    if (entry.isDirectory)
-    {
-      content = ConvertFSTEntriesToBuilderNodes(entry);
-    }
-    else
-    {
-      content =
-          std::vector<BuilderContentSource>{{0, entry.size, ContentFile{entry.physicalName, 0}}};
-    }
-
-    nodes.emplace_back(FSTBuilderNode{entry.virtualName, entry.size, std::move(content)});
-  }
-  return nodes;
-}
-
 void DirectoryBlobPartition::BuildFSTFromFolder(const std::string& fst_root_path, u64 fst_address)
 {
-  auto nodes = ConvertFSTEntriesToBuilderNodes(File::ScanDirectoryTree(fst_root_path, true));
-  BuildFST(std::move(nodes), fst_address);
+  BuildFST(ScanFolderWithLayoutCache(fst_root_path), fst_address);
 }
 
 static void ConvertUTF8NamesToSHIFTJIS(std::vector<FSTBuilderNode>* fst)
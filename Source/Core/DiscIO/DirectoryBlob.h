@@ -30,6 +30,7 @@ namespace DiscIO
 {
 enum class PartitionType : u32;
 
+class CachedFileCheck;
 class DirectoryBlobReader;
 class VolumeDisc;
 
@@ -44,6 +45,9 @@ struct ContentFile
 
   // Offset from the start of the file where the first byte of this content chunk is.
   u64 m_offset;
+
+  // Set if the file's size comes from a cached layout rather than from the file itself.
+  std::shared_ptr<CachedFileCheck> m_cache_check;
 };
 
 // Content chunk that loads data from a DirectoryBlobReader.
@@ -0,0 +1,304 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/DirectoryBlobLayoutCache.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <ctime>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include <fmt/format.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/Logging/Log.h"
+#include "DiscIO/DirectoryBlob.h"
+
+namespace DiscIO
+{
+struct DirectoryBlobLayoutCache
+{
+  std::string path;
+  std::atomic<bool> invalidated = false;
+};
+
+namespace
+{
+constexpr std::array<char, 4> MAGIC = {'D', 'B', 'L', 'C'};
+// Bump this when the layout of the cache file changes.
+constexpr u32 VERSION = 1;
+
+class LayoutWriter
+{
+public:
+  template <typename T>
+  void Write(T value)
+  {
+    const auto* bytes = reinterpret_cast<const char*>(&value);
+    m_data.append(bytes, sizeof(T));
+  }
+
+  void WriteString(std::string_view str)
+  {
+    Write(static_cast<u32>(str.size()));
+    m_data.append(str);
+  }
+
+  const std::string& GetData() const { return m_data; }
+
+private:
+  std::string m_data;
+};
+
+class LayoutReader
+{
+public:
+  explicit LayoutReader(std::string_view data) : m_data(data) {}
+
+  template <typename T>
+  bool Read(T* value)
+  {
+    if (m_data.size() - m_position < sizeof(T))
+      return false;
+    std::memcpy(value, m_data.data() + m_position, sizeof(T));
+    m_position += sizeof(T);
+    return true;
+  }
+
+  bool ReadString(std::string* str)
+  {
+    u32 size;
+    if (!Read(&size) || m_data.size() - m_position < size)
+      return false;
+    str->assign(m_data.substr(m_position, size));
+    m_position += size;
+    return true;
+  }
+
+  bool IsAtEnd() const { return m_position == m_data.size(); }
+
+private:
+  std::string_view m_data;
+  size_t m_position = 0;
+};
+
+void WriteChildren(const File::FSTEntry& parent, LayoutWriter* writer)
+{
+  writer->Write(static_cast<u32>(parent.children.size()));
+  for (const File::FSTEntry& entry : parent.children)
+  {
+    writer->Write(static_cast<u8>(entry.isDirectory));
+    writer->Write(entry.size);
+    writer->Write(entry.modificationTime);
+    writer->WriteString(entry.virtualName);
+    if (entry.isDirectory)
+      WriteChildren(entry, writer);
+  }
+}
+
+bool ReadChildren(File::FSTEntry* parent, LayoutReader* reader)
+{
+  u32 count;
+  if (!reader->Read(&count))
+    return false;
+
+  for (u32 i = 0; i < count; ++i)
+  {
+    File::FSTEntry& entry = parent->children.emplace_back();
+    u8 is_directory;
+    if (!reader->Read(&is_directory) || !reader->Read(&entry.size) ||
+        !reader->Read(&entry.modificationTime) || !reader->ReadString(&entry.virtualName))
+    {
+      return false;
+    }
+    entry.isDirectory = is_directory != 0;
+    entry.physicalName = parent->physicalName + DIR_SEP + entry.virtualName;
+    if (entry.isDirectory && !ReadChildren(&entry, reader))
+      return false;
+  }
+  return true;
+}
+
+bool DirectoriesUnchanged(const File::FSTEntry& parent)
+{
+  for (const File::FSTEntry& entry : parent.children)
+  {
+    if (!entry.isDirectory)
+      continue;
+
+    const File::FileInfo info(entry.physicalName);
+    if (!info.IsDirectory() || info.GetModificationTime() != entry.modificationTime ||
+        !DirectoriesUnchanged(entry))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Modification times only have a resolution of a second, so a directory modified in the same
+// second as it was scanned could later be modified again without its time changing.
+bool HasRecentlyModifiedDirectory(const File::FSTEntry& parent, s64 cutoff)
+{
+  if (parent.modificationTime >= cutoff)
+    return true;
+  for (const File::FSTEntry& entry : parent.children)
+  {
+    if (entry.isDirectory && HasRecentlyModifiedDirectory(entry, cutoff))
+      return true;
+  }
+  return false;
+}
+
+std::optional<File::FSTEntry> LoadLayout(const std::string& cache_path,
+                                         const std::string& root_path, s64 root_time)
+{
+  std::string data;
+  if (!File::ReadFileToString(cache_path, data))
+    return std::nullopt;
+
+  LayoutReader reader(data);
+  std::array<char, 4> magic;
+  u32 version;
+  std::string cached_root_path;
+  File::FSTEntry root;
+  if (!reader.Read(&magic) || magic != MAGIC || !reader.Read(&version) || version != VERSION ||
+      !reader.ReadString(&cached_root_path) || cached_root_path != root_path ||
+      !reader.Read(&root.modificationTime) || root.modificationTime != root_time)
+  {
+    return std::nullopt;
+  }
+
+  root.isDirectory = true;
+  root.physicalName = root_path;
+  if (!ReadChildren(&root, &reader) || !reader.IsAtEnd())
+  {
+    WARN_LOG_FMT(DISCIO, "Ignoring corrupted directory layout cache {}", cache_path);
+    return std::nullopt;
+  }
+
+  if (!DirectoriesUnchanged(root))
+    return std::nullopt;
+
+  return root;
+}
+
+void SaveLayout(const std::string& cache_path, const File::FSTEntry& root)
+{
+  if (HasRecentlyModifiedDirectory(root, static_cast<s64>(std::time(nullptr)) - 1))
+    return;
+
+  LayoutWriter writer;
+  writer.Write(MAGIC);
+  writer.Write(VERSION);
+  writer.WriteString(root.physicalName);
+  writer.Write(root.modificationTime);
+  WriteChildren(root, &writer);
+
+  const std::string temp_path = File::GetTempFilenameForAtomicWrite(cache_path);
+  if (!File::CreateFullPath(cache_path) || !File::WriteStringToFile(temp_path, writer.GetData()) ||
+      !File::Rename(temp_path, cache_path))
+  {
+    File::Delete(temp_path);
+    WARN_LOG_FMT(DISCIO, "Failed to write directory layout cache {}", cache_path);
+  }
+}
+
+std::vector<FSTBuilderNode>
+ConvertToBuilderNodes(const File::FSTEntry& parent,
+                      const std::shared_ptr<DirectoryBlobLayoutCache>& cache)
+{
+  std::vector<FSTBuilderNode> nodes;
+  nodes.reserve(parent.children.size());
+  for (const File::FSTEntry& entry : parent.children)
+  {
+    std::variant<std::vector<BuilderContentSource>, std::vector<FSTBuilderNode>> content;
+    if (entry.isDirectory)
+    {
+      content = ConvertToBuilderNodes(entry, cache);
+    }
+    else
+    {
+      std::shared_ptr<CachedFileCheck> check;
+      if (cache)
+        check = std::make_shared<CachedFileCheck>(cache, entry.size, entry.modificationTime);
+      content = std::vector<BuilderContentSource>{
+          {0, entry.size, ContentFile{entry.physicalName, 0, std::move(check)}}};
+    }
+
+    nodes.emplace_back(FSTBuilderNode{entry.virtualName, entry.size, std::move(content)});
+  }
+  return nodes;
+}
+}  // namespace
+
+std::vector<FSTBuilderNode> ScanFolderWithLayoutCache(const std::string& root_path)
+{
+  std::string root = root_path;
+#ifdef _WIN32
+  if (!root.empty() && (root.back() == '/' || root.back() == '\\'))
+    root.pop_back();
+#else
+  if (!root.empty() && root.back() == '/')
+    root.pop_back();
+#endif
+
+  // Stat the root before scanning, so that changes made during the scan invalidate the cache.
+  const s64 root_time = File::FileInfo(root).GetModificationTime();
+  if (root_time == 0)
+    return ConvertToBuilderNodes(File::ScanDirectoryTree(root, true), nullptr);
+
+  const std::string cache_path =
+      fmt::format("{}DirectoryBlobs/{:016x}.layout", File::GetUserPath(D_CACHE_IDX),
+                  Common::GetXXH3Hash64(reinterpret_cast<const u8*>(root.data()),
+                                        static_cast<u32>(root.size()), 0));
+
+  if (std::optional<File::FSTEntry> cached = LoadLayout(cache_path, root, root_time))
+  {
+    INFO_LOG_FMT(DISCIO, "Using cached directory layout for {}", root);
+    auto cache = std::make_shared<DirectoryBlobLayoutCache>();
+    cache->path = cache_path;
+    return ConvertToBuilderNodes(*cached, cache);
+  }
+
+  File::FSTEntry scanned = File::ScanDirectoryTree(root, true);
+  scanned.physicalName = root;
+  scanned.modificationTime = root_time;
+  SaveLayout(cache_path, scanned);
+  return ConvertToBuilderNodes(scanned, nullptr);
+}
+
+CachedFileCheck::CachedFileCheck(std::shared_ptr<DirectoryBlobLayoutCache> cache, u64 size,
+                                 s64 modification_time)
+    : m_cache(std::move(cache)), m_size(size), m_modification_time(modification_time)
+{
+}
+
+void CachedFileCheck::Check(const std::string& path)
+{
+  std::call_once(m_checked, [&] {
+    const File::FileInfo info(path);
+    if (info.GetSize() == m_size && info.GetModificationTime() == m_modification_time)
+      return;
+
+    // A file which changed without changing size is still read correctly, since file contents
+    // are never cached. The layout cache only needs to be rewritten with the new time.
+    if (info.GetSize() != m_size)
+    {
+      WARN_LOG_FMT(DISCIO,
+                   "{} changed size since the directory layout was cached. Restart the game to "
+                   "use the new version of the file.",
+                   path);
+    }
+
+    if (!m_cache->invalidated.exchange(true))
+      File::Delete(m_cache->path);
+  });
+}
+}  // namespace DiscIO
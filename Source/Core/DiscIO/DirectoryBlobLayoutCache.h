@@ -0,0 +1,43 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace DiscIO
+{
+struct FSTBuilderNode;
+
+// Scanning an extracted disc means listing every directory and querying every file, which gets
+// slow for large games or mods, especially on network shares. The result of the scan is cached
+// in the user's cache directory, and reused for as long as none of the scanned directories have
+// been modified. Which files exist is what determines the layout, and adding, removing or
+// renaming files bumps the modification time of their directory, so files themselves are only
+// checked against the cache when they're first read.
+std::vector<FSTBuilderNode> ScanFolderWithLayoutCache(const std::string& root_path);
+
+struct DirectoryBlobLayoutCache;
+
+// Compares a file against the size and modification time stored for it in a cached layout the
+// first time it's read. If the file has changed, the cache is deleted so that the next scan
+// picks up the change. (The change can't be applied to the layout that's already in use.)
+class CachedFileCheck final
+{
+public:
+  CachedFileCheck(std::shared_ptr<DirectoryBlobLayoutCache> cache, u64 size, s64 modification_time);
+
+  void Check(const std::string& path);
+
+private:
+  std::shared_ptr<DirectoryBlobLayoutCache> m_cache;
+  u64 m_size;
+  s64 m_modification_time;
+  std::once_flag m_checked;
+};
+}  // namespace DiscIO
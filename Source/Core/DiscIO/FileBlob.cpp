@@ -9,13 +9,15 @@
 #include <utility>
 #include <vector>
 
+#include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 
 namespace DiscIO
 {
-PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
+PlainFileReader::PlainFileReader(File::IOFile file)
+    : m_file(std::move(file)), m_async_reader(m_file, MAX_READS_IN_FLIGHT)
 {
   m_size = m_file.GetSize();
 }
@@ -30,15 +32,92 @@ std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
-  if (m_file.Seek(offset, File::SeekOrigin::Begin) && m_file.ReadBytes(out_ptr, nbytes))
+  if (offset + nbytes > static_cast<u64>(m_size))
+    return false;
+
+  // Copy whatever has been prefetched, and read the gaps in between directly
+  u64 direct_offset = offset;
+  const u64 end = offset + nbytes;
+  for (u64 block_offset = Common::AlignDown(offset, PREFETCH_BLOCK_SIZE); block_offset < end;
+       block_offset += PREFETCH_BLOCK_SIZE)
   {
+    // A failed prefetch is simply read again directly
+    PrefetchBlock* block = FindPrefetchBlock(block_offset);
+    if (!block || !FinishPrefetch(block))
+      continue;
+
+    const u64 copy_start = std::max(offset, block_offset);
+    const u64 copy_end = std::min(end, block_offset + block->size);
+    if (direct_offset < copy_start &&
+        !m_async_reader.ReadAt(direct_offset, copy_start - direct_offset,
+                               out_ptr + (direct_offset - offset)))
+    {
+      return false;
+    }
+
+    std::copy_n(block->data.data() + (copy_start - block_offset), copy_end - copy_start,
+                out_ptr + (copy_start - offset));
+    direct_offset = copy_end;
+  }
+
+  if (direct_offset >= end)
     return true;
+
+  return m_async_reader.ReadAt(direct_offset, end - direct_offset,
+                               out_ptr + (direct_offset - offset));
+}
+
+void PlainFileReader::Prefetch(u64 offset, u64 size)
+{
+  if (offset >= static_cast<u64>(m_size))
+    return;
+  size = std::min(size, m_size - offset);
+  size = std::min(size, NUM_PREFETCH_BLOCKS * PREFETCH_BLOCK_SIZE);
+
+  const u64 end = offset + size;
+  for (u64 block_offset = Common::AlignDown(offset, PREFETCH_BLOCK_SIZE); block_offset < end;
+       block_offset += PREFETCH_BLOCK_SIZE)
+  {
+    if (PrefetchBlock* block = FindPrefetchBlock(block_offset))
+    {
+      block->last_used = ++m_prefetch_counter;
+      continue;
+    }
+
+    PrefetchBlock& block = *std::min_element(
+        m_prefetch_blocks.begin(), m_prefetch_blocks.end(),
+        [](const PrefetchBlock& a, const PrefetchBlock& b) { return a.last_used < b.last_used; });
+    if (block.pending)
+      m_async_reader.Wait(block.request_id);
+
+    block.offset = block_offset;
+    block.size = std::min<u64>(PREFETCH_BLOCK_SIZE, m_size - block_offset);
+    block.data.resize(block.size);
+    block.request_id = m_async_reader.Submit(block.offset, block.size, block.data.data());
+    block.pending = true;
+    block.valid = true;
+    block.last_used = ++m_prefetch_counter;
   }
-  else
+}
+
+PlainFileReader::PrefetchBlock* PlainFileReader::FindPrefetchBlock(u64 offset)
+{
+  const auto it = std::find_if(m_prefetch_blocks.begin(), m_prefetch_blocks.end(),
+                               [offset](const PrefetchBlock& block) {
+                                 return block.valid && block.offset == offset;
+                               });
+  return it != m_prefetch_blocks.end() ? &*it : nullptr;
+}
+
+bool PlainFileReader::FinishPrefetch(PrefetchBlock* block)
+{
+  if (block->pending)
   {
-    m_file.ClearError();
-    return false;
+    block->pending = false;
+    block->valid = m_async_reader.Wait(block->request_id);
   }
+
+  return block->valid;
 }
 
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
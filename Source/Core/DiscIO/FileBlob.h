@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <array>
 #include <cstdio>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "Common/AsyncFileReader.h"
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
 #include "DiscIO/Blob.h"
@@ -30,12 +33,37 @@ public:
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
   bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+  void Prefetch(u64 offset, u64 size) override;
 
 private:
+  static constexpr u64 PREFETCH_BLOCK_SIZE = 0x40000;
+  static constexpr size_t NUM_PREFETCH_BLOCKS = 8;
+  static constexpr u32 MAX_READS_IN_FLIGHT = 4;
+
+  struct PrefetchBlock
+  {
+    u64 offset = 0;
+    u64 size = 0;
+    std::vector<u8> data;
+    File::AsyncFileReader::RequestID request_id = 0;
+    bool pending = false;
+    bool valid = false;
+    u64 last_used = 0;
+  };
+
   PlainFileReader(File::IOFile file);
 
+  PrefetchBlock* FindPrefetchBlock(u64 offset);
+  bool FinishPrefetch(PrefetchBlock* block);
+
   File::IOFile m_file;
   s64 m_size;
+
+  std::array<PrefetchBlock, NUM_PREFETCH_BLOCKS> m_prefetch_blocks;
+  u64 m_prefetch_counter = 0;
+
+  // Declared last so that in-flight reads finish before the buffers they write to are freed
+  File::AsyncFileReader m_async_reader;
 };
 
 }  // namespace DiscIO
@@ -3,9 +3,16 @@
 #include "DiscIO/LaggedFibonacciGenerator.h"
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <cstring>
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
@@ -13,6 +20,62 @@
 
 namespace DiscIO
 {
+namespace
+{
+// dst[i] ^= src[i] for i in [0, count), in increasing order of i. src may overlap dst as long as
+// it's at least 4 words behind it, which makes the vectorized updates equivalent to scalar ones.
+void XorWords(u32* dst, const u32* src, size_t count)
+{
+  size_t i = 0;
+#if defined(_M_X86_64)
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(a, b));
+  }
+#elif defined(_M_ARM_64)
+  for (; i + 4 <= count; i += 4)
+    vst1q_u32(dst + i, veorq_u32(vld1q_u32(dst + i), vld1q_u32(src + i)));
+#endif
+  for (; i < count; ++i)
+    dst[i] ^= src[i];
+}
+
+// Returns the length of the common prefix of a and b.
+size_t CountMatchingBytes(const u8* a, const u8* b, size_t size)
+{
+  size_t i = 0;
+#if defined(_M_X86_64)
+  for (; i + 16 <= size; i += 16)
+  {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    const u32 mask = static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+    if (mask != 0xFFFF)
+      return i + std::countr_one(mask);
+  }
+#endif
+  if constexpr (std::endian::native == std::endian::little)
+  {
+    for (; i + 8 <= size; i += 8)
+    {
+      u64 x, y;
+      std::memcpy(&x, a + i, sizeof(x));
+      std::memcpy(&y, b + i, sizeof(y));
+      if (x != y)
+        return i + std::countr_zero(x ^ y) / 8;
+    }
+  }
+  for (; i < size; ++i)
+  {
+    if (a[i] != b[i])
+      return i;
+  }
+  return size;
+}
+}  // namespace
+
 void LaggedFibonacciGenerator::SetSeed(const u32 seed[SEED_SIZE])
 {
   SetSeed(reinterpret_cast<const u8*>(seed));
@@ -51,12 +114,19 @@ size_t LaggedFibonacciGenerator::GetSeed(const u8* data, size_t size, size_t dat
 
   lfg.m_position_bytes = data_offset % (LFG_K * sizeof(u32));
 
-  const u8* end = data + size;
   size_t reconstructed_bytes = 0;
-  while (data < end && lfg.GetByte() == *data)
+  while (reconstructed_bytes < size)
   {
-    ++reconstructed_bytes;
-    ++data;
+    const size_t length =
+        std::min(size - reconstructed_bytes, LFG_K * sizeof(u32) - lfg.m_position_bytes);
+    const u8* generated = reinterpret_cast<const u8*>(lfg.m_buffer.data()) + lfg.m_position_bytes;
+
+    const size_t matching = CountMatchingBytes(generated, data + reconstructed_bytes, length);
+    reconstructed_bytes += matching;
+    if (matching != length)
+      break;
+
+    lfg.Forward(length);
   }
   return reconstructed_bytes;
 }
@@ -142,11 +212,10 @@ void LaggedFibonacciGenerator::Forward(size_t count)
 
 void LaggedFibonacciGenerator::Forward()
 {
-  for (size_t i = 0; i < LFG_J; ++i)
-    m_buffer[i] ^= m_buffer[i + LFG_K - LFG_J];
-
-  for (size_t i = LFG_J; i < LFG_K; ++i)
-    m_buffer[i] ^= m_buffer[i - LFG_J];
+  // The lag of 32 words is larger than a vector, so each step only reads words which a previous
+  // step has finished updating, and the loops can be vectorized without changing the result.
+  XorWords(m_buffer.data(), m_buffer.data() + LFG_K - LFG_J, LFG_J);
+  XorWords(m_buffer.data() + LFG_J, m_buffer.data(), LFG_K - LFG_J);
 }
 
 void LaggedFibonacciGenerator::Backward(size_t start_word, size_t end_word)
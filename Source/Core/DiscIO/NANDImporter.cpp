@@ -4,7 +4,9 @@
 #include "DiscIO/NANDImporter.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
+#include <iterator>
 
 #include "Common/Crypto/AES.h"
 #include "Common/FileUtil.h"
@@ -15,8 +17,33 @@
 
 namespace DiscIO
 {
-constexpr size_t NAND_SIZE = 0x20000000;
 constexpr size_t NAND_KEYS_SIZE = 0x400;
+constexpr size_t NAND_TOTAL_BLOCKS = 0x40000;
+constexpr size_t NAND_BLOCK_SIZE = 0x800;
+constexpr size_t NAND_ECC_BLOCK_SIZE = 0x40;
+constexpr size_t NAND_BIN_SIZE =
+    (NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE) * NAND_TOTAL_BLOCKS;  // 0x21000000
+
+// The filesystem allocates space in clusters of 8 blocks
+constexpr size_t NAND_FAT_BLOCK_SIZE = 0x4000;
+constexpr size_t NAND_BLOCKS_PER_FAT_BLOCK = NAND_FAT_BLOCK_SIZE / NAND_BLOCK_SIZE;
+
+// Reads a cluster from a BootMii dump, leaving out the ECC data that follows every block.
+static bool ReadFATBlock(File::IOFile& file, u16 fat_block, u8* data)
+{
+  constexpr size_t BIN_BLOCK_SIZE = NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE;
+  std::array<u8, BIN_BLOCK_SIZE * NAND_BLOCKS_PER_FAT_BLOCK> raw;
+
+  if (!file.Seek(static_cast<s64>(raw.size()) * fat_block, File::SeekOrigin::Begin) ||
+      !file.ReadBytes(raw.data(), raw.size()))
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < NAND_BLOCKS_PER_FAT_BLOCK; i++)
+    std::memcpy(data + i * NAND_BLOCK_SIZE, &raw[i * BIN_BLOCK_SIZE], NAND_BLOCK_SIZE);
+  return true;
+}
 
 NANDImporter::NANDImporter() : m_nand_root(File::GetUserPath(D_WIIROOT_IDX))
 {
@@ -35,19 +62,23 @@ void NANDImporter::ImportNANDBin(const std::string& path_to_bin,
     return;
 
   ExportKeys();
+
+  m_extracts_remaining = 1;
+  m_extracts_done.Reset();
   ProcessEntry(0, "");
+  if (--m_extracts_remaining != 0)
+  {
+    while (!m_extracts_done.WaitFor(std::chrono::milliseconds(100)))
+      m_update_callback();
+  }
+  m_extract_tasks.Wait();
+
   ExtractCertificates();
 }
 
 bool NANDImporter::ReadNANDBin(const std::string& path_to_bin,
                                std::function<std::string()> get_otp_dump_path)
 {
-  constexpr size_t NAND_TOTAL_BLOCKS = 0x40000;
-  constexpr size_t NAND_BLOCK_SIZE = 0x800;
-  constexpr size_t NAND_ECC_BLOCK_SIZE = 0x40;
-  constexpr size_t NAND_BIN_SIZE =
-      (NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE) * NAND_TOTAL_BLOCKS;  // 0x21000000
-
   File::IOFile file(path_to_bin, "rb");
   const u64 image_size = file.GetSize();
   if (image_size != NAND_BIN_SIZE + NAND_KEYS_SIZE && image_size != NAND_BIN_SIZE)
@@ -56,20 +87,9 @@ bool NANDImporter::ReadNANDBin(const std::string& path_to_bin,
     return false;
   }
 
-  m_nand.resize(NAND_SIZE);
-
-  for (size_t i = 0; i < NAND_TOTAL_BLOCKS; i++)
-  {
-    // Instead of updating on every cycle, we only update every 1000 cycles for a balance between
-    // not updating fast enough vs updating too fast
-    if (i % 1000 == 0)
-      m_update_callback();
-
-    file.ReadBytes(&m_nand[i * NAND_BLOCK_SIZE], NAND_BLOCK_SIZE);
-
-    // We don't care about the ECC blocks
-    file.Seek(NAND_ECC_BLOCK_SIZE, File::SeekOrigin::Current);
-  }
+  // The filesystem is read straight from the dump when it gets extracted, instead of loading the
+  // whole 512 MiB into memory first.
+  m_nand_path = path_to_bin;
 
   m_nand_keys.resize(NAND_KEYS_SIZE);
 
@@ -85,19 +105,36 @@ bool NANDImporter::ReadNANDBin(const std::string& path_to_bin,
   }
 
   // Otherwise, just read the key data from the NAND image.
-  return file.ReadBytes(m_nand_keys.data(), NAND_KEYS_SIZE);
+  return file.Seek(NAND_BIN_SIZE, File::SeekOrigin::Begin) &&
+         file.ReadBytes(m_nand_keys.data(), NAND_KEYS_SIZE);
 }
 
 bool NANDImporter::FindSuperblock()
 {
   constexpr size_t NAND_SUPERBLOCK_START = 0x1fc00000;
+  constexpr size_t FAT_BLOCKS_PER_SUPERBLOCK = sizeof(NANDSuperblock) / NAND_FAT_BLOCK_SIZE;
+
+  File::IOFile file(m_nand_path, "rb");
 
   // There are 16 superblocks, choose the highest/newest version
   for (int i = 0; i < 16; i++)
   {
     auto superblock = std::make_unique<NANDSuperblock>();
-    std::memcpy(superblock.get(), &m_nand[NAND_SUPERBLOCK_START + i * sizeof(NANDSuperblock)],
-                sizeof(NANDSuperblock));
+    const size_t first_fat_block =
+        (NAND_SUPERBLOCK_START + i * sizeof(NANDSuperblock)) / NAND_FAT_BLOCK_SIZE;
+    u8* const superblock_data = reinterpret_cast<u8*>(superblock.get());
+    bool read_ok = true;
+    for (size_t j = 0; j < FAT_BLOCKS_PER_SUPERBLOCK; j++)
+    {
+      read_ok &= ReadFATBlock(file, static_cast<u16>(first_fat_block + j),
+                              superblock_data + j * NAND_FAT_BLOCK_SIZE);
+    }
+
+    if (!read_ok)
+    {
+      ERROR_LOG_FMT(DISCIO, "Superblock #{} could not be read", i);
+      continue;
+    }
 
     if (std::memcmp(superblock->magic, "SFFS", 4) != 0)
     {
@@ -144,9 +181,12 @@ void NANDImporter::ProcessEntry(u16 entry_number, const std::string& parent_path
     Type type = static_cast<Type>(entry.mode & 3);
     if (type == Type::File)
     {
-      std::vector<u8> data = GetEntryData(entry);
-      File::IOFile file(m_nand_root + path, "wb");
-      file.WriteBytes(data.data(), data.size());
+      ++m_extracts_remaining;
+      m_extract_tasks.Submit([this, entry, path] {
+        ExtractFile(entry, path);
+        if (--m_extracts_remaining == 0)
+          m_extracts_done.Set();
+      });
     }
     else if (type == Type::Directory)
     {
@@ -162,28 +202,37 @@ void NANDImporter::ProcessEntry(u16 entry_number, const std::string& parent_path
   }
 }
 
-std::vector<u8> NANDImporter::GetEntryData(const NANDFSTEntry& entry)
+// Runs on the thread pool, so every file gets its own handle to the dump.
+void NANDImporter::ExtractFile(const NANDFSTEntry& entry, const std::string& path) const
 {
-  constexpr size_t NAND_FAT_BLOCK_SIZE = 0x4000;
+  File::IOFile nand_file(m_nand_path, "rb");
+  File::IOFile file(m_nand_root + path, "wb");
 
   u16 sub = entry.sub;
   size_t remaining_bytes = entry.size;
-  std::vector<u8> data{};
-  data.reserve(remaining_bytes);
 
+  auto encrypted_block = std::make_unique<u8[]>(NAND_FAT_BLOCK_SIZE);
   auto block = std::make_unique<u8[]>(NAND_FAT_BLOCK_SIZE);
   while (remaining_bytes > 0)
   {
-    m_aes_ctx->CryptIvZero(&m_nand[NAND_FAT_BLOCK_SIZE * sub], block.get(), NAND_FAT_BLOCK_SIZE);
+    if (sub >= std::size(m_superblock->fat) ||
+        !ReadFATBlock(nand_file, sub, encrypted_block.get()))
+    {
+      ERROR_LOG_FMT(DISCIO, "Could not read cluster {:#06x} of {}", sub, path);
+      return;
+    }
+    m_aes_ctx->CryptIvZero(encrypted_block.get(), block.get(), NAND_FAT_BLOCK_SIZE);
 
     size_t size = std::min(remaining_bytes, NAND_FAT_BLOCK_SIZE);
-    data.insert(data.end(), block.get(), block.get() + size);
+    if (!file.WriteBytes(block.get(), size))
+    {
+      ERROR_LOG_FMT(DISCIO, "Unable to write to file {}", m_nand_root + path);
+      return;
+    }
     remaining_bytes -= size;
 
     sub = m_superblock->fat[sub];
   }
-
-  return data;
 }
 
 bool NANDImporter::ExtractCertificates()
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
@@ -13,7 +14,9 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/AES.h"
+#include "Common/Event.h"
 #include "Common/Swap.h"
+#include "Common/ThreadPool.h"
 
 namespace DiscIO
 {
@@ -69,15 +72,21 @@ private:
   std::string GetPath(const NANDFSTEntry& entry, const std::string& parent_path);
   std::string FormatDebugString(const NANDFSTEntry& entry);
   void ProcessEntry(u16 entry_number, const std::string& parent_path);
-  std::vector<u8> GetEntryData(const NANDFSTEntry& entry);
+  void ExtractFile(const NANDFSTEntry& entry, const std::string& path) const;
   void ExportKeys();
 
   std::string m_nand_root;
-  std::vector<u8> m_nand;
+  std::string m_nand_path;
   std::vector<u8> m_nand_keys;
   std::unique_ptr<Common::AES::Context> m_aes_ctx;
   std::unique_ptr<NANDSuperblock> m_superblock;
   std::function<void()> m_update_callback;
+
+  // Files are decrypted and written on the shared thread pool while the FST is being walked.
+  Common::TaskGroup m_extract_tasks;
+  // Starts at 1 for the FST walk itself, so that it can't reach 0 before all files are submitted.
+  std::atomic<u32> m_extracts_remaining = 0;
+  Common::Event m_extracts_done;
 };
 }  // namespace DiscIO
 
@@ -4,9 +4,13 @@
 #include "DiscIO/RiivolutionPatcher.h"
 
 #include <algorithm>
+#include <cstring>
 #include <locale>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <fmt/format.h>
@@ -366,35 +370,89 @@ static FSTBuilderNode* FindFileNodeInFST(std::string_view path, std::vector<FSTB
                            create_if_not_exists);
 }
 
-static DiscIO::FSTBuilderNode* FindFilenameNodeInFST(std::string_view filename,
-                                                     std::vector<FSTBuilderNode>& fst)
+namespace
 {
-  for (FSTBuilderNode& node : fst)
+// Case-insensitive lookup tables for the FST, so that mods which replace thousands of files don't
+// need a walk through the FST for every one of them.
+class FSTIndex
+{
+public:
+  explicit FSTIndex(std::vector<FSTBuilderNode>* fst) : m_fst(fst) {}
+
+  // Same as FindFileNodeInFST.
+  FSTBuilderNode* FindPath(std::string_view path, bool create_if_not_exists)
   {
-    if (node.IsFolder())
-    {
-      DiscIO::FSTBuilderNode* result = FindFilenameNodeInFST(filename, node.GetFolderContent());
-      if (result)
-        return result;
-    }
-    else if (CaseInsensitiveEquals(node.m_filename, filename))
+    if (m_dirty)
+      Rebuild();
+
+    std::string key(path);
+    Common::ToLower(&key);
+    const auto it = m_paths.find(key);
+    if (it != m_paths.end())
+      return it->second->IsFile() ? it->second : nullptr;
+    if (!create_if_not_exists)
+      return nullptr;
+
+    // Adding a node can move other nodes in memory, so the index has to be rebuilt afterwards.
+    m_dirty = true;
+    return FindFileNodeInFST(path, m_fst, true);
+  }
+
+  // Returns the first file with the given name in a depth-first walk of the FST.
+  FSTBuilderNode* FindFilename(std::string_view filename)
+  {
+    if (m_dirty)
+      Rebuild();
+
+    std::string key(filename);
+    Common::ToLower(&key);
+    const auto it = m_filenames.find(key);
+    return it != m_filenames.end() ? it->second : nullptr;
+  }
+
+private:
+  void Rebuild()
+  {
+    m_paths.clear();
+    m_filenames.clear();
+    AddNodes(m_fst, "", true);
+    m_dirty = false;
+  }
+
+  void AddNodes(std::vector<FSTBuilderNode>* nodes, const std::string& parent_path,
+                bool reachable_by_path)
+  {
+    for (FSTBuilderNode& node : *nodes)
     {
-      return &node;
+      std::string name = node.m_filename;
+      Common::ToLower(&name);
+      std::string path = parent_path + name;
+
+      // Like in FindFileNodeInFST, only the first of several names which differ only in case can
+      // be reached through a path.
+      const bool is_reachable = reachable_by_path && m_paths.try_emplace(path, &node).second;
+      if (node.IsFolder())
+        AddNodes(&node.GetFolderContent(), path + '/', is_reachable);
+      else
+        m_filenames.try_emplace(std::move(name), &node);
     }
   }
 
-  return nullptr;
-}
+  std::vector<FSTBuilderNode>* m_fst;
+  std::unordered_map<std::string, FSTBuilderNode*> m_paths;
+  std::unordered_map<std::string, FSTBuilderNode*> m_filenames;
+  bool m_dirty = true;
+};
+}  // namespace
 
-static void ApplyFilePatchToFST(const Patch& patch, const File& file,
-                                std::vector<DiscIO::FSTBuilderNode>* fst,
+static void ApplyFilePatchToFST(const Patch& patch, const File& file, FSTIndex* fst,
                                 DiscIO::FSTBuilderNode* dol_node)
 {
   if (!file.m_disc.empty() && file.m_disc[0] == '/')
   {
     // If the disc path starts with a / then we should patch that specific disc path.
     DiscIO::FSTBuilderNode* node =
-        FindFileNodeInFST(std::string_view(file.m_disc).substr(1), fst, file.m_create);
+        fst->FindPath(std::string_view(file.m_disc).substr(1), file.m_create);
     if (node)
       ApplyPatchToFile(patch, file, node);
   }
@@ -406,14 +464,13 @@ static void ApplyFilePatchToFST(const Patch& patch, const File& file,
   else
   {
     // Otherwise we want to patch the first file in the FST that matches that filename.
-    DiscIO::FSTBuilderNode* node = FindFilenameNodeInFST(file.m_disc, *fst);
+    DiscIO::FSTBuilderNode* node = fst->FindFilename(file.m_disc);
     if (node)
       ApplyPatchToFile(patch, file, node);
   }
 }
 
-static void ApplyFolderPatchToFST(const Patch& patch, const Folder& folder,
-                                  std::vector<DiscIO::FSTBuilderNode>* fst,
+static void ApplyFolderPatchToFST(const Patch& patch, const Folder& folder, FSTIndex* fst,
                                   DiscIO::FSTBuilderNode* dol_node, std::string_view disc_path,
                                   std::string_view external_path)
 {
@@ -452,8 +509,7 @@ static void ApplyFolderPatchToFST(const Patch& patch, const Folder& folder,
   }
 }
 
-static void ApplyFolderPatchToFST(const Patch& patch, const Folder& folder,
-                                  std::vector<DiscIO::FSTBuilderNode>* fst,
+static void ApplyFolderPatchToFST(const Patch& patch, const Folder& folder, FSTIndex* fst,
                                   DiscIO::FSTBuilderNode* dol_node)
 {
   ApplyFolderPatchToFST(patch, folder, fst, dol_node, folder.m_disc, folder.m_external);
@@ -462,6 +518,7 @@ static void ApplyFolderPatchToFST(const Patch& patch, const Folder& folder,
 void ApplyPatchesToFiles(const std::vector<Patch>& patches, PatchIndex index,
                          std::vector<DiscIO::FSTBuilderNode>* fst, DiscIO::FSTBuilderNode* dol_node)
 {
+  FSTIndex fst_index(fst);
   for (const auto& patch : patches)
   {
     const auto& file_patches =
@@ -470,10 +527,10 @@ void ApplyPatchesToFiles(const std::vector<Patch>& patches, PatchIndex index,
         index == PatchIndex::DolphinSysFiles ? patch.m_sys_folder_patches : patch.m_folder_patches;
 
     for (const auto& file : file_patches)
-      ApplyFilePatchToFST(patch, file, fst, dol_node);
+      ApplyFilePatchToFST(patch, file, &fst_index, dol_node);
 
     for (const auto& folder : folder_patches)
-      ApplyFolderPatchToFST(patch, folder, fst, dol_node);
+      ApplyFolderPatchToFST(patch, folder, &fst_index, dol_node);
   }
 }
 
@@ -488,6 +545,34 @@ static bool MemoryMatchesAt(u32 offset, const std::vector<u8>& value)
   return true;
 }
 
+// Returns the offset from ram_start of the first match of pattern which starts below length at a
+// multiple of stride. Matches may run past length, but not past the end of the RAM bank.
+static std::optional<u32> FindInMemory(const std::vector<u8>& pattern, u32 ram_start, u32 length,
+                                       u32 stride)
+{
+  const auto& memory = Core::System::GetInstance().GetMemory();
+  const std::span<const u8> ram = memory.GetSpanForAddress(ram_start);
+  if (pattern.empty() || pattern.size() > ram.size())
+    return std::nullopt;
+
+  const size_t search_end = std::min<size_t>(length, ram.size() - pattern.size() + 1);
+  size_t i = 0;
+  while (i < search_end)
+  {
+    // memchr is vectorized, so let it skip ahead to the next spot where the first byte matches
+    const void* first_byte = std::memchr(&ram[i], pattern[0], search_end - i);
+    if (!first_byte)
+      break;
+
+    i = static_cast<const u8*>(first_byte) - ram.data();
+    if (i % stride == 0 && std::memcmp(&ram[i], pattern.data(), pattern.size()) == 0)
+      return static_cast<u32>(i);
+    i = (i / stride + 1) * stride;
+  }
+
+  return std::nullopt;
+}
+
 static void ApplyMemoryPatch(u32 offset, const std::vector<u8>& value,
                              const std::vector<u8>& original)
 {
@@ -532,15 +617,13 @@ static void ApplySearchMemoryPatch(const Patch& patch, const Memory& memory_patc
     return;
 
   const u32 stride = memory_patch.m_align;
-  for (u32 i = 0; i < length - (stride - 1); i += stride)
-  {
-    const u32 address = ram_start + i;
-    if (MemoryMatchesAt(address, memory_patch.m_original))
-    {
-      ApplyMemoryPatch(address, GetMemoryPatchValue(patch, memory_patch), {});
-      break;
-    }
-  }
+  if (length < stride)
+    return;
+
+  const std::optional<u32> offset =
+      FindInMemory(memory_patch.m_original, ram_start, length - (stride - 1), stride);
+  if (offset)
+    ApplyMemoryPatch(ram_start + *offset, GetMemoryPatchValue(patch, memory_patch), {});
 }
 
 static void ApplyOcarinaMemoryPatch(const Patch& patch, const Memory& memory_patch, u32 ram_start,
@@ -552,32 +635,27 @@ static void ApplyOcarinaMemoryPatch(const Patch& patch, const Memory& memory_pat
   if (value.empty())
     return;
 
+  // first find the pattern
+  const std::optional<u32> pattern_offset = FindInMemory(value, ram_start, length, 4);
+  if (!pattern_offset)
+    return;
+
   auto& system = Core::System::GetInstance();
-  for (u32 i = 0; i < length; i += 4)
+  for (u32 i = *pattern_offset; i < length; i += 4)
   {
-    // first find the pattern
-    const u32 address = ram_start + i;
-    if (MemoryMatchesAt(address, value))
+    // from the pattern find the next blr instruction
+    const u32 blr_address = ram_start + i;
+    auto blr = PowerPC::HostTryReadU32(blr_address);
+    if (blr && blr->value == 0x4e800020)
     {
-      for (; i < length; i += 4)
+      // and replace it with a jump to the given offset
+      const u32 target = memory_patch.m_offset | 0x80000000;
+      const u32 jmp = ((target - blr_address) & 0x03fffffc) | 0x48000000;
+      PowerPC::HostTryWriteU32(jmp, blr_address);
+      const u32 overlapping_hook_count = HLE::UnpatchRange(system, blr_address, blr_address + 4);
+      if (overlapping_hook_count != 0)
       {
-        // from the pattern find the next blr instruction
-        const u32 blr_address = ram_start + i;
-        auto blr = PowerPC::HostTryReadU32(blr_address);
-        if (blr && blr->value == 0x4e800020)
-        {
-          // and replace it with a jump to the given offset
-          const u32 target = memory_patch.m_offset | 0x80000000;
-          const u32 jmp = ((target - blr_address) & 0x03fffffc) | 0x48000000;
-          PowerPC::HostTryWriteU32(jmp, blr_address);
-          const u32 overlapping_hook_count =
-              HLE::UnpatchRange(system, blr_address, blr_address + 4);
-          if (overlapping_hook_count != 0)
-          {
-            WARN_LOG_FMT(OSHLE, "Riivolution ocarina patch overlaps HLE hook at {}", blr_address);
-          }
-          return;
-        }
+        WARN_LOG_FMT(OSHLE, "Riivolution ocarina patch overlaps HLE hook at {}", blr_address);
       }
       return;
     }
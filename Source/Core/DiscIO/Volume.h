@@ -48,6 +48,8 @@ public:
   Volume() {}
   virtual ~Volume() {}
   virtual bool Read(u64 offset, u64 length, u8* buffer, const Partition& partition) const = 0;
+  // Hints that the given range is likely to be read soon. See BlobReader::Prefetch.
+  virtual void Prefetch(u64 offset, u64 length, const Partition& partition) const {}
   template <typename T>
   std::optional<T> ReadSwapped(u64 offset, const Partition& partition) const
   {
@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
 
 #include <mbedtls/md5.h>
@@ -357,7 +358,9 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
   return {Status::Unknown, Common::GetStringT("Unknown disc")};
 }
 
-constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
+// Each chunk starts its own hashing tasks, so chunks need to be large enough for the cost of
+// starting those to not matter. Wii groups are this size too.
+constexpr u64 DEFAULT_READ_SIZE = 0x200000;
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
                                Hashes<bool> hashes_to_calculate)
@@ -1243,14 +1246,46 @@ void VolumeVerifier::Process()
     m_group_future = std::async(std::launch::async, [this, read_failed,
                                                      group_index = m_group_index] {
       const GroupToVerify& group = m_groups[group_index];
+      const size_t blocks = group.block_index_end - group.block_index_start;
+
+      // Decrypting and hashing the blocks is what takes the longest out of everything done for
+      // a chunk, so split the blocks between a few threads. The first block is checked before
+      // starting them, since that sets up the partition's key and H3 table (which are lazily
+      // initialized and not safe to initialize concurrently).
+      std::vector<u8> block_ok(blocks, false);
+      const auto check_blocks = [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i)
+        {
+          block_ok[i] = !read_failed &&
+                        m_volume.CheckBlockIntegrity(group.block_index_start + i,
+                                                     m_data.data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+                                                     group.partition);
+        }
+      };
+
+      if (blocks > 0)
+        check_blocks(0, 1);
+
+      const size_t threads = std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1,
+                                                std::max<size_t>(blocks / 8, 1));
+      std::vector<std::future<void>> block_futures;
+      for (size_t i = 1; i < threads; ++i)
+      {
+        block_futures.push_back(std::async(std::launch::async, check_blocks,
+                                           1 + (blocks - 1) * i / threads,
+                                           1 + (blocks - 1) * (i + 1) / threads));
+      }
+      if (blocks > 0)
+        check_blocks(1, 1 + (blocks - 1) / threads);
+      for (std::future<void>& future : block_futures)
+        future.get();
+
       u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
+      for (size_t i = 0; i < blocks; ++i, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
       {
         const u64 block_offset = group.offset + offset_in_group;
 
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
+        if (block_ok[i])
         {
           m_biggest_verified_offset =
               std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
@@ -240,6 +240,42 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
   return true;
 }
 
+void VolumeWii::Prefetch(u64 offset, u64 length, const Partition& partition) const
+{
+  if (length == 0)
+    return;
+
+  if (partition == PARTITION_NONE)
+  {
+    m_reader->Prefetch(offset, length);
+    return;
+  }
+
+  auto it = m_partitions.find(partition);
+  if (it == m_partitions.end())
+    return;
+
+  const u64 partition_data_offset = partition.offset + *it->second.data_offset;
+  if (m_has_hashes && m_has_encryption &&
+      m_reader->SupportsReadWiiDecrypted(offset, length, partition_data_offset))
+  {
+    m_reader->PrefetchWiiDecrypted(offset, length, partition_data_offset);
+    return;
+  }
+
+  if (!m_has_hashes)
+  {
+    m_reader->Prefetch(partition_data_offset + offset, length);
+    return;
+  }
+
+  // Read works on whole blocks, so prefetch every block which overlaps the range
+  const u64 first_block = offset / BLOCK_DATA_SIZE;
+  const u64 last_block = (offset + length - 1) / BLOCK_DATA_SIZE;
+  m_reader->Prefetch(partition_data_offset + first_block * BLOCK_TOTAL_SIZE,
+                     (last_block - first_block + 1) * BLOCK_TOTAL_SIZE);
+}
+
 bool VolumeWii::HasWiiHashes() const
 {
   return m_has_hashes;
@@ -512,18 +548,26 @@ bool VolumeWii::HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GR
                           HashBlock out[BLOCKS_PER_GROUP],
                           const std::function<bool(size_t block)>& read_function)
 {
-  std::array<std::future<void>, BLOCKS_PER_GROUP> hash_futures;
+  // Each task hashes one H1 subgroup of 8 blocks. The blocks are read on this thread, so a
+  // subgroup can be hashed while the next one is being read, without starting a thread per block.
+  constexpr size_t BLOCKS_PER_SUBGROUP = 8;
+  constexpr size_t SUBGROUPS = BLOCKS_PER_GROUP / BLOCKS_PER_SUBGROUP;
+
+  std::array<std::future<void>, SUBGROUPS> hash_futures;
   bool success = true;
 
-  for (size_t i = 0; i < BLOCKS_PER_GROUP; ++i)
+  for (size_t subgroup = 0; subgroup < SUBGROUPS && success; ++subgroup)
   {
-    if (read_function && success)
+    const size_t h1_base = subgroup * BLOCKS_PER_SUBGROUP;
+
+    for (size_t i = h1_base; i < h1_base + BLOCKS_PER_SUBGROUP && read_function && success; ++i)
       success = read_function(i);
 
-    hash_futures[i] = std::async(std::launch::async, [&in, &out, &hash_futures, success, i]() {
-      const size_t h1_base = Common::AlignDown(i, 8);
+    if (!success)
+      break;
 
-      if (success)
+    hash_futures[subgroup] = std::async(std::launch::async, [&in, &out, subgroup, h1_base]() {
+      for (size_t i = h1_base; i < h1_base + BLOCKS_PER_SUBGROUP; ++i)
       {
         // H0 hashes
         for (size_t j = 0; j < 31; ++j)
@@ -536,47 +580,36 @@ bool VolumeWii::HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GR
         out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
       }
 
-      if (i % 8 == 7)
-      {
-        for (size_t j = 0; j < 7; ++j)
-          hash_futures[h1_base + j].get();
-
-        if (success)
-        {
-          // H1 padding
-          out[h1_base].padding_1 = {};
-
-          // H1 copies
-          for (size_t j = 1; j < 8; ++j)
-            out[h1_base + j].h1 = out[h1_base].h1;
+      // H1 padding
+      out[h1_base].padding_1 = {};
 
-          // H2 hash
-          out[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(out[i].h1);
-        }
+      // H1 copies
+      for (size_t j = 1; j < BLOCKS_PER_SUBGROUP; ++j)
+        out[h1_base + j].h1 = out[h1_base].h1;
 
-        if (i == BLOCKS_PER_GROUP - 1)
-        {
-          for (size_t j = 0; j < 7; ++j)
-            hash_futures[j * 8 + 7].get();
-
-          if (success)
-          {
-            // H2 padding
-            out[0].padding_2 = {};
-
-            // H2 copies
-            for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
-              out[j].h2 = out[0].h2;
-          }
-        }
-      }
+      // H2 hash
+      out[0].h2[subgroup] = Common::SHA1::CalculateDigest(out[h1_base].h1);
     });
   }
 
   // Wait for all the async tasks to finish
-  hash_futures.back().get();
+  for (std::future<void>& future : hash_futures)
+  {
+    if (future.valid())
+      future.get();
+  }
+
+  if (!success)
+    return false;
+
+  // H2 padding
+  out[0].padding_2 = {};
 
-  return success;
+  // H2 copies
+  for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
+    out[j].h2 = out[0].h2;
+
+  return true;
 }
 
 bool VolumeWii::EncryptGroup(
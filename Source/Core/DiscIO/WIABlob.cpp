@@ -11,8 +11,10 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <zstd.h>
@@ -79,13 +81,19 @@ std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compressio
 
 template <bool RVZ>
 WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& path)
-    : m_file(std::move(file)), m_encryption_cache(this)
+    : m_file(std::move(file)), m_path(path), m_encryption_cache(this)
 {
   m_valid = Initialize(path);
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  // The worker threads may still be using m_readahead_chunk and m_readahead_file, and have to be
+  // stopped before the mutexes they lock are destroyed.
+  m_readahead_thread.Shutdown();
+  m_decode_threads.reset();
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -158,6 +166,32 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
     return false;
   }
 
+  if (RVZ && m_compression_type == WIARVZCompressionType::Zstd &&
+      m_header_2.compressor_data_size != 0)
+  {
+    if (m_header_2.compressor_data_size != sizeof(WIAHeader2::compressor_data))
+      return false;
+
+    const u8* compressor_data = m_header_2.compressor_data;
+    const u64 dictionary_offset = static_cast<u64>(Common::swap32(compressor_data)) << 2;
+    const u32 dictionary_size =
+        compressor_data[4] << 16 | compressor_data[5] << 8 | compressor_data[6];
+
+    std::vector<u8> dictionary(dictionary_size);
+    if (!m_file.Seek(dictionary_offset, File::SeekOrigin::Begin) ||
+        !m_file.ReadBytes(dictionary.data(), dictionary.size()))
+    {
+      return false;
+    }
+
+    m_zstd_dictionary = CreateZstdDictionary(dictionary);
+    if (!m_zstd_dictionary)
+    {
+      ERROR_LOG_FMT(DISCIO, "Invalid Zstandard dictionary in {}", path);
+      return false;
+    }
+  }
+
   const size_t number_of_partition_entries = Common::swap32(m_header_2.number_of_partition_entries);
   const size_t partition_entry_size = Common::swap32(m_header_2.partition_entry_size);
   std::vector<u8> partition_entries(partition_entry_size * number_of_partition_entries);
@@ -478,6 +512,108 @@ bool WIARVZFileReader<RVZ>::ReadWiiDecrypted(u64 offset, u64 size, u8* out_ptr,
   return size == 0;
 }
 
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::Prefetch(u64 offset, u64 size)
+{
+  // Data in partitions is prefetched through PrefetchWiiDecrypted instead
+  const auto it = m_data_entries.upper_bound(offset);
+  if (size == 0 || it == m_data_entries.end() || it->second.is_partition)
+    return;
+
+  const RawDataEntry& raw_data = m_raw_data_entries[it->second.index];
+  PrefetchFromGroups(offset, Common::swap32(m_header_2.chunk_size),
+                     Common::swap64(raw_data.data_offset), Common::swap64(raw_data.data_size),
+                     Common::swap32(raw_data.group_index),
+                     Common::swap32(raw_data.number_of_groups), 0);
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::PrefetchWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset)
+{
+  u32 partition_first_sector;
+  const PartitionEntry* partition = GetPartition(partition_data_offset, &partition_first_sector);
+  if (size == 0 || !partition)
+    return;
+
+  const u64 chunk_size = Common::swap32(m_header_2.chunk_size) * VolumeWii::BLOCK_DATA_SIZE /
+                         VolumeWii::BLOCK_TOTAL_SIZE;
+
+  for (const PartitionDataEntry& data : partition->data_entries)
+  {
+    const u64 data_offset =
+        (Common::swap32(data.first_sector) - partition_first_sector) * VolumeWii::BLOCK_DATA_SIZE;
+    const u64 data_size = Common::swap32(data.number_of_sectors) * VolumeWii::BLOCK_DATA_SIZE;
+
+    PrefetchFromGroups(
+        offset, chunk_size, data_offset, data_size, Common::swap32(data.group_index),
+        Common::swap32(data.number_of_groups),
+        std::max<u32>(1, static_cast<u32>(chunk_size / VolumeWii::GROUP_DATA_SIZE)));
+  }
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::PrefetchFromGroups(u64 offset, u64 chunk_size, u64 data_offset,
+                                               u64 data_size, u32 group_index,
+                                               u32 number_of_groups, u32 exception_lists)
+{
+  if (offset < data_offset || offset >= data_offset + data_size)
+    return;
+
+  // There's only one readahead slot. Waiting for it here would hold up the reads which are
+  // actually needed right now, so a prefetch while it's busy is dropped instead.
+  if (m_readahead_chunk)
+  {
+    std::lock_guard lk(m_readahead_mutex);
+    if (!m_readahead_done)
+      return;
+  }
+
+  const u64 i = (offset - data_offset) / chunk_size;
+  GroupChunkInfo info;
+  if (i >= number_of_groups ||
+      !GetGroupChunkInfo(group_index + i, i * chunk_size, chunk_size, data_size, &info))
+  {
+    return;
+  }
+
+  if (info.compressed_size != 0 && info.compression_type != WIARVZCompressionType::None)
+  {
+    StartReadahead(info.offset_in_file, info.compressed_size, info.decompressed_size,
+                   info.compression_type, exception_lists, info.rvz_packed_size,
+                   info.offset_in_data);
+  }
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::GetGroupChunkInfo(u64 total_group_index, u64 group_offset_in_data,
+                                              u64 chunk_size, u64 data_size,
+                                              GroupChunkInfo* info) const
+{
+  if (total_group_index >= m_group_entries.size())
+    return false;
+
+  const GroupEntry group = m_group_entries[total_group_index];
+  u32 group_data_size = Common::swap32(group.data_size);
+
+  info->compression_type = m_compression_type;
+  info->rvz_packed_size = 0;
+  if constexpr (RVZ)
+  {
+    if ((group_data_size & 0x80000000) == 0)
+      info->compression_type = WIARVZCompressionType::None;
+
+    group_data_size &= 0x7FFFFFFF;
+
+    info->rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  info->offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+  info->compressed_size = group_data_size;
+  info->decompressed_size = std::min(chunk_size, data_size - group_offset_in_data);
+  info->offset_in_data = group_offset_in_data;
+  return true;
+}
+
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size,
                                            u32 sector_size, u64 data_offset, u64 data_size,
@@ -495,48 +631,35 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   data_size += skipped_data;
 
   const u64 start_group_index = (*offset - data_offset) / chunk_size;
+  DecodeGroupsInParallel(*offset, *size, chunk_size, data_offset, data_size, group_index,
+                         number_of_groups, exception_lists);
+
   for (u64 i = start_group_index; i < number_of_groups && (*size) > 0; ++i)
   {
     const u64 total_group_index = group_index + i;
-    if (total_group_index >= m_group_entries.size())
-      return false;
-
-    const GroupEntry group = m_group_entries[total_group_index];
     const u64 group_offset_in_data = i * chunk_size;
-    const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
-
-    chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
-    const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
-
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
-    {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
-
-      group_data_size &= 0x7FFFFFFF;
+    GroupChunkInfo info;
+    if (!GetGroupChunkInfo(total_group_index, group_offset_in_data, chunk_size, data_size, &info))
+      return false;
 
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
-    }
+    const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
+    const u64 bytes_to_read = std::min(info.decompressed_size - offset_in_group, *size);
 
-    if (group_data_size == 0)
+    if (info.compressed_size == 0)
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
-
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
+      Chunk& chunk = ReadCompressedData(info.offset_in_file, info.compressed_size,
+                                        info.decompressed_size, info.compression_type,
+                                        exception_lists, info.rvz_packed_size,
+                                        info.offset_in_data);
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        EvictCachedChunk(info.offset_in_file);
         return false;
       }
 
@@ -554,11 +677,145 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     *offset += bytes_to_read;
     *size -= bytes_to_read;
     *out_ptr += bytes_to_read;
+
+    // Moving on to the next group suggests a sequential read, so prepare the group after it.
+    const bool sequential = total_group_index == m_last_group_index + 1;
+    m_last_group_index = total_group_index;
+    GroupChunkInfo next_info;
+    if (sequential && *size == 0 && i + 1 < number_of_groups &&
+        group_offset_in_data + chunk_size < data_size &&
+        GetGroupChunkInfo(total_group_index + 1, group_offset_in_data + chunk_size, chunk_size,
+                          data_size, &next_info))
+    {
+      // There's no point in decompressing stored data ahead of time.
+      if (next_info.compressed_size != 0 &&
+          next_info.compression_type != WIARVZCompressionType::None)
+      {
+        StartReadahead(next_info.offset_in_file, next_info.compressed_size,
+                       next_info.decompressed_size, next_info.compression_type, exception_lists,
+                       next_info.rvz_packed_size, next_info.offset_in_data);
+      }
+    }
   }
 
   return true;
 }
 
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::DecodeGroupsInParallel(u64 offset, u64 size, u64 chunk_size,
+                                                   u64 data_offset, u64 data_size,
+                                                   u32 group_index, u32 number_of_groups,
+                                                   u32 exception_lists)
+{
+  // Only worth it when a single read covers several groups, which happens for large DVD reads.
+  if (size <= chunk_size || m_decode_threads_failed)
+    return;
+
+  const u64 start_group_index = (offset - data_offset) / chunk_size;
+  const u64 end_group_index =
+      std::min<u64>((offset + size - 1 - data_offset) / chunk_size + 1, number_of_groups);
+
+  // Leave room in the cache, so decoding the later groups doesn't evict the earlier ones.
+  size_t memory_usage = 0;
+  std::vector<std::unique_ptr<CachedChunk>> chunks;
+  for (u64 i = start_group_index; i < end_group_index; ++i)
+  {
+    const u64 group_offset_in_data = i * chunk_size;
+    GroupChunkInfo info;
+    if (group_offset_in_data >= data_size ||
+        !GetGroupChunkInfo(group_index + i, group_offset_in_data, chunk_size, data_size, &info))
+    {
+      break;
+    }
+
+    if (info.compressed_size == 0 || info.compression_type == WIARVZCompressionType::None ||
+        IsChunkCached(info.offset_in_file) ||
+        (m_readahead_chunk && m_readahead_chunk->offset_in_file == info.offset_in_file))
+    {
+      continue;
+    }
+
+    Chunk chunk = CreateChunk(nullptr, info.offset_in_file, info.compressed_size,
+                              info.decompressed_size, info.compression_type, exception_lists,
+                              info.rvz_packed_size, info.offset_in_data);
+    memory_usage += chunk.GetMemoryUsage();
+    if (memory_usage > MAX_CHUNK_CACHE_SIZE / 2)
+      break;
+
+    chunks.push_back(std::make_unique<CachedChunk>(CachedChunk{info.offset_in_file,
+                                                               std::move(chunk)}));
+  }
+
+  if (chunks.size() < 2 || !CreateDecodeThreads())
+    return;
+
+  {
+    std::lock_guard lk(m_decode_mutex);
+    m_decode_pending = chunks.size();
+  }
+  for (size_t i = 0; i < chunks.size(); ++i)
+  {
+    DecodeThread& decode_thread = m_decode_threads[i % m_decode_thread_count];
+    chunks[i]->chunk.SetFile(&decode_thread.file);
+    decode_thread.worker.EmplaceItem(chunks[i].get());
+  }
+  {
+    std::unique_lock lk(m_decode_mutex);
+    m_decode_cv.wait(lk, [this] { return m_decode_pending == 0; });
+  }
+
+  // Failed chunks are left out, so the serial read reports the error as usual.
+  for (std::unique_ptr<CachedChunk>& cached_chunk : chunks)
+  {
+    if (!cached_chunk->success)
+      continue;
+
+    cached_chunk->chunk.SetFile(&m_file);
+    InsertCachedChunk(std::move(*cached_chunk));
+  }
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::CreateDecodeThreads()
+{
+  if (m_decode_threads)
+    return true;
+
+  const size_t thread_count =
+      std::min<size_t>(MAX_DECODE_THREADS, std::thread::hardware_concurrency());
+  if (thread_count < 2)
+  {
+    m_decode_threads_failed = true;
+    return false;
+  }
+
+  auto decode_threads = std::make_unique<DecodeThread[]>(thread_count);
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    if (!decode_threads[i].file.Open(m_path, "rb"))
+    {
+      m_decode_threads_failed = true;
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    decode_threads[i].worker.Reset([this](CachedChunk* cached_chunk) {
+      const bool success = cached_chunk->chunk.DecompressAll();
+
+      std::lock_guard lk(m_decode_mutex);
+      cached_chunk->success = success;
+      if (--m_decode_pending == 0)
+        m_decode_cv.notify_one();
+    });
+  }
+
+  m_decode_threads = std::move(decode_threads);
+  m_decode_thread_count = thread_count;
+  return true;
+}
+
 template <bool RVZ>
 typename WIARVZFileReader<RVZ>::Chunk&
 WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
@@ -566,9 +823,30 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  if (m_readahead_chunk && m_readahead_chunk->offset_in_file == offset_in_file)
+    FinishReadahead();
+
+  for (auto it = m_chunk_cache.begin(); it != m_chunk_cache.end(); ++it)
+  {
+    if (it->offset_in_file == offset_in_file)
+    {
+      m_chunk_cache.splice(m_chunk_cache.begin(), m_chunk_cache, it);
+      return m_chunk_cache.front().chunk;
+    }
+  }
+
+  InsertCachedChunk(CachedChunk{
+      offset_in_file, CreateChunk(&m_file, offset_in_file, compressed_size, decompressed_size,
+                                  compression_type, exception_lists, rvz_packed_size, data_offset)});
+  return m_chunk_cache.front().chunk;
+}
 
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk
+WIARVZFileReader<RVZ>::CreateChunk(File::IOFile* file, u64 offset_in_file, u64 compressed_size,
+                                   u64 decompressed_size, WIARVZCompressionType compression_type,
+                                   u32 exception_lists, u32 rvz_packed_size, u64 data_offset) const
+{
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
   {
@@ -591,17 +869,107 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                                       m_header_2.compressor_data_size);
     break;
   case WIARVZCompressionType::Zstd:
-    decompressor = std::make_unique<ZstdDecompressor>();
+    decompressor = std::make_unique<ZstdDecompressor>(m_zstd_dictionary);
     break;
   }
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return Chunk(file, offset_in_file, compressed_size, decompressed_size, exception_lists,
+               compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::IsChunkCached(u64 offset_in_file) const
+{
+  return std::any_of(m_chunk_cache.begin(), m_chunk_cache.end(),
+                     [offset_in_file](const CachedChunk& cached_chunk) {
+                       return cached_chunk.offset_in_file == offset_in_file;
+                     });
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InsertCachedChunk(CachedChunk cached_chunk)
+{
+  m_chunk_cache_size += cached_chunk.chunk.GetMemoryUsage();
+  m_chunk_cache.push_front(std::move(cached_chunk));
+
+  // Always keep the chunk which was just inserted, since the caller is about to use it.
+  while (m_chunk_cache_size > MAX_CHUNK_CACHE_SIZE && m_chunk_cache.size() > 1)
+  {
+    m_chunk_cache_size -= m_chunk_cache.back().chunk.GetMemoryUsage();
+    m_chunk_cache.pop_back();
+  }
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::EvictCachedChunk(u64 offset_in_file)
+{
+  for (auto it = m_chunk_cache.begin(); it != m_chunk_cache.end(); ++it)
+  {
+    if (it->offset_in_file == offset_in_file)
+    {
+      m_chunk_cache_size -= it->chunk.GetMemoryUsage();
+      m_chunk_cache.erase(it);
+      return;
+    }
+  }
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::StartReadahead(u64 offset_in_file, u64 compressed_size,
+                                           u64 decompressed_size,
+                                           WIARVZCompressionType compression_type,
+                                           u32 exception_lists, u32 rvz_packed_size,
+                                           u64 data_offset)
+{
+  if (IsChunkCached(offset_in_file))
+    return;
+
+  if (m_readahead_chunk)
+  {
+    if (m_readahead_chunk->offset_in_file == offset_in_file)
+      return;
+    FinishReadahead();
+  }
+
+  if (!m_readahead_file.IsOpen())
+  {
+    if (!m_readahead_file.Open(m_path, "rb"))
+      return;
+
+    m_readahead_thread.Reset([this](CachedChunk* cached_chunk) {
+      const bool success = cached_chunk->chunk.DecompressAll();
+
+      std::lock_guard lk(m_readahead_mutex);
+      cached_chunk->success = success;
+      m_readahead_done = true;
+      m_readahead_cv.notify_one();
+    });
+  }
+
+  m_readahead_done = false;
+  m_readahead_chunk = std::make_unique<CachedChunk>(CachedChunk{
+      offset_in_file, CreateChunk(&m_readahead_file, offset_in_file, compressed_size,
+                                  decompressed_size, compression_type, exception_lists,
+                                  rvz_packed_size, data_offset)});
+  m_readahead_thread.EmplaceItem(m_readahead_chunk.get());
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::FinishReadahead()
+{
+  {
+    std::unique_lock lk(m_readahead_mutex);
+    m_readahead_cv.wait(lk, [this] { return m_readahead_done; });
+  }
+
+  std::unique_ptr<CachedChunk> cached_chunk = std::move(m_readahead_chunk);
+  if (cached_chunk->success && !IsChunkCached(cached_chunk->offset_in_file))
+  {
+    cached_chunk->chunk.SetFile(&m_file);
+    InsertCachedChunk(std::move(*cached_chunk));
+  }
 }
 
 template <bool RVZ>
@@ -645,16 +1013,29 @@ WIARVZFileReader<RVZ>::Chunk::Chunk(File::IOFile* file, u64 offset_in_file, u64
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 {
-  if (!m_decompressor || !m_file ||
-      offset + size > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
-  {
+  if (!DecompressUntil(offset + size))
     return false;
-  }
 
-  while (offset + size > GetOutBytesWrittenExcludingExceptions())
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  return DecompressUntil(m_out.data.size() - m_out_bytes_allocated_for_exceptions);
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressUntil(u64 end)
+{
+  if (!m_decompressor || !m_file || end > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
+    return false;
+
+  while (end > GetOutBytesWrittenExcludingExceptions())
   {
     u64 bytes_to_read;
-    if (offset + size == m_out.data.size())
+    if (end == m_out.data.size())
     {
       // Read all the remaining data.
       bytes_to_read = m_in.data.size() - m_in.bytes_written;
@@ -667,7 +1048,7 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 
       // The compressed data is probably not much bigger than the decompressed data.
       // Add a few bytes for possible compression overhead and for any hash exceptions.
-      bytes_to_read = offset + size - GetOutBytesWrittenExcludingExceptions() + 0x100;
+      bytes_to_read = end - GetOutBytesWrittenExcludingExceptions() + 0x100;
 
       // Align the access in an attempt to gain speed. But we don't actually know the
       // block size of the underlying storage device, so we just use the Wii block size.
@@ -747,7 +1128,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
@@ -1055,7 +1435,9 @@ std::optional<std::vector<u8>> WIARVZFileReader<RVZ>::Compress(Compressor* compr
 template <bool RVZ>
 void WIARVZFileReader<RVZ>::SetUpCompressor(std::unique_ptr<Compressor>* compressor,
                                             WIARVZCompressionType compression_type,
-                                            int compression_level, WIAHeader2* header_2)
+                                            int compression_level, u64 chunk_size,
+                                            const std::vector<u8>& zstd_dictionary,
+                                            WIAHeader2* header_2)
 {
   switch (compression_type)
   {
@@ -1086,7 +1468,7 @@ void WIARVZFileReader<RVZ>::SetUpCompressor(std::unique_ptr<Compressor>* compres
     break;
   }
   case WIARVZCompressionType::Zstd:
-    *compressor = std::make_unique<ZstdCompressor>(compression_level);
+    *compressor = std::make_unique<ZstdCompressor>(compression_level, chunk_size, zstd_dictionary);
     break;
   }
 }
@@ -1136,6 +1518,113 @@ static bool AllSame(const u8* begin, const u8* end)
   return AllAre(begin, end, *begin);
 };
 
+template <bool RVZ>
+std::vector<u8>
+WIARVZFileReader<RVZ>::BuildZstdDictionary(BlobReader* infile,
+                                           const std::vector<PartitionEntry>& partition_entries,
+                                           const std::vector<RawDataEntry>& raw_data_entries,
+                                           const std::vector<DataEntry>& data_entries)
+{
+  // The bundled Zstandard doesn't include the dictionary builder, so rather than training a
+  // dictionary, we use a raw content dictionary made of small samples spread evenly over the
+  // disc. Discs repeat the same file headers and structures all over, and chunks too small for
+  // Zstandard to find much redundancy in on their own benefit the most from having them.
+  constexpr u64 NUMBER_OF_SAMPLES = 64;
+  constexpr u64 SAMPLE_SIZE = 0x700;
+
+  struct Region
+  {
+    u64 offset;
+    u64 size;
+    const PartitionEntry* partition_entry;
+  };
+
+  std::vector<Region> regions;
+  u64 total_size = 0;
+  for (const DataEntry& data_entry : data_entries)
+  {
+    Region& region = regions.emplace_back();
+    if (data_entry.is_partition)
+    {
+      const PartitionEntry& partition_entry = partition_entries[data_entry.index];
+      const PartitionDataEntry& partition_data_entry =
+          partition_entry.data_entries[data_entry.partition_data_index];
+      region.offset =
+          Common::swap32(partition_data_entry.first_sector) * VolumeWii::BLOCK_TOTAL_SIZE;
+      region.size =
+          Common::swap32(partition_data_entry.number_of_sectors) * VolumeWii::BLOCK_TOTAL_SIZE;
+      region.partition_entry = &partition_entry;
+    }
+    else
+    {
+      const RawDataEntry& raw_data_entry = raw_data_entries[data_entry.index];
+      region.offset = Common::swap64(raw_data_entry.data_offset);
+      region.size = Common::swap64(raw_data_entry.data_size);
+      region.partition_entry = nullptr;
+    }
+    total_size += region.size;
+  }
+
+  if (total_size < NUMBER_OF_SAMPLES * VolumeWii::BLOCK_TOTAL_SIZE)
+    return {};
+
+  std::vector<u8> dictionary;
+  dictionary.reserve(NUMBER_OF_SAMPLES * SAMPLE_SIZE);
+
+  std::vector<u8> block(VolumeWii::BLOCK_TOTAL_SIZE);
+  std::vector<u8> block_data(VolumeWii::BLOCK_DATA_SIZE);
+  const u64 step = total_size / NUMBER_OF_SAMPLES;
+  auto region = regions.cbegin();
+  u64 region_start = 0;
+  for (u64 i = 0; i < NUMBER_OF_SAMPLES; ++i)
+  {
+    const u64 position = i * step + step / 2;
+    while (position >= region_start + region->size)
+      region_start += (region++)->size;
+
+    const u64 offset_in_region = position - region_start;
+    const u8* sample;
+    if (region->partition_entry)
+    {
+      const u64 block_offset = Common::AlignDown(offset_in_region, VolumeWii::BLOCK_TOTAL_SIZE);
+      if (!infile->Read(region->offset + block_offset, block.size(), block.data()))
+        return {};
+
+      auto aes_context =
+          Common::AES::CreateContextDecrypt(region->partition_entry->partition_key.data());
+      VolumeWii::DecryptBlockData(block.data(), block_data.data(), aes_context.get());
+      sample = block_data.data();
+    }
+    else
+    {
+      if (region->size < SAMPLE_SIZE)
+        continue;
+
+      const u64 sample_offset = std::min(offset_in_region, region->size - SAMPLE_SIZE);
+      if (!infile->Read(region->offset + sample_offset, SAMPLE_SIZE, block.data()))
+        return {};
+      sample = block.data();
+    }
+
+    // Padding compresses well without any help
+    if (AllSame(sample, sample + SAMPLE_SIZE))
+      continue;
+
+    dictionary.insert(dictionary.end(), sample, sample + SAMPLE_SIZE);
+  }
+
+  // Zstandard would try to parse a dictionary which starts with its dictionary magic as a
+  // structured dictionary instead of using it as raw content
+  if (dictionary.size() >= 4 &&
+      static_cast<u32>(dictionary[0] | dictionary[1] << 8 | dictionary[2] << 16 |
+                       dictionary[3] << 24) == ZSTD_MAGIC_DICTIONARY)
+  {
+    dictionary.erase(dictionary.begin(), dictionary.begin() + 4);
+  }
+
+  return dictionary;
+}
+
 template <typename OutputParametersEntry>
 static void RVZPack(const u8* in, OutputParametersEntry* out, u64 bytes_per_chunk, size_t chunks,
                     u64 total_size, u64 data_offset, bool multipart, bool allow_junk_reuse,
@@ -1729,7 +2218,8 @@ template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::IOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, bool zstd_dictionary,
+                               int threads, CompressCB callback)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
   ASSERT(chunk_size > 0);
@@ -1796,6 +2286,21 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   outfile->WriteBytes(buffer.data(), buffer.size());
   bytes_written = headers_size_upper_bound;
 
+  std::vector<u8> dictionary;
+  u64 dictionary_offset = 0;
+  if (RVZ && zstd_dictionary && compression_type == WIARVZCompressionType::Zstd)
+  {
+    dictionary = BuildZstdDictionary(infile, partition_entries, raw_data_entries, data_entries);
+
+    // The dictionary is stored right after the space reserved for the headers.
+    dictionary_offset = bytes_written;
+    if (!outfile->WriteBytes(dictionary.data(), dictionary.size()))
+      return ConversionResultCode::WriteFailed;
+    bytes_written += dictionary.size();
+    if (!PadTo4(outfile, &bytes_written))
+      return ConversionResultCode::WriteFailed;
+  }
+
   if (!infile->Read(0, header_2.disc_header.size(), header_2.disc_header.data()))
     return ConversionResultCode::ReadFailed;
   // We intentially do not increment bytes_read here, since these bytes will be read again
@@ -1804,7 +2309,8 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   std::mutex reusable_groups_mutex;
 
   const auto set_up_compress_thread_state = [&](CompressThreadState* state) {
-    SetUpCompressor(&state->compressor, compression_type, compression_level, nullptr);
+    SetUpCompressor(&state->compressor, compression_type, compression_level, chunk_size,
+                    dictionary, nullptr);
     return ConversionResultCode::Success;
   };
 
@@ -1835,7 +2341,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> mt_compressor(
-      set_up_compress_thread_state, process_and_compress, output);
+      set_up_compress_thread_state, process_and_compress, output, threads);
 
   for (const DataEntry& data_entry : data_entries)
   {
@@ -1933,7 +2439,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
     return status;
 
   std::unique_ptr<Compressor> compressor;
-  SetUpCompressor(&compressor, compression_type, compression_level, &header_2);
+  SetUpCompressor(&compressor, compression_type, compression_level, 0, dictionary, &header_2);
 
   const std::optional<std::vector<u8>> compressed_raw_data_entries = Compress(
       compressor.get(), reinterpret_cast<u8*>(raw_data_entries.data()), raw_data_entries_size);
@@ -2001,10 +2507,23 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   header_2.group_entries_offset = Common::swap64(group_entries_offset);
   header_2.group_entries_size = Common::swap32(static_cast<u32>(compressed_group_entries->size()));
 
+  if (!dictionary.empty())
+  {
+    const u32 dictionary_off4 = Common::swap32(static_cast<u32>(dictionary_offset >> 2));
+    std::memcpy(header_2.compressor_data, &dictionary_off4, sizeof(dictionary_off4));
+    header_2.compressor_data[4] = static_cast<u8>(dictionary.size() >> 16);
+    header_2.compressor_data[5] = static_cast<u8>(dictionary.size() >> 8);
+    header_2.compressor_data[6] = static_cast<u8>(dictionary.size());
+    header_2.compressor_data_size = sizeof(header_2.compressor_data);
+  }
+
   header_1.magic = RVZ ? RVZ_MAGIC : WIA_MAGIC;
   header_1.version = Common::swap32(RVZ ? RVZ_VERSION : WIA_VERSION);
-  header_1.version_compatible =
-      Common::swap32(RVZ ? RVZ_VERSION_WRITE_COMPATIBLE : WIA_VERSION_WRITE_COMPATIBLE);
+  if (!dictionary.empty())
+    header_1.version_compatible = Common::swap32(RVZ_VERSION_WRITE_COMPATIBLE_ZSTD_DICTIONARY);
+  else
+    header_1.version_compatible =
+        Common::swap32(RVZ ? RVZ_VERSION_WRITE_COMPATIBLE : WIA_VERSION_WRITE_COMPATIBLE);
   header_1.header_2_size = Common::swap32(sizeof(WIAHeader2));
   header_1.header_2_hash =
       Common::SHA1::CalculateDigest(reinterpret_cast<const u8*>(&header_2), sizeof(header_2));
@@ -2027,7 +2546,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback)
+                       int chunk_size, bool zstd_dictionary, int threads, CompressCB callback)
 {
   File::IOFile outfile(outfile_path, "wb");
   if (!outfile)
@@ -2045,7 +2564,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, zstd_dictionary, threads, callback);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
@@ -4,10 +4,13 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -15,6 +18,7 @@
 #include "Common/Crypto/SHA1.h"
 #include "Common/IOFile.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -65,10 +69,13 @@ public:
   bool Read(u64 offset, u64 size, u8* out_ptr) override;
   bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override;
   bool ReadWiiDecrypted(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset) override;
+  void Prefetch(u64 offset, u64 size) override;
+  void PrefetchWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) override;
 
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
-                                      int compression_level, int chunk_size, CompressCB callback);
+                                      int compression_level, int chunk_size, bool zstd_dictionary,
+                                      int threads, CompressCB callback);
 
 private:
   using WiiKey = std::array<u8, 16>;
@@ -192,6 +199,12 @@ private:
           u64 data_offset, std::unique_ptr<Decompressor> decompressor);
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
+    bool DecompressAll();
+
+    // Only valid once the chunk has been fully decompressed, or before anything has been read.
+    void SetFile(File::IOFile* file) { m_file = file; }
+
+    size_t GetMemoryUsage() const { return m_in.data.size() + m_out.data.size(); }
 
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
@@ -204,6 +217,7 @@ private:
     }
 
   private:
+    bool DecompressUntil(u64 end);
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
                           size_t* bytes_used, bool align);
@@ -233,12 +247,55 @@ private:
 
   const PartitionEntry* GetPartition(u64 partition_data_offset, u32* partition_first_sector) const;
 
+  struct CachedChunk
+  {
+    u64 offset_in_file;
+    Chunk chunk;
+    bool success = false;  // Only used for readahead
+  };
+
+  struct GroupChunkInfo
+  {
+    u64 offset_in_file;
+    u32 compressed_size;  // Zero if the group is all zeroes
+    u64 decompressed_size;
+    WIARVZCompressionType compression_type;
+    u32 rvz_packed_size;
+    u64 offset_in_data;
+  };
+
+  struct DecodeThread
+  {
+    File::IOFile file;
+    Common::WorkQueueThread<CachedChunk*> worker;
+  };
+
+  bool GetGroupChunkInfo(u64 total_group_index, u64 group_offset_in_data, u64 chunk_size,
+                         u64 data_size, GroupChunkInfo* info) const;
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
+  void DecodeGroupsInParallel(u64 offset, u64 size, u64 chunk_size, u64 data_offset,
+                              u64 data_size, u32 group_index, u32 number_of_groups,
+                              u32 exception_lists);
+  bool CreateDecodeThreads();
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  Chunk CreateChunk(File::IOFile* file, u64 offset_in_file, u64 compressed_size,
+                    u64 decompressed_size, WIARVZCompressionType compression_type,
+                    u32 exception_lists, u32 rvz_packed_size, u64 data_offset) const;
+
+  bool IsChunkCached(u64 offset_in_file) const;
+  void InsertCachedChunk(CachedChunk cached_chunk);
+  void EvictCachedChunk(u64 offset_in_file);
+
+  void StartReadahead(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
+                      WIARVZCompressionType compression_type, u32 exception_lists,
+                      u32 rvz_packed_size, u64 data_offset);
+  void FinishReadahead();
+  void PrefetchFromGroups(u64 offset, u64 chunk_size, u64 data_offset, u64 data_size,
+                          u32 group_index, u32 number_of_groups, u32 exception_lists);
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -342,7 +399,12 @@ private:
 
   static void SetUpCompressor(std::unique_ptr<Compressor>* compressor,
                               WIARVZCompressionType compression_type, int compression_level,
+                              u64 chunk_size, const std::vector<u8>& zstd_dictionary,
                               WIAHeader2* header_2);
+  static std::vector<u8> BuildZstdDictionary(BlobReader* infile,
+                                             const std::vector<PartitionEntry>& partition_entries,
+                                             const std::vector<RawDataEntry>& raw_data_entries,
+                                             const std::vector<DataEntry>& data_entries);
   static bool TryReuse(std::map<ReuseID, GroupEntry>* reusable_groups,
                        std::mutex* reusable_groups_mutex, OutputParametersEntry* entry);
   static ConversionResult<OutputParameters>
@@ -363,10 +425,38 @@ private:
 
   bool m_valid;
   WIARVZCompressionType m_compression_type;
+  ZstdDictionary m_zstd_dictionary;
 
   File::IOFile m_file;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+  std::string m_path;
+
+  // Decompressed chunks, most recently used first. Reads which alternate between a few places on
+  // the disc (e.g. streamed audio and level data) would otherwise keep decompressing the same
+  // chunks over and over.
+  static constexpr size_t MAX_CHUNK_CACHE_SIZE = 32 * 1024 * 1024;
+  std::list<CachedChunk> m_chunk_cache;
+  size_t m_chunk_cache_size = 0;
+
+  // When reads move from one group to the next, the group after that is decompressed ahead of
+  // time on a worker thread, which reads through its own file handle.
+  u64 m_last_group_index = std::numeric_limits<u64>::max();
+  File::IOFile m_readahead_file;
+  std::unique_ptr<CachedChunk> m_readahead_chunk;
+  bool m_readahead_done = false;
+  std::mutex m_readahead_mutex;
+  std::condition_variable m_readahead_cv;
+  Common::WorkQueueThread<CachedChunk*> m_readahead_thread;
+
+  // Large reads which cover several groups decompress them on a small pool of threads, each with
+  // its own file handle, before copying the data out serially.
+  static constexpr size_t MAX_DECODE_THREADS = 4;
+  std::unique_ptr<DecodeThread[]> m_decode_threads;
+  size_t m_decode_thread_count = 0;
+  bool m_decode_threads_failed = false;
+  size_t m_decode_pending = 0;
+  std::mutex m_decode_mutex;
+  std::condition_variable m_decode_cv;
+
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
@@ -389,9 +479,11 @@ private:
   static constexpr u32 WIA_VERSION_WRITE_COMPATIBLE = 0x01000000;
   static constexpr u32 WIA_VERSION_READ_COMPATIBLE = 0x00080000;
 
-  static constexpr u32 RVZ_VERSION = 0x01000000;
+  static constexpr u32 RVZ_VERSION = 0x01010000;
   static constexpr u32 RVZ_VERSION_WRITE_COMPATIBLE = 0x00030000;
   static constexpr u32 RVZ_VERSION_READ_COMPATIBLE = 0x00030000;
+  // Files with a Zstandard dictionary can't be read by versions which predate dictionaries.
+  static constexpr u32 RVZ_VERSION_WRITE_COMPATIBLE_ZSTD_DICTIONARY = 0x01010000;
 };
 
 using WIAFileReader = WIARVZFileReader<false>;
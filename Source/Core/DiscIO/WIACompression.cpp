@@ -256,9 +256,27 @@ bool LZMADecompressor::Decompress(const DecompressionBuffer& in, DecompressionBu
   return result == LZMA_OK || result == LZMA_STREAM_END;
 }
 
-ZstdDecompressor::ZstdDecompressor()
+ZstdDictionary CreateZstdDictionary(const std::vector<u8>& data)
+{
+  ZSTD_DDict* dictionary = ZSTD_createDDict(data.data(), data.size());
+  if (!dictionary)
+    return nullptr;
+
+  return ZstdDictionary(dictionary, [](const ZSTD_DDict* d) {
+    ZSTD_freeDDict(const_cast<ZSTD_DDict*>(d));
+  });
+}
+
+ZstdDecompressor::ZstdDecompressor(ZstdDictionary dictionary)
+    : m_dictionary(std::move(dictionary))
 {
   m_stream = ZSTD_createDStream();
+
+  if (m_stream && m_dictionary && ZSTD_isError(ZSTD_DCtx_refDDict(m_stream, m_dictionary.get())))
+  {
+    ZSTD_freeDStream(m_stream);
+    m_stream = nullptr;
+  }
 }
 
 ZstdDecompressor::~ZstdDecompressor()
@@ -733,12 +751,33 @@ size_t LZMACompressor::GetSize() const
   return static_cast<size_t>(m_stream.next_out - m_buffer.data());
 }
 
-ZstdCompressor::ZstdCompressor(int compression_level)
+ZstdCompressor::ZstdCompressor(int compression_level, u64 chunk_size,
+                               const std::vector<u8>& dictionary)
 {
   m_stream = ZSTD_createCStream();
 
   if (ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_compressionLevel, compression_level)) ||
       ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_contentSizeFlag, 0)))
+  {
+    m_stream = nullptr;
+    return;
+  }
+
+  if (chunk_size >= LONG_DISTANCE_MATCHING_MIN_CHUNK_SIZE)
+  {
+    // Every chunk is a separate frame, so a window covering the chunk is all that's useful.
+    // Setting it explicitly also keeps the decompressor from allocating the default LDM window.
+    const int window_log = std::clamp(IntLog2(chunk_size - 1) + 1, 10, 27);
+    if (ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_enableLongDistanceMatching, 1)) ||
+        ZSTD_isError(ZSTD_CCtx_setParameter(m_stream, ZSTD_c_windowLog, window_log)))
+    {
+      m_stream = nullptr;
+      return;
+    }
+  }
+
+  if (!dictionary.empty() &&
+      ZSTD_isError(ZSTD_CCtx_loadDictionary(m_stream, dictionary.data(), dictionary.size())))
   {
     m_stream = nullptr;
   }
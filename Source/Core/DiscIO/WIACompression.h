@@ -102,10 +102,15 @@ private:
   bool m_error_occurred = false;
 };
 
+using ZstdDictionary = std::shared_ptr<const ZSTD_DDict>;
+
+// Returns nullptr if the dictionary couldn't be loaded.
+ZstdDictionary CreateZstdDictionary(const std::vector<u8>& data);
+
 class ZstdDecompressor final : public Decompressor
 {
 public:
-  ZstdDecompressor();
+  explicit ZstdDecompressor(ZstdDictionary dictionary = nullptr);
   ~ZstdDecompressor();
 
   bool Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
@@ -113,6 +118,7 @@ public:
 
 private:
   ZSTD_DStream* m_stream;
+  ZstdDictionary m_dictionary;
 };
 
 class RVZPackDecompressor final : public Decompressor
@@ -228,7 +234,11 @@ private:
 class ZstdCompressor final : public Compressor
 {
 public:
-  ZstdCompressor(int compression_level);
+  // Chunks of at least this size are compressed with long distance matching.
+  static constexpr u64 LONG_DISTANCE_MATCHING_MIN_CHUNK_SIZE = 0x100000;
+
+  // dictionary may be empty. chunk_size may be 0 if it isn't known.
+  ZstdCompressor(int compression_level, u64 chunk_size, const std::vector<u8>& dictionary);
   ~ZstdCompressor();
 
   bool Start(std::optional<u64> size) override;
@@ -33,7 +33,7 @@ public:
   WiiEncryptionCache(const WiiEncryptionCache&) = delete;
   WiiEncryptionCache& operator=(const WiiEncryptionCache&) = delete;
 
-  // Encrypts exactly one group.
+  // Encrypts exactly one group, or returns it from the cache of recently encrypted groups.
   // If the returned pointer is nullptr, reading from the blob failed.
   // If the returned pointer is not nullptr, it is guaranteed to be valid until
   // the next call of this function or the destruction of this object.
@@ -48,9 +48,20 @@ public:
                      const HashExceptionCallback& hash_exception_callback = {});
 
 private:
+  // Games often go back and forth between a few files (streamed audio alongside level data, for
+  // instance), and every cache miss means hashing and encrypting a full 2 MiB group again.
+  static constexpr size_t CACHED_GROUPS = 4;
+
+  struct CachedGroup
+  {
+    std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> data;
+    u64 offset = std::numeric_limits<u64>::max();
+    u64 last_used = 0;
+  };
+
   BlobReader* m_blob;
-  std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> m_cache;
-  u64 m_cached_offset = 0;
+  std::array<CachedGroup, CACHED_GROUPS> m_cache;
+  u64 m_use_counter = 0;
 };
 
 }  // namespace DiscIO
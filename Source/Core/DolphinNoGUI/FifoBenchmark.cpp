@@ -0,0 +1,255 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/FifoBenchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+#include <optional>
+#include <utility>
+
+#include <picojson.h>
+
+#include "AudioCommon/AudioCommon.h"
+#include "Common/Config/Config.h"
+#include "Common/IOFile.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "VideoCommon/Statistics.h"
+
+namespace FifoBenchmark
+{
+using Clock = std::chrono::steady_clock;
+
+static std::string s_path;
+static u32 s_loops = 1;
+static std::function<void()> s_on_finished;
+
+// Only accessed on the CPU thread while the benchmark is running.
+static u32 s_loops_started = 0;
+static bool s_finished = false;
+static Clock::time_point s_measure_start;
+static Clock::time_point s_measure_end;
+static Clock::time_point s_last_frame_written;
+static std::vector<double> s_cpu_frame_times;
+static int s_pipelines_first_loop = 0;
+static int s_uber_pipelines_first_loop = 0;
+static int s_pipelines_total = 0;
+static int s_uber_pipelines_total = 0;
+
+// Only accessed on the GPU thread while the benchmark is running.
+static std::optional<Clock::time_point> s_last_present;
+static std::vector<double> s_gpu_frame_times;
+
+// Whether the frames currently being played count towards the frame times. This is set by the CPU
+// thread, so in dual core the GPU thread can assign a frame or two to the wrong loop.
+static std::atomic<bool> s_measuring = false;
+// The pipeline counters as of the last presented frame, published by the GPU thread.
+static std::atomic<int> s_pipelines = 0;
+static std::atomic<int> s_uber_pipelines = 0;
+
+void ApplyConfig()
+{
+  Config::SetCurrent(Config::MAIN_AUDIO_BACKEND, BACKEND_NULLSOUND);
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+  Config::SetCurrent(Config::GFX_VSYNC, false);
+}
+
+static double ToMilliseconds(Clock::duration duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+static void OnFrameWritten()
+{
+  if (s_finished)
+    return;
+
+  const Clock::time_point now = Clock::now();
+  const FifoPlayer& player = FifoPlayer::GetInstance();
+  if (player.GetCurrentFrameNum() == player.GetFrameRangeStart())
+  {
+    ++s_loops_started;
+    if (s_loops_started == 2)
+    {
+      s_pipelines_first_loop = s_pipelines.load(std::memory_order_relaxed);
+      s_uber_pipelines_first_loop = s_uber_pipelines.load(std::memory_order_relaxed);
+    }
+
+    if (s_loops_started > s_loops)
+    {
+      s_cpu_frame_times.push_back(ToMilliseconds(now - s_last_frame_written));
+      s_measuring.store(false, std::memory_order_relaxed);
+      s_measure_end = now;
+      s_pipelines_total = s_pipelines.load(std::memory_order_relaxed);
+      s_uber_pipelines_total = s_uber_pipelines.load(std::memory_order_relaxed);
+      s_finished = true;
+      if (s_on_finished)
+        s_on_finished();
+      return;
+    }
+
+    const u32 first_measured_loop = s_loops > 1 ? 2 : 1;
+    if (s_loops_started == first_measured_loop)
+    {
+      s_measure_start = now;
+      s_last_frame_written = now;
+      s_measuring.store(true, std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  if (s_measuring.load(std::memory_order_relaxed))
+    s_cpu_frame_times.push_back(ToMilliseconds(now - s_last_frame_written));
+  s_last_frame_written = now;
+}
+
+static void OnFramePresented()
+{
+  const Clock::time_point now = Clock::now();
+  s_pipelines.store(g_stats.num_pipelines_created, std::memory_order_relaxed);
+  s_uber_pipelines.store(g_stats.num_uber_pipelines_created, std::memory_order_relaxed);
+
+  if (!s_measuring.load(std::memory_order_relaxed))
+  {
+    s_last_present.reset();
+    return;
+  }
+
+  if (s_last_present)
+    s_gpu_frame_times.push_back(ToMilliseconds(now - *s_last_present));
+  s_last_present = now;
+}
+
+static FrameTimeStats ComputeStats(std::vector<double> frame_times)
+{
+  FrameTimeStats stats;
+  if (frame_times.empty())
+    return stats;
+
+  std::sort(frame_times.begin(), frame_times.end());
+  const auto percentile = [&frame_times](double p) {
+    const size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * frame_times.size()));
+    return frame_times[std::clamp<size_t>(rank, 1, frame_times.size()) - 1];
+  };
+
+  stats.mean_ms =
+      std::accumulate(frame_times.begin(), frame_times.end(), 0.0) / frame_times.size();
+  stats.p50_ms = percentile(50);
+  stats.p90_ms = percentile(90);
+  stats.p99_ms = percentile(99);
+  stats.max_ms = frame_times.back();
+  return stats;
+}
+
+void Start(const std::string& path, u32 loops, std::function<void()> on_finished)
+{
+  s_path = path;
+  s_loops = loops != 0 ? loops : 1;
+  s_on_finished = std::move(on_finished);
+
+  s_loops_started = 0;
+  s_finished = false;
+  s_cpu_frame_times.clear();
+  s_gpu_frame_times.clear();
+  s_last_present.reset();
+  s_pipelines_first_loop = 0;
+  s_uber_pipelines_first_loop = 0;
+  s_pipelines_total = 0;
+  s_uber_pipelines_total = 0;
+  s_measuring = false;
+  s_pipelines = 0;
+  s_uber_pipelines = 0;
+
+  FifoPlayer::GetInstance().SetFrameWrittenCallback(OnFrameWritten);
+  Core::SetFramePresentedCallback(OnFramePresented);
+}
+
+Result Stop()
+{
+  FifoPlayer::GetInstance().SetFrameWrittenCallback(nullptr);
+  Core::SetFramePresentedCallback(nullptr);
+  s_on_finished = nullptr;
+  s_measuring = false;
+
+  Result result;
+  result.path = s_path;
+  result.completed = s_finished;
+  result.frames = s_cpu_frame_times.size();
+  if (s_finished)
+    result.seconds = std::chrono::duration<double>(s_measure_end - s_measure_start).count();
+  result.cpu_frame_time = ComputeStats(std::move(s_cpu_frame_times));
+  result.gpu_frame_time = ComputeStats(std::move(s_gpu_frame_times));
+  // With a single loop, everything is compiled during the first loop.
+  result.pipelines_total = s_pipelines_total;
+  result.uber_pipelines_total = s_uber_pipelines_total;
+  result.pipelines_first_loop = s_loops > 1 ? s_pipelines_first_loop : s_pipelines_total;
+  result.uber_pipelines_first_loop =
+      s_loops > 1 ? s_uber_pipelines_first_loop : s_uber_pipelines_total;
+
+  s_cpu_frame_times.clear();
+  s_gpu_frame_times.clear();
+  return result;
+}
+
+static picojson::value StatsToJSON(const FrameTimeStats& stats)
+{
+  picojson::object object;
+  object.emplace("mean", picojson::value(stats.mean_ms));
+  object.emplace("p50", picojson::value(stats.p50_ms));
+  object.emplace("p90", picojson::value(stats.p90_ms));
+  object.emplace("p99", picojson::value(stats.p99_ms));
+  object.emplace("max", picojson::value(stats.max_ms));
+  return picojson::value(std::move(object));
+}
+
+static picojson::value PipelinesToJSON(int first_loop, int total)
+{
+  picojson::object object;
+  object.emplace("first_loop", picojson::value(static_cast<double>(first_loop)));
+  object.emplace("total", picojson::value(static_cast<double>(total)));
+  return picojson::value(std::move(object));
+}
+
+bool WriteResults(const std::string& output_path, u32 loops, const std::vector<Result>& results)
+{
+  picojson::array files;
+  for (const Result& result : results)
+  {
+    picojson::object file;
+    file.emplace("path", picojson::value(result.path));
+    file.emplace("completed", picojson::value(result.completed));
+    file.emplace("frames", picojson::value(static_cast<double>(result.frames)));
+    file.emplace("seconds", picojson::value(result.seconds));
+    file.emplace("cpu_frame_time_ms", StatsToJSON(result.cpu_frame_time));
+    file.emplace("gpu_frame_time_ms", StatsToJSON(result.gpu_frame_time));
+    file.emplace("pipelines_compiled",
+                 PipelinesToJSON(result.pipelines_first_loop, result.pipelines_total));
+    file.emplace("uber_pipelines_compiled",
+                 PipelinesToJSON(result.uber_pipelines_first_loop, result.uber_pipelines_total));
+    files.emplace_back(std::move(file));
+  }
+
+  picojson::object root;
+  root.emplace("backend", picojson::value(Config::Get(Config::MAIN_GFX_BACKEND)));
+  root.emplace("loops", picojson::value(static_cast<double>(loops)));
+  root.emplace("results", picojson::value(std::move(files)));
+  const std::string json = picojson::value(std::move(root)).serialize(true);
+
+  if (output_path.empty())
+  {
+    std::fputs(json.c_str(), stdout);
+    return true;
+  }
+
+  File::IOFile file(output_path, "w");
+  return file.WriteString(json);
+}
+}  // namespace FifoBenchmark
@@ -0,0 +1,56 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// Replays FIFO logs unthrottled and measures how long the frames take, so that the performance of
+// the video backends can be compared between builds without depending on any game's CPU code.
+namespace FifoBenchmark
+{
+struct FrameTimeStats
+{
+  double mean_ms = 0;
+  double p50_ms = 0;
+  double p90_ms = 0;
+  double p99_ms = 0;
+  double max_ms = 0;
+};
+
+struct Result
+{
+  std::string path;
+  // false if the playback was stopped before all loops were played.
+  bool completed = false;
+  u64 frames = 0;
+  double seconds = 0;
+  // Time between the FIFO player writing two frames, on the CPU thread.
+  FrameTimeStats cpu_frame_time;
+  // Time between two frames being presented, on the GPU thread.
+  FrameTimeStats gpu_frame_time;
+  // Pipelines compiled during the first loop, and during the whole run.
+  int pipelines_first_loop = 0;
+  int pipelines_total = 0;
+  int uber_pipelines_first_loop = 0;
+  int uber_pipelines_total = 0;
+};
+
+// Sets up the config for benchmarking. Must be called before booting.
+void ApplyConfig();
+
+// Starts measuring the FIFO log at path, which is about to be booted. The log is played loops
+// times, and on_finished is called on the CPU thread after that. If there is more than one loop,
+// the first one is a warm-up which is not included in the frame times, since that is where most
+// pipelines get compiled.
+void Start(const std::string& path, u32 loops, std::function<void()> on_finished);
+// Must be called after the emulation has been shut down.
+Result Stop();
+
+// Writes the results as JSON to output_path, or to stdout if it is empty.
+bool WriteResults(const std::string& output_path, u32 loops, const std::vector<Result>& results);
+}  // namespace FifoBenchmark
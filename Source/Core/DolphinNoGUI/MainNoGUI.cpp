@@ -4,11 +4,13 @@
 #include "DolphinNoGUI/Platform.h"
 
 #include <OptionParser.h>
+#include <chrono>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
 #include <signal.h>
 #include <string>
+#include <variant>
 #include <vector>
 
 #ifndef _WIN32
@@ -24,6 +26,12 @@
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
+
+#include "DolphinNoGUI/FifoBenchmark.h"
+#include "DolphinNoGUI/MinimalBoot.h"
+#include "DolphinNoGUI/MovieVerifier.h"
+#include "DolphinNoGUI/StateBenchmark.h"
 
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
@@ -37,6 +45,8 @@
 #include "VideoCommon/VideoBackendBase.h"
 
 static std::unique_ptr<Platform> s_platform;
+// The headless platform prints the title to the standard output, where the results go by default.
+static bool s_is_benchmarking = false;
 
 static void signal_handler(int)
 {
@@ -79,7 +89,8 @@ void Host_Message(HostMessageID id)
 
 void Host_UpdateTitle(const std::string& title)
 {
-  s_platform->SetTitle(title);
+  if (!s_is_benchmarking)
+    s_platform->SetTitle(title);
 }
 
 void Host_UpdateDisasmDialog()
@@ -155,6 +166,13 @@ static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
 {
   std::string platform_name = static_cast<const char*>(options.get("platform"));
 
+  // Movie verification, benchmarking and minimal boots have no use for a window.
+  if (platform_name.empty() && (options.get("verify_movie") || options.get("fifo_benchmark") ||
+                                options.get("minimal_boot")))
+  {
+    platform_name = "headless";
+  }
+
 #if HAVE_X11
   if (platform_name == "x11" || platform_name.empty())
     return Platform::CreateX11Platform();
@@ -176,12 +194,62 @@ static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
   return nullptr;
 }
 
+static int RunFifoBenchmark(const std::vector<std::string>& paths, const optparse::Values& options,
+                            const WindowSystemInfo& wsi)
+{
+  const u32 loops = static_cast<int>(options.get("benchmark_loops"));
+  FifoBenchmark::ApplyConfig();
+
+  // Each FIFO log is booted separately, so they don't share any shaders or pipelines.
+  std::vector<FifoBenchmark::Result> results;
+  for (const std::string& path : paths)
+  {
+    std::unique_ptr<BootParameters> boot = BootParameters::GenerateFromFile(path);
+    if (!boot || !std::holds_alternative<BootParameters::DFF>(boot->parameters))
+    {
+      fprintf(stderr, "%s is not a FIFO log\n", path.c_str());
+      return 1;
+    }
+
+    FifoBenchmark::Start(path, loops, [] { s_platform->Stop(); });
+    s_platform->ResetRunningFlag();
+    if (!BootManager::BootCore(std::move(boot), wsi))
+    {
+      FifoBenchmark::Stop();
+      fprintf(stderr, "Could not boot %s\n", path.c_str());
+      return 1;
+    }
+
+    s_platform->MainLoop();
+    Core::Stop();
+    Core::Shutdown();
+
+    results.push_back(FifoBenchmark::Stop());
+    if (!results.back().completed)
+    {
+      fprintf(stderr, "The benchmark was stopped before %s finished playing\n", path.c_str());
+      break;
+    }
+  }
+
+  if (!FifoBenchmark::WriteResults(static_cast<const char*>(options.get("benchmark_output")),
+                                   loops, results))
+  {
+    fprintf(stderr, "Could not write the benchmark results\n");
+    return 1;
+  }
+
+  return results.size() == paths.size() && results.back().completed ? 0 : 1;
+}
+
 #ifdef _WIN32
 #define main app_main
 #endif
 
 int main(int argc, char* argv[])
 {
+  const auto start_time = std::chrono::steady_clock::now();
+
   auto parser = CommandLineParse::CreateParser(CommandLineParse::ParserOptions::OmitGUIOptions);
   parser->add_option("-p", "--platform")
       .action("store")
@@ -201,6 +269,46 @@ int main(int argc, char* argv[])
             "win32"
 #endif
       });
+  parser->add_option("--verify_movie")
+      .action("store_true")
+      .help("Play the movie given with --movie as fast as possible without video or audio output, "
+            "and write hashes of the emulated RAM and XFB for comparing runs");
+  parser->add_option("--hash_output")
+      .action("store")
+      .help("File to write movie verification hashes to (default: standard output)");
+  parser->add_option("--hash_interval")
+      .action("store")
+      .type("int")
+      .set_default(1)
+      .help("Number of frames between movie verification hashes (default: %default)");
+  parser->add_option("--fifo_benchmark")
+      .action("store_true")
+      .help("Play each of the given FIFO logs unthrottled with the selected video backend, and "
+            "write frame time percentiles and pipeline compile counts as JSON");
+  parser->add_option("--benchmark_loops")
+      .action("store")
+      .type("int")
+      .set_default(3)
+      .help("Number of times each FIFO log is played when benchmarking. The first of several "
+            "loops is a warm-up which is not included in the frame times (default: %default)");
+  parser->add_option("--state_benchmark")
+      .action("store_true")
+      .help("Boot the given game, optionally into the state given with --save_state, then save "
+            "and load states to memory and to a file repeatedly, and write the save and load time "
+            "percentiles as JSON");
+  parser->add_option("--state_cycles")
+      .action("store")
+      .type("int")
+      .set_default(10)
+      .help("Number of save/load cycles of each kind when benchmarking states (default: %default)");
+  parser->add_option("--benchmark_output")
+      .action("store")
+      .help("File to write the benchmark results to (default: standard output)");
+  parser->add_option("--minimal_boot")
+      .action("store_true")
+      .help("Skip host input, hotkeys, on-screen messages, analytics and audio output, use the "
+            "Null video backend unless one is given with --video_backend, and write the time "
+            "to the first frame to standard error");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -211,9 +319,25 @@ int main(int argc, char* argv[])
     save_state_path = static_cast<const char*>(options.get("save_state"));
   }
 
+  const bool fifo_benchmark = options.get("fifo_benchmark");
+  std::vector<std::string> benchmark_paths;
   std::unique_ptr<BootParameters> boot;
   bool game_specified = false;
-  if (options.is_set("exec"))
+  if (fifo_benchmark)
+  {
+    if (options.is_set("exec"))
+    {
+      const std::list<std::string> paths_list = options.all("exec");
+      benchmark_paths.assign(paths_list.begin(), paths_list.end());
+    }
+    benchmark_paths.insert(benchmark_paths.end(), args.begin(), args.end());
+    if (benchmark_paths.empty())
+    {
+      fprintf(stderr, "No FIFO logs to benchmark were specified.\n");
+      return 1;
+    }
+  }
+  else if (options.is_set("exec"))
   {
     const std::list<std::string> paths_list = options.all("exec");
     const std::vector<std::string> paths{std::make_move_iterator(std::begin(paths_list)),
@@ -247,6 +371,25 @@ int main(int argc, char* argv[])
     return 0;
   }
 
+  const bool verify_movie = options.get("verify_movie");
+  if (verify_movie && !options.is_set("movie"))
+  {
+    fprintf(stderr, "Movie verification requires a movie to be specified with --movie.\n");
+    return 1;
+  }
+  if (fifo_benchmark && options.is_set("movie"))
+  {
+    fprintf(stderr, "A movie cannot be played when benchmarking FIFO logs.\n");
+    return 1;
+  }
+  const bool state_benchmark = options.get("state_benchmark");
+  if (state_benchmark && (fifo_benchmark || verify_movie || !game_specified))
+  {
+    fprintf(stderr, "Benchmarking states requires a game to be specified, and cannot be combined "
+                    "with FIFO log benchmarks or movie verification.\n");
+    return 1;
+  }
+
   std::string user_directory;
   if (options.is_set("user"))
     user_directory = static_cast<const char*>(options.get("user"));
@@ -260,9 +403,13 @@ int main(int argc, char* argv[])
 
   const WindowSystemInfo wsi = s_platform->GetWindowSystemInfo();
 
+  const bool minimal_boot = options.get("minimal_boot");
   UICommon::SetUserDirectory(user_directory);
   UICommon::Init();
-  UICommon::InitControllers(wsi);
+  if (minimal_boot)
+    UICommon::InitEmulatedControllers();
+  else
+    UICommon::InitControllers(wsi);
 
   Common::ScopeGuard ui_common_guard([] {
     UICommon::ShutdownControllers();
@@ -275,6 +422,40 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  if (options.is_set("movie"))
+  {
+    std::optional<std::string> movie_savestate_path;
+    if (!Movie::PlayInput(static_cast<const char*>(options.get("movie")), &movie_savestate_path))
+    {
+      fprintf(stderr, "Could not play the specified movie\n");
+      return 1;
+    }
+    boot->boot_session_data.SetSavestateData(std::move(movie_savestate_path),
+                                             DeleteSavestateAfterBoot::No);
+  }
+
+  if (minimal_boot)
+  {
+    const std::string video_backend = static_cast<const char*>(options.get("video_backend"));
+    MinimalBoot::ApplyConfig(!video_backend.empty());
+  }
+
+  if (verify_movie)
+  {
+    MovieVerifier::ApplyConfig();
+    if (!MovieVerifier::Start(static_cast<const char*>(options.get("hash_output")),
+                              static_cast<int>(options.get("hash_interval")),
+                              [] { s_platform->Stop(); }))
+    {
+      fprintf(stderr, "Could not open the movie verification hash output\n");
+      return 1;
+    }
+  }
+  Common::ScopeGuard movie_verifier_guard([verify_movie] {
+    if (verify_movie)
+      MovieVerifier::Stop();
+  });
+
   Core::AddOnStateChangedCallback([](Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -293,24 +474,61 @@ int main(int argc, char* argv[])
   sigaction(SIGTERM, &sa, nullptr);
 #endif
 
-  DolphinAnalytics::Instance().ReportDolphinStart("nogui");
+  if (!minimal_boot)
+    DolphinAnalytics::Instance().ReportDolphinStart("nogui");
+
+  if (fifo_benchmark)
+  {
+    s_is_benchmarking = true;
+    const int result = RunFifoBenchmark(benchmark_paths, options, wsi);
+    s_platform.reset();
+    return result;
+  }
+
+  // This isn't done when benchmarking, since the benchmark owns the frame presented callback.
+  const bool time_boot = minimal_boot && !state_benchmark;
+  if (time_boot)
+    MinimalBoot::Start(start_time);
+  Common::ScopeGuard minimal_boot_guard([time_boot] {
+    if (time_boot)
+      MinimalBoot::Stop();
+  });
+
+  if (state_benchmark)
+  {
+    s_is_benchmarking = true;
+    StateBenchmark::Start(static_cast<int>(options.get("state_cycles")),
+                          [] { s_platform->Stop(); });
+  }
 
   if (!BootManager::BootCore(std::move(boot), wsi))
   {
+    if (state_benchmark)
+      StateBenchmark::Finish();
     fprintf(stderr, "Could not boot the specified file\n");
     return 1;
   }
 
 #ifdef USE_DISCORD_PRESENCE
-  Discord::UpdateDiscordPresence();
+  if (!minimal_boot)
+    Discord::UpdateDiscordPresence();
 #endif
 
   s_platform->MainLoop();
+  if (state_benchmark)
+    StateBenchmark::Finish();
   Core::Stop();
 
   Core::Shutdown();
   s_platform.reset();
 
+  if (state_benchmark &&
+      !StateBenchmark::WriteResults(static_cast<const char*>(options.get("benchmark_output"))))
+  {
+    fprintf(stderr, "The state benchmark did not complete, or its results could not be written\n");
+    return 1;
+  }
+
   return 0;
 }
 
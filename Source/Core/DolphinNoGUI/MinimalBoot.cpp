@@ -0,0 +1,50 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/MinimalBoot.h"
+
+#include <atomic>
+
+#include "AudioCommon/AudioCommon.h"
+#include "Common/Config/Config.h"
+#include "Common/Logging/Log.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+
+namespace MinimalBoot
+{
+static std::chrono::steady_clock::time_point s_start_time;
+static std::atomic<bool> s_reported = false;
+
+void ApplyConfig(bool keep_video_backend)
+{
+  if (!keep_video_backend)
+    Config::SetCurrent(Config::MAIN_GFX_BACKEND, "Null");
+  Config::SetCurrent(Config::MAIN_AUDIO_BACKEND, BACKEND_NULLSOUND);
+  Config::SetCurrent(Config::MAIN_OSD_MESSAGES, false);
+  Config::SetCurrent(Config::MAIN_ANALYTICS_ENABLED, false);
+  Config::SetCurrent(Config::MAIN_WIIMOTE_CONTINUOUS_SCANNING, false);
+}
+
+static void OnFramePresented()
+{
+  if (s_reported.exchange(true, std::memory_order_relaxed))
+    return;
+
+  const auto elapsed = std::chrono::steady_clock::now() - s_start_time;
+  NOTICE_LOG_FMT(BOOT, "Time to first frame: {:.1f} ms",
+                 std::chrono::duration<double, std::milli>(elapsed).count());
+}
+
+void Start(std::chrono::steady_clock::time_point start_time)
+{
+  s_start_time = start_time;
+  s_reported.store(false, std::memory_order_relaxed);
+  Core::SetFramePresentedCallback(OnFramePresented);
+}
+
+void Stop()
+{
+  Core::SetFramePresentedCallback(nullptr);
+}
+}  // namespace MinimalBoot
@@ -0,0 +1,22 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+
+// Boots with only what is needed to emulate, for test farms that run many short headless sessions
+// and spend much of their time starting up. Host input, hotkeys, on-screen messages, analytics and
+// audio output are left out, and the time until the first frame is presented is reported.
+namespace MinimalBoot
+{
+// Sets up the config for a minimal boot. Must be called before booting. The Null video backend is
+// used unless keep_video_backend is set, so that a backend given on the command line can be
+// tested offscreen instead.
+void ApplyConfig(bool keep_video_backend);
+
+// Starts timing the boot from start_time. The time to the first frame is written to stderr on the
+// GPU thread once that frame has been presented.
+void Start(std::chrono::steady_clock::time_point start_time);
+void Stop();
+}  // namespace MinimalBoot
@@ -0,0 +1,117 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/MovieVerifier.h"
+
+#include <cstdio>
+#include <utility>
+
+#include <fmt/format.h>
+#include <xxhash.h>
+
+#include "AudioCommon/AudioCommon.h"
+#include "Common/Config/Config.h"
+#include "Common/IOFile.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/HW/Memmap.h"
+#include "Core/HW/VideoInterface.h"
+#include "Core/Movie.h"
+#include "Core/System.h"
+
+namespace MovieVerifier
+{
+static File::IOFile s_output_file;
+// Either the handle of s_output_file or stdout.
+static std::FILE* s_output = nullptr;
+static u32 s_interval = 1;
+static std::function<void()> s_on_finished;
+static bool s_finished = false;
+
+void ApplyConfig()
+{
+  // The Null backend doesn't render anything, so every frame is skipped as far as the host is
+  // concerned. The hashes are taken from emulated memory, which doesn't depend on the backend.
+  Config::SetCurrent(Config::MAIN_GFX_BACKEND, "Null");
+  Config::SetCurrent(Config::MAIN_AUDIO_BACKEND, BACKEND_NULLSOUND);
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  Config::SetCurrent(Config::MAIN_MOVIE_PAUSE_MOVIE, false);
+}
+
+static u64 HashXFB(Memory::MemoryManager& memory)
+{
+  // The XFB is always in MEM1, and only the address bits below 0x3FFFFFFF are decoded.
+  const u32 address = VideoInterface::GetXFBAddressTop() & 0x3FFFFFFF;
+  const u32 size = VideoInterface::GetXFBSize();
+  if (size == 0 || address >= memory.GetRamSizeReal() ||
+      size > memory.GetRamSizeReal() - address)
+  {
+    return 0;
+  }
+
+  return XXH3_64bits(memory.GetRAM() + address, size);
+}
+
+static void WriteHashes(u64 frame)
+{
+  auto& memory = Core::System::GetInstance().GetMemory();
+
+  u64 ram_hash = XXH3_64bits(memory.GetRAM(), memory.GetRamSizeReal());
+  if (memory.GetEXRAM())
+  {
+    const u64 exram_hash = XXH3_64bits(memory.GetEXRAM(), memory.GetExRamSizeReal());
+    ram_hash = XXH3_64bits_withSeed(&exram_hash, sizeof(exram_hash), ram_hash);
+  }
+
+  fmt::print(s_output, "{} {:016x} {:016x}\n", frame, ram_hash, HashXFB(memory));
+}
+
+static void OnFrame(u64 frame)
+{
+  if (s_finished)
+    return;
+
+  // Playback ends while polling the input of the frame before, or before the first frame for a
+  // movie without any input.
+  const bool is_last_frame = !Movie::IsPlayingInput() || frame >= Movie::GetTotalFrames();
+  if (is_last_frame || frame % s_interval == 0)
+    WriteHashes(frame);
+
+  if (is_last_frame)
+  {
+    s_finished = true;
+    std::fflush(s_output);
+    if (s_on_finished)
+      s_on_finished();
+  }
+}
+
+bool Start(const std::string& output_path, u32 interval, std::function<void()> on_finished)
+{
+  if (output_path.empty())
+  {
+    s_output = stdout;
+  }
+  else
+  {
+    if (!s_output_file.Open(output_path, "w"))
+      return false;
+    s_output = s_output_file.GetHandle();
+  }
+
+  s_interval = interval != 0 ? interval : 1;
+  s_on_finished = std::move(on_finished);
+  s_finished = false;
+
+  Movie::SetReadOnly(true);
+  Movie::SetFrameCallback(OnFrame);
+  return true;
+}
+
+void Stop()
+{
+  Movie::SetFrameCallback(nullptr);
+  s_output_file.Close();
+  s_output = nullptr;
+  s_on_finished = nullptr;
+}
+}  // namespace MovieVerifier
@@ -0,0 +1,23 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Plays a movie as fast as possible without rendering or audio output, and writes hashes of the
+// emulated RAM and XFB every few frames so that two runs of the same movie, for example before and
+// after a Dolphin update, can be compared to find where they desync.
+namespace MovieVerifier
+{
+// Sets up the config for verification. Must be called before booting.
+void ApplyConfig();
+
+// Starts writing hashes to output_path, or to stdout if it is empty, every interval frames and on
+// the last frame. on_finished is called on the CPU thread once the movie has ended.
+bool Start(const std::string& output_path, u32 interval, std::function<void()> on_finished);
+void Stop();
+}  // namespace MovieVerifier
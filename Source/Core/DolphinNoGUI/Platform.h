@@ -29,6 +29,8 @@ public:
 
   // Request an immediate shutdown.
   void Stop();
+  // Allows MainLoop to be run again after it returned because of Stop.
+  void ResetRunningFlag() { m_running.Set(); }
 
   static std::unique_ptr<Platform> CreateHeadlessPlatform();
 #ifdef HAVE_X11
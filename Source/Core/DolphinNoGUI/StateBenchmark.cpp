@@ -0,0 +1,205 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/StateBenchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <picojson.h>
+
+#include "Common/Event.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Thread.h"
+#include "Core/Core.h"
+#include "Core/State.h"
+
+namespace StateBenchmark
+{
+using Clock = std::chrono::steady_clock;
+
+// Gives the game some time to get going after booting or loading the initial state.
+constexpr u32 WARMUP_FRAMES = 60;
+
+struct TimeStats
+{
+  double mean_ms = 0;
+  double p50_ms = 0;
+  double p90_ms = 0;
+  double p99_ms = 0;
+  double max_ms = 0;
+};
+
+static u32 s_cycles = 1;
+static std::function<void()> s_on_finished;
+static std::thread s_thread;
+static Common::Event s_start_event;
+static std::atomic<bool> s_cancelled = false;
+
+// Only accessed on the GPU thread while the emulation is running.
+static u32 s_frames_presented = 0;
+
+// Written by the benchmark thread, and only read after it has been joined.
+static bool s_completed = false;
+static size_t s_state_size = 0;
+static std::vector<double> s_memory_save_times;
+static std::vector<double> s_memory_load_times;
+static std::vector<double> s_file_save_times;
+static std::vector<double> s_file_load_times;
+static u64 s_file_size = 0;
+
+static double ToMilliseconds(Clock::duration duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+template <typename F>
+static void Measure(std::vector<double>* times, F&& f)
+{
+  const Clock::time_point start = Clock::now();
+  f();
+  times->push_back(ToMilliseconds(Clock::now() - start));
+}
+
+static void OnFramePresented()
+{
+  if (++s_frames_presented == WARMUP_FRAMES)
+    s_start_event.Set();
+}
+
+static void BenchmarkThread()
+{
+  Common::SetCurrentThreadName("State benchmark");
+
+  s_start_event.Wait();
+  if (s_cancelled.load(std::memory_order_relaxed))
+    return;
+
+  std::vector<u8> buffer;
+  for (u32 i = 0; i < s_cycles && !s_cancelled.load(std::memory_order_relaxed); ++i)
+  {
+    Measure(&s_memory_save_times, [&buffer] { State::SaveToBuffer(buffer); });
+    Measure(&s_memory_load_times, [&buffer] { State::LoadFromBuffer(buffer); });
+  }
+  s_state_size = buffer.size();
+
+  // Loading a state file also saves the undo state, which is part of what a load costs.
+  const std::string path = File::GetUserPath(D_STATESAVES_IDX) + "StateBenchmark.sav";
+  for (u32 i = 0; i < s_cycles && !s_cancelled.load(std::memory_order_relaxed); ++i)
+  {
+    Measure(&s_file_save_times, [&path] { State::SaveAs(path, true); });
+    Measure(&s_file_load_times, [&path] { State::LoadAs(path); });
+  }
+  s_file_size = File::GetSize(path);
+  File::Delete(path);
+
+  if (s_cancelled.load(std::memory_order_relaxed))
+    return;
+
+  s_completed = true;
+  if (s_on_finished)
+    s_on_finished();
+}
+
+void Start(u32 cycles, std::function<void()> on_finished)
+{
+  s_cycles = cycles != 0 ? cycles : 1;
+  s_on_finished = std::move(on_finished);
+  s_cancelled = false;
+  s_frames_presented = 0;
+  s_completed = false;
+  s_state_size = 0;
+  s_file_size = 0;
+  s_memory_save_times.clear();
+  s_memory_load_times.clear();
+  s_file_save_times.clear();
+  s_file_load_times.clear();
+
+  s_start_event.Reset();
+  Core::SetFramePresentedCallback(OnFramePresented);
+  s_thread = std::thread(BenchmarkThread);
+}
+
+void Finish()
+{
+  if (!s_thread.joinable())
+    return;
+
+  // Does nothing if the benchmark has already finished.
+  s_cancelled = true;
+  s_start_event.Set();
+  s_thread.join();
+}
+
+static picojson::value StatsToJSON(std::vector<double> times)
+{
+  TimeStats stats;
+  if (!times.empty())
+  {
+    std::sort(times.begin(), times.end());
+    const auto percentile = [&times](double p) {
+      const size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * times.size()));
+      return times[std::clamp<size_t>(rank, 1, times.size()) - 1];
+    };
+
+    stats.mean_ms = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+    stats.p50_ms = percentile(50);
+    stats.p90_ms = percentile(90);
+    stats.p99_ms = percentile(99);
+    stats.max_ms = times.back();
+  }
+
+  picojson::object object;
+  object.emplace("mean", picojson::value(stats.mean_ms));
+  object.emplace("p50", picojson::value(stats.p50_ms));
+  object.emplace("p90", picojson::value(stats.p90_ms));
+  object.emplace("p99", picojson::value(stats.p99_ms));
+  object.emplace("max", picojson::value(stats.max_ms));
+  return picojson::value(std::move(object));
+}
+
+bool WriteResults(const std::string& output_path)
+{
+  Core::SetFramePresentedCallback(nullptr);
+  s_on_finished = nullptr;
+
+  picojson::object memory;
+  memory.emplace("state_size", picojson::value(static_cast<double>(s_state_size)));
+  memory.emplace("save_ms", StatsToJSON(std::move(s_memory_save_times)));
+  memory.emplace("load_ms", StatsToJSON(std::move(s_memory_load_times)));
+
+  picojson::object file;
+  file.emplace("file_size", picojson::value(static_cast<double>(s_file_size)));
+  file.emplace("save_ms", StatsToJSON(std::move(s_file_save_times)));
+  file.emplace("load_ms", StatsToJSON(std::move(s_file_load_times)));
+
+  picojson::object root;
+  root.emplace("completed", picojson::value(s_completed));
+  root.emplace("cycles", picojson::value(static_cast<double>(s_cycles)));
+  root.emplace("memory", picojson::value(std::move(memory)));
+  root.emplace("file", picojson::value(std::move(file)));
+  const std::string json = picojson::value(std::move(root)).serialize(true);
+
+  s_memory_save_times.clear();
+  s_memory_load_times.clear();
+  s_file_save_times.clear();
+  s_file_load_times.clear();
+
+  if (output_path.empty())
+  {
+    std::fputs(json.c_str(), stdout);
+    return s_completed;
+  }
+
+  File::IOFile output(output_path, "w");
+  return output.WriteString(json) && s_completed;
+}
+}  // namespace StateBenchmark
@@ -0,0 +1,25 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Saves and loads states of the booted game over and over, both to memory and to a file, and
+// measures how long each of those takes.
+namespace StateBenchmark
+{
+// Must be called before booting. Once the game has presented a few frames, the benchmark does
+// each kind of save and load cycles times on a thread of its own, and calls on_finished after that.
+void Start(u32 cycles, std::function<void()> on_finished);
+// Waits for the benchmark to finish, or cancels it if it hasn't started yet. Must be called before
+// the emulation is stopped.
+void Finish();
+// Must be called after the emulation has been shut down. Writes the results as JSON to
+// output_path, or to stdout if it is empty. Returns false if the benchmark didn't complete or the
+// results couldn't be written.
+bool WriteResults(const std::string& output_path);
+}  // namespace StateBenchmark
@@ -57,6 +57,9 @@ void AdvancedWidget::CreateWidgets()
   m_show_graphs = new GraphicsBool(tr("Show Performance Graphs"), Config::GFX_SHOW_GRAPHS);
   m_show_speed = new GraphicsBool(tr("Show % Speed"), Config::GFX_SHOW_SPEED);
   m_show_speed_colors = new GraphicsBool(tr("Show Speed Colors"), Config::GFX_SHOW_SPEED_COLORS);
+  m_show_tlb_stats = new GraphicsBool(tr("Show TLB Statistics"), Config::GFX_SHOW_TLB_STATS);
+  m_show_frame_breakdown =
+      new GraphicsBool(tr("Show Frame Time Breakdown"), Config::GFX_SHOW_FRAME_BREAKDOWN);
   m_perf_samp_window = new GraphicsInteger(0, 10000, Config::GFX_PERF_SAMP_WINDOW, 100);
   m_perf_samp_window->SetTitle(tr("Performance Sample Window (ms)"));
   m_log_render_time =
@@ -72,6 +75,8 @@ void AdvancedWidget::CreateWidgets()
   performance_layout->addWidget(m_perf_samp_window, 3, 1);
   performance_layout->addWidget(m_log_render_time, 4, 0);
   performance_layout->addWidget(m_show_speed_colors, 4, 1);
+  performance_layout->addWidget(m_show_tlb_stats, 5, 0);
+  performance_layout->addWidget(m_show_frame_breakdown, 5, 1);
 
   // Debugging
   auto* debugging_box = new QGroupBox(tr("Debugging"));
@@ -98,6 +103,10 @@ void AdvancedWidget::CreateWidgets()
   m_load_custom_textures = new GraphicsBool(tr("Load Custom Textures"), Config::GFX_HIRES_TEXTURES);
   m_prefetch_custom_textures =
       new GraphicsBool(tr("Prefetch Custom Textures"), Config::GFX_CACHE_HIRES_TEXTURES);
+  m_async_custom_textures =
+      new GraphicsBool(tr("Load Custom Textures Asynchronously"), Config::GFX_HIRES_TEXTURES_ASYNC);
+  m_compress_custom_textures =
+      new GraphicsBool(tr("Compress Custom Textures"), Config::GFX_HIRES_TEXTURES_COMPRESS);
   m_dump_efb_target = new GraphicsBool(tr("Dump EFB Target"), Config::GFX_DUMP_EFB_TARGET);
   m_dump_xfb_target = new GraphicsBool(tr("Dump XFB Target"), Config::GFX_DUMP_XFB_TARGET);
   m_disable_vram_copies =
@@ -113,6 +122,9 @@ void AdvancedWidget::CreateWidgets()
   utility_layout->addWidget(m_dump_efb_target, 2, 0);
   utility_layout->addWidget(m_dump_xfb_target, 2, 1);
 
+  utility_layout->addWidget(m_async_custom_textures, 3, 0);
+  utility_layout->addWidget(m_compress_custom_textures, 3, 1);
+
   // Texture dumping
   auto* texture_dump_box = new QGroupBox(tr("Texture Dumping"));
   auto* texture_dump_layout = new QGridLayout();
@@ -210,6 +222,8 @@ void AdvancedWidget::ConnectWidgets()
 void AdvancedWidget::LoadSettings()
 {
   m_prefetch_custom_textures->setEnabled(Config::Get(Config::GFX_HIRES_TEXTURES));
+  m_async_custom_textures->setEnabled(Config::Get(Config::GFX_HIRES_TEXTURES));
+  m_compress_custom_textures->setEnabled(Config::Get(Config::GFX_HIRES_TEXTURES));
   m_dump_bitrate->setEnabled(!Config::Get(Config::GFX_USE_FFV1));
 
   m_enable_prog_scan->setChecked(Config::Get(Config::SYSCONF_PROGRESSIVE_SCAN));
@@ -222,6 +236,8 @@ void AdvancedWidget::LoadSettings()
 void AdvancedWidget::SaveSettings()
 {
   m_prefetch_custom_textures->setEnabled(Config::Get(Config::GFX_HIRES_TEXTURES));
+  m_async_custom_textures->setEnabled(Config::Get(Config::GFX_HIRES_TEXTURES));
+  m_compress_custom_textures->setEnabled(Config::Get(Config::GFX_HIRES_TEXTURES));
   m_dump_bitrate->setEnabled(!Config::Get(Config::GFX_USE_FFV1));
 
   Config::SetBase(Config::SYSCONF_PROGRESSIVE_SCAN, m_enable_prog_scan->isChecked());
@@ -270,6 +286,18 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Shows the % speed of emulation compared to full speed."
                  "<br><br><dolphin_emphasis>If unsure, leave this "
                  "unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_TLB_STATS_DESCRIPTION[] =
+      QT_TR_NOOP("Shows how address translations through the page table were resolved: by each "
+                 "way of the emulated TLB, by the translation cache, or by walking the page "
+                 "table. Only relevant for games which use the MMU."
+                 "<br><br><dolphin_emphasis>If unsure, leave this "
+                 "unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_FRAME_BREAKDOWN_DESCRIPTION[] =
+      QT_TR_NOOP("Shows a graph of what the time of each frame was spent on: emulating the CPU, "
+                 "processing GPU commands, submitting work to the video backend, compiling "
+                 "shaders, waiting for the GPU thread or throttling to the target speed."
+                 "<br><br><dolphin_emphasis>If unsure, leave this "
+                 "unchecked.</dolphin_emphasis>");
   static const char TR_SHOW_SPEED_COLORS_DESCRIPTION[] =
       QT_TR_NOOP("Changes the color of the FPS counter depending on emulation speed."
                  "<br><br><dolphin_emphasis>If unsure, leave this "
@@ -321,6 +349,16 @@ void AdvancedWidget::AddDescriptions()
       "Caches custom textures to system RAM on startup.<br><br>This can require exponentially "
       "more RAM but fixes possible stuttering.<br><br><dolphin_emphasis>If unsure, leave this "
       "unchecked.</dolphin_emphasis>");
+  static const char TR_ASYNC_CUSTOM_TEXTURE_DESCRIPTION[] = QT_TR_NOOP(
+      "Loads custom textures on background threads, showing the original texture until the custom "
+      "one is ready.<br><br>Avoids stuttering when large custom textures are loaded for the first "
+      "time without having to prefetch the whole pack, but custom textures may briefly pop "
+      "in.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_COMPRESS_CUSTOM_TEXTURE_DESCRIPTION[] = QT_TR_NOOP(
+      "Compresses uncompressed custom textures to BC7 in the background and stores the result in "
+      "User/Cache/CustomTextures/, so that they use a quarter of the VRAM from the next time they "
+      "are loaded.<br><br>Only has an effect on backends which support BC7 "
+      "textures.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_DUMP_EFB_DESCRIPTION[] =
       QT_TR_NOOP("Dumps the contents of EFB copies to User/Dump/Textures/.<br><br>"
                  "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
@@ -362,9 +400,11 @@ void AdvancedWidget::AddDescriptions()
       "any issue with this.<br><br><dolphin_emphasis>If unsure, leave this "
       "unchecked.</dolphin_emphasis>");
   static const char TR_BACKEND_MULTITHREADING_DESCRIPTION[] =
-      QT_TR_NOOP("Enables multithreaded command submission in backends where supported. Enabling "
+      QT_TR_NOOP("Enables multithreaded command submission or presentation in backends where "
+                 "supported, and multithreaded rasterization in the software renderer. Enabling "
                  "this option may result in a performance improvement on systems with more than "
-                 "two CPU cores. Currently, this is limited to the Vulkan backend.<br><br>"
+                 "two CPU cores. Currently, this is limited to the Vulkan, D3D11, D3D12 and "
+                 "Software backends. D3D11 requires driver support for command lists.<br><br>"
                  "<dolphin_emphasis>If unsure, leave this checked.</dolphin_emphasis>");
   static const char TR_PREFER_VS_FOR_POINT_LINE_EXPANSION_DESCRIPTION[] =
       QT_TR_NOOP("On backends that support both using the geometry shader and the vertex shader "
@@ -413,6 +453,8 @@ void AdvancedWidget::AddDescriptions()
   m_show_speed->SetDescription(tr(TR_SHOW_SPEED_DESCRIPTION));
   m_log_render_time->SetDescription(tr(TR_LOG_RENDERTIME_DESCRIPTION));
   m_show_speed_colors->SetDescription(tr(TR_SHOW_SPEED_COLORS_DESCRIPTION));
+  m_show_tlb_stats->SetDescription(tr(TR_SHOW_TLB_STATS_DESCRIPTION));
+  m_show_frame_breakdown->SetDescription(tr(TR_SHOW_FRAME_BREAKDOWN_DESCRIPTION));
 
   m_enable_wireframe->SetDescription(tr(TR_WIREFRAME_DESCRIPTION));
   m_show_statistics->SetDescription(tr(TR_SHOW_STATS_DESCRIPTION));
@@ -424,6 +466,8 @@ void AdvancedWidget::AddDescriptions()
   m_dump_base_textures->SetDescription(tr(TR_DUMP_BASE_TEXTURE_DESCRIPTION));
   m_load_custom_textures->SetDescription(tr(TR_LOAD_CUSTOM_TEXTURE_DESCRIPTION));
   m_prefetch_custom_textures->SetDescription(tr(TR_CACHE_CUSTOM_TEXTURE_DESCRIPTION));
+  m_async_custom_textures->SetDescription(tr(TR_ASYNC_CUSTOM_TEXTURE_DESCRIPTION));
+  m_compress_custom_textures->SetDescription(tr(TR_COMPRESS_CUSTOM_TEXTURE_DESCRIPTION));
   m_dump_efb_target->SetDescription(tr(TR_DUMP_EFB_DESCRIPTION));
   m_dump_xfb_target->SetDescription(tr(TR_DUMP_XFB_DESCRIPTION));
   m_disable_vram_copies->SetDescription(tr(TR_DISABLE_VRAM_COPIES_DESCRIPTION));
@@ -42,11 +42,15 @@ private:
   GraphicsBool* m_show_graphs;
   GraphicsBool* m_show_speed;
   GraphicsBool* m_show_speed_colors;
+  GraphicsBool* m_show_tlb_stats;
+  GraphicsBool* m_show_frame_breakdown;
   GraphicsInteger* m_perf_samp_window;
   GraphicsBool* m_log_render_time;
 
   // Utility
   GraphicsBool* m_prefetch_custom_textures;
+  GraphicsBool* m_async_custom_textures;
+  GraphicsBool* m_compress_custom_textures;
   GraphicsBool* m_dump_efb_target;
   GraphicsBool* m_dump_xfb_target;
   GraphicsBool* m_disable_vram_copies;
@@ -122,6 +122,12 @@ void GeneralWidget::CreateWidgets()
   m_wait_for_shaders = new GraphicsBool(tr("Compile Shaders Before Starting"),
                                         Config::GFX_WAIT_FOR_SHADERS_BEFORE_STARTING);
   shader_compilation_layout->addWidget(m_wait_for_shaders);
+  m_specialized_ubershaders = new GraphicsBool(tr("Specialized Ubershader Variants"),
+                                               Config::GFX_SPECIALIZED_UBERSHADERS);
+  shader_compilation_layout->addWidget(m_specialized_ubershaders, 2, 1);
+  m_shared_shader_cache =
+      new GraphicsBool(tr("Share Shader Cache Between Games"), Config::GFX_SHARED_SHADER_CACHE);
+  shader_compilation_layout->addWidget(m_shared_shader_cache, 3, 0);
   shader_compilation_box->setLayout(shader_compilation_layout);
 
   main_layout->addWidget(m_video_box);
@@ -254,6 +260,18 @@ void GeneralWidget::AddDescriptions()
                  "two or fewer cores, it is recommended to enable this option, as a large shader "
                  "queue may reduce frame rates.<br><br><dolphin_emphasis>Otherwise, if "
                  "unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_SPECIALIZED_UBERSHADERS_DESCRIPTION[] = QT_TR_NOOP(
+      "Compiles ubershaders in several variants, each specialized on the TEV stage count and on "
+      "whether indirect texturing, fog and lighting are used. Ubershaders run faster on weaker "
+      "GPUs this way, but many more of them have to be compiled up front.<br><br>Only affects "
+      "the ubershader modes.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
+  static const char TR_SHARED_SHADER_CACHE_DESCRIPTION[] = QT_TR_NOOP(
+      "Keeps compiled shaders in a store shared by all games, which is checked before compiling "
+      "a shader that isn't in the game's own cache. Games built on the same engine often use the "
+      "same shaders, so this reduces stuttering the first time a game is played.<br><br>The "
+      "store is limited in size; the shaders used by the fewest games are removed first."
+      "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
 
   m_backend_combo->SetTitle(tr("Backend"));
   m_backend_combo->SetDescription(tr(TR_BACKEND_DESCRIPTION));
@@ -284,6 +302,10 @@ void GeneralWidget::AddDescriptions()
   m_shader_compilation_mode[3]->SetDescription(tr(TR_SHADER_COMPILE_SKIP_DRAWING_DESCRIPTION));
 
   m_wait_for_shaders->SetDescription(tr(TR_SHADER_COMPILE_BEFORE_START_DESCRIPTION));
+
+  m_specialized_ubershaders->SetDescription(tr(TR_SPECIALIZED_UBERSHADERS_DESCRIPTION));
+
+  m_shared_shader_cache->SetDescription(tr(TR_SHARED_SHADER_CACHE_DESCRIPTION));
 }
 
 void GeneralWidget::OnBackendChanged(const QString& backend_name)
@@ -14,6 +14,7 @@
 #include "Core/ConfigManager.h"
 
 #include "DolphinQt/Config/Graphics/GraphicsBool.h"
+#include "DolphinQt/Config/Graphics/GraphicsInteger.h"
 #include "DolphinQt/Config/Graphics/GraphicsSlider.h"
 #include "DolphinQt/Config/Graphics/GraphicsWindow.h"
 #include "DolphinQt/Config/ToolTipControls/ToolTipSlider.h"
@@ -67,6 +68,11 @@ void HacksWidget::CreateWidgets()
   m_accuracy->setTickPosition(QSlider::TicksBelow);
   m_gpu_texture_decoding =
       new GraphicsBool(tr("GPU Texture Decoding"), Config::GFX_ENABLE_GPU_TEXTURE_DECODING);
+  m_track_memory_writes =
+      new GraphicsBool(tr("Track Memory Writes"), Config::GFX_TRACK_TEXTURE_MEMORY_WRITES);
+  m_texture_cache_budget = new GraphicsInteger(0, 65536, Config::GFX_TEXTURE_CACHE_BUDGET, 256);
+  m_texture_cache_budget->SetTitle(tr("Memory Budget (MiB)"));
+  m_texture_cache_budget->setSpecialValueText(tr("Unlimited"));
 
   auto* safe_label = new QLabel(tr("Safe"));
   safe_label->setAlignment(Qt::AlignRight);
@@ -78,6 +84,9 @@ void HacksWidget::CreateWidgets()
   texture_cache_layout->addWidget(m_accuracy, 0, 2);
   texture_cache_layout->addWidget(new QLabel(tr("Fast")), 0, 3);
   texture_cache_layout->addWidget(m_gpu_texture_decoding, 1, 0);
+  texture_cache_layout->addWidget(m_track_memory_writes, 1, 2, 1, 2);
+  texture_cache_layout->addWidget(new QLabel(tr("Memory Budget (MiB):")), 2, 0);
+  texture_cache_layout->addWidget(m_texture_cache_budget, 2, 2, 1, 2);
 
   // XFB
   auto* xfb_box = new QGroupBox(tr("External Frame Buffer (XFB)"));
@@ -107,12 +116,15 @@ void HacksWidget::CreateWidgets()
   m_save_texture_cache_state =
       new GraphicsBool(tr("Save Texture Cache to State"), Config::GFX_SAVE_TEXTURE_CACHE_TO_STATE);
   m_vi_skip = new GraphicsBool(tr("VI Skip"), Config::GFX_HACK_VI_SKIP);
+  m_speculative_bounding_box =
+      new GraphicsBool(tr("Speculative Bounding Box"), Config::GFX_HACK_BBOX_SPECULATIVE);
 
   other_layout->addWidget(m_fast_depth_calculation, 0, 0);
   other_layout->addWidget(m_disable_bounding_box, 0, 1);
   other_layout->addWidget(m_vertex_rounding, 1, 0);
   other_layout->addWidget(m_save_texture_cache_state, 1, 1);
   other_layout->addWidget(m_vi_skip, 2, 0);
+  other_layout->addWidget(m_speculative_bounding_box, 2, 1);
 
   main_layout->addWidget(efb_box);
   main_layout->addWidget(texture_cache_box);
@@ -133,12 +145,14 @@ void HacksWidget::OnBackendChanged(const QString& backend_name)
 
   m_gpu_texture_decoding->setEnabled(gpu_texture_decoding);
   m_disable_bounding_box->setEnabled(bbox);
+  m_speculative_bounding_box->setEnabled(bbox);
 
   const QString tooltip = tr("%1 doesn't support this feature on your system.")
                               .arg(tr(backend_name.toStdString().c_str()));
 
   m_gpu_texture_decoding->setToolTip(!gpu_texture_decoding ? tooltip : QString{});
   m_disable_bounding_box->setToolTip(!bbox ? tooltip : QString{});
+  m_speculative_bounding_box->setToolTip(!bbox ? tooltip : QString{});
 }
 
 void HacksWidget::ConnectWidgets()
@@ -244,6 +258,20 @@ void HacksWidget::AddDescriptions()
       "from RAM. Lower accuracies cause in-game text to appear garbled in certain "
       "games.<br><br><dolphin_emphasis>If unsure, select the rightmost "
       "value.</dolphin_emphasis>");
+  static const char TR_TRACK_MEMORY_WRITES_DESCRIPTION[] = QT_TR_NOOP(
+      "Keeps track of which parts of RAM the game writes to, so that textures which haven't been "
+      "written to don't have to be checked for changes. This makes the \"Safe\" texture cache "
+      "accuracy about as fast as the faster ones in games with many large "
+      "textures.<br><br>Only works with fastmem enabled, and takes effect the next time "
+      "emulation is started.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
+  static const char TR_TEXTURE_CACHE_BUDGET_DESCRIPTION[] = QT_TR_NOOP(
+      "Limits the amount of video memory used for cached textures. When the limit is exceeded, "
+      "the textures that haven't been used for the longest time are freed, even if they would "
+      "otherwise be kept around.<br><br>Helps to avoid running out of video memory when using a "
+      "high internal resolution or custom textures on GPUs with little memory. EFB copies aren't "
+      "affected, since they can't be recreated.<br><br><dolphin_emphasis>If unsure, leave this "
+      "at Unlimited.</dolphin_emphasis>");
   static const char TR_STORE_XFB_TO_TEXTURE_DESCRIPTION[] = QT_TR_NOOP(
       "Stores XFB copies exclusively on the GPU, bypassing system memory. Causes graphical defects "
       "in a small number of games.<br><br>Enabled = XFB Copies to "
@@ -274,6 +302,13 @@ void HacksWidget::AddDescriptions()
       QT_TR_NOOP("Disables bounding box emulation.<br><br>This may improve GPU performance "
                  "significantly, but some games will break.<br><br><dolphin_emphasis>If "
                  "unsure, leave this checked.</dolphin_emphasis>");
+  static const char TR_SPECULATIVE_BOUNDINGBOX_DESCRIPTION[] =
+      QT_TR_NOOP("Reads the bounding box back from the GPU asynchronously, handing the game the "
+                 "most recent values which are available instead of waiting for the current "
+                 "ones.<br><br>This avoids stalling the GPU in games which read the bounding box "
+                 "often, but the values can lag behind, which may cause glitches. Only supported "
+                 "by the Vulkan backend, and always disabled during netplay."
+                 "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_SAVE_TEXTURE_CACHE_TO_STATE_DESCRIPTION[] =
       QT_TR_NOOP("Includes the contents of the embedded frame buffer (EFB) and upscaled EFB copies "
                  "in save states. Fixes missing and/or non-upscaled textures/objects when loading "
@@ -301,11 +336,14 @@ void HacksWidget::AddDescriptions()
   m_immediate_xfb->SetDescription(tr(TR_IMMEDIATE_XFB_DESCRIPTION));
   m_skip_duplicate_xfbs->SetDescription(tr(TR_SKIP_DUPLICATE_XFBS_DESCRIPTION));
   m_gpu_texture_decoding->SetDescription(tr(TR_GPU_DECODING_DESCRIPTION));
+  m_track_memory_writes->SetDescription(tr(TR_TRACK_MEMORY_WRITES_DESCRIPTION));
+  m_texture_cache_budget->SetDescription(tr(TR_TEXTURE_CACHE_BUDGET_DESCRIPTION));
   m_fast_depth_calculation->SetDescription(tr(TR_FAST_DEPTH_CALC_DESCRIPTION));
   m_disable_bounding_box->SetDescription(tr(TR_DISABLE_BOUNDINGBOX_DESCRIPTION));
   m_save_texture_cache_state->SetDescription(tr(TR_SAVE_TEXTURE_CACHE_TO_STATE_DESCRIPTION));
   m_vertex_rounding->SetDescription(tr(TR_VERTEX_ROUNDING_DESCRIPTION));
   m_vi_skip->SetDescription(tr(TR_VI_SKIP_DESCRIPTION));
+  m_speculative_bounding_box->SetDescription(tr(TR_SPECULATIVE_BOUNDINGBOX_DESCRIPTION));
 }
 
 void HacksWidget::UpdateDeferEFBCopiesEnabled()
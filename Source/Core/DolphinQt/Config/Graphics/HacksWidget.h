@@ -6,6 +6,7 @@
 #include "DolphinQt/Config/Graphics/GraphicsWidget.h"
 
 class GraphicsBool;
+class GraphicsInteger;
 class GraphicsWindow;
 class QLabel;
 class ToolTipSlider;
@@ -32,6 +33,8 @@ private:
   QLabel* m_accuracy_label;
   ToolTipSlider* m_accuracy;
   GraphicsBool* m_gpu_texture_decoding;
+  GraphicsBool* m_track_memory_writes;
+  GraphicsInteger* m_texture_cache_budget;
 
   // External Framebuffer
   GraphicsBool* m_store_xfb_copies;
@@ -43,6 +46,7 @@ private:
   GraphicsBool* m_disable_bounding_box;
   GraphicsBool* m_vertex_rounding;
   GraphicsBool* m_vi_skip;
+  GraphicsBool* m_speculative_bounding_box;
   GraphicsBool* m_save_texture_cache_state;
 
   void CreateWidgets();
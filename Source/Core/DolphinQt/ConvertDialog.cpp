@@ -477,7 +477,7 @@ void ConvertDialog::Convert()
         success = std::async(std::launch::async, [&] {
           const bool good = DiscIO::ConvertToGCZ(
               blob_reader.get(), original_path, dst_path.toStdString(),
-              file->GetPlatform() == DiscIO::Platform::WiiDisc ? 1 : 0, block_size, callback);
+              file->GetPlatform() == DiscIO::Platform::WiiDisc ? 1 : 0, block_size, 0, callback);
           progress_dialog.Reset();
           return good;
         });
@@ -489,7 +489,7 @@ void ConvertDialog::Convert()
           const bool good =
               DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), original_path, dst_path.toStdString(),
                                         format == DiscIO::BlobType::RVZ, compression,
-                                        compression_level, block_size, callback);
+                                        compression_level, block_size, false, 0, callback);
           progress_dialog.Reset();
           return good;
         });
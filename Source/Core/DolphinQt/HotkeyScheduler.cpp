@@ -603,6 +603,19 @@ void HotkeyScheduler::Run()
 
     if (IsHotkey(HK_SAVE_STATE_FILE))
       emit StateSaveFile();
+
+    // Holding the hotkey keeps going back until it's released.
+    constexpr int REWIND_REPEAT_DELAY = 20;
+    static int rewind_hold_count = 0;
+    if (IsHotkey(HK_REWIND, true))
+    {
+      if (rewind_hold_count++ % REWIND_REPEAT_DELAY == 0)
+        emit StateRewind();
+    }
+    else
+    {
+      rewind_hold_count = 0;
+    }
   }
 }
 
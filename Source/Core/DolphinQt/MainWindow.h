@@ -103,6 +103,7 @@ private:
   void StateLoadUndo();
   void StateSaveUndo();
   void StateSaveOldest();
+  void StateRewind();
   void SetStateSlot(int slot);
   void IncrementSelectedStateSlot();
   void DecrementSelectedStateSlot();
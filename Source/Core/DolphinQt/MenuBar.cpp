@@ -5,6 +5,7 @@
 
 #include <cinttypes>
 #include <future>
+#include <limits>
 
 #include <QAction>
 #include <QActionGroup>
@@ -127,6 +128,7 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   {
     m_recording_stop->setEnabled(false);
     m_recording_export->setEnabled(false);
+    m_recording_jump->setEnabled(false);
   }
   m_recording_play->setEnabled(m_game_selected && !running);
   m_recording_start->setEnabled((m_game_selected || running) && !Movie::IsPlayingInput());
@@ -723,11 +725,20 @@ void MenuBar::AddMovieMenu()
                                            [this] { emit StopRecording(); });
   m_recording_export =
       movie_menu->addAction(tr("Export Recording..."), this, [this] { emit ExportRecording(); });
+  m_recording_jump = movie_menu->addAction(tr("&Jump to Checkpoint..."), this, [this] {
+    bool ok;
+    const int frame = QInputDialog::getInt(this, tr("Jump to Checkpoint"), tr("Frame:"),
+                                           static_cast<int>(Movie::GetCurrentFrame()), 0,
+                                           std::numeric_limits<int>::max(), 1, &ok);
+    if (ok)
+      Movie::JumpToCheckpoint(static_cast<u64>(frame));
+  });
 
   m_recording_start->setEnabled(false);
   m_recording_play->setEnabled(false);
   m_recording_stop->setEnabled(false);
   m_recording_export->setEnabled(false);
+  m_recording_jump->setEnabled(false);
 
   m_recording_read_only = movie_menu->addAction(tr("&Read-Only Mode"));
   m_recording_read_only->setCheckable(true);
@@ -744,6 +755,12 @@ void MenuBar::AddMovieMenu()
   connect(pause_at_end, &QAction::toggled,
           [](bool value) { Config::SetBaseOrCurrent(Config::MAIN_MOVIE_PAUSE_MOVIE, value); });
 
+  auto* compact_format = movie_menu->addAction(tr("Save Compact Movies with Checkpoints"));
+  compact_format->setCheckable(true);
+  compact_format->setChecked(Config::Get(Config::MAIN_MOVIE_COMPACT_FORMAT));
+  connect(compact_format, &QAction::toggled,
+          [](bool value) { Config::SetBaseOrCurrent(Config::MAIN_MOVIE_COMPACT_FORMAT, value); });
+
   auto* rerecord_counter = movie_menu->addAction(tr("Show Rerecord Counter"));
   rerecord_counter->setCheckable(true);
   rerecord_counter->setChecked(Config::Get(Config::MAIN_MOVIE_SHOW_RERECORD));
@@ -1154,6 +1171,7 @@ void MenuBar::OnRecordingStatusChanged(bool recording)
   m_recording_start->setEnabled(!recording && (m_game_selected || Core::IsRunning()));
   m_recording_stop->setEnabled(recording);
   m_recording_export->setEnabled(recording);
+  m_recording_jump->setEnabled(recording);
 }
 
 void MenuBar::OnReadOnlyModeChanged(bool read_only)
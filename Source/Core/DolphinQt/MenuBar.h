@@ -230,6 +230,7 @@ private:
   QAction* m_recording_play;
   QAction* m_recording_start;
   QAction* m_recording_stop;
+  QAction* m_recording_jump;
   QAction* m_recording_read_only;
 
   // Options
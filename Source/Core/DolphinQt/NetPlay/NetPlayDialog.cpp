@@ -179,6 +179,17 @@ void NetPlayDialog::CreateMainLayout()
          "uses the same video backend."));
   m_strict_settings_sync_action->setCheckable(true);
 
+  m_data_menu->addSeparator();
+
+  m_resync_state_action = m_data_menu->addAction(tr("Resync From Host's State"), this, [] {
+    Settings::Instance().GetNetPlayServer()->CaptureStateForResync();
+  });
+  m_resync_state_action->setToolTip(
+      tr("Stops the game and captures the host's state. When the game is started again, every "
+         "player resumes from that state.\nUse this to recover from a desync without starting "
+         "over. Players who resynced before only download what changed since then."));
+  m_resync_state_action->setEnabled(false);
+
   m_network_menu = m_menu_bar->addMenu(tr("Network"));
   m_network_menu->setToolTipsVisible(true);
   m_fixed_delay_action = m_network_menu->addAction(tr("Fair Input Delay"));
@@ -231,6 +242,14 @@ void NetPlayDialog::CreateMainLayout()
   m_golf_mode_overlay_action->setCheckable(true);
   m_hide_remote_gbas_action = m_other_menu->addAction(tr("Hide Remote GBAs"));
   m_hide_remote_gbas_action->setCheckable(true);
+  m_other_menu->setToolTipsVisible(true);
+  m_auto_buffer_size_action = m_other_menu->addAction(tr("Adjust Buffer Automatically"));
+  m_auto_buffer_size_action->setToolTip(
+      tr("Adjusts the buffer size to the latency and jitter of the connections while playing.
+"
+         "With Fair Input Delay, the host's setting applies to all players. Otherwise, each player "
+         "adjusts their own maximum buffer."));
+  m_auto_buffer_size_action->setCheckable(true);
 
   m_game_button->setDefault(false);
   m_game_button->setAutoDefault(false);
@@ -424,6 +443,7 @@ void NetPlayDialog::ConnectWidgets()
   connect(m_golf_mode_overlay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_fixed_delay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_hide_remote_gbas_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
+  connect(m_auto_buffer_size_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
 }
 
 void NetPlayDialog::SendMessage(const std::string& msg)
@@ -860,6 +880,7 @@ void NetPlayDialog::SetOptionsEnabled(bool enabled)
     m_host_input_authority_action->setEnabled(enabled);
     m_golf_mode_action->setEnabled(enabled);
     m_fixed_delay_action->setEnabled(enabled);
+    m_resync_state_action->setEnabled(!enabled);
   }
 
   m_record_input_action->setEnabled(enabled);
@@ -1127,6 +1148,7 @@ void NetPlayDialog::LoadSettings()
   const bool strict_settings_sync = Config::Get(Config::NETPLAY_STRICT_SETTINGS_SYNC);
   const bool golf_mode_overlay = Config::Get(Config::NETPLAY_GOLF_MODE_OVERLAY);
   const bool hide_remote_gbas = Config::Get(Config::NETPLAY_HIDE_REMOTE_GBAS);
+  const bool auto_buffer_size = Config::Get(Config::NETPLAY_AUTO_BUFFER_SIZE);
 
   m_buffer_size_box->setValue(buffer_size);
 
@@ -1143,6 +1165,7 @@ void NetPlayDialog::LoadSettings()
   m_strict_settings_sync_action->setChecked(strict_settings_sync);
   m_golf_mode_overlay_action->setChecked(golf_mode_overlay);
   m_hide_remote_gbas_action->setChecked(hide_remote_gbas);
+  m_auto_buffer_size_action->setChecked(auto_buffer_size);
 
   const std::string network_mode = Config::Get(Config::NETPLAY_NETWORK_MODE);
 
@@ -1186,6 +1209,7 @@ void NetPlayDialog::SaveSettings()
   Config::SetBase(Config::NETPLAY_STRICT_SETTINGS_SYNC, m_strict_settings_sync_action->isChecked());
   Config::SetBase(Config::NETPLAY_GOLF_MODE_OVERLAY, m_golf_mode_overlay_action->isChecked());
   Config::SetBase(Config::NETPLAY_HIDE_REMOTE_GBAS, m_hide_remote_gbas_action->isChecked());
+  Config::SetBase(Config::NETPLAY_AUTO_BUFFER_SIZE, m_auto_buffer_size_action->isChecked());
 
   std::string network_mode;
   if (m_fixed_delay_action->isChecked())
@@ -1270,3 +1294,10 @@ void NetPlayDialog::SetHostWiiSyncData(std::vector<u64> titles, std::string redi
   if (client)
     client->SetWiiSyncData(nullptr, std::move(titles), std::move(redirect_folder));
 }
+
+void NetPlayDialog::SetHostSyncedState(std::vector<u8> state)
+{
+  auto client = Settings::Instance().GetNetPlayClient();
+  if (client)
+    client->SetSyncedState(std::move(state));
+}
@@ -96,6 +96,7 @@ public:
   void SetChunkedProgress(int pid, u64 progress) override;
 
   void SetHostWiiSyncData(std::vector<u64> titles, std::string redirect_folder) override;
+  void SetHostSyncedState(std::vector<u8> state) override;
 
 signals:
   void Stop();
@@ -152,11 +153,13 @@ private:
   QAction* m_sync_codes_action;
   QAction* m_record_input_action;
   QAction* m_strict_settings_sync_action;
+  QAction* m_resync_state_action;
   QAction* m_host_input_authority_action;
   QAction* m_golf_mode_action;
   QAction* m_golf_mode_overlay_action;
   QAction* m_fixed_delay_action;
   QAction* m_hide_remote_gbas_action;
+  QAction* m_auto_buffer_size_action;
   QPushButton* m_quit_button;
   QSplitter* m_splitter;
   QActionGroup* m_network_mode_group;
@@ -0,0 +1,316 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/BenchmarkCommand.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/StringUtil.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/Filesystem.h"
+#include "DiscIO/Volume.h"
+
+namespace DolphinTool
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct DiscRead
+{
+  u64 offset;
+  u32 size;
+};
+
+struct ReadTimeStats
+{
+  double mean_us = 0;
+  double p50_us = 0;
+  double p90_us = 0;
+  double p99_us = 0;
+  double max_us = 0;
+};
+
+void CollectFiles(const DiscIO::FileInfo& directory, std::vector<DiscRead>* files)
+{
+  for (const DiscIO::FileInfo& file : directory)
+  {
+    if (file.IsDirectory())
+      CollectFiles(file, files);
+    else if (file.GetSize() != 0)
+      files->push_back({file.GetOffset(), file.GetSize()});
+  }
+}
+
+// Picks reads of up to read_size bytes at random places in the files of the game partition, the
+// way a game streams its data. The same seed gives the same reads for any format of the same disc.
+std::vector<DiscRead> GenerateReads(const DiscIO::Volume& volume, u32 count, u32 read_size,
+                                    u32 seed)
+{
+  std::vector<DiscRead> files;
+  const DiscIO::FileSystem* file_system = volume.GetFileSystem(volume.GetGamePartition());
+  if (file_system)
+    CollectFiles(file_system->GetRoot(), &files);
+  if (files.empty())
+    return {};
+
+  std::mt19937 generator(seed);
+  std::vector<DiscRead> reads;
+  reads.reserve(count);
+  for (u32 i = 0; i < count; ++i)
+  {
+    const DiscRead& file = files[generator() % files.size()];
+    const u32 size = std::min(file.size, read_size);
+    // Like DVD reads, start at a multiple of 32 bytes
+    const u64 offset_in_file = (generator() % (file.size - size + 1)) & ~u64(0x1f);
+    reads.push_back({file.offset + offset_in_file, size});
+  }
+  return reads;
+}
+
+// Reads pairs of "offset size", in hex with a 0x prefix or in decimal, relative to the game
+// partition.
+std::optional<std::vector<DiscRead>> LoadReads(const std::string& path)
+{
+  std::ifstream stream;
+  File::OpenFStream(stream, path, std::ios_base::in);
+  if (!stream)
+    return std::nullopt;
+
+  std::vector<DiscRead> reads;
+  std::string offset_string;
+  std::string size_string;
+  while (stream >> offset_string >> size_string)
+  {
+    DiscRead read;
+    if (TryParse(offset_string, &read.offset) && TryParse(size_string, &read.size) &&
+        read.size != 0)
+    {
+      reads.push_back(read);
+    }
+  }
+  return reads;
+}
+
+ReadTimeStats ComputeStats(std::vector<double> times)
+{
+  ReadTimeStats stats;
+  if (times.empty())
+    return stats;
+
+  std::sort(times.begin(), times.end());
+  const auto percentile = [&times](double p) {
+    const size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * times.size()));
+    return times[std::clamp<size_t>(rank, 1, times.size()) - 1];
+  };
+
+  stats.mean_us = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+  stats.p50_us = percentile(50);
+  stats.p90_us = percentile(90);
+  stats.p99_us = percentile(99);
+  stats.max_us = times.back();
+  return stats;
+}
+
+picojson::value StatsToJSON(const ReadTimeStats& stats)
+{
+  picojson::object object;
+  object.emplace("mean", picojson::value(stats.mean_us));
+  object.emplace("p50", picojson::value(stats.p50_us));
+  object.emplace("p90", picojson::value(stats.p90_us));
+  object.emplace("p99", picojson::value(stats.p99_us));
+  object.emplace("max", picojson::value(stats.max_us));
+  return picojson::value(std::move(object));
+}
+
+std::optional<picojson::object> BenchmarkFile(const std::string& path,
+                                              const std::optional<std::vector<DiscRead>>& script,
+                                              u32 count, u32 read_size, u32 seed)
+{
+  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(path);
+  if (!volume)
+  {
+    std::cerr << "Error: Unable to open disc image " << path << std::endl;
+    return std::nullopt;
+  }
+
+  const std::vector<DiscRead> reads =
+      script ? *script : GenerateReads(*volume, count, read_size, seed);
+  if (reads.empty())
+  {
+    std::cerr << "Error: Nothing to read from " << path << std::endl;
+    return std::nullopt;
+  }
+
+  const DiscIO::Partition partition = volume->GetGamePartition();
+  std::vector<u8> buffer;
+  std::vector<double> times;
+  times.reserve(reads.size());
+  u64 bytes_read = 0;
+  u32 failed_reads = 0;
+
+  const Clock::time_point start = Clock::now();
+  for (const DiscRead& read : reads)
+  {
+    buffer.resize(read.size);
+    const Clock::time_point read_start = Clock::now();
+    const bool success = volume->Read(read.offset, read.size, buffer.data(), partition);
+    times.push_back(std::chrono::duration<double, std::micro>(Clock::now() - read_start).count());
+
+    if (success)
+      bytes_read += read.size;
+    else
+      ++failed_reads;
+  }
+  const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  const DiscIO::BlobReader& blob = volume->GetBlobReader();
+  picojson::object result;
+  result.emplace("path", picojson::value(path));
+  result.emplace("format", picojson::value(DiscIO::GetName(blob.GetBlobType(), false)));
+  result.emplace("compression", picojson::value(blob.GetCompressionMethod()));
+  const std::optional<int> compression_level = blob.GetCompressionLevel();
+  result.emplace("compression_level",
+                 compression_level ? picojson::value(static_cast<double>(*compression_level)) :
+                                     picojson::value());
+  result.emplace("block_size", picojson::value(static_cast<double>(blob.GetBlockSize())));
+  result.emplace("reads", picojson::value(static_cast<double>(reads.size())));
+  result.emplace("failed_reads", picojson::value(static_cast<double>(failed_reads)));
+  result.emplace("seconds", picojson::value(seconds));
+  result.emplace("mib_per_second",
+                 picojson::value(seconds > 0 ? bytes_read / seconds / (1024 * 1024) : 0.0));
+  result.emplace("read_time_us", StatsToJSON(ComputeStats(std::move(times))));
+  return result;
+}
+}  // namespace
+
+int BenchmarkCommand::Main(const std::vector<std::string>& args)
+{
+  auto parser = std::make_unique<optparse::OptionParser>();
+
+  parser->usage("usage: benchmark [options]...");
+  parser->description("Measures how fast disc images can be read, and writes the read times as "
+                      "JSON. To compare formats, convert the same disc to each of them and pass "
+                      "all of the files.");
+
+  parser->add_option("-i", "--input")
+      .type("string")
+      .action("append")
+      .help("Path to disc image FILE. Can be given several times.")
+      .metavar("FILE");
+
+  parser->add_option("-n", "--reads")
+      .type("int")
+      .action("store")
+      .set_default(2000)
+      .help("Optional. Number of random reads from the files on the disc (default: %default).");
+
+  parser->add_option("-s", "--read_size")
+      .type("int")
+      .action("store")
+      .set_default(0x8000)
+      .help("Optional. Maximum size of each random read in bytes (default: %default).");
+
+  parser->add_option("--seed")
+      .type("int")
+      .action("store")
+      .set_default(0)
+      .help("Optional. Seed for picking the random reads (default: %default).");
+
+  parser->add_option("-r", "--read_list")
+      .type("string")
+      .action("store")
+      .help("Optional. Path to a FILE with one \"offset size\" read per line, relative to the game "
+            "partition, to use instead of random reads.")
+      .metavar("FILE");
+
+  parser->add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Optional. Path to write the results to (default: standard output).")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser->parse_args(args);
+
+  if (!options.is_set("input"))
+  {
+    std::cerr << "Error: No input set" << std::endl;
+    return 1;
+  }
+  const std::list<std::string> inputs = options.all("input");
+
+  const u32 count = static_cast<u32>(static_cast<int>(options.get("reads")));
+  const u32 read_size = static_cast<u32>(static_cast<int>(options.get("read_size")));
+  const u32 seed = static_cast<u32>(static_cast<int>(options.get("seed")));
+  if (count == 0 || read_size == 0)
+  {
+    std::cerr << "Error: The number and size of reads must not be 0" << std::endl;
+    return 1;
+  }
+
+  std::optional<std::vector<DiscRead>> script;
+  if (options.is_set("read_list"))
+  {
+    const std::string read_list_path = static_cast<const char*>(options.get("read_list"));
+    script = LoadReads(read_list_path);
+    if (!script)
+    {
+      std::cerr << "Error: Unable to open read list " << read_list_path << std::endl;
+      return 1;
+    }
+  }
+
+  picojson::array results;
+  for (const std::string& input : inputs)
+  {
+    std::optional<picojson::object> result = BenchmarkFile(input, script, count, read_size, seed);
+    if (!result)
+      return 1;
+    results.emplace_back(std::move(*result));
+  }
+
+  picojson::object root;
+  if (!script)
+  {
+    root.emplace("read_size", picojson::value(static_cast<double>(read_size)));
+    root.emplace("seed", picojson::value(static_cast<double>(seed)));
+  }
+  root.emplace("results", picojson::value(std::move(results)));
+  const std::string json = picojson::value(std::move(root)).serialize(true);
+
+  const std::string output_path =
+      options.is_set("output") ? static_cast<const char*>(options.get("output")) : "";
+  if (output_path.empty())
+  {
+    std::cout << json;
+    return 0;
+  }
+
+  File::IOFile file(output_path, "w");
+  if (!file.WriteString(json))
+  {
+    std::cerr << "Error: Unable to write " << output_path << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+}  // namespace DolphinTool
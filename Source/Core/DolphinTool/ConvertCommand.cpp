@@ -3,15 +3,25 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <optional>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
+#include <fmt/format.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
@@ -23,11 +33,25 @@
 
 namespace DolphinTool
 {
+namespace
+{
+// Two jobs are enough for one image to be read or written while another is being compressed.
+constexpr size_t DEFAULT_BATCH_JOBS = 2;
+
+// A rough upper bound for the memory a compression thread holds on to: the input chunk (at least
+// a whole Wii group for WIA/RVZ), its decrypted copy and the compressed output.
+u64 EstimateMemoryPerThread(int block_size)
+{
+  return std::max<u64>(block_size, 0x200000) * 3;
+}
+}  // namespace
+
 int ConvertCommand::Main(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
 
-  parser.usage("usage: convert [options]... [FILE]...");
+  parser.usage("usage: convert [options]... [FILE]...\n\n"
+               "Multiple FILEs can be converted at once by passing --output_directory.");
 
   parser.add_option("-u", "--user")
       .action("store")
@@ -46,6 +70,31 @@ int ConvertCommand::Main(const std::vector<std::string>& args)
       .help("Path to the destination FILE.")
       .metavar("FILE");
 
+  parser.add_option("-O", "--output_directory")
+      .type("string")
+      .action("store")
+      .help("Convert every input into DIR, keeping the file names but using the extension of the "
+            "output format.")
+      .metavar("DIR");
+
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Number of images to convert at the same time when converting multiple files. "
+            "Default is 2.");
+
+  parser.add_option("-t", "--threads")
+      .type("int")
+      .action("store")
+      .help("Total number of compression threads, shared between all jobs. Default is the number "
+            "of hardware threads.");
+
+  parser.add_option("-m", "--memory_limit")
+      .type("int")
+      .action("store")
+      .help("Approximate limit in MiB for the memory used by compression. Lowers the number of "
+            "threads if needed.");
+
   parser.add_option("-f", "--format")
       .type("string")
       .action("store")
@@ -75,6 +124,12 @@ int ConvertCommand::Main(const std::vector<std::string>& args)
       .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
             "zstd: 5");
 
+  parser.add_option("-d", "--zstd_dictionary")
+      .action("store_true")
+      .help("Store a Zstandard dictionary sampled from the disc when converting to RVZ with zstd. "
+            "Improves the compression of small block sizes, but the output can't be read by "
+            "older versions of Dolphin.");
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -88,21 +143,35 @@ int ConvertCommand::Main(const std::vector<std::string>& args)
 
   // Validate options
 
-  // --input
+  // --input, and any further inputs given as arguments
+  std::vector<std::string> input_file_paths = parser.args();
   const std::string input_file_path = static_cast<const char*>(options.get("input"));
-  if (input_file_path.empty())
+  if (!input_file_path.empty())
+    input_file_paths.insert(input_file_paths.begin(), input_file_path);
+  if (input_file_paths.empty())
   {
     std::cerr << "Error: No input set" << std::endl;
     return 1;
   }
 
-  // --output
+  // --output, --output_directory
   const std::string output_file_path = static_cast<const char*>(options.get("output"));
-  if (output_file_path.empty())
+  const std::string output_directory = static_cast<const char*>(options.get("output_directory"));
+  if (!output_file_path.empty() && !output_directory.empty())
+  {
+    std::cerr << "Error: --output and --output_directory can't be used together" << std::endl;
+    return 1;
+  }
+  if (output_file_path.empty() && output_directory.empty())
   {
     std::cerr << "Error: No output set" << std::endl;
     return 1;
   }
+  if (!output_file_path.empty() && input_file_paths.size() > 1)
+  {
+    std::cerr << "Error: Converting multiple files requires --output_directory" << std::endl;
+    return 1;
+  }
 
   // --format
   const std::optional<DiscIO::BlobType> format_o =
@@ -114,78 +183,28 @@ int ConvertCommand::Main(const std::vector<std::string>& args)
   }
   const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
-  {
-    std::cerr << "Error: The input file could not be opened." << std::endl;
-    return 1;
-  }
+  ConversionOptions conversion_options;
+  conversion_options.format = format;
 
   // --scrub
-  const bool scrub = static_cast<bool>(options.get("scrub"));
-
-  // Open the volume
-  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
-  {
-    if (scrub)
-    {
-      std::cerr << "Error: Scrubbing is only supported for GC/Wii disc images." << std::endl;
-      return 1;
-    }
+  conversion_options.scrub = static_cast<bool>(options.get("scrub"));
 
-    std::cerr << "Warning: The input file is not a GC/Wii disc image. Continuing anyway."
-              << std::endl;
-  }
-
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      std::cerr << "Error: Scrubbing a Datel disc is not supported." << std::endl;
-      return 1;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      std::cerr << "Error: Unable to process disc image. Try again without --scrub." << std::endl;
-      return 1;
-    }
-  }
-
-  if (scrub && format == DiscIO::BlobType::RVZ)
+  if (conversion_options.scrub && format == DiscIO::BlobType::RVZ)
   {
     std::cerr << "Warning: Scrubbing an RVZ container does not offer significant space advantages. "
                  "Continuing anyway."
               << std::endl;
   }
 
-  if (scrub && format == DiscIO::BlobType::PLAIN)
+  if (conversion_options.scrub && format == DiscIO::BlobType::PLAIN)
   {
     std::cerr << "Warning: Scrubbing does not save space when converting to ISO unless using "
                  "external compression. Continuing anyway."
               << std::endl;
   }
 
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
-  {
-    std::cerr << "Warning: Converting Wii disc images to GCZ without scrubbing may not offer space "
-                 "advantages over ISO. Continuing anyway."
-              << std::endl;
-  }
-
-  if (volume && volume->IsNKit())
-  {
-    std::cerr << "Warning: Converting an NKit file, output will still be NKit! Continuing anyway."
-              << std::endl;
-  }
-
   // --block_size
-  std::optional<int> block_size_o;
+  std::optional<int>& block_size_o = conversion_options.block_size;
   if (options.is_set("block_size"))
     block_size_o = static_cast<int>(options.get("block_size"));
 
@@ -210,23 +229,13 @@ int ConvertCommand::Main(const std::vector<std::string>& args)
       std::cerr << "Warning: Block size is not ideal for performance. Continuing anyway."
                 << std::endl;
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      std::cerr << "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, "
-                   "the file size must be an integer multiple of the block size "
-                   "and must not be an integer multiple of the block size multiplied by 32. "
-                   "Continuing anyway."
-                << std::endl;
-    }
   }
 
   // --compress, --compress_level
-  std::optional<DiscIO::WIARVZCompressionType> compression_o =
-      ParseCompressionTypeString(static_cast<const char*>(options.get("compression")));
+  std::optional<DiscIO::WIARVZCompressionType>& compression_o = conversion_options.compression;
+  compression_o = ParseCompressionTypeString(static_cast<const char*>(options.get("compression")));
 
-  std::optional<int> compression_level_o;
+  std::optional<int>& compression_level_o = conversion_options.compression_level;
   if (options.is_set("compression_level"))
     compression_level_o = static_cast<int>(options.get("compression_level"));
 
@@ -270,7 +279,134 @@ int ConvertCommand::Main(const std::vector<std::string>& args)
     }
   }
 
+  // --zstd_dictionary
+  conversion_options.zstd_dictionary = static_cast<bool>(options.get("zstd_dictionary"));
+  if (conversion_options.zstd_dictionary &&
+      (format != DiscIO::BlobType::RVZ || compression_o != DiscIO::WIARVZCompressionType::Zstd))
+  {
+    std::cerr << "Error: --zstd_dictionary can only be used for RVZ with zstd compression"
+              << std::endl;
+    return 1;
+  }
+
+  // --threads
+  int threads = std::max<int>(1, std::thread::hardware_concurrency());
+  if (options.is_set("threads"))
+    threads = static_cast<int>(options.get("threads"));
+  if (threads < 1)
+  {
+    std::cerr << "Error: The number of threads must be at least 1" << std::endl;
+    return 1;
+  }
+
+  // --memory_limit
+  if (options.is_set("memory_limit"))
+  {
+    const u64 memory_limit = static_cast<u64>(static_cast<int>(options.get("memory_limit")))
+                             << 20;
+    const u64 per_thread = EstimateMemoryPerThread(block_size_o.value_or(0));
+    threads = static_cast<int>(std::clamp<u64>(memory_limit / per_thread, 1, threads));
+  }
+
+  // --jobs
+  size_t jobs = std::min<size_t>(DEFAULT_BATCH_JOBS, input_file_paths.size());
+  if (options.is_set("jobs"))
+    jobs = static_cast<size_t>(std::max(1, static_cast<int>(options.get("jobs"))));
+  jobs = std::min({jobs, input_file_paths.size(), static_cast<size_t>(threads)});
+
   // Perform the conversion
+  if (!output_file_path.empty())
+  {
+    conversion_options.threads = threads;
+    if (!ConvertFile(input_file_paths[0], output_file_path, conversion_options, std::cerr))
+    {
+      std::cerr << "Error: Conversion failed" << std::endl;
+      return 1;
+    }
+    return 0;
+  }
+
+  const size_t failures =
+      ConvertBatch(input_file_paths, output_directory, conversion_options, jobs, threads);
+  if (failures != 0)
+  {
+    std::cerr << "Error: " << failures << " of " << input_file_paths.size()
+              << " conversions failed" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+bool ConvertCommand::ConvertFile(const std::string& input_file_path,
+                                 const std::string& output_file_path,
+                                 const ConversionOptions& options, std::ostream& log)
+{
+  const DiscIO::BlobType format = options.format;
+  const bool scrub = options.scrub;
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    log << "Error: The input file could not be opened." << std::endl;
+    return false;
+  }
+
+  // Open the volume
+  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (scrub)
+    {
+      log << "Error: Scrubbing is only supported for GC/Wii disc images." << std::endl;
+      return false;
+    }
+
+    log << "Warning: The input file is not a GC/Wii disc image. Continuing anyway." << std::endl;
+  }
+
+  if (scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      log << "Error: Scrubbing a Datel disc is not supported." << std::endl;
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      log << "Error: Unable to process disc image. Try again without --scrub." << std::endl;
+      return false;
+    }
+  }
+
+  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    log << "Warning: Converting Wii disc images to GCZ without scrubbing may not offer space "
+           "advantages over ISO. Continuing anyway."
+        << std::endl;
+  }
+
+  if (volume && volume->IsNKit())
+  {
+    log << "Warning: Converting an NKit file, output will still be NKit! Continuing anyway."
+        << std::endl;
+  }
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(options.block_size.value(), volume->GetDataSize()))
+  {
+    log << "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, "
+           "the file size must be an integer multiple of the block size "
+           "and must not be an integer multiple of the block size multiplied by 32. "
+           "Continuing anyway."
+        << std::endl;
+  }
+
   const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
 
   bool success = false;
@@ -294,18 +430,20 @@ int ConvertCommand::Main(const std::vector<std::string>& args)
       else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
         sub_type = 1;
     }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
+    success =
+        DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
+                             options.block_size.value(), options.threads, NOOP_STATUS_CALLBACK);
     break;
   }
 
   case DiscIO::BlobType::WIA:
   case DiscIO::BlobType::RVZ:
   {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
+    success = DiscIO::ConvertToWIAOrRVZ(
+        blob_reader.get(), input_file_path, output_file_path, format == DiscIO::BlobType::RVZ,
+        options.compression.value(), options.compression_level.value(),
+        options.block_size.value(), options.zstd_dictionary, options.threads,
+        NOOP_STATUS_CALLBACK);
     break;
   }
 
@@ -316,13 +454,76 @@ int ConvertCommand::Main(const std::vector<std::string>& args)
   }
   }
 
-  if (!success)
+  return success;
+}
+
+size_t ConvertCommand::ConvertBatch(const std::vector<std::string>& input_file_paths,
+                                    const std::string& output_directory,
+                                    const ConversionOptions& options, size_t jobs, int threads)
+{
+  if (!File::IsDirectory(output_directory) && !File::CreateFullPath(output_directory + '/'))
   {
-    std::cerr << "Error: Conversion failed" << std::endl;
-    return 1;
+    std::cerr << "Error: Unable to create the output directory" << std::endl;
+    return input_file_paths.size();
   }
 
-  return 0;
+  // Running more than one conversion at a time lets the reading and writing of one image overlap
+  // with the compression of another. The compression threads are divided between the jobs, so
+  // the total stays within the budget no matter how many jobs there are.
+  ConversionOptions job_options = options;
+  job_options.threads = std::max(1, threads / static_cast<int>(jobs));
+
+  std::atomic<size_t> next_index = 0;
+  std::atomic<size_t> failures = 0;
+  std::mutex log_mutex;
+
+  const auto worker = [&] {
+    for (size_t i = next_index++; i < input_file_paths.size(); i = next_index++)
+    {
+      const std::string input_path = WithUnifiedPathSeparators(input_file_paths[i]);
+      std::string name;
+      SplitPath(input_path, nullptr, &name, nullptr);
+      const std::string output_path =
+          fmt::format("{}/{}{}", output_directory, name, GetFormatExtension(options.format));
+      const std::string progress = fmt::format("[{}/{}]", i + 1, input_file_paths.size());
+
+      {
+        std::lock_guard lk(log_mutex);
+        std::cerr << progress << " Converting " << input_path << " to " << output_path
+                  << std::endl;
+      }
+
+      // Buffer each conversion's messages so that the output of concurrent jobs doesn't mix.
+      std::ostringstream log;
+      bool success;
+      std::error_code error;
+      if (std::filesystem::equivalent(StringToPath(input_path), StringToPath(output_path), error))
+      {
+        log << "Error: The output file would overwrite the input file" << std::endl;
+        success = false;
+      }
+      else
+      {
+        success = ConvertFile(input_path, output_path, job_options, log);
+      }
+
+      if (!success)
+        ++failures;
+
+      std::lock_guard lk(log_mutex);
+      std::cerr << log.str() << progress << ' ' << (success ? "Finished " : "Failed ")
+                << input_path << std::endl;
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < jobs; ++i)
+    workers.emplace_back(worker);
+  worker();
+  for (std::thread& thread : workers)
+    thread.join();
+
+  return failures.load();
 }
 
 std::optional<DiscIO::WIARVZCompressionType>
@@ -358,4 +559,19 @@ std::optional<DiscIO::BlobType> ConvertCommand::ParseFormatString(const std::str
     return std::nullopt;
 }
 
+std::string ConvertCommand::GetFormatExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return ".gcz";
+  case DiscIO::BlobType::WIA:
+    return ".wia";
+  case DiscIO::BlobType::RVZ:
+    return ".rvz";
+  default:
+    return ".iso";
+  }
+}
+
 }  // namespace DolphinTool
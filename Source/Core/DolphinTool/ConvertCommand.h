@@ -4,6 +4,7 @@
 #pragma once
 
 #include <optional>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -19,9 +20,30 @@ public:
   int Main(const std::vector<std::string>& args) override;
 
 private:
+  struct ConversionOptions
+  {
+    DiscIO::BlobType format;
+    bool scrub = false;
+    std::optional<int> block_size;
+    std::optional<DiscIO::WIARVZCompressionType> compression;
+    std::optional<int> compression_level;
+    bool zstd_dictionary = false;
+    int threads = 0;
+  };
+
+  bool ConvertFile(const std::string& input_file_path, const std::string& output_file_path,
+                   const ConversionOptions& options, std::ostream& log);
+
+  // Runs the conversions on a pool of jobs worker threads, splitting the thread budget between
+  // them. Returns the number of conversions which failed.
+  size_t ConvertBatch(const std::vector<std::string>& input_file_paths,
+                      const std::string& output_directory, const ConversionOptions& options,
+                      size_t jobs, int threads);
+
   std::optional<DiscIO::WIARVZCompressionType>
   ParseCompressionTypeString(const std::string& compression_str);
   std::optional<DiscIO::BlobType> ParseFormatString(const std::string& format_str);
+  std::string GetFormatExtension(DiscIO::BlobType format);
 };
 
 }  // namespace DolphinTool
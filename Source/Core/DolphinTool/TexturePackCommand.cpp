@@ -0,0 +1,67 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/TexturePackCommand.h"
+
+#include <iostream>
+#include <memory>
+
+#include <OptionParser.h>
+
+#include "Common/FileUtil.h"
+#include "VideoCommon/TexturePack.h"
+
+namespace DolphinTool
+{
+int TexturePackCommand::Main(const std::vector<std::string>& args)
+{
+  auto parser = std::make_unique<optparse::OptionParser>();
+
+  parser->usage("usage: texturepack [options]...");
+
+  parser->add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the custom texture DIRECTORY of a game.")
+      .metavar("DIRECTORY");
+
+  parser->add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the texture pack FILE to create. Dolphin loads it from "
+            "Load/Textures/<game ID>.dtp.")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser->parse_args(args);
+
+  // Validate options
+  const std::string input_directory = static_cast<const char*>(options.get("input"));
+  if (input_directory.empty())
+  {
+    std::cerr << "Error: No input set" << std::endl;
+    return 1;
+  }
+  if (!File::IsDirectory(input_directory))
+  {
+    std::cerr << "Error: Input is not a directory" << std::endl;
+    return 1;
+  }
+
+  const std::string output_file_path = static_cast<const char*>(options.get("output"));
+  if (output_file_path.empty())
+  {
+    std::cerr << "Error: No output set" << std::endl;
+    return 1;
+  }
+
+  std::string error_message;
+  if (!TexturePack::Build(input_directory, output_file_path, &error_message))
+  {
+    std::cerr << "Error: " << error_message << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+}  // namespace DolphinTool
@@ -4,6 +4,10 @@
 #include "DolphinTool/VerifyCommand.h"
 #include "UICommon/UICommon.h"
 
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+
 #include <OptionParser.h>
 
 namespace DolphinTool
@@ -32,6 +36,10 @@ int VerifyCommand::Main(const std::vector<std::string>& args)
             "[%choices]")
       .choices({"crc32", "md5", "sha1"});
 
+  parser->add_option("-t", "--time")
+      .action("store_true")
+      .help("Optional. Print the time taken and the verification throughput to stderr.");
+
   const optparse::Values& options = parser->parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -88,6 +96,7 @@ int VerifyCommand::Main(const std::vector<std::string>& args)
   }
 
   // Verify the volume
+  const auto start_time = std::chrono::steady_clock::now();
   const std::optional<DiscIO::VolumeVerifier::Result> result =
       VerifyVolume(volume, hashes_to_calculate);
   if (!result)
@@ -96,6 +105,15 @@ int VerifyCommand::Main(const std::vector<std::string>& args)
     return 1;
   }
 
+  if (options.get("time"))
+  {
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    const double mib = static_cast<double>(volume->GetDataSize()) / (1024 * 1024);
+    std::cerr << std::fixed << std::setprecision(2) << "Verified " << mib << " MiB in "
+              << elapsed.count() << " s (" << (mib / std::max(elapsed.count(), 1e-6))
+              << " MiB/s)" << std::endl;
+  }
+
   if (algorithm == std::nullopt)
   {
     PrintFullReport(result);
@@ -28,6 +28,8 @@ void ControlReference::UpdateReference(ciface::ExpressionParser::ControlEnvironm
   if (m_parsed_expression)
   {
     m_parsed_expression->UpdateReferences(env);
+    m_constant_value = m_parsed_expression->GetConstantValue();
+    m_direct_input = m_parsed_expression->GetDirectInput();
   }
 }
 
@@ -55,6 +57,8 @@ std::optional<std::string> ControlReference::SetExpression(std::string expr)
   auto parse_result = ParseExpression(m_expression);
   m_parse_status = parse_result.status;
   m_parsed_expression = std::move(parse_result.expr);
+  m_constant_value.reset();
+  m_direct_input = nullptr;
   return parse_result.description;
 }
 
@@ -87,9 +91,14 @@ bool OutputReference::IsInput() const
 //
 ControlState InputReference::State(const ControlState ignore)
 {
-  if (m_parsed_expression && GetInputGate())
-    return m_parsed_expression->GetValue() * range;
-  return 0.0;
+  if (!m_parsed_expression || !GetInputGate())
+    return 0.0;
+
+  if (m_direct_input)
+    return GetInputValue(m_direct_input) * range;
+  if (m_constant_value)
+    return *m_constant_value * range;
+  return m_parsed_expression->GetValue() * range;
 }
 
 //
@@ -5,6 +5,8 @@
 
 #include <cmath>
 #include <memory>
+#include <optional>
+#include <string>
 
 #include "InputCommon/ControlReference/ExpressionParser.h"
 #include "InputCommon/ControllerInterface/CoreDevice.h"
@@ -49,6 +51,11 @@ protected:
   std::unique_ptr<ciface::ExpressionParser::Expression> m_parsed_expression;
   ciface::ExpressionParser::ParseStatus m_parse_status =
       ciface::ExpressionParser::ParseStatus::EmptyExpression;
+
+  // Set by UpdateReference when the expression is a constant or reads a single input, so that State
+  // can skip walking the expression tree.
+  std::optional<ControlState> m_constant_value;
+  ciface::Core::Device::Input* m_direct_input = nullptr;
 };
 
 template <>
@@ -44,6 +44,10 @@ public:
 
   bool IsSuppressed(Device::Input* input) const
   {
+    // Usually nothing is suppressed, so avoid the lookups.
+    if (m_suppressions.empty())
+      return false;
+
     // Input is suppressed if it exists in the map at all.
     return m_suppressions.lower_bound({input, nullptr}) !=
            m_suppressions.lower_bound({input + 1, nullptr});
@@ -73,6 +77,20 @@ private:
 
 static HotkeySuppressions s_hotkey_suppressions;
 
+static ControlState GetInputValueIgnoringSuppression(Device::Input* input)
+{
+  if (!input)
+    return 0.0;
+
+  // Note: Inputs may return negative values in situations where opposing directions are
+  // activated. We clamp off the negative values here.
+
+  // FYI: Clamping values greater than 1.0 is purposely not done to support unbounded values in
+  // the future. (e.g. raw accelerometer/gyro data)
+
+  return std::max(0.0, input->GetState());
+}
+
 Token::Token(TokenType type_) : type(type_)
 {
 }
@@ -248,25 +266,11 @@ class ControlExpression : public Expression
 public:
   explicit ControlExpression(ControlQualifier qualifier) : m_qualifier(qualifier) {}
 
-  ControlState GetValue() const override
-  {
-    if (s_hotkey_suppressions.IsSuppressed(m_input))
-      return 0;
-    return GetValueIgnoringSuppression();
-  }
+  ControlState GetValue() const override { return GetInputValue(m_input); }
 
   ControlState GetValueIgnoringSuppression() const
   {
-    if (!m_input)
-      return 0.0;
-
-    // Note: Inputs may return negative values in situations where opposing directions are
-    // activated. We clamp off the negative values here.
-
-    // FYI: Clamping values greater than 1.0 is purposely not done to support unbounded values in
-    // the future. (e.g. raw accelerometer/gyro data)
-
-    return std::max(0.0, m_input->GetState());
+    return GetInputValueIgnoringSuppression(m_input);
   }
   void SetValue(ControlState value) override
   {
@@ -281,6 +285,14 @@ public:
     m_output = env.FindOutput(m_qualifier);
   }
 
+  std::optional<ControlState> GetConstantValue() const override
+  {
+    if (!m_input)
+      return 0.0;
+    return std::nullopt;
+  }
+  Device::Input* GetDirectInput() const override { return m_input; }
+
   Device::Input* GetInput() const { return m_input; };
 
 private:
@@ -291,6 +303,13 @@ private:
   Device::Output* m_output = nullptr;
 };
 
+ControlState GetInputValue(Device::Input* input)
+{
+  if (s_hotkey_suppressions.IsSuppressed(input))
+    return 0.0;
+  return GetInputValueIgnoringSuppression(input);
+}
+
 bool HotkeySuppressions::IsSuppressedIgnoringModifiers(Device::Input* input,
                                                        const Modifiers& ignore_modifiers) const
 {
@@ -344,54 +363,30 @@ public:
 
   ControlState GetValue() const override
   {
-    switch (op)
-    {
-    case TOK_AND:
-      return std::min(lhs->GetValue(), rhs->GetValue());
-    case TOK_OR:
-      return std::max(lhs->GetValue(), rhs->GetValue());
-    case TOK_ADD:
-      return lhs->GetValue() + rhs->GetValue();
-    case TOK_SUB:
-      return lhs->GetValue() - rhs->GetValue();
-    case TOK_MUL:
-      return lhs->GetValue() * rhs->GetValue();
-    case TOK_DIV:
-    {
-      const ControlState result = lhs->GetValue() / rhs->GetValue();
-      return std::isinf(result) ? 0.0 : result;
-    }
-    case TOK_MOD:
-    {
-      const ControlState result = std::fmod(lhs->GetValue(), rhs->GetValue());
-      return std::isnan(result) ? 0.0 : result;
-    }
-    case TOK_ASSIGN:
+    if (op == TOK_ASSIGN)
     {
       // Use this carefully as it's extremely powerful and can end up in unforeseen situations
       lhs->SetValue(rhs->GetValue());
       return lhs->GetValue();
     }
-    case TOK_LTHAN:
-      return lhs->GetValue() < rhs->GetValue();
-    case TOK_GTHAN:
-      return lhs->GetValue() > rhs->GetValue();
-    case TOK_COMMA:
-    {
-      // Eval and discard lhs:
-      lhs->GetValue();
-      return rhs->GetValue();
-    }
-    case TOK_XOR:
-    {
-      const auto lval = lhs->GetValue();
-      const auto rval = rhs->GetValue();
-      return std::max(std::min(1 - lval, rval), std::min(lval, 1 - rval));
-    }
-    default:
-      ASSERT(false);
-      return 0;
-    }
+
+    // The left-hand side has to be evaluated first for commas.
+    const ControlState lval = lhs->GetValue();
+    return Evaluate(lval, rhs->GetValue());
+  }
+
+  std::optional<ControlState> GetConstantValue() const override
+  {
+    // Assignments have side effects, so they are always evaluated.
+    if (op == TOK_ASSIGN)
+      return std::nullopt;
+
+    const auto lhs_value = lhs->GetConstantValue();
+    const auto rhs_value = rhs->GetConstantValue();
+    if (!lhs_value || !rhs_value)
+      return std::nullopt;
+
+    return Evaluate(*lhs_value, *rhs_value);
   }
 
   void SetValue(ControlState value) override
@@ -412,6 +407,47 @@ public:
     lhs->UpdateReferences(env);
     rhs->UpdateReferences(env);
   }
+
+private:
+  // Everything but assignments, which GetValue handles itself.
+  ControlState Evaluate(ControlState lval, ControlState rval) const
+  {
+    switch (op)
+    {
+    case TOK_AND:
+      return std::min(lval, rval);
+    case TOK_OR:
+      return std::max(lval, rval);
+    case TOK_ADD:
+      return lval + rval;
+    case TOK_SUB:
+      return lval - rval;
+    case TOK_MUL:
+      return lval * rval;
+    case TOK_DIV:
+    {
+      const ControlState result = lval / rval;
+      return std::isinf(result) ? 0.0 : result;
+    }
+    case TOK_MOD:
+    {
+      const ControlState result = std::fmod(lval, rval);
+      return std::isnan(result) ? 0.0 : result;
+    }
+    case TOK_LTHAN:
+      return lval < rval;
+    case TOK_GTHAN:
+      return lval > rval;
+    case TOK_COMMA:
+      // lhs was evaluated and is discarded
+      return rval;
+    case TOK_XOR:
+      return std::max(std::min(1 - lval, rval), std::min(lval, 1 - rval));
+    default:
+      ASSERT(false);
+      return 0;
+    }
+  }
 };
 
 class LiteralExpression : public Expression
@@ -439,6 +475,7 @@ public:
   LiteralReal(ControlState value) : m_value(value) {}
 
   ControlState GetValue() const override { return m_value; }
+  std::optional<ControlState> GetConstantValue() const override { return m_value; }
 
   std::string GetName() const override { return ValueToString(m_value); }
 
@@ -576,26 +613,36 @@ public:
   CoalesceExpression(std::unique_ptr<Expression>&& lhs, std::unique_ptr<Expression>&& rhs)
       : m_lhs(std::move(lhs)), m_rhs(std::move(rhs))
   {
+    UpdateActiveChild();
   }
 
-  ControlState GetValue() const override { return GetActiveChild()->GetValue(); }
-  void SetValue(ControlState value) override { GetActiveChild()->SetValue(value); }
+  ControlState GetValue() const override { return m_active_child->GetValue(); }
+  void SetValue(ControlState value) override { m_active_child->SetValue(value); }
 
-  int CountNumControls() const override { return GetActiveChild()->CountNumControls(); }
+  int CountNumControls() const override { return m_active_child->CountNumControls(); }
   void UpdateReferences(ControlEnvironment& env) override
   {
     m_lhs->UpdateReferences(env);
     m_rhs->UpdateReferences(env);
+    UpdateActiveChild();
+  }
+
+  std::optional<ControlState> GetConstantValue() const override
+  {
+    return m_active_child->GetConstantValue();
   }
+  Device::Input* GetDirectInput() const override { return m_active_child->GetDirectInput(); }
 
 private:
-  const std::unique_ptr<Expression>& GetActiveChild() const
+  // The number of bound controls only changes in UpdateReferences.
+  void UpdateActiveChild()
   {
-    return m_lhs->CountNumControls() > 0 ? m_lhs : m_rhs;
+    m_active_child = m_lhs->CountNumControls() > 0 ? m_lhs.get() : m_rhs.get();
   }
 
   std::unique_ptr<Expression> m_lhs;
   std::unique_ptr<Expression> m_rhs;
+  Expression* m_active_child;
 };
 
 std::shared_ptr<Device> ControlEnvironment::FindDevice(ControlQualifier qualifier) const
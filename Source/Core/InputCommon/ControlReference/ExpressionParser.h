@@ -172,8 +172,19 @@ public:
   virtual void SetValue(ControlState state) = 0;
   virtual int CountNumControls() const = 0;
   virtual void UpdateReferences(ControlEnvironment& finder) = 0;
+
+  // These allow the most common expressions to be evaluated without walking the expression tree.
+  // Their results are only valid until the next call to UpdateReferences.
+
+  // Returns the value of an expression that always evaluates to the same value.
+  virtual std::optional<ControlState> GetConstantValue() const { return std::nullopt; }
+  // Returns the input whose GetInputValue() is the value of the expression, if there is one.
+  virtual Core::Device::Input* GetDirectInput() const { return nullptr; }
 };
 
+// The value of a single input as used in expressions, which accounts for hotkey suppression.
+ControlState GetInputValue(Core::Device::Input* input);
+
 class ParseResult
 {
 public:
@@ -373,6 +373,14 @@ private:
     // Subtraction for clarity:
     return 0.0 - GetArg(0).GetValue();
   }
+
+  std::optional<ControlState> GetConstantValue() const override
+  {
+    // Negative literals are parsed as a minus applied to a literal.
+    if (const auto value = GetArg(0).GetConstantValue())
+      return 0.0 - *value;
+    return std::nullopt;
+  }
 };
 
 // usage: deadzone(input, amount)
@@ -13,9 +13,17 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <mutex>
 #include <optional>
 
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
 #include <libusb.h>
 #elif GCADAPTER_USE_ANDROID_IMPLEMENTATION
@@ -109,11 +117,35 @@ struct PortState
   GCPadStatus status = {};
 
   ControllerType controller_type = ControllerType::None;
-  bool is_new_connection = false;
+  // Incremented for every new connection so that the consumer can hand out the origin once.
+  u32 connection_count = 0;
 };
 
-// Only access with s_mutex held!
+// A full set of port states read from a single adapter report.
+struct InputSnapshot
+{
+  std::array<PortState, SerialInterface::MAX_SI_CHANNELS> ports{};
+};
+
+// Only accessed by the read thread (or while it isn't running).
 static std::array<PortState, SerialInterface::MAX_SI_CHANNELS> s_port_states;
+static std::array<u32, SerialInterface::MAX_SI_CHANNELS> s_connection_counts{};
+
+// Snapshots are handed from the read thread to the emulation thread through a lock-free triple
+// buffer: the read thread owns one slot, the emulation thread owns another, and the shared slot
+// holds the latest snapshot that hasn't been picked up yet. Reading therefore never blocks the
+// adapter thread and always returns the freshest report, however often SI polls.
+constexpr u8 SNAPSHOT_FRESH_FLAG = 0x4;
+static std::array<InputSnapshot, 3> s_snapshots;
+static std::atomic<u8> s_shared_snapshot{1};
+static u8 s_producer_snapshot = 0;
+static u8 s_consumer_snapshot = 2;
+
+// Consumer-side copy of PortState::connection_count for which the origin was already returned.
+static std::array<u32, SerialInterface::MAX_SI_CHANNELS> s_origin_connection_counts{};
+
+// Set by ResetDeviceType() and consumed by the read thread on the next report.
+static std::array<std::atomic<bool>, SerialInterface::MAX_SI_CHANNELS> s_reset_device_type{};
 
 static std::array<u8, CONTROLER_OUTPUT_RUMBLE_PAYLOAD_SIZE> s_controller_write_payload;
 static std::atomic<int> s_controller_write_payload_size{0};
@@ -124,7 +156,6 @@ static std::thread s_write_adapter_thread;
 static Common::Flag s_write_adapter_thread_running;
 static Common::Event s_write_happened;
 
-static std::mutex s_read_mutex;
 #if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
 static std::mutex s_init_mutex;
 #elif GCADAPTER_USE_ANDROID_IMPLEMENTATION
@@ -159,13 +190,66 @@ static u64 s_last_init = 0;
 static std::optional<size_t> s_config_callback_id = std::nullopt;
 
 static bool s_is_adapter_wanted = false;
+static bool s_low_latency_polling = false;
 static std::array<bool, SerialInterface::MAX_SI_CHANNELS> s_config_rumble_enabled{};
 
+// Called by the read thread after s_port_states has been updated.
+static void PublishPortStates()
+{
+  InputSnapshot& snapshot = s_snapshots[s_producer_snapshot];
+  snapshot.ports = s_port_states;
+
+  s_producer_snapshot =
+      s_shared_snapshot.exchange(s_producer_snapshot | SNAPSHOT_FRESH_FLAG,
+                                 std::memory_order_acq_rel) &
+      ~SNAPSHOT_FRESH_FLAG;
+}
+
+// Only call from the emulation thread.
+static const InputSnapshot& GetLatestSnapshot()
+{
+  if (s_shared_snapshot.load(std::memory_order_relaxed) & SNAPSHOT_FRESH_FLAG)
+  {
+    s_consumer_snapshot =
+        s_shared_snapshot.exchange(s_consumer_snapshot, std::memory_order_acq_rel) &
+        ~SNAPSHOT_FRESH_FLAG;
+  }
+  return s_snapshots[s_consumer_snapshot];
+}
+
+static void ClearPortStates()
+{
+  s_port_states.fill({});
+  for (int chan = 0; chan < SerialInterface::MAX_SI_CHANNELS; ++chan)
+    s_port_states[chan].connection_count = s_connection_counts[chan];
+  PublishPortStates();
+}
+
+static void RaiseReadThreadPriority()
+{
+#ifdef _WIN32
+  if (!SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL))
+    WARN_LOG_FMT(CONTROLLERINTERFACE, "Failed to raise read thread priority");
+#else
+  sched_param param{};
+  param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+  const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+  if (error != 0)
+    WARN_LOG_FMT(CONTROLLERINTERFACE, "Failed to raise read thread priority: {}", error);
+#endif
+}
+
 static void ReadThreadFunc()
 {
   Common::SetCurrentThreadName("GCAdapter Read Thread");
   NOTICE_LOG_FMT(CONTROLLERINTERFACE, "GCAdapter read thread started");
 
+  // The adapter sends a report every millisecond. In low latency mode, the thread runs at a raised
+  // priority and requests the next report right away instead of yielding between transfers.
+  const bool low_latency = s_low_latency_polling;
+  if (low_latency)
+    RaiseReadThreadPriority();
+
 #if GCADAPTER_USE_ANDROID_IMPLEMENTATION
   bool first_read = true;
   JNIEnv* const env = IDCache::GetEnvForThread();
@@ -229,7 +313,8 @@ static void ReadThreadFunc()
     }
 #endif
 
-    Common::YieldCPU();
+    if (!low_latency)
+      Common::YieldCPU();
   }
 
   // Terminate the write thread on leaving
@@ -404,6 +489,9 @@ static void RefreshConfig()
                            SerialInterface::SIDevices::SIDEVICE_WIIU_ADAPTER;
     s_config_rumble_enabled[i] = Config::Get(Config::GetInfoForAdapterRumble(i));
   }
+
+  // Only takes effect when the read thread is (re)started.
+  s_low_latency_polling = Config::Get(Config::MAIN_ADAPTER_LOW_LATENCY_POLLING);
 }
 
 void Init()
@@ -478,7 +566,7 @@ static void Setup()
   if (s_status == AdapterStatus::Error)
     s_status = AdapterStatus::NotDetected;
 
-  s_port_states.fill({});
+  ClearPortStates();
   s_controller_rumble.fill(0);
 
   const int ret = s_libusb_context->GetDeviceList([](libusb_device* device) {
@@ -698,7 +786,7 @@ static void Reset()
     s_read_adapter_thread.join();
   // The read thread will close the write thread
 
-  s_port_states.fill({});
+  ClearPortStates();
 
 #if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
   s_status = AdapterStatus::NotDetected;
@@ -737,14 +825,12 @@ GCPadStatus Input(int chan)
     return {};
 #endif
 
-  std::lock_guard lk(s_read_mutex);
-
-  auto& pad_state = s_port_states[chan];
+  const PortState& pad_state = GetLatestSnapshot().ports[chan];
 
   // Return the "origin" state for the first input on a new connection.
-  if (pad_state.is_new_connection)
+  if (pad_state.connection_count != s_origin_connection_counts[chan])
   {
-    pad_state.is_new_connection = false;
+    s_origin_connection_counts[chan] = pad_state.connection_count;
     return pad_state.origin;
   }
 
@@ -780,8 +866,6 @@ void ProcessInputPayload(const u8* data, std::size_t size)
   }
   else
   {
-    std::lock_guard lk(s_read_mutex);
-
     for (int chan = 0; chan != SerialInterface::MAX_SI_CHANNELS; ++chan)
     {
       const u8* const channel_data = &data[1 + (9 * chan)];
@@ -789,6 +873,8 @@ void ProcessInputPayload(const u8* data, std::size_t size)
       const auto type = IdentifyControllerType(channel_data[0]);
 
       auto& pad_state = s_port_states[chan];
+      if (s_reset_device_type[chan].exchange(false, std::memory_order_relaxed))
+        pad_state.controller_type = ControllerType::None;
 
       GCPadStatus pad = {};
 
@@ -846,25 +932,27 @@ void ProcessInputPayload(const u8* data, std::size_t size)
 
         pad.button |= PAD_GET_ORIGIN;
         pad_state.origin = pad;
-        pad_state.is_new_connection = true;
+        pad_state.connection_count = ++s_connection_counts[chan];
       }
 
       pad_state.controller_type = type;
       pad_state.status = pad;
     }
+
+    PublishPortStates();
   }
 }
 
 bool DeviceConnected(int chan)
 {
-  std::lock_guard lk(s_read_mutex);
-  return s_port_states[chan].controller_type != ControllerType::None;
+  if (s_reset_device_type[chan].load(std::memory_order_relaxed))
+    return false;
+  return GetLatestSnapshot().ports[chan].controller_type != ControllerType::None;
 }
 
 void ResetDeviceType(int chan)
 {
-  std::lock_guard lk(s_read_mutex);
-  s_port_states[chan].controller_type = ControllerType::None;
+  s_reset_device_type[chan].store(true, std::memory_order_relaxed);
 }
 
 bool UseAdapter()
@@ -935,7 +1023,7 @@ void Output(int chan, u8 rumble_command)
 
   // Skip over rumble commands if it has not changed or the controller is wireless
   if (rumble_command != s_controller_rumble[chan] &&
-      s_port_states[chan].controller_type != ControllerType::Wireless)
+      GetLatestSnapshot().ports[chan].controller_type != ControllerType::Wireless)
   {
     s_controller_rumble[chan] = rumble_command;
     std::array<u8, CONTROLER_OUTPUT_RUMBLE_PAYLOAD_SIZE> rumble = {
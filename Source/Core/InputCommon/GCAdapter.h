@@ -20,6 +20,8 @@ void StopScanThread();
 
 // Buttons have PAD_GET_ORIGIN set on new connection
 // Netplay and CSIDevice_GCAdapter make use of this.
+// Returns the most recent adapter report without blocking. Must only be called from the
+// emulation thread, as are DeviceConnected, ResetDeviceType and Output.
 GCPadStatus Input(int chan);
 
 void Output(int chan, u8 rumble_command);
@@ -8,12 +8,15 @@
 #include <cstdio>
 #include <cstring>
 #include <iterator>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -63,6 +66,58 @@ bool UseGameCovers()
   return Config::Get(Config::MAIN_USE_GAME_COVERS);
 #endif
 }
+
+// Keeps the most recently displayed covers in memory, so that the grid view doesn't have to read
+// the same files again while scrolling, without holding on to the covers of the whole library.
+class CoverCache
+{
+public:
+  std::shared_ptr<const GameCover> Get(const std::string& path)
+  {
+    std::lock_guard lk(m_mutex);
+
+    const auto it = m_lookup.find(path);
+    if (it != m_lookup.end())
+    {
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      return it->second->second;
+    }
+
+    auto cover = std::make_shared<GameCover>();
+    std::string contents;
+    if (File::ReadFileToString(path, contents))
+      cover->buffer = {contents.begin(), contents.end()};
+
+    m_entries.emplace_front(path, cover);
+    m_lookup.emplace(path, m_entries.begin());
+    m_size += cover->buffer.size();
+
+    while (m_size > MAX_SIZE && m_entries.size() > 1)
+    {
+      m_size -= m_entries.back().second->buffer.size();
+      m_lookup.erase(m_entries.back().first);
+      m_entries.pop_back();
+    }
+
+    return cover;
+  }
+
+private:
+  static constexpr size_t MAX_SIZE = 32 * 1024 * 1024;
+
+  using Entry = std::pair<std::string, std::shared_ptr<const GameCover>>;
+
+  std::mutex m_mutex;
+  std::list<Entry> m_entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> m_lookup;
+  size_t m_size = 0;
+};
+
+CoverCache& GetCoverCache()
+{
+  static CoverCache cache;
+  return cache;
+}
 }  // Anonymous namespace
 
 DiscIO::Language GameFile::GetConfigLanguage() const
@@ -209,34 +264,26 @@ bool GameFile::IsValid() const
 
 bool GameFile::CustomCoverChanged()
 {
-  if (!m_custom_cover.buffer.empty() || !UseGameCovers())
+  if (!UseGameCovers())
     return false;
 
   std::string path, name;
   SplitPath(m_file_path, &path, &name, nullptr);
 
-  std::string contents;
-
   // This icon naming format is intended as an alternative to Homebrew Channel icons
   // for those who don't want to have a Homebrew Channel style folder structure.
-  const std::string cover_path = path + name + ".cover.png";
-  bool success = File::Exists(cover_path) && File::ReadFileToString(cover_path, contents);
-
-  if (!success)
-  {
-    const std::string alt_cover_path = path + "cover.png";
-    success = File::Exists(alt_cover_path) && File::ReadFileToString(alt_cover_path, contents);
-  }
+  m_pending.custom_cover_path = path + name + ".cover.png";
+  if (!File::Exists(m_pending.custom_cover_path))
+    m_pending.custom_cover_path = path + "cover.png";
+  if (!File::Exists(m_pending.custom_cover_path))
+    m_pending.custom_cover_path.clear();
 
-  if (success)
-    m_pending.custom_cover.buffer = {contents.begin(), contents.end()};
-
-  return success;
+  return m_pending.custom_cover_path != m_custom_cover_path;
 }
 
 void GameFile::DownloadDefaultCover()
 {
-  if (!m_default_cover.buffer.empty() || !UseGameCovers() || m_gametdb_id.empty())
+  if (!m_default_cover_path.empty() || !UseGameCovers() || m_gametdb_id.empty())
     return;
 
   const auto cover_path = File::GetUserPath(D_COVERCACHE_IDX) + DIR_SEP;
@@ -302,31 +349,26 @@ void GameFile::DownloadDefaultCover()
 
 bool GameFile::DefaultCoverChanged()
 {
-  if (!m_default_cover.buffer.empty() || !UseGameCovers())
+  if (!m_default_cover_path.empty() || !UseGameCovers() || m_gametdb_id.empty())
     return false;
 
-  const auto cover_path = File::GetUserPath(D_COVERCACHE_IDX) + DIR_SEP;
-
-  std::string contents;
-
-  File::ReadFileToString(cover_path + m_gametdb_id + ".png", contents);
-
-  if (contents.empty())
+  const auto cover_path = File::GetUserPath(D_COVERCACHE_IDX) + DIR_SEP + m_gametdb_id + ".png";
+  if (File::GetSize(cover_path) == 0)
     return false;
 
-  m_pending.default_cover.buffer = {contents.begin(), contents.end()};
+  m_pending.default_cover_path = cover_path;
 
   return true;
 }
 
 void GameFile::CustomCoverCommit()
 {
-  m_custom_cover = std::move(m_pending.custom_cover);
+  m_custom_cover_path = std::move(m_pending.custom_cover_path);
 }
 
 void GameFile::DefaultCoverCommit()
 {
-  m_default_cover = std::move(m_pending.default_cover);
+  m_default_cover_path = std::move(m_pending.default_cover_path);
 }
 
 void GameBanner::DoState(PointerWrap& p)
@@ -336,11 +378,6 @@ void GameBanner::DoState(PointerWrap& p)
   p.Do(height);
 }
 
-void GameCover::DoState(PointerWrap& p)
-{
-  p.Do(buffer);
-}
-
 void GameFile::DoState(PointerWrap& p)
 {
   p.Do(m_valid);
@@ -379,8 +416,8 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_custom_maker);
   m_volume_banner.DoState(p);
   m_custom_banner.DoState(p);
-  m_default_cover.DoState(p);
-  m_custom_cover.DoState(p);
+  p.Do(m_default_cover_path);
+  p.Do(m_custom_cover_path);
 }
 
 std::string GameFile::GetExtension() const
@@ -840,9 +877,13 @@ const GameBanner& GameFile::GetBannerImage() const
   return m_custom_banner.empty() ? m_volume_banner : m_custom_banner;
 }
 
-const GameCover& GameFile::GetCoverImage() const
+std::shared_ptr<const GameCover> GameFile::GetCoverImage() const
 {
-  return m_custom_cover.empty() ? m_default_cover : m_custom_cover;
+  static const auto empty_cover = std::make_shared<const GameCover>();
+
+  const std::string& path =
+      m_custom_cover_path.empty() ? m_default_cover_path : m_custom_cover_path;
+  return path.empty() ? empty_cover : GetCoverCache().Get(path);
 }
 
 }  // namespace UICommon
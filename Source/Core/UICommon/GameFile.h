@@ -5,6 +5,7 @@
 
 #include <array>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -31,11 +32,11 @@ struct GameBanner
   void DoState(PointerWrap& p);
 };
 
+// The contents of a cover image file. Covers are only read when they are displayed.
 struct GameCover
 {
   std::vector<u8> buffer;
   bool empty() const { return buffer.empty(); }
-  void DoState(PointerWrap& p);
 };
 
 bool operator==(const GameBanner& lhs, const GameBanner& rhs);
@@ -109,7 +110,7 @@ public:
   bool IsNKit() const { return m_is_nkit; }
   bool IsModDescriptor() const;
   const GameBanner& GetBannerImage() const;
-  const GameCover& GetCoverImage() const;
+  std::shared_ptr<const GameCover> GetCoverImage() const;
   void DoState(PointerWrap& p);
   bool XMLMetadataChanged();
   void XMLMetadataCommit();
@@ -175,8 +176,8 @@ private:
   std::string m_custom_maker;
   GameBanner m_volume_banner{};
   GameBanner m_custom_banner{};
-  GameCover m_default_cover{};
-  GameCover m_custom_cover{};
+  std::string m_default_cover_path;
+  std::string m_custom_cover_path;
 
   // The following data members allow GameFileCache to construct updated versions
   // of GameFiles in a threadsafe way. They should not be handled in DoState.
@@ -187,8 +188,8 @@ private:
     std::string custom_maker;
     GameBanner volume_banner;
     GameBanner custom_banner;
-    GameCover default_cover;
-    GameCover custom_cover;
+    std::string default_cover_path;
+    std::string custom_cover_path;
   } m_pending{};
 };
 
@@ -4,12 +4,14 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -26,7 +28,11 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 23;  // Last changed in PR 10932
+static constexpr u32 CACHE_REVISION = 24;
+
+// Opening game files is mostly bound by I/O, so using more threads than this doesn't help.
+static constexpr size_t MAX_SCAN_THREADS = 8;
+static constexpr size_t SCAN_BATCH_SIZE = 64;
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
@@ -132,19 +138,43 @@ bool GameFileCache::Update(
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
+  //
+  // Opening the files is slow, which adds up for large collections, so they are opened on several
+  // threads. This is done in batches so that games are reported while the rest are being scanned.
+  const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  const size_t num_threads =
+      std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MAX_SCAN_THREADS);
+  std::vector<std::shared_ptr<GameFile>> batch;
+  for (size_t batch_start = 0; batch_start < new_paths.size(); batch_start += SCAN_BATCH_SIZE)
   {
     if (processing_halted)
       break;
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+    const size_t batch_size = std::min(SCAN_BATCH_SIZE, new_paths.size() - batch_start);
+    batch.assign(batch_size, nullptr);
+
+    std::atomic<size_t> next_index = 0;
+    const auto scan = [&] {
+      for (size_t i = next_index++; i < batch_size && !processing_halted; i = next_index++)
+        batch[i] = std::make_shared<GameFile>(new_paths[batch_start + i]);
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < std::min(num_threads, batch_size); ++i)
+      threads.emplace_back(scan);
+    scan();
+    for (std::thread& thread : threads)
+      thread.join();
+
+    for (std::shared_ptr<GameFile>& file : batch)
     {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
+      if (file && file->IsValid())
+      {
+        if (game_added_to_cache)
+          game_added_to_cache(file);
 
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
+        cache_changed = true;
+        m_cached_files.push_back(std::move(file));
+      }
     }
   }
 
@@ -160,11 +160,16 @@ void InitControllers(const WindowSystemInfo& wsi)
   }
 
   GCAdapter::Init();
+  InitEmulatedControllers();
+  HotkeyManagerEmu::Initialize();
+}
+
+void InitEmulatedControllers()
+{
   Pad::Initialize();
   Pad::InitializeGBA();
   Keyboard::Initialize();
   Wiimote::Initialize(Wiimote::InitializeMode::DO_NOT_WAIT_FOR_WIIMOTES);
-  HotkeyManagerEmu::Initialize();
   FreeLook::Initialize();
 }
 
@@ -15,6 +15,9 @@ void Init();
 void Shutdown();
 
 void InitControllers(const WindowSystemInfo& wsi);
+// Only creates the emulated controllers, without any host input backends or hotkeys, for headless
+// runs that never read input from the host.
+void InitEmulatedControllers();
 void ShutdownControllers();
 
 #ifdef HAVE_X11
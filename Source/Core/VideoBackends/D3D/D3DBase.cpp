@@ -5,14 +5,20 @@
 
 #include <algorithm>
 #include <array>
+#include <condition_variable>
+#include <deque>
+#include <thread>
 
+#include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/DynamicLibrary.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Thread.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
 #include "VideoBackends/D3D/D3DState.h"
+#include "VideoBackends/D3D/D3DSwapChain.h"
 #include "VideoBackends/D3D/DXTexture.h"
 #include "VideoBackends/D3DCommon/D3DCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -26,17 +32,134 @@ ComPtr<IDXGIFactory> dxgi_factory;
 ComPtr<ID3D11Device> device;
 ComPtr<ID3D11Device1> device1;
 ComPtr<ID3D11DeviceContext> context;
+ComPtr<ID3D11DeviceContext> immediate_context;
 D3D_FEATURE_LEVEL feature_level;
 
 static ComPtr<ID3D11Debug> s_debug;
 
+// Limits how many frames the GPU thread can record ahead of the worker's presents.
+constexpr u32 MAX_PENDING_PRESENTS = 2;
+
+struct PendingCommandList
+{
+  ComPtr<ID3D11CommandList> command_list;
+  SwapChain* present_swap_chain;
+};
+
+static bool s_using_command_lists = false;
+static u64 s_command_list_count = 0;
+static std::thread s_command_list_thread;
+static std::mutex s_command_list_mutex;
+static std::condition_variable s_command_list_submitted_cv;
+static std::condition_variable s_command_list_executed_cv;
+static std::deque<PendingCommandList> s_pending_command_lists;
+static u32 s_pending_presents = 0;
+static bool s_executing_command_list = false;
+static bool s_command_list_thread_exit = false;
+static std::mutex s_immediate_context_mutex;
+
 constexpr std::array<D3D_FEATURE_LEVEL, 3> s_supported_feature_levels{
     D3D_FEATURE_LEVEL_11_0,
     D3D_FEATURE_LEVEL_10_1,
     D3D_FEATURE_LEVEL_10_0,
 };
 
-bool Create(u32 adapter_index, bool enable_debug_layer)
+static bool SupportsCommandLists()
+{
+  // Runtime-emulated command lists only add overhead over recording on the immediate context.
+  D3D11_FEATURE_DATA_THREADING threading{};
+  if (FAILED(device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threading,
+                                         sizeof(threading))) ||
+      !threading.DriverCommandLists)
+  {
+    return false;
+  }
+
+  // Texel buffers are streamed with NO_OVERWRITE maps, which deferred contexts only allow for
+  // buffers bound as shader resources with this option.
+  D3D11_FEATURE_DATA_D3D11_OPTIONS options{};
+  if (FAILED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))))
+    return false;
+
+  return options.MapNoOverwriteOnDynamicBufferSRV != FALSE;
+}
+
+static void CommandListThreadFunc()
+{
+  Common::SetCurrentThreadName("D3D11 Command List Thread");
+
+  std::unique_lock lock(s_command_list_mutex);
+  for (;;)
+  {
+    s_command_list_submitted_cv.wait(
+        lock, [] { return !s_pending_command_lists.empty() || s_command_list_thread_exit; });
+    if (s_pending_command_lists.empty())
+      break;
+
+    PendingCommandList pending = std::move(s_pending_command_lists.front());
+    s_pending_command_lists.pop_front();
+    s_executing_command_list = true;
+    lock.unlock();
+
+    {
+      std::lock_guard immediate_lock(s_immediate_context_mutex);
+      immediate_context->ExecuteCommandList(pending.command_list.Get(), FALSE);
+      if (pending.present_swap_chain)
+        pending.present_swap_chain->Present();
+      else
+        immediate_context->Flush();
+    }
+    pending.command_list.Reset();
+
+    lock.lock();
+    s_executing_command_list = false;
+    if (pending.present_swap_chain)
+      s_pending_presents--;
+    s_command_list_executed_cv.notify_all();
+  }
+}
+
+static void CreateCommandListContext()
+{
+  if (!SupportsCommandLists())
+  {
+    INFO_LOG_FMT(VIDEO, "Driver command lists are not supported, using the immediate context.");
+    return;
+  }
+
+  ComPtr<ID3D11DeviceContext> deferred_context;
+  const HRESULT hr = device->CreateDeferredContext(0, deferred_context.GetAddressOf());
+  if (FAILED(hr))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to create deferred context: {}", DX11HRWrap(hr));
+    return;
+  }
+
+  // Start counting from one, so dynamic buffers are discarded in the first command list too.
+  context = std::move(deferred_context);
+  s_using_command_lists = true;
+  s_command_list_count = 1;
+  s_command_list_thread = std::thread(CommandListThreadFunc);
+  INFO_LOG_FMT(VIDEO, "Recording commands on a deferred context.");
+}
+
+static void DestroyCommandListContext()
+{
+  WaitForCommandLists();
+
+  {
+    std::lock_guard lock(s_command_list_mutex);
+    s_command_list_thread_exit = true;
+  }
+  s_command_list_submitted_cv.notify_one();
+  s_command_list_thread.join();
+
+  s_command_list_thread_exit = false;
+  s_using_command_lists = false;
+  s_command_list_count = 0;
+}
+
+bool Create(u32 adapter_index, bool enable_debug_layer, bool enable_command_lists)
 {
   PFN_D3D11_CREATE_DEVICE d3d11_create_device;
   if (!s_d3d11_library.Open("d3d11.dll") ||
@@ -77,7 +200,8 @@ bool Create(u32 adapter_index, bool enable_debug_layer)
     hr = d3d11_create_device(
         adapter.Get(), D3D_DRIVER_TYPE_UNKNOWN, nullptr, D3D11_CREATE_DEVICE_DEBUG,
         s_supported_feature_levels.data(), static_cast<UINT>(s_supported_feature_levels.size()),
-        D3D11_SDK_VERSION, device.GetAddressOf(), &feature_level, context.GetAddressOf());
+        D3D11_SDK_VERSION, device.GetAddressOf(), &feature_level,
+        immediate_context.GetAddressOf());
 
     // Debugbreak on D3D error
     if (SUCCEEDED(hr) && SUCCEEDED(hr = device.As(&s_debug)))
@@ -107,7 +231,7 @@ bool Create(u32 adapter_index, bool enable_debug_layer)
     hr = d3d11_create_device(
         adapter.Get(), D3D_DRIVER_TYPE_UNKNOWN, nullptr, 0, s_supported_feature_levels.data(),
         static_cast<UINT>(s_supported_feature_levels.size()), D3D11_SDK_VERSION,
-        device.GetAddressOf(), &feature_level, context.GetAddressOf());
+        device.GetAddressOf(), &feature_level, immediate_context.GetAddressOf());
   }
 
   if (FAILED(hr))
@@ -129,18 +253,27 @@ bool Create(u32 adapter_index, bool enable_debug_layer)
                  DX11HRWrap(hr));
   }
 
+  context = immediate_context;
+  if (enable_command_lists)
+    CreateCommandListContext();
+
   stateman = std::make_unique<StateManager>();
   return true;
 }
 
 void Destroy()
 {
+  if (s_using_command_lists)
+    DestroyCommandListContext();
+
   stateman.reset();
 
   context->ClearState();
-  context->Flush();
+  immediate_context->ClearState();
+  immediate_context->Flush();
 
   context.Reset();
+  immediate_context.Reset();
   device1.Reset();
 
   auto remaining_references = device.Reset();
@@ -167,6 +300,64 @@ void Destroy()
   s_d3d11_library.Close();
 }
 
+bool UsingCommandLists()
+{
+  return s_using_command_lists;
+}
+
+u64 GetCommandListCount()
+{
+  return s_command_list_count;
+}
+
+void SubmitCommandList(SwapChain* present_swap_chain)
+{
+  if (!s_using_command_lists)
+  {
+    if (present_swap_chain)
+      present_swap_chain->Present();
+    else
+      context->Flush();
+    return;
+  }
+
+  // Restore the deferred context's state afterwards, so the state manager's view stays valid.
+  ComPtr<ID3D11CommandList> command_list;
+  const HRESULT hr = context->FinishCommandList(TRUE, command_list.GetAddressOf());
+  ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to finish command list: {}", DX11HRWrap(hr));
+  s_command_list_count++;
+  if (FAILED(hr))
+    return;
+
+  std::unique_lock lock(s_command_list_mutex);
+  if (present_swap_chain)
+  {
+    s_command_list_executed_cv.wait(lock,
+                                    [] { return s_pending_presents < MAX_PENDING_PRESENTS; });
+    s_pending_presents++;
+  }
+
+  s_pending_command_lists.push_back({std::move(command_list), present_swap_chain});
+  s_command_list_submitted_cv.notify_one();
+}
+
+void WaitForCommandLists()
+{
+  if (!s_using_command_lists)
+    return;
+
+  SubmitCommandList();
+
+  std::unique_lock lock(s_command_list_mutex);
+  s_command_list_executed_cv.wait(
+      lock, [] { return s_pending_command_lists.empty() && !s_executing_command_list; });
+}
+
+std::unique_lock<std::mutex> LockImmediateContext()
+{
+  return std::unique_lock(s_immediate_context_mutex);
+}
+
 std::vector<u32> GetAAModes(u32 adapter_index)
 {
   // Use temporary device if we don't have one already.
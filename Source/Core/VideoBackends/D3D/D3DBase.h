@@ -8,6 +8,7 @@
 #include <d3dcompiler.h>
 #include <dxgi1_5.h>
 #include <fmt/format.h>
+#include <mutex>
 #include <vector>
 #include <wrl/client.h>
 
@@ -25,11 +26,32 @@ extern ComPtr<IDXGIFactory> dxgi_factory;
 extern ComPtr<ID3D11Device> device;
 extern ComPtr<ID3D11Device1> device1;
 extern ComPtr<ID3D11DeviceContext> context;
+extern ComPtr<ID3D11DeviceContext> immediate_context;
 extern D3D_FEATURE_LEVEL feature_level;
 
-bool Create(u32 adapter_index, bool enable_debug_layer);
+bool Create(u32 adapter_index, bool enable_debug_layer, bool enable_command_lists);
 void Destroy();
 
+// When command lists are in use, context is a deferred context. Its commands are executed on
+// immediate_context by a worker thread, so recording the next commands overlaps with their
+// submission to the driver. Otherwise, context and immediate_context are the same.
+bool UsingCommandLists();
+
+// Number of command lists recorded so far. Deferred contexts require the first map of a dynamic
+// buffer in each command list to use D3D11_MAP_WRITE_DISCARD.
+u64 GetCommandListCount();
+
+// Closes the current command list and queues it for execution, presenting the swap chain
+// afterwards if one is provided. Without command lists, presents or flushes the context.
+void SubmitCommandList(SwapChain* present_swap_chain = nullptr);
+
+// Submits the current command list, and waits for all queued command lists to be executed. Until
+// the next submission, immediate_context can then be used for readbacks and swap chain changes.
+void WaitForCommandLists();
+
+// Prevents the worker thread from using immediate_context while the lock is held.
+std::unique_lock<std::mutex> LockImmediateContext();
+
 // Returns a list of supported AA modes for the current device.
 std::vector<u32> GetAAModes(u32 adapter_index);
 
@@ -74,15 +74,16 @@ std::vector<BBoxType> D3DBoundingBox::Read(u32 index, u32 length)
 {
   std::vector<BBoxType> values(length);
   D3D::context->CopyResource(m_staging_buffer.Get(), m_buffer.Get());
+  D3D::WaitForCommandLists();
 
   D3D11_MAPPED_SUBRESOURCE map;
-  HRESULT hr = D3D::context->Map(m_staging_buffer.Get(), 0, D3D11_MAP_READ, 0, &map);
+  HRESULT hr = D3D::immediate_context->Map(m_staging_buffer.Get(), 0, D3D11_MAP_READ, 0, &map);
   if (SUCCEEDED(hr))
   {
     std::memcpy(values.data(), reinterpret_cast<const u8*>(map.pData) + sizeof(BBoxType) * index,
                 sizeof(BBoxType) * length);
 
-    D3D::context->Unmap(m_staging_buffer.Get(), 0);
+    D3D::immediate_context->Unmap(m_staging_buffer.Get(), 0);
   }
 
   return values;
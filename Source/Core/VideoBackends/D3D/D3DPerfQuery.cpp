@@ -103,12 +103,15 @@ void PerfQuery::FlushOne()
 {
   auto& entry = m_query_buffer[m_query_read_pos];
 
+  // Query results are only available once the command list ending the query has executed.
+  D3D::WaitForCommandLists();
+
   UINT64 result = 0;
   HRESULT hr = S_FALSE;
   while (hr != S_OK)
   {
     // TODO: Might cause us to be stuck in an infinite loop!
-    hr = D3D::context->GetData(entry.query.Get(), &result, sizeof(result), 0);
+    hr = D3D::immediate_context->GetData(entry.query.Get(), &result, sizeof(result), 0);
   }
 
   // NOTE: Reported pixel metrics should be referenced to native resolution
@@ -132,13 +135,14 @@ void PerfQuery::FlushResults()
 
 void PerfQuery::WeakFlush()
 {
+  const auto lock = D3D::LockImmediateContext();
   while (!IsFlushed())
   {
     auto& entry = m_query_buffer[m_query_read_pos];
 
     UINT64 result = 0;
-    HRESULT hr = D3D::context->GetData(entry.query.Get(), &result, sizeof(result),
-                                       D3D11_ASYNC_GETDATA_DONOTFLUSH);
+    HRESULT hr = D3D::immediate_context->GetData(entry.query.Get(), &result, sizeof(result),
+                                                 D3D11_ASYNC_GETDATA_DONOTFLUSH);
 
     if (hr == S_OK)
     {
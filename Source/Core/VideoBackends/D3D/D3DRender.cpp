@@ -166,14 +166,25 @@ void Renderer::BindBackbuffer(const ClearColor& clear_color)
 
 void Renderer::PresentBackbuffer()
 {
-  m_swap_chain->Present();
+  if (D3D::UsingCommandLists())
+  {
+    // Present only unbinds the back buffer from the immediate context, so unbind it from the
+    // deferred context as well before the worker thread presents.
+    D3D::stateman->UnbindFramebuffer();
+    m_current_framebuffer = nullptr;
+  }
+
+  D3D::SubmitCommandList(m_swap_chain.get());
 }
 
 void Renderer::OnConfigChanged(u32 bits)
 {
   // Quad-buffer changes require swap chain recreation.
   if (bits & CONFIG_CHANGE_BIT_STEREO_MODE && m_swap_chain)
+  {
+    D3D::WaitForCommandLists();
     m_swap_chain->SetStereo(SwapChain::WantsStereo());
+  }
 }
 
 void Renderer::CheckForSwapChainChanges()
@@ -184,6 +195,9 @@ void Renderer::CheckForSwapChainChanges()
   if (!surface_changed && !surface_resized)
     return;
 
+  // The worker thread must be done with the swap chain buffers before they are released.
+  D3D::WaitForCommandLists();
+
   if (surface_changed)
   {
     m_swap_chain->ChangeSurface(m_new_surface_handle);
@@ -271,13 +285,14 @@ std::unique_ptr<BoundingBox> Renderer::CreateBoundingBox() const
 
 void Renderer::Flush()
 {
-  D3D::context->Flush();
+  D3D::SubmitCommandList();
 }
 
 void Renderer::WaitForGPUIdle()
 {
   // There is no glFinish() equivalent in D3D.
-  D3D::context->Flush();
+  D3D::WaitForCommandLists();
+  D3D::immediate_context->Flush();
 }
 
 void Renderer::SetFullscreen(bool enable_fullscreen)
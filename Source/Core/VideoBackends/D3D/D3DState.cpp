@@ -201,6 +201,14 @@ void StateManager::ApplyTextures()
   }
 }
 
+void StateManager::UnbindFramebuffer()
+{
+  D3D::context->OMSetRenderTargets(0, nullptr, nullptr);
+  m_current.framebuffer = nullptr;
+  m_current.uav = nullptr;
+  m_dirtyFlags |= DirtyFlag_Framebuffer;
+}
+
 u32 StateManager::UnsetTexture(ID3D11ShaderResourceView* srv)
 {
   u32 mask = 0;
@@ -205,6 +205,9 @@ public:
     m_pending.use_integer_rtv = enable;
   }
 
+  // Unbinds the render targets, forcing the pending framebuffer to be rebound on the next Apply().
+  void UnbindFramebuffer();
+
   // removes currently set texture from all slots, returns mask of previously bound slots
   u32 UnsetTexture(ID3D11ShaderResourceView* srv);
   void SetTextureByMask(u32 textureSlotMask, ID3D11ShaderResourceView* srv);
@@ -3,11 +3,16 @@
 
 #include "VideoBackends/D3D/D3DVertexManager.h"
 
+#include <cstring>
+#include <memory>
+#include <utility>
+
 #include <d3d11.h>
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
 
 #include "Core/System.h"
 
@@ -55,6 +60,17 @@ static void UpdateConstantBuffer(ID3D11Buffer* const buffer, const void* data, u
   ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, data_size);
 }
 
+// Deferred contexts require the first map of a dynamic buffer in a command list to discard.
+static bool IsFirstMapInCommandList(u64* last_command_list)
+{
+  const u64 command_list = D3D::GetCommandListCount();
+  if (*last_command_list == command_list)
+    return false;
+
+  *last_command_list = command_list;
+  return true;
+}
+
 static ComPtr<ID3D11ShaderResourceView>
 CreateTexelBufferView(ID3D11Buffer* buffer, TexelBufferFormat format, DXGI_FORMAT srv_format)
 {
@@ -67,6 +83,20 @@ CreateTexelBufferView(ID3D11Buffer* buffer, TexelBufferFormat format, DXGI_FORMA
   return srv;
 }
 
+namespace
+{
+class D3DStaticVertexBuffer final : public StaticVertexBuffer
+{
+public:
+  explicit D3DStaticVertexBuffer(ComPtr<ID3D11Buffer> buffer) : m_buffer(std::move(buffer)) {}
+
+  ID3D11Buffer* GetBuffer() const { return m_buffer.Get(); }
+
+private:
+  ComPtr<ID3D11Buffer> m_buffer;
+};
+}  // namespace
+
 VertexManager::VertexManager() = default;
 
 VertexManager::~VertexManager() = default;
@@ -131,7 +161,8 @@ void VertexManager::UploadUtilityUniforms(const void* uniforms, u32 uniforms_siz
 
 bool VertexManager::MapTexelBuffer(u32 required_size, D3D11_MAPPED_SUBRESOURCE& sr)
 {
-  if ((m_texel_buffer_offset + required_size) > TEXEL_STREAM_BUFFER_SIZE)
+  if (IsFirstMapInCommandList(&m_texel_buffer_command_list) ||
+      (m_texel_buffer_offset + required_size) > TEXEL_STREAM_BUFFER_SIZE)
   {
     // Restart buffer.
     HRESULT hr = D3D::context->Map(m_texel_buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &sr);
@@ -232,7 +263,7 @@ void VertexManager::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_in
   }
 
   D3D11_MAP MapType = D3D11_MAP_WRITE_NO_OVERWRITE;
-  if (cursor + totalBufferSize >= BUFFER_SIZE)
+  if (IsFirstMapInCommandList(&m_buffer_command_list) || cursor + totalBufferSize >= BUFFER_SIZE)
   {
     // Wrap around
     m_current_buffer = (m_current_buffer + 1) % BUFFER_COUNT;
@@ -260,6 +291,58 @@ void VertexManager::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_in
   D3D::stateman->SetIndexBuffer(m_buffers[m_current_buffer].Get());
 }
 
+std::unique_ptr<StaticVertexBuffer> VertexManager::CreateStaticVertexBuffer(const void* data,
+                                                                            u32 size)
+{
+  const CD3D11_BUFFER_DESC desc(size, D3D11_BIND_VERTEX_BUFFER, D3D11_USAGE_IMMUTABLE);
+  const D3D11_SUBRESOURCE_DATA initial_data = {data, 0, 0};
+  ComPtr<ID3D11Buffer> buffer;
+  const HRESULT hr = D3D::device->CreateBuffer(&desc, &initial_data, &buffer);
+  if (FAILED(hr))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to create static vertex buffer (size={}): {}", size,
+                 DX11HRWrap(hr));
+    return nullptr;
+  }
+
+  D3DCommon::SetDebugObjectName(buffer.Get(), "Static vertex buffer");
+  ADDSTAT(g_stats.this_frame.bytes_vertex_streamed, size);
+  return std::make_unique<D3DStaticVertexBuffer>(std::move(buffer));
+}
+
+void VertexManager::CommitStaticBuffer(const StaticVertexBuffer& vertex_buffer, u32 vertex_stride,
+                                       u32 num_indices, u32* out_base_vertex, u32* out_base_index)
+{
+  const u32 indexBufferSize = num_indices * sizeof(u16);
+
+  u32 cursor = Common::AlignUp(m_buffer_cursor, sizeof(u16));
+  D3D11_MAP MapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+  if (IsFirstMapInCommandList(&m_buffer_command_list) || cursor + indexBufferSize >= BUFFER_SIZE)
+  {
+    // Wrap around
+    m_current_buffer = (m_current_buffer + 1) % BUFFER_COUNT;
+    cursor = 0;
+    MapType = D3D11_MAP_WRITE_DISCARD;
+  }
+
+  *out_base_vertex = 0;
+  *out_base_index = cursor / sizeof(u16);
+
+  D3D11_MAPPED_SUBRESOURCE map;
+  D3D::context->Map(m_buffers[m_current_buffer].Get(), 0, MapType, 0, &map);
+  std::memcpy(reinterpret_cast<u8*>(map.pData) + cursor, m_cpu_index_buffer.data(),
+              indexBufferSize);
+  D3D::context->Unmap(m_buffers[m_current_buffer].Get(), 0);
+
+  m_buffer_cursor = cursor + indexBufferSize;
+
+  ADDSTAT(g_stats.this_frame.bytes_index_streamed, indexBufferSize);
+
+  D3D::stateman->SetVertexBuffer(
+      static_cast<const D3DStaticVertexBuffer&>(vertex_buffer).GetBuffer(), vertex_stride, 0);
+  D3D::stateman->SetIndexBuffer(m_buffers[m_current_buffer].Get());
+}
+
 void VertexManager::UploadUniforms()
 {
   auto& system = Core::System::GetInstance();
@@ -51,6 +51,10 @@ protected:
   void ResetBuffer(u32 vertex_stride) override;
   void CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_indices, u32* out_base_vertex,
                     u32* out_base_index) override;
+  std::unique_ptr<StaticVertexBuffer> CreateStaticVertexBuffer(const void* data,
+                                                               u32 size) override;
+  void CommitStaticBuffer(const StaticVertexBuffer& vertex_buffer, u32 vertex_stride,
+                          u32 num_indices, u32* out_base_vertex, u32* out_base_index) override;
   void UploadUniforms() override;
 
 private:
@@ -63,6 +67,7 @@ private:
   ComPtr<ID3D11Buffer> m_buffers[BUFFER_COUNT] = {};
   u32 m_current_buffer = 0;
   u32 m_buffer_cursor = 0;
+  u64 m_buffer_command_list = 0;
 
   ComPtr<ID3D11Buffer> m_vertex_constant_buffer = nullptr;
   ComPtr<ID3D11Buffer> m_geometry_constant_buffer = nullptr;
@@ -71,6 +76,7 @@ private:
   ComPtr<ID3D11Buffer> m_texel_buffer = nullptr;
   std::array<ComPtr<ID3D11ShaderResourceView>, NUM_TEXEL_BUFFER_FORMATS> m_texel_buffer_views;
   u32 m_texel_buffer_offset = 0;
+  u64 m_texel_buffer_command_list = 0;
 };
 
 }  // namespace DX11
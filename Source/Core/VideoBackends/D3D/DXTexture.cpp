@@ -296,8 +296,11 @@ bool DXStagingTexture::Map()
   else
     map_type = D3D11_MAP_READ_WRITE;
 
+  // Staging textures are mapped on the immediate context, after the copies have executed.
+  D3D::WaitForCommandLists();
+
   D3D11_MAPPED_SUBRESOURCE sr;
-  HRESULT hr = D3D::context->Map(m_tex.Get(), 0, map_type, 0, &sr);
+  HRESULT hr = D3D::immediate_context->Map(m_tex.Get(), 0, map_type, 0, &sr);
   ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to map readback texture: {}", DX11HRWrap(hr));
   if (FAILED(hr))
     return false;
@@ -312,7 +315,8 @@ void DXStagingTexture::Unmap()
   if (!m_map_pointer)
     return;
 
-  D3D::context->Unmap(m_tex.Get(), 0);
+  const auto lock = D3D::LockImmediateContext();
+  D3D::immediate_context->Unmap(m_tex.Get(), 0);
   m_map_pointer = nullptr;
 }
 
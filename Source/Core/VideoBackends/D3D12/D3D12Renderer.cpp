@@ -55,11 +55,17 @@ bool Renderer::Initialize()
   if (!::Renderer::Initialize())
     return false;
 
+  // Presenting only queues work on the command queue, which is free-threaded, so it can be done
+  // without blocking the GPU thread on vsync.
+  if (m_swap_chain && g_ActiveConfig.bBackendMultithreading)
+    m_present_queue.Start();
+
   return true;
 }
 
 void Renderer::Shutdown()
 {
+  m_present_queue.Stop();
   m_swap_chain.reset();
 
   ::Renderer::Shutdown();
@@ -413,6 +419,8 @@ void Renderer::DispatchComputeShader(const AbstractShader* shader, u32 groupsize
 
 void Renderer::BindBackbuffer(const ClearColor& clear_color)
 {
+  // The current buffer index only advances once the previous frame has been presented.
+  m_present_queue.Wait();
   CheckForSwapChainChanges();
   SetAndClearFramebuffer(m_swap_chain->GetCurrentFramebuffer(), clear_color);
 }
@@ -448,7 +456,7 @@ void Renderer::PresentBackbuffer()
   m_swap_chain->GetCurrentTexture()->TransitionToState(D3D12_RESOURCE_STATE_PRESENT);
   ExecuteCommandList(false);
 
-  m_swap_chain->Present();
+  m_present_queue.Submit([this] { m_swap_chain->Present(); });
 }
 
 void Renderer::OnConfigChanged(u32 bits)
@@ -458,6 +466,7 @@ void Renderer::OnConfigChanged(u32 bits)
   // For quad-buffered stereo we need to change the layer count, so recreate the swap chain.
   if (m_swap_chain && bits & CONFIG_CHANGE_BIT_STEREO_MODE)
   {
+    m_present_queue.Wait();
     ExecuteCommandList(true);
     m_swap_chain->SetStereo(SwapChain::WantsStereo());
   }
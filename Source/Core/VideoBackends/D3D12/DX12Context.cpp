@@ -209,6 +209,14 @@ bool DXContext::CreateCommandQueue()
                                                D3D12_COMMAND_QUEUE_FLAG_NONE};
   HRESULT hr = m_device->CreateCommandQueue(&queue_desc, IID_PPV_ARGS(&m_command_queue));
   ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to create command queue: {}", DX12HRWrap(hr));
+  if (FAILED(hr))
+    return false;
+
+  const D3D12_COMMAND_QUEUE_DESC copy_queue_desc = {D3D12_COMMAND_LIST_TYPE_COPY,
+                                                    D3D12_COMMAND_QUEUE_PRIORITY_NORMAL,
+                                                    D3D12_COMMAND_QUEUE_FLAG_NONE};
+  hr = m_device->CreateCommandQueue(&copy_queue_desc, IID_PPV_ARGS(&m_copy_queue));
+  ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to create copy queue: {}", DX12HRWrap(hr));
   return SUCCEEDED(hr);
 }
 
@@ -220,6 +228,12 @@ bool DXContext::CreateFence()
   if (FAILED(hr))
     return false;
 
+  hr = m_device->CreateFence(m_copy_fence_value, D3D12_FENCE_FLAG_NONE,
+                             IID_PPV_ARGS(&m_copy_fence));
+  ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to create copy fence: {}", DX12HRWrap(hr));
+  if (FAILED(hr))
+    return false;
+
   m_fence_event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
   ASSERT_MSG(VIDEO, m_fence_event != NULL, "Failed to create fence event");
   if (!m_fence_event)
@@ -456,6 +470,25 @@ bool DXContext::CreateCommandLists()
     if (FAILED(hr))
       return false;
 
+    hr = m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY,
+                                          IID_PPV_ARGS(res.copy_command_allocator.GetAddressOf()));
+    ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to create copy command allocator: {}",
+               DX12HRWrap(hr));
+    if (FAILED(hr))
+      return false;
+
+    hr = m_device->CreateCommandList(1, D3D12_COMMAND_LIST_TYPE_COPY,
+                                     res.copy_command_allocator.Get(), nullptr,
+                                     IID_PPV_ARGS(res.copy_command_list.GetAddressOf()));
+    ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to create copy command list: {}", DX12HRWrap(hr));
+    if (FAILED(hr))
+      return false;
+
+    hr = res.copy_command_list->Close();
+    ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Closing new copy command list failed: {}", DX12HRWrap(hr));
+    if (FAILED(hr))
+      return false;
+
     if (!res.descriptor_allocator.Create(m_device.Get(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
                                          TEMPORARY_SLOTS) ||
         !res.sampler_allocator.Create(m_device.Get()))
@@ -480,6 +513,9 @@ void DXContext::MoveToNextCommandList()
   // Begin command list.
   res.command_allocator->Reset();
   res.command_list->Reset(res.command_allocator.Get(), nullptr);
+  res.copy_command_allocator->Reset();
+  res.copy_command_list->Reset(res.copy_command_allocator.Get(), nullptr);
+  res.copy_command_list_used = false;
   res.descriptor_allocator.Reset();
   if (res.sampler_allocator.ShouldReset())
     res.sampler_allocator.Reset();
@@ -492,8 +528,22 @@ void DXContext::ExecuteCommandList(bool wait_for_completion)
 {
   CommandListResources& res = m_command_lists[m_current_command_list];
 
+  // Texture uploads on the copy queue go first. The command list waits for them on the GPU, so the
+  // fence of the command list also covers the copies.
+  HRESULT hr = res.copy_command_list->Close();
+  ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to close copy command list: {}", DX12HRWrap(hr));
+  if (res.copy_command_list_used)
+  {
+    const std::array<ID3D12CommandList*, 1> copy_lists{res.copy_command_list.Get()};
+    m_copy_queue->ExecuteCommandLists(static_cast<UINT>(copy_lists.size()), copy_lists.data());
+    hr = m_copy_queue->Signal(m_copy_fence.Get(), ++m_copy_fence_value);
+    ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to signal copy fence: {}", DX12HRWrap(hr));
+    hr = m_command_queue->Wait(m_copy_fence.Get(), m_copy_fence_value);
+    ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to wait for copy fence: {}", DX12HRWrap(hr));
+  }
+
   // Close and queue command list.
-  HRESULT hr = res.command_list->Close();
+  hr = res.command_list->Close();
   ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to close command list: {}", DX12HRWrap(hr));
   const std::array<ID3D12CommandList*, 1> execute_lists{res.command_list.Get()};
   m_command_queue->ExecuteCommandLists(static_cast<UINT>(execute_lists.size()),
@@ -544,6 +594,13 @@ void DXContext::DestroyPendingResources(CommandListResources& cmdlist)
   cmdlist.pending_resources.clear();
 }
 
+bool DXContext::IsFenceComplete(u64 fence) const
+{
+  // m_completed_fence_value isn't updated here, as WaitForFence relies on it to know which command
+  // lists it still has to clean up.
+  return m_completed_fence_value >= fence || m_fence->GetCompletedValue() >= fence;
+}
+
 void DXContext::WaitForFence(u64 fence)
 {
   if (m_completed_fence_value >= fence)
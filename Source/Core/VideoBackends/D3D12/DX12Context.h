@@ -61,6 +61,15 @@ public:
   ID3D12Device* GetDevice() const { return m_device.Get(); }
   ID3D12CommandQueue* GetCommandQueue() const { return m_command_queue.Get(); }
 
+  // Returns the copy queue command list for the current command list. It is executed right before
+  // the current command list, which waits for the copies to finish.
+  ID3D12GraphicsCommandList* GetCopyCommandList()
+  {
+    CommandListResources& res = m_command_lists[m_current_command_list];
+    res.copy_command_list_used = true;
+    return res.copy_command_list.Get();
+  }
+
   // Returns the current command list, commands can be recorded directly.
   ID3D12GraphicsCommandList* GetCommandList() const
   {
@@ -116,6 +125,9 @@ public:
   // Waits for a specific fence.
   void WaitForFence(u64 fence);
 
+  // Checks whether a specific fence has completed without waiting for it.
+  bool IsFenceComplete(u64 fence) const;
+
   // Defers destruction of a D3D resource (associates it with the current list).
   void DeferResourceDestruction(ID3D12Resource* resource);
 
@@ -139,6 +151,9 @@ private:
   {
     ComPtr<ID3D12CommandAllocator> command_allocator;
     ComPtr<ID3D12GraphicsCommandList> command_list;
+    ComPtr<ID3D12CommandAllocator> copy_command_allocator;
+    ComPtr<ID3D12GraphicsCommandList> copy_command_list;
+    bool copy_command_list_used = false;
     DescriptorAllocator descriptor_allocator;
     SamplerAllocator sampler_allocator;
     std::vector<ID3D12Resource*> pending_resources;
@@ -166,12 +181,17 @@ private:
   ComPtr<ID3D12Debug> m_debug_interface;
   ComPtr<ID3D12Device> m_device;
   ComPtr<ID3D12CommandQueue> m_command_queue;
+  ComPtr<ID3D12CommandQueue> m_copy_queue;
 
   ComPtr<ID3D12Fence> m_fence = nullptr;
   HANDLE m_fence_event = {};
   u32 m_current_fence_value = 0;
   u64 m_completed_fence_value = 0;
 
+  // Signaled by the copy queue, waited on by the command queue.
+  ComPtr<ID3D12Fence> m_copy_fence = nullptr;
+  u64 m_copy_fence_value = 0;
+
   std::array<CommandListResources, NUM_COMMAND_LISTS> m_command_lists;
   u32 m_current_command_list = NUM_COMMAND_LISTS - 1;
 
@@ -12,6 +12,7 @@
 #include "VideoBackends/D3D12/D3D12StreamBuffer.h"
 #include "VideoBackends/D3D12/DX12Context.h"
 #include "VideoBackends/D3D12/DescriptorHeapManager.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace DX12
 {
@@ -90,6 +91,8 @@ std::unique_ptr<DXTexture> DXTexture::Create(const TextureConfig& config, std::s
   }
   if (config.IsComputeImage())
     resource_flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+  else if (!config.IsRenderTarget() && g_ActiveConfig.bAsyncTextureUploads)
+    resource_state = D3D12_RESOURCE_STATE_COMMON;  // Can be uploaded on the copy queue
 
   const D3D12_RESOURCE_DESC resource_desc = {
       D3D12_RESOURCE_DIMENSION_TEXTURE2D,
@@ -212,6 +215,9 @@ void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   // a limiting factor in these scenarios anyway.
   constexpr u32 STAGING_BUFFER_UPLOAD_THRESHOLD = 1024 * 1024 * 4;
 
+  // Uploads of at least a 256x256 RGBA8 texture can use the copy queue.
+  constexpr u32 COPY_QUEUE_UPLOAD_THRESHOLD = 256 * 256 * 4;
+
   // Determine the stride in the stream buffer. It must be aligned to 256 bytes.
   const u32 block_size = GetBlockSizeForFormat(GetFormat());
   const u32 num_rows = Common::AlignUp(height, block_size) / block_size;
@@ -219,8 +225,19 @@ void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   const u32 upload_stride = Common::AlignUp(source_stride, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
   const u32 upload_size = upload_stride * num_rows;
 
+  // Large textures which haven't been used on the command queue yet, which are mostly custom
+  // textures, are uploaded on the copy queue. The copy queue can only write to textures in the
+  // COMMON state, and they decay back to it once the copies have executed. Once the first level
+  // went there, the remaining levels follow.
+  const bool use_copy_queue =
+      m_state == D3D12_RESOURCE_STATE_COMMON &&
+      (m_uploading_on_copy_queue || (level == 0 && upload_size >= COPY_QUEUE_UPLOAD_THRESHOLD &&
+                                     g_ActiveConfig.bAsyncTextureUploads));
+  m_uploading_on_copy_queue = use_copy_queue && level != (m_config.levels - 1);
+
   // Both paths need us in COPY_DEST state, and avoids switching back and forth for mips.
-  TransitionToState(D3D12_RESOURCE_STATE_COPY_DEST);
+  if (!use_copy_queue)
+    TransitionToState(D3D12_RESOURCE_STATE_COPY_DEST);
 
   ComPtr<ID3D12Resource> staging_buffer;
   ID3D12Resource* upload_buffer_resource;
@@ -308,7 +325,9 @@ void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
       {{upload_buffer_offset, D3DCommon::GetDXGIFormatForAbstractFormat(m_config.format, false),
         aligned_width, aligned_height, 1, upload_stride}}};
   const D3D12_BOX src_box{0, 0, 0, aligned_width, aligned_height, 1};
-  g_dx_context->GetCommandList()->CopyTextureRegion(&dst_loc, 0, 0, 0, &src_loc, &src_box);
+  ID3D12GraphicsCommandList* command_list =
+      use_copy_queue ? g_dx_context->GetCopyCommandList() : g_dx_context->GetCommandList();
+  command_list->CopyTextureRegion(&dst_loc, 0, 0, 0, &src_loc, &src_box);
 
   // Preemptively transition to shader read only after uploading the last mip level, as we're
   // likely finished with writes to this texture for now.
@@ -637,6 +656,18 @@ void DXStagingTexture::Flush()
     g_dx_context->WaitForFence(m_completed_fence);
 }
 
+bool DXStagingTexture::IsCopyComplete() const
+{
+  if (!m_needs_flush)
+    return true;
+
+  // A copy in the current command list can't have completed, as it hasn't been executed yet.
+  if (m_completed_fence == g_dx_context->GetCurrentFenceValue())
+    return false;
+
+  return g_dx_context->IsFenceComplete(m_completed_fence);
+}
+
 std::unique_ptr<DXStagingTexture> DXStagingTexture::Create(StagingTextureType type,
                                                            const TextureConfig& config)
 {
@@ -58,6 +58,7 @@ private:
   std::wstring m_name;
 
   mutable D3D12_RESOURCE_STATES m_state;
+  bool m_uploading_on_copy_queue = false;
 };
 
 class DXFramebuffer final : public AbstractFramebuffer
@@ -114,6 +115,7 @@ public:
   bool Map() override;
   void Unmap() override;
   void Flush() override;
+  bool IsCopyComplete() const override;
 
   static std::unique_ptr<DXStagingTexture> Create(StagingTextureType type,
                                                   const TextureConfig& config);
@@ -12,6 +12,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/VideoConfig.h"
 
 static bool IsTearingSupported(IDXGIFactory2* dxgi_factory)
@@ -41,6 +42,9 @@ SwapChain::SwapChain(const WindowSystemInfo& wsi, IDXGIFactory* dxgi_factory, IU
 
 SwapChain::~SwapChain()
 {
+  if (m_frame_latency_handle)
+    CloseHandle(m_frame_latency_handle);
+
   // Can't destroy swap chain while it's fullscreen.
   if (m_swap_chain && GetFullscreenState(m_swap_chain.Get()))
     m_swap_chain->SetFullscreenState(FALSE, nullptr);
@@ -54,7 +58,10 @@ bool SwapChain::WantsStereo()
 u32 SwapChain::GetSwapChainFlags() const
 {
   // This flag is necessary if we want to use a flip-model swapchain without locking the framerate
-  return m_allow_tearing_supported ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+  u32 flags = m_allow_tearing_supported ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+  if (m_frame_latency_waitable)
+    flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+  return flags;
 }
 
 bool SwapChain::CreateSwapChain(bool stereo)
@@ -72,6 +79,9 @@ bool SwapChain::CreateSwapChain(bool stereo)
   if (SUCCEEDED(hr))
   {
     m_allow_tearing_supported = IsTearingSupported(dxgi_factory2.Get());
+    // The waitable object needs a flip-model swap chain, which this path always creates. It can
+    // only be chosen when creating the swap chain, so changing the setting needs a new one.
+    m_frame_latency_waitable = g_ActiveConfig.bLowLatencyPresent;
 
     DXGI_SWAP_CHAIN_DESC1 swap_chain_desc = {};
     swap_chain_desc.Width = m_width;
@@ -122,6 +132,7 @@ bool SwapChain::CreateSwapChain(bool stereo)
     desc.Flags = 0;
 
     m_allow_tearing_supported = false;
+    m_frame_latency_waitable = false;
     hr = m_dxgi_factory->CreateSwapChain(m_d3d_device.Get(), &desc, &m_swap_chain);
   }
 
@@ -131,6 +142,16 @@ bool SwapChain::CreateSwapChain(bool stereo)
     return false;
   }
 
+  if (m_frame_latency_waitable)
+  {
+    Microsoft::WRL::ComPtr<IDXGISwapChain2> swap_chain2;
+    if (SUCCEEDED(m_swap_chain.As(&swap_chain2)) &&
+        SUCCEEDED(swap_chain2->SetMaximumFrameLatency(1)))
+    {
+      m_frame_latency_handle = swap_chain2->GetFrameLatencyWaitableObject();
+    }
+  }
+
   // We handle fullscreen ourselves.
   hr = m_dxgi_factory->MakeWindowAssociation(static_cast<HWND>(m_wsi.render_surface),
                                              DXGI_MWA_NO_WINDOW_CHANGES | DXGI_MWA_NO_ALT_ENTER);
@@ -153,6 +174,12 @@ void SwapChain::DestroySwapChain()
 {
   DestroySwapChainBuffers();
 
+  if (m_frame_latency_handle)
+  {
+    CloseHandle(m_frame_latency_handle);
+    m_frame_latency_handle = nullptr;
+  }
+
   // Can't destroy swap chain while it's fullscreen.
   if (m_swap_chain && GetFullscreenState(m_swap_chain.Get()))
     m_swap_chain->SetFullscreenState(FALSE, nullptr);
@@ -242,9 +269,22 @@ bool SwapChain::Present()
     return false;
   }
 
+  m_last_present_time = Clock::now();
+  WaitForFrameLatency();
   return true;
 }
 
+void SwapChain::WaitForFrameLatency()
+{
+  if (!m_frame_latency_handle)
+    return;
+
+  // Don't hang if the frame is never displayed, e.g. because the window was minimized.
+  constexpr DWORD TIMEOUT_MS = 100;
+  if (WaitForSingleObjectEx(m_frame_latency_handle, TIMEOUT_MS, TRUE) == WAIT_OBJECT_0)
+    g_perf_metrics.CountPresentLatency(Clock::now() - m_last_present_time);
+}
+
 bool SwapChain::ChangeSurface(void* native_handle)
 {
   DestroySwapChain();
@@ -52,6 +52,9 @@ protected:
   virtual bool CreateSwapChainBuffers() = 0;
   virtual void DestroySwapChainBuffers() = 0;
 
+  // Waits until the swap chain has room for another frame, so that at most one frame is queued.
+  void WaitForFrameLatency();
+
   WindowSystemInfo m_wsi;
   Microsoft::WRL::ComPtr<IDXGIFactory> m_dxgi_factory;
   Microsoft::WRL::ComPtr<IDXGISwapChain> m_swap_chain;
@@ -63,6 +66,11 @@ protected:
 
   bool m_stereo = false;
   bool m_allow_tearing_supported = false;
+  // Set when the swap chain was created with a frame latency waitable object, which is signaled
+  // when the previous frame has been displayed.
+  bool m_frame_latency_waitable = false;
+  HANDLE m_frame_latency_handle = nullptr;
+  TimePoint m_last_present_time;
   bool m_has_fullscreen = false;
   bool m_fullscreen_request = false;
 };
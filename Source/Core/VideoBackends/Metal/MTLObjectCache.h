@@ -5,6 +5,7 @@
 
 #include <Metal/Metal.h>
 #include <memory>
+#include <unordered_map>
 
 #include "VideoBackends/Metal/MRCHelpers.h"
 
@@ -89,6 +90,9 @@ public:
 
   id<MTLSamplerState> GetSampler(SamplerState state) { return GetSampler(SamplerSelector(state)); }
 
+  /// Samplers in argument buffers can't have their LOD clamped when bound, so it's part of the key
+  id<MTLSamplerState> GetArgumentBufferSampler(SamplerState state);
+
   void ReloadSamplers();
 
   std::unique_ptr<AbstractPipeline> CreatePipeline(const AbstractPipelineConfig& config);
@@ -98,8 +102,10 @@ private:
   class Internal;
   std::unique_ptr<Internal> m_internal;
   MRCOwned<id<MTLSamplerState>> CreateSampler(SamplerSelector sel);
+  MRCOwned<id<MTLSamplerState>> CreateArgumentBufferSampler(SamplerState state);
   MRCOwned<id<MTLDepthStencilState>> m_dss[DepthStencilSelector::N_VALUES];
   MRCOwned<id<MTLSamplerState>> m_samplers[SamplerSelector::N_VALUES];
+  std::unordered_map<u32, MRCOwned<id<MTLSamplerState>>> m_argument_buffer_samplers;
 };
 
 extern std::unique_ptr<ObjectCache> g_object_cache;
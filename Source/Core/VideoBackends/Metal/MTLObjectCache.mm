@@ -3,11 +3,17 @@
 
 #include "VideoBackends/Metal/MTLObjectCache.h"
 
+#include <cctype>
 #include <map>
 #include <mutex>
 #include <optional>
+#include <string>
+
+#include <fmt/format.h>
 
 #include "Common/Assert.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "VideoBackends/Metal/MTLPipeline.h"
@@ -160,7 +166,7 @@ static const char* to_string(WrapMode wrap)
 
 // clang-format on
 
-MRCOwned<id<MTLSamplerState>> Metal::ObjectCache::CreateSampler(SamplerSelector sel)
+static MRCOwned<MTLSamplerDescriptor*> CreateSamplerDescriptor(SamplerSelector sel)
 {
   @autoreleasepool
   {
@@ -176,14 +182,41 @@ MRCOwned<id<MTLSamplerState>> Metal::ObjectCache::CreateSampler(SamplerSelector
                                       to_string(sel.MagFilter()), to_string(sel.MipFilter()),
                                       to_string(sel.WrapU()), to_string(sel.WrapV()),
                                       sel.AnisotropicFiltering() ? "(AF)" : ""])];
-    return MRCTransfer([Metal::g_device newSamplerStateWithDescriptor:desc]);
+    return desc;
   }
 }
 
+MRCOwned<id<MTLSamplerState>> Metal::ObjectCache::CreateSampler(SamplerSelector sel)
+{
+  auto desc = CreateSamplerDescriptor(sel);
+  return MRCTransfer([Metal::g_device newSamplerStateWithDescriptor:desc]);
+}
+
+MRCOwned<id<MTLSamplerState>> Metal::ObjectCache::CreateArgumentBufferSampler(SamplerState state)
+{
+  // Use the same LOD clamps the state tracker passes when binding samplers directly
+  auto desc = CreateSamplerDescriptor(SamplerSelector(state));
+  [desc setLodMinClamp:static_cast<float>(state.tm1.min_lod.Value())];
+  [desc setLodMaxClamp:static_cast<float>(state.tm1.max_lod.Value())];
+  [desc setSupportArgumentBuffers:YES];
+  return MRCTransfer([Metal::g_device newSamplerStateWithDescriptor:desc]);
+}
+
+id<MTLSamplerState> Metal::ObjectCache::GetArgumentBufferSampler(SamplerState state)
+{
+  const u32 key = SamplerSelector(state).value | (state.tm1.min_lod.Value() << 8) |
+                  (state.tm1.max_lod.Value() << 16);
+  auto& sampler = m_argument_buffer_samplers[key];
+  if (__builtin_expect(!sampler, false))
+    sampler = CreateArgumentBufferSampler(state);
+  return sampler;
+}
+
 void Metal::ObjectCache::ReloadSamplers()
 {
   for (auto& sampler : m_samplers)
     sampler = nullptr;
+  m_argument_buffer_samplers.clear();
 }
 
 // MARK: Pipelines
@@ -270,6 +303,13 @@ static MTLBlendFactor Convert(SrcBlendFactor factor, bool usedualsrc)
 class Metal::ObjectCache::Internal
 {
 public:
+  Internal()
+  {
+    if (g_ActiveConfig.bShaderCache)
+      LoadBinaryArchive();
+  }
+  ~Internal() { SaveBinaryArchive(); }
+
   using StoredPipeline = std::pair<MRCOwned<id<MTLRenderPipelineState>>, PipelineReflection>;
   /// Holds only the things that are actually used in a Metal pipeline
   struct PipelineID
@@ -377,6 +417,126 @@ public:
   std::map<const Shader*, std::vector<PipelineID>> m_shaders;
   std::array<u32, 3> m_pipeline_counter;
 
+  // Compiled pipelines persisted between sessions, so only the first launch pays for the driver
+  // compile. Typed as id since MTLBinaryArchive needs macOS 11.
+  MRCOwned<id> m_binary_archive;
+  std::string m_binary_archive_path;
+  std::mutex m_binary_archive_mtx;
+  bool m_binary_archive_dirty = false;
+
+  static std::string GetBinaryArchivePath()
+  {
+    // The compiled code is only valid for the GPU and driver that produced it, and on macOS the
+    // driver is part of the OS, so key the file on both.
+    std::string key = fmt::format("{}-{}", [[g_device name] UTF8String],
+                                  [[[NSProcessInfo processInfo] operatingSystemVersionString]
+                                      UTF8String]);
+    for (char& c : key)
+    {
+      if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.')
+        c = '_';
+    }
+    return fmt::format("{}Metal-{}.binarchive", File::GetUserPath(D_SHADERCACHE_IDX), key);
+  }
+
+  void LoadBinaryArchive()
+  {
+    if (@available(macOS 11, iOS 14, *))
+    {
+      if (!File::Exists(File::GetUserPath(D_SHADERCACHE_IDX)))
+        File::CreateDir(File::GetUserPath(D_SHADERCACHE_IDX));
+
+      m_binary_archive_path = GetBinaryArchivePath();
+      auto desc = MRCTransfer([MTLBinaryArchiveDescriptor new]);
+      NSError* err = nullptr;
+      if (File::Exists(m_binary_archive_path))
+      {
+        [desc setUrl:[NSURL fileURLWithPath:[NSString stringWithUTF8String:m_binary_archive_path
+                                                                                .c_str()]]];
+        m_binary_archive =
+            MRCTransfer<id>([g_device newBinaryArchiveWithDescriptor:desc error:&err]);
+        if (!m_binary_archive)
+        {
+          WARN_LOG_FMT(VIDEO, "Discarding unreadable Metal pipeline archive {}: {}",
+                       m_binary_archive_path, [[err localizedDescription] UTF8String]);
+          File::Delete(m_binary_archive_path);
+          [desc setUrl:nil];
+        }
+      }
+      if (!m_binary_archive)
+      {
+        m_binary_archive =
+            MRCTransfer<id>([g_device newBinaryArchiveWithDescriptor:desc error:&err]);
+      }
+      if (!m_binary_archive)
+      {
+        WARN_LOG_FMT(VIDEO, "Failed to create Metal pipeline archive: {}",
+                     [[err localizedDescription] UTF8String]);
+      }
+    }
+  }
+
+  void SaveBinaryArchive()
+  {
+    if (@available(macOS 11, iOS 14, *))
+    {
+      std::lock_guard<std::mutex> lock(m_binary_archive_mtx);
+      if (!m_binary_archive || !m_binary_archive_dirty)
+        return;
+
+      NSError* err = nullptr;
+      NSURL* url =
+          [NSURL fileURLWithPath:[NSString stringWithUTF8String:m_binary_archive_path.c_str()]];
+      if (![static_cast<id<MTLBinaryArchive>>(m_binary_archive) serializeToURL:url error:&err])
+      {
+        WARN_LOG_FMT(VIDEO, "Failed to save Metal pipeline archive {}: {}", m_binary_archive_path,
+                     [[err localizedDescription] UTF8String]);
+      }
+      m_binary_archive_dirty = false;
+    }
+  }
+
+  // Looks the pipeline up in the binary archive, returning nil if it isn't there.
+  id<MTLRenderPipelineState> CreatePipelineFromArchive(MTLRenderPipelineDescriptor* desc,
+                                                       MTLRenderPipelineReflection** reflection)
+  {
+    if (@available(macOS 11, iOS 14, *))
+    {
+      if (!m_binary_archive)
+        return nil;
+      [desc setBinaryArchives:@[ static_cast<id<MTLBinaryArchive>>(m_binary_archive) ]];
+      return [g_device
+          newRenderPipelineStateWithDescriptor:desc
+                                       options:MTLPipelineOptionArgumentInfo |
+                                               MTLPipelineOptionFailOnBinaryArchiveMiss
+                                    reflection:reflection
+                                         error:nil];
+    }
+    return nil;
+  }
+
+  void AddPipelineToArchive(MTLRenderPipelineDescriptor* desc)
+  {
+    if (@available(macOS 11, iOS 14, *))
+    {
+      if (!m_binary_archive)
+        return;
+      std::lock_guard<std::mutex> lock(m_binary_archive_mtx);
+      NSError* err = nullptr;
+      if ([static_cast<id<MTLBinaryArchive>>(m_binary_archive)
+              addRenderPipelineFunctionsWithDescriptor:desc
+                                                 error:&err])
+      {
+        m_binary_archive_dirty = true;
+      }
+      else
+      {
+        WARN_LOG_FMT(VIDEO, "Failed to add pipeline to Metal archive: {}",
+                     [[err localizedDescription] UTF8String]);
+      }
+    }
+  }
+
   StoredPipeline CreatePipeline(const AbstractPipelineConfig& config)
   {
     @autoreleasepool
@@ -429,8 +589,11 @@ public:
       [desc setDepthAttachmentPixelFormat:Util::FromAbstract(fs.depth_texture_format)];
       if (Util::HasStencil(fs.depth_texture_format))
         [desc setStencilAttachmentPixelFormat:Util::FromAbstract(fs.depth_texture_format)];
-      NSError* err = nullptr;
       MTLRenderPipelineReflection* reflection = nullptr;
+      if (id<MTLRenderPipelineState> pipe = CreatePipelineFromArchive(desc, &reflection))
+        return std::make_pair(MRCTransfer(pipe), PipelineReflection(reflection));
+
+      NSError* err = nullptr;
       id<MTLRenderPipelineState> pipe =
           [g_device newRenderPipelineStateWithDescriptor:desc
                                                  options:MTLPipelineOptionArgumentInfo
@@ -445,6 +608,7 @@ public:
         return std::make_pair(nullptr, PipelineReflection());
       }
 
+      AddPipelineToArchive(desc);
       return std::make_pair(MRCTransfer(pipe), PipelineReflection(reflection));
     }
   }
@@ -496,9 +660,17 @@ Metal::ObjectCache::CreatePipeline(const AbstractPipelineConfig& config)
   Internal::StoredPipeline pipeline = m_internal->GetOrCreatePipeline(config);
   if (!pipeline.first)
     return nullptr;
+  MRCOwned<id<MTLArgumentEncoder>> argument_encoder;
+  if (g_features.argument_buffers &&
+      (pipeline.second.fragment_buffers & (1 << ARGUMENT_BUFFER_INDEX)))
+  {
+    argument_encoder =
+        MRCRetain(static_cast<const Shader*>(config.pixel_shader)->GetArgumentEncoder());
+  }
   return std::make_unique<Pipeline>(
       std::move(pipeline.first), pipeline.second, Convert(config.rasterization_state.primitive),
-      Convert(config.rasterization_state.cullmode), config.depth_state, config.usage);
+      Convert(config.rasterization_state.cullmode), config.depth_state, config.usage,
+      std::move(argument_encoder));
 }
 
 void Metal::ObjectCache::ShaderDestroyed(const Shader* shader)
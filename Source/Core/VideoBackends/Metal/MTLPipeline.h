@@ -29,7 +29,8 @@ class Pipeline final : public AbstractPipeline
 public:
   explicit Pipeline(MRCOwned<id<MTLRenderPipelineState>> pipeline,
                     const PipelineReflection& reflection, MTLPrimitiveType prim, MTLCullMode cull,
-                    DepthState depth, AbstractPipelineUsage usage);
+                    DepthState depth, AbstractPipelineUsage usage,
+                    MRCOwned<id<MTLArgumentEncoder>> argument_encoder);
 
   id<MTLRenderPipelineState> Get() const { return m_pipeline; }
   MTLPrimitiveType Prim() const { return m_prim; }
@@ -42,6 +43,8 @@ public:
   u32 GetFragmentBuffers() const { return m_reflection.fragment_buffers; }
   bool UsesVertexBuffer(u32 index) const { return m_reflection.vertex_buffers & (1 << index); }
   bool UsesFragmentBuffer(u32 index) const { return m_reflection.fragment_buffers & (1 << index); }
+  /// Null if the pipeline binds its textures and samplers directly
+  id<MTLArgumentEncoder> GetArgumentEncoder() const { return m_argument_encoder; }
 
 private:
   MRCOwned<id<MTLRenderPipelineState>> m_pipeline;
@@ -50,6 +53,7 @@ private:
   DepthStencilSelector m_depth_stencil;
   AbstractPipelineUsage m_usage;
   PipelineReflection m_reflection;
+  MRCOwned<id<MTLArgumentEncoder>> m_argument_encoder;
 };
 
 class ComputePipeline : public Shader
@@ -5,6 +5,8 @@
 
 #include "Common/MsgHandler.h"
 
+#include "VideoBackends/Metal/MTLUtil.h"
+
 static void MarkAsUsed(u32* list, u32 start, u32 length)
 {
   for (u32 i = start; i < start + length; ++i)
@@ -47,17 +49,48 @@ static void GetArguments(NSArray<MTLArgument*>* arguments, u32* textures, u32* s
   }
 }
 
+static void GetArgumentBufferMembers(NSArray<MTLArgument*>* arguments, u32* textures,
+                                     u32* samplers)
+{
+  for (MTLArgument* argument in arguments)
+  {
+    if ([argument type] != MTLArgumentTypeBuffer || [argument index] != ARGUMENT_BUFFER_INDEX ||
+        [argument bufferDataType] != MTLDataTypeStruct)
+    {
+      continue;
+    }
+    for (MTLStructMember* member in [[argument bufferStructType] members])
+    {
+      MTLDataType type = [member dataType];
+      u32 length = 1;
+      if (type == MTLDataTypeArray)
+      {
+        type = [[member arrayType] elementType];
+        length = [[member arrayType] arrayLength];
+      }
+      const u32 idx = [member argumentIndex];
+      if (type == MTLDataTypeTexture && idx + length <= ARGUMENT_BUFFER_FIRST_SAMPLER)
+        MarkAsUsed(textures, idx, length);
+      else if (type == MTLDataTypeSampler && idx >= ARGUMENT_BUFFER_FIRST_SAMPLER)
+        MarkAsUsed(samplers, idx - ARGUMENT_BUFFER_FIRST_SAMPLER, length);
+    }
+  }
+}
+
 Metal::PipelineReflection::PipelineReflection(MTLRenderPipelineReflection* reflection)
 {
   GetArguments([reflection vertexArguments], nullptr, nullptr, &vertex_buffers);
   GetArguments([reflection fragmentArguments], &textures, &samplers, &fragment_buffers);
+  if (g_features.argument_buffers)
+    GetArgumentBufferMembers([reflection fragmentArguments], &textures, &samplers);
 }
 
 Metal::Pipeline::Pipeline(MRCOwned<id<MTLRenderPipelineState>> pipeline,
                           const PipelineReflection& reflection, MTLPrimitiveType prim,
-                          MTLCullMode cull, DepthState depth, AbstractPipelineUsage usage)
+                          MTLCullMode cull, DepthState depth, AbstractPipelineUsage usage,
+                          MRCOwned<id<MTLArgumentEncoder>> argument_encoder)
     : m_pipeline(std::move(pipeline)), m_prim(prim), m_cull(cull), m_depth_stencil(depth),
-      m_usage(usage), m_reflection(reflection)
+      m_usage(usage), m_reflection(reflection), m_argument_encoder(std::move(argument_encoder))
 {
 }
 
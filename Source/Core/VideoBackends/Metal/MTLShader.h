@@ -4,6 +4,7 @@
 #pragma once
 
 #include <Metal/Metal.h>
+#include <mutex>
 
 #include "VideoBackends/Metal/MRCHelpers.h"
 
@@ -19,10 +20,14 @@ public:
   ~Shader();
 
   id<MTLFunction> GetShader() const { return m_shader; }
+  /// Only valid for pixel shaders that use an argument buffer
+  id<MTLArgumentEncoder> GetArgumentEncoder() const;
   BinaryData GetBinary() const override;
 
 private:
   std::string m_msl;
   MRCOwned<id<MTLFunction>> m_shader;
+  mutable std::once_flag m_argument_encoder_once;
+  mutable MRCOwned<id<MTLArgumentEncoder>> m_argument_encoder;
 };
 }  // namespace Metal
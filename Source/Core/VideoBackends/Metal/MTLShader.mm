@@ -2,6 +2,7 @@
 #include "VideoBackends/Metal/MTLShader.h"
 
 #include "VideoBackends/Metal/MTLObjectCache.h"
+#include "VideoBackends/Metal/MTLUtil.h"
 
 Metal::Shader::Shader(ShaderStage stage, std::string msl, MRCOwned<id<MTLFunction>> shader)
     : AbstractShader(stage), m_msl(std::move(msl)), m_shader(std::move(shader))
@@ -13,6 +14,17 @@ Metal::Shader::~Shader()
   g_object_cache->ShaderDestroyed(this);
 }
 
+id<MTLArgumentEncoder> Metal::Shader::GetArgumentEncoder() const
+{
+  // Pipelines sharing a pixel shader share its encoder, so switching between them doesn't need a
+  // new argument buffer.
+  std::call_once(m_argument_encoder_once, [this] {
+    m_argument_encoder =
+        MRCTransfer([m_shader newArgumentEncoderWithBufferIndex:ARGUMENT_BUFFER_INDEX]);
+  });
+  return m_argument_encoder;
+}
+
 AbstractShader::BinaryData Metal::Shader::GetBinary() const
 {
   return BinaryData(m_msl.begin(), m_msl.end());
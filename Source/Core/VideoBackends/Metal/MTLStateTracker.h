@@ -194,6 +194,8 @@ private:
   // MARK: State
   u8 m_dirty_textures;
   u8 m_dirty_samplers;
+  u8 m_dirty_argument_textures;
+  u8 m_dirty_argument_samplers;
   union Flags
   {
     struct
@@ -231,6 +233,9 @@ private:
     id<MTLRenderPipelineState> pipeline;
     std::array<id<MTLBuffer>, 2> vertex_buffers;
     std::array<id<MTLBuffer>, 2> fragment_buffers;
+    id<MTLArgumentEncoder> argument_encoder;
+    id<MTLBuffer> argument_buffer;
+    std::array<id<MTLTexture>, 8> resident_textures;
     u32 width;
     u32 height;
     MathUtil::Rectangle<int> scissor_rect;
@@ -280,6 +285,7 @@ private:
   void CheckViewport();
   void CheckScissor();
   void PrepareRender();
+  void PrepareArgumentBuffer(const Pipeline* pipe);
   void PrepareCompute();
 };
 
@@ -103,6 +103,14 @@ void Metal::StateTracker::UsageTracker::Reset(size_t new_size)
 
 // MARK: - StateTracker
 
+static id<MTLSamplerState> GetSamplerState(const SamplerState& state)
+{
+  // Argument buffer samplers also work when bound directly, for pipelines without textures.
+  if (Metal::g_features.argument_buffers)
+    return Metal::g_object_cache->GetArgumentBufferSampler(state);
+  return Metal::g_object_cache->GetSampler(state);
+}
+
 Metal::StateTracker::StateTracker() : m_backref(std::make_shared<Backref>(this))
 {
   m_flags.should_apply_label = true;
@@ -373,6 +381,8 @@ void Metal::StateTracker::BeginRenderPass(MTLRenderPassDescriptor* descriptor)
   m_flags.NewEncoder();
   m_dirty_samplers = 0xff;
   m_dirty_textures = 0xff;
+  m_dirty_argument_samplers = 0xff;
+  m_dirty_argument_textures = 0xff;
   CheckScissor();
   CheckViewport();
   ASSERT_MSG(VIDEO, m_current_render_encoder, "Failed to create render encoder!");
@@ -467,7 +477,9 @@ void Metal::StateTracker::WaitForFlushedEncoders()
 void Metal::StateTracker::ReloadSamplers()
 {
   for (size_t i = 0; i < std::size(m_state.samplers); ++i)
-    m_state.samplers[i] = g_object_cache->GetSampler(m_state.sampler_states[i]);
+    m_state.samplers[i] = GetSamplerState(m_state.sampler_states[i]);
+  m_dirty_samplers = 0xff;
+  m_dirty_argument_samplers = 0xff;
 }
 
 void Metal::StateTracker::SetManualBufferUpload(bool enabled)
@@ -542,16 +554,18 @@ void Metal::StateTracker::SetTexture(u32 idx, id<MTLTexture> texture)
   {
     m_state.textures[idx] = texture;
     m_dirty_textures |= 1 << idx;
+    m_dirty_argument_textures |= 1 << idx;
   }
 }
 
 void Metal::StateTracker::SetSamplerForce(u32 idx, const SamplerState& sampler)
 {
-  m_state.samplers[idx] = g_object_cache->GetSampler(sampler);
+  m_state.samplers[idx] = GetSamplerState(sampler);
   m_state.sampler_min_lod[idx] = sampler.tm1.min_lod;
   m_state.sampler_max_lod[idx] = sampler.tm1.max_lod;
   m_state.sampler_states[idx] = sampler;
   m_dirty_samplers |= 1 << idx;
+  m_dirty_argument_samplers |= 1 << idx;
 }
 
 void Metal::StateTracker::SetSampler(u32 idx, const SamplerState& sampler)
@@ -578,6 +592,7 @@ void Metal::StateTracker::UnbindTexture(id<MTLTexture> texture)
     {
       m_state.textures[i] = m_dummy_texture;
       m_dirty_textures |= 1 << i;
+      m_dirty_argument_textures |= 1 << i;
     }
   }
 }
@@ -800,20 +815,27 @@ void Metal::StateTracker::PrepareRender()
     if (m_state.vertices)
       SetVertexBufferNow(0, m_state.vertices, 0);
   }
-  if (u8 dirty = m_dirty_textures & pipe->GetTextures())
+  if (pipe->GetArgumentEncoder())
   {
-    m_dirty_textures &= ~pipe->GetTextures();
-    NSRange range = RangeOfBits(dirty);
-    [enc setFragmentTextures:&m_state.textures[range.location] withRange:range];
+    PrepareArgumentBuffer(pipe);
   }
-  if (u8 dirty = m_dirty_samplers & pipe->GetSamplers())
+  else
   {
-    m_dirty_samplers &= ~pipe->GetSamplers();
-    NSRange range = RangeOfBits(dirty);
-    [enc setFragmentSamplerStates:&m_state.samplers[range.location]
-                     lodMinClamps:&m_state.sampler_min_lod[range.location]
-                     lodMaxClamps:&m_state.sampler_max_lod[range.location]
-                        withRange:range];
+    if (u8 dirty = m_dirty_textures & pipe->GetTextures())
+    {
+      m_dirty_textures &= ~pipe->GetTextures();
+      NSRange range = RangeOfBits(dirty);
+      [enc setFragmentTextures:&m_state.textures[range.location] withRange:range];
+    }
+    if (u8 dirty = m_dirty_samplers & pipe->GetSamplers())
+    {
+      m_dirty_samplers &= ~pipe->GetSamplers();
+      NSRange range = RangeOfBits(dirty);
+      [enc setFragmentSamplerStates:&m_state.samplers[range.location]
+                       lodMinClamps:&m_state.sampler_min_lod[range.location]
+                       lodMaxClamps:&m_state.sampler_max_lod[range.location]
+                          withRange:range];
+    }
   }
   if (m_state.perf_query_group != m_current.perf_query_group)
   {
@@ -894,6 +916,72 @@ void Metal::StateTracker::PrepareRender()
   }
 }
 
+void Metal::StateTracker::PrepareArgumentBuffer(const Pipeline* pipe)
+{
+  id<MTLRenderCommandEncoder> enc = m_current_render_encoder;
+  id<MTLArgumentEncoder> arg_enc = pipe->GetArgumentEncoder();
+  const u8 textures = pipe->GetTextures();
+  const u8 samplers = pipe->GetSamplers();
+  if (arg_enc == m_current.argument_encoder && !(m_dirty_argument_textures & textures) &&
+      !(m_dirty_argument_samplers & samplers))
+  {
+    return;
+  }
+
+  // Switching argument encoders always encodes a new buffer, so only this encoder's slots matter.
+  m_dirty_argument_textures = 0;
+  m_dirty_argument_samplers = 0;
+  m_current.argument_encoder = arg_enc;
+
+  const size_t length = [arg_enc encodedLength];
+  DEBUG_ASSERT([arg_enc alignment] <= static_cast<size_t>(AlignMask::Uniform) + 1);
+  Map map = Allocate(UploadBuffer::Uniform, length, AlignMask::Uniform);
+  [arg_enc setArgumentBuffer:map.gpu_buffer offset:map.gpu_offset];
+
+  // Textures referenced through an argument buffer have to be made resident on the encoder.
+  id<MTLResource> new_resident[std::size(m_state.textures)];
+  u32 num_new_resident = 0;
+  for (u32 i = 0; i < std::size(m_state.textures); ++i)
+  {
+    if (textures & (1 << i))
+    {
+      [arg_enc setTexture:m_state.textures[i] atIndex:i];
+      if (m_current.resident_textures[i] != m_state.textures[i])
+      {
+        m_current.resident_textures[i] = m_state.textures[i];
+        new_resident[num_new_resident++] = m_state.textures[i];
+      }
+    }
+    if (samplers & (1 << i))
+      [arg_enc setSamplerState:m_state.samplers[i] atIndex:ARGUMENT_BUFFER_FIRST_SAMPLER + i];
+  }
+  if (num_new_resident)
+  {
+    if (@available(macOS 13, iOS 16, *))
+    {
+      [enc useResources:new_resident
+                  count:num_new_resident
+                  usage:MTLResourceUsageRead
+                 stages:MTLRenderStageFragment];
+    }
+    else
+    {
+      [enc useResources:new_resident count:num_new_resident usage:MTLResourceUsageRead];
+    }
+  }
+
+  if (m_current.argument_buffer == map.gpu_buffer)
+  {
+    [enc setFragmentBufferOffset:map.gpu_offset atIndex:ARGUMENT_BUFFER_INDEX];
+  }
+  else
+  {
+    [enc setFragmentBuffer:map.gpu_buffer offset:map.gpu_offset atIndex:ARGUMENT_BUFFER_INDEX];
+    m_current.argument_buffer = map.gpu_buffer;
+  }
+  ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, Align(length, AlignMask::Uniform));
+}
+
 void Metal::StateTracker::PrepareCompute()
 {
   if (!m_current_compute_encoder)
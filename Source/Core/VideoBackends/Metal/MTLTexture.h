@@ -52,6 +52,7 @@ public:
   bool Map() override;
   void Unmap() override;
   void Flush() override;
+  bool IsCopyComplete() const override;
 
 private:
   MRCOwned<id<MTLBuffer>> m_buffer;
@@ -189,6 +189,11 @@ void Metal::StagingTexture::Flush()
   m_wait_buffer = nullptr;
 }
 
+bool Metal::StagingTexture::IsCopyComplete() const
+{
+  return !m_wait_buffer || [m_wait_buffer status] == MTLCommandBufferStatusCompleted;
+}
+
 Metal::Framebuffer::Framebuffer(AbstractTexture* color, AbstractTexture* depth,  //
                                 u32 width, u32 height, u32 layers, u32 samples)
     : AbstractFramebuffer(color, depth,
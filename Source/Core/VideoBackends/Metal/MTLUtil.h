@@ -21,8 +21,16 @@ struct DeviceFeatures
   /// previous render.  This is the case unless a game uses features like bbox or texture downloads.
   bool manual_buffer_upload;
   bool subgroup_ops;
+  /// Bind pixel shader textures and samplers through a tier 2 argument buffer instead of one by one
+  /// Cuts down on binding calls in draw-heavy games, which Apple GPUs are sensitive to.
+  bool argument_buffers;
 };
 
+/// Fragment buffer index the argument buffer is bound to when using argument buffers
+constexpr u32 ARGUMENT_BUFFER_INDEX = 3;
+/// Argument buffer id of the first sampler, the textures come before it
+constexpr u32 ARGUMENT_BUFFER_FIRST_SAMPLER = 16;
+
 extern DeviceFeatures g_features;
 
 namespace Util
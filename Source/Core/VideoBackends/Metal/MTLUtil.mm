@@ -75,6 +75,7 @@ void Metal::Util::PopulateBackendInfo(VideoConfig* config)
   // Metal requires multisample resolve to be done on a render pass
   config->backend_info.bSupportsPartialMultisampleResolve = false;
   config->backend_info.bSupportsDynamicVertexLoader = true;
+  config->backend_info.bSupportsStaticVertexBuffers = false;
   config->backend_info.bSupportsVSLinePointExpand = true;
 }
 
@@ -255,6 +256,26 @@ void Metal::Util::PopulateBackendInfoFeatures(VideoConfig* config, id<MTLDevice>
 #endif
   if (DriverDetails::HasBug(DriverDetails::BUG_BROKEN_DYNAMIC_SAMPLER_INDEXING))
     config->backend_info.bSupportsDynamicSamplerIndexing = false;
+
+  const bool supports_tier2_argument_buffers =
+      [device argumentBuffersSupport] == MTLArgumentBuffersTier2;
+  switch (config->iUseArgumentBuffers)
+  {
+  case TriState::Off:
+    g_features.argument_buffers = false;
+    break;
+  case TriState::On:
+    g_features.argument_buffers = supports_tier2_argument_buffers;
+    break;
+  case TriState::Auto:
+    g_features.argument_buffers =
+        supports_tier2_argument_buffers && vendor == DriverDetails::VENDOR_APPLE;
+    break;
+  }
+  // Argument buffers are encoded in place, which the private buffers used for manual uploads
+  // don't allow.
+  if (g_features.manual_buffer_upload)
+    g_features.argument_buffers = false;
 }
 
 // clang-format off
@@ -475,6 +496,23 @@ std::optional<std::string> Metal::Util::TranslateShaderToMSL(ShaderStage stage,
       MakeResourceBinding(spv::ExecutionModelGLCompute, 2, 1, 3, 0, 0), // cs/ssbo
   };
 
+  // With argument buffers, set 1 becomes a struct at buffer ARGUMENT_BUFFER_INDEX, whose texture
+  // and sampler ids share a namespace.
+  static constexpr u32 ARGBUF = spirv_cross::kArgumentBufferBinding;
+  static constexpr u32 SMP = ARGUMENT_BUFFER_FIRST_SAMPLER;
+  static const spirv_cross::MSLResourceBinding argument_buffer_bindings[] = {
+      MakeResourceBinding(spv::ExecutionModelFragment,  1, ARGBUF, ARGUMENT_BUFFER_INDEX, 0, 0),
+      MakeResourceBinding(spv::ExecutionModelFragment,  1, 0, 0, 0, SMP + 0), // ps/samp0
+      MakeResourceBinding(spv::ExecutionModelFragment,  1, 1, 0, 1, SMP + 1), // ps/samp1
+      MakeResourceBinding(spv::ExecutionModelFragment,  1, 2, 0, 2, SMP + 2), // ps/samp2
+      MakeResourceBinding(spv::ExecutionModelFragment,  1, 3, 0, 3, SMP + 3), // ps/samp3
+      MakeResourceBinding(spv::ExecutionModelFragment,  1, 4, 0, 4, SMP + 4), // ps/samp4
+      MakeResourceBinding(spv::ExecutionModelFragment,  1, 5, 0, 5, SMP + 5), // ps/samp5
+      MakeResourceBinding(spv::ExecutionModelFragment,  1, 6, 0, 6, SMP + 6), // ps/samp6
+      MakeResourceBinding(spv::ExecutionModelFragment,  1, 7, 0, 7, SMP + 7), // ps/samp7
+      MakeResourceBinding(spv::ExecutionModelFragment,  1, 8, 0, 8, SMP + 8), // ps/samp8
+  };
+
   spirv_cross::CompilerMSL::Options options;
 #if TARGET_OS_OSX
   options.platform = spirv_cross::CompilerMSL::Options::macOS;
@@ -496,10 +534,26 @@ std::optional<std::string> Metal::Util::TranslateShaderToMSL(ShaderStage stage,
   else
     options.set_msl_version(2, 0);
   options.use_framebuffer_fetch_subpasses = true;
+
+  const bool use_argument_buffers = g_features.argument_buffers && stage == ShaderStage::Pixel;
+  if (use_argument_buffers)
+  {
+    // Only the textures and samplers go in an argument buffer, uniforms stay directly bound.
+    options.argument_buffers = true;
+    compiler.add_discrete_descriptor_set(0);
+    compiler.add_discrete_descriptor_set(2);
+    for (auto& binding : argument_buffer_bindings)
+      compiler.add_msl_resource_binding(binding);
+  }
   compiler.set_msl_options(options);
 
   for (auto& binding : resource_bindings)
-    compiler.add_msl_resource_binding(binding);
+  {
+    const bool in_argument_buffer =
+        binding.stage == spv::ExecutionModelFragment && binding.desc_set == 1;
+    if (!use_argument_buffers || !in_argument_buffer)
+      compiler.add_msl_resource_binding(binding);
+  }
 
   std::string output(MSL_HEADER);
   std::string compiled = compiler.compile();
@@ -500,6 +500,15 @@ void OGLStagingTexture::Flush()
   m_needs_flush = false;
 }
 
+bool OGLStagingTexture::IsCopyComplete() const
+{
+  // Without buffer storage, the transfer happens on Map(), so there's nothing to check.
+  if (m_fence == 0)
+    return true;
+
+  return glClientWaitSync(m_fence, 0, 0) != GL_TIMEOUT_EXPIRED;
+}
+
 bool OGLStagingTexture::Map()
 {
   if (m_map_pointer)
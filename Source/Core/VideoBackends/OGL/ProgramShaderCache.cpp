@@ -38,7 +38,6 @@
 
 namespace OGL
 {
-u32 ProgramShaderCache::s_ubo_buffer_size;
 s32 ProgramShaderCache::s_ubo_align = 1;
 GLuint ProgramShaderCache::s_attributeless_VBO = 0;
 GLuint ProgramShaderCache::s_attributeless_VAO = 0;
@@ -225,36 +224,39 @@ void ProgramShaderCache::UploadConstants()
   auto& pixel_shader_manager = system.GetPixelShaderManager();
   auto& vertex_shader_manager = system.GetVertexShaderManager();
   auto& geometry_shader_manager = system.GetGeometryShaderManager();
-  if (pixel_shader_manager.dirty || vertex_shader_manager.dirty || geometry_shader_manager.dirty)
-  {
-    auto buffer = s_buffer->Map(s_ubo_buffer_size, s_ubo_align);
-
-    memcpy(buffer.first, &pixel_shader_manager.constants, sizeof(PixelShaderConstants));
-
-    memcpy(buffer.first + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align),
-           &vertex_shader_manager.constants, sizeof(VertexShaderConstants));
-
-    memcpy(buffer.first + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align) +
-               Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align),
-           &geometry_shader_manager.constants, sizeof(GeometryShaderConstants));
+  const u32 pixel_size =
+      pixel_shader_manager.dirty ? Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align) : 0;
+  const u32 vertex_size =
+      vertex_shader_manager.dirty ? Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align) : 0;
+  const u32 geometry_size = geometry_shader_manager.dirty ?
+                                Common::AlignUp(sizeof(GeometryShaderConstants), s_ubo_align) :
+                                0;
+  const u32 upload_size = pixel_size + vertex_size + geometry_size;
+  if (upload_size == 0)
+    return;
 
-    s_buffer->Unmap(s_ubo_buffer_size);
-    glBindBufferRange(GL_UNIFORM_BUFFER, 1, s_buffer->m_buffer, buffer.second,
-                      sizeof(PixelShaderConstants));
-    glBindBufferRange(GL_UNIFORM_BUFFER, 2, s_buffer->m_buffer,
-                      buffer.second + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align),
-                      sizeof(VertexShaderConstants));
-    glBindBufferRange(GL_UNIFORM_BUFFER, 3, s_buffer->m_buffer,
-                      buffer.second + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align) +
-                          Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align),
-                      sizeof(GeometryShaderConstants));
+  // Only the stages which changed are written and rebound, the other bindings stay valid. Each
+  // binding call is a state change, which is comparatively expensive in most drivers.
+  auto buffer = s_buffer->Map(upload_size, s_ubo_align);
+  u32 offset = 0;
+  const auto upload = [&](u32 index, const void* constants, u32 size, u32 aligned_size) {
+    if (aligned_size == 0)
+      return;
+
+    std::memcpy(buffer.first + offset, constants, size);
+    glBindBufferRange(GL_UNIFORM_BUFFER, index, s_buffer->m_buffer, buffer.second + offset, size);
+    offset += aligned_size;
+  };
+  upload(1, &pixel_shader_manager.constants, sizeof(PixelShaderConstants), pixel_size);
+  upload(2, &vertex_shader_manager.constants, sizeof(VertexShaderConstants), vertex_size);
+  upload(3, &geometry_shader_manager.constants, sizeof(GeometryShaderConstants), geometry_size);
+  s_buffer->Unmap(upload_size);
 
-    pixel_shader_manager.dirty = false;
-    vertex_shader_manager.dirty = false;
-    geometry_shader_manager.dirty = false;
+  pixel_shader_manager.dirty = false;
+  vertex_shader_manager.dirty = false;
+  geometry_shader_manager.dirty = false;
 
-    ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, s_ubo_buffer_size);
-  }
+  ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, upload_size);
 }
 
 void ProgramShaderCache::UploadConstants(const void* data, u32 data_size)
@@ -441,11 +443,6 @@ void ProgramShaderCache::Init()
   // then the UBO will fail.
   glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &s_ubo_align);
 
-  s_ubo_buffer_size =
-      static_cast<u32>(Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align) +
-                       Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align) +
-                       Common::AlignUp(sizeof(GeometryShaderConstants), s_ubo_align));
-
   // We multiply by *4*4 because we need to get down to basic machine units.
   // So multiply by four to get how many floats we have from vec4s
   // Then once more to get bytes
@@ -509,17 +509,27 @@ static u32 VerticalFilter(const std::array<u32, 3>& colors,
   return out_color32;
 }
 
-static u32 GammaCorrection(u32 color, const float gamma_rcp)
+// Gamma correction only depends on the channel value, so it's computed once per copy instead of
+// three times for every pixel.
+static std::array<u8, 256> BuildGammaTable(const float gamma_rcp)
+{
+  std::array<u8, 256> table;
+  for (int i = 0; i < 256; i++)
+  {
+    table[i] =
+        static_cast<u8>(std::clamp(std::pow(i / 255.0f, gamma_rcp) * 255.0f, 0.0f, 255.0f));
+  }
+  return table;
+}
+
+static u32 GammaCorrection(u32 color, const std::array<u8, 256>& gamma_table)
 {
   u8 in_colors[4];
   std::memcpy(&in_colors, &color, sizeof(in_colors));
 
   u8 out_color[4];
   for (int i = BLU_C; i <= RED_C; i++)
-  {
-    out_color[i] = static_cast<u8>(
-        std::clamp(std::pow(in_colors[i] / 255.0f, gamma_rcp) * 255.0f, 0.0f, 255.0f));
-  }
+    out_color[i] = gamma_table[in_colors[i]];
 
   u32 out_color32;
   std::memcpy(&out_color32, out_color, sizeof(out_color32));
@@ -571,7 +581,7 @@ void EncodeXFB(u8* xfb_in_ram, u32 memory_stride, const MathUtil::Rectangle<int>
   const int right = source_rect.right;
   const bool clamp_top = bpmem.triggerEFBCopy.clamp_top;
   const bool clamp_bottom = bpmem.triggerEFBCopy.clamp_bottom;
-  const float gamma_rcp = 1.0f / gamma;
+  const std::array<u8, 256> gamma_table = BuildGammaTable(1.0f / gamma);
   const auto filter_coefficients = bpmem.copyfilter.GetCoefficients();
 
   // this assumes copies will always start on an even (YU) pixel and the
@@ -611,7 +621,7 @@ void EncodeXFB(u8* xfb_in_ram, u32 memory_stride, const MathUtil::Rectangle<int>
       u32 filtered = VerticalFilter(colors, filter_coefficients);
 
       // Gamma correction happens here.
-      filtered = GammaCorrection(filtered, gamma_rcp);
+      filtered = GammaCorrection(filtered, gamma_table);
 
       scanline[i] = ConvertColorToYUV(filtered);
     }
@@ -704,16 +714,15 @@ void ResetPerfQuery()
   perf_values = {};
 }
 
-void IncPerfCounterQuadCount(PerfQueryType type)
+void AddPerfCounterPixels(PerfQueryType type, u32 count)
 {
   // NOTE: hardware doesn't process individual pixels but quads instead.
   // Current software renderer architecture works on pixels though, so
   // we have this "quad" hack here to only increment the registers on
-  // every fourth rendered pixel
+  // every third rendered pixel
   static u32 quad[PQ_NUM_MEMBERS];
-  if (++quad[type] != 3)
-    return;
-  quad[type] = 0;
-  ++perf_values[type];
+  const u32 total = quad[type] + count;
+  quad[type] = total % 3;
+  perf_values[type] += total / 3;
 }
 }  // namespace EfbInterface
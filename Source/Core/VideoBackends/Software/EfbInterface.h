@@ -58,5 +58,8 @@ void EncodeXFB(u8* xfb_in_ram, u32 memory_stride, const MathUtil::Rectangle<int>
 
 u32 GetPerfQueryResult(PerfQueryType type);
 void ResetPerfQuery();
-void IncPerfCounterQuadCount(PerfQueryType type);
+
+// Counts the given number of pixels towards a perf counter. Only every third one counts, which
+// is independent of how the pixels are split up between calls.
+void AddPerfCounterPixels(PerfQueryType type, u32 count);
 }  // namespace EfbInterface
@@ -4,11 +4,18 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Thread.h"
 
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
@@ -96,21 +103,137 @@ struct Slope
   }
 };
 
-static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
+// Everything needed to rasterize one triangle against one scissor rectangle.
+struct TriangleSetup
+{
+  Slope ZSlope;
+  Slope WSlope;
+  Slope ColorSlopes[2][4];
+  Slope TexSlopes[8][3];
+
+  // Half-edge constants and deltas, in 28.4 fixed point
+  s32 C1;
+  s32 C2;
+  s32 C3;
+  s32 DX12;
+  s32 DX23;
+  s32 DX31;
+  s32 DY12;
+  s32 DY23;
+  s32 DY31;
+
+  // Bounding rectangle, clipped to the scissor rectangle
+  s32 minx;
+  s32 maxx;
+  s32 miny;
+  s32 maxy;
+};
+
+// The state of one thread drawing triangles.
+struct RasterContext
+{
+  Tev tev;
+  RasterBlock rasterBlock;
+};
 
-static Tev tev;
-static RasterBlock rasterBlock;
+// With backend multithreading enabled, triangles are binned into screen tiles and only drawn at the
+// end of the batch. A tile is owned by a single thread, which draws the triangles touching it in the
+// order they were submitted. Every EFB pixel thus sees the same sequence of updates as it would if
+// the triangles were drawn one after another. Tiles are aligned to blocks, so the blocks (and with
+// them the LOD calculations) are also the same as when drawing a whole triangle at once.
+static constexpr s32 TILE_SIZE = 32;
+static_assert(TILE_SIZE % BLOCK_SIZE == 0, "Blocks must not straddle tiles");
+static constexpr u32 NUM_TILES_X = (EFB_WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr u32 NUM_TILES_Y = (EFB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr u32 MAX_WORKER_THREADS = 7;
+
+static Slope ZSlope;
+static TriangleSetup s_current_triangle;
+
+static std::vector<TriangleSetup> s_triangles;
+static std::array<std::vector<u32>, NUM_TILES_X * NUM_TILES_Y> s_tile_bins;
+static std::vector<u32> s_used_tiles;
+static std::atomic<u32> s_next_tile{0};
+
+// The first context belongs to the GPU thread, the other ones to the worker threads.
+static std::vector<std::unique_ptr<RasterContext>> s_contexts;
+static std::vector<std::thread> s_workers;
+static std::mutex s_work_mutex;
+static std::condition_variable s_work_cv;
+static std::condition_variable s_done_cv;
+static u64 s_work_generation = 0;
+static u32 s_busy_workers = 0;
+static bool s_exit_workers = false;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+static void RasterizeTiles(RasterContext& context);
+
+static void WorkerThread(RasterContext* context)
+{
+  Common::SetCurrentThreadName("SW Rasterizer");
+
+  u64 generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(s_work_mutex);
+      s_work_cv.wait(lock, [&] { return s_exit_workers || s_work_generation != generation; });
+      if (s_exit_workers)
+        return;
+      generation = s_work_generation;
+    }
+
+    RasterizeTiles(*context);
+
+    {
+      std::lock_guard<std::mutex> lock(s_work_mutex);
+      if (--s_busy_workers == 0)
+        s_done_cv.notify_one();
+    }
+  }
+}
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
   ZSlope = Slope();
+
+  // Leave a core each for the CPU thread and the GPU thread, which also draws.
+  u32 num_workers = 0;
+  if (g_Config.bBackendMultithreading)
+  {
+    num_workers =
+        std::min(std::max(std::thread::hardware_concurrency(), 3u) - 2, MAX_WORKER_THREADS);
+  }
+
+  s_contexts.clear();
+  for (u32 i = 0; i <= num_workers; i++)
+    s_contexts.push_back(std::make_unique<RasterContext>());
+
+  s_exit_workers = false;
+  s_work_generation = 0;
+  for (u32 i = 1; i <= num_workers; i++)
+    s_workers.emplace_back(WorkerThread, s_contexts[i].get());
+}
+
+void Shutdown()
+{
+  {
+    std::lock_guard<std::mutex> lock(s_work_mutex);
+    s_exit_workers = true;
+  }
+  s_work_cv.notify_all();
+  for (std::thread& worker : s_workers)
+    worker.join();
+  s_workers.clear();
+
+  s_contexts.clear();
+  s_triangles.clear();
+  for (std::vector<u32>& bin : s_tile_bins)
+    bin.clear();
+  s_used_tiles.clear();
 }
 
 void ScissorChanged()
@@ -142,29 +265,34 @@ static inline int iround(float x)
 
 void SetTevKonstColors()
 {
-  tev.SetKonstColors();
+  for (auto& context : s_contexts)
+    context->tev.SetKonstColors();
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(RasterContext& context, const TriangleSetup& triangle, s32 x, s32 y, s32 xi,
+                 s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  Tev& tev = context.tev;
+  const RasterBlock& rasterBlock = context.rasterBlock;
+
+  tev.Counters.rasterized_pixels++;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  s32 z = (s32)std::clamp<float>(triangle.ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
+    tev.Counters.perf_pixels[PQ_ZCOMP_INPUT_ZCOMPLOC]++;
     if (bpmem.zmode.testenable)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
         return;
     }
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
+    tev.Counters.perf_pixels[PQ_ZCOMP_OUTPUT_ZCOMPLOC]++;
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
   tev.Position[0] = x;
   tev.Position[1] = y;
@@ -175,7 +303,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      u16 color = (u16)ColorSlopes[i][comp].GetValue(x, y);
+      u16 color = (u16)triangle.ColorSlopes[i][comp].GetValue(x, y);
 
       // clamp color value to 0
       u16 mask = ~(color >> 8);
@@ -207,7 +335,8 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   tev.Draw();
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear, u32 texmap,
+                                u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -218,9 +347,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -258,8 +387,11 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(RasterContext& context, const TriangleSetup& triangle, s32 blockX,
+                       s32 blockY)
 {
+  RasterBlock& rasterBlock = context.rasterBlock;
+
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
     for (s32 xi = 0; xi < BLOCK_SIZE; xi++)
@@ -269,19 +401,19 @@ static void BuildBlock(s32 blockX, s32 blockY)
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / triangle.WSlope.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = triangle.TexSlopes[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = triangle.TexSlopes[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = triangle.TexSlopes[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -291,7 +423,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -303,7 +436,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -320,34 +454,22 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+// Draws the part of the triangle which is inside the given rectangle. The rectangle has to be
+// aligned to blocks.
+static void RasterizeTriangle(RasterContext& context, const TriangleSetup& triangle, s32 left,
+                              s32 top, s32 right, s32 bottom)
 {
-  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
-  // zfreeze depends on it
-  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+  const s32 C1 = triangle.C1;
+  const s32 C2 = triangle.C2;
+  const s32 C3 = triangle.C3;
 
-  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
+  const s32 DX12 = triangle.DX12;
+  const s32 DX23 = triangle.DX23;
+  const s32 DX31 = triangle.DX31;
 
-  // 28.4 fixed-pou32 coordinates. rounded to nearest and adjusted to match hardware output
-  // could also take floor and adjust -8
-  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
-  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
-
-  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
-  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
-
-  // Deltas
-  const s32 DX12 = X1 - X2;
-  const s32 DX23 = X2 - X3;
-  const s32 DX31 = X3 - X1;
-
-  const s32 DY12 = Y1 - Y2;
-  const s32 DY23 = Y2 - Y3;
-  const s32 DY31 = Y3 - Y1;
+  const s32 DY12 = triangle.DY12;
+  const s32 DY23 = triangle.DY23;
+  const s32 DY31 = triangle.DY31;
 
   // Fixed-pos32 deltas
   const s32 FDX12 = DX12 * 16;
@@ -358,70 +480,21 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 FDY23 = DY23 * 16;
   const s32 FDY31 = DY31 * 16;
 
-  // Bounding rectangle
-  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
-  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
-  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
-  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
-
-  // scissor
-  ASSERT(scissor.rect.left >= 0);
-  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
-  ASSERT(scissor.rect.top >= 0);
-  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
-
-  minx = std::max(minx, scissor.rect.left);
-  maxx = std::min(maxx, scissor.rect.right);
-  miny = std::max(miny, scissor.rect.top);
-  maxy = std::min(maxy, scissor.rect.bottom);
-
-  if (minx >= maxx || miny >= maxy)
-    return;
-
-  // Set up the remaining slopes
-  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
-                         scissor.y_off);
-
-  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
-                1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
-
-  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
-  {
-    for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
-  }
-
-  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
-  {
-    for (int comp = 0; comp < 3; comp++)
-    {
-      TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
-                                 v2->texCoords[i][comp] * w[2], ctx);
-    }
-  }
-
-  // Half-edge constants
-  s32 C1 = DY12 * X1 - DX12 * Y1;
-  s32 C2 = DY23 * X2 - DX23 * Y2;
-  s32 C3 = DY31 * X3 - DX31 * Y3;
-
-  // Correct for fill convention
-  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
-    C1++;
-  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
-    C2++;
-  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
-    C3++;
+  const s32 minx = triangle.minx;
+  const s32 maxx = triangle.maxx;
+  const s32 miny = triangle.miny;
+  const s32 maxy = triangle.maxy;
 
   // Start in corner of 2x2 block
-  s32 block_minx = minx & ~(BLOCK_SIZE - 1);
-  s32 block_miny = miny & ~(BLOCK_SIZE - 1);
+  const s32 block_minx = std::max(minx & ~(BLOCK_SIZE - 1), left);
+  const s32 block_miny = std::max(miny & ~(BLOCK_SIZE - 1), top);
+  const s32 block_maxx = std::min(maxx, right);
+  const s32 block_maxy = std::min(maxy, bottom);
 
   // Loop through blocks
-  for (s32 y = block_miny & ~(BLOCK_SIZE - 1); y < maxy; y += BLOCK_SIZE)
+  for (s32 y = block_miny; y < block_maxy; y += BLOCK_SIZE)
   {
-    for (s32 x = block_minx; x < maxx; x += BLOCK_SIZE)
+    for (s32 x = block_minx; x < block_maxx; x += BLOCK_SIZE)
     {
       s32 x1_ = (x + BLOCK_SIZE - 1);
       s32 y1_ = (y + BLOCK_SIZE - 1);
@@ -455,7 +528,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(context, triangle, x, y);
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -465,7 +538,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            Draw(context, triangle, x + ix, y + iy, ix, iy);
           }
         }
       }
@@ -488,7 +561,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
               if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+                Draw(context, triangle, x + ix, y + iy, ix, iy);
             }
 
             CX1 -= FDY12;
@@ -505,6 +578,164 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   }
 }
 
+static void RasterizeTiles(RasterContext& context)
+{
+  while (true)
+  {
+    const u32 i = s_next_tile.fetch_add(1, std::memory_order_relaxed);
+    if (i >= s_used_tiles.size())
+      return;
+
+    const u32 tile = s_used_tiles[i];
+    const s32 left = static_cast<s32>(tile % NUM_TILES_X) * TILE_SIZE;
+    const s32 top = static_cast<s32>(tile / NUM_TILES_X) * TILE_SIZE;
+    for (u32 index : s_tile_bins[tile])
+      RasterizeTriangle(context, s_triangles[index], left, top, left + TILE_SIZE, top + TILE_SIZE);
+  }
+}
+
+static void BinTriangle(u32 index)
+{
+  const TriangleSetup& triangle = s_triangles[index];
+
+  const u32 tile_minx = static_cast<u32>(triangle.minx) / TILE_SIZE;
+  const u32 tile_maxx = static_cast<u32>(triangle.maxx - 1) / TILE_SIZE;
+  const u32 tile_miny = static_cast<u32>(triangle.miny) / TILE_SIZE;
+  const u32 tile_maxy = static_cast<u32>(triangle.maxy - 1) / TILE_SIZE;
+
+  for (u32 tile_y = tile_miny; tile_y <= tile_maxy; tile_y++)
+  {
+    for (u32 tile_x = tile_minx; tile_x <= tile_maxx; tile_x++)
+    {
+      const u32 tile = tile_y * NUM_TILES_X + tile_x;
+      std::vector<u32>& bin = s_tile_bins[tile];
+      if (bin.empty())
+        s_used_tiles.push_back(tile);
+      bin.push_back(index);
+    }
+  }
+}
+
+static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
+                                  const OutputVertexData* v2,
+                                  const BPFunctions::ScissorRect& scissor)
+{
+  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
+  // zfreeze depends on it
+  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+
+  // adapted from http://devmaster.net/posts/6145/advanced-rasterization
+
+  // 28.4 fixed-pou32 coordinates. rounded to nearest and adjusted to match hardware output
+  // could also take floor and adjust -8
+  const s32 Y1 = iround(16.0f * (v0->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y2 = iround(16.0f * (v1->screenPosition.y - scissor.y_off)) - 9;
+  const s32 Y3 = iround(16.0f * (v2->screenPosition.y - scissor.y_off)) - 9;
+
+  const s32 X1 = iround(16.0f * (v0->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
+  const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
+
+  // Bounding rectangle
+  s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
+  s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
+  s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
+  s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
+
+  // scissor
+  ASSERT(scissor.rect.left >= 0);
+  ASSERT(scissor.rect.right <= static_cast<int>(EFB_WIDTH));
+  ASSERT(scissor.rect.top >= 0);
+  ASSERT(scissor.rect.bottom <= static_cast<int>(EFB_HEIGHT));
+
+  minx = std::max(minx, scissor.rect.left);
+  maxx = std::min(maxx, scissor.rect.right);
+  miny = std::max(miny, scissor.rect.top);
+  maxy = std::min(maxy, scissor.rect.bottom);
+
+  if (minx >= maxx || miny >= maxy)
+    return;
+
+  const bool deferred = !s_workers.empty();
+  TriangleSetup& triangle = deferred ? s_triangles.emplace_back() : s_current_triangle;
+
+  triangle.minx = minx;
+  triangle.maxx = maxx;
+  triangle.miny = miny;
+  triangle.maxy = maxy;
+
+  // Set up the remaining slopes
+  const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
+                         scissor.y_off);
+
+  triangle.ZSlope = ZSlope;
+
+  float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
+                1.0f / v2->projectedPosition.w};
+  triangle.WSlope = Slope(w[0], w[1], w[2], ctx);
+
+  for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
+  {
+    for (int comp = 0; comp < 4; comp++)
+    {
+      triangle.ColorSlopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
+  }
+
+  for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
+  {
+    for (int comp = 0; comp < 3; comp++)
+    {
+      triangle.TexSlopes[i][comp] =
+          Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
+                v2->texCoords[i][comp] * w[2], ctx);
+    }
+  }
+
+  // Deltas
+  const s32 DX12 = X1 - X2;
+  const s32 DX23 = X2 - X3;
+  const s32 DX31 = X3 - X1;
+
+  const s32 DY12 = Y1 - Y2;
+  const s32 DY23 = Y2 - Y3;
+  const s32 DY31 = Y3 - Y1;
+
+  // Half-edge constants
+  s32 C1 = DY12 * X1 - DX12 * Y1;
+  s32 C2 = DY23 * X2 - DX23 * Y2;
+  s32 C3 = DY31 * X3 - DX31 * Y3;
+
+  // Correct for fill convention
+  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
+    C1++;
+  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
+    C2++;
+  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
+    C3++;
+
+  triangle.C1 = C1;
+  triangle.C2 = C2;
+  triangle.C3 = C3;
+  triangle.DX12 = DX12;
+  triangle.DX23 = DX23;
+  triangle.DX31 = DX31;
+  triangle.DY12 = DY12;
+  triangle.DY23 = DY23;
+  triangle.DY31 = DY31;
+
+  if (deferred)
+  {
+    BinTriangle(static_cast<u32>(s_triangles.size() - 1));
+  }
+  else
+  {
+    RasterizeTriangle(*s_contexts[0], triangle, 0, 0, static_cast<s32>(EFB_WIDTH),
+                      static_cast<s32>(EFB_HEIGHT));
+  }
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
@@ -513,4 +744,40 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
   for (const auto& scissor : scissors)
     DrawTriangleFrontFace(v0, v1, v2, scissor);
 }
+
+void Flush()
+{
+  if (!s_used_tiles.empty())
+  {
+    // The GPU thread takes part in drawing, so only wake up the workers if there's more than one
+    // tile to draw.
+    const bool use_workers = s_used_tiles.size() > 1;
+    s_next_tile.store(0, std::memory_order_relaxed);
+    if (use_workers)
+    {
+      {
+        std::lock_guard<std::mutex> lock(s_work_mutex);
+        s_busy_workers = static_cast<u32>(s_workers.size());
+        s_work_generation++;
+      }
+      s_work_cv.notify_all();
+    }
+
+    RasterizeTiles(*s_contexts[0]);
+
+    if (use_workers)
+    {
+      std::unique_lock<std::mutex> lock(s_work_mutex);
+      s_done_cv.wait(lock, [] { return s_busy_workers == 0; });
+    }
+
+    for (u32 tile : s_used_tiles)
+      s_tile_bins[tile].clear();
+    s_used_tiles.clear();
+    s_triangles.clear();
+  }
+
+  for (auto& context : s_contexts)
+    context->tev.FlushCounters();
+}
 }  // namespace Rasterizer
@@ -68,7 +68,7 @@ void VideoSoftware::InitBackendInfo()
   g_Config.backend_info.bSupportsDualSourceBlend = true;
   g_Config.backend_info.bSupportsEarlyZ = true;
   g_Config.backend_info.bSupportsPrimitiveRestart = false;
-  g_Config.backend_info.bSupportsMultithreading = false;
+  g_Config.backend_info.bSupportsMultithreading = true;
   g_Config.backend_info.bSupportsComputeShaders = false;
   g_Config.backend_info.bSupportsGPUTextureDecoding = false;
   g_Config.backend_info.bSupportsST3CTextures = false;
@@ -89,6 +89,7 @@ void VideoSoftware::InitBackendInfo()
   g_Config.backend_info.bSupportsSettingObjectNames = false;
   g_Config.backend_info.bSupportsPartialMultisampleResolve = true;
   g_Config.backend_info.bSupportsDynamicVertexLoader = false;
+  g_Config.backend_info.bSupportsStaticVertexBuffers = false;
 
   // aamodes
   g_Config.backend_info.AAModes = {1};
@@ -139,6 +140,7 @@ void VideoSoftware::Shutdown()
   g_shader_cache.reset();
   g_vertex_manager.reset();
   g_renderer.reset();
+  Rasterizer::Shutdown();
   ShutdownShared();
 }
 }  // namespace SW
@@ -29,6 +29,14 @@
 #define ALLOW_TEV_DUMPS 0
 #endif
 
+#if defined(_M_X86) || defined(_M_X86_64)
+#define USE_SSE
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#define USE_NEON
+#include <arm_neon.h>
+#endif
+
 static inline s16 Clamp255(s16 in)
 {
   return std::clamp<s16>(in, 0, 255);
@@ -198,6 +206,145 @@ void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const Inpu
     Reg[ac.dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
 }
 
+void Tev::ClampColor(const TevStageCombiner::ColorCombiner& cc)
+{
+  if (cc.clamp)
+  {
+    Reg[cc.dest].r = Clamp255(Reg[cc.dest].r);
+    Reg[cc.dest].g = Clamp255(Reg[cc.dest].g);
+    Reg[cc.dest].b = Clamp255(Reg[cc.dest].b);
+  }
+  else
+  {
+    Reg[cc.dest].r = Clamp1024(Reg[cc.dest].r);
+    Reg[cc.dest].g = Clamp1024(Reg[cc.dest].g);
+    Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
+  }
+}
+
+void Tev::ClampAlpha(const TevStageCombiner::AlphaCombiner& ac)
+{
+  if (ac.clamp)
+    Reg[ac.dest].a = Clamp255(Reg[ac.dest].a);
+  else
+    Reg[ac.dest].a = Clamp1024(Reg[ac.dest].a);
+}
+
+// Same as DrawColorRegular and DrawAlphaRegular followed by the clamping, but evaluates all four
+// components at once. The vector lanes are in TevColor order, so lane 0 is alpha. The only
+// difference between the color and alpha combiners is that alpha is negated before the
+// rounding shift and color after it, which has to be preserved for hardware-accurate results.
+void Tev::DrawRegular(const TevStageCombiner::ColorCombiner& cc,
+                      const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
+{
+#if defined(USE_SSE) || defined(USE_NEON)
+  // Interleaved (a, b) pairs and their weights, the lerp is a * (256 - c) + b * c
+  alignas(16) s16 ab[8];
+  alignas(16) s16 weights[8];
+  alignas(16) s32 d[4];
+  for (int i = ALP_C; i <= RED_C; i++)
+  {
+    const u16 c = inputs[i].c + (inputs[i].c >> 7);
+    ab[i * 2] = inputs[i].a;
+    ab[i * 2 + 1] = inputs[i].b;
+    weights[i * 2] = 256 - c;
+    weights[i * 2 + 1] = c;
+    d[i] = inputs[i].d + s_BiasLUT[i == ALP_C ? ac.bias : cc.bias];
+  }
+
+  const s32 color_round = (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
+  const s32 alpha_round = (ac.scale == TevScale::Divide2) ? 0 : (ac.op == TevOp::Sub) ? 127 : 128;
+  const s32 color_negate = cc.op == TevOp::Sub ? -1 : 0;
+  const s32 alpha_negate = ac.op == TevOp::Sub ? -1 : 0;
+  const s16 color_min = cc.clamp ? 0 : -1024;
+  const s16 color_max = cc.clamp ? 255 : 1023;
+  const s16 alpha_min = ac.clamp ? 0 : -1024;
+  const s16 alpha_max = ac.clamp ? 255 : 1023;
+
+  alignas(8) s16 result[4];
+
+#if defined(USE_SSE)
+  // SSE2 has no per-lane shifts, but the shift amount only differs between color and alpha.
+  const __m128i alpha_mask = _mm_set_epi32(0, 0, 0, -1);
+  const __m128i color_lshift = _mm_cvtsi32_si128(s_ScaleLShiftLUT[cc.scale]);
+  const __m128i alpha_lshift = _mm_cvtsi32_si128(s_ScaleLShiftLUT[ac.scale]);
+  const __m128i color_rshift = _mm_cvtsi32_si128(s_ScaleRShiftLUT[cc.scale]);
+  const __m128i alpha_rshift = _mm_cvtsi32_si128(s_ScaleRShiftLUT[ac.scale]);
+  const auto select = [&](__m128i color, __m128i alpha) {
+    return _mm_or_si128(_mm_andnot_si128(alpha_mask, color), _mm_and_si128(alpha_mask, alpha));
+  };
+
+  __m128i temp = _mm_madd_epi16(_mm_load_si128(reinterpret_cast<const __m128i*>(ab)),
+                                _mm_load_si128(reinterpret_cast<const __m128i*>(weights)));
+  temp = select(_mm_sll_epi32(temp, color_lshift), _mm_sll_epi32(temp, alpha_lshift));
+  temp = _mm_add_epi32(temp, _mm_set_epi32(color_round, color_round, color_round, alpha_round));
+
+  const __m128i pre_negate = _mm_set_epi32(0, 0, 0, alpha_negate);
+  const __m128i post_negate = _mm_set_epi32(color_negate, color_negate, color_negate, 0);
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, pre_negate), pre_negate);
+  temp = _mm_srai_epi32(temp, 8);
+  temp = _mm_sub_epi32(_mm_xor_si128(temp, post_negate), post_negate);
+
+  __m128i out = _mm_load_si128(reinterpret_cast<const __m128i*>(d));
+  out = select(_mm_sll_epi32(out, color_lshift), _mm_sll_epi32(out, alpha_lshift));
+  out = _mm_add_epi32(out, temp);
+  out = select(_mm_sra_epi32(out, color_rshift), _mm_sra_epi32(out, alpha_rshift));
+
+  // The results always fit in 16 bits, so the saturation of the pack doesn't matter
+  __m128i packed = _mm_packs_epi32(out, out);
+  packed = _mm_max_epi16(packed, _mm_set_epi16(color_min, color_min, color_min, alpha_min,
+                                               color_min, color_min, color_min, alpha_min));
+  packed = _mm_min_epi16(packed, _mm_set_epi16(color_max, color_max, color_max, alpha_max,
+                                               color_max, color_max, color_max, alpha_max));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(result), packed);
+#else
+  const s32 lshift_values[4] = {s_ScaleLShiftLUT[ac.scale], s_ScaleLShiftLUT[cc.scale],
+                                s_ScaleLShiftLUT[cc.scale], s_ScaleLShiftLUT[cc.scale]};
+  // NEON shifts right by negative amounts
+  const s32 rshift_values[4] = {-s_ScaleRShiftLUT[ac.scale], -s_ScaleRShiftLUT[cc.scale],
+                                -s_ScaleRShiftLUT[cc.scale], -s_ScaleRShiftLUT[cc.scale]};
+  const s32 round_values[4] = {alpha_round, color_round, color_round, color_round};
+  const s32 pre_negate_values[4] = {alpha_negate, 0, 0, 0};
+  const s32 post_negate_values[4] = {0, color_negate, color_negate, color_negate};
+  const s16 min_values[4] = {alpha_min, color_min, color_min, color_min};
+  const s16 max_values[4] = {alpha_max, color_max, color_max, color_max};
+
+  const int32x4_t lshift = vld1q_s32(lshift_values);
+  const int16x4x2_t ab_lanes = vld2_s16(ab);
+  const int16x4x2_t weight_lanes = vld2_s16(weights);
+
+  int32x4_t temp = vmull_s16(ab_lanes.val[0], weight_lanes.val[0]);
+  temp = vmlal_s16(temp, ab_lanes.val[1], weight_lanes.val[1]);
+  temp = vshlq_s32(temp, lshift);
+  temp = vaddq_s32(temp, vld1q_s32(round_values));
+
+  const int32x4_t pre_negate = vld1q_s32(pre_negate_values);
+  const int32x4_t post_negate = vld1q_s32(post_negate_values);
+  temp = vsubq_s32(veorq_s32(temp, pre_negate), pre_negate);
+  temp = vshrq_n_s32(temp, 8);
+  temp = vsubq_s32(veorq_s32(temp, post_negate), post_negate);
+
+  int32x4_t out = vaddq_s32(vshlq_s32(vld1q_s32(d), lshift), temp);
+  out = vshlq_s32(out, vld1q_s32(rshift_values));
+
+  int16x4_t packed = vqmovn_s32(out);
+  packed = vmax_s16(packed, vld1_s16(min_values));
+  packed = vmin_s16(packed, vld1_s16(max_values));
+  vst1_s16(result, packed);
+#endif
+
+  Reg[cc.dest].b = result[BLU_C];
+  Reg[cc.dest].g = result[GRN_C];
+  Reg[cc.dest].r = result[RED_C];
+  Reg[ac.dest].a = result[ALP_C];
+#else
+  DrawColorRegular(cc, inputs);
+  ClampColor(cc);
+  DrawAlphaRegular(ac, inputs);
+  ClampAlpha(ac);
+#endif
+}
+
 static bool AlphaCompare(int alpha, int ref, CompareMode comp)
 {
   switch (comp)
@@ -397,7 +544,7 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+  Counters.tev_pixels_in++;
 
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
@@ -510,33 +657,23 @@ void Tev::Draw()
     inputs[ALP_C].c = m_AlphaInputLUT[ac.c].a;
     inputs[ALP_C].d = m_AlphaInputLUT[ac.d].a;
 
+    if (cc.bias != TevBias::Compare && ac.bias != TevBias::Compare)
+    {
+      DrawRegular(cc, ac, inputs);
+      continue;
+    }
+
     if (cc.bias != TevBias::Compare)
       DrawColorRegular(cc, inputs);
     else
       DrawColorCompare(cc, inputs);
-
-    if (cc.clamp)
-    {
-      Reg[cc.dest].r = Clamp255(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp255(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp255(Reg[cc.dest].b);
-    }
-    else
-    {
-      Reg[cc.dest].r = Clamp1024(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp1024(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
-    }
+    ClampColor(cc);
 
     if (ac.bias != TevBias::Compare)
       DrawAlphaRegular(ac, inputs);
     else
       DrawAlphaCompare(ac, inputs);
-
-    if (ac.clamp)
-      Reg[ac.dest].a = Clamp255(Reg[ac.dest].a);
-    else
-      Reg[ac.dest].a = Clamp1024(Reg[ac.dest].a);
+    ClampAlpha(ac);
   }
 
   // convert to 8 bits per component
@@ -666,21 +803,23 @@ void Tev::Draw()
   if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    Counters.perf_pixels[PQ_ZCOMP_INPUT]++;
 
     if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    Counters.perf_pixels[PQ_ZCOMP_OUTPUT]++;
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  Counters.bbox_left = std::min(Counters.bbox_left, static_cast<u16>(Position[0] & ~1));
+  Counters.bbox_right = std::max(Counters.bbox_right, static_cast<u16>(Position[0] | 1));
+  Counters.bbox_top = std::min(Counters.bbox_top, static_cast<u16>(Position[1] & ~1));
+  Counters.bbox_bottom = std::max(Counters.bbox_bottom, static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  Counters.tev_pixels_out++;
+  Counters.perf_pixels[PQ_BLEND_INPUT]++;
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
@@ -698,3 +837,25 @@ void Tev::SetKonstColors()
     KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
   }
 }
+
+void Tev::FlushCounters()
+{
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, Counters.rasterized_pixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, Counters.tev_pixels_in);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, Counters.tev_pixels_out);
+
+  for (int i = 0; i < PQ_NUM_MEMBERS; i++)
+  {
+    if (Counters.perf_pixels[i] != 0)
+      EfbInterface::AddPerfCounterPixels(static_cast<PerfQueryType>(i), Counters.perf_pixels[i]);
+  }
+
+  // Bounding box updates only ever grow the box, so applying them all at once is equivalent.
+  if (Counters.tev_pixels_out != 0)
+  {
+    BBoxManager::Update(Counters.bbox_left, Counters.bbox_right, Counters.bbox_top,
+                        Counters.bbox_bottom);
+  }
+
+  Counters = {};
+}
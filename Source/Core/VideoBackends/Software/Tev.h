@@ -5,8 +5,10 @@
 
 #include <array>
 
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -206,6 +208,10 @@ class Tev
   void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
   void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
   void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
+  void DrawRegular(const TevStageCombiner::ColorCombiner& cc,
+                   const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
+  void ClampColor(const TevStageCombiner::ColorCombiner& cc);
+  void ClampAlpha(const TevStageCombiner::AlphaCombiner& ac);
 
   void Indirect(unsigned int stageNum, s32 s, s32 t);
 
@@ -226,6 +232,25 @@ public:
     RED_C
   };
 
+  // Side effects of drawing which aren't tied to the drawn pixel. These are gathered per Tev, so
+  // that several of them can draw into disjoint parts of the EFB at the same time.
+  struct DrawCounters
+  {
+    u32 rasterized_pixels = 0;
+    u32 tev_pixels_in = 0;
+    u32 tev_pixels_out = 0;
+    std::array<u32, PQ_NUM_MEMBERS> perf_pixels{};
+
+    u16 bbox_left = 0xffff;
+    u16 bbox_right = 0;
+    u16 bbox_top = 0xffff;
+    u16 bbox_bottom = 0;
+  };
+  DrawCounters Counters;
+
   void SetKonstColors();
   void Draw();
+
+  // Applies the counters to the statistics, perf queries and bounding box, and resets them.
+  void FlushCounters();
 };
@@ -3,6 +3,8 @@
 
 #include "VideoBackends/Software/TextureEncoder.h"
 
+#include <cstring>
+
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/CommonFuncs.h"
@@ -10,6 +12,10 @@
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 
+#ifdef _M_X86_64
+#include "Common/Intrinsics.h"
+#endif
+
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/SWTexture.h"
 
@@ -265,6 +271,258 @@ static void SetSpans(int sBlkSize, int tBlkSize, s32* tSpan, s32* sBlkSpan, s32*
   dstBlockStart += writeStride;                                                                    \
   }
 
+// Vectorized encoders for the most common formats. They encode one row of a block at a time, and
+// give exactly the same results as the per-texel code above.
+
+// Texels are 3 bytes apart, so like the per-texel code, this reads one byte past the texel.
+static inline u32 ReadTexel(const u8* src)
+{
+  u32 texel;
+  std::memcpy(&texel, src, sizeof(texel));
+  return texel;
+}
+
+#ifdef _M_X86_64
+static inline __m128i Load4Texels(const u8* src)
+{
+  return _mm_setr_epi32(ReadTexel(src), ReadTexel(src + 3), ReadTexel(src + 6),
+                        ReadTexel(src + 9));
+}
+
+// Packs the low 16 bits of every 32-bit lane, without saturating.
+static inline __m128i Pack32To16(__m128i a, __m128i b)
+{
+  a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+  b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+  return _mm_packs_epi32(a, b);
+}
+
+static inline __m128i Convert6To8x4(__m128i v)
+{
+  return _mm_or_si128(_mm_slli_epi32(v, 2), _mm_srli_epi32(v, 4));
+}
+
+static inline void UnpackRGBA6(__m128i texels, __m128i* r, __m128i* g, __m128i* b, __m128i* a)
+{
+  const __m128i mask = _mm_set1_epi32(0x3f);
+  *a = Convert6To8x4(_mm_and_si128(texels, mask));
+  *b = Convert6To8x4(_mm_and_si128(_mm_srli_epi32(texels, 6), mask));
+  *g = Convert6To8x4(_mm_and_si128(_mm_srli_epi32(texels, 12), mask));
+  *r = Convert6To8x4(_mm_and_si128(_mm_srli_epi32(texels, 18), mask));
+}
+
+static inline void UnpackRGB8(__m128i texels, __m128i* r, __m128i* g, __m128i* b)
+{
+  const __m128i mask = _mm_set1_epi32(0xff);
+  *b = _mm_and_si128(texels, mask);
+  *g = _mm_and_si128(_mm_srli_epi32(texels, 8), mask);
+  *r = _mm_and_si128(_mm_srli_epi32(texels, 16), mask);
+}
+
+// RGB8_to_I on 16-bit lanes. The sum can't overflow 16 bits.
+static inline __m128i RGB8_to_Ix8(__m128i r, __m128i g, __m128i b)
+{
+  __m128i val = _mm_add_epi16(_mm_set1_epi16(4096), _mm_mullo_epi16(r, _mm_set1_epi16(66)));
+  val = _mm_add_epi16(val, _mm_mullo_epi16(g, _mm_set1_epi16(129)));
+  val = _mm_add_epi16(val, _mm_mullo_epi16(b, _mm_set1_epi16(25)));
+  return _mm_srli_epi16(val, 8);
+}
+
+// Byte swaps the low 16 bits of every 32-bit lane, which is all Pack32To16 keeps.
+static inline __m128i Swap16x4(__m128i v)
+{
+  return _mm_or_si128(_mm_srli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xff00)), 8),
+                      _mm_slli_epi32(v, 8));
+}
+#endif
+
+// RGBA8 blocks keep AR in the first 32 bytes and GB in the second 32 bytes.
+static void EncodeRowRGBA6ToRGBA8(u8* dst, const u8* src)
+{
+#ifdef _M_X86_64
+  __m128i r, g, b, a;
+  UnpackRGBA6(Load4Texels(src), &r, &g, &b, &a);
+  const __m128i ar = _mm_or_si128(a, _mm_slli_epi32(r, 8));
+  const __m128i gb = _mm_or_si128(g, _mm_slli_epi32(b, 8));
+  const __m128i packed = Pack32To16(ar, gb);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), packed);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 32), _mm_srli_si128(packed, 8));
+#else
+  for (int i = 0; i < 4; i++, src += 3, dst += 2)
+    RGBA_to_RGBA8(src, &dst[1], &dst[32], &dst[33], &dst[0]);
+#endif
+}
+
+static void EncodeRowRGBA6ToRGB565(u8* dst, const u8* src)
+{
+#ifdef _M_X86_64
+  const __m128i texels = Load4Texels(src);
+  const __m128i val = _mm_or_si128(
+      _mm_and_si128(_mm_srli_epi32(texels, 8), _mm_set1_epi32(0xf800)),
+      _mm_and_si128(_mm_srli_epi32(texels, 7), _mm_set1_epi32(0x07e0 | 0x001f)));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst),
+                   Pack32To16(Swap16x4(val), _mm_setzero_si128()));
+#else
+  for (int i = 0; i < 4; i++, src += 3, dst += 2)
+  {
+    const u32 srcColor = ReadTexel(src);
+    const u16 val =
+        ((srcColor >> 8) & 0xf800) | ((srcColor >> 7) & 0x07e0) | ((srcColor >> 7) & 0x001f);
+    const u16 swapped = Common::swap16(val);
+    std::memcpy(dst, &swapped, sizeof(swapped));
+  }
+#endif
+}
+
+// I8 blocks are 8 texels wide.
+static void EncodeRowRGBA6ToI8(u8* dst, const u8* src)
+{
+#ifdef _M_X86_64
+  __m128i r0, g0, b0, a0, r1, g1, b1, a1;
+  UnpackRGBA6(Load4Texels(src), &r0, &g0, &b0, &a0);
+  UnpackRGBA6(Load4Texels(src + 12), &r1, &g1, &b1, &a1);
+  const __m128i i = RGB8_to_Ix8(_mm_packs_epi32(r0, r1), _mm_packs_epi32(g0, g1),
+                                _mm_packs_epi32(b0, b1));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(i, i));
+#else
+  u8 r, g, b;
+  for (int i = 0; i < 8; i++, src += 3)
+  {
+    RGBA_to_RGB8(src, &r, &g, &b);
+    dst[i] = RGB8_to_I(r, g, b);
+  }
+#endif
+}
+
+static void EncodeRowRGBA6ToIA8(u8* dst, const u8* src)
+{
+#ifdef _M_X86_64
+  __m128i r, g, b, a;
+  UnpackRGBA6(Load4Texels(src), &r, &g, &b, &a);
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i i =
+      RGB8_to_Ix8(_mm_packs_epi32(r, zero), _mm_packs_epi32(g, zero), _mm_packs_epi32(b, zero));
+  const __m128i ai = _mm_or_si128(_mm_packs_epi32(a, zero), _mm_slli_epi16(i, 8));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), ai);
+#else
+  u8 r, g, b, a;
+  for (int i = 0; i < 4; i++, src += 3)
+  {
+    RGBA_to_RGBA8(src, &r, &g, &b, &a);
+    *dst++ = a;
+    *dst++ = RGB8_to_I(r, g, b);
+  }
+#endif
+}
+
+static void EncodeRowRGB8ToRGBA8(u8* dst, const u8* src)
+{
+#ifdef _M_X86_64
+  __m128i r, g, b;
+  UnpackRGB8(Load4Texels(src), &r, &g, &b);
+  const __m128i ar = _mm_or_si128(_mm_set1_epi32(0xff), _mm_slli_epi32(r, 8));
+  const __m128i gb = _mm_or_si128(g, _mm_slli_epi32(b, 8));
+  const __m128i packed = Pack32To16(ar, gb);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), packed);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 32), _mm_srli_si128(packed, 8));
+#else
+  for (int i = 0; i < 4; i++, src += 3, dst += 2)
+  {
+    dst[0] = 0xff;
+    dst[1] = src[2];
+    dst[32] = src[1];
+    dst[33] = src[0];
+  }
+#endif
+}
+
+static void EncodeRowRGB8ToRGB565(u8* dst, const u8* src)
+{
+#ifdef _M_X86_64
+  __m128i r, g, b;
+  UnpackRGB8(Load4Texels(src), &r, &g, &b);
+  const __m128i val =
+      _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_slli_epi32(r, 8), _mm_set1_epi32(0xf800)),
+                                _mm_and_si128(_mm_slli_epi32(g, 3), _mm_set1_epi32(0x07e0))),
+                   _mm_srli_epi32(b, 3));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst),
+                   Pack32To16(Swap16x4(val), _mm_setzero_si128()));
+#else
+  for (int i = 0; i < 4; i++, src += 3, dst += 2)
+  {
+    const u16 val = ((src[2] << 8) & 0xf800) | ((src[1] << 3) & 0x07e0) | ((src[0] >> 3) & 0x001f);
+    const u16 swapped = Common::swap16(val);
+    std::memcpy(dst, &swapped, sizeof(swapped));
+  }
+#endif
+}
+
+static void EncodeRowRGB8ToI8(u8* dst, const u8* src)
+{
+#ifdef _M_X86_64
+  __m128i r0, g0, b0, r1, g1, b1;
+  UnpackRGB8(Load4Texels(src), &r0, &g0, &b0);
+  UnpackRGB8(Load4Texels(src + 12), &r1, &g1, &b1);
+  const __m128i i = RGB8_to_Ix8(_mm_packs_epi32(r0, r1), _mm_packs_epi32(g0, g1),
+                                _mm_packs_epi32(b0, b1));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(i, i));
+#else
+  for (int i = 0; i < 8; i++, src += 3)
+    dst[i] = RGB8_to_I(src[2], src[1], src[0]);
+#endif
+}
+
+static void EncodeRowRGB8ToIA8(u8* dst, const u8* src)
+{
+#ifdef _M_X86_64
+  __m128i r, g, b;
+  UnpackRGB8(Load4Texels(src), &r, &g, &b);
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i i =
+      RGB8_to_Ix8(_mm_packs_epi32(r, zero), _mm_packs_epi32(g, zero), _mm_packs_epi32(b, zero));
+  const __m128i ai = _mm_or_si128(_mm_set1_epi16(0xff), _mm_slli_epi16(i, 8));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), ai);
+#else
+  for (int i = 0; i < 4; i++, src += 3)
+  {
+    *dst++ = 0xff;
+    *dst++ = RGB8_to_I(src[2], src[1], src[0]);
+  }
+#endif
+}
+
+// Walks the blocks of a full scale copy like ENCODE_LOOP_BLOCKS, calling encode_row for every row
+// of every block. Every row takes row_size bytes, and block_gap bytes are skipped after each block.
+template <typename EncodeRow>
+static void EncodeBlockRows(u8* dst, const u8* src, int blkWidthLog2, int blkHeightLog2,
+                            u32 row_size, u32 block_gap, EncodeRow encode_row)
+{
+  u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
+  s32 tSpan, sBlkSpan, tBlkSpan, writeStride;
+  SetBlockDimensions(blkWidthLog2, blkHeightLog2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
+  SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+
+  const s32 rowSpan = sBlkSize * 3 + tSpan;
+  u8* dstBlockStart = dst;
+  for (int tBlk = 0; tBlk < tBlkCount; tBlk++)
+  {
+    dst = dstBlockStart;
+    for (int sBlk = 0; sBlk < sBlkCount; sBlk++)
+    {
+      for (int t = 0; t < tBlkSize; t++)
+      {
+        encode_row(dst, src);
+        src += rowSpan;
+        dst += row_size;
+      }
+      src += sBlkSpan;
+      dst += block_gap;
+    }
+    src += tBlkSpan;
+    dstBlockStart += writeStride;
+  }
+}
+
 static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 {
   u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
@@ -313,20 +571,14 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::R8_0x1:
   case EFBCopyFormat::R8:
-    SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
     if (yuv)
     {
-      ENCODE_LOOP_BLOCKS
-      {
-        RGBA_to_RGB8(src, &r, &g, &b);
-        src += readStride;
-        *dst++ = RGB8_to_I(r, g, b);
-      }
-      ENCODE_LOOP_SPANS
+      EncodeBlockRows(dst, src, 3, 2, 8, 0, EncodeRowRGBA6ToI8);
     }
     else
     {
+      SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
+      SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
       ENCODE_LOOP_BLOCKS
       {
         u32 srcColor = *(u32*)src;
@@ -363,21 +615,14 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
     break;
 
   case EFBCopyFormat::RA8:
-    SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
     if (yuv)
     {
-      ENCODE_LOOP_BLOCKS
-      {
-        RGBA_to_RGBA8(src, &r, &g, &b, &a);
-        src += readStride;
-        *dst++ = a;
-        *dst++ = RGB8_to_I(r, g, b);
-      }
-      ENCODE_LOOP_SPANS
+      EncodeBlockRows(dst, src, 2, 2, 8, 0, EncodeRowRGBA6ToIA8);
     }
     else
     {
+      SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
+      SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
       ENCODE_LOOP_BLOCKS
       {
         u32 srcColor = *(u32*)src;
@@ -390,19 +635,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
     break;
 
   case EFBCopyFormat::RGB565:
-    SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
-    ENCODE_LOOP_BLOCKS
-    {
-      u32 srcColor = *(u32*)src;
-      src += readStride;
-
-      u16 val =
-          ((srcColor >> 8) & 0xf800) | ((srcColor >> 7) & 0x07e0) | ((srcColor >> 7) & 0x001f);
-      *(u16*)dst = Common::swap16(val);
-      dst += 2;
-    }
-    ENCODE_LOOP_SPANS
+    EncodeBlockRows(dst, src, 2, 2, 8, 0, EncodeRowRGBA6ToRGB565);
     break;
 
   case EFBCopyFormat::RGB5A3:
@@ -429,15 +662,7 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
     break;
 
   case EFBCopyFormat::RGBA8:
-    SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
-    ENCODE_LOOP_BLOCKS
-    {
-      RGBA_to_RGBA8(src, &dst[1], &dst[32], &dst[33], &dst[0]);
-      src += readStride;
-      dst += 2;
-    }
-    ENCODE_LOOP_SPANS2
+    EncodeBlockRows(dst, src, 2, 2, 8, 32, EncodeRowRGBA6ToRGBA8);
     break;
 
   case EFBCopyFormat::A8:
@@ -791,19 +1016,14 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 
   case EFBCopyFormat::R8_0x1:
   case EFBCopyFormat::R8:
-    SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
     if (yuv)
     {
-      ENCODE_LOOP_BLOCKS
-      {
-        *dst++ = RGB8_to_I(src[2], src[1], src[0]);
-        src += readStride;
-      }
-      ENCODE_LOOP_SPANS
+      EncodeBlockRows(dst, src, 3, 2, 8, 0, EncodeRowRGB8ToI8);
     }
     else
     {
+      SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
+      SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
       ENCODE_LOOP_BLOCKS
       {
         *dst++ = src[2];
@@ -837,21 +1057,14 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
     break;
 
   case EFBCopyFormat::RA8:
-    SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
     if (yuv)
     {
-      ENCODE_LOOP_BLOCKS
-      {
-        *dst++ = 0xff;
-        *dst++ = RGB8_to_I(src[2], src[1], src[0]);
-
-        src += readStride;
-      }
-      ENCODE_LOOP_SPANS
+      EncodeBlockRows(dst, src, 2, 2, 8, 0, EncodeRowRGB8ToIA8);
     }
     else
     {
+      SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
+      SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
       ENCODE_LOOP_BLOCKS
       {
         *dst++ = 0xff;
@@ -863,16 +1076,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
     break;
 
   case EFBCopyFormat::RGB565:
-    SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
-    ENCODE_LOOP_BLOCKS
-    {
-      u16 val = ((src[2] << 8) & 0xf800) | ((src[1] << 3) & 0x07e0) | ((src[0] >> 3) & 0x001f);
-      *(u16*)dst = Common::swap16(val);
-      src += readStride;
-      dst += 2;
-    }
-    ENCODE_LOOP_SPANS
+    EncodeBlockRows(dst, src, 2, 2, 8, 0, EncodeRowRGB8ToRGB565);
     break;
 
   case EFBCopyFormat::RGB5A3:
@@ -890,18 +1094,7 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
     break;
 
   case EFBCopyFormat::RGBA8:
-    SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
-    SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
-    ENCODE_LOOP_BLOCKS
-    {
-      dst[0] = 0xff;
-      dst[1] = src[2];
-      dst[32] = src[1];
-      dst[33] = src[0];
-      src += readStride;
-      dst += 2;
-    }
-    ENCODE_LOOP_SPANS2
+    EncodeBlockRows(dst, src, 2, 2, 8, 32, EncodeRowRGB8ToRGBA8);
     break;
 
   case EFBCopyFormat::A8:
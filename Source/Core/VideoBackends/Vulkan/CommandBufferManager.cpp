@@ -51,6 +51,8 @@ bool CommandBufferManager::CreateCommandBuffers()
   VkDevice device = g_vulkan_context->GetDevice();
   VkResult res;
 
+  m_has_transfer_queue = g_vulkan_context->GetTransferQueue() != VK_NULL_HANDLE;
+
   for (CmdBufferResources& resources : m_command_buffers)
   {
     resources.init_command_buffer_used = false;
@@ -93,6 +95,39 @@ bool CommandBufferManager::CreateCommandBuffers()
       LOG_VULKAN_ERROR(res, "vkCreateSemaphore failed: ");
       return false;
     }
+
+    if (m_has_transfer_queue)
+    {
+      VkCommandPoolCreateInfo transfer_pool_info = {
+          VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, nullptr, 0,
+          g_vulkan_context->GetTransferQueueFamilyIndex()};
+      res = vkCreateCommandPool(device, &transfer_pool_info, nullptr,
+                                &resources.transfer_command_pool);
+      if (res != VK_SUCCESS)
+      {
+        LOG_VULKAN_ERROR(res, "vkCreateCommandPool failed: ");
+        return false;
+      }
+
+      VkCommandBufferAllocateInfo transfer_buffer_info = {
+          VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, resources.transfer_command_pool,
+          VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1};
+      res = vkAllocateCommandBuffers(device, &transfer_buffer_info,
+                                     &resources.transfer_command_buffer);
+      if (res != VK_SUCCESS)
+      {
+        LOG_VULKAN_ERROR(res, "vkAllocateCommandBuffers failed: ");
+        return false;
+      }
+
+      res = vkCreateSemaphore(device, &semaphore_create_info, nullptr,
+                              &resources.transfer_semaphore);
+      if (res != VK_SUCCESS)
+      {
+        LOG_VULKAN_ERROR(res, "vkCreateSemaphore failed: ");
+        return false;
+      }
+    }
   }
 
   res = vkCreateSemaphore(device, &semaphore_create_info, nullptr, &m_present_semaphore);
@@ -120,6 +155,8 @@ void CommandBufferManager::DestroyCommandBuffers()
     // objects which are pending destruction being in-use.
     if (resources.command_pool != VK_NULL_HANDLE)
       vkDestroyCommandPool(device, resources.command_pool, nullptr);
+    if (resources.transfer_command_pool != VK_NULL_HANDLE)
+      vkDestroyCommandPool(device, resources.transfer_command_pool, nullptr);
 
     // Destroy any pending objects.
     for (auto& it : resources.cleanup_resources)
@@ -127,6 +164,8 @@ void CommandBufferManager::DestroyCommandBuffers()
 
     if (resources.semaphore != VK_NULL_HANDLE)
       vkDestroySemaphore(device, resources.semaphore, nullptr);
+    if (resources.transfer_semaphore != VK_NULL_HANDLE)
+      vkDestroySemaphore(device, resources.transfer_semaphore, nullptr);
 
     if (resources.fence != VK_NULL_HANDLE)
       vkDestroyFence(device, resources.fence, nullptr);
@@ -220,6 +259,7 @@ bool CommandBufferManager::CreateSubmitThread()
   m_submit_loop = std::make_unique<Common::BlockingLoop>();
   m_submit_thread = std::thread([this]() {
     Common::SetCurrentThreadName("Vulkan CommandBufferManager SubmitThread");
+    Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
 
     m_submit_loop->Run([this]() {
       PendingCommandBufferSubmit submit;
@@ -238,7 +278,7 @@ bool CommandBufferManager::CreateSubmitThread()
       }
 
       SubmitCommandBuffer(submit.command_buffer_index, submit.present_swap_chain,
-                          submit.present_image_index);
+                          submit.present_image_index, submit.present_id);
       CmdBufferResources& resources = m_command_buffers[submit.command_buffer_index];
       resources.waiting_for_submit.store(false, std::memory_order_release);
 
@@ -284,6 +324,26 @@ void CommandBufferManager::WaitForFenceCounter(u64 fence_counter)
   WaitForCommandBufferCompletion(index);
 }
 
+bool CommandBufferManager::IsFenceCounterComplete(u64 fence_counter) const
+{
+  if (m_completed_fence_counter >= fence_counter)
+    return true;
+
+  for (const CmdBufferResources& resources : m_command_buffers)
+  {
+    if (resources.fence_counter != fence_counter)
+      continue;
+
+    if (resources.waiting_for_submit.load(std::memory_order_acquire))
+      return false;
+
+    return vkGetFenceStatus(g_vulkan_context->GetDevice(), resources.fence) == VK_SUCCESS;
+  }
+
+  // The command buffer has been reused since, so it must have completed.
+  return true;
+}
+
 void CommandBufferManager::WaitForCommandBufferCompletion(u32 index)
 {
   CmdBufferResources& resources = m_command_buffers[index];
@@ -342,6 +402,20 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
                     static_cast<int>(res));
     }
   }
+  if (resources.transfer_command_buffer != VK_NULL_HANDLE)
+  {
+    VkResult res = vkEndCommandBuffer(resources.transfer_command_buffer);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkEndCommandBuffer failed: ");
+      PanicAlertFmt("Failed to end command buffer: {} ({})", VkResultToString(res),
+                    static_cast<int>(res));
+    }
+  }
+
+  u64 present_id = 0;
+  if (present_swap_chain != VK_NULL_HANDLE && g_vulkan_context->SupportsPresentWait())
+    present_id = m_next_present_id++;
 
   // Submitting off-thread?
   if (m_use_threaded_submission && submit_on_worker_thread && !wait_for_completion)
@@ -351,7 +425,8 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
     {
       std::lock_guard<std::mutex> guard(m_pending_submit_lock);
       m_submit_worker_idle = false;
-      m_pending_submits.push_back({present_swap_chain, present_image_index, m_current_cmd_buffer});
+      m_pending_submits.push_back(
+          {present_swap_chain, present_image_index, m_current_cmd_buffer, present_id});
     }
 
     // Wake up the worker thread for a single iteration.
@@ -362,7 +437,7 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
     WaitForWorkerThreadIdle();
 
     // Pass through to normal submission path.
-    SubmitCommandBuffer(m_current_cmd_buffer, present_swap_chain, present_image_index);
+    SubmitCommandBuffer(m_current_cmd_buffer, present_swap_chain, present_image_index, present_id);
     if (wait_for_completion)
       WaitForCommandBufferCompletion(m_current_cmd_buffer);
   }
@@ -415,22 +490,50 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
 
 void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
                                                VkSwapchainKHR present_swap_chain,
-                                               u32 present_image_index)
+                                               u32 present_image_index, u64 present_id)
 {
   CmdBufferResources& resources = m_command_buffers[command_buffer_index];
 
   // This may be executed on the worker thread, so don't modify any state of the manager class.
-  uint32_t wait_bits = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+  std::array<VkSemaphore, 2> wait_semaphores;
+  std::array<VkPipelineStageFlags, 2> wait_bits;
   VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO,
                               nullptr,
                               0,
-                              nullptr,
-                              &wait_bits,
+                              wait_semaphores.data(),
+                              wait_bits.data(),
                               static_cast<u32>(resources.command_buffers.size()),
                               resources.command_buffers.data(),
                               0,
                               nullptr};
 
+  // Texture uploads on the transfer queue go first. The graphics queue waits for them before
+  // any transfers of its own, which includes the ownership acquire barriers for the textures.
+  if (resources.transfer_command_buffer_used)
+  {
+    const VkSubmitInfo transfer_submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                                               nullptr,
+                                               0,
+                                               nullptr,
+                                               nullptr,
+                                               1,
+                                               &resources.transfer_command_buffer,
+                                               1,
+                                               &resources.transfer_semaphore};
+    VkResult res = vkQueueSubmit(g_vulkan_context->GetTransferQueue(), 1, &transfer_submit_info,
+                                 VK_NULL_HANDLE);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkQueueSubmit failed: ");
+      PanicAlertFmt("Failed to submit transfer command buffer: {} ({})", VkResultToString(res),
+                    static_cast<int>(res));
+    }
+
+    wait_semaphores[submit_info.waitSemaphoreCount] = resources.transfer_semaphore;
+    wait_bits[submit_info.waitSemaphoreCount] = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    submit_info.waitSemaphoreCount++;
+  }
+
   // If the init command buffer did not have any commands recorded, don't submit it.
   if (!resources.init_command_buffer_used)
   {
@@ -440,8 +543,9 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
 
   if (resources.semaphore_used)
   {
-    submit_info.pWaitSemaphores = &resources.semaphore;
-    submit_info.waitSemaphoreCount = 1;
+    wait_semaphores[submit_info.waitSemaphoreCount] = resources.semaphore;
+    wait_bits[submit_info.waitSemaphoreCount] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    submit_info.waitSemaphoreCount++;
   }
 
   if (present_swap_chain != VK_NULL_HANDLE)
@@ -472,7 +576,17 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
                                      &present_image_index,
                                      nullptr};
 
-    m_last_present_result = vkQueuePresentKHR(g_vulkan_context->GetPresentQueue(), &present_info);
+    VkPresentIdKHR present_id_info = {VK_STRUCTURE_TYPE_PRESENT_ID_KHR, nullptr, 1, &present_id};
+    if (present_id != 0)
+      present_info.pNext = &present_id_info;
+
+    {
+      std::lock_guard<std::mutex> guard(m_present_lock);
+      m_last_present_result =
+          vkQueuePresentKHR(g_vulkan_context->GetPresentQueue(), &present_info);
+    }
+    if (present_id != 0)
+      m_last_issued_present_id.store(present_id, std::memory_order_release);
     m_last_present_done.Set();
     if (m_last_present_result != VK_SUCCESS)
     {
@@ -496,6 +610,17 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
   }
 }
 
+VkResult CommandBufferManager::WaitForPresent(VkSwapchainKHR swap_chain, u64 present_id,
+                                              u64 timeout_ns)
+{
+  // The worker thread can't present while we wait, so it must have presented this one already.
+  if (m_last_issued_present_id.load(std::memory_order_acquire) < present_id)
+    WaitForWorkerThreadIdle();
+
+  std::lock_guard<std::mutex> guard(m_present_lock);
+  return vkWaitForPresentKHR(g_vulkan_context->GetDevice(), swap_chain, present_id, timeout_ns);
+}
+
 void CommandBufferManager::BeginCommandBuffer()
 {
   // Move to the next command buffer.
@@ -526,8 +651,21 @@ void CommandBufferManager::BeginCommandBuffer()
       LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
   }
 
+  // The graphics submission waited for the transfer submission, so the fence covers both.
+  if (resources.transfer_command_pool != VK_NULL_HANDLE)
+  {
+    res = vkResetCommandPool(g_vulkan_context->GetDevice(), resources.transfer_command_pool, 0);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
+
+    res = vkBeginCommandBuffer(resources.transfer_command_buffer, &begin_info);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
+  }
+
   // Reset upload command buffer state
   resources.init_command_buffer_used = false;
+  resources.transfer_command_buffer_used = false;
   resources.semaphore_used = false;
   resources.fence_counter = m_next_fence_counter++;
   resources.frame_index = m_current_frame;
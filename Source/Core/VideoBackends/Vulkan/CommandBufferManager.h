@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <deque>
 #include <functional>
@@ -43,6 +44,15 @@ public:
     const CmdBufferResources& cmd_buffer_resources = m_command_buffers[m_current_cmd_buffer];
     return cmd_buffer_resources.command_buffers[1];
   }
+  // Command buffer for the dedicated transfer queue, only valid if HasTransferQueue() is true.
+  // It is submitted right before the init and draw command buffers, which wait for it to finish.
+  VkCommandBuffer GetCurrentTransferCommandBuffer()
+  {
+    CmdBufferResources& cmd_buffer_resources = GetCurrentCmdBufferResources();
+    cmd_buffer_resources.transfer_command_buffer_used = true;
+    return cmd_buffer_resources.transfer_command_buffer;
+  }
+  bool HasTransferQueue() const { return m_has_transfer_queue; }
   // Allocates a descriptors set from the pool reserved for the current frame.
   VkDescriptorSet AllocateDescriptorSet(VkDescriptorSetLayout set_layout);
 
@@ -76,6 +86,10 @@ public:
   // Also invokes callbacks for completion.
   void WaitForFenceCounter(u64 fence_counter);
 
+  // Checks whether a fence has completed without waiting for it. Unlike WaitForFenceCounter, this
+  // doesn't invoke callbacks, so GetCompletedFenceCounter isn't updated.
+  bool IsFenceCounterComplete(u64 fence_counter) const;
+
   void SubmitCommandBuffer(bool submit_on_worker_thread, bool wait_for_completion,
                            VkSwapchainKHR present_swap_chain = VK_NULL_HANDLE,
                            uint32_t present_image_index = 0xFFFFFFFF);
@@ -85,6 +99,12 @@ public:
   VkResult GetLastPresentResult() const { return m_last_present_result; }
   bool CheckLastPresentDone() { return m_last_present_done.TestAndClear(); }
 
+  // With present wait, every present gets an increasing id. Returns the id of the last present
+  // submitted, or 0 if there is none.
+  u64 GetLastPresentId() const { return m_next_present_id - 1; }
+  // Waits until the present with the given id, or a later one, has been displayed.
+  VkResult WaitForPresent(VkSwapchainKHR swap_chain, u64 present_id, u64 timeout_ns);
+
   // Schedule a vulkan resource for destruction later on. This will occur when the command buffer
   // is next re-used, and the GPU has finished working with the specified resource.
   void DeferBufferViewDestruction(VkBufferView object);
@@ -101,7 +121,7 @@ private:
 
   void WaitForCommandBufferCompletion(u32 command_buffer_index);
   void SubmitCommandBuffer(u32 command_buffer_index, VkSwapchainKHR present_swap_chain,
-                           u32 present_image_index);
+                           u32 present_image_index, u64 present_id);
   void BeginCommandBuffer();
 
   VkDescriptorPool CreateDescriptorPool(u32 descriptor_sizes);
@@ -118,6 +138,12 @@ private:
     u64 fence_counter = 0;
     bool init_command_buffer_used = false;
     bool semaphore_used = false;
+
+    // Uploads on the dedicated transfer queue, signals transfer_semaphore when done
+    VkCommandPool transfer_command_pool = VK_NULL_HANDLE;
+    VkCommandBuffer transfer_command_buffer = VK_NULL_HANDLE;
+    VkSemaphore transfer_semaphore = VK_NULL_HANDLE;
+    bool transfer_command_buffer_used = false;
     std::atomic<bool> waiting_for_submit{false};
     u32 frame_index = 0;
 
@@ -153,6 +179,7 @@ private:
     VkSwapchainKHR present_swap_chain;
     u32 present_image_index;
     u32 command_buffer_index;
+    u64 present_id;
   };
   VkSemaphore m_present_semaphore = VK_NULL_HANDLE;
   std::deque<PendingCommandBufferSubmit> m_pending_submits;
@@ -162,7 +189,12 @@ private:
   Common::Flag m_last_present_failed;
   Common::Flag m_last_present_done;
   VkResult m_last_present_result = VK_SUCCESS;
+  u64 m_next_present_id = 1;
+  // The swap chain must not be presented to while waiting on it.
+  std::mutex m_present_lock;
+  std::atomic<u64> m_last_issued_present_id{0};
   bool m_use_threaded_submission = false;
+  bool m_has_transfer_queue = false;
   u32 m_descriptor_set_count = DESCRIPTOR_SETS_PER_POOL;
 };
 
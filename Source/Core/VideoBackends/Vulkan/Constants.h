@@ -93,4 +93,8 @@ constexpr u32 TEXTURE_UPLOAD_BUFFER_SIZE = 32 * 1024 * 1024;
 // large anyway, so it's only really an issue for HD texture packs, and memory is not
 // a limiting factor in these scenarios anyway.
 constexpr u32 STAGING_TEXTURE_UPLOAD_THRESHOLD = 1024 * 1024 * 4;
+
+// Textures of at least this size (a 256x256 RGBA8 texture) are uploaded on the dedicated transfer
+// queue when async texture uploads are enabled, if they haven't been used for rendering yet.
+constexpr u32 TRANSFER_QUEUE_UPLOAD_THRESHOLD = 256 * 256 * 4;
 }  // namespace Vulkan
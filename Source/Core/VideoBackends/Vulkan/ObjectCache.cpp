@@ -186,6 +186,10 @@ bool ObjectCache::CreateDescriptorSetLayouts()
     create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_UNIFORM_BUFFERS].bindingCount--;
   }
 
+  // Multiview stereoscopy reads the stereo parameters in the vertex shader.
+  if (g_ActiveConfig.backend_info.bSupportsMultiview)
+    ubo_bindings[UBO_DESCRIPTOR_SET_BINDING_GS].stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
+
   // Remove the dynamic vertex loader's buffer if it'll never be needed
   if (!g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader)
     create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_SHADER_STORAGE_BUFFERS].bindingCount--;
@@ -387,9 +391,10 @@ VkSampler ObjectCache::GetSampler(const SamplerState& info)
 }
 
 VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_format,
-                                        u32 multisamples, VkAttachmentLoadOp load_op)
+                                        u32 multisamples, VkAttachmentLoadOp load_op,
+                                        bool multiview)
 {
-  auto key = std::tie(color_format, depth_format, multisamples, load_op);
+  auto key = std::tie(color_format, depth_format, multisamples, load_op, multiview);
   auto it = m_render_pass_cache.find(key);
   if (it != m_render_pass_cache.end())
     return it->second;
@@ -453,6 +458,15 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
                                       0,
                                       nullptr};
 
+  // Broadcast draws to both layers of the attachments. The views are correlated, since they're
+  // the left and right eye of the same scene.
+  const u32 view_mask = 0b11;
+  VkRenderPassMultiviewCreateInfo multiview_info = {
+      VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO, nullptr, 1, &view_mask, 0, nullptr, 1,
+      &view_mask};
+  if (multiview)
+    pass_info.pNext = &multiview_info;
+
   VkRenderPass pass;
   VkResult res = vkCreateRenderPass(g_vulkan_context->GetDevice(), &pass_info, nullptr, &pass);
   if (res != VK_SUCCESS)
@@ -58,9 +58,9 @@ public:
   VkSampler GetLinearSampler() const { return m_linear_sampler; }
   VkSampler GetSampler(const SamplerState& info);
 
-  // Render pass cache.
+  // Render pass cache. Multiview render passes draw to both stereoscopy layers at once.
   VkRenderPass GetRenderPass(VkFormat color_format, VkFormat depth_format, u32 multisamples,
-                             VkAttachmentLoadOp load_op);
+                             VkAttachmentLoadOp load_op, bool multiview = false);
 
   // Pipeline cache. Used when creating pipelines for drivers to store compiled programs.
   VkPipelineCache GetPipelineCache() const { return m_pipeline_cache; }
@@ -102,7 +102,7 @@ private:
   std::unique_ptr<VKTexture> m_dummy_texture;
 
   // Render pass cache
-  using RenderPassCacheKey = std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp>;
+  using RenderPassCacheKey = std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp, bool>;
   std::map<RenderPassCacheKey, VkRenderPass> m_render_pass_cache;
 
   // pipeline cache
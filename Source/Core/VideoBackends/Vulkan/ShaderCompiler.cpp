@@ -87,17 +87,25 @@ static const char SUBGROUP_HELPER_HEADER[] = R"(
   #define SUBGROUP_MIN(value) value = subgroupMin(value)
   #define SUBGROUP_MAX(value) value = subgroupMax(value)
 )";
+static const char MULTIVIEW_HEADER[] = R"(
+  #extension GL_EXT_multiview : enable
+)";
 
-static std::string GetShaderCode(std::string_view source, std::string_view header)
+static std::string GetShaderCode(std::string_view source, std::string_view header,
+                                 bool graphics_stage = false)
 {
   std::string full_source_code;
   if (!header.empty())
   {
     constexpr size_t subgroup_helper_header_length = std::size(SUBGROUP_HELPER_HEADER) - 1;
-    full_source_code.reserve(header.size() + subgroup_helper_header_length + source.size());
+    constexpr size_t multiview_header_length = std::size(MULTIVIEW_HEADER) - 1;
+    full_source_code.reserve(header.size() + subgroup_helper_header_length +
+                             multiview_header_length + source.size());
     full_source_code.append(header);
     if (g_vulkan_context->SupportsShaderSubgroupOperations())
       full_source_code.append(SUBGROUP_HELPER_HEADER, subgroup_helper_header_length);
+    if (graphics_stage && g_vulkan_context->SupportsMultiview())
+      full_source_code.append(MULTIVIEW_HEADER, multiview_header_length);
     full_source_code.append(source);
   }
 
@@ -115,20 +123,20 @@ static glslang::EShTargetLanguageVersion GetLanguageVersion()
 
 std::optional<SPIRVCodeVector> CompileVertexShader(std::string_view source_code)
 {
-  return SPIRV::CompileVertexShader(GetShaderCode(source_code, SHADER_HEADER), APIType::Vulkan,
-                                    GetLanguageVersion());
+  return SPIRV::CompileVertexShader(GetShaderCode(source_code, SHADER_HEADER, true),
+                                    APIType::Vulkan, GetLanguageVersion());
 }
 
 std::optional<SPIRVCodeVector> CompileGeometryShader(std::string_view source_code)
 {
-  return SPIRV::CompileGeometryShader(GetShaderCode(source_code, SHADER_HEADER), APIType::Vulkan,
-                                      GetLanguageVersion());
+  return SPIRV::CompileGeometryShader(GetShaderCode(source_code, SHADER_HEADER, true),
+                                      APIType::Vulkan, GetLanguageVersion());
 }
 
 std::optional<SPIRVCodeVector> CompileFragmentShader(std::string_view source_code)
 {
-  return SPIRV::CompileFragmentShader(GetShaderCode(source_code, SHADER_HEADER), APIType::Vulkan,
-                                      GetLanguageVersion());
+  return SPIRV::CompileFragmentShader(GetShaderCode(source_code, SHADER_HEADER, true),
+                                      APIType::Vulkan, GetLanguageVersion());
 }
 
 std::optional<SPIRVCodeVector> CompileComputeShader(std::string_view source_code)
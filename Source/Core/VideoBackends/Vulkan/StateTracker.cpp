@@ -249,6 +249,7 @@ void StateTracker::InvalidateCachedState()
   m_gx_descriptor_sets.fill(VK_NULL_HANDLE);
   m_utility_descriptor_sets.fill(VK_NULL_HANDLE);
   m_compute_descriptor_set = VK_NULL_HANDLE;
+  m_gx_sampler_descriptor_sets.clear();
   m_dirty_flags |= DIRTY_FLAG_ALL_DESCRIPTORS | DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR |
                    DIRTY_FLAG_PIPELINE | DIRTY_FLAG_COMPUTE_SHADER | DIRTY_FLAG_DESCRIPTOR_SETS |
                    DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET;
@@ -276,6 +277,7 @@ void StateTracker::BeginRenderPass()
 
   vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
                        VK_SUBPASS_CONTENTS_INLINE);
+  m_render_pass_empty = true;
 }
 
 void StateTracker::BeginDiscardRenderPass()
@@ -296,6 +298,7 @@ void StateTracker::BeginDiscardRenderPass()
 
   vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
                        VK_SUBPASS_CONTENTS_INLINE);
+  m_render_pass_empty = true;
 }
 
 void StateTracker::EndRenderPass()
@@ -325,6 +328,7 @@ void StateTracker::BeginClearRenderPass(const VkRect2D& area, const VkClearValue
 
   vkCmdBeginRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer(), &begin_info,
                        VK_SUBPASS_CONTENTS_INLINE);
+  m_render_pass_empty = true;
 }
 
 void StateTracker::SetViewport(const VkViewport& viewport)
@@ -361,6 +365,7 @@ bool StateTracker::Bind()
   // Start render pass if not already started
   if (!InRenderPass())
     BeginRenderPass();
+  m_render_pass_empty = false;
 
   // Re-bind parts of the pipeline
   const VkCommandBuffer command_buffer = g_command_buffer_mgr->GetCurrentCommandBuffer();
@@ -490,19 +495,28 @@ void StateTracker::UpdateGXDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
   {
-    m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
-        g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
-
-    writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                            nullptr,
-                            m_gx_descriptor_sets[1],
-                            0,
-                            0,
-                            static_cast<u32>(NUM_PIXEL_SHADER_SAMPLERS),
-                            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-                            m_bindings.samplers.data(),
-                            nullptr,
-                            nullptr};
+    SamplerSetKey key;
+    for (size_t i = 0; i < NUM_PIXEL_SHADER_SAMPLERS; i++)
+      key[i] = {m_bindings.samplers[i].sampler, m_bindings.samplers[i].imageView};
+
+    VkDescriptorSet& set = m_gx_sampler_descriptor_sets[key];
+    if (set == VK_NULL_HANDLE)
+    {
+      set = g_command_buffer_mgr->AllocateDescriptorSet(
+          g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
+
+      writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                              nullptr,
+                              set,
+                              0,
+                              0,
+                              static_cast<u32>(NUM_PIXEL_SHADER_SAMPLERS),
+                              VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                              m_bindings.samplers.data(),
+                              nullptr,
+                              nullptr};
+    }
+    m_gx_descriptor_sets[1] = set;
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_SAMPLERS) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
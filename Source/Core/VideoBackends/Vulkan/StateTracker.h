@@ -5,7 +5,9 @@
 
 #include <array>
 #include <cstddef>
+#include <map>
 #include <memory>
+#include <utility>
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/Vulkan/Constants.h"
@@ -58,6 +60,10 @@ public:
   void BeginDiscardRenderPass();
   void EndRenderPass();
 
+  // True if nothing has been drawn since the current render pass began. Such a pass can be ended
+  // and replaced by a clear render pass without the attachments ever being loaded.
+  bool IsRenderPassEmpty() const { return m_render_pass_empty; }
+
   // Ends the current render pass if it was a clear render pass.
   void BeginClearRenderPass(const VkRect2D& area, const VkClearValue* clear_values,
                             u32 num_clear_values);
@@ -152,6 +158,13 @@ private:
   std::array<VkDescriptorSet, NUM_UTILITY_DESCRIPTOR_SETS> m_utility_descriptor_sets = {};
   VkDescriptorSet m_compute_descriptor_set = VK_NULL_HANDLE;
 
+  // GX sampler descriptor sets already written in the current command buffer, keyed by their
+  // contents. Games tend to alternate between a handful of texture combinations, so most sampler
+  // changes can rebind one of these instead of allocating and writing a new set. Cleared with the
+  // rest of the cached state, as the sets and the views they reference only live that long.
+  using SamplerSetKey = std::array<std::pair<VkSampler, VkImageView>, NUM_PIXEL_SHADER_SAMPLERS>;
+  std::map<SamplerSetKey, VkDescriptorSet> m_gx_sampler_descriptor_sets;
+
   // rasterization
   VkViewport m_viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
   VkRect2D m_scissor = {{0, 0}, {1, 1}};
@@ -162,5 +175,6 @@ private:
   VKFramebuffer* m_framebuffer = nullptr;
   VkRenderPass m_current_render_pass = VK_NULL_HANDLE;
   VkRect2D m_framebuffer_render_area = {};
+  bool m_render_pass_empty = false;
 };
 }  // namespace Vulkan
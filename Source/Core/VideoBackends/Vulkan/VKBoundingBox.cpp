@@ -37,7 +37,7 @@ bool VKBoundingBox::Initialize()
   return true;
 }
 
-std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+void VKBoundingBox::CopyToReadbackBuffer(StagingBuffer* buffer)
 {
   // Can't be done within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
@@ -47,22 +47,26 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
       g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
       VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, 0,
       BUFFER_SIZE, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-  m_readback_buffer->PrepareForGPUWrite(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                                        VK_ACCESS_TRANSFER_WRITE_BIT,
-                                        VK_PIPELINE_STAGE_TRANSFER_BIT);
+  buffer->PrepareForGPUWrite(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                             VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
 
   // Copy from GPU -> readback buffer.
   VkBufferCopy region = {0, 0, BUFFER_SIZE};
   vkCmdCopyBuffer(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
-                  m_readback_buffer->GetBuffer(), 1, &region);
+                  buffer->GetBuffer(), 1, &region);
 
   // Restore GPU buffer access.
   StagingBuffer::BufferMemoryBarrier(
       g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer, VK_ACCESS_TRANSFER_READ_BIT,
       VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, 0, BUFFER_SIZE,
       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
-  m_readback_buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                                   VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+  buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                        VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+}
+
+std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+{
+  CopyToReadbackBuffer(m_readback_buffer.get());
 
   // Wait until these commands complete.
   Renderer::GetInstance()->ExecuteCommandBuffer(false, true);
@@ -77,6 +81,47 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
   return values;
 }
 
+bool VKBoundingBox::QueueReadback()
+{
+  if (m_async_readback_count == NUM_ASYNC_READBACKS)
+    return false;
+
+  AsyncReadback& readback =
+      m_async_readbacks[(m_async_readback_head + m_async_readback_count) % NUM_ASYNC_READBACKS];
+  if (!readback.buffer)
+  {
+    readback.buffer = StagingBuffer::Create(STAGING_BUFFER_TYPE_READBACK, BUFFER_SIZE,
+                                            VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    if (!readback.buffer || !readback.buffer->Map())
+    {
+      readback.buffer.reset();
+      return false;
+    }
+  }
+
+  CopyToReadbackBuffer(readback.buffer.get());
+  readback.fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
+  m_async_readback_count++;
+  return true;
+}
+
+std::optional<BBoxValues> VKBoundingBox::PollReadback()
+{
+  if (m_async_readback_count == 0)
+    return std::nullopt;
+
+  AsyncReadback& readback = m_async_readbacks[m_async_readback_head];
+  if (!g_command_buffer_mgr->IsFenceCounterComplete(readback.fence_counter))
+    return std::nullopt;
+
+  BBoxValues values;
+  readback.buffer->InvalidateCPUCache();
+  readback.buffer->Read(0, values.data(), BUFFER_SIZE, false);
+  m_async_readback_head = (m_async_readback_head + 1) % NUM_ASYNC_READBACKS;
+  m_async_readback_count--;
+  return values;
+}
+
 void VKBoundingBox::Write(u32 index, const std::vector<BBoxType>& values)
 {
   // We can't issue vkCmdUpdateBuffer within a render pass.
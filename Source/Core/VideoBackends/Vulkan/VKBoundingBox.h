@@ -27,9 +27,14 @@ protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, const std::vector<BBoxType>& values) override;
 
+  bool SupportsAsyncReadback() const override { return true; }
+  bool QueueReadback() override;
+  std::optional<BBoxValues> PollReadback() override;
+
 private:
   bool CreateGPUBuffer();
   bool CreateReadbackBuffer();
+  void CopyToReadbackBuffer(StagingBuffer* buffer);
 
   VkBuffer m_gpu_buffer = VK_NULL_HANDLE;
   VmaAllocation m_gpu_allocation = VK_NULL_HANDLE;
@@ -37,6 +42,17 @@ private:
   static constexpr size_t BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
 
   std::unique_ptr<StagingBuffer> m_readback_buffer;
+
+  // Ring of buffers for asynchronous readbacks, completed in the order they were queued.
+  static constexpr u32 NUM_ASYNC_READBACKS = 4;
+  struct AsyncReadback
+  {
+    std::unique_ptr<StagingBuffer> buffer;
+    u64 fence_counter = 0;
+  };
+  std::array<AsyncReadback, NUM_ASYNC_READBACKS> m_async_readbacks;
+  u32 m_async_readback_head = 0;
+  u32 m_async_readback_count = 0;
 };
 
 }  // namespace Vulkan
@@ -15,7 +15,9 @@
 #include "VideoBackends/Vulkan/StateTracker.h"
 #include "VideoBackends/Vulkan/VKRenderer.h"
 #include "VideoBackends/Vulkan/VulkanContext.h"
+#include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace Vulkan
 {
@@ -59,6 +61,8 @@ void PerfQuery::EnableQuery(PerfQueryGroup group)
     DEBUG_ASSERT(!entry.has_value);
     entry.has_value = true;
     entry.query_group = group;
+    entry.num_views = g_framebuffer_manager->IsEFBMultiview() ? MAX_QUERY_VIEWS : 1;
+    DEBUG_ASSERT(entry.num_views <= m_query_stride);
 
     // Use precise queries if supported, otherwise boolean (which will be incorrect).
     VkQueryControlFlags flags =
@@ -66,8 +70,8 @@ void PerfQuery::EnableQuery(PerfQueryGroup group)
 
     // Ensure the query starts within a render pass.
     StateTracker::GetInstance()->BeginRenderPass();
-    vkCmdBeginQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool, m_query_next_pos,
-                    flags);
+    vkCmdBeginQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool,
+                    GetPoolIndex(m_query_next_pos), flags);
   }
 }
 
@@ -75,7 +79,8 @@ void PerfQuery::DisableQuery(PerfQueryGroup group)
 {
   if (group == PQG_ZCOMP_ZCOMPLOC || group == PQG_ZCOMP)
   {
-    vkCmdEndQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool, m_query_next_pos);
+    vkCmdEndQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool,
+                  GetPoolIndex(m_query_next_pos));
     ActiveQuery& entry = m_query_buffer[m_query_next_pos];
     entry.fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
 
@@ -95,7 +100,7 @@ void PerfQuery::ResetQuery()
   // Reset entire query pool, ensuring all queries are ready to write to.
   StateTracker::GetInstance()->EndRenderPass();
   vkCmdResetQueryPool(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool, 0,
-                      PERF_QUERY_BUFFER_SIZE);
+                      PERF_QUERY_BUFFER_SIZE * m_query_stride);
 
   std::memset(m_query_buffer.data(), 0, sizeof(ActiveQuery) * m_query_buffer.size());
 }
@@ -139,12 +144,15 @@ bool PerfQuery::IsFlushed() const
 
 bool PerfQuery::CreateQueryPool()
 {
+  // Reserve a slot per view for each query, so multiview passes don't overlap the next query.
+  m_query_stride = g_ActiveConfig.backend_info.bSupportsMultiview ? MAX_QUERY_VIEWS : 1;
+
   VkQueryPoolCreateInfo info = {
       VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,  // VkStructureType                  sType
       nullptr,                                   // const void*                      pNext
       0,                                         // VkQueryPoolCreateFlags           flags
       VK_QUERY_TYPE_OCCLUSION,                   // VkQueryType                      queryType
-      PERF_QUERY_BUFFER_SIZE,                    // uint32_t                         queryCount
+      PERF_QUERY_BUFFER_SIZE * m_query_stride,   // uint32_t                         queryCount
       0  // VkQueryPipelineStatisticFlags    pipelineStatistics;
   };
 
@@ -194,16 +202,36 @@ void PerfQuery::ReadbackQueries(u32 query_count)
          (m_query_readback_pos + query_count) <= PERF_QUERY_BUFFER_SIZE);
 
   // Read back from the GPU.
-  VkResult res = vkGetQueryPoolResults(
-      g_vulkan_context->GetDevice(), m_query_pool, m_query_readback_pos, query_count,
-      query_count * sizeof(PerfQueryDataType), m_query_result_buffer.data(),
-      sizeof(PerfQueryDataType), VK_QUERY_RESULT_WAIT_BIT);
-  if (res != VK_SUCCESS)
-    LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
+  if (m_query_stride == 1)
+  {
+    VkResult res = vkGetQueryPoolResults(
+        g_vulkan_context->GetDevice(), m_query_pool, m_query_readback_pos, query_count,
+        query_count * sizeof(PerfQueryDataType), m_query_result_buffer.data(),
+        sizeof(PerfQueryDataType), VK_QUERY_RESULT_WAIT_BIT);
+    if (res != VK_SUCCESS)
+      LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
+  }
+  else
+  {
+    // Only the slots for views that were rendered are written, so sum each query separately.
+    for (u32 i = 0; i < query_count; i++)
+    {
+      const u32 pos = m_query_readback_pos + i;
+      std::array<PerfQueryDataType, MAX_QUERY_VIEWS> view_results = {};
+      VkResult res = vkGetQueryPoolResults(
+          g_vulkan_context->GetDevice(), m_query_pool, GetPoolIndex(pos),
+          m_query_buffer[pos].num_views, sizeof(view_results), view_results.data(),
+          sizeof(PerfQueryDataType), VK_QUERY_RESULT_WAIT_BIT);
+      if (res != VK_SUCCESS)
+        LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
+
+      m_query_result_buffer[i] = view_results[0] + view_results[1];
+    }
+  }
 
   StateTracker::GetInstance()->EndRenderPass();
   vkCmdResetQueryPool(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool,
-                      m_query_readback_pos, query_count);
+                      GetPoolIndex(m_query_readback_pos), query_count * m_query_stride);
 
   // Remove pending queries.
   for (u32 i = 0; i < query_count; i++)
@@ -37,10 +37,14 @@ private:
   // TODO: This should be size_t, but the base class uses u32s
   static const u32 PERF_QUERY_BUFFER_SIZE = 512;
 
+  // Queries inside a multiview render pass write one result per view.
+  static const u32 MAX_QUERY_VIEWS = 2;
+
   struct ActiveQuery
   {
     u64 fence_counter;
     PerfQueryGroup query_group;
+    u32 num_views;
     bool has_value;
   };
 
@@ -49,7 +53,10 @@ private:
   void ReadbackQueries(u32 query_count);
   void PartialFlush(bool blocking);
 
+  u32 GetPoolIndex(u32 pos) const { return pos * m_query_stride; }
+
   VkQueryPool m_query_pool = VK_NULL_HANDLE;
+  u32 m_query_stride = 1;
   u32 m_query_readback_pos = 0;
   u32 m_query_next_pos = 0;
   std::array<ActiveQuery, PERF_QUERY_BUFFER_SIZE> m_query_buffer = {};
@@ -33,6 +33,7 @@
 
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -173,10 +174,13 @@ void Renderer::ClearScreen(const MathUtil::Rectangle<int>& rc, bool color_enable
     clear_depth_value.depthStencil.depth = 1.0f - clear_depth_value.depthStencil.depth;
 
   // If we're not in a render pass (start of the frame), we can use a clear render pass
-  // to discard the data, rather than loading and then clearing.
+  // to discard the data, rather than loading and then clearing. The same goes for a pass which
+  // hasn't drawn anything yet, e.g. after switching framebuffers: restarting it as a clear pass
+  // saves loading the attachments into tile memory on tile-based GPUs.
   bool use_clear_attachments = (color_enable && alpha_enable) || z_enable;
-  bool use_clear_render_pass =
-      !StateTracker::GetInstance()->InRenderPass() && color_enable && alpha_enable && z_enable;
+  bool use_clear_render_pass = (!StateTracker::GetInstance()->InRenderPass() ||
+                                StateTracker::GetInstance()->IsRenderPassEmpty()) &&
+                               color_enable && alpha_enable && z_enable;
 
   // The NVIDIA Vulkan driver causes the GPU to lock up, or throw exceptions if MSAA is enabled,
   // a non-full clear rect is specified, and a clear loadop or vkCmdClearAttachments is used.
@@ -196,6 +200,7 @@ void Renderer::ClearScreen(const MathUtil::Rectangle<int>& rc, bool color_enable
   if (use_clear_render_pass)
   {
     const std::array<VkClearValue, 2> clear_values = {{clear_color_value, clear_depth_value}};
+    StateTracker::GetInstance()->EndRenderPass();
     StateTracker::GetInstance()->BeginClearRenderPass(target_vk_rc, clear_values.data(),
                                                       static_cast<u32>(clear_values.size()));
     return;
@@ -226,7 +231,10 @@ void Renderer::ClearScreen(const MathUtil::Rectangle<int>& rc, bool color_enable
     }
     if (num_clear_attachments > 0)
     {
-      VkClearRect vk_rect = {target_vk_rc, 0, g_framebuffer_manager->GetEFBLayers()};
+      // Multiview render passes clear every view, and only take a single layer here.
+      const u32 clear_layers =
+          g_framebuffer_manager->IsEFBMultiview() ? 1 : g_framebuffer_manager->GetEFBLayers();
+      VkClearRect vk_rect = {target_vk_rc, 0, clear_layers};
       if (!StateTracker::GetInstance()->IsWithinRenderArea(
               target_vk_rc.offset.x, target_vk_rc.offset.y, target_vk_rc.extent.width,
               target_vk_rc.extent.height))
@@ -353,6 +361,30 @@ void Renderer::PresentBackbuffer()
 
   // New cmdbuffer, so invalidate state.
   StateTracker::GetInstance()->InvalidateCachedState();
+
+  if (g_vulkan_context->SupportsPresentWait())
+    WaitForPreviousPresent();
+}
+
+void Renderer::WaitForPreviousPresent()
+{
+  const u64 present_id = g_command_buffer_mgr->GetLastPresentId();
+  const TimePoint present_time = Clock::now();
+
+  if (g_ActiveConfig.bLowLatencyPresent && m_previous_present_id != 0)
+  {
+    // Don't hang if the present never completes, e.g. because the window was minimized.
+    constexpr u64 TIMEOUT_NS = 100'000'000;
+    const VkResult res = g_command_buffer_mgr->WaitForPresent(m_swap_chain->GetSwapChain(),
+                                                              m_previous_present_id, TIMEOUT_NS);
+    if (res == VK_SUCCESS)
+      g_perf_metrics.CountPresentLatency(Clock::now() - m_previous_present_time);
+    else if (res != VK_TIMEOUT && res != VK_ERROR_OUT_OF_DATE_KHR && res != VK_SUBOPTIMAL_KHR)
+      LOG_VULKAN_ERROR(res, "vkWaitForPresentKHR failed: ");
+  }
+
+  m_previous_present_id = present_id;
+  m_previous_present_time = present_time;
 }
 
 void Renderer::SetFullscreen(bool enable_fullscreen)
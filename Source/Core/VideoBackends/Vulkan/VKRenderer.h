@@ -100,8 +100,14 @@ private:
   void OnSwapChainResized();
   void BindFramebuffer(VKFramebuffer* fb);
 
+  // Waits for the previous frame to be displayed, so that at most one frame is queued.
+  void WaitForPreviousPresent();
+
   std::unique_ptr<SwapChain> m_swap_chain;
 
+  u64 m_previous_present_id = 0;
+  TimePoint m_previous_present_time;
+
   // Keep a copy of sampler states to avoid cache lookups every draw
   std::array<SamplerState, NUM_PIXEL_SHADER_SAMPLERS> m_sampler_states = {};
 };
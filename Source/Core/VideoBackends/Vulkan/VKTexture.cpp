@@ -328,6 +328,27 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   width = std::max(1u, std::min(width, GetWidth() >> level));
   height = std::max(1u, std::min(height, GetHeight() >> level));
 
+  // For unaligned textures, we can save some memory in the transfer buffer by skipping the rows
+  // that lie outside of the texture's dimensions.
+  const u32 upload_alignment = static_cast<u32>(g_vulkan_context->GetBufferImageGranularity());
+  const u32 block_size = GetBlockSizeForFormat(GetFormat());
+  const u32 num_rows = Common::AlignUp(height, block_size) / block_size;
+  const u32 source_pitch = CalculateStrideForFormat(m_config.format, row_length);
+  const u32 upload_size = source_pitch * num_rows;
+
+  // Large textures which haven't been used by the graphics queue yet, which are mostly custom
+  // textures, are uploaded on the dedicated transfer queue. Once the first level went there, the
+  // remaining levels have to follow, as the image is owned by the transfer queue until the end.
+  if (m_layout == VK_IMAGE_LAYOUT_UNDEFINED &&
+      (m_uploading_on_transfer_queue ||
+       (level == 0 && upload_size >= TRANSFER_QUEUE_UPLOAD_THRESHOLD &&
+        g_ActiveConfig.bAsyncTextureUploads && g_command_buffer_mgr->HasTransferQueue() &&
+        width == GetWidth() && height == GetHeight())))
+  {
+    LoadOnTransferQueue(level, width, height, row_length, buffer, upload_size);
+    return;
+  }
+
   // We don't care about the existing contents of the texture, so we could the image layout to
   // VK_IMAGE_LAYOUT_UNDEFINED here. However, under section 2.2.1, Queue Operation of the Vulkan
   // specification, it states:
@@ -347,13 +368,6 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
                      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
-  // For unaligned textures, we can save some memory in the transfer buffer by skipping the rows
-  // that lie outside of the texture's dimensions.
-  const u32 upload_alignment = static_cast<u32>(g_vulkan_context->GetBufferImageGranularity());
-  const u32 block_size = GetBlockSizeForFormat(GetFormat());
-  const u32 num_rows = Common::AlignUp(height, block_size) / block_size;
-  const u32 source_pitch = CalculateStrideForFormat(m_config.format, row_length);
-  const u32 upload_size = source_pitch * num_rows;
   std::unique_ptr<StagingBuffer> temp_buffer;
   VkBuffer upload_buffer;
   VkDeviceSize upload_buffer_offset;
@@ -419,6 +433,79 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   }
 }
 
+void VKTexture::LoadOnTransferQueue(u32 level, u32 width, u32 height, u32 row_length,
+                                    const u8* buffer, u32 upload_size)
+{
+  // The staging buffer is only ever used by the transfer queue, so it doesn't need an ownership
+  // transfer. It is destroyed with the current command buffer, and the graphics submission of
+  // that command buffer waits for the transfer submission.
+  std::unique_ptr<StagingBuffer> temp_buffer = StagingBuffer::Create(
+      STAGING_BUFFER_TYPE_UPLOAD, upload_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+  if (!temp_buffer || !temp_buffer->Map())
+  {
+    PanicAlertFmt("Failed to allocate staging texture for transfer queue texture upload.");
+    return;
+  }
+  temp_buffer->Write(0, buffer, upload_size, true);
+  temp_buffer->Unmap();
+
+  m_uploading_on_transfer_queue = true;
+
+  // Each level goes from undefined to shader read only separately, so the levels which haven't
+  // been uploaded yet stay undefined and don't need to be tracked.
+  VkImageMemoryBarrier barrier = {
+      VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,  // VkStructureType            sType
+      nullptr,                                 // const void*                pNext
+      0,                                       // VkAccessFlags              srcAccessMask
+      VK_ACCESS_TRANSFER_WRITE_BIT,            // VkAccessFlags              dstAccessMask
+      VK_IMAGE_LAYOUT_UNDEFINED,               // VkImageLayout              oldLayout
+      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,    // VkImageLayout              newLayout
+      VK_QUEUE_FAMILY_IGNORED,                 // uint32_t                   srcQueueFamilyIndex
+      VK_QUEUE_FAMILY_IGNORED,                 // uint32_t                   dstQueueFamilyIndex
+      m_image,                                 // VkImage                    image
+      {VK_IMAGE_ASPECT_COLOR_BIT, level, 1, 0,
+       GetLayers()}  // VkImageSubresourceRange    subresourceRange
+  };
+  VkCommandBuffer transfer_command_buffer = g_command_buffer_mgr->GetCurrentTransferCommandBuffer();
+  vkCmdPipelineBarrier(transfer_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+  VkBufferImageCopy image_copy = {
+      0,                                         // VkDeviceSize                bufferOffset
+      row_length,                                // uint32_t                    bufferRowLength
+      0,                                         // uint32_t                    bufferImageHeight
+      {VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1},  // VkImageSubresourceLayers    imageSubresource
+      {0, 0, 0},                                 // VkOffset3D                  imageOffset
+      {width, height, 1}                         // VkExtent3D                  imageExtent
+  };
+  vkCmdCopyBufferToImage(transfer_command_buffer, temp_buffer->GetBuffer(), m_image,
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &image_copy);
+
+  // Release the level to the graphics queue, and acquire it in the init command buffer.
+  barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  barrier.dstAccessMask = 0;
+  barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+  barrier.srcQueueFamilyIndex = g_vulkan_context->GetTransferQueueFamilyIndex();
+  barrier.dstQueueFamilyIndex = g_vulkan_context->GetGraphicsQueueFamilyIndex();
+  vkCmdPipelineBarrier(transfer_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                       &barrier);
+
+  barrier.srcAccessMask = 0;
+  barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+  vkCmdPipelineBarrier(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
+                       VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                       0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+  if (level == (m_config.levels - 1))
+  {
+    m_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    m_uploading_on_transfer_queue = false;
+  }
+}
+
 void VKTexture::FinishedRendering()
 {
   if (m_layout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
@@ -982,17 +1069,29 @@ void VKStagingTexture::Flush()
   m_needs_flush = false;
 }
 
+bool VKStagingTexture::IsCopyComplete() const
+{
+  if (!m_needs_flush)
+    return true;
+
+  // A copy in the current command buffer can't have completed, as it hasn't been submitted yet.
+  if (g_command_buffer_mgr->GetCurrentFenceCounter() == m_flush_fence_counter)
+    return false;
+
+  return g_command_buffer_mgr->IsFenceCounterComplete(m_flush_fence_counter);
+}
+
 VKFramebuffer::VKFramebuffer(VKTexture* color_attachment, VKTexture* depth_attachment, u32 width,
                              u32 height, u32 layers, u32 samples, VkFramebuffer fb,
                              VkRenderPass load_render_pass, VkRenderPass discard_render_pass,
-                             VkRenderPass clear_render_pass)
+                             VkRenderPass clear_render_pass, bool multiview)
     : AbstractFramebuffer(
           color_attachment, depth_attachment,
           color_attachment ? color_attachment->GetFormat() : AbstractTextureFormat::Undefined,
           depth_attachment ? depth_attachment->GetFormat() : AbstractTextureFormat::Undefined,
           width, height, layers, samples),
       m_fb(fb), m_load_render_pass(load_render_pass), m_discard_render_pass(discard_render_pass),
-      m_clear_render_pass(clear_render_pass)
+      m_clear_render_pass(clear_render_pass), m_multiview(multiview)
 {
 }
 
@@ -1016,6 +1115,7 @@ std::unique_ptr<VKFramebuffer> VKFramebuffer::Create(VKTexture* color_attachment
   const u32 height = either_attachment->GetHeight();
   const u32 layers = either_attachment->GetLayers();
   const u32 samples = either_attachment->GetSamples();
+  const bool multiview = either_attachment->GetConfig().IsMultiview();
 
   std::array<VkImageView, 2> attachment_views{};
   u32 num_attachments = 0;
@@ -1027,11 +1127,11 @@ std::unique_ptr<VKFramebuffer> VKFramebuffer::Create(VKTexture* color_attachment
     attachment_views[num_attachments++] = depth_attachment->GetView();
 
   VkRenderPass load_render_pass = g_object_cache->GetRenderPass(
-      vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_LOAD);
+      vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_LOAD, multiview);
   VkRenderPass discard_render_pass = g_object_cache->GetRenderPass(
-      vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_DONT_CARE);
+      vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_DONT_CARE, multiview);
   VkRenderPass clear_render_pass = g_object_cache->GetRenderPass(
-      vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_CLEAR);
+      vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_CLEAR, multiview);
   if (load_render_pass == VK_NULL_HANDLE || discard_render_pass == VK_NULL_HANDLE ||
       clear_render_pass == VK_NULL_HANDLE)
   {
@@ -1046,7 +1146,7 @@ std::unique_ptr<VKFramebuffer> VKFramebuffer::Create(VKTexture* color_attachment
                                               attachment_views.data(),
                                               width,
                                               height,
-                                              layers};
+                                              multiview ? 1 : layers};
 
   VkFramebuffer fb;
   VkResult res =
@@ -1059,7 +1159,7 @@ std::unique_ptr<VKFramebuffer> VKFramebuffer::Create(VKTexture* color_attachment
 
   return std::make_unique<VKFramebuffer>(color_attachment, depth_attachment, width, height, layers,
                                          samples, fb, load_render_pass, discard_render_pass,
-                                         clear_render_pass);
+                                         clear_render_pass, multiview);
 }
 
 void VKFramebuffer::TransitionForRender()
@@ -72,12 +72,15 @@ public:
 
 private:
   bool CreateView(VkImageViewType type);
+  void LoadOnTransferQueue(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer,
+                           u32 upload_size);
 
   VmaAllocation m_alloc;
   VkImage m_image;
   VkImageView m_view = VK_NULL_HANDLE;
   mutable VkImageLayout m_layout = VK_IMAGE_LAYOUT_UNDEFINED;
   mutable ComputeImageLayout m_compute_layout = ComputeImageLayout::Undefined;
+  bool m_uploading_on_transfer_queue = false;
   std::string m_name;
 };
 
@@ -105,6 +108,7 @@ public:
   bool Map() override;
   void Unmap() override;
   void Flush() override;
+  bool IsCopyComplete() const override;
 
   static std::unique_ptr<VKStagingTexture> Create(StagingTextureType type,
                                                   const TextureConfig& config);
@@ -128,7 +132,8 @@ class VKFramebuffer final : public AbstractFramebuffer
 public:
   VKFramebuffer(VKTexture* color_attachment, VKTexture* depth_attachment, u32 width, u32 height,
                 u32 layers, u32 samples, VkFramebuffer fb, VkRenderPass load_render_pass,
-                VkRenderPass discard_render_pass, VkRenderPass clear_render_pass);
+                VkRenderPass discard_render_pass, VkRenderPass clear_render_pass,
+                bool multiview);
   ~VKFramebuffer() override;
 
   VkFramebuffer GetFB() const { return m_fb; }
@@ -137,6 +142,7 @@ public:
   VkRenderPass GetLoadRenderPass() const { return m_load_render_pass; }
   VkRenderPass GetDiscardRenderPass() const { return m_discard_render_pass; }
   VkRenderPass GetClearRenderPass() const { return m_clear_render_pass; }
+  bool IsMultiview() const { return m_multiview; }
   void TransitionForRender();
 
   static std::unique_ptr<VKFramebuffer> Create(VKTexture* color_attachments,
@@ -147,6 +153,7 @@ protected:
   VkRenderPass m_load_render_pass;
   VkRenderPass m_discard_render_pass;
   VkRenderPass m_clear_render_pass;
+  bool m_multiview;
 };
 
 }  // namespace Vulkan
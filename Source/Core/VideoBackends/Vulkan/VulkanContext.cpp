@@ -370,7 +370,9 @@ void VulkanContext::PopulateBackendInfo(VideoConfig* config)
   config->backend_info.bSupportsSettingObjectNames = false;        // Dependent on features.
   config->backend_info.bSupportsPartialMultisampleResolve = true;  // Assumed support.
   config->backend_info.bSupportsDynamicVertexLoader = true;        // Assumed support.
+  config->backend_info.bSupportsStaticVertexBuffers = false;
   config->backend_info.bSupportsVSLinePointExpand = true;          // Assumed support.
+  config->backend_info.bSupportsMultiview = false;                 // Dependent on features.
 }
 
 void VulkanContext::PopulateBackendInfoAdapters(VideoConfig* config, const GPUList& gpu_list)
@@ -575,6 +577,10 @@ bool VulkanContext::SelectDeviceExtensions(bool enable_surface)
   if (enable_surface && !AddExtension(VK_KHR_SWAPCHAIN_EXTENSION_NAME, true))
     return false;
 
+  // Present wait lets us limit how many frames are queued for presentation.
+  if (enable_surface && AddExtension(VK_KHR_PRESENT_ID_EXTENSION_NAME, false))
+    AddExtension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME, false);
+
 #ifdef SUPPORTS_VULKAN_EXCLUSIVE_FULLSCREEN
   // VK_EXT_full_screen_exclusive
   if (AddExtension(VK_EXT_FULL_SCREEN_EXCLUSIVE_EXTENSION_NAME, true))
@@ -689,6 +695,23 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
     return false;
   }
 
+  // Look for a transfer-only queue family, which usually maps to a DMA engine that can copy
+  // textures while the graphics queue is busy rendering.
+  m_transfer_queue_family_index = queue_family_count;
+  for (uint32_t i = 0; i < queue_family_count; i++)
+  {
+    const VkQueueFlags flags = queue_family_properties[i].queueFlags;
+    if ((flags & VK_QUEUE_TRANSFER_BIT) &&
+        !(flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) &&
+        queue_family_properties[i].queueCount > 0)
+    {
+      m_transfer_queue_family_index = i;
+      break;
+    }
+  }
+  INFO_LOG_FMT(VIDEO, "Vulkan: Dedicated transfer queue {}",
+               m_transfer_queue_family_index != queue_family_count ? "found" : "not found");
+
   VkDeviceCreateInfo device_info = {};
   device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
   device_info.pNext = nullptr;
@@ -711,16 +734,27 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   present_queue_info.queueCount = 1;
   present_queue_info.pQueuePriorities = queue_priorities;
 
-  std::array<VkDeviceQueueCreateInfo, 2> queue_infos = {{
+  VkDeviceQueueCreateInfo transfer_queue_info = {};
+  transfer_queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+  transfer_queue_info.pNext = nullptr;
+  transfer_queue_info.flags = 0;
+  transfer_queue_info.queueFamilyIndex = m_transfer_queue_family_index;
+  transfer_queue_info.queueCount = 1;
+  transfer_queue_info.pQueuePriorities = queue_priorities;
+
+  std::array<VkDeviceQueueCreateInfo, 3> queue_infos = {{
       graphics_queue_info,
-      present_queue_info,
   }};
 
   device_info.queueCreateInfoCount = 1;
   if (m_graphics_queue_family_index != m_present_queue_family_index &&
       m_present_queue_family_index != queue_family_count)
   {
-    device_info.queueCreateInfoCount = 2;
+    queue_infos[device_info.queueCreateInfoCount++] = present_queue_info;
+  }
+  if (m_transfer_queue_family_index != queue_family_count)
+  {
+    queue_infos[device_info.queueCreateInfoCount++] = transfer_queue_info;
   }
   device_info.pQueueCreateInfos = queue_infos.data();
 
@@ -743,6 +777,59 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
 
   device_info.pEnabledFeatures = &m_device_features;
 
+  // Multiview is used to render both stereoscopy layers in a single pass. It is part of Vulkan 1.1,
+  // which is also required for vkGetPhysicalDeviceFeatures2(). GX pipelines can still contain
+  // geometry shaders (lines, points, wireframe), so those must work in multiview passes too.
+  VkPhysicalDeviceMultiviewFeatures multiview_features = {};
+  multiview_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES;
+  VkPhysicalDevicePresentIdFeaturesKHR present_id_features = {};
+  present_id_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+  VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features = {};
+  present_wait_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+  if (vkGetPhysicalDeviceFeatures2 && !(VK_VERSION_MAJOR(m_device_properties.apiVersion) == 1 &&
+                                        VK_VERSION_MINOR(m_device_properties.apiVersion) < 1))
+  {
+    const bool has_present_wait_extensions =
+        SupportsDeviceExtension(VK_KHR_PRESENT_ID_EXTENSION_NAME) &&
+        SupportsDeviceExtension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+
+    VkPhysicalDeviceFeatures2 device_features_2 = {};
+    device_features_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    device_features_2.pNext = &multiview_features;
+    if (has_present_wait_extensions)
+    {
+      multiview_features.pNext = &present_id_features;
+      present_id_features.pNext = &present_wait_features;
+    }
+    vkGetPhysicalDeviceFeatures2(m_physical_device, &device_features_2);
+
+    m_supports_multiview = multiview_features.multiview == VK_TRUE &&
+                           (multiview_features.multiviewGeometryShader == VK_TRUE ||
+                            m_device_features.geometryShader == VK_FALSE);
+    m_supports_present_wait = has_present_wait_extensions &&
+                              present_id_features.presentId == VK_TRUE &&
+                              present_wait_features.presentWait == VK_TRUE;
+
+    // Only chain the features which get enabled.
+    void* enabled_features = nullptr;
+    if (m_supports_present_wait)
+    {
+      present_wait_features.pNext = nullptr;
+      present_id_features.pNext = &present_wait_features;
+      enabled_features = &present_id_features;
+    }
+    if (m_supports_multiview)
+    {
+      multiview_features.pNext = enabled_features;
+      multiview_features.multiviewTessellationShader = VK_FALSE;
+      enabled_features = &multiview_features;
+    }
+    device_info.pNext = enabled_features;
+  }
+  INFO_LOG_FMT(VIDEO, "Vulkan: Multiview {}", m_supports_multiview ? "supported" : "not supported");
+  INFO_LOG_FMT(VIDEO, "Vulkan: Present wait {}",
+               m_supports_present_wait ? "supported" : "not supported");
+
   // Enable debug layer on debug builds
   if (enable_validation_layer)
   {
@@ -760,6 +847,7 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   // With the device created, we can fill the remaining entry points.
   if (!LoadVulkanDeviceFunctions(m_device))
     return false;
+  m_supports_present_wait &= vkWaitForPresentKHR != nullptr;
 
   // Grab the graphics and present queues.
   vkGetDeviceQueue(m_device, m_graphics_queue_family_index, 0, &m_graphics_queue);
@@ -767,6 +855,10 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   {
     vkGetDeviceQueue(m_device, m_present_queue_family_index, 0, &m_present_queue);
   }
+  if (m_transfer_queue_family_index != queue_family_count)
+  {
+    vkGetDeviceQueue(m_device, m_transfer_queue_family_index, 0, &m_transfer_queue);
+  }
   return true;
 }
 
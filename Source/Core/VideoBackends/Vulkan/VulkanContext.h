@@ -61,6 +61,9 @@ public:
   u32 GetGraphicsQueueFamilyIndex() const { return m_graphics_queue_family_index; }
   VkQueue GetPresentQueue() const { return m_present_queue; }
   u32 GetPresentQueueFamilyIndex() const { return m_present_queue_family_index; }
+  // The transfer queue is VK_NULL_HANDLE if the device has no dedicated transfer queue family.
+  VkQueue GetTransferQueue() const { return m_transfer_queue; }
+  u32 GetTransferQueueFamilyIndex() const { return m_transfer_queue_family_index; }
   const VkQueueFamilyProperties& GetGraphicsQueueProperties() const
   {
     return m_graphics_queue_properties;
@@ -83,6 +86,8 @@ public:
   }
   u32 GetShaderSubgroupSize() const { return m_shader_subgroup_size; }
   bool SupportsShaderSubgroupOperations() const { return m_supports_shader_subgroup_operations; }
+  bool SupportsMultiview() const { return m_supports_multiview; }
+  bool SupportsPresentWait() const { return m_supports_present_wait; }
 
   // Helpers for getting constants
   VkDeviceSize GetUniformBufferAlignment() const
@@ -133,6 +138,8 @@ private:
   u32 m_graphics_queue_family_index = 0;
   VkQueue m_present_queue = VK_NULL_HANDLE;
   u32 m_present_queue_family_index = 0;
+  VkQueue m_transfer_queue = VK_NULL_HANDLE;
+  u32 m_transfer_queue_family_index = 0;
   VkQueueFamilyProperties m_graphics_queue_properties = {};
 
   VkDebugUtilsMessengerEXT m_debug_utils_messenger = VK_NULL_HANDLE;
@@ -143,6 +150,8 @@ private:
 
   u32 m_shader_subgroup_size = 1;
   bool m_supports_shader_subgroup_operations = false;
+  bool m_supports_multiview = false;
+  bool m_supports_present_wait = false;
 
   std::vector<std::string> m_device_extensions;
 };
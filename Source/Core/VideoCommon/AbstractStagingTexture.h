@@ -67,6 +67,10 @@ public:
   // call to CopyFromTexture()/CopyToTexture() and the Flush() call.
   virtual void Flush() = 0;
 
+  // Returns true if Flush() wouldn't have to wait for the GPU, because the last copy has already
+  // completed. Backends which can't tell without waiting always return true.
+  virtual bool IsCopyComplete() const { return true; }
+
   // Reads the specified rectangle from the staging texture to out_ptr, with the specified stride
   // (length in bytes of each row). CopyFromTexture must be called first. The contents of any
   // texels outside of the rectangle used for CopyFromTexture is undefined.
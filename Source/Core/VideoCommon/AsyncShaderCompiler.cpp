@@ -3,6 +3,7 @@
 
 #include "VideoCommon/AsyncShaderCompiler.h"
 
+#include <algorithm>
 #include <thread>
 
 #include "Common/Assert.h"
@@ -31,15 +32,54 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   {
     item->Compile();
     m_completed_work.push_back(std::move(item));
+    return;
+  }
+
+  // The count is raised first so that it never drops below the number of queued items.
+  m_pending_count++;
+  if (priority < URGENT_PRIORITY_LIMIT)
+  {
+    std::lock_guard<std::mutex> guard(m_urgent_work.lock);
+    m_urgent_work.items.emplace(priority, std::move(item));
+    m_urgent_count++;
   }
   else
   {
-    std::lock_guard<std::mutex> guard(m_pending_work_lock);
-    m_pending_work.emplace(priority, std::move(item));
+    WorkQueue& queue = *m_worker_queues[m_next_worker_queue++ % m_worker_queues.size()];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    queue.items.emplace(priority, std::move(item));
+  }
+
+  // Workers check the pending count after announcing that they are going to sleep, so we only
+  // need to take the lock when someone could be waiting.
+  if (m_sleeping_workers.load() != 0)
+  {
+    std::lock_guard<std::mutex> guard(m_wake_lock);
     m_worker_thread_wake.notify_one();
   }
 }
 
+void AsyncShaderCompiler::CancelPendingWork()
+{
+  std::vector<WorkItemPtr> cancelled_work;
+  const auto remove_items = [&](WorkQueue& queue) {
+    std::lock_guard<std::mutex> guard(queue.lock);
+    for (auto& it : queue.items)
+      cancelled_work.push_back(std::move(it.second));
+    m_pending_count -= queue.items.size();
+    if (&queue == &m_urgent_work)
+      m_urgent_count -= queue.items.size();
+    queue.items.clear();
+  };
+
+  remove_items(m_urgent_work);
+  for (auto& queue : m_worker_queues)
+    remove_items(*queue);
+
+  for (WorkItemPtr& item : cancelled_work)
+    item->Cancel();
+}
+
 void AsyncShaderCompiler::RetrieveWorkItems()
 {
   std::deque<WorkItemPtr> completed_work;
@@ -57,8 +97,12 @@ void AsyncShaderCompiler::RetrieveWorkItems()
 
 bool AsyncShaderCompiler::HasPendingWork()
 {
-  std::lock_guard<std::mutex> guard(m_pending_work_lock);
-  return !m_pending_work.empty() || m_busy_workers.load() != 0;
+  return m_pending_count.load() != 0 || m_busy_workers.load() != 0;
+}
+
+size_t AsyncShaderCompiler::GetPendingWorkCount()
+{
+  return m_pending_count.load() + m_busy_workers.load();
 }
 
 bool AsyncShaderCompiler::HasCompletedWork()
@@ -87,10 +131,8 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
   // Grab the number of pending items. We use this to work out how many are left.
   size_t total_items;
   {
-    // Safe to hold both locks here, since nowhere else does.
-    std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
     std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-    total_items = m_completed_work.size() + m_pending_work.size() + m_busy_workers.load() + 1;
+    total_items = m_completed_work.size() + GetPendingWorkCount() + 1;
   }
 
   // Update progress while the compiles complete.
@@ -99,13 +141,11 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
     if (Core::GetState() == Core::State::Stopping)
       return false;
 
-    size_t remaining_items;
-    {
-      std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
-      if (m_pending_work.empty() && !m_busy_workers.load())
-        break;
-      remaining_items = m_pending_work.size();
-    }
+    if (!HasPendingWork())
+      break;
+
+    // Items queued after we started are not included in the total.
+    const size_t remaining_items = std::min(m_pending_count.load(), total_items);
 
     progress_callback(total_items - remaining_items, total_items);
     std::this_thread::sleep_for(CHECK_INTERVAL);
@@ -118,6 +158,7 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
   if (num_worker_threads == 0)
     return true;
 
+  ResizeWorkQueues(num_worker_threads);
   for (u32 i = 0; i < num_worker_threads; i++)
   {
     void* thread_param = nullptr;
@@ -129,7 +170,8 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
 
     m_worker_thread_start_result.store(false);
 
-    std::thread thr(&AsyncShaderCompiler::WorkerThreadEntryPoint, this, thread_param);
+    std::thread thr(&AsyncShaderCompiler::WorkerThreadEntryPoint, this, thread_param,
+                    m_worker_threads.size());
     m_init_event.Wait();
 
     if (!m_worker_thread_start_result.load())
@@ -166,7 +208,7 @@ void AsyncShaderCompiler::StopWorkerThreads()
 
   // Signal worker threads to stop, and wake all of them.
   {
-    std::lock_guard<std::mutex> guard(m_pending_work_lock);
+    std::lock_guard<std::mutex> guard(m_wake_lock);
     m_exit_flag.Set();
     m_worker_thread_wake.notify_all();
   }
@@ -178,6 +220,60 @@ void AsyncShaderCompiler::StopWorkerThreads()
   m_exit_flag.Clear();
 }
 
+void AsyncShaderCompiler::ResizeWorkQueues(size_t num_queues)
+{
+  if (m_worker_queues.size() == num_queues)
+    return;
+
+  // Items which are still queued from the previous thread configuration are spread over the new
+  // queues. No workers are running at this point, so the queues don't need to be locked.
+  std::multimap<u32, WorkItemPtr> queued_items;
+  for (auto& queue : m_worker_queues)
+    queued_items.merge(queue->items);
+
+  m_worker_queues.clear();
+  for (size_t i = 0; i < num_queues; i++)
+    m_worker_queues.push_back(std::make_unique<WorkQueue>());
+
+  size_t index = 0;
+  for (auto& it : queued_items)
+    m_worker_queues[index++ % num_queues]->items.emplace(it.first, std::move(it.second));
+}
+
+AsyncShaderCompiler::WorkItemPtr AsyncShaderCompiler::TakeWorkItem(WorkQueue& queue)
+{
+  std::lock_guard<std::mutex> guard(queue.lock);
+  if (queue.items.empty())
+    return nullptr;
+
+  auto iter = queue.items.begin();
+  WorkItemPtr item(std::move(iter->second));
+  queue.items.erase(iter);
+  m_pending_count--;
+  if (&queue == &m_urgent_work)
+    m_urgent_count--;
+  return item;
+}
+
+AsyncShaderCompiler::WorkItemPtr AsyncShaderCompiler::TakeWorkItem(size_t worker_index)
+{
+  if (m_urgent_count.load() != 0)
+  {
+    if (WorkItemPtr item = TakeWorkItem(m_urgent_work))
+      return item;
+  }
+
+  // Prefer our own queue, then steal from the other workers.
+  const size_t num_queues = m_worker_queues.size();
+  for (size_t i = 0; i < num_queues; i++)
+  {
+    if (WorkItemPtr item = TakeWorkItem(*m_worker_queues[(worker_index + i) % num_queues]))
+      return item;
+  }
+
+  return nullptr;
+}
+
 bool AsyncShaderCompiler::WorkerThreadInitMainThread(void** param)
 {
   return true;
@@ -192,9 +288,10 @@ void AsyncShaderCompiler::WorkerThreadExit(void* param)
 {
 }
 
-void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
+void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param, size_t worker_index)
 {
   Common::SetCurrentThreadName("AsyncShaderCompiler Worker");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
 
   // Initialize worker thread with backend-specific method.
   if (!WorkerThreadInitWorkerThread(param))
@@ -208,35 +305,36 @@ void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
   m_worker_thread_start_result.store(true);
   m_init_event.Set();
 
-  WorkerThreadRun();
+  WorkerThreadRun(worker_index);
 
   WorkerThreadExit(param);
 }
 
-void AsyncShaderCompiler::WorkerThreadRun()
+void AsyncShaderCompiler::WorkerThreadRun(size_t worker_index)
 {
-  std::unique_lock<std::mutex> pending_lock(m_pending_work_lock);
   while (!m_exit_flag.IsSet())
   {
-    m_worker_thread_wake.wait(pending_lock);
-
-    while (!m_pending_work.empty() && !m_exit_flag.IsSet())
+    // Mark ourselves as busy before taking an item, so that there is no window where the item
+    // is neither pending nor being compiled.
+    m_busy_workers++;
+    if (WorkItemPtr item = TakeWorkItem(worker_index))
     {
-      m_busy_workers++;
-      auto iter = m_pending_work.begin();
-      WorkItemPtr item(std::move(iter->second));
-      m_pending_work.erase(iter);
-      pending_lock.unlock();
-
       if (item->Compile())
       {
         std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
         m_completed_work.push_back(std::move(item));
       }
 
-      pending_lock.lock();
       m_busy_workers--;
+      continue;
     }
+    m_busy_workers--;
+
+    std::unique_lock<std::mutex> wake_lock(m_wake_lock);
+    m_sleeping_workers++;
+    m_worker_thread_wake.wait(
+        wake_lock, [this] { return m_exit_flag.IsSet() || m_pending_count.load() != 0; });
+    m_sleeping_workers--;
   }
 }
 
@@ -29,6 +29,9 @@ public:
     virtual ~WorkItem() = default;
     virtual bool Compile() = 0;
     virtual void Retrieve() = 0;
+
+    // Called on the thread which cancelled the work item, instead of Compile() and Retrieve().
+    virtual void Cancel() {}
   };
 
   using WorkItemPtr = std::unique_ptr<WorkItem>;
@@ -42,12 +45,20 @@ public:
     return std::make_unique<T>(std::forward<Params>(params)...);
   }
 
+  // Work items with a priority below this value are needed for the current frame. These are
+  // taken by the next free worker, instead of waiting in the queue of a single worker.
+  static constexpr u32 URGENT_PRIORITY_LIMIT = 200;
+
   // Queues a new work item to the compiler threads. The lower the priority, the sooner
   // this work item will be compiled, relative to the other work items.
   void QueueWorkItem(WorkItemPtr item, u32 priority);
+  // Removes all work items which have not started compiling yet, calling Cancel() on each.
+  void CancelPendingWork();
   void RetrieveWorkItems();
   bool HasPendingWork();
   bool HasCompletedWork();
+  // The number of work items that are queued or being compiled.
+  size_t GetPendingWorkCount();
 
   // Calls progress_callback periodically, with completed_items, and total_items.
   // Returns false if interrupted.
@@ -65,8 +76,19 @@ protected:
   virtual void WorkerThreadExit(void* param);
 
 private:
-  void WorkerThreadEntryPoint(void* param);
-  void WorkerThreadRun();
+  // Work items ordered by priority. We can't use a priority_queue here, because there's no way
+  // to obtain a non-const reference, which we need for the unique_ptr.
+  struct WorkQueue
+  {
+    std::mutex lock;
+    std::multimap<u32, WorkItemPtr> items;
+  };
+
+  void ResizeWorkQueues(size_t num_queues);
+  WorkItemPtr TakeWorkItem(WorkQueue& queue);
+  WorkItemPtr TakeWorkItem(size_t worker_index);
+  void WorkerThreadEntryPoint(void* param, size_t worker_index);
+  void WorkerThreadRun(size_t worker_index);
 
   Common::Flag m_exit_flag;
   Common::Event m_init_event;
@@ -74,13 +96,20 @@ private:
   std::vector<std::thread> m_worker_threads;
   std::atomic_bool m_worker_thread_start_result{false};
 
-  // A multimap is used to store the work items. We can't use a priority_queue here, because
-  // there's no way to obtain a non-const reference, which we need for the unique_ptr.
-  std::multimap<u32, WorkItemPtr> m_pending_work;
-  std::mutex m_pending_work_lock;
-  std::condition_variable m_worker_thread_wake;
+  // Urgent work is shared between all workers. Everything else is spread over one queue per
+  // worker, so that workers don't contend on a single lock during precompilation. Idle workers
+  // steal from the queues of the other workers.
+  WorkQueue m_urgent_work;
+  std::vector<std::unique_ptr<WorkQueue>> m_worker_queues;
+  std::atomic_size_t m_next_worker_queue{0};
+  std::atomic_size_t m_urgent_count{0};
+  std::atomic_size_t m_pending_count{0};
   std::atomic_size_t m_busy_workers{0};
 
+  std::mutex m_wake_lock;
+  std::condition_variable m_worker_thread_wake;
+  std::atomic_size_t m_sleeping_workers{0};
+
   std::deque<WorkItemPtr> m_completed_work;
   std::mutex m_completed_work_lock;
 };
@@ -0,0 +1,284 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/BC7Encoder.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace BC7Encoder
+{
+namespace
+{
+constexpr std::array<int, 16> WEIGHTS = {0,  4,  9,  13, 17, 21, 26, 30,
+                                         34, 38, 43, 47, 51, 55, 60, 64};
+
+using Color = std::array<float, 4>;
+using Pixels = std::array<std::array<int, 4>, 16>;
+
+struct Endpoint
+{
+  // 7 bit values, which get expanded to 8 bit by appending the p-bit
+  std::array<int, 4> values{};
+  int p_bit = 0;
+
+  int Expand(size_t channel) const { return (values[channel] << 1) | p_bit; }
+};
+
+struct EncodedBlock
+{
+  std::array<Endpoint, 2> endpoints;
+  std::array<int, 16> indices{};
+  int error = 0;
+};
+
+Endpoint QuantizeEndpoint(const Color& color)
+{
+  // Fully opaque and fully transparent colors should stay exact, as they usually matter for alpha
+  // testing, so the alpha channel decides the p-bit in those cases.
+  const float alpha = std::clamp(color[3], 0.0f, 255.0f);
+  int first_p_bit = 0;
+  int last_p_bit = 1;
+  if (alpha >= 254.5f)
+    first_p_bit = 1;
+  else if (alpha < 0.5f)
+    last_p_bit = 0;
+
+  Endpoint best;
+  float best_error = INFINITY;
+  for (int p_bit = first_p_bit; p_bit <= last_p_bit; p_bit++)
+  {
+    Endpoint endpoint;
+    endpoint.p_bit = p_bit;
+    float error = 0.0f;
+    for (size_t c = 0; c < 4; c++)
+    {
+      const float value = std::clamp(color[c], 0.0f, 255.0f);
+      endpoint.values[c] =
+          std::clamp(static_cast<int>(std::lround((value - endpoint.p_bit) / 2.0f)), 0, 127);
+      const float difference = endpoint.Expand(c) - value;
+      error += difference * difference;
+    }
+
+    if (error < best_error)
+    {
+      best_error = error;
+      best = endpoint;
+    }
+  }
+
+  return best;
+}
+
+// Picks the best palette entry for every pixel.
+void SelectIndices(const Pixels& pixels, EncodedBlock* block)
+{
+  std::array<std::array<int, 4>, 16> palette;
+  for (size_t i = 0; i < palette.size(); i++)
+  {
+    for (size_t c = 0; c < 4; c++)
+    {
+      const int e0 = block->endpoints[0].Expand(c);
+      const int e1 = block->endpoints[1].Expand(c);
+      palette[i][c] = ((64 - WEIGHTS[i]) * e0 + WEIGHTS[i] * e1 + 32) >> 6;
+    }
+  }
+
+  block->error = 0;
+  for (size_t p = 0; p < pixels.size(); p++)
+  {
+    int best_error = std::numeric_limits<int>::max();
+    for (size_t i = 0; i < palette.size(); i++)
+    {
+      int error = 0;
+      for (size_t c = 0; c < 4; c++)
+      {
+        const int difference = palette[i][c] - pixels[p][c];
+        error += difference * difference;
+      }
+      if (error < best_error)
+      {
+        best_error = error;
+        block->indices[p] = static_cast<int>(i);
+      }
+    }
+    block->error += best_error;
+  }
+}
+
+// Finds the endpoints which minimize the squared error for the current indices.
+bool RefitEndpoints(const Pixels& pixels, EncodedBlock* block)
+{
+  float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+  Color a_pixels{}, b_pixels{};
+  for (size_t p = 0; p < pixels.size(); p++)
+  {
+    const float b = WEIGHTS[block->indices[p]] / 64.0f;
+    const float a = 1.0f - b;
+    aa += a * a;
+    ab += a * b;
+    bb += b * b;
+    for (size_t c = 0; c < 4; c++)
+    {
+      a_pixels[c] += a * pixels[p][c];
+      b_pixels[c] += b * pixels[p][c];
+    }
+  }
+
+  const float determinant = aa * bb - ab * ab;
+  if (std::abs(determinant) < 1e-6f)
+    return false;
+
+  Color e0, e1;
+  for (size_t c = 0; c < 4; c++)
+  {
+    e0[c] = (bb * a_pixels[c] - ab * b_pixels[c]) / determinant;
+    e1[c] = (aa * b_pixels[c] - ab * a_pixels[c]) / determinant;
+  }
+  block->endpoints = {QuantizeEndpoint(e0), QuantizeEndpoint(e1)};
+  return true;
+}
+
+EncodedBlock EncodeBlock(const Pixels& pixels)
+{
+  // Use the principal axis of the colors as the line the palette is spread along.
+  Color mean{};
+  for (const auto& pixel : pixels)
+  {
+    for (size_t c = 0; c < 4; c++)
+      mean[c] += pixel[c] / 16.0f;
+  }
+
+  std::array<Color, 4> covariance{};
+  for (const auto& pixel : pixels)
+  {
+    for (size_t i = 0; i < 4; i++)
+    {
+      for (size_t j = 0; j < 4; j++)
+        covariance[i][j] += (pixel[i] - mean[i]) * (pixel[j] - mean[j]);
+    }
+  }
+
+  Color axis = {1.0f, 1.0f, 1.0f, 1.0f};
+  for (int iteration = 0; iteration < 8; iteration++)
+  {
+    Color next{};
+    for (size_t i = 0; i < 4; i++)
+    {
+      for (size_t j = 0; j < 4; j++)
+        next[i] += covariance[i][j] * axis[j];
+    }
+    const float length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2] +
+                                   next[3] * next[3]);
+    if (length < 1e-6f)
+      break;
+    for (size_t c = 0; c < 4; c++)
+      axis[c] = next[c] / length;
+  }
+
+  float min_t = INFINITY;
+  float max_t = -INFINITY;
+  for (const auto& pixel : pixels)
+  {
+    float t = 0.0f;
+    for (size_t c = 0; c < 4; c++)
+      t += (pixel[c] - mean[c]) * axis[c];
+    min_t = std::min(min_t, t);
+    max_t = std::max(max_t, t);
+  }
+
+  Color e0, e1;
+  for (size_t c = 0; c < 4; c++)
+  {
+    e0[c] = mean[c] + min_t * axis[c];
+    e1[c] = mean[c] + max_t * axis[c];
+  }
+
+  EncodedBlock block;
+  block.endpoints = {QuantizeEndpoint(e0), QuantizeEndpoint(e1)};
+  SelectIndices(pixels, &block);
+
+  EncodedBlock refined = block;
+  if (block.error != 0 && RefitEndpoints(pixels, &refined))
+  {
+    SelectIndices(pixels, &refined);
+    if (refined.error < block.error)
+      block = refined;
+  }
+
+  // The most significant bit of the first index isn't stored, so it has to be 0.
+  if (block.indices[0] >= 8)
+  {
+    std::swap(block.endpoints[0], block.endpoints[1]);
+    for (int& index : block.indices)
+      index = 15 - index;
+  }
+
+  return block;
+}
+
+class BitWriter
+{
+public:
+  void Write(u32 value, u32 bit_count)
+  {
+    for (u32 i = 0; i < bit_count; i++, m_position++)
+      m_bits[m_position / 64] |= static_cast<u64>((value >> i) & 1) << (m_position % 64);
+  }
+
+  void CopyTo(u8* dst) const { std::memcpy(dst, m_bits.data(), sizeof(m_bits)); }
+
+private:
+  std::array<u64, 2> m_bits{};
+  u32 m_position = 0;
+};
+
+void WriteBlock(u8* dst, const EncodedBlock& block)
+{
+  BitWriter writer;
+
+  // Mode 6 is stored as six 0 bits followed by a 1 bit.
+  writer.Write(1 << 6, 7);
+  for (size_t c = 0; c < 4; c++)
+  {
+    writer.Write(block.endpoints[0].values[c], 7);
+    writer.Write(block.endpoints[1].values[c], 7);
+  }
+  writer.Write(block.endpoints[0].p_bit, 1);
+  writer.Write(block.endpoints[1].p_bit, 1);
+  for (size_t i = 0; i < block.indices.size(); i++)
+    writer.Write(block.indices[i], i == 0 ? 3 : 4);
+
+  writer.CopyTo(dst);
+}
+}  // namespace
+
+void Encode(u8* dst, const u8* src, u32 width, u32 height, u32 row_length)
+{
+  for (u32 block_y = 0; block_y < height; block_y += BLOCK_SIZE)
+  {
+    for (u32 block_x = 0; block_x < width; block_x += BLOCK_SIZE)
+    {
+      Pixels pixels;
+      for (u32 y = 0; y < BLOCK_SIZE; y++)
+      {
+        const u32 src_y = std::min(block_y + y, height - 1);
+        for (u32 x = 0; x < BLOCK_SIZE; x++)
+        {
+          const u32 src_x = std::min(block_x + x, width - 1);
+          const u8* pixel = src + (static_cast<size_t>(src_y) * row_length + src_x) * 4;
+          for (size_t c = 0; c < 4; c++)
+            pixels[y * BLOCK_SIZE + x][c] = pixel[c];
+        }
+      }
+
+      WriteBlock(dst, EncodeBlock(pixels));
+      dst += BYTES_PER_BLOCK;
+    }
+  }
+}
+}  // namespace BC7Encoder
@@ -0,0 +1,27 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// A simple BC7 encoder for RGBA8 images, which only uses mode 6 (a single pair of RGBA endpoints
+// with 4 bit indices). This keeps it fast enough to compress custom textures in the background,
+// while the quality is still close to that of the uncompressed image for most content.
+namespace BC7Encoder
+{
+constexpr u32 BLOCK_SIZE = 4;
+constexpr u32 BYTES_PER_BLOCK = 16;
+
+constexpr size_t GetEncodedSize(u32 width, u32 height)
+{
+  return static_cast<size_t>((width + BLOCK_SIZE - 1) / BLOCK_SIZE) *
+         ((height + BLOCK_SIZE - 1) / BLOCK_SIZE) * BYTES_PER_BLOCK;
+}
+
+// Encodes an RGBA8 image with row_length pixels per row into GetEncodedSize(width, height) bytes
+// of BC7 blocks. Pixels of partial blocks at the edges are replicated from the last row/column.
+void Encode(u8* dst, const u8* src, u32 width, u32 height, u32 row_length);
+}  // namespace BC7Encoder
@@ -542,7 +542,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager,
     // GXClearPixMetric writes 0xAAA here, Sunshine alternates this register between values 0x000
     // and 0xAAA
     if (PerfQueryBase::ShouldEmulate())
-      g_perf_query->ResetQuery();
+      g_perf_query->ClearCounters();
     return;
 
   case BPMEM_PRELOAD_ADDR:
@@ -772,6 +772,10 @@ void LoadBPRegPreprocess(u8 reg, u32 value, int cycles_into_future)
 {
   auto& system = Core::System::GetInstance();
 
+  // On the FIFO pre-decode thread, the GPU thread still signals these once it runs the command.
+  if (!system.GetFifo().UseDeterministicGPUThread())
+    return;
+
   // masking via BPMEM_BP_MASK could hypothetically be a problem
   u32 newval = value & 0xffffff;
   switch (reg)
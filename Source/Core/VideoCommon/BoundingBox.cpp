@@ -9,6 +9,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoConfig.h"
 
 #include <algorithm>
@@ -31,6 +32,7 @@ void BoundingBox::Flush()
     return;
 
   m_is_valid = false;
+  m_readback_queued = false;
 
   if (std::none_of(m_dirty.begin(), m_dirty.end(), [](bool dirty) { return dirty; }))
     return;
@@ -51,6 +53,38 @@ void BoundingBox::Flush()
 
     Write(start, std::vector<BBoxType>(m_values.begin() + start, m_values.begin() + end));
   }
+  m_write_counter++;
+}
+
+bool BoundingBox::UseSpeculativeReadback() const
+{
+  return g_ActiveConfig.bBBoxSpeculative && SupportsAsyncReadback();
+}
+
+void BoundingBox::ProcessCompletedReadbacks()
+{
+  while (!m_pending_readbacks.empty())
+  {
+    const std::optional<BBoxValues> read_values = PollReadback();
+    if (!read_values)
+      break;
+
+    const PendingReadback readback = m_pending_readbacks.front();
+    m_pending_readbacks.pop_front();
+
+    // The values were overwritten by the CPU after this copy was queued.
+    if (readback.write_counter != m_write_counter)
+      continue;
+
+    for (u32 i = 0; i < NUM_BBOX_VALUES; i++)
+    {
+      if (readback.speculated[i] && readback.speculated_values[i] != (*read_values)[i])
+        INCSTAT(g_stats.this_frame.num_bbox_mispredictions);
+      if (!m_dirty[i])
+        m_values[i] = (*read_values)[i];
+    }
+    m_has_speculative_values = true;
+  }
 }
 
 void BoundingBox::Readback()
@@ -74,8 +108,35 @@ u16 BoundingBox::Get(u32 index)
 {
   ASSERT(index < NUM_BBOX_VALUES);
 
+  if (!m_is_valid && UseSpeculativeReadback())
+  {
+    // Hand out the last completed values rather than waiting for the GPU, and queue a copy of
+    // the current ones for later reads. Only the very first read has to wait.
+    ProcessCompletedReadbacks();
+    if (m_has_speculative_values)
+    {
+      if (!m_readback_queued && QueueReadback())
+      {
+        m_pending_readbacks.push_back({m_write_counter});
+        m_readback_queued = true;
+      }
+      if (m_readback_queued)
+      {
+        PendingReadback& readback = m_pending_readbacks.back();
+        readback.speculated_values[index] = m_values[index];
+        readback.speculated[index] = true;
+      }
+
+      INCSTAT(g_stats.this_frame.num_bbox_speculative_reads);
+      return static_cast<u16>(m_values[index]);
+    }
+  }
+
   if (!m_is_valid)
+  {
     Readback();
+    m_has_speculative_values = true;
+  }
 
   return static_cast<u16>(m_values[index]);
 }
@@ -110,6 +171,10 @@ void BoundingBox::DoState(PointerWrap& p)
 
     if (g_ActiveConfig.backend_info.bSupportsBBox)
       Write(0, backend_values);
+
+    // Drop the results of any readbacks which are still in flight.
+    m_write_counter++;
+    m_readback_queued = false;
   }
   else
   {
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <deque>
+#include <optional>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -13,6 +15,7 @@ class PointerWrap;
 
 using BBoxType = s32;
 constexpr u32 NUM_BBOX_VALUES = 4;
+using BBoxValues = std::array<BBoxType, NUM_BBOX_VALUES>;
 
 class BoundingBox
 {
@@ -40,12 +43,38 @@ protected:
   // TODO: This can likely use std::span once we're on C++20
   virtual void Write(u32 index, const std::vector<BBoxType>& values) = 0;
 
+  // Asynchronous readback, used by the speculative mode. QueueReadback() records a copy of the
+  // current values without waiting for it, and returns false if no copy could be queued (e.g.
+  // all readback buffers are in use). PollReadback() returns the values of the oldest queued
+  // copy once it has completed, so copies come back in the order they were queued.
+  virtual bool SupportsAsyncReadback() const { return false; }
+  virtual bool QueueReadback() { return false; }
+  virtual std::optional<BBoxValues> PollReadback() { return std::nullopt; }
+
 private:
+  // Values handed out while a queued readback was in flight, to measure how often they were
+  // different from the real ones.
+  struct PendingReadback
+  {
+    u32 write_counter = 0;
+    BBoxValues speculated_values = {};
+    std::array<bool, NUM_BBOX_VALUES> speculated = {};
+  };
+
   void Readback();
+  bool UseSpeculativeReadback() const;
+  void ProcessCompletedReadbacks();
 
   bool m_is_active = false;
 
   std::array<BBoxType, NUM_BBOX_VALUES> m_values = {};
   std::array<bool, NUM_BBOX_VALUES> m_dirty = {};
   bool m_is_valid = true;
+
+  // Speculative readback state. Readbacks queued before a write would return stale values, so
+  // their results are discarded if the write counter changed in the meantime.
+  std::deque<PendingReadback> m_pending_readbacks;
+  bool m_has_speculative_values = false;
+  bool m_readback_queued = false;
+  u32 m_write_counter = 0;
 };
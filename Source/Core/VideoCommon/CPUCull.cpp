@@ -3,6 +3,10 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+#include <thread>
+
+#include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
@@ -120,6 +124,11 @@ static Common::EnumMap<CPUCull::CullFunction, CullMode::All> GetCullFunction1()
   };
 }
 
+// Draws with fewer vertices than this are transformed inline, as handing them to the workers
+// costs more than it saves.
+static constexpr u32 PARALLEL_TRANSFORM_THRESHOLD = 2048;
+static constexpr u32 MIN_VERTICES_PER_CHUNK = 1024;
+
 CPUCull::~CPUCull() = default;
 
 void CPUCull::Init()
@@ -162,11 +171,60 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
     cullmode = cullmode_invert[cullmode];
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
-  transform(m_transform_buffer.get(), src, stride, count);
+  TransformVertices(transform, src, stride, count);
   const CullFunction cull = m_cull_table[primitive][cullmode];
   return cull(m_transform_buffer.get(), count);
 }
 
+void CPUCull::TransformVertices(TransformFunction function, const u8* src, u32 stride, u32 count)
+{
+  if (count < PARALLEL_TRANSFORM_THRESHOLD)
+  {
+    function(m_transform_buffer.get(), src, stride, count);
+    return;
+  }
+
+  if (m_transform_workers.empty()) [[unlikely]]
+  {
+    const u32 num_workers = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u) - 1;
+    for (u32 i = 0; i < num_workers; i++)
+    {
+      m_transform_workers.push_back(std::make_unique<Common::WorkQueueThread<TransformRequest>>(
+          [this](TransformRequest request) { RunTransformRequest(request); }));
+    }
+  }
+
+  const u32 num_chunks = std::min(static_cast<u32>(m_transform_workers.size()) + 1,
+                                  count / MIN_VERTICES_PER_CHUNK);
+  if (num_chunks <= 1)
+  {
+    function(m_transform_buffer.get(), src, stride, count);
+    return;
+  }
+
+  // Chunks start on even vertices so that the AVX transform's paired stores stay aligned.
+  const u32 chunk_size = Common::AlignUp((count + num_chunks - 1) / num_chunks, 2);
+  m_pending_transforms.store(num_chunks - 1, std::memory_order_relaxed);
+  m_transforms_done.Reset();
+
+  u32 start = 0;
+  for (u32 i = 0; i < num_chunks - 1; i++, start += chunk_size)
+  {
+    m_transform_workers[i]->EmplaceItem(TransformRequest{
+        function, m_transform_buffer.get() + start, src + start * stride, stride, chunk_size});
+  }
+  function(m_transform_buffer.get() + start, src + start * stride, stride, count - start);
+
+  m_transforms_done.Wait();
+}
+
+void CPUCull::RunTransformRequest(const TransformRequest& request)
+{
+  request.function(request.output, request.src, request.stride, request.count);
+  if (m_pending_transforms.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    m_transforms_done.Set();
+}
+
 template <typename T>
 void CPUCull::BufferDeleter<T>::operator()(T* ptr)
 {
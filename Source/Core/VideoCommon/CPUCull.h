@@ -3,6 +3,13 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "Common/Event.h"
+#include "Common/WorkQueueThread.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -24,6 +31,18 @@ public:
   using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
 
 private:
+  struct TransformRequest
+  {
+    TransformFunction function;
+    TransformedVertex* output;
+    const u8* src;
+    u32 stride;
+    u32 count;
+  };
+
+  void TransformVertices(TransformFunction function, const u8* src, u32 stride, u32 count);
+  void RunTransformRequest(const TransformRequest& request);
+
   template <typename T>
   struct BufferDeleter
   {
@@ -35,4 +54,10 @@ private:
   Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
                   OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
       m_cull_table;
+
+  // Large draws have their vertices transformed in chunks on these, with the GPU thread taking
+  // the last chunk itself.
+  std::vector<std::unique_ptr<Common::WorkQueueThread<TransformRequest>>> m_transform_workers;
+  std::atomic<u32> m_pending_transforms = 0;
+  Common::Event m_transforms_done;
 };
@@ -357,7 +357,7 @@ void CommandProcessorManager::RegisterMMIO(Core::System& system, MMIO::Mapping*
   mmio->Register(base | FIFO_READ_POINTER_HI, fifo_read_hi_r, fifo_read_hi_w);
 }
 
-void CommandProcessorManager::GatherPipeBursted(Core::System& system)
+void CommandProcessorManager::GatherPipeBursted(Core::System& system, u32 num_bursts)
 {
   auto& fifo = m_fifo;
 
@@ -384,14 +384,17 @@ void CommandProcessorManager::GatherPipeBursted(Core::System& system)
   }
 
   // update the fifo pointer
-  if (fifo.CPWritePointer.load(std::memory_order_relaxed) ==
-      fifo.CPEnd.load(std::memory_order_relaxed))
+  for (u32 i = 0; i < num_bursts; ++i)
   {
-    fifo.CPWritePointer.store(fifo.CPBase, std::memory_order_relaxed);
-  }
-  else
-  {
-    fifo.CPWritePointer.fetch_add(GPFifo::GATHER_PIPE_SIZE, std::memory_order_relaxed);
+    if (fifo.CPWritePointer.load(std::memory_order_relaxed) ==
+        fifo.CPEnd.load(std::memory_order_relaxed))
+    {
+      fifo.CPWritePointer.store(fifo.CPBase, std::memory_order_relaxed);
+    }
+    else
+    {
+      fifo.CPWritePointer.fetch_add(GPFifo::GATHER_PIPE_SIZE, std::memory_order_relaxed);
+    }
   }
 
   if (m_cp_ctrl_reg.GPReadEnable && m_cp_ctrl_reg.GPLinkEnable)
@@ -406,7 +409,8 @@ void CommandProcessorManager::GatherPipeBursted(Core::System& system)
   if (fifo.bFF_HiWatermark.load(std::memory_order_relaxed) != 0)
     system.GetCoreTiming().ForceExceptionCheck(0);
 
-  fifo.CPReadWriteDistance.fetch_add(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
+  fifo.CPReadWriteDistance.fetch_add(GPFifo::GATHER_PIPE_SIZE * num_bursts,
+                                     std::memory_order_seq_cst);
 
   system.GetFifo().RunGpu(system);
 
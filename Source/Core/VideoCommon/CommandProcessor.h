@@ -167,7 +167,8 @@ public:
 
   void SetCPStatusFromGPU(Core::System& system);
   void SetCPStatusFromCPU(Core::System& system);
-  void GatherPipeBursted(Core::System& system);
+  // Called after num_bursts 32-byte bursts have been written from the gather pipe to the FIFO.
+  void GatherPipeBursted(Core::System& system, u32 num_bursts = 1);
   void UpdateInterrupts(Core::System& system, u64 userdata);
   void UpdateInterruptsFromVideoBackend(Core::System& system, u64 userdata);
 
@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <type_traits>
+
+#include "Common/CommonTypes.h"
+
+// Keeps a copy of the last constants uploaded for a shader stage, and works out which rows
+// (16-byte vec4s, the granularity of HLSL/GLSL constant packing) actually differ.
+//
+// The shader managers set their dirty flag whenever any register that feeds the constants is
+// written, even if the value didn't change, and games rewrite the same state a lot. Diffing
+// against what was last uploaded lets us skip those uploads entirely, and gives backends the
+// range of rows which need to be written when they can update a block in place.
+template <typename T>
+class ConstantUploadTracker final
+{
+public:
+  static constexpr u32 ROW_SIZE = 16;
+  static constexpr u32 NUM_ROWS = (sizeof(T) + ROW_SIZE - 1) / ROW_SIZE;
+
+  static_assert(std::is_trivially_copyable_v<T>, "Constants must be trivially copyable");
+
+  struct DirtyRange
+  {
+    u32 offset = 0;
+    u32 size = 0;
+
+    bool IsEmpty() const { return size == 0; }
+  };
+
+  // Compares constants against the last uploaded copy, and records them as uploaded.
+  // Returns the byte range which differs, which covers everything after Invalidate().
+  DirtyRange Update(const T& constants)
+  {
+    if (!m_valid)
+    {
+      std::memcpy(m_shadow.data(), &constants, sizeof(T));
+      m_valid = true;
+      return {0, sizeof(T)};
+    }
+
+    const u8* src = reinterpret_cast<const u8*>(&constants);
+    u32 first_row = NUM_ROWS;
+    u32 last_row = 0;
+    for (u32 row = 0; row < NUM_ROWS; row++)
+    {
+      if (std::memcmp(&m_shadow[row * ROW_SIZE], src + row * ROW_SIZE, RowSize(row)) == 0)
+        continue;
+
+      if (first_row == NUM_ROWS)
+        first_row = row;
+      last_row = row;
+    }
+    if (first_row == NUM_ROWS)
+      return {};
+
+    const u32 offset = first_row * ROW_SIZE;
+    const u32 size = last_row * ROW_SIZE + RowSize(last_row) - offset;
+    std::memcpy(&m_shadow[offset], src + offset, size);
+    return {offset, size};
+  }
+
+  // Call when the uploaded copy can no longer be relied on, e.g. the buffer was reused for
+  // something else. The next Update() reports the whole struct as dirty.
+  void Invalidate() { m_valid = false; }
+
+private:
+  static constexpr u32 RowSize(u32 row)
+  {
+    return row == NUM_ROWS - 1 ? sizeof(T) - row * ROW_SIZE : ROW_SIZE;
+  }
+
+  std::array<u8, sizeof(T)> m_shadow{};
+  bool m_valid = false;
+};
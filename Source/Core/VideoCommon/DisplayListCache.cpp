@@ -0,0 +1,152 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/DisplayListCache.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <xxhash.h>
+
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+
+namespace DisplayListCache
+{
+namespace
+{
+struct Entry
+{
+  u32 size = 0;
+  u64 hash = 0;
+  // The memory usage of the list the last time it was accounted for in s_cache_size.
+  size_t memory_usage = sizeof(Entry);
+  CachedDisplayList list;
+};
+
+std::unordered_map<u32, Entry> s_entries;
+size_t s_cache_size = 0;
+// The entry which was returned by the last Lookup and may have grown since then.
+Entry* s_last_entry = nullptr;
+
+void UpdateLastEntryUsage()
+{
+  if (!s_last_entry)
+    return;
+
+  const size_t memory_usage = sizeof(Entry) + s_last_entry->list.GetMemoryUsage();
+  s_cache_size = s_cache_size - s_last_entry->memory_usage + memory_usage;
+  s_last_entry->memory_usage = memory_usage;
+  s_last_entry = nullptr;
+}
+}  // namespace
+
+bool CachedVertices::CanCache(const TVtxDesc& vtx_desc, int count)
+{
+  // With fewer vertices, the loader only overwrites part of the zfreeze state.
+  if (count < 3)
+    return false;
+
+  if (IsIndexed(vtx_desc.low.Position) || IsIndexed(vtx_desc.low.Normal))
+    return false;
+  for (size_t i = 0; i < vtx_desc.low.Color.Size(); i++)
+  {
+    if (IsIndexed(vtx_desc.low.Color[i]))
+      return false;
+  }
+  for (size_t i = 0; i < vtx_desc.high.TexCoord.Size(); i++)
+  {
+    if (IsIndexed(vtx_desc.high.TexCoord[i]))
+      return false;
+  }
+
+  return true;
+}
+
+void CachedVertices::Store(const VertexLoaderBase* vertex_loader, const u8* vertices,
+                           int vertex_count)
+{
+  loader = vertex_loader;
+  count = vertex_count;
+  data.assign(vertices, vertices + count * loader->m_native_vtx_decl.stride);
+
+  has_position_matrix_index = loader->m_native_vtx_decl.posmtx.enable;
+  has_tangent = loader->m_native_vtx_decl.normals[1].enable;
+  has_binormal = loader->m_native_vtx_decl.normals[2].enable;
+  position_cache = VertexLoaderManager::position_cache;
+  position_matrix_index_cache = VertexLoaderManager::position_matrix_index_cache;
+  tangent_cache = VertexLoaderManager::tangent_cache;
+  binormal_cache = VertexLoaderManager::binormal_cache;
+}
+
+void CachedVertices::RestoreLoaderState() const
+{
+  VertexLoaderManager::position_cache = position_cache;
+  if (has_position_matrix_index)
+    VertexLoaderManager::position_matrix_index_cache = position_matrix_index_cache;
+  if (has_tangent)
+    VertexLoaderManager::tangent_cache = tangent_cache;
+  if (has_binormal)
+    VertexLoaderManager::binormal_cache = binormal_cache;
+}
+
+CachedVertices* CachedDisplayList::GetVertices(u32 offset)
+{
+  if (m_next < m_vertices.size() && m_vertices[m_next].offset == offset)
+    return &m_vertices[m_next++];
+
+  auto it = std::lower_bound(
+      m_vertices.begin(), m_vertices.end(), offset,
+      [](const CachedVertices& vertices, u32 value) { return vertices.offset < value; });
+  if (it == m_vertices.end() || it->offset != offset)
+  {
+    it = m_vertices.emplace(it);
+    it->offset = offset;
+  }
+
+  m_next = static_cast<size_t>(it - m_vertices.begin()) + 1;
+  return &*it;
+}
+
+size_t CachedDisplayList::GetMemoryUsage() const
+{
+  size_t memory_usage = m_vertices.capacity() * sizeof(CachedVertices);
+  for (const CachedVertices& vertices : m_vertices)
+    memory_usage += vertices.data.capacity();
+  return memory_usage;
+}
+
+CachedDisplayList* Lookup(u32 address, const u8* data, u32 size)
+{
+  UpdateLastEntryUsage();
+  if (s_cache_size > MAX_CACHE_SIZE)
+    Clear();
+
+  const u64 hash = XXH3_64bits(data, size);
+  const auto [it, inserted] = s_entries.try_emplace(address);
+  Entry& entry = it->second;
+
+  // Lists are only cached once they were called twice with the same contents, as some games
+  // build a new list in the same place every frame.
+  if (inserted || entry.size != size || entry.hash != hash)
+  {
+    if (!inserted)
+      s_cache_size -= entry.memory_usage;
+    entry = Entry{size, hash};
+    s_cache_size += entry.memory_usage;
+    return nullptr;
+  }
+
+  entry.list.Rewind();
+  s_last_entry = &entry;
+  return &entry.list;
+}
+
+void Clear()
+{
+  s_entries.clear();
+  s_cache_size = 0;
+  s_last_entry = nullptr;
+}
+}  // namespace DisplayListCache
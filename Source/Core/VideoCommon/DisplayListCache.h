@@ -0,0 +1,79 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+class VertexLoaderBase;
+struct TVtxDesc;
+
+// Keeps the vertices of display lists which are called repeatedly in the native vertex format, so
+// that calling the same list again copies them instead of running the vertex loader.
+//
+// Display lists are looked up by their address, and their contents are hashed on every call, so a
+// list which was changed or replaced is converted again. Cached vertices are only used when the
+// vertex loader is the same one which converted them. Vertices with indexed attributes are never
+// cached, as they depend on the contents of the vertex arrays rather than on the list itself.
+namespace DisplayListCache
+{
+// The cache is cleared entirely when the converted vertices grow beyond this size.
+constexpr size_t MAX_CACHE_SIZE = 64 * 1024 * 1024;
+
+// The vertices of one primitive command in a display list.
+struct CachedVertices
+{
+  // Whether vertices in the given format can be stored.
+  static bool CanCache(const TVtxDesc& vtx_desc, int count);
+
+  // Stores the converted vertices along with the zfreeze and tangent state the loader left behind.
+  void Store(const VertexLoaderBase* vertex_loader, const u8* vertices, int vertex_count);
+  // Restores the state which the loader would have left behind after converting the vertices.
+  void RestoreLoaderState() const;
+
+  bool IsValidFor(const VertexLoaderBase* vertex_loader, int vertex_count) const
+  {
+    return loader == vertex_loader && count == vertex_count;
+  }
+
+  u32 offset = 0;
+  const VertexLoaderBase* loader = nullptr;
+  int count = 0;
+  std::vector<u8> data;
+
+  bool has_position_matrix_index = false;
+  bool has_tangent = false;
+  bool has_binormal = false;
+  std::array<std::array<float, 4>, 3> position_cache{};
+  std::array<u32, 3> position_matrix_index_cache{};
+  std::array<float, 4> tangent_cache{};
+  std::array<float, 4> binormal_cache{};
+};
+
+class CachedDisplayList
+{
+public:
+  // Returns the vertices of the primitive command at the given offset in the list. The pointer
+  // stays valid until the next call.
+  CachedVertices* GetVertices(u32 offset);
+
+  void Rewind() { m_next = 0; }
+  size_t GetMemoryUsage() const;
+
+private:
+  // Ordered by offset. Commands are usually looked up in this order, starting from the front.
+  std::vector<CachedVertices> m_vertices;
+  size_t m_next = 0;
+};
+
+// Returns the cache entry for a display list which is about to run, or nullptr if the list isn't
+// worth caching yet. The entry is valid until the next call to Lookup or Clear.
+CachedDisplayList* Lookup(u32 address, const u8* data, u32 size);
+
+// Must be called when vertex loaders are destroyed.
+void Clear();
+}  // namespace DisplayListCache
@@ -4,6 +4,7 @@
 #include "VideoCommon/Fifo.h"
 
 #include <atomic>
+#include <chrono>
 #include <cstring>
 
 #include "Common/Assert.h"
@@ -13,6 +14,8 @@
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Thread.h"
+#include "Common/Trace.h"
 
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -26,6 +29,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/FrameTimeBreakdown.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -36,6 +40,12 @@ namespace Fifo
 {
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
 
+// In deterministic GPU thread mode, FIFO data is preprocessed and handed to the GPU thread once at
+// least this much has been copied, rather than after every gather pipe burst.  The batch depends
+// only on the FIFO contents, so it doesn't affect determinism.  The FIFO pre-decode thread is
+// handed batches of the same size.
+static constexpr size_t PREPROCESS_BATCH_SIZE = 1024;
+
 FifoManager::FifoManager() = default;
 FifoManager::~FifoManager() = default;
 
@@ -45,6 +55,8 @@ void FifoManager::RefreshConfig()
   m_config_sync_gpu_max_distance = Config::Get(Config::MAIN_SYNC_GPU_MAX_DISTANCE);
   m_config_sync_gpu_min_distance = Config::Get(Config::MAIN_SYNC_GPU_MIN_DISTANCE);
   m_config_sync_gpu_overclock = Config::Get(Config::MAIN_SYNC_GPU_OVERCLOCK);
+  m_gpu_mainloop.SetMaxSpinTime(
+      std::chrono::microseconds(Config::Get(Config::MAIN_GPU_THREAD_SPIN_TIME)));
 }
 
 void FifoManager::DoState(PointerWrap& p)
@@ -147,7 +159,10 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (m_use_deterministic_gpu_thread)
   {
-    m_gpu_mainloop.Wait();
+    {
+      FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::GPUWait);
+      m_gpu_mainloop.Wait();
+    }
     if (!m_gpu_mainloop.IsRunning())
       return;
 
@@ -158,9 +173,7 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
                     fmt::ptr(m_fifo_aux_read_ptr));
     }
 
-    memmove(m_fifo_aux_data, m_fifo_aux_read_ptr, m_fifo_aux_write_ptr - m_fifo_aux_read_ptr);
-    m_fifo_aux_write_ptr -= (m_fifo_aux_read_ptr - m_fifo_aux_data);
-    m_fifo_aux_read_ptr = m_fifo_aux_data;
+    CompactFifoAuxBuffer();
 
     if (may_move_read_ptr)
     {
@@ -185,11 +198,21 @@ void FifoManager::PushFifoAuxBuffer(const void* ptr, size_t size)
 {
   if (size > (size_t)(m_fifo_aux_data + FIFO_SIZE - m_fifo_aux_write_ptr))
   {
-    SyncGPU(SyncGPUReason::AuxSpace, /* may_move_read_ptr */ false);
-    if (!m_gpu_mainloop.IsRunning())
+    if (m_use_deterministic_gpu_thread)
     {
-      // GPU is shutting down
-      return;
+      SyncGPU(SyncGPUReason::AuxSpace, /* may_move_read_ptr */ false);
+      if (!m_gpu_mainloop.IsRunning())
+      {
+        // GPU is shutting down
+        return;
+      }
+    }
+    else
+    {
+      // We're on the pre-decode thread, so wait for the GPU thread to run the previous batch.
+      while (m_predecode_gpu_running.IsSet())
+        m_predecode_gpu_done_event.Wait();
+      CompactFifoAuxBuffer();
     }
     if (size > (size_t)(m_fifo_aux_data + FIFO_SIZE - m_fifo_aux_write_ptr))
     {
@@ -210,6 +233,15 @@ void* FifoManager::PopFifoAuxBuffer(size_t size)
   return ret;
 }
 
+// Moves the data which hasn't been read yet to the start of the aux FIFO.  Nothing may be reading
+// from the aux FIFO meanwhile.
+void FifoManager::CompactFifoAuxBuffer()
+{
+  memmove(m_fifo_aux_data, m_fifo_aux_read_ptr, m_fifo_aux_write_ptr - m_fifo_aux_read_ptr);
+  m_fifo_aux_write_ptr -= (m_fifo_aux_read_ptr - m_fifo_aux_data);
+  m_fifo_aux_read_ptr = m_fifo_aux_data;
+}
+
 // Description: RunGpuLoop() sends data through this function.
 void FifoManager::ReadDataFromFifo(Core::System& system, u32 readPtr)
 {
@@ -224,6 +256,8 @@ void FifoManager::ReadDataFromFifo(Core::System& system, u32 readPtr)
       return;
     }
     memmove(m_video_buffer, m_video_buffer_read_ptr, existing_len);
+    if (m_use_predecode_thread)
+      m_video_buffer_pp_read_ptr -= m_video_buffer_read_ptr - m_video_buffer;
     m_video_buffer_write_ptr = m_video_buffer + existing_len;
     m_video_buffer_read_ptr = m_video_buffer;
   }
@@ -233,12 +267,14 @@ void FifoManager::ReadDataFromFifo(Core::System& system, u32 readPtr)
   m_video_buffer_write_ptr += GPFifo::GATHER_PIPE_SIZE;
 }
 
-// The deterministic_gpu_thread version.
-void FifoManager::ReadDataFromFifoOnCPU(Core::System& system, u32 readPtr)
+// The deterministic_gpu_thread version.  The data is only copied to pending_ptr; it isn't visible
+// to the GPU thread until PreprocessFifoData is called.
+void FifoManager::ReadDataFromFifoOnCPU(Core::System& system, u32 readPtr, u8*& pending_ptr)
 {
-  u8* write_ptr = m_video_buffer_write_ptr;
-  if (GPFifo::GATHER_PIPE_SIZE > static_cast<size_t>(m_video_buffer + FIFO_SIZE - write_ptr))
+  if (GPFifo::GATHER_PIPE_SIZE > static_cast<size_t>(m_video_buffer + FIFO_SIZE - pending_ptr))
   {
+    PreprocessFifoData(pending_ptr);
+
     // We can't wrap around while the GPU is working on the data.
     // This should be very rare due to the reset in SyncGPU.
     SyncGPU(SyncGPUReason::Wraparound);
@@ -253,8 +289,8 @@ void FifoManager::ReadDataFromFifoOnCPU(Core::System& system, u32 readPtr)
       PanicAlertFmt("Desynced read pointers");
       return;
     }
-    write_ptr = m_video_buffer_write_ptr;
-    const size_t existing_len = write_ptr - m_video_buffer_pp_read_ptr;
+    pending_ptr = m_video_buffer_write_ptr;
+    const size_t existing_len = pending_ptr - m_video_buffer_pp_read_ptr;
     if (GPFifo::GATHER_PIPE_SIZE > static_cast<size_t>(FIFO_SIZE - existing_len))
     {
       PanicAlertFmt("FIFO out of bounds (existing {} + new {} > {})", existing_len,
@@ -263,11 +299,20 @@ void FifoManager::ReadDataFromFifoOnCPU(Core::System& system, u32 readPtr)
     }
   }
   auto& memory = system.GetMemory();
-  memory.CopyFromEmu(m_video_buffer_write_ptr, readPtr, GPFifo::GATHER_PIPE_SIZE);
-  m_video_buffer_pp_read_ptr = OpcodeDecoder::RunFifo<true>(
-      DataReader(m_video_buffer_pp_read_ptr, write_ptr + GPFifo::GATHER_PIPE_SIZE), nullptr);
+  memory.CopyFromEmu(pending_ptr, readPtr, GPFifo::GATHER_PIPE_SIZE);
+  pending_ptr += GPFifo::GATHER_PIPE_SIZE;
+}
+
+void FifoManager::PreprocessFifoData(u8* end)
+{
+  if (end == m_video_buffer_write_ptr)
+    return;
+
+  m_video_buffer_pp_read_ptr =
+      OpcodeDecoder::RunFifo<true>(DataReader(m_video_buffer_pp_read_ptr, end), nullptr);
   // This would have to be locked if the GPU thread didn't spin.
-  m_video_buffer_write_ptr = write_ptr + GPFifo::GATHER_PIPE_SIZE;
+  m_video_buffer_write_ptr = end;
+  m_gpu_mainloop.Wakeup();
 }
 
 void FifoManager::ResetVideoBuffer()
@@ -287,6 +332,11 @@ void FifoManager::RunGpuLoop(Core::System& system)
   AsyncRequests::GetInstance()->SetEnable(true);
   AsyncRequests::GetInstance()->SetPassthrough(false);
 
+  // The pre-decode thread only works on data handed to it by this loop, so it lives as long as it.
+  m_use_predecode_thread = Config::Get(Config::MAIN_GPU_PREDECODE_THREAD);
+  if (m_use_predecode_thread)
+    m_predecode_thread = std::thread(&FifoManager::PredecodeThreadLoop, this);
+
   m_gpu_mainloop.Run(
       [this, &system] {
         // Run events from the CPU thread.
@@ -296,6 +346,9 @@ void FifoManager::RunGpuLoop(Core::System& system)
         if (!m_emu_running_state.IsSet())
           return;
 
+        TRACE_ZONE("RunGpuLoop");
+        FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::GPU);
+
         if (m_use_deterministic_gpu_thread)
         {
           // All the fifo/CP stuff is on the CPU.  We just need to run the opcode decoder.
@@ -315,61 +368,61 @@ void FifoManager::RunGpuLoop(Core::System& system)
           auto& fifo = command_processor.GetFifo();
           command_processor.SetCPStatusFromGPU(system);
 
-          // check if we are able to run this buffer
-          while (!command_processor.IsInterruptWaiting() &&
-                 fifo.bFF_GPReadEnable.load(std::memory_order_relaxed) &&
-                 fifo.CPReadWriteDistance.load(std::memory_order_relaxed) && !AtBreakpoint(system))
+          if (m_use_predecode_thread)
           {
-            if (m_config_sync_gpu && m_sync_ticks.load() < m_config_sync_gpu_min_distance)
-              break;
-
-            u32 cyclesExecuted = 0;
-            u32 readPtr = fifo.CPReadPointer.load(std::memory_order_relaxed);
-            ReadDataFromFifo(system, readPtr);
-
-            if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
-              readPtr = fifo.CPBase.load(std::memory_order_relaxed);
-            else
-              readPtr += GPFifo::GATHER_PIPE_SIZE;
-
-            const s32 distance =
-                static_cast<s32>(fifo.CPReadWriteDistance.load(std::memory_order_relaxed)) -
-                GPFifo::GATHER_PIPE_SIZE;
-            ASSERT_MSG(COMMANDPROCESSOR, distance >= 0,
-                       "Negative fifo.CPReadWriteDistance = {} in FIFO Loop !\nThat can produce "
-                       "instability in the game. Please report it.",
-                       distance);
-
-            u8* write_ptr = m_video_buffer_write_ptr;
-            m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
-                DataReader(m_video_buffer_read_ptr, write_ptr), &cyclesExecuted);
-
-            fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
-            fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
-            if ((write_ptr - m_video_buffer_read_ptr) == 0)
-            {
-              fifo.SafeCPReadPointer.store(fifo.CPReadPointer.load(std::memory_order_relaxed),
-                                           std::memory_order_relaxed);
-            }
-
-            command_processor.SetCPStatusFromGPU(system);
-
-            if (m_config_sync_gpu)
+            RunPredecodedFifo(system);
+          }
+          else
+          {
+            // check if we are able to run this buffer
+            while (!command_processor.IsInterruptWaiting() &&
+                   fifo.bFF_GPReadEnable.load(std::memory_order_relaxed) &&
+                   fifo.CPReadWriteDistance.load(std::memory_order_relaxed) &&
+                   !AtBreakpoint(system))
             {
-              cyclesExecuted = (int)(cyclesExecuted / m_config_sync_gpu_overclock);
-              int old = m_sync_ticks.fetch_sub(cyclesExecuted);
-              if (old >= m_config_sync_gpu_max_distance &&
-                  old - (int)cyclesExecuted < m_config_sync_gpu_max_distance)
+              if (m_config_sync_gpu && m_sync_ticks.load() < m_config_sync_gpu_min_distance)
+                break;
+
+              u32 cyclesExecuted = 0;
+              u32 readPtr = fifo.CPReadPointer.load(std::memory_order_relaxed);
+              ReadDataFromFifo(system, readPtr);
+
+              if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
+                readPtr = fifo.CPBase.load(std::memory_order_relaxed);
+              else
+                readPtr += GPFifo::GATHER_PIPE_SIZE;
+
+              const s32 distance =
+                  static_cast<s32>(fifo.CPReadWriteDistance.load(std::memory_order_relaxed)) -
+                  GPFifo::GATHER_PIPE_SIZE;
+              ASSERT_MSG(COMMANDPROCESSOR, distance >= 0,
+                         "Negative fifo.CPReadWriteDistance = {} in FIFO Loop !\nThat can produce "
+                         "instability in the game. Please report it.",
+                         distance);
+
+              u8* write_ptr = m_video_buffer_write_ptr;
+              m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
+                  DataReader(m_video_buffer_read_ptr, write_ptr), &cyclesExecuted);
+
+              fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
+              fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE,
+                                                 std::memory_order_seq_cst);
+              if ((write_ptr - m_video_buffer_read_ptr) == 0)
               {
-                m_sync_wakeup_event.Set();
+                fifo.SafeCPReadPointer.store(fifo.CPReadPointer.load(std::memory_order_relaxed),
+                                             std::memory_order_relaxed);
               }
-            }
 
-            // This call is pretty important in DualCore mode and must be called in the FIFO Loop.
-            // If we don't, s_swapRequested or s_efbAccessRequested won't be set to false
-            // leading the CPU thread to wait in Video_OutputXFB or Video_AccessEFB thus slowing
-            // things down.
-            AsyncRequests::GetInstance()->PullEvents();
+              command_processor.SetCPStatusFromGPU(system);
+
+              UpdateSyncTicks(cyclesExecuted);
+
+              // This call is pretty important in DualCore mode and must be called in the FIFO Loop.
+              // If we don't, s_swapRequested or s_efbAccessRequested won't be set to false
+              // leading the CPU thread to wait in Video_OutputXFB or Video_AccessEFB thus slowing
+              // things down.
+              AsyncRequests::GetInstance()->PullEvents();
+            }
           }
 
           // fast skip remaining GPU time if fifo is empty
@@ -388,10 +441,127 @@ void FifoManager::RunGpuLoop(Core::System& system)
       },
       100);
 
+  if (m_use_predecode_thread)
+  {
+    m_predecode_exit.Set();
+    m_predecode_start_event.Set();
+    m_predecode_thread.join();
+    m_predecode_exit.Clear();
+    m_use_predecode_thread = false;
+  }
+
   AsyncRequests::GetInstance()->SetEnable(false);
   AsyncRequests::GetInstance()->SetPassthrough(true);
 }
 
+void FifoManager::UpdateSyncTicks(u32 cycles_executed)
+{
+  if (!m_config_sync_gpu)
+    return;
+
+  cycles_executed = (int)(cycles_executed / m_config_sync_gpu_overclock);
+  int old = m_sync_ticks.fetch_sub(cycles_executed);
+  if (old >= m_config_sync_gpu_max_distance &&
+      old - (int)cycles_executed < m_config_sync_gpu_max_distance)
+  {
+    m_sync_wakeup_event.Set();
+  }
+}
+
+// The GPU thread loop with the FIFO pre-decode thread.  Each batch is copied from the FIFO while
+// neither thread works on the buffers, then pre-decoded while the previous batch is run.
+void FifoManager::RunPredecodedFifo(Core::System& system)
+{
+  auto& command_processor = system.GetCommandProcessor();
+  auto& fifo = command_processor.GetFifo();
+
+  // Everything before the read_ptr has been run, so the preprocessing state starts out as the main
+  // one.  This also covers loading a state and leaving deterministic GPU thread mode.
+  m_video_buffer_pp_read_ptr = m_video_buffer_read_ptr;
+  m_fifo_aux_write_ptr = m_fifo_aux_data;
+  m_fifo_aux_read_ptr = m_fifo_aux_data;
+  CopyPreprocessCPStateFromMain();
+  VertexLoaderManager::g_preprocess_vat_dirty = BitSet8::AllTrue(CP_NUM_VAT_REG);
+
+  while (true)
+  {
+    CompactFifoAuxBuffer();
+
+    // check if we are able to copy more of the FIFO
+    size_t copied = 0;
+    while (copied < PREPROCESS_BATCH_SIZE && !command_processor.IsInterruptWaiting() &&
+           fifo.bFF_GPReadEnable.load(std::memory_order_relaxed) &&
+           fifo.CPReadWriteDistance.load(std::memory_order_relaxed) && !AtBreakpoint(system))
+    {
+      if (m_config_sync_gpu && m_sync_ticks.load() < m_config_sync_gpu_min_distance)
+        break;
+
+      u32 readPtr = fifo.CPReadPointer.load(std::memory_order_relaxed);
+      ReadDataFromFifo(system, readPtr);
+
+      if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
+        readPtr = fifo.CPBase.load(std::memory_order_relaxed);
+      else
+        readPtr += GPFifo::GATHER_PIPE_SIZE;
+
+      fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
+      fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
+      copied += GPFifo::GATHER_PIPE_SIZE;
+    }
+
+    // The commands before the pp_read_ptr were pre-decoded along with the previous batch.
+    u8* const run_end = m_video_buffer_pp_read_ptr;
+    if (copied == 0 && run_end == m_video_buffer_read_ptr)
+      break;
+
+    m_predecode_gpu_running.Set();
+    if (copied != 0)
+    {
+      m_predecode_end = m_video_buffer_write_ptr;
+      m_predecode_start_event.Set();
+    }
+
+    u32 cycles_executed = 0;
+    m_video_buffer_read_ptr =
+        OpcodeDecoder::RunFifo(DataReader(m_video_buffer_read_ptr, run_end), &cycles_executed);
+
+    m_predecode_gpu_running.Clear();
+    m_predecode_gpu_done_event.Set();
+    if (copied != 0)
+      m_predecode_done_event.Wait();
+
+    if (m_video_buffer_read_ptr == m_video_buffer_write_ptr)
+    {
+      fifo.SafeCPReadPointer.store(fifo.CPReadPointer.load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+    }
+
+    command_processor.SetCPStatusFromGPU(system);
+
+    UpdateSyncTicks(cycles_executed);
+
+    // See the comment in RunGpuLoop.
+    AsyncRequests::GetInstance()->PullEvents();
+  }
+}
+
+void FifoManager::PredecodeThreadLoop()
+{
+  Common::SetCurrentThreadName("FIFO pre-decode thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
+
+  while (true)
+  {
+    m_predecode_start_event.Wait();
+    if (m_predecode_exit.IsSet())
+      return;
+
+    m_video_buffer_pp_read_ptr = OpcodeDecoder::RunFifo<true>(
+        DataReader(m_video_buffer_pp_read_ptr, m_predecode_end), nullptr);
+    m_predecode_done_event.Set();
+  }
+}
+
 void FifoManager::FlushGpu(Core::System& system)
 {
   if (!system.IsDualCoreMode() || m_use_deterministic_gpu_thread)
@@ -405,6 +575,15 @@ void FifoManager::GpuMaySleep()
   m_gpu_mainloop.AllowSleep();
 }
 
+WakeupStatistics FifoManager::GetWakeupStatistics() const
+{
+  WakeupStatistics stats;
+  stats.gpu_thread = m_gpu_mainloop.GetWakeupStatistics();
+  stats.sync_waits = m_sync_waits.load(std::memory_order_relaxed);
+  stats.sync_wait_ns = m_sync_wait_ns.load(std::memory_order_relaxed);
+  return stats;
+}
+
 bool AtBreakpoint(Core::System& system)
 {
   auto& command_processor = system.GetCommandProcessor();
@@ -438,18 +617,23 @@ void FifoManager::RunGpu(Core::System& system)
 
 int FifoManager::RunGpuOnCpu(Core::System& system, int ticks)
 {
+  FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::GPU);
+
   auto& command_processor = system.GetCommandProcessor();
   auto& fifo = command_processor.GetFifo();
   bool reset_simd_state = false;
   int available_ticks = int(ticks * m_config_sync_gpu_overclock) + m_sync_ticks.load();
+  u8* pending_ptr = m_video_buffer_write_ptr;
   while (fifo.bFF_GPReadEnable.load(std::memory_order_relaxed) &&
          fifo.CPReadWriteDistance.load(std::memory_order_relaxed) && !AtBreakpoint(system) &&
          available_ticks >= 0)
   {
     if (m_use_deterministic_gpu_thread)
     {
-      ReadDataFromFifoOnCPU(system, fifo.CPReadPointer.load(std::memory_order_relaxed));
-      m_gpu_mainloop.Wakeup();
+      ReadDataFromFifoOnCPU(system, fifo.CPReadPointer.load(std::memory_order_relaxed),
+                            pending_ptr);
+      if (static_cast<size_t>(pending_ptr - m_video_buffer_write_ptr) >= PREPROCESS_BATCH_SIZE)
+        PreprocessFifoData(pending_ptr);
     }
     else
     {
@@ -480,6 +664,9 @@ int FifoManager::RunGpuOnCpu(Core::System& system, int ticks)
     fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_relaxed);
   }
 
+  if (m_use_deterministic_gpu_thread)
+    PreprocessFifoData(pending_ptr);
+
   command_processor.SetCPStatusFromGPU(system);
 
   if (reset_simd_state)
@@ -555,7 +742,16 @@ int FifoManager::WaitForGpuThread(Core::System& system, int ticks)
 
   // Wait for GPU
   if (now >= m_config_sync_gpu_max_distance)
+  {
+    FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::GPUWait);
+    const auto wait_start = std::chrono::steady_clock::now();
     m_sync_wakeup_event.Wait();
+    const auto wait_time = std::chrono::steady_clock::now() - wait_start;
+    m_sync_waits.fetch_add(1, std::memory_order_relaxed);
+    m_sync_wait_ns.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(wait_time).count(),
+        std::memory_order_relaxed);
+  }
 
   return GPU_TIME_SLOT_SIZE;
 }
@@ -6,6 +6,7 @@
 #include <atomic>
 #include <cstddef>
 #include <optional>
+#include <thread>
 
 #include "Common/BlockingLoop.h"
 #include "Common/CommonTypes.h"
@@ -37,6 +38,14 @@ enum class SyncGPUReason
   AuxSpace,
 };
 
+struct WakeupStatistics
+{
+  Common::BlockingLoop::WakeupStatistics gpu_thread;
+  // Times the CPU thread blocked in SyncGPU mode waiting for the GPU thread to catch up.
+  u64 sync_waits = 0;
+  u64 sync_wait_ns = 0;
+};
+
 class FifoManager final
 {
 public:
@@ -54,6 +63,11 @@ public:
   void PauseAndLock(Core::System& system, bool doLock, bool unpauseOnUnlock);
   void UpdateWantDeterminism(Core::System& system, bool want);
   bool UseDeterministicGPUThread() const { return m_use_deterministic_gpu_thread; }
+  // Whether display lists and indexed XF data are read from the aux FIFO rather than from memory.
+  bool UseFifoAuxBuffer() const
+  {
+    return m_use_deterministic_gpu_thread || m_use_predecode_thread;
+  }
 
   // In deterministic GPU thread mode this waits for the GPU to be done with pending work.
   void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr = true);
@@ -73,10 +87,17 @@ public:
   void EmulatorState(bool running);
   void ResetVideoBuffer();
 
+  WakeupStatistics GetWakeupStatistics() const;
+
 private:
   void RefreshConfig();
   void ReadDataFromFifo(Core::System& system, u32 readPtr);
-  void ReadDataFromFifoOnCPU(Core::System& system, u32 readPtr);
+  void ReadDataFromFifoOnCPU(Core::System& system, u32 readPtr, u8*& pending_ptr);
+  void PreprocessFifoData(u8* end);
+  void CompactFifoAuxBuffer();
+  void UpdateSyncTicks(u32 cycles_executed);
+  void RunPredecodedFifo(Core::System& system);
+  void PredecodeThreadLoop();
   int RunGpuOnCpu(Core::System& system, int ticks);
   int WaitForGpuThread(Core::System& system, int ticks);
   static void SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLate);
@@ -96,6 +117,20 @@ private:
   // and can change at runtime.
   bool m_use_deterministic_gpu_thread = false;
 
+  // With the FIFO pre-decode thread, the GPU thread copies data from the FIFO in batches.  While it
+  // runs one batch, the pre-decode thread finds the command boundaries in the next one and copies
+  // the display lists and indexed XF data it uses to the aux FIFO, like the CPU thread does in
+  // deterministic GPU thread mode.  It isn't used in that mode.
+  bool m_use_predecode_thread = false;
+  std::thread m_predecode_thread;
+  Common::Event m_predecode_start_event;
+  Common::Event m_predecode_done_event;
+  Common::Flag m_predecode_exit;
+  u8* m_predecode_end = nullptr;
+  // Set while the GPU thread runs commands which may read from the aux FIFO.
+  Common::Flag m_predecode_gpu_running;
+  Common::Event m_predecode_gpu_done_event;
+
   CoreTiming::EventType* m_event_sync_gpu = nullptr;
 
   // STATE_TO_SAVE
@@ -115,10 +150,18 @@ private:
   // FIFO.  Maybe someday it will be under the lock.  For now, because RunGpuLoop
   // polls, it's just atomic.
   // - The pp_read_ptr is the CPU preprocessing version of the read_ptr.
+  // - Within RunGpuOnCpu, the CPU thread may have copied more data than it has
+  // preprocessed and published through write_ptr yet.  That data is batched so
+  // the preprocessor and the GPU thread see it in larger pieces.
+  // With the FIFO pre-decode thread, the GPU thread owns both pointers again.  It
+  // hands the data between the pp_read_ptr and the write_ptr to the pre-decode
+  // thread, and only runs commands up to where the pp_read_ptr was before that.
 
   std::atomic<int> m_sync_ticks = 0;
   bool m_syncing_suspended = false;
   Common::Event m_sync_wakeup_event;
+  std::atomic<u64> m_sync_waits = 0;
+  std::atomic<u64> m_sync_wait_ns = 0;
 
   std::optional<size_t> m_config_callback_id = std::nullopt;
   bool m_config_sync_gpu = false;
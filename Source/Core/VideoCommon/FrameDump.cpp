@@ -18,6 +18,7 @@ extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
 #include <libavutil/error.h>
+#include <libavutil/hwcontext.h>
 #include <libavutil/log.h>
 #include <libavutil/mathematics.h>
 #include <libavutil/opt.h>
@@ -49,6 +50,13 @@ struct FrameDumpContext
   AVFrame* scaled_frame = nullptr;
   SwsContext* sws = nullptr;
 
+  // Format frames are converted to on the CPU. Differs from the codec's format when the encoder
+  // takes frames in GPU memory, which are uploaded from scaled_frame into hw_frame.
+  AVPixelFormat sw_pix_fmt = AV_PIX_FMT_NONE;
+  AVBufferRef* hw_device = nullptr;
+  AVBufferRef* hw_frames = nullptr;
+  AVFrame* hw_frame = nullptr;
+
   s64 last_pts = AV_NOPTS_VALUE;
 
   int width = 0;
@@ -155,6 +163,152 @@ std::string AVErrorString(int error)
   return fmt::format("{:8x} {}", (u32)error, &msg[0]);
 }
 
+// FFmpeg names its hardware encoders <codec>_<backend>, e.g. h264_nvenc or hevc_vaapi.
+const AVCodec* FindHardwareEncoder(AVCodecID codec_id, const std::string& backend)
+{
+  const std::string name = fmt::format("{}_{}", avcodec_get_name(codec_id), backend);
+  const AVCodec* codec = avcodec_find_encoder_by_name(name.c_str());
+  if (!codec)
+    WARN_LOG_FMT(FRAMEDUMP, "Hardware encoder {} is not available, using software encoding", name);
+  return codec;
+}
+
+// Encoders such as VAAPI only accept frames which are already in GPU memory.
+bool RequiresHardwareFrames(const AVCodec* codec)
+{
+  if (!codec->pix_fmts)
+    return false;
+
+  for (const AVPixelFormat* fmt = codec->pix_fmts; *fmt != AV_PIX_FMT_NONE; fmt++)
+  {
+    const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(*fmt);
+    if (desc && !(desc->flags & AV_PIX_FMT_FLAG_HWACCEL))
+      return false;
+  }
+  return true;
+}
+
+bool CreateHardwareFrames(FrameDumpContext& context, const AVCodec* codec)
+{
+  const AVCodecHWConfig* hw_config = nullptr;
+  for (int i = 0; (hw_config = avcodec_get_hw_config(codec, i)) != nullptr; i++)
+  {
+    if (hw_config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_FRAMES_CTX)
+      break;
+  }
+  if (!hw_config)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Encoder {} has no usable hardware configuration", codec->name);
+    return false;
+  }
+
+  if (const int error = av_hwdevice_ctx_create(&context.hw_device, hw_config->device_type, nullptr,
+                                               nullptr, 0))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not create {} device: {}",
+                  av_hwdevice_get_type_name(hw_config->device_type), AVErrorString(error));
+    return false;
+  }
+
+  context.hw_frames = av_hwframe_ctx_alloc(context.hw_device);
+  if (!context.hw_frames)
+    return false;
+
+  auto* const frames = reinterpret_cast<AVHWFramesContext*>(context.hw_frames->data);
+  frames->format = hw_config->pix_fmt;
+  frames->sw_format = context.sw_pix_fmt;
+  frames->width = context.width;
+  frames->height = context.height;
+  if (const int error = av_hwframe_ctx_init(context.hw_frames))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not create hardware frame pool: {}", AVErrorString(error));
+    return false;
+  }
+
+  context.codec->hw_frames_ctx = av_buffer_ref(context.hw_frames);
+  context.codec->pix_fmt = hw_config->pix_fmt;
+  context.hw_frame = av_frame_alloc();
+  return context.codec->hw_frames_ctx && context.hw_frame;
+}
+
+void DestroyEncoder(FrameDumpContext& context)
+{
+  av_frame_free(&context.hw_frame);
+  avcodec_free_context(&context.codec);
+  av_buffer_unref(&context.hw_frames);
+  av_buffer_unref(&context.hw_device);
+}
+
+bool OpenEncoder(FrameDumpContext& context, const AVCodec* codec,
+                 const AVOutputFormat* output_format, bool hardware)
+{
+  context.codec = avcodec_alloc_context3(codec);
+  if (!codec || !context.codec)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not find encoder or allocate codec context");
+    return false;
+  }
+
+  // Force XVID FourCC for better compatibility when using H.263
+  if (codec->id == AV_CODEC_ID_MPEG4)
+    context.codec->codec_tag = MKTAG('X', 'V', 'I', 'D');
+
+  const auto time_base = GetTimeBaseForCurrentRefreshRate();
+
+  INFO_LOG_FMT(FRAMEDUMP, "Creating video file: {} x {} @ {}/{} fps", context.width,
+               context.height, time_base.den, time_base.num);
+
+  context.codec->codec_type = AVMEDIA_TYPE_VIDEO;
+  context.codec->bit_rate = static_cast<int64_t>(g_Config.iBitrateKbps) * 1000;
+  context.codec->width = context.width;
+  context.codec->height = context.height;
+  context.codec->time_base = time_base;
+  context.codec->gop_size = 1;
+  context.codec->level = 1;
+
+  AVPixelFormat pix_fmt = AV_PIX_FMT_NONE;
+
+  const std::string& pixel_format_string = g_Config.sDumpPixelFormat;
+  if (!pixel_format_string.empty())
+  {
+    pix_fmt = av_get_pix_fmt(pixel_format_string.c_str());
+    if (pix_fmt == AV_PIX_FMT_NONE)
+      WARN_LOG_FMT(FRAMEDUMP, "Invalid pixel format {}", pixel_format_string);
+  }
+
+  if (pix_fmt == AV_PIX_FMT_NONE)
+  {
+    if (context.codec->codec_id == AV_CODEC_ID_FFV1)
+      pix_fmt = AV_PIX_FMT_BGR0;
+    else if (context.codec->codec_id == AV_CODEC_ID_UTVIDEO)
+      pix_fmt = AV_PIX_FMT_GBRP;
+    else if (hardware)
+      pix_fmt = AV_PIX_FMT_NV12;  // The one format every hardware encoder accepts.
+    else
+      pix_fmt = AV_PIX_FMT_YUV420P;
+  }
+
+  context.codec->pix_fmt = pix_fmt;
+  context.sw_pix_fmt = pix_fmt;
+
+  if (RequiresHardwareFrames(codec) && !CreateHardwareFrames(context, codec))
+    return false;
+
+  if (context.codec->codec_id == AV_CODEC_ID_UTVIDEO)
+    av_opt_set_int(context.codec->priv_data, "pred", 3, 0);  // median
+
+  if (output_format->flags & AVFMT_GLOBALHEADER)
+    context.codec->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+
+  if (avcodec_open2(context.codec, codec, nullptr) < 0)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not open codec");
+    return false;
+  }
+
+  return true;
+}
+
 }  // namespace
 
 bool FrameDump::Start(int w, int h, u64 start_ticks)
@@ -235,71 +389,34 @@ bool FrameDump::CreateVideoFile()
     if (!codec)
       WARN_LOG_FMT(FRAMEDUMP, "Invalid encoder {}", g_Config.sDumpEncoder);
   }
-  if (!codec)
-    codec = avcodec_find_encoder(codec_id);
-
-  m_context->codec = avcodec_alloc_context3(codec);
-  if (!codec || !m_context->codec)
-  {
-    ERROR_LOG_FMT(FRAMEDUMP, "Could not find encoder or allocate codec context");
-    return false;
-  }
-
-  // Force XVID FourCC for better compatibility when using H.263
-  if (codec->id == AV_CODEC_ID_MPEG4)
-    m_context->codec->codec_tag = MKTAG('X', 'V', 'I', 'D');
-
-  const auto time_base = GetTimeBaseForCurrentRefreshRate();
 
-  INFO_LOG_FMT(FRAMEDUMP, "Creating video file: {} x {} @ {}/{} fps", m_context->width,
-               m_context->height, time_base.den, time_base.num);
-
-  m_context->codec->codec_type = AVMEDIA_TYPE_VIDEO;
-  m_context->codec->bit_rate = static_cast<int64_t>(g_Config.iBitrateKbps) * 1000;
-  m_context->codec->width = m_context->width;
-  m_context->codec->height = m_context->height;
-  m_context->codec->time_base = time_base;
-  m_context->codec->gop_size = 1;
-  m_context->codec->level = 1;
-
-  AVPixelFormat pix_fmt = AV_PIX_FMT_NONE;
-
-  const std::string& pixel_format_string = g_Config.sDumpPixelFormat;
-  if (!pixel_format_string.empty())
+  bool hardware = false;
+  if (!codec && !g_Config.bUseFFV1 && !g_Config.sDumpHardwareEncoder.empty())
   {
-    pix_fmt = av_get_pix_fmt(pixel_format_string.c_str());
-    if (pix_fmt == AV_PIX_FMT_NONE)
-      WARN_LOG_FMT(FRAMEDUMP, "Invalid pixel format {}", pixel_format_string);
+    codec = FindHardwareEncoder(codec_id, g_Config.sDumpHardwareEncoder);
+    hardware = codec != nullptr;
   }
+  if (!codec)
+    codec = avcodec_find_encoder(codec_id);
 
-  if (pix_fmt == AV_PIX_FMT_NONE)
+  if (!OpenEncoder(*m_context, codec, output_format, hardware))
   {
-    if (m_context->codec->codec_id == AV_CODEC_ID_FFV1)
-      pix_fmt = AV_PIX_FMT_BGR0;
-    else if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
-      pix_fmt = AV_PIX_FMT_GBRP;
-    else
-      pix_fmt = AV_PIX_FMT_YUV420P;
-  }
-
-  m_context->codec->pix_fmt = pix_fmt;
-
-  if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
-    av_opt_set_int(m_context->codec->priv_data, "pred", 3, 0);  // median
-
-  if (output_format->flags & AVFMT_GLOBALHEADER)
-    m_context->codec->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+    if (!hardware)
+      return false;
 
-  if (avcodec_open2(m_context->codec, codec, nullptr) < 0)
-  {
-    ERROR_LOG_FMT(FRAMEDUMP, "Could not open codec");
-    return false;
+    // The encoder exists in this FFmpeg build, but there may be no device which supports it.
+    WARN_LOG_FMT(FRAMEDUMP, "Could not open hardware encoder {}, using software encoding",
+                 codec->name);
+    DestroyEncoder(*m_context);
+    codec = avcodec_find_encoder(codec_id);
+    if (!OpenEncoder(*m_context, codec, output_format, false))
+      return false;
   }
 
   m_context->src_frame = av_frame_alloc();
   m_context->scaled_frame = av_frame_alloc();
 
-  m_context->scaled_frame->format = m_context->codec->pix_fmt;
+  m_context->scaled_frame->format = m_context->sw_pix_fmt;
   m_context->scaled_frame->width = m_context->width;
   m_context->scaled_frame->height = m_context->height;
 
@@ -324,7 +441,7 @@ bool FrameDump::CreateVideoFile()
     return false;
   }
 
-  if (av_cmp_q(m_context->stream->time_base, time_base) != 0)
+  if (av_cmp_q(m_context->stream->time_base, m_context->codec->time_base) != 0)
   {
     WARN_LOG_FMT(FRAMEDUMP, "Stream time base differs at {}/{}", m_context->stream->time_base.den,
                  m_context->stream->time_base.num);
@@ -383,17 +500,33 @@ void FrameDump::AddFrame(const FrameData& frame)
   // Convert image from RGBA to desired pixel format.
   m_context->sws = sws_getCachedContext(
       m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
+      m_context->sw_pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
   if (m_context->sws)
   {
     sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
               frame.height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
   }
 
+  AVFrame* encode_frame = m_context->scaled_frame;
+  if (m_context->hw_frames)
+  {
+    // Upload to a frame from the device's pool.
+    av_frame_unref(m_context->hw_frame);
+    int error = av_hwframe_get_buffer(m_context->hw_frames, m_context->hw_frame, 0);
+    if (!error)
+      error = av_hwframe_transfer_data(m_context->hw_frame, encode_frame, 0);
+    if (error)
+    {
+      ERROR_LOG_FMT(FRAMEDUMP, "Error uploading frame: {}", AVErrorString(error));
+      return;
+    }
+    encode_frame = m_context->hw_frame;
+  }
+
   m_context->last_pts = pts;
-  m_context->scaled_frame->pts = pts;
+  encode_frame->pts = pts;
 
-  if (const int error = avcodec_send_frame(m_context->codec, m_context->scaled_frame))
+  if (const int error = avcodec_send_frame(m_context->codec, encode_frame))
   {
     ERROR_LOG_FMT(FRAMEDUMP, "Error while encoding video: {}", AVErrorString(error));
     return;
@@ -467,7 +600,7 @@ void FrameDump::CloseVideoFile()
   av_frame_free(&m_context->src_frame);
   av_frame_free(&m_context->scaled_frame);
 
-  avcodec_free_context(&m_context->codec);
+  DestroyEncoder(*m_context);
 
   if (m_context->format)
     avio_closep(&m_context->format->pb);
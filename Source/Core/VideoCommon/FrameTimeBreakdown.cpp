@@ -0,0 +1,123 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/FrameTimeBreakdown.h"
+
+#include <atomic>
+#include <chrono>
+
+namespace FrameTimeBreakdown
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Deep enough for the CPU thread running the GPU in single core and compiling a shader there.
+constexpr u32 MAX_DEPTH = 8;
+
+struct ThreadState
+{
+  std::array<Phase, MAX_DEPTH> stack;
+  u32 depth = 0;
+  Clock::time_point last_change;
+};
+
+thread_local ThreadState s_thread_state;
+
+std::array<std::atomic<u64>, NUM_PHASES> s_frame_ns{};
+std::array<std::atomic<u64>, NUM_PHASES> s_total_ns{};
+
+// Only accessed on the thread that presents frames.
+std::array<PhaseTimes, HISTORY_SIZE> s_history{};
+size_t s_history_index = 0;
+size_t s_history_size = 0;
+
+void CreditInnermostPhase(ThreadState& state, Clock::time_point now)
+{
+  if (state.depth != 0)
+  {
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - state.last_change);
+    s_frame_ns[static_cast<size_t>(state.stack[state.depth - 1])].fetch_add(
+        static_cast<u64>(elapsed.count()), std::memory_order_relaxed);
+  }
+  state.last_change = now;
+}
+}  // namespace
+
+const char* GetPhaseName(Phase phase)
+{
+  static constexpr std::array<const char*, NUM_PHASES> names = {
+      "CPU", "GPU", "Submit", "Shaders", "GPU wait", "Throttle"};
+  return names[static_cast<size_t>(phase)];
+}
+
+const char* GetPhaseLabel(Phase phase)
+{
+  static constexpr std::array<const char*, NUM_PHASES> labels = {
+      "cpu", "gpu", "submit", "shader_compile", "gpu_wait", "throttle"};
+  return labels[static_cast<size_t>(phase)];
+}
+
+ScopedPhase::ScopedPhase(Phase phase)
+{
+  ThreadState& state = s_thread_state;
+  m_pushed = state.depth < MAX_DEPTH;
+  if (!m_pushed)
+    return;
+
+  CreditInnermostPhase(state, Clock::now());
+  state.stack[state.depth++] = phase;
+}
+
+ScopedPhase::~ScopedPhase()
+{
+  if (!m_pushed)
+    return;
+
+  ThreadState& state = s_thread_state;
+  CreditInnermostPhase(state, Clock::now());
+  --state.depth;
+}
+
+void Reset()
+{
+  for (size_t i = 0; i < NUM_PHASES; ++i)
+  {
+    s_frame_ns[i].store(0, std::memory_order_relaxed);
+    s_total_ns[i].store(0, std::memory_order_relaxed);
+  }
+  s_history_index = 0;
+  s_history_size = 0;
+}
+
+void EndFrame()
+{
+  PhaseTimes& frame = s_history[s_history_index];
+  for (size_t i = 0; i < NUM_PHASES; ++i)
+  {
+    frame[i] = s_frame_ns[i].exchange(0, std::memory_order_relaxed);
+    s_total_ns[i].fetch_add(frame[i], std::memory_order_relaxed);
+  }
+
+  s_history_index = (s_history_index + 1) % HISTORY_SIZE;
+  if (s_history_size < HISTORY_SIZE)
+    ++s_history_size;
+}
+
+size_t GetHistory(std::array<PhaseTimes, HISTORY_SIZE>* history)
+{
+  const size_t oldest = (s_history_index + HISTORY_SIZE - s_history_size) % HISTORY_SIZE;
+  for (size_t i = 0; i < s_history_size; ++i)
+    (*history)[i] = s_history[(oldest + i) % HISTORY_SIZE];
+  return s_history_size;
+}
+
+PhaseTimes GetTotals()
+{
+  PhaseTimes totals;
+  for (size_t i = 0; i < NUM_PHASES; ++i)
+    totals[i] = s_total_ns[i].load(std::memory_order_relaxed);
+  return totals;
+}
+}  // namespace FrameTimeBreakdown
@@ -0,0 +1,69 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// Attributes the time of the emulation threads to what they were doing, so that a slow frame can
+// be blamed on the CPU emulation, the GPU thread, the backend, shader compilation or throttling.
+//
+// Each thread keeps a stack of the phases it is in, and the time since the last phase change is
+// credited to the innermost one. Time a thread spends outside of any phase isn't counted at all,
+// so the worker threads of the backends and the shader compiler don't skew the breakdown.
+namespace FrameTimeBreakdown
+{
+enum class Phase : u8
+{
+  // Running emulated CPU code and the hardware events scheduled by it.
+  CPU,
+  // Processing FIFO commands, in the GPU thread or in single core on the CPU thread.
+  GPU,
+  // Submitting draws and presenting frames through the video backend.
+  Submit,
+  // Compiling shaders and pipelines that are needed for the current draw.
+  ShaderCompile,
+  // The CPU thread waiting for the GPU thread to catch up.
+  GPUWait,
+  // Sleeping to keep the emulation at its target speed.
+  Throttle,
+};
+constexpr size_t NUM_PHASES = 6;
+
+// The name shown in the overlay, and the label used in the metrics export.
+const char* GetPhaseName(Phase phase);
+const char* GetPhaseLabel(Phase phase);
+
+// Nanoseconds spent in each phase, indexed by Phase.
+using PhaseTimes = std::array<u64, NUM_PHASES>;
+
+class ScopedPhase final
+{
+public:
+  explicit ScopedPhase(Phase phase);
+  ~ScopedPhase();
+
+  ScopedPhase(const ScopedPhase&) = delete;
+  ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+private:
+  bool m_pushed;
+};
+
+void Reset();
+
+// Moves the time counted since the previous call into the frame history. Called when a frame is
+// presented, on the thread that presents frames.
+void EndFrame();
+
+// The phase times of the last frames, oldest first. Must be called on the thread that presents
+// frames.
+constexpr size_t HISTORY_SIZE = 256;
+size_t GetHistory(std::array<PhaseTimes, HISTORY_SIZE>* history);
+
+// The phase times of all frames since the last Reset. Can be called from any thread.
+PhaseTimes GetTotals();
+}  // namespace FrameTimeBreakdown
@@ -141,18 +141,27 @@ static u32 CalculateEFBLayers()
   return (g_ActiveConfig.stereo_mode != StereoMode::Off) ? 2 : 1;
 }
 
+static u32 CalculateEFBFlags()
+{
+  // With multiview, both eyes are rendered by a single draw without a geometry shader.
+  u32 flags = AbstractTextureFlag_RenderTarget;
+  if (g_ActiveConfig.UseMultiviewForStereo())
+    flags |= AbstractTextureFlag_Multiview;
+  return flags;
+}
+
 TextureConfig FramebufferManager::GetEFBColorTextureConfig()
 {
   return TextureConfig(g_renderer->GetTargetWidth(), g_renderer->GetTargetHeight(), 1,
                        CalculateEFBLayers(), g_ActiveConfig.iMultisamples, GetEFBColorFormat(),
-                       AbstractTextureFlag_RenderTarget);
+                       CalculateEFBFlags());
 }
 
 TextureConfig FramebufferManager::GetEFBDepthTextureConfig()
 {
   return TextureConfig(g_renderer->GetTargetWidth(), g_renderer->GetTargetHeight(), 1,
                        CalculateEFBLayers(), g_ActiveConfig.iMultisamples, GetEFBDepthFormat(),
-                       AbstractTextureFlag_RenderTarget);
+                       CalculateEFBFlags());
 }
 
 FramebufferState FramebufferManager::GetEFBFramebufferState() const
@@ -162,6 +171,7 @@ FramebufferState FramebufferManager::GetEFBFramebufferState() const
   ret.depth_texture_format = m_efb_depth_texture->GetFormat();
   ret.per_sample_shading = IsEFBMultisampled() && g_ActiveConfig.bSSAA;
   ret.samples = m_efb_color_texture->GetSamples();
+  ret.multiview = IsEFBMultiview();
   return ret;
 }
 
@@ -351,7 +361,9 @@ bool FramebufferManager::CompileConversionPipelines()
 
     AbstractPipelineConfig config = {};
     config.vertex_shader = g_shader_cache->GetScreenQuadVertexShader();
-    config.geometry_shader = IsEFBStereo() ? g_shader_cache->GetTexcoordGeometryShader() : nullptr;
+    config.geometry_shader = IsEFBStereo() && !IsEFBMultiview() ?
+                                 g_shader_cache->GetTexcoordGeometryShader() :
+                                 nullptr;
     config.pixel_shader = pixel_shader.get();
     config.rasterization_state = RenderState::GetNoCullRasterizationState(PrimitiveType::Triangles);
     config.depth_state = RenderState::GetNoDepthTestingDepthState();
@@ -415,7 +427,7 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
 
   u32 tile_index;
   if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
-    PopulateEFBCache(false, tile_index);
+    PopulateEFBCacheOnMiss(false, tile_index);
 
   m_efb_color_cache.tiles[tile_index].frame_access_mask |= 1;
 
@@ -438,7 +450,7 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
 
   u32 tile_index;
   if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
-    PopulateEFBCache(true, tile_index);
+    PopulateEFBCacheOnMiss(true, tile_index);
 
   m_efb_depth_cache.tiles[tile_index].frame_access_mask |= 1;
 
@@ -613,6 +625,8 @@ bool FramebufferManager::CompileReadbackPipelines()
   config.framebuffer_state = GetEFBFramebufferState();
   config.framebuffer_state.per_sample_shading = false;
   config.vertex_shader = g_shader_cache->GetScreenQuadVertexShader();
+  if (IsEFBMultiview())
+    config.geometry_shader = nullptr;
   config.pixel_shader = restore_shader.get();
   m_efb_restore_pipeline = g_renderer->CreatePipeline(config);
   if (!m_efb_restore_pipeline)
@@ -785,6 +799,24 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async
   data.tiles[tile_index].present = true;
 }
 
+void FramebufferManager::PopulateEFBCacheOnMiss(bool depth, u32 tile_index)
+{
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+
+  // We have to wait for the GPU anyway, so copy every other tile which was read in recent frames
+  // as part of the same batch. Games which sample the EFB at several points (e.g. depth tests for
+  // lens flares) would otherwise stall once per tile, instead of once per invalidation.
+  PopulateEFBCache(depth, tile_index, true);
+  for (u32 i = 0; i < data.tiles.size(); i++)
+  {
+    if (data.tiles[i].frame_access_mask != 0 && !data.tiles[i].present)
+      PopulateEFBCache(depth, i, true);
+  }
+
+  // Everything RefreshPeekCache() would have copied is now present.
+  data.needs_refresh = false;
+}
+
 void FramebufferManager::ClearEFB(const MathUtil::Rectangle<int>& rc, bool clear_color,
                                   bool clear_alpha, bool clear_z, u32 color, u32 z)
 {
@@ -828,7 +860,8 @@ bool FramebufferManager::CompileClearPipelines()
   AbstractPipelineConfig config;
   config.vertex_format = nullptr;
   config.vertex_shader = vertex_shader.get();
-  config.geometry_shader = IsEFBStereo() ? g_shader_cache->GetColorGeometryShader() : nullptr;
+  config.geometry_shader =
+      IsEFBStereo() && !IsEFBMultiview() ? g_shader_cache->GetColorGeometryShader() : nullptr;
   config.pixel_shader = g_shader_cache->GetColorPixelShader();
   config.rasterization_state = RenderState::GetNoCullRasterizationState(PrimitiveType::Triangles);
   config.depth_state = RenderState::GetAlwaysWriteDepthState();
@@ -998,7 +1031,8 @@ bool FramebufferManager::CompilePokePipelines()
   AbstractPipelineConfig config = {};
   config.vertex_format = m_poke_vertex_format.get();
   config.vertex_shader = poke_vertex_shader.get();
-  config.geometry_shader = IsEFBStereo() ? g_shader_cache->GetColorGeometryShader() : nullptr;
+  config.geometry_shader =
+      IsEFBStereo() && !IsEFBMultiview() ? g_shader_cache->GetColorGeometryShader() : nullptr;
   config.pixel_shader = g_shader_cache->GetColorPixelShader();
   config.rasterization_state = RenderState::GetNoCullRasterizationState(
       g_ActiveConfig.backend_info.bSupportsLargePoints ? PrimitiveType::Points :
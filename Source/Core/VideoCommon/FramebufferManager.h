@@ -66,6 +66,7 @@ public:
   u32 GetEFBSamples() const { return m_efb_color_texture->GetSamples(); }
   bool IsEFBMultisampled() const { return m_efb_color_texture->IsMultisampled(); }
   bool IsEFBStereo() const { return m_efb_color_texture->GetLayers() > 1; }
+  bool IsEFBMultiview() const { return m_efb_color_texture->GetConfig().IsMultiview(); }
   FramebufferState GetEFBFramebufferState() const;
 
   // First-time setup.
@@ -162,6 +163,7 @@ protected:
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  void PopulateEFBCacheOnMiss(bool depth, u32 tile_index);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -188,6 +188,11 @@ std::string GenerateScreenQuadVertexShader()
       "  v_tex0 = float3(float((id << 1) & 2), float(id & 2), 0.0f);\n"
       "  opos = float4(v_tex0.xy * float2(2.0f, -2.0f) + float2(-1.0f, 1.0f), 0.0f, 1.0f);\n");
 
+  // When drawing to a multiview EFB, there is no geometry shader to fill in the layer. The view
+  // index is zero in non-multiview render passes, so this is safe for all framebuffers.
+  if (g_ActiveConfig.UseMultiviewForStereo())
+    code.Write("  v_tex0.z = float(gl_ViewIndex);\n");
+
   // NDC space is flipped in Vulkan. We also flip in GL so that (0,0) is in the lower-left.
   if (GetAPIType() == APIType::Vulkan || GetAPIType() == APIType::OpenGL)
     code.Write("  opos.y = -opos.y;\n");
@@ -31,7 +31,10 @@ constexpr Common::EnumMap<u32, PrimitiveType::TriangleStrip> vertex_out_map{4u,
 
 bool geometry_shader_uid_data::IsPassthrough() const
 {
-  const bool stereo = g_ActiveConfig.stereo_mode != StereoMode::Off;
+  // With multiview, the vertex shader applies the stereo offset and the rasterizer handles
+  // writing to both layers, so stereoscopy alone doesn't need a geometry shader.
+  const bool stereo =
+      g_ActiveConfig.stereo_mode != StereoMode::Off && !g_ActiveConfig.UseMultiviewForStereo();
   const bool wireframe = g_ActiveConfig.bWireFrame;
   return primitive_type >= static_cast<u32>(PrimitiveType::Triangles) && !stereo && !wireframe;
 }
@@ -63,7 +66,7 @@ ShaderCode GenerateGeometryShaderCode(APIType api_type, const ShaderHostConfig&
   const bool wireframe = host_config.wireframe;
   const bool msaa = host_config.msaa;
   const bool ssaa = host_config.ssaa;
-  const bool stereo = host_config.stereo;
+  const bool stereo = host_config.stereo && !host_config.backend_multiview;
   const auto primitive_type = static_cast<PrimitiveType>(uid_data->primitive_type);
   const u32 vertex_in = vertex_in_map[primitive_type];
   u32 vertex_out = vertex_out_map[primitive_type];
@@ -7,6 +7,7 @@
 #include <string_view>
 #include <variant>
 
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/VariantUtil.h"
 
@@ -64,6 +65,45 @@ private:
   GraphicsModConfig m_mod;
 };
 
+void GraphicsModManager::TextureIdFilter::Add(u64 texture_id)
+{
+  // The ids are already hashes, so two independent slices of one are enough to index the filter.
+  const u32 bit0 = static_cast<u32>(texture_id) % NUM_BITS;
+  const u32 bit1 = static_cast<u32>(texture_id >> 32) % NUM_BITS;
+  m_bits[bit0 / 64] |= u64{1} << (bit0 % 64);
+  m_bits[bit1 / 64] |= u64{1} << (bit1 % 64);
+}
+
+bool GraphicsModManager::TextureIdFilter::MayContain(u64 texture_id) const
+{
+  const u32 bit0 = static_cast<u32>(texture_id) % NUM_BITS;
+  const u32 bit1 = static_cast<u32>(texture_id >> 32) % NUM_BITS;
+  return (m_bits[bit0 / 64] & (u64{1} << (bit0 % 64))) != 0 &&
+         (m_bits[bit1 / 64] & (u64{1} << (bit1 % 64))) != 0;
+}
+
+void GraphicsModManager::TextureIdFilter::Clear()
+{
+  m_bits.fill(0);
+}
+
+u64 GraphicsModManager::GetTextureId(std::string_view texture_name)
+{
+  if (texture_name.empty())
+    return 0;
+
+  const u64 id = Common::GetXXH3Hash64(reinterpret_cast<const u8*>(texture_name.data()),
+                                       static_cast<u32>(texture_name.size()), 0);
+  return id != 0 ? id : 1;
+}
+
+u64 GraphicsModManager::GetProjectionTextureKey(ProjectionType projection_type, u64 texture_id)
+{
+  // Perturb the id per projection type; different texture ids mapping to the same key is as
+  // unlikely as two names hashing to the same id.
+  return texture_id ^ (static_cast<u64>(projection_type) * 0x9E3779B97F4A7C15ULL);
+}
+
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetProjectionActions(ProjectionType projection_type) const
 {
@@ -78,9 +118,12 @@ GraphicsModManager::GetProjectionActions(ProjectionType projection_type) const
 
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
-                                                const std::string& texture_name) const
+                                                u64 texture_id) const
 {
-  const auto lookup = fmt::format("{}_{}", texture_name, static_cast<int>(projection_type));
+  if (!m_texture_filter.MayContain(texture_id))
+    return m_default;
+
+  const u64 lookup = GetProjectionTextureKey(projection_type, texture_id);
   if (const auto it = m_projection_texture_target_to_actions.find(lookup);
       it != m_projection_texture_target_to_actions.end())
   {
@@ -91,9 +134,12 @@ GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
 }
 
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
+GraphicsModManager::GetDrawStartedActions(u64 texture_id) const
 {
-  if (const auto it = m_draw_started_target_to_actions.find(texture_name);
+  if (!m_texture_filter.MayContain(texture_id))
+    return m_default;
+
+  if (const auto it = m_draw_started_target_to_actions.find(texture_id);
       it != m_draw_started_target_to_actions.end())
   {
     return it->second;
@@ -103,9 +149,12 @@ GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
 }
 
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetTextureLoadActions(const std::string& texture_name) const
+GraphicsModManager::GetTextureLoadActions(u64 texture_id) const
 {
-  if (const auto it = m_load_texture_target_to_actions.find(texture_name);
+  if (!m_texture_filter.MayContain(texture_id))
+    return m_default;
+
+  if (const auto it = m_load_texture_target_to_actions.find(texture_id);
       it != m_load_texture_target_to_actions.end())
   {
     return it->second;
@@ -192,12 +241,14 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
         std::visit(
             overloaded{
                 [&](const DrawStartedTextureTarget& the_target) {
-                  m_draw_started_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  const u64 texture_id = GetTextureId(the_target.m_texture_info_string);
+                  m_texture_filter.Add(texture_id);
+                  m_draw_started_target_to_actions[texture_id].push_back(m_actions.back().get());
                 },
                 [&](const LoadTextureTarget& the_target) {
-                  m_load_texture_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  const u64 texture_id = GetTextureId(the_target.m_texture_info_string);
+                  m_texture_filter.Add(texture_id);
+                  m_load_texture_target_to_actions[texture_id].push_back(m_actions.back().get());
                 },
                 [&](const EFBTarget& the_target) {
                   FBInfo info;
@@ -216,8 +267,10 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
                 [&](const ProjectionTarget& the_target) {
                   if (the_target.m_texture_info_string)
                   {
-                    const auto lookup = fmt::format("{}_{}", *the_target.m_texture_info_string,
-                                                    static_cast<int>(the_target.m_projection_type));
+                    const u64 texture_id = GetTextureId(*the_target.m_texture_info_string);
+                    m_texture_filter.Add(texture_id);
+                    const u64 lookup =
+                        GetProjectionTextureKey(the_target.m_projection_type, texture_id);
                     m_projection_texture_target_to_actions[lookup].push_back(
                         m_actions.back().get());
                   }
@@ -273,6 +326,7 @@ void GraphicsModManager::Reset()
   m_projection_texture_target_to_actions.clear();
   m_draw_started_target_to_actions.clear();
   m_load_texture_target_to_actions.clear();
+  m_texture_filter.Clear();
   m_efb_target_to_actions.clear();
   m_xfb_target_to_actions.clear();
 }
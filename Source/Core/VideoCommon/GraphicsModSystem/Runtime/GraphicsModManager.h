@@ -3,13 +3,16 @@
 
 #pragma once
 
+#include <array>
 #include <list>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModAction.h"
 #include "VideoCommon/TextureInfo.h"
@@ -19,14 +22,16 @@ class GraphicsModGroupConfig;
 class GraphicsModManager
 {
 public:
+  // Texture names are interned to ids once, when the texture cache entry is created, so that the
+  // per-draw lookups below don't have to build or hash strings. Ids only depend on the name, so
+  // they stay valid when the mods are reloaded. An empty name maps to 0.
+  static u64 GetTextureId(std::string_view texture_name);
+
   const std::vector<GraphicsModAction*>& GetProjectionActions(ProjectionType projection_type) const;
-  const std::vector<GraphicsModAction*>&
-  GetProjectionTextureActions(ProjectionType projection_type,
-                              const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetDrawStartedActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetTextureLoadActions(const std::string& texture_name) const;
+  const std::vector<GraphicsModAction*>& GetProjectionTextureActions(ProjectionType projection_type,
+                                                                     u64 texture_id) const;
+  const std::vector<GraphicsModAction*>& GetDrawStartedActions(u64 texture_id) const;
+  const std::vector<GraphicsModAction*>& GetTextureLoadActions(u64 texture_id) const;
   const std::vector<GraphicsModAction*>& GetEFBActions(const FBInfo& efb) const;
   const std::vector<GraphicsModAction*>& GetXFBActions(const FBInfo& xfb) const;
 
@@ -39,14 +44,30 @@ private:
 
   class DecoratedAction;
 
+  // Bloom filter over every texture id that has an action attached, so that the common case of a
+  // texture no mod targets is rejected without touching the maps.
+  class TextureIdFilter
+  {
+  public:
+    void Add(u64 texture_id);
+    bool MayContain(u64 texture_id) const;
+    void Clear();
+
+  private:
+    static constexpr u32 NUM_BITS = 4096;
+    std::array<u64, NUM_BITS / 64> m_bits{};
+  };
+
+  static u64 GetProjectionTextureKey(ProjectionType projection_type, u64 texture_id);
+
   static inline const std::vector<GraphicsModAction*> m_default = {};
   std::list<std::unique_ptr<GraphicsModAction>> m_actions;
   std::unordered_map<ProjectionType, std::vector<GraphicsModAction*>>
       m_projection_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
-      m_projection_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_draw_started_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_load_texture_target_to_actions;
+  std::unordered_map<u64, std::vector<GraphicsModAction*>> m_projection_texture_target_to_actions;
+  std::unordered_map<u64, std::vector<GraphicsModAction*>> m_draw_started_target_to_actions;
+  std::unordered_map<u64, std::vector<GraphicsModAction*>> m_load_texture_target_to_actions;
+  TextureIdFilter m_texture_filter;
   std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_efb_target_to_actions;
   std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_xfb_target_to_actions;
 
@@ -10,12 +10,14 @@
 #include <string_view>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
-#include <xxhash.h>
 
 #include <fmt/format.h>
+#include <xxhash.h>
 
+#include "Common/Align.h"
 #include "Common/CommonPaths.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
@@ -28,26 +30,201 @@
 #include "Common/Swap.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
+#include "Common/ThreadPool.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
+#include "VideoCommon/BC7Encoder.h"
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/TextureInfo.h"
+#include "VideoCommon/TexturePack.h"
 #include "VideoCommon/VideoConfig.h"
 
 struct DiskTexture
 {
   std::string path;
   bool has_arbitrary_mipmaps;
+  // The location of the texture in path if it's a texture pack. A size of 0 means the whole file.
+  u64 offset = 0;
+  u64 size = 0;
 };
 
-constexpr std::string_view s_format_prefix{"tex1_"};
-
 static std::unordered_map<std::string, DiskTexture> s_textureMap;
+// Whether s_textureMap contains any textures named with the respective hash, so that we only
+// calculate the names we can actually find.
+static bool s_has_legacy_names = false;
+static bool s_has_xxh3_names = false;
 static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_textureCache;
 static std::mutex s_textureCacheMutex;
 static Common::Flag s_textureCacheAbortLoading;
 
 static std::thread s_prefetcher;
 
+// Textures which are being loaded in the background, and the ones that are done but haven't been
+// picked up by Search yet. Failed loads are kept in s_async_loaded as nullptr, so that they don't
+// get retried over and over.
+static std::unordered_set<std::string> s_async_pending;
+static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_async_loaded;
+static std::unique_ptr<Common::TaskGroup> s_async_loads;
+
+// Uncompressed custom textures can be compressed to BC7 in the background. The result is stored in
+// the cache directory, keyed by a hash of the uncompressed data, and used instead of the
+// uncompressed levels from the next time the texture is loaded.
+struct CompressionRequest
+{
+  u64 hash;
+  size_t size;
+  std::vector<HiresTexture::Level> levels;
+};
+
+constexpr u32 COMPRESSED_TEXTURE_MAGIC = 0x37434244;  // "DBC7"
+// Textures which don't fit are compressed the next time they are loaded instead.
+constexpr size_t MAX_PENDING_COMPRESSION_SIZE = 256 * 1024 * 1024;
+
+static std::unique_ptr<Common::TaskGroup> s_compressions;
+static std::mutex s_compression_mutex;
+static std::unordered_set<u64> s_compression_pending;
+static size_t s_compression_pending_size = 0;
+
+static std::string GetCompressedTexturePath(u64 hash)
+{
+  return fmt::format("{}CustomTextures/{:016x}.bc7", File::GetUserPath(D_CACHE_IDX), hash);
+}
+
+static void CompressTexture(CompressionRequest request)
+{
+  std::vector<u32> header{COMPRESSED_TEXTURE_MAGIC, static_cast<u32>(request.levels.size())};
+  std::vector<u8> data;
+  for (const HiresTexture::Level& level : request.levels)
+  {
+    header.push_back(level.width);
+    header.push_back(level.height);
+
+    const size_t offset = data.size();
+    data.resize(offset + BC7Encoder::GetEncodedSize(level.width, level.height));
+    BC7Encoder::Encode(data.data() + offset, level.data.data(), level.width, level.height,
+                       level.row_length);
+  }
+
+  // Write to a temporary file first, so that a partially written file is never picked up.
+  const std::string path = GetCompressedTexturePath(request.hash);
+  const std::string temp_path = path + ".tmp";
+  File::CreateFullPath(path);
+  bool success;
+  {
+    File::IOFile file(temp_path, "wb");
+    success = file.WriteArray(header.data(), header.size()) &&
+              file.WriteBytes(data.data(), data.size());
+  }
+  if (!success || !File::Rename(temp_path, path))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to write compressed custom texture {}", path);
+    File::Delete(temp_path);
+  }
+
+  std::lock_guard lk(s_compression_mutex);
+  s_compression_pending.erase(request.hash);
+  s_compression_pending_size -= request.size;
+}
+
+static bool LoadCompressedTexture(u64 hash, std::vector<HiresTexture::Level>* levels)
+{
+  File::IOFile file(GetCompressedTexturePath(hash), "rb");
+  if (!file)
+    return false;
+
+  std::vector<u32> header(2 + levels->size() * 2);
+  if (!file.ReadArray(header.data(), header.size()) || header[0] != COMPRESSED_TEXTURE_MAGIC ||
+      header[1] != levels->size())
+  {
+    return false;
+  }
+
+  std::vector<HiresTexture::Level> compressed_levels(levels->size());
+  for (size_t i = 0; i < compressed_levels.size(); i++)
+  {
+    HiresTexture::Level& level = compressed_levels[i];
+    level.width = header[2 + i * 2];
+    level.height = header[3 + i * 2];
+    if (level.width != (*levels)[i].width || level.height != (*levels)[i].height)
+      return false;
+
+    level.format = AbstractTextureFormat::BPTC;
+    level.row_length = Common::AlignUp(level.width, BC7Encoder::BLOCK_SIZE);
+    level.data.resize(BC7Encoder::GetEncodedSize(level.width, level.height));
+    if (!file.ReadBytes(level.data.data(), level.data.size()))
+      return false;
+  }
+
+  *levels = std::move(compressed_levels);
+  return true;
+}
+
+// Replaces the levels of an uncompressed texture with their compressed version if there is one, or
+// queues them for compression otherwise.
+static void UseCompressedTexture(std::vector<HiresTexture::Level>* levels)
+{
+  if (!g_ActiveConfig.bHiresTexturesCompress ||
+      !g_ActiveConfig.backend_info.bSupportsBPTCTextures)
+  {
+    return;
+  }
+
+  // D3D11 requires the first level of block compressed textures to be a multiple of the block
+  // size. All levels have the same format at this point.
+  const HiresTexture::Level& first_level = levels->front();
+  if (first_level.format != AbstractTextureFormat::RGBA8 ||
+      first_level.width % BC7Encoder::BLOCK_SIZE != 0 ||
+      first_level.height % BC7Encoder::BLOCK_SIZE != 0)
+  {
+    return;
+  }
+
+  u64 hash = 0;
+  size_t size = 0;
+  for (const HiresTexture::Level& level : *levels)
+  {
+    const u64 seed = hash ^ ((static_cast<u64>(level.width) << 32) | level.height);
+    hash = XXH3_64bits_withSeed(level.data.data(), level.data.size(), seed);
+    size += level.data.size();
+  }
+
+  if (LoadCompressedTexture(hash, levels))
+    return;
+
+  std::lock_guard lk(s_compression_mutex);
+  if (s_compression_pending.contains(hash) ||
+      s_compression_pending_size + size > MAX_PENDING_COMPRESSION_SIZE)
+  {
+    return;
+  }
+
+  if (!s_compressions)
+    s_compressions = std::make_unique<Common::TaskGroup>(Common::ThreadPool::Priority::Low);
+  s_compression_pending.insert(hash);
+  s_compression_pending_size += size;
+  s_compressions->Submit(
+      [request = CompressionRequest{hash, size, *levels}]() mutable {
+        CompressTexture(std::move(request));
+      });
+}
+
+static void StopCompression()
+{
+  // Compression tasks take the mutex when they're done with a texture, so it can't be held while
+  // waiting for them.
+  std::unique_ptr<Common::TaskGroup> compressions;
+  {
+    std::lock_guard lk(s_compression_mutex);
+    compressions = std::move(s_compressions);
+  }
+  if (compressions)
+    compressions->Cancel();
+
+  std::lock_guard lk(s_compression_mutex);
+  s_compression_pending.clear();
+  s_compression_pending_size = 0;
+}
+
 void HiresTexture::Init()
 {
   // Note: Update is not called here so that we handle dynamic textures on startup more gracefully
@@ -56,6 +233,7 @@ void HiresTexture::Init()
 void HiresTexture::Shutdown()
 {
   Clear();
+  StopCompression();
 }
 
 void HiresTexture::Update()
@@ -65,6 +243,7 @@ void HiresTexture::Update()
     s_textureCacheAbortLoading.Set();
     s_prefetcher.join();
   }
+  StopAsyncLoads();
 
   if (!g_ActiveConfig.bHiresTextures)
   {
@@ -78,10 +257,29 @@ void HiresTexture::Update()
   }
 
   const std::string& game_id = SConfig::GetInstance().GetGameID();
+  const std::string& root_directory = File::GetUserPath(D_HIRESTEXTURES_IDX);
   const std::set<std::string> texture_directories =
-      GetTextureDirectoriesWithGameId(File::GetUserPath(D_HIRESTEXTURES_IDX), game_id);
+      GetTextureDirectoriesWithGameId(root_directory, game_id);
   const std::vector<std::string> extensions{".png", ".dds"};
 
+  // Returns false if a texture with the same name was already inserted.
+  const auto insert_texture = [](std::string filename, DiskTexture texture) {
+    const bool is_legacy_name = filename.starts_with(TextureInfo::legacy_format_prefix);
+    const bool is_xxh3_name = filename.starts_with(TextureInfo::xxh3_format_prefix);
+    if (!is_legacy_name && !is_xxh3_name)
+      return true;
+
+    s_has_legacy_names |= is_legacy_name;
+    s_has_xxh3_names |= is_xxh3_name;
+
+    const size_t arb_index = filename.rfind("_arb");
+    texture.has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (texture.has_arbitrary_mipmaps)
+      filename.erase(arb_index, 4);
+
+    return s_textureMap.try_emplace(std::move(filename), std::move(texture)).second;
+  };
+
   for (const auto& texture_directory : texture_directories)
   {
     const auto texture_paths =
@@ -93,20 +291,8 @@ void HiresTexture::Update()
       std::string filename;
       SplitPath(path, nullptr, &filename, nullptr);
 
-      if (filename.substr(0, s_format_prefix.length()) == s_format_prefix)
-      {
-        const size_t arb_index = filename.rfind("_arb");
-        const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
-        if (has_arbitrary_mipmaps)
-          filename.erase(arb_index, 4);
-
-        const auto [it, inserted] =
-            s_textureMap.try_emplace(filename, DiskTexture{path, has_arbitrary_mipmaps});
-        if (!inserted)
-        {
-          failed_insert = true;
-        }
-      }
+      if (!insert_texture(std::move(filename), DiskTexture{path, false}))
+        failed_insert = true;
     }
 
     if (failed_insert)
@@ -116,6 +302,29 @@ void HiresTexture::Update()
     }
   }
 
+  // The textures of a pack are inserted after the loose files, so that single textures of a pack
+  // can be replaced without having to rebuild it.
+  std::string pack_path =
+      fmt::format("{}{}{}", root_directory, game_id, TexturePack::FILE_EXTENSION);
+  if (!File::Exists(pack_path))
+  {
+    pack_path =
+        fmt::format("{}{}{}", root_directory, game_id.substr(0, 3), TexturePack::FILE_EXTENSION);
+  }
+  if (File::Exists(pack_path))
+  {
+    if (const auto entries = TexturePack::ReadIndex(pack_path))
+    {
+      for (const TexturePack::Entry& entry : *entries)
+        insert_texture(entry.name, DiskTexture{pack_path, false, entry.offset, entry.size});
+      INFO_LOG_FMT(VIDEO, "Loaded texture pack '{}' with {} textures", pack_path, entries->size());
+    }
+    else
+    {
+      ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is invalid", pack_path);
+    }
+  }
+
   if (g_ActiveConfig.bCacheHiresTextures)
   {
     // remove cached but deleted textures
@@ -144,13 +353,17 @@ void HiresTexture::Clear()
     s_textureCacheAbortLoading.Set();
     s_prefetcher.join();
   }
+  StopAsyncLoads();
   s_textureMap.clear();
+  s_has_legacy_names = false;
+  s_has_xxh3_names = false;
   s_textureCache.clear();
 }
 
 void HiresTexture::Prefetch()
 {
   Common::SetCurrentThreadName("Prefetcher");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
 
   size_t size_sum = 0;
   const size_t sys_mem = Common::MemPhysical();
@@ -213,35 +426,56 @@ void HiresTexture::Prefetch()
                   10000);
 }
 
-std::string HiresTexture::GenBaseName(const TextureInfo& texture_info, bool dump)
+static std::string FindBaseName(const TextureInfo& texture_info, TextureHashVersion hash_version)
 {
-  if (!dump && s_textureMap.empty())
-    return "";
-
-  const auto texture_name_details = texture_info.CalculateTextureName();
+  const auto texture_name_details = texture_info.CalculateTextureName(hash_version);
 
   // look for an exact match first
   const std::string full_name = texture_name_details.GetFullName();
-  if (dump || s_textureMap.find(full_name) != s_textureMap.end())
+  if (s_textureMap.find(full_name) != s_textureMap.end())
     return full_name;
 
   // else try and find a wildcard
-  if (!dump)
-  {
-    // Single wildcard ignoring the tlut hash
-    const std::string texture_name_single_wildcard_tlut =
-        fmt::format("{}_{}_$_{}", texture_name_details.base_name, texture_name_details.texture_name,
-                    texture_name_details.format_name);
-    if (s_textureMap.find(texture_name_single_wildcard_tlut) != s_textureMap.end())
-      return texture_name_single_wildcard_tlut;
 
-    // Single wildcard ignoring the texture hash
-    const std::string texture_name_single_wildcard_tex =
-        fmt::format("{}_${}_{}", texture_name_details.base_name, texture_name_details.tlut_name,
-                    texture_name_details.format_name);
-    if (s_textureMap.find(texture_name_single_wildcard_tex) != s_textureMap.end())
-      return texture_name_single_wildcard_tex;
+  // Single wildcard ignoring the tlut hash
+  const std::string texture_name_single_wildcard_tlut =
+      fmt::format("{}_{}_$_{}", texture_name_details.base_name, texture_name_details.texture_name,
+                  texture_name_details.format_name);
+  if (s_textureMap.find(texture_name_single_wildcard_tlut) != s_textureMap.end())
+    return texture_name_single_wildcard_tlut;
+
+  // Single wildcard ignoring the texture hash
+  const std::string texture_name_single_wildcard_tex =
+      fmt::format("{}_${}_{}", texture_name_details.base_name, texture_name_details.tlut_name,
+                  texture_name_details.format_name);
+  if (s_textureMap.find(texture_name_single_wildcard_tex) != s_textureMap.end())
+    return texture_name_single_wildcard_tex;
+
+  return "";
+}
+
+std::string HiresTexture::GenBaseName(const TextureInfo& texture_info, bool dump)
+{
+  // Dumps always use the configured hash, but packs using either naming scheme can be loaded.
+  const TextureHashVersion hash_version = g_ActiveConfig.texture_hash_version;
+  if (dump)
+    return texture_info.CalculateTextureName(hash_version).GetFullName();
+
+  const bool prefer_xxh3 = hash_version == TextureHashVersion::XXH3;
+  if (prefer_xxh3 && s_has_xxh3_names)
+  {
+    std::string name = FindBaseName(texture_info, TextureHashVersion::XXH3);
+    if (!name.empty())
+      return name;
+  }
+  if (s_has_legacy_names)
+  {
+    std::string name = FindBaseName(texture_info, TextureHashVersion::Legacy);
+    if (!name.empty())
+      return name;
   }
+  if (!prefer_xxh3 && s_has_xxh3_names)
+    return FindBaseName(texture_info, TextureHashVersion::XXH3);
 
   return "";
 }
@@ -261,7 +495,8 @@ u32 HiresTexture::CalculateMipCount(u32 width, u32 height)
   return mip_count;
 }
 
-std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_info)
+std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_info,
+                                                   std::string* pending_name)
 {
   const std::string base_filename = GenBaseName(texture_info);
 
@@ -273,6 +508,28 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_in
     return iter->second;
   }
 
+  if (pending_name && g_ActiveConfig.bHiresTexturesAsync && !base_filename.empty())
+  {
+    auto loaded_iter = s_async_loaded.find(base_filename);
+    if (loaded_iter != s_async_loaded.end())
+    {
+      std::shared_ptr<HiresTexture> ptr = loaded_iter->second;
+      if (ptr)
+      {
+        s_async_loaded.erase(loaded_iter);
+        if (g_ActiveConfig.bCacheHiresTextures)
+          s_textureCache[base_filename] = ptr;
+      }
+      return ptr;
+    }
+
+    if (s_async_pending.insert(base_filename).second)
+      QueueAsyncLoad(base_filename, texture_info.GetRawWidth(), texture_info.GetRawHeight());
+
+    *pending_name = base_filename;
+    return nullptr;
+  }
+
   std::shared_ptr<HiresTexture> ptr(
       Load(base_filename, texture_info.GetRawWidth(), texture_info.GetRawHeight()));
 
@@ -284,6 +541,37 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_in
   return ptr;
 }
 
+bool HiresTexture::IsLoadPending(const std::string& base_filename)
+{
+  std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+  return s_async_pending.contains(base_filename);
+}
+
+void HiresTexture::QueueAsyncLoad(std::string base_filename, u32 width, u32 height)
+{
+  // A frame is waiting for these, so they go ahead of other background work.
+  if (!s_async_loads)
+    s_async_loads = std::make_unique<Common::TaskGroup>(Common::ThreadPool::Priority::High);
+
+  s_async_loads->Submit([base_filename = std::move(base_filename), width, height]() mutable {
+    std::shared_ptr<HiresTexture> texture(Load(base_filename, width, height));
+
+    std::lock_guard<std::mutex> loader_lk(s_textureCacheMutex);
+    s_async_pending.erase(base_filename);
+    s_async_loaded[std::move(base_filename)] = std::move(texture);
+  });
+}
+
+void HiresTexture::StopAsyncLoads()
+{
+  if (s_async_loads)
+    s_async_loads->Cancel();
+
+  std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+  s_async_pending.clear();
+  s_async_loaded.clear();
+}
+
 std::unique_ptr<HiresTexture> HiresTexture::Load(const std::string& base_filename, u32 width,
                                                  u32 height)
 {
@@ -298,7 +586,7 @@ std::unique_ptr<HiresTexture> HiresTexture::Load(const std::string& base_filenam
   std::unique_ptr<HiresTexture> ret = std::unique_ptr<HiresTexture>(new HiresTexture());
   const DiskTexture& first_mip_file = filename_iter->second;
   ret->m_has_arbitrary_mipmaps = first_mip_file.has_arbitrary_mipmaps;
-  LoadDDSTexture(ret.get(), first_mip_file.path);
+  LoadDDSTexture(ret.get(), first_mip_file.path, first_mip_file.offset, first_mip_file.size);
 
   // Load remaining mip levels, or from the start if it's not a DDS texture.
   for (u32 mip_level = static_cast<u32>(ret->m_levels.size());; mip_level++)
@@ -314,12 +602,14 @@ std::unique_ptr<HiresTexture> HiresTexture::Load(const std::string& base_filenam
     // Try loading DDS textures first, that way we maintain compression of DXT formats.
     // TODO: Reduce the number of open() calls here. We could use one fd.
     Level level;
-    if (!LoadDDSTexture(level, filename_iter->second.path, mip_level))
+    const DiskTexture& mip_file = filename_iter->second;
+    if (!LoadDDSTexture(level, mip_file.path, mip_file.offset, mip_file.size, mip_level))
     {
       File::IOFile file;
-      file.Open(filename_iter->second.path, "rb");
-      std::vector<u8> buffer(file.GetSize());
-      file.ReadBytes(buffer.data(), file.GetSize());
+      file.Open(mip_file.path, "rb");
+      file.Seek(mip_file.offset, File::SeekOrigin::Begin);
+      std::vector<u8> buffer(mip_file.size != 0 ? mip_file.size : file.GetSize());
+      file.ReadBytes(buffer.data(), buffer.size());
 
       if (!LoadTexture(level, buffer))
       {
@@ -395,6 +685,8 @@ std::unique_ptr<HiresTexture> HiresTexture::Load(const std::string& base_filenam
     return nullptr;
   }
 
+  UseCompressedTexture(&ret->m_levels);
+
   return ret;
 }
 
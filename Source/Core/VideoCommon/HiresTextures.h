@@ -25,7 +25,12 @@ public:
   static void Clear();
   static void Shutdown();
 
-  static std::shared_ptr<HiresTexture> Search(const TextureInfo& texture_info);
+  // When asynchronous loading is enabled and pending_name is given, textures which aren't in memory
+  // yet are loaded in the background instead. Until that's done, nullptr is returned, and the name
+  // of the texture is stored in pending_name for use with IsLoadPending.
+  static std::shared_ptr<HiresTexture> Search(const TextureInfo& texture_info,
+                                              std::string* pending_name = nullptr);
+  static bool IsLoadPending(const std::string& base_filename);
 
   static std::string GenBaseName(const TextureInfo& texture_info, bool dump = false);
 
@@ -49,8 +54,12 @@ public:
 private:
   static std::unique_ptr<HiresTexture> Load(const std::string& base_filename, u32 width,
                                             u32 height);
-  static bool LoadDDSTexture(HiresTexture* tex, const std::string& filename);
-  static bool LoadDDSTexture(Level& level, const std::string& filename, u32 mip_level);
+  static void QueueAsyncLoad(std::string base_filename, u32 width, u32 height);
+  static void StopAsyncLoads();
+  // offset and size select a file inside of a texture pack. A size of 0 means the whole file.
+  static bool LoadDDSTexture(HiresTexture* tex, const std::string& filename, u64 offset, u64 size);
+  static bool LoadDDSTexture(Level& level, const std::string& filename, u64 offset, u64 size,
+                             u32 mip_level);
   static bool LoadTexture(Level& level, const std::vector<u8>& buffer);
   static void Prefetch();
 
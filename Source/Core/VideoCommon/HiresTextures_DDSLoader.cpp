@@ -227,7 +227,8 @@ void ConvertTexture_R8G8B8(HiresTexture::Level* level)
   level->data = std::move(new_data);
 }
 
-bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
+// file_size is the size of the DDS data, which starts at the current position of the file.
+bool ParseDDSHeader(File::IOFile& file, u64 file_size, DDSLoadInfo* info)
 {
   // Exit as early as possible for non-DDS textures, since all extensions are currently
   // passed through this function.
@@ -394,7 +395,7 @@ bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
 
   // Check for truncated or corrupted files.
   info->first_mip_offset = sizeof(magic) + header_size;
-  if (info->first_mip_offset >= file.GetSize())
+  if (info->first_mip_offset >= file_size)
     return false;
 
   return true;
@@ -434,7 +435,8 @@ bool ReadMipLevel(HiresTexture::Level* level, File::IOFile& file, const std::str
 
 }  // namespace
 
-bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename)
+bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename, u64 offset,
+                                  u64 size)
 {
   File::IOFile file;
   file.Open(filename, "rb");
@@ -442,12 +444,15 @@ bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename
     return false;
 
   DDSLoadInfo info;
-  if (!ParseDDSHeader(file, &info))
+  if (!file.Seek(offset, File::SeekOrigin::Begin) ||
+      !ParseDDSHeader(file, size != 0 ? size : file.GetSize(), &info))
+  {
     return false;
+  }
 
   // Read first mip level, as it may have a custom pitch.
   Level first_level;
-  if (!file.Seek(info.first_mip_offset, File::SeekOrigin::Begin) ||
+  if (!file.Seek(offset + info.first_mip_offset, File::SeekOrigin::Begin) ||
       !ReadMipLevel(&first_level, file, filename, 0, info, info.width, info.height,
                     info.first_mip_row_length, info.first_mip_size))
   {
@@ -481,7 +486,8 @@ bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename
   return true;
 }
 
-bool HiresTexture::LoadDDSTexture(Level& level, const std::string& filename, u32 mip_level)
+bool HiresTexture::LoadDDSTexture(Level& level, const std::string& filename, u64 offset, u64 size,
+                                  u32 mip_level)
 {
   // Only loading a single mip level.
   File::IOFile file;
@@ -490,8 +496,11 @@ bool HiresTexture::LoadDDSTexture(Level& level, const std::string& filename, u32
     return false;
 
   DDSLoadInfo info;
-  if (!ParseDDSHeader(file, &info))
+  if (!file.Seek(offset, File::SeekOrigin::Begin) ||
+      !ParseDDSHeader(file, size != 0 ? size : file.GetSize(), &info))
+  {
     return false;
+  }
 
   return ReadMipLevel(&level, file, filename, mip_level, info, info.width, info.height,
                       info.first_mip_row_length, info.first_mip_size);
@@ -6,7 +6,15 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <numeric>
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+#include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -16,6 +24,113 @@ namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
+// Lane values for WritePattern besides plain vertex offsets.
+constexpr int LANE_RESTART = -1;  // Always the primitive restart index
+constexpr int LANE_BASE = -2;     // Always the first vertex of the draw (fan center)
+
+template <size_t Length>
+struct LaneTable
+{
+  std::array<u16, Length> offset{};
+  std::array<u16, Length> mask{};
+  std::array<u16, Length> step{};
+};
+
+// Repeats one period of an index pattern until it fills a whole number of 8x16-bit vectors.
+template <u32 Vertices, size_t Length>
+constexpr auto BuildLaneTable(const std::array<int, Length>& period)
+{
+  constexpr size_t lanes = std::lcm(Length, size_t(8));
+  constexpr u32 repeats = static_cast<u32>(lanes / Length);
+  LaneTable<lanes> table;
+  for (size_t i = 0; i < lanes; i++)
+  {
+    const int lane = period[i % Length];
+    const u32 rep = static_cast<u32>(i / Length);
+    if (lane == LANE_RESTART)
+    {
+      table.offset[i] = s_primitive_restart;
+    }
+    else if (lane != LANE_BASE)
+    {
+      table.offset[i] = static_cast<u16>(lane + rep * Vertices);
+      table.mask[i] = UINT16_MAX;
+      table.step[i] = static_cast<u16>(repeats * Vertices);
+    }
+    else
+    {
+      table.mask[i] = UINT16_MAX;
+    }
+  }
+  return table;
+}
+
+// Writes as many whole periods of an index pattern as fit a whole number of vectors, given
+// `periods` available, and returns how many were written.  Each period consumes `Vertices`
+// vertices and emits one index per lane, where lanes are vertex offsets relative to the start of
+// the period (the first period starting at `index`) or one of the LANE_ constants.  Every lane
+// either advances by a fixed step per iteration or stays constant, so the whole pattern is
+// generated with vector adds and the scalar loops only have to handle the tail.
+template <u32 Vertices, int... Lanes>
+u32 WritePattern(u16*& index_ptr, u32 periods, u32 index)
+{
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+  static constexpr auto table =
+      BuildLaneTable<Vertices>(std::array<int, sizeof...(Lanes)>{Lanes...});
+  constexpr size_t num_vectors = table.offset.size() / 8;
+  constexpr u32 repeats = static_cast<u32>(table.offset.size() / sizeof...(Lanes));
+
+  const u32 iterations = periods / repeats;
+  if (iterations == 0)
+    return 0;
+
+#if defined(_M_X86_64)
+  const __m128i base = _mm_set1_epi16(static_cast<s16>(index));
+  std::array<__m128i, num_vectors> values;
+  std::array<__m128i, num_vectors> steps;
+  for (size_t i = 0; i < num_vectors; i++)
+  {
+    const auto* offset = reinterpret_cast<const __m128i*>(&table.offset[i * 8]);
+    const auto* mask = reinterpret_cast<const __m128i*>(&table.mask[i * 8]);
+    values[i] = _mm_add_epi16(_mm_and_si128(base, _mm_loadu_si128(mask)), _mm_loadu_si128(offset));
+    steps[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&table.step[i * 8]));
+  }
+  for (u32 iteration = 0; iteration < iterations; iteration++)
+  {
+    for (size_t i = 0; i < num_vectors; i++)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr), values[i]);
+      values[i] = _mm_add_epi16(values[i], steps[i]);
+      index_ptr += 8;
+    }
+  }
+#else
+  const uint16x8_t base = vdupq_n_u16(static_cast<u16>(index));
+  std::array<uint16x8_t, num_vectors> values;
+  std::array<uint16x8_t, num_vectors> steps;
+  for (size_t i = 0; i < num_vectors; i++)
+  {
+    values[i] = vaddq_u16(vandq_u16(base, vld1q_u16(&table.mask[i * 8])),
+                          vld1q_u16(&table.offset[i * 8]));
+    steps[i] = vld1q_u16(&table.step[i * 8]);
+  }
+  for (u32 iteration = 0; iteration < iterations; iteration++)
+  {
+    for (size_t i = 0; i < num_vectors; i++)
+    {
+      vst1q_u16(index_ptr, values[i]);
+      values[i] = vaddq_u16(values[i], steps[i]);
+      index_ptr += 8;
+    }
+  }
+#endif
+
+  return iterations * repeats;
+#else
+  return 0;
+#endif
+}
+
 template <bool pr>
 u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -30,7 +145,13 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  u32 written;
+  if constexpr (pr)
+    written = WritePattern<3, 0, 1, 2, LANE_RESTART>(index_ptr, num_verts / 3, index);
+  else
+    written = WritePattern<3, 0, 1, 2>(index_ptr, num_verts / 3, index);
+
+  for (u32 i = 2 + written * 3; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
@@ -42,7 +163,7 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
+    for (u32 i = WritePattern<1, 0>(index_ptr, num_verts, index); i < num_verts; ++i)
     {
       *index_ptr++ = index + i;
     }
@@ -50,8 +171,12 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
   }
   else
   {
+    // Triangles are written in pairs, so the winding of the first remaining one is unchanged.
+    const u32 pairs = num_verts > 2 ? (num_verts - 2) / 2 : 0;
+    const u32 written = WritePattern<2, 0, 1, 2, 1, 3, 2>(index_ptr, pairs, index);
+
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (u32 i = 2 + written * 2; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -87,6 +212,12 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 
   if constexpr (pr)
   {
+    if (num_verts > 2)
+    {
+      i += 3 * WritePattern<3, 1, 2, LANE_BASE, 3, 4, LANE_RESTART>(index_ptr,
+                                                                   (num_verts - 2) / 3, index);
+    }
+
     for (; i + 3 <= num_verts; i += 3)
     {
       *index_ptr++ = index + i - 1;
@@ -106,6 +237,10 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
       *index_ptr++ = s_primitive_restart;
     }
   }
+  else if (num_verts > 2)
+  {
+    i += WritePattern<1, LANE_BASE, 1, 2>(index_ptr, num_verts - 2, index);
+  }
 
   for (; i < num_verts; ++i)
   {
@@ -135,6 +270,11 @@ template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
   u32 i = 3;
+  if constexpr (pr)
+    i += 4 * WritePattern<4, 1, 2, 0, 3, LANE_RESTART>(index_ptr, num_verts / 4, index);
+  else
+    i += 4 * WritePattern<4, 0, 1, 2, 0, 2, 3>(index_ptr, num_verts / 4, index);
+
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -225,7 +365,7 @@ u16* AddLines_VSExpand(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddPoints(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 0; i != num_verts; ++i)
+  for (u32 i = WritePattern<1, 0>(index_ptr, num_verts, index); i != num_verts; ++i)
   {
     *index_ptr++ = index + i;
   }
@@ -319,6 +459,21 @@ void IndexGenerator::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vert
   m_base_index += num_vertices;
 }
 
+void IndexGenerator::AddRemappedIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                                        const u16* remap, u32 num_unique_vertices)
+{
+  DEBUG_ASSERT(primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
+
+  u16* const start = m_index_buffer_current;
+  m_index_buffer_current = m_primitive_table[primitive](start, num_vertices, 0);
+  for (u16* index = start; index != m_index_buffer_current; ++index)
+  {
+    if (*index != s_primitive_restart)
+      *index = static_cast<u16>(m_base_index + remap[*index]);
+  }
+  m_base_index += num_unique_vertices;
+}
+
 void IndexGenerator::AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices)
 {
   std::memcpy(m_index_buffer_current, indices, sizeof(u16) * num_indices);
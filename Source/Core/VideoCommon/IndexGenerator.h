@@ -18,6 +18,11 @@ public:
 
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
 
+  // Like AddIndices, but vertex i of the primitive is vertex remap[i] of the num_unique_vertices
+  // vertices which were added to the vertex buffer. Only for triangle primitives.
+  void AddRemappedIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices, const u16* remap,
+                          u32 num_unique_vertices);
+
   void AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices);
 
   // returns numprimitives
@@ -23,11 +23,13 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStructs.h"
 
@@ -130,8 +132,15 @@ public:
     // load vertices
     const u32 size = vertex_size * num_vertices;
 
-    const u32 bytes =
-        VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive, num_vertices, vertex_data);
+    DisplayListCache::CachedVertices* cached = nullptr;
+    if (m_cached_display_list)
+    {
+      cached = m_cached_display_list->GetVertices(
+          static_cast<u32>(vertex_data - m_cached_display_list_start));
+    }
+
+    const u32 bytes = VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive, num_vertices,
+                                                                      vertex_data, cached);
 
     ASSERT(bytes == size);
 
@@ -172,7 +181,7 @@ public:
         const u8* start_address;
 
         auto& fifo = system.GetFifo();
-        if (fifo.UseDeterministicGPUThread())
+        if (fifo.UseFifoAuxBuffer())
         {
           start_address = static_cast<u8*>(fifo.PopFifoAuxBuffer(size));
         }
@@ -188,8 +197,15 @@ public:
           // temporarily swap dl and non-dl (small "hack" for the stats)
           g_stats.SwapDL();
 
+          if (g_ActiveConfig.bDisplayListCache)
+          {
+            m_cached_display_list = DisplayListCache::Lookup(address, start_address, size);
+            m_cached_display_list_start = start_address;
+          }
+
           Run(start_address, size, *this);
           INCSTAT(g_stats.this_frame.num_dlists_called);
+          m_cached_display_list = nullptr;
 
           // un-swap
           g_stats.SwapDL();
@@ -255,6 +271,9 @@ public:
 
   u32 m_cycles = 0;
   bool m_in_display_list = false;
+  // Only set while running a display list on the GPU thread.
+  DisplayListCache::CachedDisplayList* m_cached_display_list = nullptr;
+  const u8* m_cached_display_list_start = nullptr;
 };
 
 template <bool is_preprocess>
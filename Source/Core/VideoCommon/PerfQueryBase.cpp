@@ -3,6 +3,7 @@
 
 #include "VideoCommon/PerfQueryBase.h"
 #include <memory>
+#include "Common/ChunkFile.h"
 #include "VideoCommon/VideoConfig.h"
 
 std::unique_ptr<PerfQueryBase> g_perf_query;
@@ -11,3 +12,36 @@ bool PerfQueryBase::ShouldEmulate()
 {
   return g_ActiveConfig.bPerfQueriesEnable;
 }
+
+bool PerfQueryBase::ShouldUseAsyncResults()
+{
+  return g_ActiveConfig.bPerfQueriesEnable && g_ActiveConfig.bPerfQueriesAsync;
+}
+
+void PerfQueryBase::ClearCounters()
+{
+  if (ShouldUseAsyncResults())
+  {
+    // This waits for the host GPU, but only once per interval and only on the GPU thread, instead
+    // of the CPU thread syncing with the GPU thread on every counter read.
+    FlushResults();
+    for (int i = 0; i < PQ_NUM_MEMBERS; i++)
+    {
+      m_async_results[i].store(GetQueryResult(static_cast<PerfQueryType>(i)),
+                               std::memory_order_relaxed);
+    }
+  }
+
+  ResetQuery();
+}
+
+u32 PerfQueryBase::GetAsyncQueryResult(PerfQueryType type) const
+{
+  return m_async_results[type].load(std::memory_order_relaxed);
+}
+
+void PerfQueryBase::DoState(PointerWrap& p)
+{
+  for (auto& result : m_async_results)
+    p.Do(result);
+}
@@ -9,6 +9,8 @@
 
 #include "Common/CommonTypes.h"
 
+class PointerWrap;
+
 enum PerfQueryType
 {
   PQ_ZCOMP_INPUT_ZCOMPLOC = 0,
@@ -38,6 +40,23 @@ public:
   // NOTE: Called from CPU+GPU thread
   static bool ShouldEmulate();
 
+  // Checks if reads should return the totals of the previous counting interval, rather than
+  // waiting for the GPU thread and the host GPU to catch up.
+  // NOTE: Called from CPU+GPU thread
+  static bool ShouldUseAsyncResults();
+
+  // Called when the game clears the counters. With async results, the totals of the interval
+  // which just ended are resolved and saved before the counters are reset.
+  // NOTE: Called from GPU thread
+  void ClearCounters();
+
+  // Return the saved value of the previous interval for the specified query type
+  // NOTE: Called from CPU thread
+  u32 GetAsyncQueryResult(PerfQueryType type) const;
+
+  // Saves the async totals, which games read until the next interval ends.
+  void DoState(PointerWrap& p);
+
   // Begin querying the specified value for the following host GPU commands
   // The call to EnableQuery() should be placed immediately before the draw command, otherwise
   // there is a risk of GPU resets if the query is left open and the buffer is submitted during
@@ -65,6 +84,7 @@ public:
 protected:
   std::atomic<u32> m_query_count;
   std::array<std::atomic<u32>, PQG_NUM_MEMBERS> m_results;
+  std::array<std::atomic<u32>, PQ_NUM_MEMBERS> m_async_results{};
 };
 
 extern std::unique_ptr<PerfQueryBase> g_perf_query;
@@ -3,6 +3,7 @@
 
 #include "VideoCommon/PerformanceMetrics.h"
 
+#include <algorithm>
 #include <mutex>
 
 #include <imgui.h>
@@ -10,7 +11,9 @@
 
 #include "Core/CoreTiming.h"
 #include "Core/HW/VideoInterface.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/System.h"
+#include "VideoCommon/FrameTimeBreakdown.h"
 #include "VideoCommon/VideoConfig.h"
 
 PerformanceMetrics g_perf_metrics;
@@ -20,26 +23,50 @@ void PerformanceMetrics::Reset()
   m_fps_counter.Reset();
   m_vps_counter.Reset();
   m_speed_counter.Reset();
+  m_frame_time_histogram.Reset();
+  m_vblank_time_histogram.Reset();
+  FrameTimeBreakdown::Reset();
+  m_breakdown_max_time = 0.0;
 
   m_time_sleeping = DT::zero();
+  m_throttle_overshoot = DT::zero();
+  m_present_latency = DT::zero();
   m_real_times.fill(Clock::now());
   m_cpu_times.fill(Core::System::GetInstance().GetCoreTiming().GetCPUTimePoint(0));
 }
 
+static u64 ToMicroseconds(DT dt)
+{
+  return static_cast<u64>(std::chrono::duration_cast<std::chrono::microseconds>(dt).count());
+}
+
 void PerformanceMetrics::CountFrame()
 {
   m_fps_counter.Count();
+  m_frame_time_histogram.Add(ToMicroseconds(m_fps_counter.GetLastRawDt()));
+  FrameTimeBreakdown::EndFrame();
 }
 
 void PerformanceMetrics::CountVBlank()
 {
   m_vps_counter.Count();
+  m_vblank_time_histogram.Add(ToMicroseconds(m_vps_counter.GetLastRawDt()));
 }
 
-void PerformanceMetrics::CountThrottleSleep(DT sleep)
+void PerformanceMetrics::CountThrottleSleep(DT sleep, DT overshoot)
 {
   std::unique_lock lock(m_time_lock);
   m_time_sleeping += sleep;
+  m_throttle_overshoot += (overshoot - m_throttle_overshoot) / 64;
+}
+
+void PerformanceMetrics::CountPresentLatency(DT latency)
+{
+  std::unique_lock lock(m_time_lock);
+  if (m_present_latency == DT::zero())
+    m_present_latency = latency;
+  else
+    m_present_latency += (latency - m_present_latency) / 16;
 }
 
 void PerformanceMetrics::CountPerformanceMarker(Core::System& system, s64 cyclesLate)
@@ -79,6 +106,18 @@ double PerformanceMetrics::GetLastSpeedDenominator() const
   return DT_s(m_speed_counter.GetLastRawDt()).count() * VideoInterface::GetTargetRefreshRate();
 }
 
+DT PerformanceMetrics::GetThrottleOvershoot() const
+{
+  std::shared_lock lock(m_time_lock);
+  return m_throttle_overshoot;
+}
+
+DT PerformanceMetrics::GetPresentLatency() const
+{
+  std::shared_lock lock(m_time_lock);
+  return m_present_latency;
+}
+
 void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 {
   const float bg_alpha = 0.7f;
@@ -109,7 +148,7 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
   const float graph_height =
       std::min(200.f * backbuffer_scale, ImGui::GetIO().DisplaySize.y - 85.f * backbuffer_scale);
 
-  const bool stack_vertically = !g_ActiveConfig.bShowGraphs;
+  const bool stack_vertically = !g_ActiveConfig.bShowGraphs && !g_ActiveConfig.bShowFrameBreakdown;
 
   ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 0.f);
   ImGui::PushStyleVar(ImGuiStyleVar_WindowRounding, 14.f * backbuffer_scale);
@@ -186,6 +225,77 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     }
   }
 
+  if (g_ActiveConfig.bShowFrameBreakdown)
+  {
+    using FrameTimeBreakdown::HISTORY_SIZE;
+    using FrameTimeBreakdown::NUM_PHASES;
+
+    static std::array<FrameTimeBreakdown::PhaseTimes, HISTORY_SIZE> history;
+    static std::array<float, HISTORY_SIZE> frame_numbers;
+    // The top of each phase's band, with the bottom of the first one in front.
+    static std::array<std::array<float, HISTORY_SIZE>, NUM_PHASES + 1> stacked_times;
+
+    const size_t frames = FrameTimeBreakdown::GetHistory(&history);
+    double max_frame_time = 1000.0 / 59.94;
+    for (size_t frame = 0; frame < frames; ++frame)
+    {
+      frame_numbers[frame] = static_cast<float>(frame);
+      stacked_times[0][frame] = 0.f;
+      for (size_t phase = 0; phase < NUM_PHASES; ++phase)
+      {
+        stacked_times[phase + 1][frame] =
+            stacked_times[phase][frame] + history[frame][phase] / 1000000.f;
+      }
+      max_frame_time = std::max<double>(max_frame_time, stacked_times[NUM_PHASES][frame]);
+    }
+
+    // Grow immediately to fit spikes, but shrink slowly so that the scale doesn't jump around.
+    if (max_frame_time > m_breakdown_max_time)
+      m_breakdown_max_time = max_frame_time;
+    else
+      m_breakdown_max_time += 0.02 * (max_frame_time - m_breakdown_max_time);
+
+    ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 4.f * backbuffer_scale));
+
+    // Position in the top-right corner of the screen, below the performance graphs.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(graph_width, graph_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+    window_y += graph_height + window_padding;
+
+    if (ImGui::Begin("FrameBreakdown", nullptr, imgui_flags))
+    {
+      if (ImPlot::BeginPlot("FrameBreakdown", ImVec2(-1.0, -1.0),
+                            ImPlotFlags_NoFrame | ImPlotFlags_NoTitle | ImPlotFlags_NoMenus))
+      {
+        ImPlot::PushStyleColor(ImPlotCol_PlotBg, {0, 0, 0, 0});
+        ImPlot::PushStyleColor(ImPlotCol_LegendBg, {0, 0, 0, 0.2f});
+        ImPlot::PushStyleVar(ImPlotStyleVar_FitPadding, ImVec2(0.f, 0.f));
+        ImPlot::SetupAxes(nullptr, nullptr,
+                          ImPlotAxisFlags_Lock | ImPlotAxisFlags_NoDecorations |
+                              ImPlotAxisFlags_NoHighlight,
+                          ImPlotAxisFlags_Lock | ImPlotAxisFlags_NoLabel |
+                              ImPlotAxisFlags_NoHighlight);
+        ImPlot::SetupAxisFormat(ImAxis_Y1, "%.1f");
+        ImPlot::SetupAxesLimits(0, HISTORY_SIZE - 1, 0, m_breakdown_max_time * 1.1,
+                                ImGuiCond_Always);
+        ImPlot::SetupLegend(ImPlotLocation_NorthWest, ImPlotLegendFlags_Horizontal);
+        for (size_t phase = 0; phase < NUM_PHASES; ++phase)
+        {
+          ImPlot::PlotShaded(
+              FrameTimeBreakdown::GetPhaseName(static_cast<FrameTimeBreakdown::Phase>(phase)),
+              frame_numbers.data(), stacked_times[phase].data(), stacked_times[phase + 1].data(),
+              static_cast<int>(frames));
+        }
+        ImPlot::EndPlot();
+        ImPlot::PopStyleVar();
+        ImPlot::PopStyleColor(2);
+      }
+      ImGui::End();
+    }
+    ImGui::PopStyleVar();
+  }
+
   if (g_ActiveConfig.bShowSpeed)
   {
     // Position in the top-right corner of the screen.
@@ -210,7 +320,9 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 
   if (g_ActiveConfig.bShowFPS || g_ActiveConfig.bShowFTimes)
   {
-    int count = g_ActiveConfig.bShowFPS + 2 * g_ActiveConfig.bShowFTimes;
+    const DT present_latency = GetPresentLatency();
+    const bool show_present_latency = g_ActiveConfig.bShowFTimes && present_latency != DT::zero();
+    int count = g_ActiveConfig.bShowFPS + 3 * g_ActiveConfig.bShowFTimes + show_present_latency;
     float window_height = (12.f + 17.f * count) * backbuffer_scale;
 
     // Position in the top-right corner of the screen.
@@ -233,6 +345,14 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
                            DT_ms(m_fps_counter.GetDtAvg()).count());
         ImGui::TextColored(ImVec4(r, g, b, 1.0f), " ±:%6.2lfms",
                            DT_ms(m_fps_counter.GetDtStd()).count());
+        // How late the throttle wakes up, which shows up as uneven frame pacing.
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "late:%4.0lfus",
+                           DT_us(GetThrottleOvershoot()).count());
+        if (show_present_latency)
+        {
+          ImGui::TextColored(ImVec4(r, g, b, 1.0f), "lat:%5.2lfms",
+                             DT_ms(present_latency).count());
+        }
       }
       ImGui::End();
     }
@@ -268,5 +388,36 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     }
   }
 
+  if (g_ActiveConfig.bShowTLBStats)
+  {
+    // Only a snapshot, the counters keep being updated by the CPU thread.
+    const PowerPC::TLBStatistics stats = PowerPC::GetTLBStatistics();
+    const double total = std::max<double>(stats.GetTotalLookups(), 1.0);
+    float window_height = (12.f + 17.f * 4) * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(window_width * 1.25f, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= window_width * 1.25f + window_padding;
+
+    if (ImGui::Begin("TLBStats", nullptr, imgui_flags))
+    {
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Way 0:%6.2lf%%",
+                         100.0 * stats.tlb_way_hits[0] / total);
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Way 1:%6.2lf%%",
+                         100.0 * stats.tlb_way_hits[1] / total);
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Cache:%6.2lf%%",
+                         100.0 * stats.translation_cache_hits / total);
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Walk: %6.2lf%%",
+                         100.0 * stats.page_table_walks / total);
+      ImGui::End();
+    }
+  }
+
   ImGui::PopStyleVar(2);
 }
@@ -7,6 +7,7 @@
 #include <shared_mutex>
 
 #include "Common/CommonTypes.h"
+#include "Common/Histogram.h"
 #include "VideoCommon/PerformanceTracker.h"
 
 namespace Core
@@ -17,6 +18,11 @@ class System;
 class PerformanceMetrics
 {
 public:
+  // Upper bounds of the frame time histogram buckets, in microseconds.
+  static constexpr std::array<u64, 9> FRAME_TIME_BUCKETS_US = {
+      8333, 16667, 20000, 25000, 33333, 50000, 66667, 100000, 250000};
+  using FrameTimeHistogram = Common::Histogram<FRAME_TIME_BUCKETS_US.size()>;
+
   PerformanceMetrics() = default;
   ~PerformanceMetrics() = default;
 
@@ -30,7 +36,10 @@ public:
   void CountFrame();
   void CountVBlank();
 
-  void CountThrottleSleep(DT sleep);
+  // overshoot is how long after the throttle deadline the sleep ended.
+  void CountThrottleSleep(DT sleep, DT overshoot);
+  // Time from presenting a frame until the backend reported it as displayed.
+  void CountPresentLatency(DT latency);
   void CountPerformanceMarker(Core::System& system, s64 cyclesLate);
 
   // Getter Functions
@@ -41,6 +50,15 @@ public:
 
   double GetLastSpeedDenominator() const;
 
+  // Moving average of how late throttle sleeps end, which directly adds to frame time jitter.
+  DT GetThrottleOvershoot() const;
+  // Moving average of the present latency, or zero if the backend doesn't report it.
+  DT GetPresentLatency() const;
+
+  // Times between presented frames and between VBlanks, since the last Reset.
+  const FrameTimeHistogram& GetFrameTimeHistogram() const { return m_frame_time_histogram; }
+  const FrameTimeHistogram& GetVBlankTimeHistogram() const { return m_vblank_time_histogram; }
+
   // ImGui Functions
   void DrawImGuiStats(const float backbuffer_scale);
 
@@ -49,7 +67,11 @@ private:
   PerformanceTracker m_vps_counter{"vblank_times.txt"};
   PerformanceTracker m_speed_counter{std::nullopt, 1000000};
 
+  FrameTimeHistogram m_frame_time_histogram{FRAME_TIME_BUCKETS_US};
+  FrameTimeHistogram m_vblank_time_histogram{FRAME_TIME_BUCKETS_US};
+
   double m_graph_max_time = 0.0;
+  double m_breakdown_max_time = 0.0;
 
   mutable std::shared_mutex m_time_lock;
 
@@ -57,6 +79,8 @@ private:
   std::array<TimePoint, 256> m_real_times;
   std::array<TimePoint, 256> m_cpu_times;
   DT m_time_sleeping;
+  DT m_throttle_overshoot;
+  DT m_present_latency;
 };
 
 extern PerformanceMetrics g_perf_metrics;
@@ -924,7 +924,11 @@ ShaderCode GeneratePixelShaderCode(APIType api_type, const ShaderHostConfig& hos
     out.Write("\tfloat4 ocol1;\n");
   }
 
-  if (host_config.backend_geometry_shaders && stereo)
+  if (host_config.backend_multiview)
+  {
+    out.Write("\tint layer = int(gl_ViewIndex);\n");
+  }
+  else if (host_config.backend_geometry_shaders && stereo)
   {
     out.Write("\tint layer = gl_Layer;\n");
   }
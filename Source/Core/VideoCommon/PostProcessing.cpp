@@ -3,6 +3,7 @@
 
 #include "VideoCommon/PostProcessing.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -396,8 +397,6 @@ bool PostProcessing::Initialize(AbstractTextureFormat format)
 
 void PostProcessing::RecompileShader()
 {
-  m_pipeline.reset();
-  m_pixel_shader.reset();
   if (!CompilePixelShader())
     return;
   if (!CompileVertexShader())
@@ -409,6 +408,7 @@ void PostProcessing::RecompileShader()
 void PostProcessing::RecompilePipeline()
 {
   m_pipeline.reset();
+  m_scale_pipeline.reset();
   CompilePipeline();
 }
 
@@ -425,18 +425,71 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
   if (!m_pipeline)
     return;
 
+  // Running the default shader at a lower resolution would only add a pass.
+  const float scale = g_ActiveConfig.fPostProcessingScale;
+  if (scale < 1.0f && m_scale_pipeline && m_config.GetShaderCode() != s_default_shader)
+  {
+    const u32 width = std::max(static_cast<u32>(dst.GetWidth() * scale), 1u);
+    const u32 height = std::max(static_cast<u32>(dst.GetHeight() * scale), 1u);
+    if (EnsureIntermediateTexture(width, height))
+    {
+      AbstractFramebuffer* const output_framebuffer = g_renderer->GetCurrentFramebuffer();
+      g_renderer->SetAndDiscardFramebuffer(m_intermediate_framebuffer.get());
+      Draw(m_pipeline.get(), m_intermediate_texture->GetRect(), src, src_tex, src_layer);
+
+      g_renderer->SetFramebuffer(output_framebuffer);
+      Draw(m_scale_pipeline.get(), dst, m_intermediate_texture->GetRect(),
+           m_intermediate_texture.get(), 0);
+      return;
+    }
+  }
+
+  Draw(m_pipeline.get(), dst, src, src_tex, src_layer);
+}
+
+void PostProcessing::Draw(const AbstractPipeline* pipeline, const MathUtil::Rectangle<int>& dst,
+                          const MathUtil::Rectangle<int>& src, const AbstractTexture* src_tex,
+                          int src_layer)
+{
   FillUniformBuffer(src, src_tex, src_layer);
   g_vertex_manager->UploadUtilityUniforms(m_uniform_staging_buffer.data(),
                                           static_cast<u32>(m_uniform_staging_buffer.size()));
 
   g_renderer->SetViewportAndScissor(
       g_renderer->ConvertFramebufferRectangle(dst, g_renderer->GetCurrentFramebuffer()));
-  g_renderer->SetPipeline(m_pipeline.get());
+  g_renderer->SetPipeline(pipeline);
   g_renderer->SetTexture(0, src_tex);
   g_renderer->SetSamplerState(0, RenderState::GetLinearSamplerState());
   g_renderer->Draw(0, 3);
 }
 
+bool PostProcessing::EnsureIntermediateTexture(u32 width, u32 height)
+{
+  if (m_intermediate_texture && m_intermediate_texture->GetWidth() == width &&
+      m_intermediate_texture->GetHeight() == height &&
+      m_intermediate_texture->GetFormat() == m_framebuffer_format)
+  {
+    return true;
+  }
+
+  m_intermediate_framebuffer.reset();
+  m_intermediate_texture = g_renderer->CreateTexture(
+      TextureConfig(width, height, 1, 1, 1, m_framebuffer_format, AbstractTextureFlag_RenderTarget),
+      "Post-processing intermediate texture");
+  if (!m_intermediate_texture)
+    return false;
+
+  m_intermediate_framebuffer =
+      g_renderer->CreateFramebuffer(m_intermediate_texture.get(), nullptr);
+  if (!m_intermediate_framebuffer)
+  {
+    m_intermediate_texture.reset();
+    return false;
+  }
+
+  return true;
+}
+
 std::string PostProcessing::GetUniformBufferHeader() const
 {
   std::ostringstream ss;
@@ -684,6 +737,8 @@ bool PostProcessing::CompilePixelShader()
 {
   m_pipeline.reset();
   m_pixel_shader.reset();
+  m_scale_pipeline.reset();
+  m_scale_pixel_shader.reset();
 
   // Generate GLSL and compile the new shader.
   m_config.LoadShader(g_ActiveConfig.sPostProcessingShader);
@@ -703,6 +758,11 @@ bool PostProcessing::CompilePixelShader()
       return false;
   }
 
+  // Shares the header, so that its uniform block matches the vertex shader too.
+  m_scale_pixel_shader = g_renderer->CreateShaderFromSource(
+      ShaderStage::Pixel, GetHeader() + s_default_shader + GetFooter(),
+      "Post-processing scale pixel shader");
+
   m_uniform_staging_buffer.resize(CalculateUniformsSize());
   return true;
 }
@@ -726,6 +786,13 @@ bool PostProcessing::CompilePipeline()
   if (!m_pipeline)
     return false;
 
+  // Not being able to scale just means that the shader runs at the output resolution.
+  if (m_scale_pixel_shader)
+  {
+    config.pixel_shader = m_scale_pixel_shader.get();
+    m_scale_pipeline = g_renderer->CreatePipeline(config);
+  }
+
   return true;
 }
 }  // namespace VideoCommon
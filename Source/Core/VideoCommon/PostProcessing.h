@@ -13,6 +13,7 @@
 #include "Common/Timer.h"
 #include "VideoCommon/TextureConfig.h"
 
+class AbstractFramebuffer;
 class AbstractPipeline;
 class AbstractShader;
 class AbstractTexture;
@@ -116,6 +117,10 @@ protected:
   bool CompilePixelShader();
   bool CompilePipeline();
 
+  void Draw(const AbstractPipeline* pipeline, const MathUtil::Rectangle<int>& dst,
+            const MathUtil::Rectangle<int>& src, const AbstractTexture* src_tex, int src_layer);
+  bool EnsureIntermediateTexture(u32 width, u32 height);
+
   size_t CalculateUniformsSize() const;
   void FillUniformBuffer(const MathUtil::Rectangle<int>& src, const AbstractTexture* src_tex,
                          int src_layer);
@@ -128,6 +133,13 @@ protected:
   std::unique_ptr<AbstractShader> m_pixel_shader;
   std::unique_ptr<AbstractPipeline> m_pipeline;
   AbstractTextureFormat m_framebuffer_format = AbstractTextureFormat::Undefined;
+
+  // When the shader runs below the output resolution, it renders to the intermediate texture, which
+  // is then stretched to the output with the default shader.
+  std::unique_ptr<AbstractShader> m_scale_pixel_shader;
+  std::unique_ptr<AbstractPipeline> m_scale_pipeline;
+  std::unique_ptr<AbstractTexture> m_intermediate_texture;
+  std::unique_ptr<AbstractFramebuffer> m_intermediate_framebuffer;
   std::vector<u8> m_uniform_staging_buffer;
 };
 }  // namespace VideoCommon
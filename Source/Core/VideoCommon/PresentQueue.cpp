@@ -0,0 +1,87 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/PresentQueue.h"
+
+#include <utility>
+
+#include "Common/Thread.h"
+
+namespace VideoCommon
+{
+PresentQueue::~PresentQueue()
+{
+  Stop();
+}
+
+void PresentQueue::Start()
+{
+  if (IsRunning())
+    return;
+
+  m_exit = false;
+  m_thread = std::thread(&PresentQueue::ThreadLoop, this);
+}
+
+void PresentQueue::Stop()
+{
+  if (!IsRunning())
+    return;
+
+  {
+    std::unique_lock lk(m_mutex);
+    m_done.wait(lk, [this] { return !m_pending; });
+    m_exit = true;
+  }
+  m_wakeup.notify_one();
+  m_thread.join();
+}
+
+void PresentQueue::Submit(PresentFunction present)
+{
+  if (!IsRunning())
+  {
+    present();
+    return;
+  }
+
+  {
+    std::unique_lock lk(m_mutex);
+    m_done.wait(lk, [this] { return !m_pending; });
+    m_pending = std::move(present);
+  }
+  m_wakeup.notify_one();
+}
+
+void PresentQueue::Wait()
+{
+  if (!IsRunning())
+    return;
+
+  std::unique_lock lk(m_mutex);
+  m_done.wait(lk, [this] { return !m_pending; });
+}
+
+void PresentQueue::ThreadLoop()
+{
+  Common::SetCurrentThreadName("Present thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
+
+  std::unique_lock lk(m_mutex);
+  while (true)
+  {
+    m_wakeup.wait(lk, [this] { return m_pending || m_exit; });
+    if (!m_pending)
+      break;
+
+    // Keep m_pending set while presenting, so waiters block until it completes.
+    PresentFunction present = m_pending;
+    lk.unlock();
+    present();
+    lk.lock();
+
+    m_pending = nullptr;
+    m_done.notify_all();
+  }
+}
+}  // namespace VideoCommon
@@ -0,0 +1,53 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace VideoCommon
+{
+// Runs swap chain presents on a separate thread.
+//
+// With vsync enabled, presenting blocks until the display is ready for another frame, and doing
+// that on the GPU thread stalls FIFO processing for the next frame. Backends whose present call
+// is safe to make from another thread can hand it off here instead. At most one present is in
+// flight: submitting another one waits for the previous one to complete, and backends must call
+// Wait() before touching the swap chain (acquiring the next buffer, resizing, destroying it).
+class PresentQueue final
+{
+public:
+  using PresentFunction = std::function<void()>;
+
+  PresentQueue() = default;
+  ~PresentQueue();
+
+  PresentQueue(const PresentQueue&) = delete;
+  PresentQueue& operator=(const PresentQueue&) = delete;
+
+  void Start();
+  // Waits for the pending present, if any, then stops the thread.
+  void Stop();
+
+  bool IsRunning() const { return m_thread.joinable(); }
+
+  // Presents on the thread, or immediately when it isn't running.
+  void Submit(PresentFunction present);
+
+  // Blocks until the pending present, if any, has completed.
+  void Wait();
+
+private:
+  void ThreadLoop();
+
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::condition_variable m_done;
+  PresentFunction m_pending;
+  bool m_exit = false;
+};
+}  // namespace VideoCommon
@@ -51,6 +51,7 @@
 #include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/Host.h"
+#include "Core/MetricsExporter.h"
 #include "Core/Movie.h"
 #include "Core/System.h"
 
@@ -65,6 +66,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/FrameDump.h"
+#include "VideoCommon/FrameTimeBreakdown.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/FreeLookCamera.h"
@@ -164,6 +166,7 @@ void Renderer::Shutdown()
   // First stop any framedumping, which might need to dump the last xfb frame. This process
   // can require additional graphics sub-systems so it needs to be done first
   ShutdownFrameDumping();
+  m_present_queue.Stop();
   ShutdownImGui();
   m_post_processor.reset();
   m_bounding_box.reset();
@@ -394,24 +397,34 @@ std::tuple<int, int> Renderer::CalculateTargetScale(int x, int y) const
   return std::make_tuple(x * static_cast<int>(m_efb_scale), y * static_cast<int>(m_efb_scale));
 }
 
-// return true if target size changed
-bool Renderer::CalculateTargetSize()
+unsigned int Renderer::CalculateConfiguredEFBScale() const
 {
+  unsigned int scale;
   if (g_ActiveConfig.iEFBScale == EFB_SCALE_AUTO_INTEGRAL)
   {
     // Set a scale based on the window size
     int width = EFB_WIDTH * m_target_rectangle.GetWidth() / m_last_xfb_width;
     int height = EFB_HEIGHT * m_target_rectangle.GetHeight() / m_last_xfb_height;
-    m_efb_scale = std::max((width - 1) / EFB_WIDTH + 1, (height - 1) / EFB_HEIGHT + 1);
+    scale = std::max((width - 1) / EFB_WIDTH + 1, (height - 1) / EFB_HEIGHT + 1);
   }
   else
   {
-    m_efb_scale = g_ActiveConfig.iEFBScale;
+    scale = g_ActiveConfig.iEFBScale;
   }
 
   const u32 max_size = g_ActiveConfig.backend_info.MaxTextureSize;
-  if (max_size < EFB_WIDTH * m_efb_scale)
-    m_efb_scale = max_size / EFB_WIDTH;
+  if (max_size < EFB_WIDTH * scale)
+    scale = max_size / EFB_WIDTH;
+
+  return scale;
+}
+
+// return true if target size changed
+bool Renderer::CalculateTargetSize()
+{
+  m_efb_scale = CalculateConfiguredEFBScale();
+  if (m_dynamic_efb_scale != 0)
+    m_efb_scale = std::min(m_efb_scale, m_dynamic_efb_scale);
 
   auto [new_efb_width, new_efb_height] = CalculateTargetScale(EFB_WIDTH, EFB_HEIGHT);
   new_efb_width = std::max(new_efb_width, 1);
@@ -490,6 +503,8 @@ void Renderer::CheckForConfigChanges()
       g_ActiveConfig.graphics_mod_config ? g_ActiveConfig.graphics_mod_config->GetChangeCount() : 0;
   const bool old_graphics_mods_enabled = g_ActiveConfig.bGraphicMods;
 
+  // The present thread reads the vsync setting.
+  m_present_queue.Wait();
   UpdateActiveConfig();
   FreeLook::UpdateActiveConfig();
   g_vertex_manager->OnConfigChange();
@@ -706,6 +721,99 @@ void Renderer::AdjustRectanglesToFitBounds(MathUtil::Rectangle<int>* target_rect
   }
 }
 
+void Renderer::UpdateFastForwardFrameSkip()
+{
+  // Dumped frames must all be rendered.
+  if (!g_ActiveConfig.bFastForwardFrameSkipActive || IsFrameDumping())
+  {
+    m_fast_forward_frame = 0;
+    m_skip_frame_draws = false;
+    return;
+  }
+
+  // The last frame of every period is always rendered, so that there is something to look at.
+  const u32 period = std::max(g_ActiveConfig.iFastForwardFramePeriod, 2u);
+  const u32 skipped_frames = std::min(g_ActiveConfig.iFastForwardSkippedFrames, period - 1);
+  m_fast_forward_frame = (m_fast_forward_frame + 1) % period;
+  m_skip_frame_draws = m_fast_forward_frame < skipped_frames;
+}
+
+void Renderer::UpdateDynamicEFBScale(double last_speed)
+{
+  // Dumped frames should all have the configured resolution.
+  if (!g_ActiveConfig.bDynamicEFBScale || IsFrameDumping())
+  {
+    m_dynamic_efb_scale = 0;
+    m_dynamic_efb_frames = 0;
+    m_dynamic_efb_speed_sum = 0.0;
+    m_dynamic_efb_headroom_windows = 0;
+    return;
+  }
+
+  // Half a second at 60 FPS. Short enough to react to a demanding scene, long enough that a
+  // single slow frame (e.g. a shader compile) doesn't count.
+  constexpr u32 WINDOW_FRAMES = 30;
+  // Raising the scale needs this many good windows in a row, so that it doesn't flip back and forth
+  // around the point where the GPU just keeps up.
+  constexpr u32 HEADROOM_WINDOWS = 6;
+
+  m_dynamic_efb_speed_sum += last_speed;
+  if (++m_dynamic_efb_frames < WINDOW_FRAMES)
+    return;
+
+  const double speed = m_dynamic_efb_speed_sum / m_dynamic_efb_frames;
+  m_dynamic_efb_frames = 0;
+  m_dynamic_efb_speed_sum = 0.0;
+
+  const FrameTimeBreakdown::PhaseTimes totals = FrameTimeBreakdown::GetTotals();
+  FrameTimeBreakdown::PhaseTimes window;
+  u64 window_total = 0;
+  for (size_t i = 0; i < FrameTimeBreakdown::NUM_PHASES; ++i)
+  {
+    window[i] = totals[i] - m_dynamic_efb_last_totals[i];
+    window_total += window[i];
+  }
+  m_dynamic_efb_last_totals = totals;
+  if (window_total == 0)
+    return;
+
+  const auto share = [&](FrameTimeBreakdown::Phase phase) {
+    return static_cast<double>(window[static_cast<size_t>(phase)]) / window_total;
+  };
+  // Time spent waiting for the GPU to finish or to accept more work means the GPU is the limit.
+  const double gpu_bound_share =
+      share(FrameTimeBreakdown::Phase::GPUWait) + share(FrameTimeBreakdown::Phase::Submit);
+  const double throttle_share = share(FrameTimeBreakdown::Phase::Throttle);
+
+  // The scale the user asked for is never exceeded.
+  const u32 current_scale = m_efb_scale;
+  const u32 max_scale = std::max(CalculateConfiguredEFBScale(), 1u);
+  const u32 min_scale =
+      std::clamp(static_cast<u32>(std::max(g_ActiveConfig.iDynamicEFBScaleMin, 1)), 1u, max_scale);
+
+  if (speed < 0.97 && gpu_bound_share > 0.1 && current_scale > min_scale)
+  {
+    m_dynamic_efb_scale = current_scale - 1;
+    m_dynamic_efb_headroom_windows = 0;
+    INFO_LOG_FMT(VIDEO, "Dynamic resolution: lowering the internal resolution to {}x",
+                 m_dynamic_efb_scale);
+  }
+  else if (speed >= 0.99 && throttle_share > 0.25 && current_scale < max_scale)
+  {
+    if (++m_dynamic_efb_headroom_windows < HEADROOM_WINDOWS)
+      return;
+
+    m_dynamic_efb_scale = current_scale + 1 < max_scale ? current_scale + 1 : 0;
+    m_dynamic_efb_headroom_windows = 0;
+    INFO_LOG_FMT(VIDEO, "Dynamic resolution: raising the internal resolution to {}x",
+                 current_scale + 1);
+  }
+  else
+  {
+    m_dynamic_efb_headroom_windows = 0;
+  }
+}
+
 bool Renderer::IsHeadless() const
 {
   return true;
@@ -1345,10 +1453,10 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
       m_is_game_widescreen = true;
   }
 
-  // Ensure the last frame was written to the dump.
-  // This is required even if frame dumping has stopped, since the frame dump is one frame
+  // Send any frames whose readback has completed to the dump.
+  // This is required even if frame dumping has stopped, since the frame dump runs a few frames
   // behind the renderer.
-  FlushFrameDump();
+  FlushFrameDump(false);
 
   if (g_ActiveConfig.bGraphicMods)
   {
@@ -1386,7 +1494,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
 
       // Render the XFB to the screen.
       BeginUtilityDrawing();
-      if (!IsHeadless())
+      if (!IsHeadless() && !m_skip_frame_draws)
       {
         BindBackbuffer({{0.0f, 0.0f, 0.0f, 1.0f}});
 
@@ -1406,6 +1514,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
 
         // Present to the window system.
         {
+          FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::Submit);
           std::lock_guard<std::mutex> guard(m_swap_mutex);
           PresentBackbuffer();
         }
@@ -1422,6 +1531,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
         perf_sample.num_prims = g_stats.this_frame.num_prims + g_stats.this_frame.num_dl_prims;
         perf_sample.num_draw_calls = g_stats.this_frame.num_draw_calls;
         DolphinAnalytics::Instance().ReportPerformanceInfo(std::move(perf_sample));
+        MetricsExporter::UpdateVideoMetrics();
 
         if (IsFrameDumping())
           DumpCurrentFrame(xfb_entry->texture.get(), xfb_rect, ticks, m_frame_count);
@@ -1447,10 +1557,21 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
       }
       else
       {
-        // Flush any outstanding EFB copies to RAM, in case the game is running at an uncapped frame
+        // Flush outstanding EFB copies to RAM, in case the game is running at an uncapped frame
         // rate and not waiting for vblank. Otherwise, we'd end up with a huge list of pending
-        // copies.
-        g_texture_cache->FlushEFBCopies();
+        // copies. Copies the GPU hasn't finished yet are kept until the end of the next frame at
+        // the latest, so that we don't have to wait for them here. That makes when the copies
+        // reach RAM depend on the host GPU, so all of them are flushed when that matters.
+        auto& system = Core::System::GetInstance();
+        if (Core::WantsDeterminism() || !system.IsDualCoreMode() ||
+            Config::Get(Config::MAIN_SYNC_GPU))
+        {
+          g_texture_cache->FlushEFBCopies();
+        }
+        else
+        {
+          g_texture_cache->FlushCompletedEFBCopies();
+        }
       }
 
       if (!is_duplicate_frame)
@@ -1462,12 +1583,16 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
         const double last_speed =
             last_speed_denominator > 0.0 ? (1.0 / last_speed_denominator) : 1.0;
         Core::Callback_FramePresented(last_speed);
+        UpdateDynamicEFBScale(last_speed);
       }
 
       // Handle any config changes, this gets propagated to the backend.
       CheckForConfigChanges();
       g_Config.iSaveTargetId = 0;
 
+      if (!is_duplicate_frame)
+        UpdateFastForwardFrameSkip();
+
       EndUtilityDrawing();
     }
     else
@@ -1548,13 +1673,20 @@ void Renderer::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  // If every buffer is in flight, the oldest one has to be sent to the encoder before reuse.
+  FrameDumpBuffer& buffer = m_frame_dump_buffers[m_frame_dump_write_index];
+  if (buffer.copy_pending)
+    DumpFrameData();
+  WaitForFrameDumpBuffer(buffer);
+
+  if (!CheckFrameDumpReadbackTexture(buffer.readback_texture, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_frame_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  buffer.readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
+                                           buffer.readback_texture->GetRect());
+  buffer.state = m_frame_dump.FetchState(ticks, frame_number);
+  buffer.copy_pending = true;
+  m_frame_dump_write_index = (m_frame_dump_write_index + 1) % NUM_FRAME_DUMP_BUFFERS;
 }
 
 bool Renderer::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -1584,9 +1716,9 @@ bool Renderer::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
   return true;
 }
 
-bool Renderer::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool Renderer::CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& rbtex,
+                                             u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -1600,45 +1732,34 @@ bool Renderer::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height
   return true;
 }
 
-void Renderer::FlushFrameDump()
+void Renderer::FlushFrameDump(bool wait_for_all)
 {
-  if (!m_frame_dump_needs_flush)
-    return;
-
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
-
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
-
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
-  output->Flush();
-  if (output->Map())
+  // Frames have to be encoded in order, so stop at the first copy which is still running.
+  while (m_frame_dump_buffers[m_frame_dump_read_index].copy_pending)
   {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
-  }
-  else
-  {
-    ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
-  }
+    if (!wait_for_all &&
+        !m_frame_dump_buffers[m_frame_dump_read_index].readback_texture->IsCopyComplete())
+    {
+      break;
+    }
 
-  m_frame_dump_needs_flush = false;
+    DumpFrameData();
+  }
 
   // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
+  if (!wait_for_all && !IsFrameDumping())
     ShutdownFrameDumping();
 }
 
 void Renderer::ShutdownFrameDumping()
 {
-  // Ensure the last queued readback has been sent to the encoder.
-  FlushFrameDump();
+  // Ensure all queued readbacks have been sent to the encoder.
+  FlushFrameDump(true);
 
   if (!m_frame_dump_thread_running.IsSet())
     return;
 
-  // Ensure previous frame has been encoded.
+  // Ensure previous frames have been encoded.
   FinishFrameData();
 
   // Wake thread up, and wait for it to exit.
@@ -1649,13 +1770,34 @@ void Renderer::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  m_frame_dump_buffers = {};
+  m_frame_dump_write_index = 0;
+  m_frame_dump_read_index = 0;
 }
 
-void Renderer::DumpFrameData(const u8* data, int w, int h, int stride)
+void Renderer::DumpFrameData()
 {
-  m_frame_dump_data = FrameDump::FrameData{data, w, h, stride, m_last_frame_state};
+  const u32 index = m_frame_dump_read_index;
+  FrameDumpBuffer& buffer = m_frame_dump_buffers[index];
+  m_frame_dump_read_index = (m_frame_dump_read_index + 1) % NUM_FRAME_DUMP_BUFFERS;
+  buffer.copy_pending = false;
+
+  auto& output = buffer.readback_texture;
+  output->Flush();
+  if (!output->Map())
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    return;
+  }
+
+  buffer.data = FrameDump::FrameData{reinterpret_cast<u8*>(output->GetMappedPointer()),
+                                     output->GetConfig().width, output->GetConfig().height,
+                                     static_cast<int>(output->GetMappedStride()), buffer.state};
+  {
+    std::lock_guard<std::mutex> lk(m_frame_dump_queue_lock);
+    buffer.encoding = true;
+    m_frame_dump_queue.push_back(index);
+  }
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -1667,23 +1809,34 @@ void Renderer::DumpFrameData(const u8* data, int w, int h, int stride)
 
   // Wake worker thread up.
   m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
 }
 
-void Renderer::FinishFrameData()
+void Renderer::WaitForFrameDumpBuffer(FrameDumpBuffer& buffer)
 {
-  if (!m_frame_dump_frame_running)
-    return;
+  while (true)
+  {
+    {
+      std::lock_guard<std::mutex> lk(m_frame_dump_queue_lock);
+      if (!buffer.encoding)
+        break;
+    }
+    m_frame_dump_done.Wait();
+  }
 
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+  if (buffer.readback_texture && buffer.readback_texture->IsMapped())
+    buffer.readback_texture->Unmap();
+}
 
-  m_frame_dump_output_texture->Unmap();
+void Renderer::FinishFrameData()
+{
+  for (FrameDumpBuffer& buffer : m_frame_dump_buffers)
+    WaitForFrameDumpBuffer(buffer);
 }
 
 void Renderer::FrameDumpThreadFunc()
 {
   Common::SetCurrentThreadName("FrameDumping");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
 
   bool dump_to_ffmpeg = !g_ActiveConfig.bDumpFramesAsImages;
   bool frame_dump_started = false;
@@ -1704,46 +1857,62 @@ void Renderer::FrameDumpThreadFunc()
     if (!m_frame_dump_thread_running.IsSet())
       break;
 
-    auto frame = m_frame_dump_data;
-
-    // Save screenshot
-    if (m_screenshot_request.TestAndClear())
+    while (true)
     {
-      std::lock_guard<std::mutex> lk(m_screenshot_lock);
+      u32 index;
+      FrameDump::FrameData frame;
+      {
+        std::lock_guard<std::mutex> lk(m_frame_dump_queue_lock);
+        if (m_frame_dump_queue.empty())
+          break;
+        index = m_frame_dump_queue.front();
+        m_frame_dump_queue.pop_front();
+        frame = m_frame_dump_buffers[index].data;
+      }
 
-      if (DumpFrameToPNG(frame, m_screenshot_name))
-        OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
+      // Save screenshot
+      if (m_screenshot_request.TestAndClear())
+      {
+        std::lock_guard<std::mutex> lk(m_screenshot_lock);
 
-      // Reset settings
-      m_screenshot_name.clear();
-      m_screenshot_completed.Set();
-    }
+        if (DumpFrameToPNG(frame, m_screenshot_name))
+          OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
 
-    if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES))
-    {
-      if (!frame_dump_started)
-      {
-        if (dump_to_ffmpeg)
-          frame_dump_started = StartFrameDumpToFFMPEG(frame);
-        else
-          frame_dump_started = StartFrameDumpToImage(frame);
+        // Reset settings
+        m_screenshot_name.clear();
+        m_screenshot_completed.Set();
+      }
 
-        // Stop frame dumping if we fail to start.
+      if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES))
+      {
         if (!frame_dump_started)
-          Config::SetCurrent(Config::MAIN_MOVIE_DUMP_FRAMES, false);
+        {
+          if (dump_to_ffmpeg)
+            frame_dump_started = StartFrameDumpToFFMPEG(frame);
+          else
+            frame_dump_started = StartFrameDumpToImage(frame);
+
+          // Stop frame dumping if we fail to start.
+          if (!frame_dump_started)
+            Config::SetCurrent(Config::MAIN_MOVIE_DUMP_FRAMES, false);
+        }
+
+        // If we failed to start frame dumping, don't write a frame.
+        if (frame_dump_started)
+        {
+          if (dump_to_ffmpeg)
+            DumpFrameToFFMPEG(frame);
+          else
+            DumpFrameToImage(frame);
+        }
       }
 
-      // If we failed to start frame dumping, don't write a frame.
-      if (frame_dump_started)
       {
-        if (dump_to_ffmpeg)
-          DumpFrameToFFMPEG(frame);
-        else
-          DumpFrameToImage(frame);
+        std::lock_guard<std::mutex> lk(m_frame_dump_queue_lock);
+        m_frame_dump_buffers[index].encoding = false;
       }
+      m_frame_dump_done.Set();
     }
-
-    m_frame_dump_done.Set();
   }
 
   if (frame_dump_started)
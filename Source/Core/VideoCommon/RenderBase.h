@@ -14,6 +14,7 @@
 #pragma once
 
 #include <array>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,8 +30,10 @@
 #include "VideoCommon/AsyncShaderCompiler.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FrameDump.h"
+#include "VideoCommon/FrameTimeBreakdown.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 #include "VideoCommon/PerformanceMetrics.h"
+#include "VideoCommon/PresentQueue.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/TextureConfig.h"
 
@@ -229,6 +232,10 @@ public:
   // Finish up the current frame, print some stats
   void Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks);
 
+  // True while fast-forwarding through a frame whose draws are skipped and which won't be
+  // presented. The FIFO is still processed for these frames.
+  bool IsSkippingFrameDraws() const { return m_skip_frame_draws; }
+
   void UpdateWidescreenHeuristic();
 
   // Draws the specified XFB buffer to the screen, performing any post-processing.
@@ -287,6 +294,8 @@ protected:
   };
 
   std::tuple<int, int> CalculateTargetScale(int x, int y) const;
+  // The EFB scale from the config, before dynamic resolution lowers it.
+  unsigned int CalculateConfiguredEFBScale() const;
   bool CalculateTargetSize();
 
   void CheckForConfigChanges();
@@ -346,6 +355,9 @@ protected:
   Common::Flag m_surface_resized;
   std::mutex m_swap_mutex;
 
+  // Used by backends which present from a separate thread.
+  VideoCommon::PresentQueue m_present_queue;
+
   // ImGui resources.
   std::unique_ptr<NativeVertexFormat> m_imgui_vertex_format;
   std::vector<std::unique_ptr<AbstractTexture>> m_imgui_textures;
@@ -374,23 +386,34 @@ private:
   // Set by frame dump thread on frame completion.
   Common::Event m_frame_dump_done;
 
-  // Holds emulation state during the last swap when dumping.
-  FrameDump::FrameState m_last_frame_state;
-
-  // Communication of frame between video and dump threads.
-  FrameDump::FrameData m_frame_dump_data;
-
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+  // Frames are read back through a ring of staging textures, so neither the GPU copy nor the
+  // encoder has to finish within a single frame. The video thread only waits when every buffer
+  // is still in use.
+  static constexpr u32 NUM_FRAME_DUMP_BUFFERS = 3;
+  struct FrameDumpBuffer
+  {
+    std::unique_ptr<AbstractStagingTexture> readback_texture;
+    // Emulation state during the swap which filled this buffer.
+    FrameDump::FrameState state;
+    // Mapped frame handed to the dump thread.
+    FrameDump::FrameData data;
+    // Set when the GPU copy has been queued, but the frame hasn't been sent to the dump thread.
+    bool copy_pending = false;
+    // Set while the dump thread owns the mapped texture. Protected by m_frame_dump_queue_lock.
+    bool encoding = false;
+  };
+  std::array<FrameDumpBuffer, NUM_FRAME_DUMP_BUFFERS> m_frame_dump_buffers;
+  // Next buffer to copy a frame into, and the oldest buffer with a pending copy.
+  u32 m_frame_dump_write_index = 0;
+  u32 m_frame_dump_read_index = 0;
+
+  // Buffers waiting to be encoded, in presentation order.
+  std::mutex m_frame_dump_queue_lock;
+  std::deque<u32> m_frame_dump_queue;
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
@@ -403,6 +426,19 @@ private:
   u32 m_last_xfb_stride = 0;
   u32 m_last_xfb_height = 0;
 
+  // Position of the current frame in the fast-forward frame skip period.
+  u32 m_fast_forward_frame = 0;
+  bool m_skip_frame_draws = false;
+
+  // Upper bound on the EFB scale set by dynamic resolution, or 0 if it's not limiting it.
+  u32 m_dynamic_efb_scale = 0;
+  // Measurements of the current dynamic resolution window.
+  u32 m_dynamic_efb_frames = 0;
+  double m_dynamic_efb_speed_sum = 0.0;
+  FrameTimeBreakdown::PhaseTimes m_dynamic_efb_last_totals{};
+  // Number of windows in a row which had enough headroom to raise the scale again.
+  u32 m_dynamic_efb_headroom_windows = 0;
+
   std::unique_ptr<BoundingBox> m_bounding_box;
 
   // Nintendo's SDK seems to write "default" bounding box values before every draw (1023 0 1023 0
@@ -430,21 +466,33 @@ private:
 
   bool IsFrameDumping() const;
 
+  // Decides whether the draws of the next frame are skipped.
+  void UpdateFastForwardFrameSkip();
+
+  // Adjusts the dynamic resolution limit from the speed and frame time breakdown of the last
+  // frames. The new scale takes effect on the next CheckForConfigChanges().
+  void UpdateDynamicEFBScale(double last_speed);
+
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
   // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  bool CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& rbtex,
+                                     u32 target_width, u32 target_height);
 
   // Fills the frame dump staging texture with the current XFB texture.
   void DumpCurrentFrame(const AbstractTexture* src_texture,
                         const MathUtil::Rectangle<int>& src_rect, u64 ticks, int frame_number);
 
-  // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  // Waits for the oldest pending readback, and queues it for encoding on the dump thread.
+  void DumpFrameData();
+
+  // Queues rendered frames whose readback has completed for encoding. If wait_for_all is set,
+  // waits for and queues every rendered frame.
+  void FlushFrameDump(bool wait_for_all);
 
-  // Ensures all rendered frames are queued for encoding.
-  void FlushFrameDump();
+  // Waits for the dump thread to finish encoding from the buffer, and releases its mapping.
+  void WaitForFrameDumpBuffer(FrameDumpBuffer& buffer);
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
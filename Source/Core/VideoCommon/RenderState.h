@@ -69,6 +69,7 @@ union FramebufferState
   BitField<8, 8, AbstractTextureFormat> depth_texture_format;
   BitField<16, 8, u32> samples;
   BitField<24, 1, u32> per_sample_shading;
+  BitField<25, 1, u32> multiview;
 
   u32 hex;
 };
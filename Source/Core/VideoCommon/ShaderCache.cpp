@@ -3,15 +3,19 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <cstring>
+
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Trace.h"
 #include "Core/ConfigManager.h"
 
 #include "VideoCommon/ConstantManager.h"
 #include "VideoCommon/DriverDetails.h"
+#include "VideoCommon/FrameTimeBreakdown.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/RenderBase.h"
@@ -74,6 +78,9 @@ void ShaderCache::InitializeShaderCache()
 
 void ShaderCache::Reload()
 {
+  // Anything which hasn't started compiling yet was queued for the old configuration, and would
+  // be thrown away below. Only wait for the work that is already in progress.
+  m_async_shader_compiler->CancelPendingWork();
   WaitForAsyncCompiler();
   ClosePipelineUIDCache();
   ClearCaches();
@@ -101,6 +108,11 @@ void ShaderCache::RetrieveAsyncShaders()
   m_async_shader_compiler->RetrieveWorkItems();
 }
 
+size_t ShaderCache::GetPendingAsyncCompileCount() const
+{
+  return m_async_shader_compiler->GetPendingWorkCount();
+}
+
 void ShaderCache::Shutdown()
 {
   // This may leave shaders uncommitted to the cache, but it's better than blocking shutdown
@@ -111,12 +123,104 @@ void ShaderCache::Shutdown()
   ClosePipelineUIDCache();
 }
 
-const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
+/// Clears render state which has no effect with the rest of the state
+static void CanonicalizeRenderState(DepthState& depth, BlendingState& blend)
+{
+  // The comparison function and depth writes are ignored when the depth test is disabled.
+  if (!depth.testenable)
+    depth.hex = 0;
+
+  if (!blend.blendenable)
+  {
+    blend.subtract = false;
+    blend.subtractAlpha = false;
+    blend.srcfactor = SrcBlendFactor::Zero;
+    blend.dstfactor = DstBlendFactor::Zero;
+    blend.srcfactoralpha = SrcBlendFactor::Zero;
+    blend.dstfactoralpha = DstBlendFactor::Zero;
+  }
+  if (!blend.logicopenable)
+    blend.logicmode = LogicOp::Clear;
+}
+
+/// Clears UID bits which do not affect the generated shaders or pipeline, so that pipelines which
+/// only differ in these bits share a single compiled pipeline.
+static GXPipelineUid CanonicalizePipelineUid(const GXPipelineUid& in)
+{
+  GXPipelineUid out;
+  memcpy(&out, &in, sizeof(out));  // copy padding
+
+  vertex_shader_uid_data* vs = out.vs_uid.GetUidData();
+  bool has_regular_texgen = false;
+  for (u32 i = 0; i < vs->numTexGens; i++)
+  {
+    // Only regular texgens use the source row and input form; other types read earlier outputs.
+    auto& texinfo = vs->texMtxInfo[i];
+    if (texinfo.texgentype == TexGenType::Regular)
+    {
+      has_regular_texgen = true;
+      continue;
+    }
+
+    texinfo.sourcerow = SourceRow::Geom;
+    texinfo.inputform = TexInputForm::AB11;
+  }
+  if (!has_regular_texgen)
+    vs->dualTexTrans_enabled = false;
+
+  pixel_shader_uid_data* ps = out.ps_uid.GetUidData();
+  if (ps->fog_fsel == FogType::Off)
+  {
+    ps->fog_proj = FogProjection::Perspective;
+    ps->fog_RangeBaseEnabled = false;
+
+    // The z texture result is only used for per-pixel depth and fog.
+    if (!ps->per_pixel_depth)
+      ps->ztex_op = ZTexOp::Disabled;
+  }
+
+  // Pass-through geometry shaders are never compiled.
+  geometry_shader_uid_data* gs = out.gs_uid.GetUidData();
+  if (gs->IsPassthrough())
+    gs->numTexGens = 0;
+
+  CanonicalizeRenderState(out.depth_state, out.blending_state);
+  return out;
+}
+
+static GXUberPipelineUid CanonicalizePipelineUid(const GXUberPipelineUid& in)
+{
+  GXUberPipelineUid out;
+  memcpy(&out, &in, sizeof(out));  // Copy padding
+  CanonicalizeRenderState(out.depth_state, out.blending_state);
+  return out;
+}
+
+template <typename UidType, typename CacheType>
+UidType ShaderCache::CanonicalizeAndCount(const UidType& uid, const CacheType& cache,
+                                          std::set<UidType>& seen_uids)
+{
+  UidType canonical_uid = CanonicalizePipelineUid(uid);
+  if (canonical_uid == uid)
+    return canonical_uid;
+
+  // The first time a UID is seen which maps to an already-existing pipeline, we would have
+  // compiled a duplicate pipeline for it.
+  if (seen_uids.insert(uid).second && cache.find(canonical_uid) != cache.end())
+    INCSTAT(g_stats.num_pipelines_deduplicated);
+
+  return canonical_uid;
+}
+
+const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid_in)
 {
+  const GXPipelineUid uid =
+      CanonicalizeAndCount(uid_in, m_gx_pipeline_cache, m_gx_pipeline_canonicalized_uids);
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
 
+  FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::ShaderCompile);
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
@@ -127,8 +231,11 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
   return InsertGXPipeline(uid, std::move(pipeline));
 }
 
-std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
+std::optional<const AbstractPipeline*>
+ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid_in)
 {
+  const GXPipelineUid uid =
+      CanonicalizeAndCount(uid_in, m_gx_pipeline_cache, m_gx_pipeline_canonicalized_uids);
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
@@ -144,12 +251,15 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
   return {};
 }
 
-const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
+const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid_in)
 {
+  const GXUberPipelineUid uid = CanonicalizeAndCount(uid_in, m_gx_uber_pipeline_cache,
+                                                     m_gx_uber_pipeline_canonicalized_uids);
   auto it = m_gx_uber_pipeline_cache.find(uid);
   if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
 
+  FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::ShaderCompile);
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
@@ -369,6 +479,15 @@ void ShaderCache::LoadCaches()
                                                           true);
     LoadShaderCache<ShaderStage::Pixel, PixelShaderUid>(m_ps_cache, m_api_type, "specialized-ps",
                                                         true);
+
+    // Consulted before compiling specialized shaders the game's own cache doesn't have.
+    if (g_ActiveConfig.bSharedShaderCache)
+    {
+      std::string directory = GetDiskShaderCacheFileName(m_api_type, "shared", false, true);
+      directory.replace(directory.size() - std::strlen(".cache"), std::string::npos, "/");
+      m_shared_shader_store.Open(std::move(directory), SConfig::GetInstance().GetGameID(),
+                                 static_cast<u64>(g_ActiveConfig.iSharedShaderCacheSize) << 20);
+    }
   }
 
   if (g_ActiveConfig.backend_info.bSupportsPipelineCacheData)
@@ -391,6 +510,7 @@ void ShaderCache::ClearCaches()
   ClearPipelineCache(m_gx_uber_pipeline_cache, m_gx_uber_pipeline_disk_cache);
   ClearShaderCache(m_uber_vs_cache);
   ClearShaderCache(m_uber_ps_cache);
+  m_shared_shader_store.Close();
 
   m_screen_quad_vertex_shader.reset();
   m_texture_copy_vertex_shader.reset();
@@ -413,15 +533,29 @@ void ShaderCache::ClearCaches()
   SETSTAT(g_stats.num_pixel_shaders_alive, 0);
   SETSTAT(g_stats.num_vertex_shaders_created, 0);
   SETSTAT(g_stats.num_vertex_shaders_alive, 0);
+  SETSTAT(g_stats.num_pipelines_created, 0);
+  SETSTAT(g_stats.num_uber_pipelines_created, 0);
+  SETSTAT(g_stats.num_pipelines_deduplicated, 0);
+  m_gx_pipeline_canonicalized_uids.clear();
+  m_gx_uber_pipeline_canonicalized_uids.clear();
 }
 
 void ShaderCache::CompileMissingPipelines()
 {
-  // Queue all uids with a null pipeline for compilation.
+  // Queue all uids with a null pipeline for compilation, in the order the game first needed them,
+  // so that the pipelines needed soonest after boot are the first ones ready. Anything missing
+  // from the recorded order goes at the end.
+  u32 priority = COMPILE_PRIORITY_SHADERCACHE_PIPELINE;
+  for (const GXPipelineUid& uid : m_gx_pipeline_uid_order)
+  {
+    auto it = m_gx_pipeline_cache.find(uid);
+    if (it != m_gx_pipeline_cache.end() && !it->second.first && !it->second.second)
+      QueuePipelineCompile(uid, priority++);
+  }
   for (auto& it : m_gx_pipeline_cache)
   {
-    if (!it.second.first)
-      QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+    if (!it.second.first && !it.second.second)
+      QueuePipelineCompile(it.first, priority);
   }
   for (auto& it : m_gx_uber_pipeline_cache)
   {
@@ -430,8 +564,36 @@ void ShaderCache::CompileMissingPipelines()
   }
 }
 
+template <typename Uid>
+std::unique_ptr<AbstractShader> ShaderCache::LoadSharedShader(ShaderStage stage,
+                                                              const Uid& uid) const
+{
+  if (!m_shared_shader_store.IsOpen())
+    return nullptr;
+
+  const std::vector<u8> binary =
+      m_shared_shader_store.Lookup(static_cast<u32>(stage), &uid, sizeof(uid));
+  if (binary.empty())
+    return nullptr;
+
+  return g_renderer->CreateShaderFromBinary(stage, binary.data(), binary.size());
+}
+
+template <typename Uid>
+void ShaderCache::StoreSharedShader(ShaderStage stage, const Uid& uid,
+                                    const std::vector<u8>& binary)
+{
+  m_shared_shader_store.Insert(static_cast<u32>(stage), &uid, sizeof(uid), binary.data(),
+                               static_cast<u32>(binary.size()));
+}
+
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
 {
+  TRACE_ZONE("ShaderCache::CompileVertexShader");
+
+  if (auto shader = LoadSharedShader(ShaderStage::Vertex, uid))
+    return shader;
+
   const ShaderCode source_code =
       GenerateVertexShaderCode(m_api_type, m_host_config, uid.GetUidData());
   return g_renderer->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer());
@@ -440,6 +602,8 @@ std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexSha
 std::unique_ptr<AbstractShader>
 ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) const
 {
+  TRACE_ZONE("ShaderCache::CompileVertexUberShader");
+
   const ShaderCode source_code =
       UberShader::GenVertexShader(m_api_type, m_host_config, uid.GetUidData());
   return g_renderer->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer(),
@@ -448,6 +612,11 @@ ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) con
 
 std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShaderUid& uid) const
 {
+  TRACE_ZONE("ShaderCache::CompilePixelShader");
+
+  if (auto shader = LoadSharedShader(ShaderStage::Pixel, uid))
+    return shader;
+
   const ShaderCode source_code =
       GeneratePixelShaderCode(m_api_type, m_host_config, uid.GetUidData());
   return g_renderer->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer());
@@ -456,6 +625,8 @@ std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShade
 std::unique_ptr<AbstractShader>
 ShaderCache::CompilePixelUberShader(const UberShader::PixelShaderUid& uid) const
 {
+  TRACE_ZONE("ShaderCache::CompilePixelUberShader");
+
   const ShaderCode source_code =
       UberShader::GenPixelShader(m_api_type, m_host_config, uid.GetUidData());
   return g_renderer->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer(),
@@ -474,7 +645,10 @@ const AbstractShader* ShaderCache::InsertVertexShader(const VertexShaderUid& uid
     {
       auto binary = shader->GetBinary();
       if (!binary.empty())
+      {
         m_vs_cache.disk_cache.Append(uid, binary.data(), static_cast<u32>(binary.size()));
+        StoreSharedShader(ShaderStage::Vertex, uid, binary);
+      }
     }
     INCSTAT(g_stats.num_vertex_shaders_created);
     INCSTAT(g_stats.num_vertex_shaders_alive);
@@ -518,7 +692,10 @@ const AbstractShader* ShaderCache::InsertPixelShader(const PixelShaderUid& uid,
     {
       auto binary = shader->GetBinary();
       if (!binary.empty())
+      {
         m_ps_cache.disk_cache.Append(uid, binary.data(), static_cast<u32>(binary.size()));
+        StoreSharedShader(ShaderStage::Pixel, uid, binary);
+      }
     }
     INCSTAT(g_stats.num_pixel_shaders_created);
     INCSTAT(g_stats.num_pixel_shaders_alive);
@@ -552,6 +729,8 @@ const AbstractShader* ShaderCache::InsertPixelUberShader(const UberShader::Pixel
 
 const AbstractShader* ShaderCache::CreateGeometryShader(const GeometryShaderUid& uid)
 {
+  TRACE_ZONE("ShaderCache::CreateGeometryShader");
+
   const ShaderCode source_code =
       GenerateGeometryShaderCode(m_api_type, m_host_config, uid.GetUidData());
   std::unique_ptr<AbstractShader> shader =
@@ -853,6 +1032,7 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
   if (!entry.first && pipeline)
   {
     entry.first = std::move(pipeline);
+    INCSTAT(g_stats.num_pipelines_created);
 
     if (g_ActiveConfig.bShaderCache)
     {
@@ -879,6 +1059,7 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
   if (!entry.first && pipeline)
   {
     entry.first = std::move(pipeline);
+    INCSTAT(g_stats.num_uber_pipelines_created);
 
     if (g_ActiveConfig.bShaderCache)
     {
@@ -979,6 +1160,7 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 {
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
+  real_uid = CanonicalizePipelineUid(real_uid);
 
   auto iter = m_gx_pipeline_cache.find(real_uid);
   if (iter != m_gx_pipeline_cache.end())
@@ -987,10 +1169,12 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
   // Flag it as empty with a null pipeline object, for later compilation.
   auto& entry = m_gx_pipeline_cache[real_uid];
   entry.second = false;
+  m_gx_pipeline_uid_order.push_back(real_uid);
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
 {
+  m_gx_pipeline_uid_order.push_back(config);
   if (!m_gx_pipeline_uid_cache_file.IsOpen())
     return;
 
@@ -1003,6 +1187,15 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   }
 }
 
+template <typename T, typename Uid>
+static void RemovePendingShader(T& cache, const Uid& uid)
+{
+  // The shader may have been compiled synchronously in the meantime, which we want to keep.
+  auto it = cache.shader_map.find(uid);
+  if (it != cache.shader_map.end() && it->second.pending)
+    cache.shader_map.erase(it);
+}
+
 void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority)
 {
   class VertexShaderWorkItem final : public AsyncShaderCompiler::WorkItem
@@ -1020,6 +1213,7 @@ void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 prior
     }
 
     void Retrieve() override { shader_cache->InsertVertexShader(uid, std::move(shader)); }
+    void Cancel() override { RemovePendingShader(shader_cache->m_vs_cache, uid); }
 
   private:
     ShaderCache* shader_cache;
@@ -1049,6 +1243,7 @@ void ShaderCache::QueueVertexUberShaderCompile(const UberShader::VertexShaderUid
     }
 
     void Retrieve() override { shader_cache->InsertVertexUberShader(uid, std::move(shader)); }
+    void Cancel() override { RemovePendingShader(shader_cache->m_uber_vs_cache, uid); }
 
   private:
     ShaderCache* shader_cache;
@@ -1078,6 +1273,7 @@ void ShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priorit
     }
 
     void Retrieve() override { shader_cache->InsertPixelShader(uid, std::move(shader)); }
+    void Cancel() override { RemovePendingShader(shader_cache->m_ps_cache, uid); }
 
   private:
     ShaderCache* shader_cache;
@@ -1107,6 +1303,7 @@ void ShaderCache::QueuePixelUberShaderCompile(const UberShader::PixelShaderUid&
     }
 
     void Retrieve() override { shader_cache->InsertPixelUberShader(uid, std::move(shader)); }
+    void Cancel() override { RemovePendingShader(shader_cache->m_uber_ps_cache, uid); }
 
   private:
     ShaderCache* shader_cache;
@@ -1177,6 +1374,14 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
       }
     }
 
+    void Cancel() override
+    {
+      // Leave the UID in the cache so that it is queued again with CompileMissingPipelines().
+      auto it = shader_cache->m_gx_pipeline_cache.find(uid);
+      if (it != shader_cache->m_gx_pipeline_cache.end())
+        it->second.second = false;
+    }
+
   private:
     ShaderCache* shader_cache;
     std::unique_ptr<AbstractPipeline> pipeline;
@@ -1252,6 +1457,13 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
       }
     }
 
+    void Cancel() override
+    {
+      auto it = shader_cache->m_gx_uber_pipeline_cache.find(uid);
+      if (it != shader_cache->m_gx_uber_pipeline_cache.end())
+        it->second.second = false;
+    }
+
   private:
     ShaderCache* shader_cache;
     std::unique_ptr<AbstractPipeline> UberPipeline;
@@ -9,9 +9,11 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -24,6 +26,7 @@
 #include "VideoCommon/GeometryShaderGen.h"
 #include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/RenderState.h"
+#include "VideoCommon/SharedShaderStore.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureConversionShader.h"
 #include "VideoCommon/TextureConverterShaderGen.h"
@@ -61,6 +64,9 @@ public:
   // Retrieves all pending shaders/pipelines from the async compiler.
   void RetrieveAsyncShaders();
 
+  // The number of shaders/pipelines waiting for the async compiler.
+  size_t GetPendingAsyncCompileCount() const;
+
   // Accesses ShaderGen shader caches
   const AbstractPipeline* GetPipelineForUid(const GXPipelineUid& uid);
   const AbstractPipeline* GetUberPipelineForUid(const GXUberPipelineUid& uid);
@@ -160,6 +166,9 @@ private:
                                                std::unique_ptr<AbstractPipeline> pipeline);
   void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
   void AppendGXPipelineUID(const GXPipelineUid& config);
+  template <typename UidType, typename CacheType>
+  UidType CanonicalizeAndCount(const UidType& uid, const CacheType& cache,
+                               std::set<UidType>& seen_uids);
 
   // ASync Compiler Methods
   void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
@@ -179,6 +188,10 @@ private:
                          const char* type, bool include_gameid);
   template <typename T, typename Y>
   void ClearPipelineCache(T& cache, Y& disk_cache);
+  template <typename Uid>
+  std::unique_ptr<AbstractShader> LoadSharedShader(ShaderStage stage, const Uid& uid) const;
+  template <typename Uid>
+  void StoreSharedShader(ShaderStage stage, const Uid& uid, const std::vector<u8>& binary);
 
   // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
   // The shader cache is compiled last, as it is the least likely to be required. On demand
@@ -190,6 +203,9 @@ private:
     COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
     COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
   };
+  static_assert(COMPILE_PRIORITY_ONDEMAND_PIPELINE < AsyncShaderCompiler::URGENT_PRIORITY_LIMIT &&
+                COMPILE_PRIORITY_UBERSHADER_PIPELINE >= AsyncShaderCompiler::URGENT_PRIORITY_LIMIT,
+                "Only on-demand pipelines should be compiled as urgent work");
 
   // Configuration bits.
   APIType m_api_type;
@@ -223,11 +239,20 @@ private:
   ShaderModuleCache<UberShader::VertexShaderUid> m_uber_vs_cache;
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
+  // Specialized shader binaries shared between games. Mutable, as the (const) compile functions
+  // consult it and lookups update its usage tracking.
+  mutable SharedShaderStore m_shared_shader_store;
+
   // GX Pipeline Caches - .first - pipeline, .second - pending
   std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
   std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
+  // UIDs in the order the game first used them, which is also their order in the UID cache file.
+  std::vector<GXPipelineUid> m_gx_pipeline_uid_order;
+  // UIDs which differed from their canonical form, used to count the compiles that were saved.
+  std::set<GXPipelineUid> m_gx_pipeline_canonicalized_uids;
+  std::set<GXUberPipelineUid> m_gx_uber_pipeline_canonicalized_uids;
   LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
@@ -11,6 +11,32 @@
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
+namespace
+{
+// Only a couple of generators are alive at once on any thread, keep a few spare buffers for them.
+constexpr size_t MAX_RECYCLED_SHADER_BUFFERS = 4;
+thread_local std::vector<std::string> s_recycled_shader_buffers;
+}  // namespace
+
+ShaderCode::ShaderCode(size_t reserve_size)
+{
+  if (!s_recycled_shader_buffers.empty())
+  {
+    m_buffer = std::move(s_recycled_shader_buffers.back());
+    s_recycled_shader_buffers.pop_back();
+    m_buffer.clear();
+  }
+
+  m_buffer.reserve(reserve_size);
+}
+
+ShaderCode::~ShaderCode()
+{
+  // Moved-from objects have nothing worth keeping.
+  if (!m_buffer.empty() && s_recycled_shader_buffers.size() < MAX_RECYCLED_SHADER_BUFFERS)
+    s_recycled_shader_buffers.push_back(std::move(m_buffer));
+}
+
 ShaderHostConfig ShaderHostConfig::GetCurrent()
 {
   ShaderHostConfig bits = {};
@@ -46,6 +72,7 @@ ShaderHostConfig ShaderHostConfig::GetCurrent()
   bits.backend_sampler_lod_bias = g_ActiveConfig.backend_info.bSupportsLodBiasInSampler;
   bits.backend_dynamic_vertex_loader = g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader;
   bits.backend_vs_point_line_expand = g_ActiveConfig.UseVSForLinePointExpand();
+  bits.backend_multiview = g_ActiveConfig.UseMultiviewForStereo();
   return bits;
 }
 
@@ -106,7 +106,17 @@ private:
 class ShaderCode : public ShaderGeneratorInterface
 {
 public:
-  ShaderCode() { m_buffer.reserve(16384); }
+  // The buffer is taken from the current thread's pool of released buffers when possible, so
+  // generating many shaders on the same thread (e.g. an async compiler worker) reuses the same
+  // allocations instead of growing a new string for each shader.
+  explicit ShaderCode(size_t reserve_size = 16384);
+  ~ShaderCode();
+
+  ShaderCode(const ShaderCode&) = delete;
+  ShaderCode(ShaderCode&&) = default;
+  ShaderCode& operator=(const ShaderCode&) = delete;
+  ShaderCode& operator=(ShaderCode&&) = default;
+
   const std::string& GetBuffer() const { return m_buffer; }
 
   // Writes format strings using fmtlib format strings.
@@ -179,6 +189,7 @@ union ShaderHostConfig
   BitField<26, 1, bool, u32> backend_sampler_lod_bias;
   BitField<27, 1, bool, u32> backend_dynamic_vertex_loader;
   BitField<28, 1, bool, u32> backend_vs_point_line_expand;
+  BitField<29, 1, bool, u32> backend_multiview;
 
   static ShaderHostConfig GetCurrent();
 };
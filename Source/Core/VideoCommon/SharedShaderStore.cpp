@@ -0,0 +1,298 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/SharedShaderStore.h"
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+#include <fmt/format.h>
+#include <xxhash.h>
+
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+
+namespace
+{
+// Bump this when the layout of the index or entry files changes.
+constexpr u32 VERSION = 1;
+constexpr char INDEX_MAGIC[] = "SharedShaderStore";
+
+struct EntryHeader
+{
+  u32 version;
+  u32 type;
+  u32 key_size;
+};
+}  // namespace
+
+SharedShaderStore::~SharedShaderStore()
+{
+  Close();
+}
+
+void SharedShaderStore::Open(std::string directory, std::string game_id, u64 max_size)
+{
+  Close();
+
+  std::lock_guard lk(m_mutex);
+  if (!directory.empty() && directory.back() != '/')
+    directory += '/';
+  if (!File::IsDirectory(directory) && !File::CreateFullPath(directory))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to create shared shader store directory {}", directory);
+    return;
+  }
+
+  m_directory = std::move(directory);
+  m_game_id = std::move(game_id);
+  m_max_size = max_size;
+  m_is_open = true;
+  LoadIndex();
+  EvictIfNeeded();
+
+  INFO_LOG_FMT(VIDEO, "Opened shared shader store {} with {} entries ({} bytes)", m_directory,
+               m_entries.size(), m_total_size);
+}
+
+void SharedShaderStore::Close()
+{
+  std::lock_guard lk(m_mutex);
+  if (!m_is_open)
+    return;
+
+  if (m_index_dirty)
+    SaveIndex();
+
+  m_entries.clear();
+  m_total_size = 0;
+  m_use_counter = 0;
+  m_is_open = false;
+}
+
+std::vector<u8> SharedShaderStore::Lookup(u32 type, const void* key, u32 key_size)
+{
+  std::lock_guard lk(m_mutex);
+  if (!m_is_open)
+    return {};
+
+  const u64 hash = HashKey(type, key, key_size);
+  auto iter = m_entries.find(hash);
+  if (iter == m_entries.end())
+    return {};
+
+  File::IOFile file(GetEntryPath(hash), "rb");
+  EntryHeader header;
+  std::vector<u8> stored_key(key_size);
+  std::vector<u8> value;
+  if (file.ReadArray(&header, 1) && header.version == VERSION && header.type == type &&
+      header.key_size == key_size && file.ReadBytes(stored_key.data(), key_size) &&
+      std::memcmp(stored_key.data(), key, key_size) == 0)
+  {
+    value.resize(iter->second.size);
+    if (!file.ReadBytes(value.data(), value.size()))
+      value.clear();
+  }
+
+  if (value.empty())
+  {
+    // Missing, truncated or a hash collision; forget it so it gets replaced with a good copy.
+    file.Close();
+    File::Delete(GetEntryPath(hash));
+    m_total_size -= iter->second.size;
+    m_entries.erase(iter);
+    m_index_dirty = true;
+    return {};
+  }
+
+  Touch(iter->second);
+  return value;
+}
+
+void SharedShaderStore::Insert(u32 type, const void* key, u32 key_size, const u8* value,
+                               u32 value_size)
+{
+  std::lock_guard lk(m_mutex);
+  if (!m_is_open || value_size == 0)
+    return;
+
+  const u64 hash = HashKey(type, key, key_size);
+  auto iter = m_entries.find(hash);
+  if (iter != m_entries.end())
+  {
+    Touch(iter->second);
+    return;
+  }
+
+  // Write to a temporary file first, so concurrent instances never see a partial entry.
+  const std::string path = GetEntryPath(hash);
+  const std::string temp_path = File::GetTempFilenameForAtomicWrite(path);
+  {
+    File::IOFile file(temp_path, "wb");
+    const EntryHeader header{VERSION, type, key_size};
+    if (!file.WriteArray(&header, 1) || !file.WriteBytes(key, key_size) ||
+        !file.WriteBytes(value, value_size))
+    {
+      file.Close();
+      File::Delete(temp_path);
+      return;
+    }
+  }
+  if (!File::Rename(temp_path, path))
+  {
+    File::Delete(temp_path);
+    return;
+  }
+
+  Entry& entry = m_entries[hash];
+  entry.size = value_size;
+  m_total_size += value_size;
+  Touch(entry);
+  EvictIfNeeded();
+}
+
+size_t SharedShaderStore::GetEntryCount() const
+{
+  std::lock_guard lk(m_mutex);
+  return m_entries.size();
+}
+
+u64 SharedShaderStore::GetTotalSize() const
+{
+  std::lock_guard lk(m_mutex);
+  return m_total_size;
+}
+
+size_t SharedShaderStore::GetReferenceCount(u32 type, const void* key, u32 key_size) const
+{
+  std::lock_guard lk(m_mutex);
+  auto iter = m_entries.find(HashKey(type, key, key_size));
+  return iter != m_entries.end() ? iter->second.games.size() : 0;
+}
+
+u64 SharedShaderStore::HashKey(u32 type, const void* key, u32 key_size)
+{
+  return XXH3_64bits_withSeed(key, key_size, type);
+}
+
+std::string SharedShaderStore::GetEntryPath(u64 hash) const
+{
+  return fmt::format("{}{:016x}.bin", m_directory, hash);
+}
+
+std::string SharedShaderStore::GetIndexPath() const
+{
+  return m_directory + "index.txt";
+}
+
+void SharedShaderStore::Touch(Entry& entry)
+{
+  entry.last_use = ++m_use_counter;
+  if (!m_game_id.empty())
+    entry.games.insert(m_game_id);
+  m_index_dirty = true;
+}
+
+void SharedShaderStore::EvictIfNeeded()
+{
+  if (m_total_size <= m_max_size)
+    return;
+
+  // Evict down to a bit below the limit, so we don't end up evicting on every insert.
+  const u64 target_size = m_max_size - m_max_size / 8;
+
+  std::vector<std::tuple<size_t, u64, u64>> order;
+  order.reserve(m_entries.size());
+  for (const auto& [hash, entry] : m_entries)
+    order.emplace_back(entry.games.size(), entry.last_use, hash);
+  std::sort(order.begin(), order.end());
+
+  size_t evicted = 0;
+  for (const auto& [references, last_use, hash] : order)
+  {
+    if (m_total_size <= target_size)
+      break;
+
+    auto iter = m_entries.find(hash);
+    File::Delete(GetEntryPath(hash));
+    m_total_size -= iter->second.size;
+    m_entries.erase(iter);
+    evicted++;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Evicted {} entries from the shared shader store", evicted);
+  m_index_dirty = true;
+}
+
+void SharedShaderStore::LoadIndex()
+{
+  // Format: a header line with the magic, version and use counter, followed by one line per
+  // entry: hash, size, last use and a comma-separated list of the games which used it.
+  std::string contents;
+  if (!File::ReadFileToString(GetIndexPath(), contents))
+    return;
+
+  const std::vector<std::string> lines = SplitString(contents, '\n');
+  if (lines.empty())
+    return;
+
+  const std::vector<std::string> header = SplitString(lines[0], ' ');
+  u32 version = 0;
+  if (header.size() != 3 || header[0] != INDEX_MAGIC || !TryParse(header[1], &version) ||
+      version != VERSION || !TryParse(header[2], &m_use_counter))
+  {
+    WARN_LOG_FMT(VIDEO, "Ignoring shared shader store index with unknown format");
+    return;
+  }
+
+  for (size_t i = 1; i < lines.size(); i++)
+  {
+    const std::vector<std::string> fields = SplitString(lines[i], ' ');
+    u64 hash;
+    Entry entry;
+    if (fields.size() != 4 || !TryParse(fields[0], &hash, 16) ||
+        !TryParse(fields[1], &entry.size) || !TryParse(fields[2], &entry.last_use))
+    {
+      continue;
+    }
+    if (fields[3] != "-")
+    {
+      for (std::string& game : SplitString(fields[3], ','))
+        entry.games.insert(std::move(game));
+    }
+
+    // Entries may have been removed by hand, or by another instance evicting them.
+    if (!File::Exists(GetEntryPath(hash)))
+    {
+      m_index_dirty = true;
+      continue;
+    }
+
+    m_total_size += entry.size;
+    m_entries.emplace(hash, std::move(entry));
+  }
+}
+
+void SharedShaderStore::SaveIndex()
+{
+  std::string contents = fmt::format("{} {} {}\n", INDEX_MAGIC, VERSION, m_use_counter);
+  for (const auto& [hash, entry] : m_entries)
+  {
+    const std::string games =
+        entry.games.empty() ? "-" : JoinStrings({entry.games.begin(), entry.games.end()}, ",");
+    contents += fmt::format("{:016x} {} {} {}\n", hash, entry.size, entry.last_use, games);
+  }
+
+  const std::string path = GetIndexPath();
+  const std::string temp_path = File::GetTempFilenameForAtomicWrite(path);
+  if (!File::WriteStringToFile(temp_path, contents) || !File::RenameSync(temp_path, path))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to write shared shader store index {}", path);
+    return;
+  }
+  m_index_dirty = false;
+}
@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// Shader binaries shared between all games.
+//
+// The per-game shader caches only help once a game has been played, but titles built on the same
+// SDK tend to generate many identical shader UIDs. This store is addressed by a hash of the UID
+// (whose contents fully determine the generated code), so any game can reuse a binary another
+// game compiled. Each entry records which games have used it, and when the store grows past its
+// size limit, entries used by the fewest games are evicted first, oldest first among equals.
+class SharedShaderStore final
+{
+public:
+  SharedShaderStore() = default;
+  ~SharedShaderStore();
+
+  SharedShaderStore(const SharedShaderStore&) = delete;
+  SharedShaderStore& operator=(const SharedShaderStore&) = delete;
+
+  // Opens the store in directory, creating it if needed. Entries used or added while open are
+  // referenced by game_id. max_size is the total size of the stored binaries in bytes.
+  void Open(std::string directory, std::string game_id, u64 max_size);
+  void Close();
+
+  bool IsOpen() const { return m_is_open; }
+
+  // type distinguishes keys of different kinds which may have the same bytes.
+  // Returns an empty vector if the key isn't stored.
+  std::vector<u8> Lookup(u32 type, const void* key, u32 key_size);
+  void Insert(u32 type, const void* key, u32 key_size, const u8* value, u32 value_size);
+
+  size_t GetEntryCount() const;
+  u64 GetTotalSize() const;
+  // Number of games which have used the entry, or zero if it isn't stored.
+  size_t GetReferenceCount(u32 type, const void* key, u32 key_size) const;
+
+private:
+  struct Entry
+  {
+    u64 size = 0;
+    u64 last_use = 0;
+    std::set<std::string> games;
+  };
+
+  static u64 HashKey(u32 type, const void* key, u32 key_size);
+  std::string GetEntryPath(u64 hash) const;
+  std::string GetIndexPath() const;
+
+  void Touch(Entry& entry);
+  void EvictIfNeeded();
+  void LoadIndex();
+  void SaveIndex();
+
+  mutable std::mutex m_mutex;
+  bool m_is_open = false;
+  bool m_index_dirty = false;
+  std::string m_directory;
+  std::string m_game_id;
+  u64 m_max_size = 0;
+  u64 m_total_size = 0;
+  u64 m_use_counter = 0;
+  std::unordered_map<u64, Entry> m_entries;
+};
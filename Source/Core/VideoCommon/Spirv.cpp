@@ -135,7 +135,10 @@ CompileShaderToSPV(EShLanguage stage, APIType api_type,
   }
   else
   {
-    options.disableOptimizer = false;
+    // D3D and Metal only use the SPIR-V as an intermediate which is cross-compiled and then
+    // optimized by the platform's own shader compiler, so running the SPIR-V optimizer there
+    // only adds to the compile time of each shader.
+    options.disableOptimizer = api_type != APIType::Vulkan;
     options.stripDebugInfo = true;
   }
 
@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/StaticVertexCache.h"
+
+#include <iterator>
+#include <utility>
+
+#include <xxhash.h>
+
+StaticVertexCache::StaticVertexCache(size_t budget) : m_budget(budget)
+{
+}
+
+StaticVertexCache::~StaticVertexCache() = default;
+
+u64 StaticVertexCache::HashVertexData(const void* data, u32 size, u32 vertex_stride)
+{
+  // The same bytes interpreted with another stride are different vertices.
+  return XXH3_64bits_withSeed(data, size, vertex_stride);
+}
+
+const StaticVertexBuffer* StaticVertexCache::Lookup(u64 hash, u32 size)
+{
+  const auto it = m_entries.find(hash);
+  if (it == m_entries.end() || it->second->size != size)
+    return nullptr;
+
+  m_lru.splice(m_lru.begin(), m_lru, it->second);
+  return it->second->buffer.get();
+}
+
+bool StaticVertexCache::ShouldInsert(u64 hash, u32 size)
+{
+  if (size < MIN_VERTEX_DATA_SIZE || size > m_budget)
+    return false;
+
+  if (m_seen_last_frame.count(hash) != 0 || !m_seen_this_frame.insert(hash).second)
+    return true;
+
+  return false;
+}
+
+const StaticVertexBuffer* StaticVertexCache::Insert(u64 hash, u32 size,
+                                                    std::unique_ptr<StaticVertexBuffer> buffer)
+{
+  if (const auto it = m_entries.find(hash); it != m_entries.end())
+    Erase(it->second);
+
+  m_lru.push_front({hash, size, std::move(buffer)});
+  m_entries.emplace(hash, m_lru.begin());
+  m_size += size;
+  m_seen_this_frame.erase(hash);
+  m_seen_last_frame.erase(hash);
+
+  // The new entry itself is never evicted.
+  while (m_size > m_budget && m_lru.size() > 1)
+    Erase(std::prev(m_lru.end()));
+
+  return m_lru.front().buffer.get();
+}
+
+void StaticVertexCache::Erase(std::list<Entry>::iterator it)
+{
+  m_size -= it->size;
+  m_entries.erase(it->hash);
+  m_lru.erase(it);
+}
+
+void StaticVertexCache::OnEndFrame()
+{
+  std::swap(m_seen_last_frame, m_seen_this_frame);
+  m_seen_this_frame.clear();
+}
+
+void StaticVertexCache::Clear()
+{
+  m_entries.clear();
+  m_lru.clear();
+  m_size = 0;
+  m_seen_this_frame.clear();
+  m_seen_last_frame.clear();
+}
@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Common/CommonTypes.h"
+
+// Vertex data in a buffer on the GPU which is never written to again. Created by the backend.
+class StaticVertexBuffer
+{
+public:
+  virtual ~StaticVertexBuffer() = default;
+};
+
+// Keeps vertex data which is drawn unchanged again and again in buffers on the GPU, so that it
+// doesn't have to be streamed to the GPU for every draw.
+//
+// Vertex data is identified by the hash of its contents. Most vertex data is only drawn once, so
+// it is only placed in the cache once it was drawn again in the same or the following frame. When
+// the cache grows beyond its budget, the least recently drawn vertex data is evicted.
+class StaticVertexCache
+{
+public:
+  // Smaller draws aren't worth hashing, and would fill the cache with lots of tiny buffers.
+  static constexpr u32 MIN_VERTEX_DATA_SIZE = 16 * 1024;
+  static constexpr size_t DEFAULT_BUDGET = 64 * 1024 * 1024;
+
+  explicit StaticVertexCache(size_t budget = DEFAULT_BUDGET);
+  ~StaticVertexCache();
+
+  static u64 HashVertexData(const void* data, u32 size, u32 vertex_stride);
+
+  // Returns the buffer holding the vertex data with this hash, or nullptr if it isn't cached.
+  const StaticVertexBuffer* Lookup(u64 hash, u32 size);
+
+  // Returns whether vertex data which wasn't found in the cache should be inserted.
+  bool ShouldInsert(u64 hash, u32 size);
+
+  // Takes ownership of the buffer, which may evict other vertex data.
+  const StaticVertexBuffer* Insert(u64 hash, u32 size, std::unique_ptr<StaticVertexBuffer> buffer);
+
+  void OnEndFrame();
+  void Clear();
+
+  size_t GetSize() const { return m_size; }
+  size_t GetEntryCount() const { return m_entries.size(); }
+
+private:
+  struct Entry
+  {
+    u64 hash;
+    u32 size;
+    std::unique_ptr<StaticVertexBuffer> buffer;
+  };
+
+  void Erase(std::list<Entry>::iterator it);
+
+  // Most recently drawn first.
+  std::list<Entry> m_lru;
+  std::unordered_map<u64, std::list<Entry>::iterator> m_entries;
+  size_t m_size = 0;
+  size_t m_budget;
+
+  // Hashes of the vertex data which was drawn but not cached in this and the last frame.
+  std::unordered_set<u64> m_seen_this_frame;
+  std::unordered_set<u64> m_seen_last_frame;
+};
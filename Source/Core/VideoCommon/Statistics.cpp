@@ -6,9 +6,14 @@
 #include <cstring>
 #include <utility>
 
+#include <fmt/format.h>
 #include <imgui.h>
 
+#include "Core/System.h"
+
 #include "VideoCommon/BPFunctions.h"
+#include "VideoCommon/Fifo.h"
+#include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -71,10 +76,16 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Texture memory", "%.1f MiB", texture_memory / (1024.0 * 1024.0));
+  draw_statistic("EFB/XFB copy memory", "%.1f MiB", texture_copy_memory / (1024.0 * 1024.0));
+  draw_statistic("Texture pool memory", "%.1f MiB", texture_pool_memory / (1024.0 * 1024.0));
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
   draw_statistic("vshaders alive", "%d", num_vertex_shaders_alive);
+  draw_statistic("Pipelines created", "%d", num_pipelines_created);
+  draw_statistic("Uber pipelines created", "%d", num_uber_pipelines_created);
+  draw_statistic("Pipelines deduplicated", "%d", num_pipelines_deduplicated);
   draw_statistic("shaders changes", "%d", this_frame.num_shader_changes);
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
@@ -91,13 +102,43 @@ void Statistics::Display() const
   draw_statistic("Index streamed", "%i kB", this_frame.bytes_index_streamed / 1024);
   draw_statistic("Uniform streamed", "%i kB", this_frame.bytes_uniform_streamed / 1024);
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
+  draw_statistic("Vertex Loaders precompiled", "%d", num_vertex_loaders_precompiled);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
+  draw_statistic("Speculative BBox reads:", "%d", this_frame.num_bbox_speculative_reads);
+  draw_statistic("BBox mispredictions:", "%d", this_frame.num_bbox_mispredictions);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
 
   ImGui::Columns(1);
 
+  if (ImGui::CollapsingHeader("GPU thread wakeups"))
+  {
+    const Fifo::WakeupStatistics wakeups =
+        Core::System::GetInstance().GetFifo().GetWakeupStatistics();
+    const u64 num_wakeups = wakeups.gpu_thread.spin_wakeups + wakeups.gpu_thread.event_wakeups;
+    ImGui::Columns(2, "WakeupColumns", true);
+    draw_statistic("Spin wakeups", "%llu",
+                   static_cast<unsigned long long>(wakeups.gpu_thread.spin_wakeups));
+    draw_statistic("Event wakeups", "%llu",
+                   static_cast<unsigned long long>(wakeups.gpu_thread.event_wakeups));
+    draw_statistic("Average latency", "%.1f us",
+                   num_wakeups ? wakeups.gpu_thread.total_latency_ns / 1000.0 / num_wakeups : 0.0);
+    draw_statistic("Max latency", "%.1f us", wakeups.gpu_thread.max_latency_ns / 1000.0);
+    draw_statistic("SyncGPU waits", "%llu", static_cast<unsigned long long>(wakeups.sync_waits));
+    draw_statistic("SyncGPU blocked", "%.1f ms", wakeups.sync_wait_ns / 1000000.0);
+    ImGui::Columns(1);
+  }
+
+  if (ImGui::CollapsingHeader("Vertices per loader"))
+  {
+    for (const auto& loader : VertexLoaderManager::GetLoaderStatistics())
+    {
+      ImGui::TextUnformatted(
+          fmt::format("{:>10} {}", loader.num_vertices, loader.description).c_str());
+    }
+  }
+
   ImGui::End();
 }
 
@@ -14,12 +14,22 @@ struct Statistics
   int num_pixel_shaders_alive;
   int num_vertex_shaders_created;
   int num_vertex_shaders_alive;
+  int num_pipelines_created;
+  int num_uber_pipelines_created;
+  // Pipelines that would have been compiled, but only differed in unused state from an existing one
+  int num_pipelines_deduplicated;
 
   int num_textures_created;
   int num_textures_uploaded;
   int num_textures_alive;
 
+  // Video memory used by the texture cache, in bytes
+  size_t texture_memory;
+  size_t texture_copy_memory;
+  size_t texture_pool_memory;
+
   int num_vertex_loaders;
+  int num_vertex_loaders_precompiled;
 
   std::array<float, 6> proj;
   std::array<float, 16> gproj;
@@ -72,6 +82,9 @@ struct Statistics
     int num_efb_peeks;
     int num_efb_pokes;
 
+    int num_bbox_speculative_reads;
+    int num_bbox_mispredictions;
+
     int num_draw_done;
     int num_token;
     int num_token_int;
@@ -103,7 +116,7 @@ extern Statistics g_stats;
 #define SETSTAT(a, x)                                                                              \
   do                                                                                               \
   {                                                                                                \
-    (a) = static_cast<int>(x);                                                                     \
+    (a) = static_cast<decltype(a)>(x);                                                             \
   } while (false)
 #else
 #define INCSTAT(a)                                                                                 \
@@ -22,6 +22,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/Hash.h"
+#include "Common/Image.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
@@ -39,6 +40,7 @@
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
+#include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 #include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/PixelShaderManager.h"
@@ -62,6 +64,14 @@ static int xfb_count = 0;
 
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
+static u64 HashTextureData(const u8* src, u32 len, u32 samples)
+{
+  if (g_ActiveConfig.texture_hash_version == TextureHashVersion::XXH3)
+    return Common::GetXXH3Hash64(src, len, samples);
+
+  return Common::GetHash64(src, len, samples);
+}
+
 TextureCacheBase::TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
                                            std::unique_ptr<AbstractFramebuffer> fb)
     : texture(std::move(tex)), framebuffer(std::move(fb))
@@ -72,6 +82,28 @@ TextureCacheBase::TCacheEntry::~TCacheEntry()
 {
   for (auto& reference : references)
     reference->references.erase(this);
+  UnlinkConvertedCopies();
+}
+
+void TextureCacheBase::TCacheEntry::UnlinkConvertedCopies()
+{
+  if (conversion_source)
+  {
+    auto& source_copies = conversion_source->converted_copies;
+    for (auto iter = source_copies.begin(); iter != source_copies.end(); ++iter)
+    {
+      if (iter->second == this)
+      {
+        source_copies.erase(iter);
+        break;
+      }
+    }
+    conversion_source = nullptr;
+  }
+
+  for (auto& converted_copy : converted_copies)
+    converted_copy.second->conversion_source = nullptr;
+  converted_copies.clear();
 }
 
 void TextureCacheBase::CheckTempSize(size_t required_size)
@@ -104,6 +136,10 @@ TextureCacheBase::~TextureCacheBase()
   // Clear pending EFB copies first, so we don't try to flush them.
   m_pending_efb_copies.clear();
 
+  // Texture dumps which were already queued still get written.
+  ProcessPendingTextureDumps(true);
+  m_texture_dump_encodes.Wait();
+
   HiresTexture::Shutdown();
   Invalidate();
   Common::FreeAlignedMemory(temp);
@@ -133,6 +169,8 @@ void TextureCacheBase::Invalidate()
   }
   textures_by_address.clear();
   textures_by_hash.clear();
+  copies_by_address.clear();
+  max_copy_size_in_bytes = 0;
 
   texture_pool.clear();
 }
@@ -168,7 +206,8 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
       config.bDisableCopyToVRAM != backup_config.disable_vram_copies ||
       config.bArbitraryMipmapDetection != backup_config.arbitrary_mipmap_detection ||
       config.bGraphicMods != backup_config.graphics_mods ||
-      change_count != backup_config.graphics_mod_change_count)
+      change_count != backup_config.graphics_mod_change_count ||
+      config.texture_hash_version != backup_config.texture_hash_version)
   {
     Invalidate();
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
@@ -179,6 +218,8 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
 
 void TextureCacheBase::Cleanup(int _frameCount)
 {
+  ProcessPendingTextureDumps(false);
+
   TexAddrCache::iterator iter = textures_by_address.begin();
   TexAddrCache::iterator tcend = textures_by_address.end();
   while (iter != tcend)
@@ -238,6 +279,84 @@ void TextureCacheBase::Cleanup(int _frameCount)
       ++iter2;
     }
   }
+
+  EnforceMemoryBudget(_frameCount);
+}
+
+void TextureCacheBase::EnforceMemoryBudget(int frame_count)
+{
+  size_t texture_memory = 0;
+  size_t copy_memory = 0;
+  size_t pool_memory = 0;
+  for (const auto& it : textures_by_address)
+  {
+    const size_t size = it.second->texture->GetConfig().GetMemorySize();
+    if (it.second->IsCopy())
+      copy_memory += size;
+    else
+      texture_memory += size;
+  }
+  for (const auto& it : texture_pool)
+    pool_memory += it.first.GetMemorySize();
+
+  const size_t budget = static_cast<size_t>(g_ActiveConfig.iTextureCacheBudget) << 20;
+  if (budget != 0 && texture_memory + copy_memory + pool_memory > budget)
+  {
+    // Evict the textures which weren't used for the longest time first, and the largest ones of
+    // those used in the same frame. Copies can't be recreated, and neither can anything used in
+    // this frame without thrashing, so those are left alone.
+    std::vector<std::pair<TexAddrCache::iterator, size_t>> candidates;
+    for (auto it = textures_by_address.begin(); it != textures_by_address.end(); ++it)
+    {
+      const TCacheEntry* entry = it->second;
+      if (entry->IsCopy() || entry->frameCount >= frame_count ||
+          std::find(bound_textures.begin(), bound_textures.end(), entry) != bound_textures.end())
+      {
+        continue;
+      }
+      candidates.emplace_back(it, entry->texture->GetConfig().GetMemorySize());
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+      return std::make_pair(a.first->second->frameCount, b.second) <
+             std::make_pair(b.first->second->frameCount, a.second);
+    });
+    for (const auto& [it, size] : candidates)
+    {
+      if (texture_memory + copy_memory <= budget)
+        break;
+
+      // The texture goes to the pool, which is trimmed below.
+      InvalidateTexture(it);
+      texture_memory -= size;
+      pool_memory += size;
+    }
+
+    // Unused textures in the pool go first, oldest first. Textures that were just evicted have a
+    // frameCount of FRAMECOUNT_INVALID, so they sort before everything else.
+    std::vector<TexPool::iterator> pool_entries;
+    for (auto it = texture_pool.begin(); it != texture_pool.end(); ++it)
+      pool_entries.push_back(it);
+    std::sort(pool_entries.begin(), pool_entries.end(), [](const auto& a, const auto& b) {
+      return a->second.frameCount < b->second.frameCount;
+    });
+    for (const auto& it : pool_entries)
+    {
+      if (texture_memory + copy_memory + pool_memory <= budget)
+        break;
+
+      pool_memory -= it->first.GetMemorySize();
+      texture_pool.erase(it);
+    }
+  }
+
+  SETSTAT(g_stats.texture_memory, texture_memory);
+  SETSTAT(g_stats.texture_copy_memory, copy_memory);
+  SETSTAT(g_stats.texture_pool_memory, pool_memory);
+}
+
+bool TextureCacheBase::TCacheEntry::IsCustomTextureReady() const
+{
+  return !pending_custom_texture.empty() && !HiresTexture::IsLoadPending(pending_custom_texture);
 }
 
 bool TextureCacheBase::TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
@@ -263,6 +382,7 @@ void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
   backup_config.gpu_texture_decoding = config.bEnableGPUTextureDecoding;
   backup_config.disable_vram_copies = config.bDisableCopyToVRAM;
   backup_config.arbitrary_mipmap_detection = config.bArbitraryMipmapDetection;
+  backup_config.texture_hash_version = config.texture_hash_version;
   backup_config.graphics_mods = config.bGraphicMods;
   backup_config.graphics_mod_change_count =
       config.graphics_mod_config ? config.graphics_mod_config->GetChangeCount() : 0;
@@ -273,6 +393,18 @@ TextureCacheBase::ApplyPaletteToEntry(TCacheEntry* entry, const u8* palette, TLU
 {
   DEBUG_ASSERT(g_ActiveConfig.backend_info.bSupportsPaletteConversion);
 
+  // Games which animate their palettes or switch between a few TLUTs convert the same EFB copy
+  // with the same palette over and over, so reuse the result of the previous conversion.
+  const u32 palette_size = entry->format == TextureFormat::I4 ? 32 : 512;
+  const u64 tlut_hash = HashTextureData(palette, palette_size, 0);
+  const auto converted_iter =
+      entry->converted_copies.find({tlut_hash, entry->format.texfmt, tlutfmt});
+  if (converted_iter != entry->converted_copies.end())
+  {
+    converted_iter->second->frameCount = FRAMECOUNT_INVALID;
+    return converted_iter->second;
+  }
+
   const AbstractPipeline* pipeline = g_shader_cache->GetPaletteConversionPipeline(tlutfmt);
   if (!pipeline)
   {
@@ -299,7 +431,6 @@ TextureCacheBase::ApplyPaletteToEntry(TCacheEntry* entry, const u8* palette, TLU
 
   g_renderer->BeginUtilityDrawing();
 
-  const u32 palette_size = entry->format == TextureFormat::I4 ? 32 : 512;
   u32 texel_buffer_offset;
   if (g_vertex_manager->UploadTexelBuffer(palette, palette_size,
                                           TexelBufferFormat::TEXEL_BUFFER_FORMAT_R16_UINT,
@@ -332,14 +463,23 @@ TextureCacheBase::ApplyPaletteToEntry(TCacheEntry* entry, const u8* palette, TLU
     g_renderer->EndUtilityDrawing();
   }
 
-  textures_by_address.emplace(decoded_entry->addr, decoded_entry);
+  InsertTexture(decoded_entry->addr, decoded_entry);
+  entry->AddConvertedCopy(tlut_hash, entry->format.texfmt, tlutfmt, decoded_entry);
 
   return decoded_entry;
 }
 
-TextureCacheBase::TCacheEntry* TextureCacheBase::ReinterpretEntry(const TCacheEntry* existing_entry,
+TextureCacheBase::TCacheEntry* TextureCacheBase::ReinterpretEntry(TCacheEntry* existing_entry,
                                                                   TextureFormat new_format)
 {
+  const auto converted_iter =
+      existing_entry->converted_copies.find({0, new_format, existing_entry->format.tlutfmt});
+  if (converted_iter != existing_entry->converted_copies.end())
+  {
+    converted_iter->second->frameCount = existing_entry->frameCount;
+    return converted_iter->second;
+  }
+
   const AbstractPipeline* pipeline =
       g_shader_cache->GetTextureReinterpretPipeline(existing_entry->format.texfmt, new_format);
   if (!pipeline)
@@ -378,7 +518,9 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::ReinterpretEntry(const TCacheEn
   g_renderer->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  InsertTexture(reinterpreted_entry->addr, reinterpreted_entry);
+  existing_entry->AddConvertedCopy(0, new_format, existing_entry->format.tlutfmt,
+                                   reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -551,10 +693,31 @@ void TextureCacheBase::DoState(PointerWrap& p)
 
   p.Do(last_entry_id);
 
+  TextureHashVersion hash_version = g_ActiveConfig.texture_hash_version;
+  p.Do(hash_version);
+
   if (p.IsWriteMode() || p.IsMeasureMode())
     DoSaveState(p);
   else
     DoLoadState(p);
+
+  // The copies in the state were hashed with another function. RAM has already been restored at
+  // this point, so they can simply be hashed again.
+  if (p.IsReadMode() && hash_version != g_ActiveConfig.texture_hash_version)
+  {
+    for (auto& it : textures_by_address)
+    {
+      const u64 hash = it.second->CalculateHash();
+      it.second->SetHashes(hash, hash);
+    }
+
+    std::vector<TCacheEntry*> hashed_entries;
+    for (auto& it : textures_by_hash)
+      hashed_entries.push_back(it.second);
+    textures_by_hash.clear();
+    for (TCacheEntry* entry : hashed_entries)
+      entry->textures_by_hash_iter = textures_by_hash.emplace(entry->hash, entry);
+  }
 }
 
 void TextureCacheBase::DoSaveState(PointerWrap& p)
@@ -696,6 +859,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
     auto tex = DeserializeTexture(p);
     TCacheEntry* entry = new TCacheEntry(std::move(tex->texture), std::move(tex->framebuffer));
     entry->textures_by_hash_iter = textures_by_hash.end();
+    entry->copies_by_address_iter = copies_by_address.end();
     entry->DoState(p);
     if (entry->texture && commit_state)
       id_map.emplace(i, entry);
@@ -728,7 +892,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     TCacheEntry* entry = GetEntry(id);
     if (entry)
-      textures_by_address.emplace(addr, entry);
+      InsertTexture(addr, entry);
   }
 
   // Fill in hash map.
@@ -795,7 +959,7 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, const u8
 
   u32 numBlocksX = (entry_to_update->native_width + block_width - 1) / block_width;
 
-  auto iter = FindOverlappingTextures(entry_to_update->addr, entry_to_update->size_in_bytes);
+  auto iter = FindOverlappingCopies(entry_to_update->addr, entry_to_update->size_in_bytes);
   while (iter.first != iter.second)
   {
     TCacheEntry* entry = iter.first->second;
@@ -919,14 +1083,9 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, const u8
                                                              0, dstrect, layer, 0);
         }
 
-        if (isPaletteTexture)
-        {
-          // Remove the temporary converted texture, it won't be used anywhere else
-          // TODO: It would be nice to convert and copy in one step, but this code path isn't common
-          iter.first = InvalidateTexture(iter.first);
-          continue;
-        }
-        else
+        // The palette-applied texture stays cached with its EFB copy, the copy itself was already
+        // linked with the partially updated texture above.
+        if (!isPaletteTexture)
         {
           // Link the two textures together, so we won't apply this partial update again
           entry->CreateReference(entry_to_update);
@@ -937,7 +1096,7 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, const u8
       else
       {
         // If the hash does not match, this EFB copy will not be used for anything, so remove it
-        iter.first = InvalidateTexture(iter.first);
+        iter.first = InvalidateCopy(iter.first);
         continue;
       }
     }
@@ -973,11 +1132,84 @@ void TextureCacheBase::DumpTexture(TCacheEntry* entry, std::string basename, uns
       return;
   }
 
-  const std::string filename = fmt::format("{}/{}.png", szDir, basename);
-  if (File::Exists(filename))
+  std::string filename = fmt::format("{}/{}.png", szDir, basename);
+  if (m_queued_texture_dumps.contains(filename) || File::Exists(filename))
+    return;
+
+  m_queued_texture_dumps.insert(filename);
+  QueueTextureDump(entry->texture.get(), level, std::move(filename));
+}
+
+void TextureCacheBase::QueueTextureDump(const AbstractTexture* texture, u32 level,
+                                        std::string filename)
+{
+  // We can't dump compressed textures currently (it would mean drawing them to a RGBA8
+  // framebuffer, and saving that). TextureCache does not dump custom textures anyway.
+  const TextureConfig& config = texture->GetConfig();
+  ASSERT(!AbstractTexture::IsCompressedFormat(config.format));
+  ASSERT(level < config.levels);
+
+  // Readbacks which haven't completed yet each hold a staging texture, so don't let them pile up.
+  constexpr size_t MAX_PENDING_READBACKS = 64;
+  if (m_pending_texture_dumps.size() >= MAX_PENDING_READBACKS)
+    ProcessPendingTextureDumps(true);
+
+  const u32 width = std::max(1u, config.width >> level);
+  const u32 height = std::max(1u, config.height >> level);
+  TextureConfig readback_config(width, height, 1, 1, 1, AbstractTextureFormat::RGBA8, 0);
+  auto readback_texture =
+      g_renderer->CreateStagingTexture(StagingTextureType::Readback, readback_config);
+  if (!readback_texture)
     return;
 
-  entry->texture->Save(filename, level);
+  readback_texture->CopyFromTexture(texture, 0, level);
+  m_pending_texture_dumps.push_back(
+      {std::move(readback_texture), std::move(filename), width, height});
+}
+
+void TextureCacheBase::ProcessPendingTextureDumps(bool wait)
+{
+  // Each encode holds a copy of the image, so the GPU thread waits for the workers when they fall
+  // too far behind.
+  constexpr u32 MAX_ENCODES_IN_FLIGHT = 64;
+  const int compression_level = Config::Get(Config::GFX_PNG_COMPRESSION_LEVEL);
+
+  auto it = m_pending_texture_dumps.begin();
+  while (it != m_pending_texture_dumps.end())
+  {
+    if (!wait && !it->readback_texture->IsCopyComplete())
+    {
+      ++it;
+      continue;
+    }
+
+    it->readback_texture->Flush();
+    if (it->readback_texture->Map())
+    {
+      const u32 stride = it->width * 4;
+      std::vector<u8> data(static_cast<size_t>(stride) * it->height);
+      it->readback_texture->ReadTexels(
+          MathUtil::Rectangle<int>(0, 0, static_cast<int>(it->width), static_cast<int>(it->height)),
+          data.data(), stride);
+
+      if (m_texture_dump_encodes_in_flight.load(std::memory_order_relaxed) >=
+          MAX_ENCODES_IN_FLIGHT)
+      {
+        m_texture_dump_encodes.Wait();
+      }
+
+      m_texture_dump_encodes_in_flight.fetch_add(1, std::memory_order_relaxed);
+      m_texture_dump_encodes.Submit([this, data = std::move(data),
+                                     filename = std::move(it->filename), width = it->width,
+                                     height = it->height, compression_level] {
+        Common::SavePNG(filename, data.data(), Common::ImageByteFormat::RGBA, width, height,
+                        width * 4, compression_level);
+        m_texture_dump_encodes_in_flight.fetch_sub(1, std::memory_order_relaxed);
+      });
+    }
+
+    it = m_pending_texture_dumps.erase(it);
+  }
 }
 
 // Helper for checking if a BPMemory TexMode0 register is set to Point
@@ -1227,7 +1459,8 @@ private:
 TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture_info)
 {
   // if this stage was not invalidated by changes to texture registers, keep the current texture
-  if (TMEM::IsValid(texture_info.GetStage()) && bound_textures[texture_info.GetStage()])
+  if (TMEM::IsValid(texture_info.GetStage()) && bound_textures[texture_info.GetStage()] &&
+      !bound_textures[texture_info.GetStage()]->IsCustomTextureReady())
   {
     TCacheEntry* entry = bound_textures[texture_info.GetStage()];
     // If the TMEM configuration is such that this texture is more or less guaranteed to still
@@ -1237,11 +1470,25 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture
       return entry;
     }
 
-    // Otherwise, hash the backing memory and check it's unchanged.
+    // Otherwise, hash the backing memory and check it's unchanged. If write tracking tells us
+    // nothing wrote to the memory since it was last hashed, even that can be skipped.
     // FIXME: this doesn't correctly handle textures from tmem.
-    if (!entry->tmem_only && entry->base_hash == entry->CalculateHash())
+    if (!entry->tmem_only)
     {
-      return entry;
+      auto& memory = Core::System::GetInstance().GetMemory();
+      if (!entry->IsCopy() &&
+          memory.IsRangeUnchanged(entry->addr, entry->size_in_bytes, entry->write_stamp))
+      {
+        return entry;
+      }
+
+      const u64 write_stamp =
+          entry->IsCopy() ? 0 : memory.WatchRange(entry->addr, entry->size_in_bytes);
+      if (entry->base_hash == entry->CalculateHash())
+      {
+        entry->write_stamp = write_stamp;
+        return entry;
+      }
     }
   }
 
@@ -1253,11 +1500,13 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture
   entry->frameCount = FRAMECOUNT_INVALID;
   if (entry->texture_info_name.empty() && g_ActiveConfig.bGraphicMods)
   {
-    entry->texture_info_name = texture_info.CalculateTextureName().GetFullName();
+    entry->texture_info_name =
+        texture_info.CalculateTextureName(g_ActiveConfig.texture_hash_version).GetFullName();
+    entry->texture_info_id = GraphicsModManager::GetTextureId(entry->texture_info_name);
 
     GraphicsModActionData::TextureLoad texture_load{entry->texture_info_name};
     for (const auto action :
-         g_renderer->GetGraphicsModManager().GetTextureLoadActions(entry->texture_info_name))
+         g_renderer->GetGraphicsModManager().GetTextureLoadActions(entry->texture_info_id))
     {
       action->OnTextureLoad(&texture_load);
     }
@@ -1315,17 +1564,46 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize,
         texture_info.GetRawAddress(), texture_info.GetFullLevelSize(), MemoryUpdate::TEXTURE_MAP);
   }
 
+  // If write tracking tells us that the memory of an entry at this address hasn't been written to
+  // since the entry was hashed, the hash is still valid and doesn't have to be computed again.
+  auto& memory = Core::System::GetInstance().GetMemory();
+  const u32 texture_size = texture_info.GetTextureSize();
+  u64 write_stamp = 0;
+  bool base_hash_known = false;
+  if (!texture_info.IsFromTmem() && memory.IsWriteTrackingEnabled())
+  {
+    const auto range = textures_by_address.equal_range(texture_info.GetRawAddress());
+    for (auto it = range.first; it != range.second; ++it)
+    {
+      const TCacheEntry* entry = it->second;
+      if (!entry->tmem_only && !entry->IsCopy() && entry->size_in_bytes == texture_size &&
+          memory.IsRangeUnchanged(entry->addr, texture_size, entry->write_stamp))
+      {
+        base_hash = entry->base_hash;
+        write_stamp = entry->write_stamp;
+        base_hash_known = true;
+        break;
+      }
+    }
+
+    if (!base_hash_known)
+      write_stamp = memory.WatchRange(texture_info.GetRawAddress(), texture_size);
+  }
+
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  if (!base_hash_known)
+  {
+    base_hash =
+        HashTextureData(texture_info.GetData(), texture_size, textureCacheSafetyColorSampleSize);
+  }
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
     palette_size = *texture_info.GetPaletteSize();
     full_hash =
-        base_hash ^ Common::GetHash64(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
-                                      textureCacheSafetyColorSampleSize);
+        base_hash ^ HashTextureData(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
+                                    textureCacheSafetyColorSampleSize);
   }
   else
   {
@@ -1453,6 +1731,15 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize,
           entry->native_width == texture_info.GetRawWidth() &&
           entry->native_height == texture_info.GetRawHeight())
       {
+        // The native texture was only a placeholder until the custom texture finished loading.
+        if (entry->IsCustomTextureReady())
+        {
+          iter = InvalidateTexture(iter);
+          continue;
+        }
+
+        if (!entry->IsCopy() && entry->size_in_bytes == texture_size)
+          entry->write_stamp = write_stamp;
         entry = DoPartialTextureUpdates(iter->second, texture_info.GetTlutAddress(),
                                         texture_info.GetTlutFormat());
         entry->texture->FinishedRendering();
@@ -1519,7 +1806,7 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize,
       // All parameters, except the address, need to match here
       if (entry->format == full_format && entry->native_levels >= texture_info.GetLevelCount() &&
           entry->native_width == texture_info.GetRawWidth() &&
-          entry->native_height == texture_info.GetRawHeight())
+          entry->native_height == texture_info.GetRawHeight() && !entry->IsCustomTextureReady())
       {
         entry = DoPartialTextureUpdates(hash_iter->second, texture_info.GetTlutAddress(),
                                         texture_info.GetTlutFormat());
@@ -1538,9 +1825,10 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize,
   }
 
   std::shared_ptr<HiresTexture> hires_tex;
+  std::string pending_custom_texture;
   if (g_ActiveConfig.bHiresTextures)
   {
-    hires_tex = HiresTexture::Search(texture_info);
+    hires_tex = HiresTexture::Search(texture_info, &pending_custom_texture);
 
     if (hires_tex)
     {
@@ -1642,7 +1930,7 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize,
     }
   }
 
-  iter = textures_by_address.emplace(texture_info.GetRawAddress(), entry);
+  iter = InsertTexture(texture_info.GetRawAddress(), entry);
   if (textureCacheSafetyColorSampleSize == 0 ||
       std::max(texture_info.GetTextureSize(), palette_size) <=
           (u32)textureCacheSafetyColorSampleSize * 8)
@@ -1655,7 +1943,9 @@ TextureCacheBase::GetTexture(const int textureCacheSafetyColorSampleSize,
   entry->SetDimensions(texture_info.GetRawWidth(), texture_info.GetRawHeight(),
                        texture_info.GetLevelCount());
   entry->SetHashes(base_hash, full_hash);
+  entry->write_stamp = write_stamp;
   entry->is_custom_tex = hires_tex != nullptr;
+  entry->pending_custom_texture = std::move(pending_custom_texture);
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
 
@@ -1798,7 +2088,7 @@ TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height, u32 stride,
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  textures_by_address.emplace(entry->addr, entry);
+  InsertTexture(entry->addr, entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -1808,13 +2098,14 @@ TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height, u32 stride,
     if (g_ActiveConfig.bGraphicMods)
     {
       entry->texture_info_name = fmt::format("{}_{}", XFB_DUMP_PREFIX, id);
+      entry->texture_info_id = GraphicsModManager::GetTextureId(entry->texture_info_name);
     }
 
     if (g_ActiveConfig.bDumpXFBTarget)
     {
-      entry->texture->Save(fmt::format("{}{}_n{:06}_{}.png", File::GetUserPath(D_DUMPTEXTURES_IDX),
-                                       XFB_DUMP_PREFIX, xfb_count++, id),
-                           0);
+      QueueTextureDump(entry->texture.get(), 0,
+                       fmt::format("{}{}_n{:06}_{}.png", File::GetUserPath(D_DUMPTEXTURES_IDX),
+                                   XFB_DUMP_PREFIX, xfb_count++, id));
     }
   }
 
@@ -1868,7 +2159,7 @@ void TextureCacheBase::StitchXFBCopy(TCacheEntry* stitched_entry)
   std::vector<TCacheEntry*> candidates;
   bool create_upscaled_copy = false;
 
-  auto iter = FindOverlappingTextures(stitched_entry->addr, stitched_entry->size_in_bytes);
+  auto iter = FindOverlappingCopies(stitched_entry->addr, stitched_entry->size_in_bytes);
   while (iter.first != iter.second)
   {
     // Currently, this checks the stride of the VRAM copy against the VI request. Therefore, for
@@ -1892,7 +2183,7 @@ void TextureCacheBase::StitchXFBCopy(TCacheEntry* stitched_entry)
       else
       {
         // If the hash does not match, this EFB copy will not be used for anything, so remove it
-        iter.first = InvalidateTexture(iter.first);
+        iter.first = InvalidateCopy(iter.first);
         continue;
       }
     }
@@ -2257,14 +2548,14 @@ void TextureCacheBase::CopyRenderTargetToTexture(
         if (g_ActiveConfig.bGraphicMods)
         {
           entry->texture_info_name = fmt::format("{}_{}", XFB_DUMP_PREFIX, id);
+          entry->texture_info_id = GraphicsModManager::GetTextureId(entry->texture_info_name);
         }
 
         if (g_ActiveConfig.bDumpXFBTarget)
         {
-          entry->texture->Save(fmt::format("{}{}_n{:06}_{}.png",
-                                           File::GetUserPath(D_DUMPTEXTURES_IDX), XFB_DUMP_PREFIX,
-                                           xfb_count++, id),
-                               0);
+          QueueTextureDump(entry->texture.get(), 0,
+                           fmt::format("{}{}_n{:06}_{}.png", File::GetUserPath(D_DUMPTEXTURES_IDX),
+                                       XFB_DUMP_PREFIX, xfb_count++, id));
         }
       }
       else if (g_ActiveConfig.bDumpEFBTarget || g_ActiveConfig.bGraphicMods)
@@ -2273,15 +2564,15 @@ void TextureCacheBase::CopyRenderTargetToTexture(
         if (g_ActiveConfig.bGraphicMods)
         {
           entry->texture_info_name = fmt::format("{}_{}", EFB_DUMP_PREFIX, id);
+          entry->texture_info_id = GraphicsModManager::GetTextureId(entry->texture_info_name);
         }
 
         if (g_ActiveConfig.bDumpEFBTarget)
         {
           static int efb_count = 0;
-          entry->texture->Save(fmt::format("{}{}_n{:06}_{}.png",
-                                           File::GetUserPath(D_DUMPTEXTURES_IDX), EFB_DUMP_PREFIX,
-                                           efb_count++, id),
-                               0);
+          QueueTextureDump(entry->texture.get(), 0,
+                           fmt::format("{}{}_n{:06}_{}.png", File::GetUserPath(D_DUMPTEXTURES_IDX),
+                                       EFB_DUMP_PREFIX, efb_count++, id));
         }
       }
     }
@@ -2307,6 +2598,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
         // Immediately flush it.
         WriteEFBCopyToRAM(dst, bytes_per_row / sizeof(u32), num_blocks_y, dstStride,
                           std::move(staging_texture));
+        memory.MarkWritten(dstAddr, num_blocks_y * dstStride);
       }
       else
       {
@@ -2315,6 +2607,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
         entry->pending_efb_copy_width = bytes_per_row / sizeof(u32);
         entry->pending_efb_copy_height = num_blocks_y;
         entry->pending_efb_copy_invalidated = false;
+        entry->pending_efb_copy_overdue = false;
         m_pending_efb_copies.push_back(entry);
       }
     }
@@ -2412,7 +2705,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    textures_by_address.emplace(dstAddr, entry);
+    InsertTexture(dstAddr, entry);
   }
 }
 
@@ -2426,6 +2719,25 @@ void TextureCacheBase::FlushEFBCopies()
   m_pending_efb_copies.clear();
 }
 
+void TextureCacheBase::FlushCompletedEFBCopies()
+{
+  // Copies have to reach RAM in the order they were made, in case they overlap. The GPU completes
+  // them in order as well, so everything after the first copy which isn't done yet is kept.
+  auto keep_begin = m_pending_efb_copies.begin();
+  for (; keep_begin != m_pending_efb_copies.end(); ++keep_begin)
+  {
+    TCacheEntry* entry = *keep_begin;
+    if (!entry->pending_efb_copy_overdue && !entry->pending_efb_copy->IsCopyComplete())
+      break;
+
+    FlushEFBCopy(entry);
+  }
+
+  m_pending_efb_copies.erase(m_pending_efb_copies.begin(), keep_begin);
+  for (TCacheEntry* entry : m_pending_efb_copies)
+    entry->pending_efb_copy_overdue = true;
+}
+
 void TextureCacheBase::WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32 stride,
                                          std::unique_ptr<AbstractStagingTexture> staging_texture)
 {
@@ -2442,6 +2754,7 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   u8* const dst = memory.GetPointer(entry->addr);
   WriteEFBCopyToRAM(dst, entry->pending_efb_copy_width, entry->pending_efb_copy_height,
                     entry->memory_stride, std::move(entry->pending_efb_copy));
+  memory.MarkWritten(entry->addr, entry->pending_efb_copy_height * entry->memory_stride);
 
   // If the EFB copy was invalidated (e.g. the bloom case mentioned in InvalidateTexture), now is
   // the time to clean up the TCacheEntry. In which case, we don't need to compute the new hash of
@@ -2462,7 +2775,7 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   if (entry->is_xfb_copy)
   {
     const u32 covered_range = entry->pending_efb_copy_height * entry->memory_stride;
-    auto range = FindOverlappingTextures(entry->addr, covered_range);
+    auto range = FindOverlappingCopies(entry->addr, covered_range);
     for (auto iter = range.first; iter != range.second; ++iter)
     {
       TCacheEntry* overlapping_entry = iter->second;
@@ -2564,6 +2877,7 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::AllocateCacheEntry(const Textur
   TCacheEntry* cacheEntry =
       new TCacheEntry(std::move(alloc->texture), std::move(alloc->framebuffer));
   cacheEntry->textures_by_hash_iter = textures_by_hash.end();
+  cacheEntry->copies_by_address_iter = copies_by_address.end();
   cacheEntry->id = last_entry_id++;
   return cacheEntry;
 }
@@ -2651,6 +2965,18 @@ TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
   return std::make_pair(begin, end);
 }
 
+std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
+TextureCacheBase::FindOverlappingCopies(u32 addr, u32 size_in_bytes)
+{
+  // Same as above, but only the copies are searched, and the size of the largest copy in the cache
+  // is used instead of the maximal texture size.
+  const u32 lower_addr = addr > max_copy_size_in_bytes ? addr - max_copy_size_in_bytes : 0;
+  auto begin = copies_by_address.lower_bound(lower_addr);
+  auto end = copies_by_address.upper_bound(addr + size_in_bytes);
+
+  return std::make_pair(begin, end);
+}
+
 TextureCacheBase::TexAddrCache::iterator
 TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pending_efb_copy)
 {
@@ -2675,6 +3001,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
         // as invalidated. This way it can still be used via tmem cache emulation, but nothing else.
         // Spyro: A Hero's Tail is known for using such overwritten textures.
         bound_textures[i]->tmem_only = true;
+        bound_textures[i]->UnlinkConvertedCopies();
         return ++iter;
       }
       else
@@ -2715,6 +3042,14 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
   texture_pool.emplace(config,
                        TexPoolEntry(std::move(entry->texture), std::move(entry->framebuffer)));
 
+  if (entry->copies_by_address_iter != copies_by_address.end())
+  {
+    copies_by_address.erase(entry->copies_by_address_iter);
+    entry->copies_by_address_iter = copies_by_address.end();
+    if (copies_by_address.empty())
+      max_copy_size_in_bytes = 0;
+  }
+
   // Don't delete if there's a pending EFB copy, as we need the TCacheEntry alive.
   if (!entry->pending_efb_copy)
     delete entry;
@@ -2722,6 +3057,27 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
   return textures_by_address.erase(iter);
 }
 
+TextureCacheBase::TexAddrCache::iterator
+TextureCacheBase::InvalidateCopy(TexAddrCache::iterator copy_iter)
+{
+  TCacheEntry* entry = copy_iter->second;
+  ++copy_iter;
+  InvalidateTexture(GetTexCacheIter(entry));
+  return copy_iter;
+}
+
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::InsertTexture(u32 addr,
+                                                                         TCacheEntry* entry)
+{
+  if (entry->IsCopy())
+  {
+    entry->copies_by_address_iter = copies_by_address.emplace(addr, entry);
+    max_copy_size_in_bytes = std::max(max_copy_size_in_bytes, entry->size_in_bytes);
+  }
+
+  return textures_by_address.emplace(addr, entry);
+}
+
 bool TextureCacheBase::CreateUtilityTextures()
 {
   constexpr TextureConfig encoding_texture_config(
@@ -3046,7 +3402,7 @@ u64 TextureCacheBase::TCacheEntry::CalculateHash() const
   u8* ptr = memory.GetPointer(addr);
   if (memory_stride == bytes_per_row)
   {
-    return Common::GetHash64(ptr, size_in_bytes, hash_sample_size);
+    return HashTextureData(ptr, size_in_bytes, hash_sample_size);
   }
   else
   {
@@ -3065,7 +3421,7 @@ u64 TextureCacheBase::TCacheEntry::CalculateHash() const
     {
       // Multiply by a prime number to mix the hash up a bit. This prevents identical blocks from
       // canceling each other out
-      temp_hash = (temp_hash * 397) ^ Common::GetHash64(ptr, bytes_per_row, samples_per_row);
+      temp_hash = (temp_hash * 397) ^ HashTextureData(ptr, bytes_per_row, samples_per_row);
       ptr += memory_stride;
     }
     return temp_hash;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <bitset>
 #include <fmt/format.h>
 #include <map>
@@ -19,6 +20,7 @@
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
+#include "Common/ThreadPool.h"
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/TextureConfig.h"
@@ -28,6 +30,7 @@
 class AbstractFramebuffer;
 class AbstractStagingTexture;
 class PointerWrap;
+enum class TextureHashVersion : int;
 struct VideoConfig;
 
 constexpr std::string_view EFB_DUMP_PREFIX = "efb1";
@@ -118,6 +121,8 @@ public:
     u32 size_in_bytes = 0;
     u64 base_hash = 0;
     u64 hash = 0;  // for paletted textures, hash = base_hash ^ palette_hash
+    // Write tracking stamp from when base_hash was computed, 0 if the memory isn't tracked
+    u64 write_stamp = 0;
     TextureAndTLUTFormat format;
     u32 memory_stride = 0;
     bool is_efb_copy = false;
@@ -144,19 +149,33 @@ public:
     // Keep an iterator to the entry in textures_by_hash, so it does not need to be searched when
     // removing the cache entry
     std::multimap<u64, TCacheEntry*>::iterator textures_by_hash_iter;
+    // Same for copies_by_address, which only contains EFB and XFB copies
+    std::multimap<u32, TCacheEntry*>::iterator copies_by_address_iter;
 
     // This is used to keep track of both:
     //   * efb copies used by this partially updated texture
     //   * partially updated textures which refer to this efb copy
     std::unordered_set<TCacheEntry*> references;
 
+    // Palette-applied and reinterpreted versions of this entry, keyed by TLUT hash and format.
+    // They are reused until either entry is removed from the cache.
+    std::map<std::tuple<u64, TextureFormat, TLUTFormat>, TCacheEntry*> converted_copies;
+    TCacheEntry* conversion_source = nullptr;
+
     // Pending EFB copy
     std::unique_ptr<AbstractStagingTexture> pending_efb_copy;
     u32 pending_efb_copy_width = 0;
     u32 pending_efb_copy_height = 0;
     bool pending_efb_copy_invalidated = false;
+    // Set once the copy has been kept pending over the end of a frame.
+    bool pending_efb_copy_overdue = false;
 
     std::string texture_info_name = "";
+    // GraphicsModManager::GetTextureId of texture_info_name
+    u64 texture_info_id = 0;
+
+    // Name of the custom texture being loaded in the background to replace this one, if any
+    std::string pending_custom_texture;
 
     explicit TCacheEntry(std::unique_ptr<AbstractTexture> tex,
                          std::unique_ptr<AbstractFramebuffer> fb);
@@ -185,6 +204,7 @@ public:
     {
       base_hash = _base_hash;
       hash = _hash;
+      write_stamp = 0;
     }
 
     // This texture entry is used by the other entry as a sub-texture
@@ -195,12 +215,24 @@ public:
       other_entry->references.emplace(this);
     }
 
+    // Records other_entry as the conversion of this entry for the given TLUT hash and format
+    void AddConvertedCopy(u64 tlut_hash, TextureFormat texfmt, TLUTFormat tlutfmt,
+                          TCacheEntry* other_entry)
+    {
+      converted_copies[{tlut_hash, texfmt, tlutfmt}] = other_entry;
+      other_entry->conversion_source = this;
+    }
+    void UnlinkConvertedCopies();
+
     void SetXfbCopy(u32 stride);
     void SetEfbCopy(u32 stride);
     void SetNotCopy();
 
     bool OverlapsMemoryRange(u32 range_address, u32 range_size) const;
 
+    // Whether the custom texture for this entry has finished loading, so it should be replaced
+    bool IsCustomTextureReady() const;
+
     bool IsEfbCopy() const { return is_efb_copy; }
     bool IsCopy() const { return is_xfb_copy || is_efb_copy; }
     u32 NumBlocksX() const;
@@ -261,6 +293,11 @@ public:
   // Flushes all pending EFB copies to emulated RAM.
   void FlushEFBCopies();
 
+  // Flushes the pending EFB copies which the GPU has already finished, plus any which were kept
+  // pending at the end of the previous frame. Lets the readback overlap with the next frame, while
+  // the copies still reach RAM within a frame when the game doesn't synchronize with the GPU.
+  void FlushCompletedEFBCopies();
+
   // Texture Serialization
   void SerializeTexture(AbstractTexture* tex, const TextureConfig& config, PointerWrap& p);
   std::optional<TexPoolEntry> DeserializeTexture(PointerWrap& p);
@@ -312,7 +349,7 @@ private:
 
   TCacheEntry* ApplyPaletteToEntry(TCacheEntry* entry, const u8* palette, TLUTFormat tlutfmt);
 
-  TCacheEntry* ReinterpretEntry(const TCacheEntry* existing_entry, TextureFormat new_format);
+  TCacheEntry* ReinterpretEntry(TCacheEntry* existing_entry, TextureFormat new_format);
 
   TCacheEntry* DoPartialTextureUpdates(TCacheEntry* entry_to_update, const u8* palette,
                                        TLUTFormat tlutfmt);
@@ -323,6 +360,9 @@ private:
 
   TCacheEntry* AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
+  // Frees the least recently used textures when the cache is above the configured memory budget,
+  // and updates the memory usage statistics.
+  void EnforceMemoryBudget(int frame_count);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
@@ -330,10 +370,18 @@ private:
   // indexed, this may return false positives.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
   FindOverlappingTextures(u32 addr, u32 size_in_bytes);
+  // Return all possible overlapping EFB and XFB copies, as iterators into copies_by_address.
+  std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
+  FindOverlappingCopies(u32 addr, u32 size_in_bytes);
+
+  // Adds a texture to textures_by_address, and to copies_by_address if it is a copy
+  TexAddrCache::iterator InsertTexture(u32 addr, TCacheEntry* entry);
 
   // Removes and unlinks texture from texture cache and returns it to the pool
   TexAddrCache::iterator InvalidateTexture(TexAddrCache::iterator t_iter,
                                            bool discard_pending_efb_copy = false);
+  // Same as above, but takes and returns an iterator into copies_by_address
+  TexAddrCache::iterator InvalidateCopy(TexAddrCache::iterator copy_iter);
 
   void UninitializeEFBMemory(u8* dst, u32 stride, u32 bytes_per_row, u32 num_blocks_y);
   void UninitializeXFBMemory(u8* dst, u32 stride, u32 bytes_per_row, u32 num_blocks_y);
@@ -355,12 +403,24 @@ private:
   // Returns an EFB copy staging texture to the pool, so it can be re-used.
   void ReleaseEFBCopyStagingTexture(std::unique_ptr<AbstractStagingTexture> tex);
 
+  // Starts reading back a level of the texture, which is written to filename as a PNG once the
+  // GPU has finished the copy. The encoding happens on the shared thread pool.
+  void QueueTextureDump(const AbstractTexture* texture, u32 level, std::string filename);
+  // Hands the texture dumps whose readback is complete over to the thread pool. If wait is set,
+  // waits for all of them instead.
+  void ProcessPendingTextureDumps(bool wait);
+
   bool CheckReadbackTexture(u32 width, u32 height, AbstractTextureFormat format);
   void DoSaveState(PointerWrap& p);
   void DoLoadState(PointerWrap& p);
 
   TexAddrCache textures_by_address;
   TexHashCache textures_by_hash;
+  // EFB and XFB copies only, so the partial texture updates don't need to skip over all the
+  // regular textures in the same memory range.
+  TexAddrCache copies_by_address;
+  // Size of the largest copy in copies_by_address, bounds how far below an address to search
+  u32 max_copy_size_in_bytes = 0;
   TexPool texture_pool;
   u64 last_entry_id = 0;
 
@@ -380,6 +440,7 @@ private:
     bool arbitrary_mipmap_detection;
     bool graphics_mods;
     u32 graphics_mod_change_count;
+    TextureHashVersion texture_hash_version;
   };
   BackupConfig backup_config = {};
 
@@ -401,6 +462,20 @@ private:
   // We store this in the class so that the same staging texture can be used for multiple
   // readbacks, saving the overhead of allocating a new buffer every time.
   std::unique_ptr<AbstractStagingTexture> m_readback_texture;
+
+  struct PendingTextureDump
+  {
+    std::unique_ptr<AbstractStagingTexture> readback_texture;
+    std::string filename;
+    u32 width;
+    u32 height;
+  };
+  // Texture dumps which are waiting for their readback to complete.
+  std::vector<PendingTextureDump> m_pending_texture_dumps;
+  // Texture dumps which have been queued this session, so each is only read back once.
+  std::unordered_set<std::string> m_queued_texture_dumps;
+  Common::TaskGroup m_texture_dump_encodes{Common::ThreadPool::Priority::Low};
+  std::atomic<u32> m_texture_dump_encodes_in_flight = 0;
 };
 
 extern std::unique_ptr<TextureCacheBase> g_texture_cache;
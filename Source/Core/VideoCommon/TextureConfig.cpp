@@ -38,3 +38,16 @@ size_t TextureConfig::GetMipStride(u32 level) const
 {
   return AbstractTexture::CalculateStrideForFormat(format, std::max(width >> level, 1u));
 }
+
+size_t TextureConfig::GetMemorySize() const
+{
+  // The stride of compressed formats covers a whole row of blocks.
+  const u32 block_size = AbstractTexture::GetBlockSizeForFormat(format);
+  size_t size = 0;
+  for (u32 level = 0; level < levels; level++)
+  {
+    const u32 rows = std::max((std::max(height >> level, 1u) + block_size - 1) / block_size, 1u);
+    size += GetMipStride(level) * rows;
+  }
+  return size * layers * samples;
+}
@@ -37,6 +37,7 @@ enum AbstractTextureFlag : u32
 {
   AbstractTextureFlag_RenderTarget = (1 << 0),  // Texture is used as a framebuffer.
   AbstractTextureFlag_ComputeImage = (1 << 1),  // Texture is used as a compute image.
+  AbstractTextureFlag_Multiview = (1 << 2),     // All layers are rendered in a single pass.
 };
 
 struct TextureConfig
@@ -55,10 +56,13 @@ struct TextureConfig
   MathUtil::Rectangle<int> GetMipRect(u32 level) const;
   size_t GetStride() const;
   size_t GetMipStride(u32 level) const;
+  // Approximate amount of memory used by a texture with this config, ignoring driver overhead
+  size_t GetMemorySize() const;
 
   bool IsMultisampled() const { return samples > 1; }
   bool IsRenderTarget() const { return (flags & AbstractTextureFlag_RenderTarget) != 0; }
   bool IsComputeImage() const { return (flags & AbstractTextureFlag_ComputeImage) != 0; }
+  bool IsMultiview() const { return (flags & AbstractTextureFlag_Multiview) != 0; }
 
   u32 width = 0;
   u32 height = 0;
@@ -14,6 +14,10 @@
 #include "VideoCommon/TextureDecoder_Util.h"
 #include "VideoCommon/VideoConfig.h"
 
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
 // GameCube/Wii texture decoder
 
 // Decodes all known GameCube/Wii texture formats.
@@ -141,10 +145,9 @@ static inline void DecodeBytes_RGBA8(u32* dst, const u16* src, const u16* src2)
 #endif
 }
 
-static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+static inline void DecodeDXTColors(const DXTBlock* src, u32 colors[4])
 {
   // S3TC Decoder (Note: GCN decodes differently from PC so we can't use native support)
-  // Needs more speed.
   u16 c1 = Common::swap16(src->color1);
   u16 c2 = Common::swap16(src->color2);
   int blue1 = Convert5To8(c1 & 0x1F);
@@ -153,7 +156,6 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
   int green2 = Convert6To8((c2 >> 5) & 0x3F);
   int red1 = Convert5To8((c1 >> 11) & 0x1F);
   int red2 = Convert5To8((c2 >> 11) & 0x1F);
-  int colors[4];
   colors[0] = MakeRGBA(red1, green1, blue1, 255);
   colors[1] = MakeRGBA(red2, green2, blue2, 255);
   if (c1 > c2)
@@ -170,6 +172,12 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
     colors[2] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 255);
     colors[3] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 0);
   }
+}
+
+static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+{
+  u32 colors[4];
+  DecodeDXTColors(src, colors);
 
   for (int y = 0; y < 4; y++)
   {
@@ -183,6 +191,285 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
   }
 }
 
+#ifdef _M_ARM_64
+// NEON is always available on AArch64, so these don't need a runtime check.
+
+// Converts eight 16-bit texels to RGBA8. The first half of the result holds texels 0-3, the second
+// half texels 4-7.
+static inline uint16x8x2_t DecodePixels_IA8_NEON(uint16x8_t val)
+{
+  const uint16x8_t a = vandq_u16(val, vdupq_n_u16(0xFF));
+  const uint16x8_t i = vshrq_n_u16(val, 8);
+  const uint16x8_t rg = vorrq_u16(i, vshlq_n_u16(i, 8));
+  const uint16x8_t ba = vorrq_u16(i, vshlq_n_u16(a, 8));
+  return vzipq_u16(rg, ba);
+}
+
+// Expects texels which are already byteswapped.
+static inline uint16x8x2_t DecodePixels_RGB565_NEON(uint16x8_t val)
+{
+  const uint16x8_t r5 = vshrq_n_u16(val, 11);
+  const uint16x8_t g6 = vandq_u16(vshrq_n_u16(val, 5), vdupq_n_u16(0x3F));
+  const uint16x8_t b5 = vandq_u16(val, vdupq_n_u16(0x1F));
+  const uint16x8_t r = vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2));
+  const uint16x8_t g = vorrq_u16(vshlq_n_u16(g6, 2), vshrq_n_u16(g6, 4));
+  const uint16x8_t b = vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2));
+  const uint16x8_t rg = vorrq_u16(r, vshlq_n_u16(g, 8));
+  const uint16x8_t ba = vorrq_u16(b, vdupq_n_u16(0xFF00));
+  return vzipq_u16(rg, ba);
+}
+
+// Expects texels which are already byteswapped.
+static inline uint16x8x2_t DecodePixels_RGB5A3_NEON(uint16x8_t val)
+{
+  const uint16x8_t mask5 = vdupq_n_u16(0x1F);
+  const uint16x8_t mask4 = vdupq_n_u16(0xF);
+
+  // RGB555
+  const uint16x8_t r5 = vandq_u16(vshrq_n_u16(val, 10), mask5);
+  const uint16x8_t g5 = vandq_u16(vshrq_n_u16(val, 5), mask5);
+  const uint16x8_t b5 = vandq_u16(val, mask5);
+  const uint16x8_t rg555 = vorrq_u16(vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2)),
+                                     vshlq_n_u16(vorrq_u16(vshlq_n_u16(g5, 3), vshrq_n_u16(g5, 2)), 8));
+  const uint16x8_t ba555 =
+      vorrq_u16(vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2)), vdupq_n_u16(0xFF00));
+
+  // RGB4A3
+  const uint16x8_t a3 = vandq_u16(vshrq_n_u16(val, 12), vdupq_n_u16(0x7));
+  const uint16x8_t r4 = vandq_u16(vshrq_n_u16(val, 8), mask4);
+  const uint16x8_t g4 = vandq_u16(vshrq_n_u16(val, 4), mask4);
+  const uint16x8_t b4 = vandq_u16(val, mask4);
+  const uint16x8_t a = vorrq_u16(vorrq_u16(vshlq_n_u16(a3, 5), vshlq_n_u16(a3, 2)), vshrq_n_u16(a3, 1));
+  const uint16x8_t rg4443 = vorrq_u16(vmulq_n_u16(r4, 0x11), vshlq_n_u16(vmulq_n_u16(g4, 0x11), 8));
+  const uint16x8_t ba4443 = vorrq_u16(vmulq_n_u16(b4, 0x11), vshlq_n_u16(a, 8));
+
+  const uint16x8_t is_rgb555 = vtstq_u16(val, vdupq_n_u16(0x8000));
+  return vzipq_u16(vbslq_u16(is_rgb555, rg555, rg4443), vbslq_u16(is_rgb555, ba555, ba4443));
+}
+
+static inline uint16x8x2_t DecodePixels_Paletted_NEON(const u16* pixels, TLUTFormat tlutfmt)
+{
+  const uint16x8_t val = vld1q_u16(pixels);
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    return DecodePixels_IA8_NEON(val);
+  case TLUTFormat::RGB565:
+    return DecodePixels_RGB565_NEON(vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(val))));
+  case TLUTFormat::RGB5A3:
+    return DecodePixels_RGB5A3_NEON(vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(val))));
+  default:
+    return {vdupq_n_u16(0), vdupq_n_u16(0)};
+  }
+}
+
+static inline void StorePixels_NEON(u32* dst, uint16x8_t pixels)
+{
+  vst1q_u32(dst, vreinterpretq_u32_u16(pixels));
+}
+
+static void DecodeDXTBlock_NEON(u32* dst, const DXTBlock* src, int pitch)
+{
+  u32 colors[4];
+  DecodeDXTColors(src, colors);
+
+  // Look up the bytes of the colors with a table lookup, 4 texels at a time. Texel x of a line
+  // uses bits (7 - 2x) and (6 - 2x) as its index.
+  alignas(16) static constexpr s8 index_shifts[16] = {-6, -6, -6, -6, -4, -4, -4, -4,
+                                                      -2, -2, -2, -2, 0,  0,  0,  0};
+  const uint8x16_t palette = vreinterpretq_u8_u32(vld1q_u32(colors));
+  const int8x16_t shifts = vld1q_s8(index_shifts);
+  const uint8x16_t byte_offsets = vreinterpretq_u8_u32(vdupq_n_u32(0x03020100));
+
+  for (int y = 0; y < 4; y++)
+  {
+    const uint8x16_t line = vdupq_n_u8(src->lines[y]);
+    const uint8x16_t index = vandq_u8(vshlq_u8(line, shifts), vdupq_n_u8(3));
+    const uint8x16_t offsets = vorrq_u8(vshlq_n_u8(index, 2), byte_offsets);
+    vst1q_u8(reinterpret_cast<u8*>(dst), vqtbl1q_u8(palette, offsets));
+    dst += pitch;
+  }
+}
+
+// Returns false for formats which don't have a NEON decoder.
+static bool TexDecoder_DecodeImpl_NEON(u32* dst, const u8* src, int width, int height,
+                                       TextureFormat texformat, const u8* tlut_,
+                                       TLUTFormat tlutfmt)
+{
+  const u16* tlut = reinterpret_cast<const u16*>(tlut_);
+
+  switch (texformat)
+  {
+  case TextureFormat::C4:
+    for (int y = 0; y < height; y += 8)
+    {
+      for (int x = 0; x < width; x += 8)
+      {
+        for (int iy = 0; iy < 8; iy++, src += 4)
+        {
+          u16 texels[8];
+          for (int ix = 0; ix < 4; ix++)
+          {
+            texels[ix * 2] = tlut[src[ix] >> 4];
+            texels[ix * 2 + 1] = tlut[src[ix] & 0xF];
+          }
+          const uint16x8x2_t pixels = DecodePixels_Paletted_NEON(texels, tlutfmt);
+          StorePixels_NEON(dst + (y + iy) * width + x, pixels.val[0]);
+          StorePixels_NEON(dst + (y + iy) * width + x + 4, pixels.val[1]);
+        }
+      }
+    }
+    return true;
+
+  case TextureFormat::I4:
+    for (int y = 0; y < height; y += 8)
+    {
+      for (int x = 0; x < width; x += 8)
+      {
+        // Two lines of 8 texels at a time
+        for (int iy = 0; iy < 8; iy += 2, src += 8)
+        {
+          const uint8x8_t val = vld1_u8(src);
+          const uint8x8x2_t i4 = vzip_u8(vshr_n_u8(val, 4), vand_u8(val, vdup_n_u8(0xF)));
+          for (int line = 0; line < 2; line++)
+          {
+            const uint8x8_t i = vorr_u8(vshl_n_u8(i4.val[line], 4), i4.val[line]);
+            const uint8x8x4_t pixels = {{i, i, i, i}};
+            vst4_u8(reinterpret_cast<u8*>(dst + (y + iy + line) * width + x), pixels);
+          }
+        }
+      }
+    }
+    return true;
+
+  case TextureFormat::I8:
+    for (int y = 0; y < height; y += 4)
+    {
+      for (int x = 0; x < width; x += 8)
+      {
+        for (int iy = 0; iy < 4; iy++, src += 8)
+        {
+          const uint8x8_t i = vld1_u8(src);
+          const uint8x8x4_t pixels = {{i, i, i, i}};
+          vst4_u8(reinterpret_cast<u8*>(dst + (y + iy) * width + x), pixels);
+        }
+      }
+    }
+    return true;
+
+  case TextureFormat::C8:
+    for (int y = 0; y < height; y += 4)
+    {
+      for (int x = 0; x < width; x += 8)
+      {
+        for (int iy = 0; iy < 4; iy++, src += 8)
+        {
+          u16 texels[8];
+          for (int ix = 0; ix < 8; ix++)
+            texels[ix] = tlut[src[ix]];
+          const uint16x8x2_t pixels = DecodePixels_Paletted_NEON(texels, tlutfmt);
+          StorePixels_NEON(dst + (y + iy) * width + x, pixels.val[0]);
+          StorePixels_NEON(dst + (y + iy) * width + x + 4, pixels.val[1]);
+        }
+      }
+    }
+    return true;
+
+  case TextureFormat::IA4:
+    for (int y = 0; y < height; y += 4)
+    {
+      for (int x = 0; x < width; x += 8)
+      {
+        for (int iy = 0; iy < 4; iy++, src += 8)
+        {
+          const uint8x8_t val = vld1_u8(src);
+          const uint8x8_t a = vorr_u8(vand_u8(val, vdup_n_u8(0xF0)), vshr_n_u8(val, 4));
+          const uint8x8_t l = vorr_u8(vshl_n_u8(val, 4), vand_u8(val, vdup_n_u8(0xF)));
+          const uint8x8x4_t pixels = {{l, l, l, a}};
+          vst4_u8(reinterpret_cast<u8*>(dst + (y + iy) * width + x), pixels);
+        }
+      }
+    }
+    return true;
+
+  case TextureFormat::IA8:
+  case TextureFormat::RGB565:
+  case TextureFormat::RGB5A3:
+  case TextureFormat::C14X2:
+    // 4x4 blocks of 16-bit texels. Two lines of 4 texels at a time.
+    for (int y = 0; y < height; y += 4)
+    {
+      for (int x = 0; x < width; x += 4)
+      {
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+        {
+          uint16x8x2_t pixels;
+          if (texformat == TextureFormat::C14X2)
+          {
+            u16 texels[8];
+            for (int ix = 0; ix < 8; ix++)
+              texels[ix] = tlut[Common::swap16(src + ix * 2) & 0x3FFF];
+            pixels = DecodePixels_Paletted_NEON(texels, tlutfmt);
+          }
+          else if (texformat == TextureFormat::IA8)
+          {
+            pixels = DecodePixels_IA8_NEON(vld1q_u16(reinterpret_cast<const u16*>(src)));
+          }
+          else
+          {
+            const uint16x8_t val = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(src)));
+            pixels = texformat == TextureFormat::RGB565 ? DecodePixels_RGB565_NEON(val) :
+                                                          DecodePixels_RGB5A3_NEON(val);
+          }
+          StorePixels_NEON(dst + (y + iy) * width + x, pixels.val[0]);
+          StorePixels_NEON(dst + (y + iy + 1) * width + x, pixels.val[1]);
+        }
+      }
+    }
+    return true;
+
+  case TextureFormat::RGBA8:
+  {
+    // A block stores the AR pairs of all its texels, followed by the GB pairs.
+    alignas(16) static constexpr u8 shuffle[16] = {1, 8, 9, 0, 3, 10, 11, 2,
+                                                   5, 12, 13, 4, 7, 14, 15, 6};
+    const uint8x16_t mask = vld1q_u8(shuffle);
+    for (int y = 0; y < height; y += 4)
+    {
+      for (int x = 0; x < width; x += 4, src += 64)
+      {
+        for (int iy = 0; iy < 4; iy++)
+        {
+          const uint8x16_t argb = vcombine_u8(vld1_u8(src + 8 * iy), vld1_u8(src + 32 + 8 * iy));
+          vst1q_u8(reinterpret_cast<u8*>(dst + (y + iy) * width + x), vqtbl1q_u8(argb, mask));
+        }
+      }
+    }
+    return true;
+  }
+
+  case TextureFormat::CMPR:
+  {
+    const DXTBlock* block = reinterpret_cast<const DXTBlock*>(src);
+    for (int y = 0; y < height; y += 8)
+    {
+      for (int x = 0; x < width; x += 8, block += 4)
+      {
+        DecodeDXTBlock_NEON(dst + y * width + x, block, width);
+        DecodeDXTBlock_NEON(dst + y * width + x + 4, block + 1, width);
+        DecodeDXTBlock_NEON(dst + (y + 4) * width + x, block + 2, width);
+        DecodeDXTBlock_NEON(dst + (y + 4) * width + x + 4, block + 3, width);
+      }
+    }
+    return true;
+  }
+
+  default:
+    return false;
+  }
+}
+#endif
+
 // JSD 01/06/11:
 // TODO: we really should ensure BOTH the source and destination addresses are aligned to 16-byte
 // boundaries to
@@ -197,6 +484,11 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
+#ifdef _M_ARM_64
+  if (TexDecoder_DecodeImpl_NEON(dst, src, width, height, texformat, tlut, tlutfmt))
+    return;
+#endif
+
   const int Wsteps4 = (width + 3) / 4;
   const int Wsteps8 = (width + 7) / 8;
 
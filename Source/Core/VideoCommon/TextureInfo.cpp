@@ -11,6 +11,7 @@
 #include "Core/System.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/VideoConfig.h"
 
 TextureInfo TextureInfo::FromStage(u32 stage)
 {
@@ -103,7 +104,7 @@ std::string TextureInfo::NameDetails::GetFullName() const
   return fmt::format("{}_{}{}_{}", base_name, texture_name, tlut_name, format_name);
 }
 
-TextureInfo::NameDetails TextureInfo::CalculateTextureName() const
+TextureInfo::NameDetails TextureInfo::CalculateTextureName(TextureHashVersion hash_version) const
 {
   if (!m_ptr)
     return NameDetails{};
@@ -155,12 +156,17 @@ TextureInfo::NameDetails TextureInfo::CalculateTextureName() const
     tlut += 2 * min;
   }
 
-  const u64 tex_hash = XXH64(m_ptr, m_texture_size, 0);
-  const u64 tlut_hash = tlut_size ? XXH64(tlut, tlut_size, 0) : 0;
+  const bool use_xxh3 = hash_version == TextureHashVersion::XXH3;
+  const auto hash = [use_xxh3](const u8* data, size_t size) -> u64 {
+    return use_xxh3 ? XXH3_64bits(data, size) : XXH64(data, size, 0);
+  };
+  const u64 tex_hash = hash(m_ptr, m_texture_size);
+  const u64 tlut_hash = tlut_size ? hash(tlut, tlut_size) : 0;
 
   NameDetails result;
-  result.base_name = fmt::format("{}{}x{}{}", format_prefix, m_raw_width, m_raw_height,
-                                 m_mipmaps_enabled ? "_m" : "");
+  result.base_name =
+      fmt::format("{}{}x{}{}", use_xxh3 ? xxh3_format_prefix : legacy_format_prefix, m_raw_width,
+                  m_raw_height, m_mipmaps_enabled ? "_m" : "");
   result.texture_name = fmt::format("{:016x}", tex_hash);
   result.tlut_name = tlut_size ? fmt::format("_{:016x}", tlut_hash) : "";
   result.format_name = fmt::to_string(static_cast<int>(m_texture_format));
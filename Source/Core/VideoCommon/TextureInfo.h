@@ -11,6 +11,7 @@
 #include "Common/CommonTypes.h"
 
 enum class TextureFormat;
+enum class TextureHashVersion : int;
 enum class TLUTFormat;
 
 class TextureInfo
@@ -31,7 +32,7 @@ public:
 
     std::string GetFullName() const;
   };
-  NameDetails CalculateTextureName() const;
+  NameDetails CalculateTextureName(TextureHashVersion hash_version) const;
 
   const u8* GetData() const;
   const u8* GetTlutAddress() const;
@@ -91,7 +92,8 @@ public:
   const MipLevel* GetMipMapLevel(u32 level) const;
   u32 GetFullLevelSize() const;
 
-  static constexpr std::string_view format_prefix{"tex1_"};
+  static constexpr std::string_view legacy_format_prefix{"tex1_"};
+  static constexpr std::string_view xxh3_format_prefix{"tex2_"};
 
 private:
   const u8* m_ptr;
@@ -0,0 +1,185 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TexturePack.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include <fmt/format.h>
+
+#include "Common/Align.h"
+#include "Common/FileSearch.h"
+#include "Common/IOFile.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/TextureInfo.h"
+
+namespace TexturePack
+{
+namespace
+{
+constexpr u32 MAGIC = 0x4B505444;  // "DTPK"
+constexpr u32 VERSION = 1;
+
+struct Header
+{
+  u32 magic;
+  u32 version;
+  u32 entry_count;
+  u32 names_size;
+};
+static_assert(std::is_trivially_copyable_v<Header>);
+static_assert(sizeof(Header) == 16);
+
+struct IndexEntry
+{
+  u64 offset;
+  u64 size;
+  u32 name_offset;
+  u32 name_size;
+};
+static_assert(std::is_trivially_copyable_v<IndexEntry>);
+static_assert(sizeof(IndexEntry) == 24);
+
+bool IsTextureName(std::string_view name)
+{
+  return name.starts_with(TextureInfo::legacy_format_prefix) ||
+         name.starts_with(TextureInfo::xxh3_format_prefix);
+}
+}  // namespace
+
+std::optional<std::vector<Entry>> ReadIndex(const std::string& path)
+{
+  File::IOFile file(path, "rb");
+  if (!file)
+    return std::nullopt;
+
+  const u64 file_size = file.GetSize();
+  Header header;
+  if (!file.ReadBytes(&header, sizeof(header)) || header.magic != MAGIC ||
+      header.version != VERSION)
+  {
+    return std::nullopt;
+  }
+
+  const u64 index_size = static_cast<u64>(header.entry_count) * sizeof(IndexEntry);
+  if (sizeof(Header) + index_size + header.names_size > file_size)
+    return std::nullopt;
+
+  std::vector<IndexEntry> index(header.entry_count);
+  std::vector<char> names(header.names_size);
+  if (!file.ReadArray(index.data(), index.size()) || !file.ReadArray(names.data(), names.size()))
+    return std::nullopt;
+
+  std::vector<Entry> entries;
+  entries.reserve(index.size());
+  for (const IndexEntry& index_entry : index)
+  {
+    if (index_entry.name_offset > names.size() ||
+        index_entry.name_size > names.size() - index_entry.name_offset ||
+        index_entry.offset > file_size || index_entry.size > file_size - index_entry.offset)
+    {
+      return std::nullopt;
+    }
+
+    entries.push_back({std::string(names.data() + index_entry.name_offset, index_entry.name_size),
+                       index_entry.offset, index_entry.size});
+  }
+
+  return entries;
+}
+
+bool Build(const std::string& directory, const std::string& output_path,
+           std::string* error_message)
+{
+  struct SourceFile
+  {
+    std::string name;
+    std::string path;
+  };
+
+  std::vector<SourceFile> source_files;
+  for (std::string& path : Common::DoFileSearch({directory}, {".png", ".dds"}, true))
+  {
+    std::string name;
+    SplitPath(path, nullptr, &name, nullptr);
+    if (IsTextureName(name))
+      source_files.push_back({std::move(name), std::move(path)});
+  }
+
+  if (source_files.empty())
+  {
+    *error_message = fmt::format("No custom textures found in {}", directory);
+    return false;
+  }
+
+  // Sorting makes the output deterministic. Like when loading a texture directory, the same name
+  // can't be used twice.
+  std::sort(source_files.begin(), source_files.end(),
+            [](const SourceFile& a, const SourceFile& b) { return a.name < b.name; });
+  const auto duplicate = std::adjacent_find(
+      source_files.begin(), source_files.end(),
+      [](const SourceFile& a, const SourceFile& b) { return a.name == b.name; });
+  if (duplicate != source_files.end())
+  {
+    *error_message = fmt::format("{} and {} have the same name", duplicate->path,
+                                 std::next(duplicate)->path);
+    return false;
+  }
+
+  std::vector<IndexEntry> index(source_files.size());
+  std::string names;
+  for (size_t i = 0; i < source_files.size(); i++)
+  {
+    index[i].name_offset = static_cast<u32>(names.size());
+    index[i].name_size = static_cast<u32>(source_files[i].name.size());
+    names += source_files[i].name;
+  }
+
+  const Header header{MAGIC, VERSION, static_cast<u32>(index.size()),
+                      static_cast<u32>(names.size())};
+
+  File::IOFile output(output_path, "wb");
+  if (!output)
+  {
+    *error_message = fmt::format("Failed to open {} for writing", output_path);
+    return false;
+  }
+
+  // The index is written last, once the sizes of all files are known.
+  u64 offset = Common::AlignUp(sizeof(Header) + index.size() * sizeof(IndexEntry) + names.size(),
+                               PAYLOAD_ALIGNMENT);
+  std::vector<u8> buffer;
+  for (size_t i = 0; i < source_files.size(); i++)
+  {
+    File::IOFile input(source_files[i].path, "rb");
+    buffer.resize(input.GetSize());
+    if (!input.ReadBytes(buffer.data(), buffer.size()))
+    {
+      *error_message = fmt::format("Failed to read {}", source_files[i].path);
+      return false;
+    }
+
+    index[i].offset = offset;
+    index[i].size = buffer.size();
+    if (!output.Seek(offset, File::SeekOrigin::Begin) ||
+        !output.WriteBytes(buffer.data(), buffer.size()))
+    {
+      *error_message = fmt::format("Failed to write {}", output_path);
+      return false;
+    }
+    offset = Common::AlignUp(offset + buffer.size(), PAYLOAD_ALIGNMENT);
+  }
+
+  if (!output.Seek(0, File::SeekOrigin::Begin) || !output.WriteBytes(&header, sizeof(header)) ||
+      !output.WriteArray(index.data(), index.size()) ||
+      !output.WriteBytes(names.data(), names.size()))
+  {
+    *error_message = fmt::format("Failed to write {}", output_path);
+    return false;
+  }
+
+  return true;
+}
+}  // namespace TexturePack
@@ -0,0 +1,39 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// A texture pack file holds all the custom textures of a game in a single file, so that they can be
+// found without walking a directory tree of thousands of files.
+//
+// The file consists of a header, an index sorted by name, the names, and the unmodified PNG and DDS
+// files. DDS files thus keep their BCn compressed data as it is uploaded to the GPU. Every file is
+// aligned to PAYLOAD_ALIGNMENT, so that the pack can also be memory mapped.
+namespace TexturePack
+{
+constexpr std::string_view FILE_EXTENSION = ".dtp";
+constexpr u32 PAYLOAD_ALIGNMENT = 64;
+
+struct Entry
+{
+  // Name of the texture file without its extension, as it would be in a texture directory
+  std::string name;
+  u64 offset;
+  u64 size;
+};
+
+// Reads the index of a texture pack. Returns std::nullopt if the file isn't a valid pack.
+std::optional<std::vector<Entry>> ReadIndex(const std::string& path);
+
+// Creates a texture pack from all custom textures in the given directory and its subdirectories.
+// Returns false and sets error_message on failure.
+bool Build(const std::string& directory, const std::string& output_path,
+           std::string* error_message);
+}  // namespace TexturePack
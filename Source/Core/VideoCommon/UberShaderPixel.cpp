@@ -33,6 +33,27 @@ PixelShaderUid GetPixelShaderUid()
       (bpmem.zmode.testenable && bpmem.genMode.zfreeze);
   uid_data->uint_output = bpmem.blendmode.UseLogicOp();
 
+  if (g_ActiveConfig.bSpecializedUberShaders)
+  {
+    const u32 num_stages = bpmem.genMode.numtevstages + 1;
+    for (u32 bucket = 1; bucket < TEV_STAGE_BUCKET_LIMITS.size(); bucket++)
+    {
+      if (num_stages <= TEV_STAGE_BUCKET_LIMITS[bucket])
+      {
+        uid_data->tev_stage_bucket = bucket;
+        break;
+      }
+    }
+
+    bool uses_indirect = false;
+    for (u32 i = 0; i < num_stages; i++)
+      uses_indirect |= bpmem.tevind[i].hex != 0;
+    uid_data->no_indirect = !uses_indirect;
+
+    uid_data->no_fog =
+        g_ActiveConfig.bDisableFog || bpmem.fog.c_proj_fsel.fsel == FogType::Off;
+  }
+
   return out;
 }
 
@@ -68,7 +89,7 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   const bool per_pixel_depth = uid_data->per_pixel_depth != 0;
   const bool bounding_box = host_config.bounding_box;
   const u32 numTexgen = uid_data->num_texgens;
-  ShaderCode out;
+  ShaderCode out(65536);
 
   ASSERT_MSG(VIDEO, !(use_dual_source && use_framebuffer_fetch),
              "If you're using framebuffer fetch, you shouldn't need dual source blend!");
@@ -530,7 +551,11 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
               "  float4 ocol1;\n");
   }
 
-  if (host_config.backend_geometry_shaders && stereo)
+  if (host_config.backend_multiview)
+  {
+    out.Write("\tint layer = int(gl_ViewIndex);\n");
+  }
+  else if (host_config.backend_geometry_shaders && stereo)
   {
     out.Write("\tint layer = gl_Layer;\n");
   }
@@ -555,7 +580,7 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
               "  float3 lit_normal = normalize(Normal.xyz);\n"
               "  float3 lit_pos = WorldPos.xyz;\n");
     WriteVertexLighting(out, api_type, "lit_pos", "lit_normal", "colors_0", "colors_1",
-                        "lit_colors_0", "lit_colors_1");
+                        "lit_colors_0", "lit_colors_1", true);
     color_input_prefix = "lit_";
     out.Write("  // The number of colors available to TEV is determined by numColorChans.\n"
               "  // Normally this is performed in the vertex shader after lighting,\n"
@@ -572,8 +597,17 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
 
   out.Write("  // Main tev loop\n");
 
-  out.Write("  for(uint stage = 0u; stage <= num_stages; stage++)\n"
-            "  {{\n"
+  // Specialized variants give the loop a constant trip count, so the compiler can unroll it.
+  if (uid_data->tev_stage_bucket != 0)
+  {
+    out.Write("  for(uint stage = 0u; stage < {}u && stage <= num_stages; stage++)\n",
+              TEV_STAGE_BUCKET_LIMITS[uid_data->tev_stage_bucket]);
+  }
+  else
+  {
+    out.Write("  for(uint stage = 0u; stage <= num_stages; stage++)\n");
+  }
+  out.Write("  {{\n"
             "    StageState ss;\n"
             "    ss.stage = stage;\n"
             "    ss.cc = bpmem_combiners(stage).x;\n"
@@ -602,12 +636,14 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
               "\n"
               "    bool texture_enabled = (ss.order & {}u) != 0u;\n",
               1 << TwoTevStageOrders().enable_tex_even.StartBit());
+    // Without indirect stages tevind is a constant zero, and the compiler drops the whole block.
     out.Write("\n"
               "    // Indirect textures\n"
-              "    uint tevind = bpmem_tevind(stage);\n"
+              "    uint tevind = {};\n"
               "    if (tevind != 0u)\n"
               "    {{\n"
               "      uint bs = {};\n",
+              uid_data->no_indirect ? "0u" : "bpmem_tevind(stage)",
               BitfieldExtract<&TevStageIndirect::bs>("tevind"));
     out.Write("      uint fmt = {};\n", BitfieldExtract<&TevStageIndirect::fmt>("tevind"));
     out.Write("      uint bias = {};\n", BitfieldExtract<&TevStageIndirect::bias>("tevind"));
@@ -996,9 +1032,18 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
 
   // FIXME: Fog is implemented the same as ShaderGen, but ShaderGen's fog is all hacks.
   //        Should be fixed point, and should not make guesses about Range-Based adjustments.
-  out.Write("  // Fog\n"
-            "  uint fog_function = {};\n",
-            BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
+  if (uid_data->no_fog)
+  {
+    out.Write("  // Fog disabled in this variant\n"
+              "  uint fog_function = {:s};\n",
+              FogType::Off);
+  }
+  else
+  {
+    out.Write("  // Fog\n"
+              "  uint fog_function = {};\n",
+              BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
+  }
   out.Write("  if (fog_function != {:s}) {{\n", FogType::Off);
   out.Write("    // TODO: This all needs to be converted from float to fixed point\n"
             "    float ze;\n"
@@ -1252,6 +1297,31 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   return out;
 }
 
+static void EnumerateSpecializations(PixelShaderUid uid,
+                                     const std::function<void(const PixelShaderUid&)>& callback)
+{
+  if (!g_ActiveConfig.bSpecializedUberShaders)
+  {
+    callback(uid);
+    return;
+  }
+
+  pixel_ubershader_uid_data* const puid = uid.GetUidData();
+  for (u32 bucket = 0; bucket < TEV_STAGE_BUCKET_LIMITS.size(); bucket++)
+  {
+    puid->tev_stage_bucket = bucket;
+    for (u32 no_indirect = 0; no_indirect < 2; no_indirect++)
+    {
+      puid->no_indirect = no_indirect;
+      for (u32 no_fog = 0; no_fog < 2; no_fog++)
+      {
+        puid->no_fog = no_fog;
+        callback(uid);
+      }
+    }
+  }
+}
+
 void EnumeratePixelShaderUids(const std::function<void(const PixelShaderUid&)>& callback)
 {
   PixelShaderUid uid;
@@ -1277,7 +1347,7 @@ void EnumeratePixelShaderUids(const std::function<void(const PixelShaderUid&)>&
           for (u32 no_dual_src = 0; no_dual_src < 2; no_dual_src++)
           {
             puid->no_dual_src = no_dual_src;
-            callback(uid);
+            EnumerateSpecializations(uid, callback);
           }
         }
       }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include "Common/CommonTypes.h"
 #include "VideoCommon/ShaderGenCommon.h"
@@ -20,12 +21,20 @@ struct pixel_ubershader_uid_data
   u32 uint_output : 1;
   u32 no_dual_src : 1;
 
+  // Coarse state the specialized variants are compiled for; all zero is the generic shader.
+  u32 tev_stage_bucket : 2;
+  u32 no_indirect : 1;
+  u32 no_fog : 1;
+
   u32 NumValues() const { return sizeof(pixel_ubershader_uid_data); }
 };
 #pragma pack()
 
 using PixelShaderUid = ShaderUid<pixel_ubershader_uid_data>;
 
+// Maximum number of TEV stages handled by each tev_stage_bucket value.
+constexpr std::array<u32, 4> TEV_STAGE_BUCKET_LIMITS = {16, 2, 4, 8};
+
 PixelShaderUid GetPixelShaderUid();
 
 ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
@@ -44,8 +53,10 @@ struct fmt::formatter<UberShader::pixel_ubershader_uid_data>
   auto format(const UberShader::pixel_ubershader_uid_data& uid, FormatContext& ctx) const
   {
     return fmt::format_to(
-        ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}", uid.num_texgens,
+        ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}, up to {} stages{}{}", uid.num_texgens,
         uid.early_depth ? ", early-depth" : "", uid.per_pixel_depth ? ", per-pixel depth" : "",
-        uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "");
+        uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "",
+        UberShader::TEV_STAGE_BUCKET_LIMITS[uid.tev_stage_bucket],
+        uid.no_indirect ? ", no indirect" : "", uid.no_fog ? ", no fog" : "");
   }
 };
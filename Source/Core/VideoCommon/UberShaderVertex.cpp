@@ -9,6 +9,7 @@
 #include "VideoCommon/UberShaderCommon.h"
 #include "VideoCommon/VertexShaderGen.h"
 #include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace UberShader
@@ -20,6 +21,15 @@ VertexShaderUid GetVertexShaderUid()
   vertex_ubershader_uid_data* const uid_data = out.GetUidData();
   uid_data->num_texgens = xfmem.numTexGen.numTexGens;
 
+  if (g_ActiveConfig.bSpecializedUberShaders)
+  {
+    // Both channels are lit regardless of numColorChans, since texgens can read them.
+    bool uses_lighting = false;
+    for (u32 chan = 0; chan < NUM_XF_COLOR_CHANNELS; chan++)
+      uses_lighting |= xfmem.color[chan].enablelighting || xfmem.alpha[chan].enablelighting;
+    uid_data->no_lighting = !uses_lighting;
+  }
+
   return out;
 }
 
@@ -39,7 +49,7 @@ ShaderCode GenVertexShader(APIType api_type, const ShaderHostConfig& host_config
   const bool vertex_loader =
       host_config.backend_dynamic_vertex_loader || host_config.backend_vs_point_line_expand;
   const u32 num_texgen = uid_data->num_texgens;
-  ShaderCode out;
+  ShaderCode out(32768);
 
   out.Write("// {}\n\n", *uid_data);
   out.Write("{}", s_lighting_struct);
@@ -49,7 +59,7 @@ ShaderCode GenVertexShader(APIType api_type, const ShaderHostConfig& host_config
   out.Write("{}", s_shader_uniforms);
   out.Write("}};\n");
 
-  if (vertex_loader)
+  if (vertex_loader || host_config.backend_multiview)
   {
     out.Write("UBO_BINDING(std140, 3) uniform GSBlock {{\n");
     out.Write("{}", s_geometry_shader_uniforms);
@@ -332,7 +342,7 @@ float3 load_input_float3_rawtex(uint vtx_offset, uint attr_offset) {{
             "}}\n");
 
   WriteVertexLighting(out, api_type, "pos.xyz", "_normal", "vertex_color_0", "vertex_color_1",
-                      "o.colors_0", "o.colors_1");
+                      "o.colors_0", "o.colors_1", !uid_data->no_lighting);
 
   // Texture Coordinates
   if (num_texgen > 0)
@@ -480,6 +490,14 @@ float3 load_input_float3_rawtex(uint vtx_offset, uint attr_offset) {{
               "}}\n");
   }
 
+  if (host_config.backend_multiview)
+  {
+    // Each view runs the vertex shader separately, so apply the horizontal stereoscopy offset
+    // here instead of in the geometry shader. See GeometryShaderGen for the formula.
+    out.Write("o.pos.x += ((gl_ViewIndex == 0) ? " I_STEREOPARAMS ".x : " I_STEREOPARAMS ".y) * "
+              "(o.pos.w - " I_STEREOPARAMS ".z);\n");
+  }
+
   if (host_config.backend_geometry_shaders)
   {
     AssignVSOutputMembers(out, "vs", "o", num_texgen, host_config);
@@ -725,6 +743,13 @@ void EnumerateVertexShaderUids(const std::function<void(const VertexShaderUid&)>
     vertex_ubershader_uid_data* const vuid = uid.GetUidData();
     vuid->num_texgens = texgens;
     callback(uid);
+
+    if (g_ActiveConfig.bSpecializedUberShaders)
+    {
+      vuid->no_lighting = 1;
+      callback(uid);
+      vuid->no_lighting = 0;
+    }
   }
 }
 }  // namespace UberShader
@@ -12,6 +12,8 @@ namespace UberShader
 struct vertex_ubershader_uid_data
 {
   u32 num_texgens : 4;
+  // Specialized variant for draws where no color channel has lighting enabled.
+  u32 no_lighting : 1;
 
   u32 NumValues() const { return sizeof(vertex_ubershader_uid_data); }
 };
@@ -33,6 +35,7 @@ struct fmt::formatter<UberShader::vertex_ubershader_uid_data>
   template <typename FormatContext>
   auto format(const UberShader::vertex_ubershader_uid_data& uid, FormatContext& ctx) const
   {
-    return fmt::format_to(ctx.out(), "Vertex UberShader for {} texgens", uid.num_texgens);
+    return fmt::format_to(ctx.out(), "Vertex UberShader for {} texgens{}", uid.num_texgens,
+                          uid.no_lighting ? ", no lighting" : "");
   }
 };
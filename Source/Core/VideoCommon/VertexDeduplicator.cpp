@@ -0,0 +1,51 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/VertexDeduplicator.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <xxhash.h>
+
+#include "Common/MathUtil.h"
+
+u32 VertexDeduplicator::Run(const u8* src, u32 vertex_size, u32 count)
+{
+  // Keep the table at most half full.
+  const u32 table_size = MathUtil::NextPowerOf2(std::max(count * 2, 16u));
+  const u32 mask = table_size - 1;
+  m_table.assign(table_size, 0);
+  m_remap.resize(count);
+  m_unique_vertices.resize(static_cast<size_t>(count) * vertex_size);
+
+  u32 num_unique = 0;
+  for (u32 i = 0; i < count; i++)
+  {
+    const u8* vertex = src + static_cast<size_t>(i) * vertex_size;
+    u32 slot = static_cast<u32>(XXH3_64bits(vertex, vertex_size)) & mask;
+    while (true)
+    {
+      const u32 entry = m_table[slot];
+      if (entry == 0)
+      {
+        std::memcpy(&m_unique_vertices[static_cast<size_t>(num_unique) * vertex_size], vertex,
+                    vertex_size);
+        m_table[slot] = ++num_unique;
+        m_remap[i] = static_cast<u16>(num_unique - 1);
+        break;
+      }
+
+      const u8* other = &m_unique_vertices[static_cast<size_t>(entry - 1) * vertex_size];
+      if (std::memcmp(vertex, other, vertex_size) == 0)
+      {
+        m_remap[i] = static_cast<u16>(entry - 1);
+        break;
+      }
+
+      slot = (slot + 1) & mask;
+    }
+  }
+
+  return num_unique;
+}
@@ -0,0 +1,33 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// Finds the distinct vertices of a primitive command before they are converted.
+//
+// Vertices with indexed attributes usually refer to the same array elements many times, once for
+// every triangle sharing them. The vertex loader's output only depends on the input bytes of a
+// vertex, so vertices with identical input are converted only once and drawn through the index
+// buffer instead.
+class VertexDeduplicator
+{
+public:
+  // Returns the number of distinct vertices in src, which are then available from
+  // GetUniqueVertices() in the order they first appear.
+  u32 Run(const u8* src, u32 vertex_size, u32 count);
+
+  const u8* GetUniqueVertices() const { return m_unique_vertices.data(); }
+
+  // For each vertex of the last run, the index of its distinct vertex.
+  const u16* GetRemap() const { return m_remap.data(); }
+
+private:
+  std::vector<u8> m_unique_vertices;
+  std::vector<u16> m_remap;
+  // Open addressing hash table of distinct vertex index + 1, 0 meaning empty.
+  std::vector<u32> m_table;
+};
@@ -253,7 +253,6 @@ int VertexLoader::RunVertices(const u8* src, u8* dst, int count)
   g_vertex_manager_write_ptr = dst;
   g_video_buffer_read_ptr = src;
 
-  m_numLoadedVertices += count;
   m_skippedVertices = 0;
 
   for (m_remaining = count - 1; m_remaining >= 0; m_remaining--)
@@ -152,7 +152,6 @@ public:
                fmt::join(a_binormal_cache, ", "), fmt::join(b_binormal_cache, ", "));
 
     memcpy(dst, buffer_a.data(), count_a * m_native_vtx_decl.stride);
-    m_numLoadedVertices += count;
     return count_a;
   }
 
@@ -31,6 +31,7 @@ public:
 
   bool operator==(const VertexLoaderUID& rh) const { return vid == rh.vid; }
   size_t GetHash() const { return hash; }
+  const std::array<u32, 5>& GetUidData() const { return vid; }
 
 private:
   size_t CalculateHash() const
@@ -72,7 +73,7 @@ public:
 
   // used by VertexLoaderManager
   NativeVertexFormat* m_native_vertex_format = nullptr;
-  int m_numLoadedVertices = 0;
+  u64 m_numLoadedVertices = 0;
 
 protected:
   VertexLoaderBase(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
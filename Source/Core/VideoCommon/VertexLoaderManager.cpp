@@ -4,18 +4,29 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FileUtil.h"
+#include "Common/Flag.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/Thread.h"
 
+#include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -23,10 +34,12 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexDeduplicator.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
@@ -43,6 +56,7 @@ alignas(sizeof(std::array<float, 4>)) std::array<float, 4> tangent_cache;
 alignas(sizeof(std::array<float, 4>)) std::array<float, 4> binormal_cache;
 
 static NativeVertexFormatMap s_native_vertex_map;
+static VertexDeduplicator s_vertex_deduplicator;
 static NativeVertexFormat* s_current_vtx_fmt;
 u32 g_current_components;
 
@@ -51,6 +65,17 @@ static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
+// Bump this when the layout of VertexLoaderUID changes.
+constexpr u32 LOADER_UID_CACHE_VERSION = 1;
+using SerializedLoaderUid = std::array<u32, 5>;
+
+// Both are guarded by s_vertex_loader_map_lock.
+static File::IOFile s_loader_uid_cache_file;
+static std::unordered_set<VertexLoaderUID> s_cached_loader_uids;
+
+static std::thread s_precompile_thread;
+static Common::Flag s_precompile_abort;
+
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 
 BitSet8 g_main_vat_dirty;
@@ -60,6 +85,119 @@ std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_main_vertex_loaders;
 std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_preprocess_vertex_loaders;
 bool g_needs_cp_xf_consistency_check;
 
+static std::pair<TVtxDesc, VAT> UnserializeLoaderUid(const SerializedLoaderUid& uid)
+{
+  TVtxDesc vtx_desc;
+  vtx_desc.low.Hex = uid[0];
+  vtx_desc.high.Hex = uid[1];
+  VAT vat;
+  vat.g0.Hex = uid[2];
+  vat.g1.Hex = uid[3];
+  vat.g2.Hex = uid[4];
+  return {vtx_desc, vat};
+}
+
+static void PrecompileLoaders(std::vector<SerializedLoaderUid> uids)
+{
+  Common::SetCurrentThreadName("Vertex loader precompiler");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
+
+  for (const SerializedLoaderUid& serialized_uid : uids)
+  {
+    if (s_precompile_abort.IsSet())
+      return;
+
+    const auto [vtx_desc, vat] = UnserializeLoaderUid(serialized_uid);
+    const VertexLoaderUID uid(vtx_desc, vat);
+
+    {
+      std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+      if (s_vertex_loader_map.contains(uid))
+        continue;
+    }
+
+    // Compile without holding the lock, so that the GPU thread can keep creating loaders. If it
+    // needed this one in the meantime, ours is simply dropped.
+    std::unique_ptr<VertexLoaderBase> loader = VertexLoaderBase::CreateVertexLoader(vtx_desc, vat);
+
+    std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+    if (s_vertex_loader_map.try_emplace(uid, std::move(loader)).second)
+    {
+      INCSTAT(g_stats.num_vertex_loaders);
+      INCSTAT(g_stats.num_vertex_loaders_precompiled);
+    }
+  }
+}
+
+static void LoadLoaderUIDCache()
+{
+  constexpr u32 CACHE_FILE_MAGIC = 0x44495556;  // VUID
+  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".vertexloaders";
+
+  std::vector<SerializedLoaderUid> uids;
+  if (s_loader_uid_cache_file.Open(filename, "rb+"))
+  {
+    u32 existing_magic;
+    u32 existing_version;
+    bool uid_file_valid = false;
+    if (s_loader_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
+        s_loader_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
+        existing_magic == CACHE_FILE_MAGIC && existing_version == LOADER_UID_CACHE_VERSION)
+    {
+      // A partially written UID at the end (e.g. after a crash) is dropped.
+      const u64 file_size = s_loader_uid_cache_file.GetSize();
+      uids.resize(static_cast<size_t>(file_size - CACHE_HEADER_SIZE) /
+                  sizeof(SerializedLoaderUid));
+      const size_t expected_size = uids.size() * sizeof(SerializedLoaderUid) + CACHE_HEADER_SIZE;
+      uid_file_valid = s_loader_uid_cache_file.ReadArray(uids.data(), uids.size()) &&
+                       s_loader_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
+    }
+
+    // If the file is invalid, close it. We re-open and truncate it below.
+    if (!uid_file_valid)
+    {
+      uids.clear();
+      s_loader_uid_cache_file.Close();
+    }
+  }
+
+  if (!s_loader_uid_cache_file.IsOpen() && s_loader_uid_cache_file.Open(filename, "wb"))
+  {
+    s_loader_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+    s_loader_uid_cache_file.WriteBytes(&LOADER_UID_CACHE_VERSION, sizeof(LOADER_UID_CACHE_VERSION));
+  }
+
+  for (const SerializedLoaderUid& serialized_uid : uids)
+  {
+    const auto [vtx_desc, vat] = UnserializeLoaderUid(serialized_uid);
+    s_cached_loader_uids.emplace(vtx_desc, vat);
+  }
+
+  INFO_LOG_FMT(VIDEO, "Read {} vertex loader UIDs from {}", uids.size(), filename);
+
+  if (!uids.empty())
+  {
+    s_precompile_abort.Clear();
+    s_precompile_thread = std::thread(PrecompileLoaders, std::move(uids));
+  }
+}
+
+// Must be called with s_vertex_loader_map_lock held.
+static void AppendLoaderUID(const VertexLoaderUID& uid)
+{
+  if (!s_loader_uid_cache_file.IsOpen() || !s_cached_loader_uids.insert(uid).second)
+    return;
+
+  const SerializedLoaderUid& serialized_uid = uid.GetUidData();
+  if (!s_loader_uid_cache_file.WriteArray(serialized_uid.data(), serialized_uid.size()))
+  {
+    WARN_LOG_FMT(VIDEO, "Writing vertex loader UID cache failed, closing file.");
+    s_loader_uid_cache_file.Close();
+  }
+}
+
 void Init()
 {
   MarkAllDirty();
@@ -68,11 +206,21 @@ void Init()
   for (auto& map_entry : g_preprocess_vertex_loaders)
     map_entry = nullptr;
   SETSTAT(g_stats.num_vertex_loaders, 0);
+  SETSTAT(g_stats.num_vertex_loaders_precompiled, 0);
+  LoadLoaderUIDCache();
 }
 
 void Clear()
 {
+  if (s_precompile_thread.joinable())
+  {
+    s_precompile_abort.Set();
+    s_precompile_thread.join();
+  }
+
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_loader_uid_cache_file.Close();
+  s_cached_loader_uids.clear();
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
@@ -117,15 +265,26 @@ void UpdateVertexArrayPointers()
   g_bases_dirty = false;
 }
 
-namespace
+std::vector<LoaderStatistics> GetLoaderStatistics()
 {
-struct entry
-{
-  std::string text;
-  u64 num_verts;
-  bool operator<(const entry& other) const { return num_verts > other.num_verts; }
-};
-}  // namespace
+  std::vector<LoaderStatistics> statistics;
+
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  statistics.reserve(s_vertex_loader_map.size());
+  for (const auto& [uid, loader] : s_vertex_loader_map)
+  {
+    const SerializedLoaderUid& data = uid.GetUidData();
+    statistics.push_back({fmt::format("{:08x}{:08x} {:08x} {:08x} {:08x}, {} bytes", data[1],
+                                      data[0], data[2], data[3], data[4], loader->m_vertex_size),
+                          loader->m_numLoadedVertices});
+  }
+
+  std::sort(statistics.begin(), statistics.end(),
+            [](const LoaderStatistics& a, const LoaderStatistics& b) {
+              return a.num_vertices > b.num_vertices;
+            });
+  return statistics;
+}
 
 void MarkAllDirty()
 {
@@ -236,6 +395,7 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
         VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
     loader = it->second.get();
     INCSTAT(g_stats.num_vertex_loaders);
+    AppendLoaderUID(uid);
   }
   if (check_for_native_format)
   {
@@ -337,7 +497,8 @@ static void CheckCPConfiguration(int vtx_attr_group)
 }
 
 template <bool IsPreprocess>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src)
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                DisplayListCache::CachedVertices* cached)
 {
   if (count == 0) [[unlikely]]
     return 0;
@@ -383,7 +544,38 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
     DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, count, stride,
                                                                 cullall || can_cpu_cull);
 
-    count = loader->RunVertices(src, dst.GetPointer(), count);
+    // Deduplication pays off for indexed positions, where vertices are shared between triangles.
+    // Culling on the CPU expects the vertices of each primitive one after another.
+    const bool deduplicate = g_ActiveConfig.bDeduplicateIndexedVertices && !cached &&
+                             !can_cpu_cull && count >= 3 &&
+                             primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES &&
+                             IsIndexed(g_main_cp_state.vtx_desc.low.Position);
+    u32 num_unique = count;
+    if (deduplicate)
+      num_unique = s_vertex_deduplicator.Run(src, loader->m_vertex_size, count);
+
+    if (cached && cached->IsValidFor(loader, count))
+    {
+      std::memcpy(dst.GetPointer(), cached->data.data(), cached->data.size());
+      cached->RestoreLoaderState();
+    }
+    else if (num_unique + 3 <= static_cast<u32>(count))
+    {
+      loader->RunVertices(s_vertex_deduplicator.GetUniqueVertices(), dst.GetPointer(),
+                          num_unique);
+      // Convert the last three vertices again, past the end of the distinct ones, so that the
+      // zfreeze and tangent caches end up the same as if every vertex had been converted.
+      loader->RunVertices(src + (count - 3) * loader->m_vertex_size,
+                          dst.GetPointer() + num_unique * stride, 3);
+    }
+    else
+    {
+      count = loader->RunVertices(src, dst.GetPointer(), count);
+      num_unique = count;
+      if (cached && DisplayListCache::CachedVertices::CanCache(g_main_cp_state.vtx_desc, count))
+        cached->Store(loader, dst.GetPointer(), count);
+    }
+    loader->m_numLoadedVertices += count;
 
     if (can_cpu_cull && !cullall)
     {
@@ -394,8 +586,16 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
       }
     }
 
-    g_vertex_manager->AddIndices(primitive, count);
-    g_vertex_manager->FlushData(count, loader->m_native_vtx_decl.stride);
+    if (num_unique != static_cast<u32>(count))
+    {
+      g_vertex_manager->AddRemappedIndices(primitive, count, s_vertex_deduplicator.GetRemap(),
+                                           num_unique);
+    }
+    else
+    {
+      g_vertex_manager->AddIndices(primitive, count);
+    }
+    g_vertex_manager->FlushData(num_unique, loader->m_native_vtx_decl.stride);
 
     ADDSTAT(g_stats.this_frame.num_prims, count);
     INCSTAT(g_stats.this_frame.num_primitive_joins);
@@ -404,9 +604,9 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 }
 
 template int RunVertices<false>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                                const u8* src);
+                                const u8* src, DisplayListCache::CachedVertices* cached);
 template int RunVertices<true>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                               const u8* src);
+                               const u8* src, DisplayListCache::CachedVertices* cached);
 
 NativeVertexFormat* GetCurrentVertexFormat()
 {
@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
@@ -15,6 +16,11 @@
 class NativeVertexFormat;
 struct PortableVertexDeclaration;
 
+namespace DisplayListCache
+{
+struct CachedVertices;
+}
+
 namespace OpcodeDecoder
 {
 enum class Primitive : u8;
@@ -25,9 +31,21 @@ namespace VertexLoaderManager
 using NativeVertexFormatMap =
     std::unordered_map<PortableVertexDeclaration, std::unique_ptr<NativeVertexFormat>>;
 
+// The vertex formats a game uses are stored in the cache directory. Init starts creating the
+// loaders for them on a background thread, so that they don't have to be compiled in the middle
+// of a frame the next time the game uses them.
 void Init();
 void Clear();
 
+struct LoaderStatistics
+{
+  std::string description;
+  u64 num_vertices;
+};
+
+// Returns the number of vertices each loader has processed, highest first.
+std::vector<LoaderStatistics> GetLoaderStatistics();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
@@ -41,8 +59,10 @@ NativeVertexFormat* GetOrCreateMatchingFormat(const PortableVertexDeclaration& d
 NativeVertexFormat* GetUberVertexFormat(const PortableVertexDeclaration& decl);
 
 // Returns -1 if buf_size is insufficient, else the amount of bytes consumed
+// If cached is set, the converted vertices are taken from it or stored in it where possible.
 template <bool IsPreprocess = false>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src);
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                DisplayListCache::CachedVertices* cached = nullptr);
 
 namespace detail
 {
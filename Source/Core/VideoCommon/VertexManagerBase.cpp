@@ -6,12 +6,14 @@
 #include <array>
 #include <cmath>
 #include <memory>
+#include <utility>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
+#include "Common/Trace.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
@@ -20,6 +22,7 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/FrameTimeBreakdown.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
@@ -118,6 +121,12 @@ void VertexManagerBase::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_v
   m_index_generator.AddIndices(primitive, num_vertices);
 }
 
+void VertexManagerBase::AddRemappedIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                                           const u16* remap, u32 num_unique_vertices)
+{
+  m_index_generator.AddRemappedIndices(primitive, num_vertices, remap, num_unique_vertices);
+}
+
 bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
                                              OpcodeDecoder::Primitive primitive, const u8* src,
                                              u32 count)
@@ -320,6 +329,20 @@ void VertexManagerBase::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 nu
   *out_base_index = 0;
 }
 
+std::unique_ptr<StaticVertexBuffer> VertexManagerBase::CreateStaticVertexBuffer(const void* data,
+                                                                                 u32 size)
+{
+  return nullptr;
+}
+
+void VertexManagerBase::CommitStaticBuffer(const StaticVertexBuffer& vertex_buffer,
+                                           u32 vertex_stride, u32 num_indices,
+                                           u32* out_base_vertex, u32* out_base_index)
+{
+  *out_base_vertex = 0;
+  *out_base_index = 0;
+}
+
 void VertexManagerBase::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_vertex)
 {
   // If bounding box is enabled, we need to flush any changes first, then invalidate what we have.
@@ -345,6 +368,68 @@ void VertexManagerBase::InvalidateConstants()
   vertex_shader_manager.dirty = true;
   geometry_shader_manager.dirty = true;
   pixel_shader_manager.dirty = true;
+  m_vertex_constants_tracker.Invalidate();
+  m_geometry_constants_tracker.Invalidate();
+  m_pixel_constants_tracker.Invalidate();
+}
+
+void VertexManagerBase::SkipRedundantConstantUploads()
+{
+  auto& system = Core::System::GetInstance();
+  auto& vertex_shader_manager = system.GetVertexShaderManager();
+  auto& geometry_shader_manager = system.GetGeometryShaderManager();
+  auto& pixel_shader_manager = system.GetPixelShaderManager();
+
+  // The previous upload is still bound, so there's nothing to do if the contents are the same.
+  if (vertex_shader_manager.dirty &&
+      m_vertex_constants_tracker.Update(vertex_shader_manager.constants).IsEmpty())
+  {
+    vertex_shader_manager.dirty = false;
+  }
+  if (geometry_shader_manager.dirty &&
+      m_geometry_constants_tracker.Update(geometry_shader_manager.constants).IsEmpty())
+  {
+    geometry_shader_manager.dirty = false;
+  }
+  if (pixel_shader_manager.dirty &&
+      m_pixel_constants_tracker.Update(pixel_shader_manager.constants).IsEmpty())
+  {
+    pixel_shader_manager.dirty = false;
+  }
+}
+
+const StaticVertexBuffer* VertexManagerBase::LookupStaticVertices(u32 vertex_stride)
+{
+  if (!g_ActiveConfig.bStaticVertexCache ||
+      !g_ActiveConfig.backend_info.bSupportsStaticVertexBuffers)
+  {
+    return nullptr;
+  }
+
+  // With VS point/line expansion, the vertices are read from the stream buffer by the shader.
+  if (g_ActiveConfig.UseVSForLinePointExpand() &&
+      (m_current_primitive_type == PrimitiveType::Points ||
+       m_current_primitive_type == PrimitiveType::Lines))
+  {
+    return nullptr;
+  }
+
+  const u32 size = m_index_generator.GetNumVerts() * vertex_stride;
+  if (size < StaticVertexCache::MIN_VERTEX_DATA_SIZE)
+    return nullptr;
+
+  const u64 hash = StaticVertexCache::HashVertexData(m_base_buffer_pointer, size, vertex_stride);
+  if (const StaticVertexBuffer* buffer = m_static_vertex_cache.Lookup(hash, size))
+    return buffer;
+
+  if (!m_static_vertex_cache.ShouldInsert(hash, size))
+    return nullptr;
+
+  auto buffer = CreateStaticVertexBuffer(m_base_buffer_pointer, size);
+  if (!buffer)
+    return nullptr;
+
+  return m_static_vertex_cache.Insert(hash, size, std::move(buffer));
 }
 
 void VertexManagerBase::UploadUtilityUniforms(const void* uniforms, u32 uniforms_size)
@@ -413,6 +498,8 @@ void VertexManagerBase::Flush()
   if (m_is_flushed)
     return;
 
+  TRACE_ZONE("VertexManagerBase::Flush");
+  FrameTimeBreakdown::ScopedPhase phase(FrameTimeBreakdown::Phase::Submit);
   m_is_flushed = true;
 
   if (xfmem.numTexGen.numTexGens != bpmem.genMode.numtexgens ||
@@ -511,11 +598,18 @@ void VertexManagerBase::Flush()
   auto& geometry_shader_manager = system.GetGeometryShaderManager();
   auto& vertex_shader_manager = system.GetVertexShaderManager();
 
+  // Frames skipped while fast-forwarding are never presented, so their draws are only needed
+  // when the game reads back the results of the rasterization through the bounding box or the
+  // performance counters. Copies of the EFB made in these frames contain stale data.
+  const bool skip_draw =
+      m_cull_all || (g_renderer->IsSkippingFrameDraws() && !g_renderer->IsBBoxEnabled() &&
+                     !PerfQueryBase::ShouldEmulate());
+
   CalculateBinormals(VertexLoaderManager::GetCurrentVertexFormat());
   // Calculate ZSlope for zfreeze
   const auto used_textures = UsedTextures();
-  std::vector<std::string> texture_names;
-  if (!m_cull_all)
+  std::vector<u64> texture_ids;
+  if (!skip_draw)
   {
     if (!g_ActiveConfig.bGraphicMods)
     {
@@ -531,31 +625,31 @@ void VertexManagerBase::Flush()
         const auto cache_entry = g_texture_cache->Load(TextureInfo::FromStage(i));
         if (cache_entry)
         {
-          texture_names.push_back(cache_entry->texture_info_name);
+          texture_ids.push_back(cache_entry->texture_info_id);
         }
       }
     }
   }
-  vertex_shader_manager.SetConstants(texture_names);
+  vertex_shader_manager.SetConstants(texture_ids);
   if (!bpmem.genMode.zfreeze)
   {
     // Must be done after VertexShaderManager::SetConstants()
     CalculateZSlope(VertexLoaderManager::GetCurrentVertexFormat());
   }
-  else if (m_zslope.dirty && !m_cull_all)  // or apply any dirty ZSlopes
+  else if (m_zslope.dirty && !skip_draw)  // or apply any dirty ZSlopes
   {
     pixel_shader_manager.SetZSlope(m_zslope.dfdx, m_zslope.dfdy, m_zslope.f0);
     m_zslope.dirty = false;
   }
 
-  if (!m_cull_all)
+  if (!skip_draw)
   {
-    for (const auto& texture_name : texture_names)
+    for (const u64 texture_id : texture_ids)
     {
       bool skip = false;
       GraphicsModActionData::DrawStarted draw_started{&skip};
       for (const auto action :
-           g_renderer->GetGraphicsModManager().GetDrawStartedActions(texture_name))
+           g_renderer->GetGraphicsModManager().GetDrawStartedActions(texture_id))
       {
         action->OnDrawStarted(&draw_started);
       }
@@ -568,10 +662,17 @@ void VertexManagerBase::Flush()
     const u32 num_indices = m_index_generator.GetIndexLen();
     if (num_indices == 0)
       return;
+    const u32 vertex_stride = VertexLoaderManager::GetCurrentVertexFormat()->GetVertexStride();
     u32 base_vertex, base_index;
-    CommitBuffer(m_index_generator.GetNumVerts(),
-                 VertexLoaderManager::GetCurrentVertexFormat()->GetVertexStride(), num_indices,
-                 &base_vertex, &base_index);
+    if (const StaticVertexBuffer* static_vertices = LookupStaticVertices(vertex_stride))
+    {
+      CommitStaticBuffer(*static_vertices, vertex_stride, num_indices, &base_vertex, &base_index);
+    }
+    else
+    {
+      CommitBuffer(m_index_generator.GetNumVerts(), vertex_stride, num_indices, &base_vertex,
+                   &base_index);
+    }
 
     if (g_ActiveConfig.backend_info.api_type != APIType::D3D &&
         g_ActiveConfig.UseVSForLinePointExpand() &&
@@ -592,6 +693,7 @@ void VertexManagerBase::Flush()
     // Now we can upload uniforms, as nothing else will override them.
     geometry_shader_manager.SetConstants(m_current_primitive_type);
     pixel_shader_manager.SetConstants();
+    SkipRedundantConstantUploads();
     UploadUniforms();
 
     // Update the pipeline, or compile one if needed.
@@ -936,6 +1038,11 @@ void VertexManagerBase::OnEndFrame()
   m_last_efb_copy_draw_counter = 0;
   m_scheduled_command_buffer_kicks.clear();
 
+  if (g_ActiveConfig.bStaticVertexCache)
+    m_static_vertex_cache.OnEndFrame();
+  else if (m_static_vertex_cache.GetEntryCount() != 0)
+    m_static_vertex_cache.Clear();
+
   // If we have no CPU access at all, leave everything in the one command buffer for maximum
   // parallelism between CPU/GPU, at the cost of slightly higher latency.
   if (m_cpu_accesses_this_frame.empty())
@@ -10,9 +10,12 @@
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
 #include "VideoCommon/CPUCull.h"
+#include "VideoCommon/ConstantManager.h"
+#include "VideoCommon/ConstantUploadTracker.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/StaticVertexCache.h"
 
 class DataReader;
 class NativeVertexFormat;
@@ -101,6 +104,8 @@ public:
 
   PrimitiveType GetCurrentPrimitiveType() const { return m_current_primitive_type; }
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
+  void AddRemappedIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices, const u16* remap,
+                          u32 num_unique_vertices);
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
   virtual DataReader PrepareForAdditionalData(OpcodeDecoder::Primitive primitive, u32 count,
@@ -165,7 +170,7 @@ public:
 
 protected:
   // When utility uniforms are used, the GX uniforms need to be re-written afterwards.
-  static void InvalidateConstants();
+  void InvalidateConstants();
 
   // Prepares the buffer for the next batch of vertices.
   virtual void ResetBuffer(u32 vertex_stride);
@@ -174,6 +179,15 @@ protected:
   virtual void CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_indices,
                             u32* out_base_vertex, u32* out_base_index);
 
+  // Creates a buffer for the static vertex cache holding a copy of the vertex data. Only called
+  // when the backend supports static vertex buffers.
+  virtual std::unique_ptr<StaticVertexBuffer> CreateStaticVertexBuffer(const void* data, u32 size);
+
+  // Commits the current batch like CommitBuffer, but with the vertices taken from a buffer of the
+  // static vertex cache. Only the indices are uploaded.
+  virtual void CommitStaticBuffer(const StaticVertexBuffer& vertex_buffer, u32 vertex_stride,
+                                  u32 num_indices, u32* out_base_vertex, u32* out_base_index);
+
   // Uploads uniform buffers for GX draws.
   virtual void UploadUniforms();
 
@@ -218,9 +232,21 @@ private:
   void UpdatePipelineConfig();
   void UpdatePipelineObject();
 
+  // Clears the dirty flags of stages whose constants match what was last uploaded.
+  void SkipRedundantConstantUploads();
+
+  // Returns the static vertex buffer holding the vertices of the current batch, if there is one.
+  const StaticVertexBuffer* LookupStaticVertices(u32 vertex_stride);
+
   bool m_is_flushed = true;
   FlushStatistics m_flush_statistics = {};
 
+  ConstantUploadTracker<VertexShaderConstants> m_vertex_constants_tracker;
+  ConstantUploadTracker<GeometryShaderConstants> m_geometry_constants_tracker;
+  ConstantUploadTracker<PixelShaderConstants> m_pixel_constants_tracker;
+
+  StaticVertexCache m_static_vertex_cache;
+
   // CPU access tracking
   u32 m_draw_counter = 0;
   u32 m_last_efb_copy_draw_counter = 0;
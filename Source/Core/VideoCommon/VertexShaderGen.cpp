@@ -94,13 +94,13 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
   out.Write("{}", s_shader_uniforms);
   out.Write("}};\n");
 
-  if (uid_data->vs_expand != VSExpand::None)
+  if (uid_data->vs_expand != VSExpand::None || host_config.backend_multiview)
   {
     out.Write("UBO_BINDING(std140, 3) uniform GSBlock {{\n");
     out.Write("{}", s_geometry_shader_uniforms);
     out.Write("}};\n");
 
-    if (api_type == APIType::D3D)
+    if (uid_data->vs_expand != VSExpand::None && api_type == APIType::D3D)
     {
       // D3D doesn't include the base vertex in SV_VertexID
       out.Write("UBO_BINDING(std140, 4) uniform DX_Constants {{\n"
@@ -670,6 +670,14 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
               "}}\n");
   }
 
+  if (host_config.backend_multiview)
+  {
+    // Each view runs the vertex shader separately, so apply the horizontal stereoscopy offset
+    // here instead of in the geometry shader. See GeometryShaderGen for the formula.
+    out.Write("o.pos.x += ((gl_ViewIndex == 0) ? " I_STEREOPARAMS ".x : " I_STEREOPARAMS ".y) * "
+              "(o.pos.w - " I_STEREOPARAMS ".z);\n");
+  }
+
   if (host_config.backend_geometry_shaders)
   {
     AssignVSOutputMembers(out, "vs", "o", uid_data->numTexGens, host_config);
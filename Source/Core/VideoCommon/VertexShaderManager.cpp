@@ -158,7 +158,7 @@ void VertexShaderManager::SetProjectionMatrix()
 
 // Syncs the shader constant buffers with xfmem
 // TODO: A cleaner way to control the matrices without making a mess in the parameters field
-void VertexShaderManager::SetConstants(const std::vector<std::string>& textures)
+void VertexShaderManager::SetConstants(const std::vector<u64>& texture_ids)
 {
   if (constants.missing_color_hex != g_ActiveConfig.iMissingColorValue)
   {
@@ -392,10 +392,10 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures)
       projection_actions.push_back(action);
     }
 
-    for (const auto& texture : textures)
+    for (const u64 texture_id : texture_ids)
     {
       for (const auto action : g_renderer->GetGraphicsModManager().GetProjectionTextureActions(
-               xfmem.projection.type, texture))
+               xfmem.projection.type, texture_id))
       {
         projection_actions.push_back(action);
       }
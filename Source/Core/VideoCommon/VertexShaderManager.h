@@ -4,7 +4,6 @@
 #pragma once
 
 #include <array>
-#include <string>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -25,7 +24,7 @@ public:
 
   // constant management
   void SetProjectionMatrix();
-  void SetConstants(const std::vector<std::string>& textures);
+  void SetConstants(const std::vector<u64>& texture_ids);
 
   void InvalidateXFRange(int start, int end);
   void SetTexMatrixChangedA(u32 value);
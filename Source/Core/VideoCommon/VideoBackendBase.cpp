@@ -43,6 +43,7 @@
 #include "VideoCommon/BPStructs.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/IndexGenerator.h"
@@ -149,6 +150,9 @@ u32 VideoBackendBase::Video_GetQueryResult(PerfQueryType type)
     return 0;
   }
 
+  if (PerfQueryBase::ShouldUseAsyncResults())
+    return g_perf_query->GetAsyncQueryResult(type);
+
   auto& system = Core::System::GetInstance();
   system.GetFifo().SyncGPU(Fifo::SyncGPUReason::PerfQuery);
 
@@ -343,5 +347,6 @@ void VideoBackendBase::ShutdownShared()
 
   auto& system = Core::System::GetInstance();
   VertexLoaderManager::Clear();
+  DisplayListCache::Clear();
   system.GetFifo().Shutdown();
 }
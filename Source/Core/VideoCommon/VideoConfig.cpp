@@ -27,12 +27,20 @@ static bool IsVSyncActive(bool enabled)
          Config::Get(Config::MAIN_EMULATION_SPEED) == 1.0;
 }
 
+static bool IsFastForwardFrameSkipActive(u32 skipped_frames)
+{
+  return skipped_frames != 0 && (Core::GetIsThrottlerTempDisabled() ||
+                                 Config::Get(Config::MAIN_EMULATION_SPEED) == 0.0);
+}
+
 void UpdateActiveConfig()
 {
   if (Movie::IsPlayingInput() && Movie::IsConfigSaved())
     Movie::SetGraphicsConfig();
   g_ActiveConfig = g_Config;
   g_ActiveConfig.bVSyncActive = IsVSyncActive(g_ActiveConfig.bVSync);
+  g_ActiveConfig.bFastForwardFrameSkipActive =
+      IsFastForwardFrameSkipActive(g_ActiveConfig.iFastForwardSkippedFrames);
 }
 
 void VideoConfig::Refresh()
@@ -57,12 +65,15 @@ void VideoConfig::Refresh()
   iAdapter = Config::Get(Config::GFX_ADAPTER);
   iManuallyUploadBuffers = Config::Get(Config::GFX_MTL_MANUALLY_UPLOAD_BUFFERS);
   iUsePresentDrawable = Config::Get(Config::GFX_MTL_USE_PRESENT_DRAWABLE);
+  iUseArgumentBuffers = Config::Get(Config::GFX_MTL_USE_ARGUMENT_BUFFERS);
 
   bWidescreenHack = Config::Get(Config::GFX_WIDESCREEN_HACK);
   aspect_mode = Config::Get(Config::GFX_ASPECT_RATIO);
   suggested_aspect_mode = Config::Get(Config::GFX_SUGGESTED_ASPECT_RATIO);
   bCrop = Config::Get(Config::GFX_CROP);
   iSafeTextureCache_ColorSamples = Config::Get(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES);
+  texture_hash_version = Config::Get(Config::GFX_TEXTURE_HASH_VERSION);
+  iTextureCacheBudget = Config::Get(Config::GFX_TEXTURE_CACHE_BUDGET);
   bShowFPS = Config::Get(Config::GFX_SHOW_FPS);
   bShowFTimes = Config::Get(Config::GFX_SHOW_FTIMES);
   bShowVPS = Config::Get(Config::GFX_SHOW_VPS);
@@ -70,6 +81,8 @@ void VideoConfig::Refresh()
   bShowGraphs = Config::Get(Config::GFX_SHOW_GRAPHS);
   bShowSpeed = Config::Get(Config::GFX_SHOW_SPEED);
   bShowSpeedColors = Config::Get(Config::GFX_SHOW_SPEED_COLORS);
+  bShowTLBStats = Config::Get(Config::GFX_SHOW_TLB_STATS);
+  bShowFrameBreakdown = Config::Get(Config::GFX_SHOW_FRAME_BREAKDOWN);
   iPerfSampleUSec = Config::Get(Config::GFX_PERF_SAMP_WINDOW) * 1000;
   bShowNetPlayPing = Config::Get(Config::GFX_SHOW_NETPLAY_PING);
   bShowNetPlayMessages = Config::Get(Config::GFX_SHOW_NETPLAY_MESSAGES);
@@ -82,6 +95,8 @@ void VideoConfig::Refresh()
   bDumpBaseTextures = Config::Get(Config::GFX_DUMP_BASE_TEXTURES);
   bHiresTextures = Config::Get(Config::GFX_HIRES_TEXTURES);
   bCacheHiresTextures = Config::Get(Config::GFX_CACHE_HIRES_TEXTURES);
+  bHiresTexturesAsync = Config::Get(Config::GFX_HIRES_TEXTURES_ASYNC);
+  bHiresTexturesCompress = Config::Get(Config::GFX_HIRES_TEXTURES_COMPRESS);
   bDumpEFBTarget = Config::Get(Config::GFX_DUMP_EFB_TARGET);
   bDumpXFBTarget = Config::Get(Config::GFX_DUMP_XFB_TARGET);
   bDumpFramesAsImages = Config::Get(Config::GFX_DUMP_FRAMES_AS_IMAGES);
@@ -90,6 +105,7 @@ void VideoConfig::Refresh()
   sDumpCodec = Config::Get(Config::GFX_DUMP_CODEC);
   sDumpPixelFormat = Config::Get(Config::GFX_DUMP_PIXEL_FORMAT);
   sDumpEncoder = Config::Get(Config::GFX_DUMP_ENCODER);
+  sDumpHardwareEncoder = Config::Get(Config::GFX_DUMP_HARDWARE_ENCODER);
   sDumpPath = Config::Get(Config::GFX_DUMP_PATH);
   iBitrateKbps = Config::Get(Config::GFX_BITRATE_KBPS);
   bInternalResolutionFrameDumps = Config::Get(Config::GFX_INTERNAL_RESOLUTION_FRAME_DUMPS);
@@ -100,6 +116,8 @@ void VideoConfig::Refresh()
   iMultisamples = Config::Get(Config::GFX_MSAA);
   bSSAA = Config::Get(Config::GFX_SSAA);
   iEFBScale = Config::Get(Config::GFX_EFB_SCALE);
+  bDynamicEFBScale = Config::Get(Config::GFX_DYNAMIC_EFB_SCALE);
+  iDynamicEFBScaleMin = Config::Get(Config::GFX_DYNAMIC_EFB_SCALE_MIN);
   bTexFmtOverlayEnable = Config::Get(Config::GFX_TEXFMT_OVERLAY_ENABLE);
   bTexFmtOverlayCenter = Config::Get(Config::GFX_TEXFMT_OVERLAY_CENTER);
   bWireFrame = Config::Get(Config::GFX_ENABLE_WIREFRAME);
@@ -107,17 +125,27 @@ void VideoConfig::Refresh()
   bBorderlessFullscreen = Config::Get(Config::GFX_BORDERLESS_FULLSCREEN);
   bEnableValidationLayer = Config::Get(Config::GFX_ENABLE_VALIDATION_LAYER);
   bBackendMultithreading = Config::Get(Config::GFX_BACKEND_MULTITHREADING);
+  bLowLatencyPresent = Config::Get(Config::GFX_LOW_LATENCY_PRESENT);
   iCommandBufferExecuteInterval = Config::Get(Config::GFX_COMMAND_BUFFER_EXECUTE_INTERVAL);
   bShaderCache = Config::Get(Config::GFX_SHADER_CACHE);
   bWaitForShadersBeforeStarting = Config::Get(Config::GFX_WAIT_FOR_SHADERS_BEFORE_STARTING);
   iShaderCompilationMode = Config::Get(Config::GFX_SHADER_COMPILATION_MODE);
+  bSpecializedUberShaders = Config::Get(Config::GFX_SPECIALIZED_UBERSHADERS);
+  bSharedShaderCache = Config::Get(Config::GFX_SHARED_SHADER_CACHE);
+  iSharedShaderCacheSize = Config::Get(Config::GFX_SHARED_SHADER_CACHE_SIZE);
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
   iShaderPrecompilerThreads = Config::Get(Config::GFX_SHADER_PRECOMPILER_THREADS);
   bCPUCull = Config::Get(Config::GFX_CPU_CULL);
+  bDisplayListCache = Config::Get(Config::GFX_DISPLAY_LIST_CACHE);
+  bStaticVertexCache = Config::Get(Config::GFX_STATIC_VERTEX_CACHE);
+  bDeduplicateIndexedVertices = Config::Get(Config::GFX_DEDUPLICATE_INDEXED_VERTICES);
+  bAsyncTextureUploads = Config::Get(Config::GFX_ASYNC_TEXTURE_UPLOADS);
 
   texture_filtering_mode = Config::Get(Config::GFX_ENHANCE_FORCE_TEXTURE_FILTERING);
   iMaxAnisotropy = Config::Get(Config::GFX_ENHANCE_MAX_ANISOTROPY);
   sPostProcessingShader = Config::Get(Config::GFX_ENHANCE_POST_SHADER);
+  fPostProcessingScale =
+      std::clamp(Config::Get(Config::GFX_ENHANCE_POST_SHADER_SCALE), 0.25f, 1.0f);
   bForceTrueColor = Config::Get(Config::GFX_ENHANCE_FORCE_TRUE_COLOR);
   bDisableCopyFilter = Config::Get(Config::GFX_ENHANCE_DISABLE_COPY_FILTER);
   bArbitraryMipmapDetection = Config::Get(Config::GFX_ENHANCE_ARBITRARY_MIPMAP_DETECTION);
@@ -135,6 +163,7 @@ void VideoConfig::Refresh()
   bEFBAccessEnable = Config::Get(Config::GFX_HACK_EFB_ACCESS_ENABLE);
   bEFBAccessDeferInvalidation = Config::Get(Config::GFX_HACK_EFB_DEFER_INVALIDATION);
   bBBoxEnable = Config::Get(Config::GFX_HACK_BBOX_ENABLE);
+  bBBoxSpeculative = Config::Get(Config::GFX_HACK_BBOX_SPECULATIVE);
   bForceProgressive = Config::Get(Config::GFX_HACK_FORCE_PROGRESSIVE);
   bSkipEFBCopyToRam = Config::Get(Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM);
   bSkipXFBCopyToRam = Config::Get(Config::GFX_HACK_SKIP_XFB_COPY_TO_RAM);
@@ -149,11 +178,14 @@ void VideoConfig::Refresh()
   iEFBAccessTileSize = Config::Get(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE);
   iMissingColorValue = Config::Get(Config::GFX_HACK_MISSING_COLOR_VALUE);
   bFastTextureSampling = Config::Get(Config::GFX_HACK_FAST_TEXTURE_SAMPLING);
+  iFastForwardSkippedFrames = Config::Get(Config::GFX_HACK_FAST_FORWARD_SKIPPED_FRAMES);
+  iFastForwardFramePeriod = Config::Get(Config::GFX_HACK_FAST_FORWARD_FRAME_PERIOD);
 #ifdef __APPLE__
   bNoMipmapping = Config::Get(Config::GFX_HACK_NO_MIPMAPPING);
 #endif
 
   bPerfQueriesEnable = Config::Get(Config::GFX_PERF_QUERIES_ENABLE);
+  bPerfQueriesAsync = Config::Get(Config::GFX_PERF_QUERIES_ASYNC);
 
   bGraphicMods = Config::Get(Config::GFX_MODS_ENABLE);
 }
@@ -52,6 +52,16 @@ enum class TextureFilteringMode : int
   Linear,
 };
 
+// Selects the hash used for the texture cache and for custom texture names. Since it changes the
+// names of dumped and custom textures, the numeric values are stored in the INI and must not change.
+enum class TextureHashVersion : int
+{
+  // The CRC32 based hash for the texture cache, XXH64 for tex1_ names
+  Legacy = 1,
+  // XXH3 for both, with tex2_ names
+  XXH3 = 2,
+};
+
 enum class TriState : int
 {
   Off,
@@ -69,6 +79,8 @@ struct VideoConfig final
   // General
   bool bVSync = false;
   bool bVSyncActive = false;
+  // Whether frames are skipped, which is only done while the emulation is unthrottled.
+  bool bFastForwardFrameSkipActive = false;
   bool bWidescreenHack = false;
   AspectMode aspect_mode{};
   AspectMode suggested_aspect_mode{};
@@ -79,9 +91,14 @@ struct VideoConfig final
   u32 iMultisamples = 0;
   bool bSSAA = false;
   int iEFBScale = 0;
+  // Lowers the internal resolution, down to iDynamicEFBScaleMin, while the GPU can't keep up.
+  bool bDynamicEFBScale = false;
+  int iDynamicEFBScaleMin = 1;
   TextureFilteringMode texture_filtering_mode = TextureFilteringMode::Default;
   int iMaxAnisotropy = 0;
   std::string sPostProcessingShader;
+  // Fraction of the output resolution the post-processing shader runs at.
+  float fPostProcessingScale = 1.0f;
   bool bForceTrueColor = false;
   bool bDisableCopyFilter = false;
   bool bArbitraryMipmapDetection = false;
@@ -95,6 +112,8 @@ struct VideoConfig final
   bool bShowGraphs = false;
   bool bShowSpeed = false;
   bool bShowSpeedColors = false;
+  bool bShowTLBStats = false;
+  bool bShowFrameBreakdown = false;
   int iPerfSampleUSec = 0;
   bool bShowNetPlayPing = false;
   bool bShowNetPlayMessages = false;
@@ -115,6 +134,8 @@ struct VideoConfig final
   bool bDumpBaseTextures = false;
   bool bHiresTextures = false;
   bool bCacheHiresTextures = false;
+  bool bHiresTexturesAsync = false;
+  bool bHiresTexturesCompress = false;
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bDumpFramesAsImages = false;
@@ -122,6 +143,8 @@ struct VideoConfig final
   std::string sDumpCodec;
   std::string sDumpPixelFormat;
   std::string sDumpEncoder;
+  // FFmpeg hardware backend to encode with when no encoder is set: nvenc, vaapi, videotoolbox, amf.
+  std::string sDumpHardwareEncoder;
   std::string sDumpFormat;
   std::string sDumpPath;
   bool bInternalResolutionFrameDumps = false;
@@ -136,9 +159,15 @@ struct VideoConfig final
   bool bEFBAccessEnable = false;
   bool bEFBAccessDeferInvalidation = false;
   bool bPerfQueriesEnable = false;
+  bool bPerfQueriesAsync = false;
   bool bBBoxEnable = false;
+  bool bBBoxSpeculative = false;
   bool bForceProgressive = false;
   bool bCPUCull = false;
+  bool bDisplayListCache = false;
+  bool bStaticVertexCache = false;
+  bool bDeduplicateIndexedVertices = false;
+  bool bAsyncTextureUploads = false;
 
   bool bEFBEmulateFormatChanges = false;
   bool bSkipEFBCopyToRam = false;
@@ -149,6 +178,8 @@ struct VideoConfig final
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
   int iSafeTextureCache_ColorSamples = 0;
+  TextureHashVersion texture_hash_version = TextureHashVersion::Legacy;
+  int iTextureCacheBudget = 0;  // in MiB, 0 means unlimited
   float fAspectRatioHackW = 1;  // Initial value needed for the first frame
   float fAspectRatioHackH = 1;
   bool bEnablePixelLighting = false;
@@ -159,6 +190,10 @@ struct VideoConfig final
   int iSaveTargetId = 0;  // TODO: Should be dropped
   u32 iMissingColorValue = 0;
   bool bFastTextureSampling = false;
+  // While fast-forwarding, the draws of the first iFastForwardSkippedFrames frames of every
+  // iFastForwardFramePeriod frames are skipped and those frames aren't presented.
+  u32 iFastForwardSkippedFrames = 0;
+  u32 iFastForwardFramePeriod = 0;
 #ifdef __APPLE__
   bool bNoMipmapping = false;  // Used by macOS fifoci to work around an M1 bug
 #endif
@@ -178,6 +213,7 @@ struct VideoConfig final
   // Metal only config
   TriState iManuallyUploadBuffers = TriState::Auto;
   TriState iUsePresentDrawable = TriState::Auto;
+  TriState iUseArgumentBuffers = TriState::Auto;
 
   // Enable API validation layers, currently only supported with Vulkan.
   bool bEnableValidationLayer = false;
@@ -185,6 +221,10 @@ struct VideoConfig final
   // Multithreaded submission, currently only supported with Vulkan.
   bool bBackendMultithreading = true;
 
+  // Keeps at most one frame waiting to be presented, where the backend can tell when frames are
+  // displayed (Vulkan with VK_KHR_present_wait, D3D with frame latency waitable swap chains).
+  bool bLowLatencyPresent = false;
+
   // Early command buffer execution interval in number of draws.
   // Currently only supported with Vulkan.
   int iCommandBufferExecuteInterval = 0;
@@ -193,6 +233,13 @@ struct VideoConfig final
   bool bWaitForShadersBeforeStarting = false;
   ShaderCompilationMode iShaderCompilationMode{};
 
+  // Compile ubershader variants specialized on TEV stage count, indirect, fog and lighting.
+  bool bSpecializedUberShaders = false;
+
+  // Shader binary store shared by all games, and its size limit in MiB.
+  bool bSharedShaderCache = false;
+  int iSharedShaderCacheSize = 0;
+
   // Number of shader compiler threads.
   // 0 disables background compilation.
   // -1 uses an automatic number based on the CPU threads.
@@ -255,6 +302,8 @@ struct VideoConfig final
     bool bSupportsPartialMultisampleResolve = false;
     bool bSupportsDynamicVertexLoader = false;
     bool bSupportsVSLinePointExpand = false;
+    bool bSupportsStaticVertexBuffers = false;
+    bool bSupportsMultiview = false;
   } backend_info;
 
   // Utility
@@ -266,6 +315,10 @@ struct VideoConfig final
       return true;
     return bPreferVSForLinePointExpansion;
   }
+  bool UseMultiviewForStereo() const
+  {
+    return stereo_mode != StereoMode::Off && backend_info.bSupportsMultiview;
+  }
   bool MultisamplingEnabled() const { return iMultisamples > 1; }
   bool ExclusiveFullscreenEnabled() const
   {
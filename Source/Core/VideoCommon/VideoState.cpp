@@ -12,6 +12,7 @@
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/PixelShaderManager.h"
@@ -94,6 +95,9 @@ void VideoCommon_DoState(PointerWrap& p)
   g_renderer->DoState(p);
   p.DoMarker("Renderer");
 
+  g_perf_query->DoState(p);
+  p.DoMarker("PerfQuery");
+
   // Refresh state.
   if (p.IsReadMode())
   {
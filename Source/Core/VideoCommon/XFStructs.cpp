@@ -120,6 +120,8 @@ static void XFRegWritten(Core::System& system, VertexShaderManager& vertex_shade
     case XFMEM_SETVIEWPORT + 3:
     case XFMEM_SETVIEWPORT + 4:
     case XFMEM_SETVIEWPORT + 5:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       vertex_shader_manager.SetViewportChanged();
       system.GetPixelShaderManager().SetViewportChanged();
@@ -133,6 +135,8 @@ static void XFRegWritten(Core::System& system, VertexShaderManager& vertex_shade
     case XFMEM_SETPROJECTION + 4:
     case XFMEM_SETPROJECTION + 5:
     case XFMEM_SETPROJECTION + 6:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       vertex_shader_manager.SetProjectionChanged();
       system.GetGeometryShaderManager().SetProjectionChanged();
@@ -151,6 +155,8 @@ static void XFRegWritten(Core::System& system, VertexShaderManager& vertex_shade
     case XFMEM_SETTEXMTXINFO + 5:
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       vertex_shader_manager.SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
       break;
@@ -163,6 +169,8 @@ static void XFRegWritten(Core::System& system, VertexShaderManager& vertex_shade
     case XFMEM_SETPOSTMTXINFO + 5:
     case XFMEM_SETPOSTMTXINFO + 6:
     case XFMEM_SETPOSTMTXINFO + 7:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       vertex_shader_manager.SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
       break;
@@ -232,12 +240,20 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
       base_address = XFMEM_REGISTERS_START;
     }
 
-    XFMemWritten(vertex_shader_manager, xf_mem_transfer_size, xf_mem_base);
+    // Games often reload matrices with the values they already hold. Only break the current
+    // batch when something actually changes, like LoadIndexedXF does.
+    u32* const dest = (u32*)&xfmem + xf_mem_base;
     for (u32 i = 0; i < xf_mem_transfer_size; i++)
     {
-      ((u32*)&xfmem)[xf_mem_base + i] = Common::swap32(data);
-      data += 4;
+      if (dest[i] != Common::swap32(data + i * 4))
+      {
+        XFMemWritten(vertex_shader_manager, xf_mem_transfer_size, xf_mem_base);
+        for (u32 j = i; j < xf_mem_transfer_size; j++)
+          dest[j] = Common::swap32(data + j * 4);
+        break;
+      }
     }
+    data += xf_mem_transfer_size * 4;
   }
 
   // write to XF regs
@@ -264,7 +280,7 @@ void LoadIndexedXF(CPArray array, u32 index, u16 address, u8 size)
   u32* newData;
   auto& system = Core::System::GetInstance();
   auto& fifo = system.GetFifo();
-  if (fifo.UseDeterministicGPUThread())
+  if (fifo.UseFifoAuxBuffer())
   {
     newData = (u32*)fifo.PopFifoAuxBuffer(size * sizeof(u32));
   }
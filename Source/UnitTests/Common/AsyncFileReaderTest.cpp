@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/AsyncFileReader.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+
+class AsyncFileReaderTest : public testing::Test
+{
+protected:
+  AsyncFileReaderTest() : m_directory(File::CreateTempDir()), m_path(m_directory + "/file.bin")
+  {
+    m_contents.resize(0x10000);
+    for (size_t i = 0; i < m_contents.size(); i++)
+      m_contents[i] = static_cast<u8>(i * 7 + i / 256);
+
+    File::IOFile file(m_path, "wb");
+    file.WriteBytes(m_contents.data(), m_contents.size());
+  }
+
+  ~AsyncFileReaderTest() override { File::DeleteDirRecursively(m_directory); }
+
+  std::vector<u8> Expected(u64 offset, u64 size) const
+  {
+    return std::vector<u8>(m_contents.begin() + offset, m_contents.begin() + offset + size);
+  }
+
+  std::string m_directory;
+  std::string m_path;
+  std::vector<u8> m_contents;
+};
+
+TEST_F(AsyncFileReaderTest, ReadAt)
+{
+  File::IOFile file(m_path, "rb");
+  File::AsyncFileReader reader(file, 2);
+
+  std::vector<u8> buffer(0x1234);
+  EXPECT_TRUE(reader.ReadAt(0x4321, buffer.size(), buffer.data()));
+  EXPECT_EQ(Expected(0x4321, buffer.size()), buffer);
+
+  // Reading past the end fails
+  EXPECT_FALSE(reader.ReadAt(m_contents.size() - 0x10, 0x20, buffer.data()));
+}
+
+TEST_F(AsyncFileReaderTest, SubmitAndWait)
+{
+  File::IOFile file(m_path, "rb");
+  File::AsyncFileReader reader(file, 3);
+
+  constexpr u64 SIZE = 0x1000;
+  std::vector<std::vector<u8>> buffers(8, std::vector<u8>(SIZE));
+  std::vector<File::AsyncFileReader::RequestID> ids;
+  for (size_t i = 0; i < buffers.size(); i++)
+    ids.push_back(reader.Submit(i * 0x1800, SIZE, buffers[i].data()));
+
+  // Waiting out of order is fine
+  for (size_t i = buffers.size(); i-- > 0;)
+  {
+    EXPECT_TRUE(reader.Wait(ids[i]));
+    EXPECT_EQ(Expected(i * 0x1800, SIZE), buffers[i]);
+  }
+
+  std::vector<u8> buffer(0x20);
+  const File::AsyncFileReader::RequestID id =
+      reader.Submit(m_contents.size() - 0x10, buffer.size(), buffer.data());
+  EXPECT_FALSE(reader.Wait(id));
+}
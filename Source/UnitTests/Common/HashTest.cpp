@@ -0,0 +1,50 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+
+TEST(Hash, XXH3Hash64Full)
+{
+  std::vector<u8> data(1000);
+  std::iota(data.begin(), data.end(), u8(0));
+
+  const u64 hash = Common::GetXXH3Hash64(data.data(), 1000, 0);
+  EXPECT_EQ(hash, Common::GetXXH3Hash64(data.data(), 1000, 0));
+
+  // Every byte, including the ones past the last whole u64, affects the hash.
+  for (size_t i : {0u, 500u, 995u, 999u})
+  {
+    data[i] ^= 1;
+    EXPECT_NE(hash, Common::GetXXH3Hash64(data.data(), 1000, 0));
+    data[i] ^= 1;
+  }
+
+  // So does the length.
+  EXPECT_NE(hash, Common::GetXXH3Hash64(data.data(), 999, 0));
+
+  // Asking for as many samples as there is data hashes everything.
+  EXPECT_EQ(hash, Common::GetXXH3Hash64(data.data(), 1000, 125));
+}
+
+TEST(Hash, XXH3Hash64Sampled)
+{
+  // 1024 u64s with 64 samples, so every 16th u64 is hashed.
+  std::vector<u8> data(8192);
+  std::iota(data.begin(), data.end(), u8(0));
+
+  const u64 hash = Common::GetXXH3Hash64(data.data(), 8192, 64);
+  EXPECT_EQ(hash, Common::GetXXH3Hash64(data.data(), 8192, 64));
+  EXPECT_NE(hash, Common::GetXXH3Hash64(data.data(), 8192, 0));
+
+  data[16 * 8 * 10] ^= 1;
+  EXPECT_NE(hash, Common::GetXXH3Hash64(data.data(), 8192, 64));
+  data[16 * 8 * 10] ^= 1;
+
+  data[16 * 8 * 10 + 8] ^= 1;
+  EXPECT_EQ(hash, Common::GetXXH3Hash64(data.data(), 8192, 64));
+}
@@ -0,0 +1,34 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Histogram.h"
+
+TEST(Histogram, Buckets)
+{
+  Common::Histogram<3> histogram({10, 100, 1000});
+
+  for (u64 value : {0, 10, 11, 100, 500, 1000, 1001, 123456})
+    histogram.Add(value);
+
+  const auto snapshot = histogram.GetSnapshot();
+  const std::array<u64, 4> expected_counts = {2, 2, 2, 2};
+  EXPECT_EQ(snapshot.counts, expected_counts);
+  EXPECT_EQ(snapshot.count, 8u);
+  EXPECT_EQ(snapshot.sum, 0u + 10 + 11 + 100 + 500 + 1000 + 1001 + 123456);
+}
+
+TEST(Histogram, Reset)
+{
+  Common::Histogram<2> histogram({1, 2});
+  histogram.Add(1);
+  histogram.Add(5);
+  histogram.Reset();
+
+  const auto snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(snapshot.count, 0u);
+  EXPECT_EQ(snapshot.sum, 0u);
+}
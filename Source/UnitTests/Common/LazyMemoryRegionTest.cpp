@@ -0,0 +1,36 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/MemArena.h"
+
+using Common::LazyMemoryRegion;
+
+TEST(LazyMemoryRegion, ReadsZerosAndClears)
+{
+  // Large enough that committing all of it up front would be noticeable.
+  constexpr size_t SIZE = 0x4000'0000;
+
+  LazyMemoryRegion region;
+  u8* memory = static_cast<u8*>(region.Create(SIZE));
+  ASSERT_NE(memory, nullptr);
+  EXPECT_EQ(region.GetSize(), SIZE);
+
+  EXPECT_EQ(memory[0], 0);
+  EXPECT_EQ(memory[SIZE / 2 + 123], 0);
+  EXPECT_EQ(memory[SIZE - 1], 0);
+
+  memory[5] = 0x12;
+  memory[SIZE - 1] = 0x34;
+  EXPECT_EQ(memory[5], 0x12);
+  EXPECT_EQ(memory[SIZE - 1], 0x34);
+
+  region.Clear();
+  EXPECT_EQ(memory[5], 0);
+  EXPECT_EQ(memory[SIZE - 1], 0);
+
+  region.Release();
+  EXPECT_EQ(region.GetSize(), 0u);
+}
@@ -0,0 +1,198 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/LinearDiskCache.h"
+
+namespace
+{
+struct Key
+{
+  u32 id;
+  u16 variant;
+  u16 padding;
+};
+
+Key MakeKey(u32 id)
+{
+  return Key{id, static_cast<u16>(id * 3), 0};
+}
+
+std::vector<u32> MakeValue(u32 id, u32 size)
+{
+  std::vector<u32> value(size);
+  for (u32 i = 0; i < size; ++i)
+    value[i] = id * 1000 + i;
+  return value;
+}
+
+class Reader final : public LinearDiskCacheReader<Key, u32>
+{
+public:
+  void Read(const Key& key, const u32* value, u32 value_size) override
+  {
+    entries.emplace_back(key.id, std::vector<u32>(value, value + value_size));
+  }
+
+  std::vector<std::pair<u32, std::vector<u32>>> entries;
+};
+
+class LinearDiskCacheTest : public testing::Test
+{
+protected:
+  LinearDiskCacheTest()
+      : m_directory(File::CreateTempDir()), m_filename(m_directory + "/cache.bin")
+  {
+  }
+
+  ~LinearDiskCacheTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  void CheckFind(const LinearDiskCache<Key, u32>& cache, u32 id, const std::vector<u32>& expected)
+  {
+    u32 size = 0;
+    const u32* value = cache.Find(MakeKey(id), &size);
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(std::vector<u32>(value, value + size), expected);
+  }
+
+  const std::string m_directory;
+  const std::string m_filename;
+};
+}  // namespace
+
+TEST_F(LinearDiskCacheTest, AppendAndReopen)
+{
+  {
+    LinearDiskCache<Key, u32> cache;
+    EXPECT_EQ(cache.Open(m_filename), 0u);
+    for (u32 id = 1; id <= 20; ++id)
+    {
+      const std::vector<u32> value = MakeValue(id, id % 5);
+      cache.Append(MakeKey(id), value.data(), static_cast<u32>(value.size()));
+    }
+    CheckFind(cache, 7, MakeValue(7, 2));
+  }
+
+  // The first reopen uses the index written when the cache was closed.
+  for (int i = 0; i < 2; ++i)
+  {
+    LinearDiskCache<Key, u32> cache;
+    Reader reader;
+    EXPECT_EQ(cache.OpenAndRead(m_filename, reader), 20u);
+    ASSERT_EQ(reader.entries.size(), 20u);
+    for (u32 id = 1; id <= 20; ++id)
+    {
+      EXPECT_EQ(reader.entries[id - 1].first, id);
+      EXPECT_EQ(reader.entries[id - 1].second, MakeValue(id, id % 5));
+      CheckFind(cache, id, MakeValue(id, id % 5));
+    }
+    u32 size;
+    EXPECT_EQ(cache.Find(MakeKey(21), &size), nullptr);
+
+    // Drop the index the second time around, which makes the cache scan the whole file.
+    cache.Close();
+    File::Delete(m_filename + ".idx");
+  }
+}
+
+TEST_F(LinearDiskCacheTest, AppendsAfterIndexAreFound)
+{
+  {
+    LinearDiskCache<Key, u32> cache;
+    cache.Open(m_filename);
+    const std::vector<u32> value = MakeValue(1, 3);
+    cache.Append(MakeKey(1), value.data(), 3);
+  }
+
+  // Keep an index which only covers the first pair, as if the emulator was closed uncleanly.
+  std::string index;
+  ASSERT_TRUE(File::ReadFileToString(m_filename + ".idx", index));
+  {
+    LinearDiskCache<Key, u32> cache;
+    cache.Open(m_filename);
+    const std::vector<u32> value = MakeValue(2, 4);
+    cache.Append(MakeKey(2), value.data(), 4);
+  }
+  ASSERT_TRUE(File::WriteStringToFile(m_filename + ".idx", index));
+
+  LinearDiskCache<Key, u32> cache;
+  EXPECT_EQ(cache.Open(m_filename), 2u);
+  CheckFind(cache, 1, MakeValue(1, 3));
+  CheckFind(cache, 2, MakeValue(2, 4));
+}
+
+TEST_F(LinearDiskCacheTest, DuplicateKeysAreCompacted)
+{
+  {
+    LinearDiskCache<Key, u32> cache;
+    cache.Open(m_filename);
+    for (u32 id : {1u, 2u, 1u, 3u, 1u})
+    {
+      const std::vector<u32> value = MakeValue(id, 2);
+      cache.Append(MakeKey(id), value.data(), 2);
+    }
+  }
+  const u64 size_with_duplicates = File::GetSize(m_filename);
+
+  LinearDiskCache<Key, u32> cache;
+  Reader reader;
+  EXPECT_EQ(cache.OpenAndRead(m_filename, reader), 3u);
+  ASSERT_EQ(reader.entries.size(), 3u);
+  EXPECT_EQ(reader.entries[0].first, 1u);
+  EXPECT_EQ(reader.entries[1].first, 2u);
+  EXPECT_EQ(reader.entries[2].first, 3u);
+  EXPECT_LT(File::GetSize(m_filename), size_with_duplicates);
+
+  // Appending to the compacted file keeps working.
+  const std::vector<u32> value = MakeValue(4, 1);
+  cache.Append(MakeKey(4), value.data(), 1);
+  cache.Close();
+  EXPECT_EQ(cache.Open(m_filename), 4u);
+  CheckFind(cache, 4, MakeValue(4, 1));
+}
+
+TEST_F(LinearDiskCacheTest, StaleIndexIsIgnored)
+{
+  {
+    LinearDiskCache<Key, u32> cache;
+    cache.Open(m_filename);
+    for (u32 id = 1; id <= 3; ++id)
+    {
+      const std::vector<u32> value = MakeValue(id, 8);
+      cache.Append(MakeKey(id), value.data(), 8);
+    }
+  }
+  std::string index;
+  ASSERT_TRUE(File::ReadFileToString(m_filename + ".idx", index));
+
+  // Recreate the cache behind the index's back.
+  File::Delete(m_filename);
+  {
+    LinearDiskCache<Key, u32> cache;
+    cache.Open(m_filename);
+    const std::vector<u32> value = MakeValue(9, 1);
+    cache.Append(MakeKey(9), value.data(), 1);
+  }
+  ASSERT_TRUE(File::WriteStringToFile(m_filename + ".idx", index));
+
+  LinearDiskCache<Key, u32> cache;
+  EXPECT_EQ(cache.Open(m_filename), 1u);
+  CheckFind(cache, 9, MakeValue(9, 1));
+}
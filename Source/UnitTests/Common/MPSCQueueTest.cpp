@@ -0,0 +1,82 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/MPSCQueue.h"
+
+TEST(MPSCQueue, Simple)
+{
+  Common::MPSCQueue<u32> q;
+
+  EXPECT_TRUE(q.Empty());
+
+  q.Push(1);
+  EXPECT_FALSE(q.Empty());
+
+  u32 v;
+  EXPECT_TRUE(q.Pop(v));
+  EXPECT_EQ(1u, v);
+  EXPECT_TRUE(q.Empty());
+  EXPECT_FALSE(q.Pop(v));
+
+  // Test the FIFO order.
+  for (u32 i = 0; i < 1000; ++i)
+    q.Push(i);
+  for (u32 i = 0; i < 1000; ++i)
+  {
+    u32 v2;
+    EXPECT_TRUE(q.Pop(v2));
+    EXPECT_EQ(i, v2);
+  }
+  EXPECT_TRUE(q.Empty());
+
+  for (u32 i = 0; i < 1000; ++i)
+    q.Push(i);
+  EXPECT_FALSE(q.Empty());
+  q.Clear();
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(MPSCQueue, MultiThreaded)
+{
+  constexpr u32 NUM_PRODUCERS = 4;
+  constexpr u32 COUNT = 100000;
+
+  // Values are tagged with the producer in the top bits.
+  Common::MPSCQueue<u32> q;
+
+  auto inserter = [&q](u32 producer) {
+    for (u32 i = 0; i < COUNT; ++i)
+      q.Push((producer << 24) | i);
+  };
+
+  auto popper = [&q]() {
+    // Elements from one producer have to arrive in the order they were pushed.
+    std::array<u32, NUM_PRODUCERS> next{};
+    for (u32 i = 0; i < NUM_PRODUCERS * COUNT; ++i)
+    {
+      u32 v;
+      while (!q.Pop(v))
+        ;
+      const u32 producer = v >> 24;
+      ASSERT_LT(producer, NUM_PRODUCERS);
+      EXPECT_EQ(next[producer], v & 0xFFFFFF);
+      next[producer]++;
+    }
+    EXPECT_TRUE(q.Empty());
+  };
+
+  std::thread popper_thread(popper);
+  std::vector<std::thread> inserter_threads;
+  for (u32 i = 0; i < NUM_PRODUCERS; ++i)
+    inserter_threads.emplace_back(inserter, i);
+
+  popper_thread.join();
+  for (std::thread& thread : inserter_threads)
+    thread.join();
+}
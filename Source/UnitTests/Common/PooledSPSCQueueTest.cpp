@@ -0,0 +1,96 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/PooledSPSCQueue.h"
+
+TEST(PooledSPSCQueue, Simple)
+{
+  Common::PooledSPSCQueue<u32> q;
+
+  EXPECT_EQ(0u, q.Size());
+  EXPECT_TRUE(q.Empty());
+
+  q.Push(1);
+  EXPECT_EQ(1u, q.Size());
+  EXPECT_FALSE(q.Empty());
+  EXPECT_EQ(1u, q.Front());
+
+  u32 v;
+  EXPECT_TRUE(q.Pop(v));
+  EXPECT_EQ(1u, v);
+  EXPECT_EQ(0u, q.Size());
+  EXPECT_TRUE(q.Empty());
+  EXPECT_FALSE(q.Pop(v));
+
+  // Test the FIFO order, also once the elements are being reused.
+  for (u32 round = 0; round < 3; ++round)
+  {
+    for (u32 i = 0; i < 1000; ++i)
+      q.Push(i);
+    EXPECT_EQ(1000u, q.Size());
+    for (u32 i = 0; i < 1000; ++i)
+    {
+      u32 v2;
+      EXPECT_TRUE(q.Pop(v2));
+      EXPECT_EQ(i, v2);
+    }
+    EXPECT_TRUE(q.Empty());
+  }
+
+  for (u32 i = 0; i < 1000; ++i)
+    q.Push(i);
+  EXPECT_FALSE(q.Empty());
+  q.Clear();
+  EXPECT_EQ(0u, q.Size());
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(PooledSPSCQueue, ReusedElementsKeepTheirCapacity)
+{
+  Common::PooledSPSCQueue<std::vector<u8>> q;
+
+  q.Push(std::vector<u8>(100));
+  const u8* const data = q.Front().data();
+  q.Pop();
+
+  // The first element is only reused once the one after it has been popped too.
+  q.Push(std::vector<u8>(1));
+  q.Pop();
+
+  const std::vector<u8> small(50);
+  q.Push(small);
+  EXPECT_EQ(50u, q.Front().size());
+  EXPECT_EQ(data, q.Front().data());
+}
+
+TEST(PooledSPSCQueue, MultiThreaded)
+{
+  Common::PooledSPSCQueue<u32> q;
+
+  auto inserter = [&q]() {
+    for (u32 i = 0; i < 100000; ++i)
+      q.Push(i);
+  };
+
+  auto popper = [&q]() {
+    for (u32 i = 0; i < 100000; ++i)
+    {
+      while (q.Empty())
+        ;
+      u32 v;
+      q.Pop(v);
+      EXPECT_EQ(i, v);
+    }
+  };
+
+  std::thread popper_thread(popper);
+  std::thread inserter_thread(inserter);
+
+  popper_thread.join();
+  inserter_thread.join();
+}
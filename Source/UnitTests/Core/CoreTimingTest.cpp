@@ -126,6 +126,41 @@ TEST(CoreTiming, BasicOrder)
   AdvanceAndCheck(4, MAX_SLICE_LENGTH);
 }
 
+TEST(CoreTiming, RemoveEvent)
+{
+  ScopeInit guard;
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& system = Core::System::GetInstance();
+  auto& core_timing = system.GetCoreTiming();
+
+  CoreTiming::EventType* cb_a = core_timing.RegisterEvent("callbackA", CallbackTemplate<0>);
+  CoreTiming::EventType* cb_b = core_timing.RegisterEvent("callbackB", CallbackTemplate<1>);
+  CoreTiming::EventType* cb_c = core_timing.RegisterEvent("callbackC", CallbackTemplate<2>);
+  CoreTiming::EventType* cb_d = core_timing.RegisterEvent("callbackD", CallbackTemplate<3>);
+  CoreTiming::EventType* cb_e = core_timing.RegisterEvent("callbackE", CallbackTemplate<4>);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  // B and C get removed from the middle and the front of the queue.
+  core_timing.ScheduleEvent(1000, cb_a, CB_IDS[0]);
+  core_timing.ScheduleEvent(500, cb_b, CB_IDS[1]);
+  core_timing.ScheduleEvent(100, cb_c, CB_IDS[2]);
+  core_timing.ScheduleEvent(800, cb_b, CB_IDS[1]);
+  core_timing.ScheduleEvent(700, cb_d, CB_IDS[3]);
+  core_timing.ScheduleEvent(1200, cb_e, CB_IDS[4]);
+  core_timing.ScheduleEvent(0, cb_c, CB_IDS[2], CoreTiming::FromThread::ANY);
+
+  core_timing.RemoveEvent(cb_b);
+  core_timing.RemoveAllEvents(cb_c);
+
+  // D -> A -> E
+  AdvanceAndCheck(3, 300, 0, -700);
+  AdvanceAndCheck(0, 200);
+  AdvanceAndCheck(4, MAX_SLICE_LENGTH);
+}
+
 namespace SharedSlotTest
 {
 static unsigned int s_counter = 0;
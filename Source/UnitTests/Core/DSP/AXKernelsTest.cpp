@@ -0,0 +1,201 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+#include "Core/HW/DSPHLE/UCodes/AXKernels.h"
+
+using namespace DSP::HLE;
+
+namespace
+{
+// Sample by sample versions of the kernels, as they were in AXVoice.h.
+
+s16 ReferenceScale(s16 sample, u16 volume)
+{
+  return static_cast<s16>(std::clamp((s32(sample) * volume) >> 15, -32767, 32767));
+}
+
+void ReferenceResample(const std::vector<s16>& input, s16* output, u32 count, s16* last_samples,
+                       u32 curr_pos, u32 ratio, const s16* coeffs)
+{
+  u32 read_samples_count = 0;
+  s16 temp[4];
+  u32 idx = 0;
+
+  for (u32 i = 0; i < 4; ++i)
+    temp[idx++ & 3] = last_samples[i];
+
+  for (u32 i = 0; i < count; ++i)
+  {
+    curr_pos += ratio;
+    while (curr_pos >= 0x10000)
+    {
+      temp[idx++ & 3] = input[read_samples_count++];
+      curr_pos -= 0x10000;
+    }
+
+    if (coeffs)
+    {
+      const s16* c = &coeffs[((curr_pos & 0xFFFF) >> 9) << 2];
+      s64 t0 = temp[idx++ & 3];
+      s64 t1 = temp[idx++ & 3];
+      s64 t2 = temp[idx++ & 3];
+      s64 t3 = temp[idx++ & 3];
+      output[i] =
+          MathUtil::SaturatingCast<s16>((t0 * c[0] + t1 * c[1] + t2 * c[2] + t3 * c[3]) >> 15);
+    }
+    else
+    {
+      const u16 curr_frac = curr_pos & 0xFFFF;
+      const u16 inv_curr_frac = -curr_frac;
+      if (curr_frac)
+      {
+        const s32 s0 = temp[idx++ & 3];
+        const s32 s1 = temp[idx++ & 3];
+        output[i] = static_cast<s16>(((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16);
+        idx += 2;
+      }
+      else
+      {
+        output[i] = temp[idx++ & 3];
+        idx += 3;
+      }
+    }
+  }
+
+  for (u32 i = 0; i < 4; ++i)
+    last_samples[3 - i] = temp[--idx & 3];
+}
+
+std::vector<s16> RandomSamples(std::mt19937& rng, size_t count)
+{
+  std::uniform_int_distribution<int> dist(-32768, 32767);
+  std::vector<s16> samples(count);
+  for (s16& sample : samples)
+  {
+    // Include plenty of extreme values, which are the ones likely to overflow.
+    const int value = dist(rng);
+    sample = static_cast<s16>(value % 3 == 0 ? (value < 0 ? -32768 : 32767) : value);
+  }
+  return samples;
+}
+
+void CheckResample(std::mt19937& rng, u32 count, u32 curr_pos, u32 ratio, const s16* coeffs)
+{
+  const u64 input_count = AXKernels::GetResampleInputCount(count, curr_pos, ratio);
+  const std::vector<s16> input = RandomSamples(rng, input_count + 4);
+
+  std::array<s16, 4> reference_last;
+  std::copy_n(input.begin(), 4, reference_last.begin());
+  std::vector<s16> reference(count);
+  ReferenceResample(std::vector<s16>(input.begin() + 4, input.end()), reference.data(), count,
+                    reference_last.data(), curr_pos, ratio, coeffs);
+
+  std::vector<s16> output(count);
+  if (coeffs)
+    AXKernels::ResamplePolyphase(input.data(), output.data(), count, curr_pos, ratio, coeffs);
+  else
+    AXKernels::ResampleLinear(input.data(), output.data(), count, curr_pos, ratio);
+
+  EXPECT_EQ(output, reference) << "count " << count << " pos " << curr_pos << " ratio " << ratio;
+  EXPECT_TRUE(std::equal(reference_last.begin(), reference_last.end(),
+                         input.begin() + input_count));
+}
+}  // namespace
+
+TEST(AXKernels, ApplyVolumeRamp)
+{
+  std::mt19937 rng(1234);
+  for (u32 count : {0u, 1u, 7u, 32u, 96u, 101u})
+  {
+    for (u32 volume : {0x0000u, 0x7fffu, 0x8000u, 0xffffu, 0x1234u})
+    {
+      for (u32 delta : {0x0000u, 0x0001u, 0xfff0u, 0x0400u})
+      {
+        std::vector<s16> samples = RandomSamples(rng, count);
+        std::vector<s16> reference = samples;
+        u16 reference_volume = static_cast<u16>(volume);
+        for (s16& sample : reference)
+        {
+          sample = ReferenceScale(sample, reference_volume);
+          reference_volume += static_cast<u16>(delta);
+        }
+
+        const u16 result = AXKernels::ApplyVolumeRamp(samples.data(), count, u16(volume),
+                                                      u16(delta));
+        EXPECT_EQ(samples, reference);
+        EXPECT_EQ(result, reference_volume);
+      }
+    }
+  }
+}
+
+TEST(AXKernels, MixAdd)
+{
+  std::mt19937 rng(5678);
+  for (u32 count : {1u, 6u, 18u, 32u, 96u})
+  {
+    for (u32 volume : {0x0000u, 0x7fffu, 0x8000u, 0xffffu, 0x4321u})
+    {
+      for (u32 delta : {0x0000u, 0x0003u, 0xff00u})
+      {
+        const std::vector<s16> input = RandomSamples(rng, count);
+        std::vector<int> out(count);
+        for (int& value : out)
+          value = static_cast<int>(rng() % 200000) - 100000;
+
+        std::vector<int> reference = out;
+        u16 reference_volume = static_cast<u16>(volume);
+        s16 reference_last = 0;
+        for (u32 i = 0; i < count; ++i)
+        {
+          reference_last = ReferenceScale(input[i], reference_volume);
+          reference[i] += reference_last;
+          reference_volume += static_cast<u16>(delta);
+        }
+
+        s16 last = 0;
+        const u16 result =
+            AXKernels::MixAdd(out.data(), input.data(), count, u16(volume), u16(delta), &last);
+        EXPECT_EQ(out, reference);
+        EXPECT_EQ(result, reference_volume);
+        EXPECT_EQ(last, reference_last);
+      }
+    }
+  }
+}
+
+TEST(AXKernels, ResampleLinear)
+{
+  std::mt19937 rng(42);
+  for (u32 count : {1u, 18u, 32u, 96u})
+  {
+    for (u32 ratio : {0x10000u, 0x8000u, 0x55555u, 0x0123u, 0x1f3a7u, 0x40000u})
+    {
+      for (u32 curr_pos : {0x0000u, 0x8000u, 0xffffu})
+        CheckResample(rng, count, curr_pos, ratio, nullptr);
+    }
+  }
+}
+
+TEST(AXKernels, ResamplePolyphase)
+{
+  std::mt19937 rng(4242);
+  const std::vector<s16> coeffs = RandomSamples(rng, 0x200);
+  for (u32 count : {1u, 18u, 32u, 96u})
+  {
+    for (u32 ratio : {0x10000u, 0x8000u, 0x55555u, 0x0123u, 0x1f3a7u, 0x40000u})
+    {
+      for (u32 curr_pos : {0x0000u, 0x8000u, 0xffffu})
+        CheckResample(rng, count, curr_pos, ratio, coeffs.data());
+    }
+  }
+}
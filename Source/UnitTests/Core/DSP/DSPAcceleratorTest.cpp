@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <random>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -33,6 +35,73 @@ protected:
   bool m_accov_raised = false;
 };
 
+// Accelerator backed by random ARAM contents, which loops back to the start like looping AX
+// voices do.
+class LoopingAccelerator : public DSP::Accelerator
+{
+public:
+  explicit LoopingAccelerator(const std::vector<u8>& memory) : m_memory(memory) {}
+
+protected:
+  void OnEndException() override
+  {
+    SetPredScale(m_memory[0]);
+    SetYn2(GetYn2());
+  }
+  u8 ReadMemory(u32 address) override { return m_memory[address % m_memory.size()]; }
+  void WriteMemory(u32 address, u8 value) override {}
+
+private:
+  const std::vector<u8>& m_memory;
+};
+
+TEST(DSPAccelerator, ReadSamplesMatchesRead)
+{
+  std::mt19937 rng(1234);
+  std::vector<u8> memory(0x100);
+  for (u8& byte : memory)
+    byte = static_cast<u8>(rng());
+  std::array<s16, 16> coefs;
+  for (s16& coef : coefs)
+    coef = static_cast<s16>(rng());
+
+  for (u32 end_address : {0x30u, 0x31u, 0x5au, 0x1ffu})
+  {
+    for (u32 current_address : {0x02u, 0x07u, 0x0fu, 0x1eu})
+    {
+      LoopingAccelerator reference(memory);
+      LoopingAccelerator accelerator(memory);
+      for (DSP::Accelerator* acc : {static_cast<DSP::Accelerator*>(&reference),
+                                    static_cast<DSP::Accelerator*>(&accelerator)})
+      {
+        acc->SetSampleFormat(0x00);
+        acc->SetStartAddress(0x02);
+        acc->SetEndAddress(end_address);
+        acc->SetCurrentAddress(current_address);
+        acc->SetPredScale(memory[0]);
+        acc->SetYn1(0x1234);
+        acc->SetYn2(-0x4321);
+      }
+
+      for (u32 count : {1u, 5u, 14u, 32u, 96u})
+      {
+        std::vector<s16> expected(count);
+        for (s16& sample : expected)
+          sample = static_cast<s16>(reference.Read(coefs.data()));
+
+        std::vector<s16> samples(count);
+        accelerator.ReadSamples(samples.data(), count, coefs.data());
+
+        EXPECT_EQ(samples, expected);
+        EXPECT_EQ(accelerator.GetCurrentAddress(), reference.GetCurrentAddress());
+        EXPECT_EQ(accelerator.GetYn1(), reference.GetYn1());
+        EXPECT_EQ(accelerator.GetYn2(), reference.GetYn2());
+        EXPECT_EQ(accelerator.GetPredScale(), reference.GetPredScale());
+      }
+    }
+  }
+}
+
 TEST(DSPAccelerator, Initialization)
 {
   TestAccelerator accelerator;
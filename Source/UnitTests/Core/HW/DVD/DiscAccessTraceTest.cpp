@@ -0,0 +1,95 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Core/HW/DVD/DiscAccessTrace.h"
+
+using DVDThread::DiscAccessTrace;
+
+namespace
+{
+constexpr u64 PARTITION = 0x50000;
+
+class DiscAccessTraceTest : public testing::Test
+{
+protected:
+  DiscAccessTraceTest()
+      : m_directory(File::CreateTempDir()), m_path(m_directory + "/traces/game.trace")
+  {
+  }
+  ~DiscAccessTraceTest() override { File::DeleteDirRecursively(m_directory); }
+
+  // Records a session which reads a header, a file in small pieces, and then two other files
+  void RecordAndReload(DiscAccessTrace& trace)
+  {
+    trace.Record(PARTITION, 0x1000, 0x20);
+    for (u64 offset = 0x100000; offset < 0x108000; offset += 0x2000)
+      trace.Record(PARTITION, offset, 0x2000);
+    trace.Record(PARTITION, 0x400000, 0x8000);
+    trace.Record(PARTITION, 0x200000, 0x4000);
+    trace.Save(m_path);
+    trace.Load(m_path);
+  }
+
+  std::string m_directory;
+  std::string m_path;
+};
+}  // namespace
+
+TEST_F(DiscAccessTraceTest, MergesSequentialReads)
+{
+  DiscAccessTrace trace;
+  trace.Record(PARTITION, 0x1000, 0x20);
+  trace.Record(PARTITION, 0x1020, 0x20);
+  trace.Record(PARTITION + 1, 0x1040, 0x20);
+  trace.Record(PARTITION + 1, 0x1000, 0x20);
+
+  const std::vector<DiscAccessTrace::Entry>& recorded = trace.GetRecorded();
+  ASSERT_EQ(3u, recorded.size());
+  EXPECT_EQ(0x1000u, recorded[0].offset);
+  EXPECT_EQ(0x40u, recorded[0].length);
+  EXPECT_EQ(PARTITION + 1, recorded[1].partition);
+}
+
+TEST_F(DiscAccessTraceTest, PredictsFromLoadedTrace)
+{
+  DiscAccessTrace trace;
+  RecordAndReload(trace);
+
+  // The first read predicts what came after it, within the size limit
+  std::vector<DiscAccessTrace::Entry> prediction = trace.Predict(PARTITION, 0x1000, 0xA000);
+  ASSERT_EQ(2u, prediction.size());
+  EXPECT_EQ(0x100000u, prediction[0].offset);
+  EXPECT_EQ(0x8000u, prediction[0].length);
+  EXPECT_EQ(0x400000u, prediction[1].offset);
+  EXPECT_EQ(0x2000u, prediction[1].length);
+
+  // Reads in the middle of a merged entry are recognized, and don't predict anything twice
+  prediction = trace.Predict(PARTITION, 0x104000, 0x10000);
+  ASSERT_EQ(1u, prediction.size());
+  EXPECT_EQ(0x200000u, prediction[0].offset);
+
+  // Jumping back starts over
+  prediction = trace.Predict(PARTITION, 0x1000, 0x20000);
+  EXPECT_EQ(3u, prediction.size());
+
+  EXPECT_TRUE(trace.Predict(PARTITION, 0x900000, 0x10000).empty());
+}
+
+TEST_F(DiscAccessTraceTest, KeepsLongerTrace)
+{
+  DiscAccessTrace trace;
+  RecordAndReload(trace);
+
+  // A shorter session doesn't replace what was loaded
+  trace.Record(PARTITION, 0x1000, 0x20);
+  trace.Save(m_path);
+  trace.Load(m_path);
+  EXPECT_EQ(1u, trace.Predict(PARTITION, 0x1000, 0x2000).size());
+}
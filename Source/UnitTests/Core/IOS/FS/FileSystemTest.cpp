@@ -249,6 +249,29 @@ TEST_F(FileSystemTest, RenameWithExistingTargetFile)
   EXPECT_EQ(metadata->size, TEST_DATA.size());
 }
 
+TEST_F(FileSystemTest, RenameDirectoryWithContents)
+{
+  ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/tmp/d", 0, modes), ResultCode::Success);
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/d/f", 0, modes), ResultCode::Success);
+  {
+    const Result<FileHandle> file = m_fs->OpenFile(Uid{0}, Gid{0}, "/tmp/d/f", Mode::Write);
+    ASSERT_TRUE(file.Succeeded());
+    ASSERT_TRUE(file->Write(std::vector<u8>(10).data(), 10).Succeeded());
+  }
+  ASSERT_TRUE(m_fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp/d").Succeeded());
+
+  EXPECT_EQ(m_fs->Rename(Uid{0}, Gid{0}, "/tmp/d", "/tmp/e"), ResultCode::Success);
+
+  EXPECT_EQ(m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/d/f").Error(), ResultCode::NotFound);
+  const Result<std::vector<std::string>> children = m_fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp/e");
+  ASSERT_TRUE(children.Succeeded());
+  EXPECT_EQ(*children, std::vector<std::string>{"f"});
+
+  const Result<Metadata> metadata = m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/e/f");
+  ASSERT_TRUE(metadata.Succeeded());
+  EXPECT_EQ(metadata->size, 10u);
+}
+
 TEST_F(FileSystemTest, GetDirectoryStats)
 {
   auto check_stats = [this](u32 clusters, u32 inodes) {
@@ -469,3 +492,47 @@ TEST_F(FileSystemTest, CreateFullPath)
   EXPECT_EQ(m_fs->CreateFullPath(Uid{0x1000}, Gid{1}, "/shared2/wc24/mbox/Readme.txt", 0, modes),
             ResultCode::Success);
 }
+
+TEST_F(FileSystemTest, TitleMetadataVersion)
+{
+  const auto expect_change = [this](bool expected_change, const auto& modify) {
+    const u64 version = m_fs->GetTitleMetadataVersion();
+    modify();
+    EXPECT_EQ(m_fs->GetTitleMetadataVersion() != version, expected_change);
+  };
+
+  expect_change(true, [&] {
+    ASSERT_EQ(m_fs->CreateFullPath(Uid{0}, Gid{0}, "/title/00010000/00000001/data/", 0, modes),
+              ResultCode::Success);
+  });
+  expect_change(true, [&] {
+    ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/title/00010000/00000001/content", 0, modes),
+              ResultCode::Success);
+  });
+
+  // Title data and other directories do not contain anything that ES caches.
+  expect_change(false, [&] {
+    const auto file =
+        m_fs->CreateAndOpenFile(Uid{0}, Gid{0}, "/title/00010000/00000001/data/save", modes);
+    ASSERT_TRUE(file);
+    ASSERT_TRUE(file->Write(std::vector<u8>(10).data(), 10).Succeeded());
+  });
+  expect_change(false, [&] {
+    ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/title.tmd", 0, modes), ResultCode::Success);
+  });
+
+  expect_change(true, [&] {
+    ASSERT_EQ(m_fs->Rename(Uid{0}, Gid{0}, "/tmp/title.tmd",
+                           "/title/00010000/00000001/content/title.tmd"),
+              ResultCode::Success);
+  });
+  expect_change(true, [&] {
+    const auto file = m_fs->OpenFile(Uid{0}, Gid{0}, "/title/00010000/00000001/content/title.tmd",
+                                     Mode::Write);
+    ASSERT_TRUE(file);
+    ASSERT_TRUE(file->Write(std::vector<u8>(10).data(), 10).Succeeded());
+  });
+  expect_change(true, [&] {
+    ASSERT_EQ(m_fs->Delete(Uid{0}, Gid{0}, "/title/00010000/00000001"), ResultCode::Success);
+  });
+}
@@ -0,0 +1,115 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Core/IOS/SDIO/SDCardCache.h"
+
+using IOS::HLE::SDCardCache;
+
+namespace
+{
+constexpr u64 BLOCK_SIZE = SDCardCache::BLOCK_SIZE;
+
+std::string MakeImage(size_t size)
+{
+  std::string image(size, '\0');
+  for (size_t i = 0; i < size; ++i)
+    image[i] = static_cast<char>((i * 131) ^ (i >> 9));
+  return image;
+}
+
+class SDCardCacheTest : public testing::Test
+{
+protected:
+  SDCardCacheTest()
+      : m_directory(File::CreateTempDir()), m_path(m_directory + "/sd.raw"),
+        m_image(MakeImage(20 * BLOCK_SIZE + 1000))
+  {
+    File::WriteStringToFile(m_path, m_image);
+  }
+  ~SDCardCacheTest() override { File::DeleteDirRecursively(m_directory); }
+
+  std::string ReadImage() const
+  {
+    std::string image;
+    File::ReadFileToString(m_path, image);
+    return image;
+  }
+
+  std::string m_directory;
+  std::string m_path;
+  std::string m_image;
+};
+}  // namespace
+
+TEST_F(SDCardCacheTest, ReadsMatchImage)
+{
+  SDCardCache cache;
+  ASSERT_TRUE(cache.Open(m_path));
+  EXPECT_EQ(cache.GetSize(), m_image.size());
+
+  // Sector sized reads in order, followed by reads at arbitrary offsets across blocks.
+  std::vector<u8> data(512);
+  for (u64 offset = 0; offset + data.size() <= m_image.size(); offset += data.size())
+  {
+    ASSERT_TRUE(cache.Read(offset, data.data(), data.size()));
+    ASSERT_EQ(std::string(data.begin(), data.end()), m_image.substr(offset, data.size()));
+  }
+  for (const u64 offset : {BLOCK_SIZE - 7, 13 * BLOCK_SIZE + 100, 3 * BLOCK_SIZE})
+  {
+    data.resize(2 * BLOCK_SIZE + 5);
+    ASSERT_TRUE(cache.Read(offset, data.data(), data.size()));
+    EXPECT_EQ(std::string(data.begin(), data.end()), m_image.substr(offset, data.size()));
+  }
+
+  EXPECT_FALSE(cache.Read(m_image.size() - 10, data.data(), 11));
+}
+
+TEST_F(SDCardCacheTest, WritesAreVisibleAndWrittenBackOnClose)
+{
+  SDCardCache cache;
+  ASSERT_TRUE(cache.Open(m_path));
+
+  const std::vector<u8> partial(300, 0xab);
+  const std::vector<u8> whole(BLOCK_SIZE, 0xcd);
+  const std::vector<u8> tail(1000, 0xef);
+  ASSERT_TRUE(cache.Write(BLOCK_SIZE - 100, partial.data(), partial.size()));
+  ASSERT_TRUE(cache.Write(5 * BLOCK_SIZE, whole.data(), whole.size()));
+  ASSERT_TRUE(cache.Write(20 * BLOCK_SIZE, tail.data(), tail.size()));
+  EXPECT_FALSE(cache.Write(m_image.size(), tail.data(), 1));
+
+  m_image.replace(BLOCK_SIZE - 100, partial.size(), partial.size(), '\xab');
+  m_image.replace(5 * BLOCK_SIZE, whole.size(), whole.size(), '\xcd');
+  m_image.replace(20 * BLOCK_SIZE, tail.size(), tail.size(), '\xef');
+
+  std::vector<u8> data(m_image.size());
+  ASSERT_TRUE(cache.Read(0, data.data(), data.size()));
+  EXPECT_EQ(std::string(data.begin(), data.end()), m_image);
+
+  cache.Close();
+  EXPECT_EQ(ReadImage(), m_image);
+}
+
+TEST_F(SDCardCacheTest, FlushesWhenTooMuchIsPending)
+{
+  m_image = MakeImage((SDCardCache::MAX_DIRTY_BLOCKS + 4) * BLOCK_SIZE);
+  File::WriteStringToFile(m_path, m_image);
+
+  SDCardCache cache;
+  ASSERT_TRUE(cache.Open(m_path));
+
+  const std::vector<u8> sector(512, 0x5a);
+  for (u64 i = 0; i <= SDCardCache::MAX_DIRTY_BLOCKS; ++i)
+  {
+    ASSERT_TRUE(cache.Write(i * BLOCK_SIZE, sector.data(), sector.size()));
+    m_image.replace(i * BLOCK_SIZE, sector.size(), sector.size(), '\x5a');
+  }
+
+  EXPECT_EQ(ReadImage(), m_image);
+}
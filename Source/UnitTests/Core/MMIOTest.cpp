@@ -139,3 +139,27 @@ TEST_F(MappingTest, ReadWriteComplex)
   EXPECT_TRUE(read_called);
   EXPECT_TRUE(write_called);
 }
+
+TEST_F(MappingTest, ReadWriteFunction)
+{
+  u16 target = 0x1234;
+
+  m_mapping->Register(0x0C001234,
+                      MMIO::FunctionRead<u16>(
+                          [](Core::System&, void* context, u32 addr) -> u16 {
+                            EXPECT_EQ(0x0C001234u, addr);
+                            return *static_cast<u16*>(context) + 1;
+                          },
+                          &target),
+                      MMIO::FunctionWrite<u16>(
+                          [](Core::System&, void* context, u32 addr, u16 val) {
+                            EXPECT_EQ(0x0C001234u, addr);
+                            *static_cast<u16*>(context) = val - 1;
+                          },
+                          &target));
+
+  EXPECT_EQ(0x1235, m_mapping->Read<u16>(0x0C001234));
+  m_mapping->Write(0x0C001234, u16(0x5678));
+  EXPECT_EQ(0x5677, target);
+  EXPECT_EQ(0x5678, m_mapping->Read<u16>(0x0C001234));
+}
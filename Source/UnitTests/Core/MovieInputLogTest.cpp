@@ -0,0 +1,130 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Core/Movie.h"
+#include "Core/MovieInputLog.h"
+
+using Movie::InputLog;
+
+namespace
+{
+std::vector<u8> MakeInput(size_t size, u8 seed)
+{
+  std::vector<u8> input(size);
+  for (size_t i = 0; i < size; ++i)
+    input[i] = static_cast<u8>((i * 131) ^ (i >> 7) ^ seed);
+  return input;
+}
+
+std::vector<u8> ReadAll(InputLog& log)
+{
+  std::vector<u8> data(log.GetSize());
+  EXPECT_TRUE(log.Read(0, data.data(), data.size()));
+  return data;
+}
+
+class MovieInputLogTest : public testing::Test
+{
+protected:
+  MovieInputLogTest() : m_directory(File::CreateTempDir())
+  {
+    m_header.filetype = {'D', 'T', 'M', 0x1B};
+  }
+  ~MovieInputLogTest() override { File::DeleteDirRecursively(m_directory); }
+
+  std::string m_directory;
+  Movie::DTMHeader m_header{};
+};
+}  // namespace
+
+TEST_F(MovieInputLogTest, ReadsAcrossBlocks)
+{
+  const std::vector<u8> input = MakeInput(3 * InputLog::BLOCK_SIZE + 100, 0);
+  InputLog log;
+  for (size_t i = 0; i < input.size(); i += 7)
+    log.Append(input.data() + i, std::min<size_t>(7, input.size() - i));
+
+  EXPECT_EQ(log.GetSize(), input.size());
+  EXPECT_EQ(ReadAll(log), input);
+
+  u8 byte;
+  EXPECT_FALSE(log.Read(input.size(), &byte, 1));
+}
+
+TEST_F(MovieInputLogTest, TruncateKeepsEarlierInput)
+{
+  std::vector<u8> input = MakeInput(2 * InputLog::BLOCK_SIZE + 10, 1);
+  InputLog log;
+  log.Append(input.data(), input.size());
+
+  const u32 generation = log.GetGeneration();
+  log.Truncate(InputLog::BLOCK_SIZE + 5);
+  EXPECT_NE(log.GetGeneration(), generation);
+
+  input.resize(InputLog::BLOCK_SIZE + 5);
+  const std::vector<u8> more = MakeInput(InputLog::BLOCK_SIZE, 2);
+  log.Append(more.data(), more.size());
+  input.insert(input.end(), more.begin(), more.end());
+  EXPECT_EQ(ReadAll(log), input);
+}
+
+TEST_F(MovieInputLogTest, SavesAndStreamsVersion2)
+{
+  const std::string path = m_directory + "/movie.dtm";
+  std::vector<u8> input = MakeInput(5 * InputLog::BLOCK_SIZE / 2, 3);
+
+  InputLog log;
+  log.Append(input.data(), input.size());
+  ASSERT_TRUE(log.Save(path, m_header, 2, true));
+  const u64 first_size = File::GetSize(path);
+  EXPECT_LT(first_size, input.size());
+
+  // Saving again to the same file only appends the new input.
+  const std::vector<u8> more = MakeInput(100, 4);
+  log.Append(more.data(), more.size());
+  input.insert(input.end(), more.begin(), more.end());
+  ASSERT_TRUE(log.Save(path, m_header, 2, true));
+
+  InputLog loaded;
+  ASSERT_TRUE(loaded.Load(path, 2));
+  EXPECT_EQ(ReadAll(loaded), input);
+
+  // Overwriting the file that a log streams from keeps the log intact.
+  loaded.Truncate(1000);
+  ASSERT_TRUE(loaded.Save(path, m_header, 2, true));
+  input.resize(1000);
+  EXPECT_EQ(ReadAll(loaded), input);
+
+  InputLog reloaded;
+  ASSERT_TRUE(reloaded.Load(path, 2));
+  EXPECT_EQ(ReadAll(reloaded), input);
+}
+
+TEST_F(MovieInputLogTest, ConvertsVersion1)
+{
+  const std::string path = m_directory + "/movie.dtm";
+  const std::vector<u8> input = MakeInput(InputLog::BLOCK_SIZE + 3, 5);
+
+  InputLog log;
+  log.Append(input.data(), input.size());
+  m_header.filetype[3] = 0x1A;
+  ASSERT_TRUE(log.Save(path, m_header, 1, false));
+  EXPECT_EQ(File::GetSize(path), sizeof(Movie::DTMHeader) + input.size());
+
+  InputLog loaded;
+  ASSERT_TRUE(loaded.Load(path, 1));
+  EXPECT_EQ(ReadAll(loaded), input);
+
+  m_header.filetype[3] = 0x1B;
+  ASSERT_TRUE(loaded.Save(path, m_header, 2, false));
+  InputLog converted;
+  ASSERT_TRUE(converted.Load(path, 2));
+  EXPECT_EQ(ReadAll(converted), input);
+}
@@ -0,0 +1,52 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Core/NetPlayPadBuffer.h"
+
+using NetPlay::LatencyEstimator;
+using NetPlay::PadBufferController;
+
+TEST(LatencyEstimator, TracksJitter)
+{
+  LatencyEstimator steady;
+  LatencyEstimator jittery;
+  for (int i = 0; i < 50; ++i)
+  {
+    steady.AddSample(60);
+    jittery.AddSample(i % 2 ? 30 : 90);
+  }
+
+  EXPECT_NEAR(steady.GetSmoothedRTT(), 60, 1);
+  EXPECT_LT(steady.GetRTTVariation(), 1);
+  EXPECT_NEAR(jittery.GetSmoothedRTT(), 60, 5);
+  EXPECT_GT(jittery.GetRTTBound(), steady.GetRTTBound() + 50);
+}
+
+TEST(PadBufferController, BufferSizeIsBounded)
+{
+  EXPECT_EQ(PadBufferController::GetBufferSizeForRTT(0), PadBufferController::MIN_BUFFER_SIZE);
+  EXPECT_EQ(PadBufferController::GetBufferSizeForRTT(100), 7u);
+  EXPECT_EQ(PadBufferController::GetBufferSizeForRTT(10000), PadBufferController::MAX_BUFFER_SIZE);
+}
+
+TEST(PadBufferController, GrowsImmediatelyAndShrinksSlowly)
+{
+  PadBufferController controller;
+  EXPECT_EQ(controller.Update(100, 3), std::optional<u32>(7));
+  EXPECT_FALSE(controller.Update(100, 7).has_value());
+
+  for (u32 i = 1; i < PadBufferController::SHRINK_DELAY; ++i)
+    EXPECT_FALSE(controller.Update(20, 7).has_value());
+  EXPECT_EQ(controller.Update(20, 7), std::optional<u32>(6));
+
+  // A spike in between restarts the wait.
+  for (u32 i = 1; i < PadBufferController::SHRINK_DELAY; ++i)
+    EXPECT_FALSE(controller.Update(20, 6).has_value());
+  EXPECT_FALSE(controller.Update(80, 6).has_value());
+  EXPECT_FALSE(controller.Update(20, 6).has_value());
+}
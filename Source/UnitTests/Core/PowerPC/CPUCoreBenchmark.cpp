@@ -0,0 +1,381 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/CPU.h"
+#include "Core/HW/Memmap.h"
+#include "Core/MemTools.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+// Runs a few representative PPC instruction sequences on every CPU core available on the host,
+// and reports how many guest instructions per second each core manages. The kernels are also checked
+// to leave the same registers and memory behind on every core.
+
+namespace
+{
+constexpr u32 CODE_ADDRESS = 0x00003000;
+constexpr u32 SOURCE_ADDRESS = 0x00100000;
+constexpr u32 DESTINATION_ADDRESS = 0x00200000;
+// The load/store kernel wraps around in windows of this size, see the rlwinm in it.
+constexpr u32 DATA_WINDOW_SIZE = 0x40000;
+constexpr u32 ITERATIONS = 2000000;
+
+// How often the kernel is checked for having reached its final "b ." instruction.
+constexpr s64 HALT_CHECK_INTERVAL = 10000;
+// Stops a kernel which never halts after this many checks, roughly a minute of emulated time.
+constexpr u32 MAX_HALT_CHECKS = 3000000;
+
+// Instruction encodings.
+constexpr u32 DForm(u32 opcd, u32 d, u32 a, s32 imm)
+{
+  return opcd << 26 | d << 21 | a << 16 | (static_cast<u32>(imm) & 0xFFFF);
+}
+constexpr u32 XForm(u32 opcd, u32 d, u32 a, u32 b, u32 xo)
+{
+  return opcd << 26 | d << 21 | a << 16 | b << 11 | xo << 1;
+}
+constexpr u32 ADDI(u32 d, u32 a, s32 imm)
+{
+  return DForm(14, d, a, imm);
+}
+constexpr u32 ANDI_RC(u32 a, u32 s, u32 imm)
+{
+  return DForm(28, s, a, imm);
+}
+constexpr u32 LWZ(u32 d, s32 offset, u32 a)
+{
+  return DForm(32, d, a, offset);
+}
+constexpr u32 STW(u32 s, s32 offset, u32 a)
+{
+  return DForm(36, s, a, offset);
+}
+constexpr u32 ADD(u32 d, u32 a, u32 b)
+{
+  return XForm(31, d, a, b, 266);
+}
+constexpr u32 SUBF(u32 d, u32 a, u32 b)
+{
+  return XForm(31, d, a, b, 40);
+}
+constexpr u32 MULLW(u32 d, u32 a, u32 b)
+{
+  return XForm(31, d, a, b, 235);
+}
+constexpr u32 XOR(u32 a, u32 s, u32 b)
+{
+  return XForm(31, s, a, b, 316);
+}
+constexpr u32 RLWINM(u32 a, u32 s, u32 sh, u32 mb, u32 me)
+{
+  return 21 << 26 | s << 21 | a << 16 | sh << 11 | mb << 6 | me << 1;
+}
+constexpr u32 MTCTR(u32 s)
+{
+  return XForm(31, s, 9, 0, 467);
+}
+constexpr u32 B(s32 offset)
+{
+  return 18 << 26 | (static_cast<u32>(offset) & 0x03FFFFFC);
+}
+constexpr u32 BL(s32 offset)
+{
+  return B(offset) | 1;
+}
+constexpr u32 BC(u32 bo, u32 bi, s32 offset)
+{
+  return 16 << 26 | bo << 21 | bi << 16 | (static_cast<u32>(offset) & 0xFFFC);
+}
+constexpr u32 BDNZ(s32 offset)
+{
+  return BC(16, 0, offset);
+}
+constexpr u32 BEQ(s32 offset)
+{
+  return BC(12, 2, offset);
+}
+constexpr u32 BLR()
+{
+  return 0x4E800020;
+}
+constexpr u32 PS_ADD(u32 d, u32 a, u32 b)
+{
+  return 4 << 26 | d << 21 | a << 16 | b << 11 | 21 << 1;
+}
+constexpr u32 PS_MUL(u32 d, u32 a, u32 c)
+{
+  return 4 << 26 | d << 21 | a << 16 | c << 6 | 25 << 1;
+}
+constexpr u32 PS_MADD(u32 d, u32 a, u32 c, u32 b)
+{
+  return 4 << 26 | d << 21 | a << 16 | b << 11 | c << 6 | 29 << 1;
+}
+
+// Every kernel loops r3 times and ends in a "b ." at halt_index. As inputs, r5 is 12345, r10 and
+// r11 point to the source and destination data, and f2, f3 and f5 hold small paired values.
+struct Kernel
+{
+  const char* name;
+  std::vector<u32> code;
+  size_t halt_index;
+  u32 instructions_per_iteration;
+};
+
+const std::array<Kernel, 4> KERNELS = {{
+    {"Integer ALU",
+     {
+         MTCTR(3),
+         ADD(4, 4, 5),
+         XOR(6, 6, 4),
+         MULLW(7, 4, 6),
+         RLWINM(8, 7, 3, 0, 31),
+         SUBF(5, 8, 5),
+         ADDI(9, 9, 1),
+         BDNZ(-24),
+         B(0),
+     },
+     8, 7},
+    {"Paired singles",
+     {
+         MTCTR(3),
+         PS_MADD(1, 2, 3, 1),
+         PS_MADD(4, 5, 3, 4),
+         PS_MUL(6, 1, 4),
+         PS_ADD(7, 7, 6),
+         PS_MADD(8, 7, 3, 2),
+         BDNZ(-20),
+         B(0),
+     },
+     7, 6},
+    {"Load/store stream",
+     {
+         MTCTR(3),
+         ADD(14, 10, 12),
+         ADD(15, 11, 12),
+         LWZ(4, 0, 14),
+         LWZ(5, 4, 14),
+         ADD(6, 4, 5),
+         STW(6, 0, 15),
+         STW(4, 4, 15),
+         ADDI(12, 12, 8),
+         RLWINM(12, 12, 0, 14, 28),
+         BDNZ(-36),
+         B(0),
+     },
+     11, 10},
+    {"Branches",
+     {
+         MTCTR(3),
+         ANDI_RC(4, 9, 1),
+         BEQ(12),
+         ADDI(5, 5, 1),
+         B(12),
+         ADDI(6, 6, 1),
+         ADDI(7, 7, 1),
+         BL(16),
+         ADDI(9, 9, 1),
+         BDNZ(-32),
+         B(0),
+         ADD(8, 8, 9),
+         BLR(),
+     },
+     10, 9},
+}};
+
+struct CoreInfo
+{
+  const char* name;
+  PowerPC::CPUCore core;
+};
+
+const std::vector<CoreInfo> CORES = {
+    {"Interpreter", PowerPC::CPUCore::Interpreter},
+    {"Cached Interpreter", PowerPC::CPUCore::CachedInterpreter},
+#if _M_X86_64
+    {"JIT64", PowerPC::CPUCore::JIT64},
+#elif _M_ARM_64
+    {"JITARM64", PowerPC::CPUCore::JITARM64},
+#endif
+};
+
+struct RunResult
+{
+  bool halted = false;
+  double mips = 0;
+  std::array<u32, 32> gpr{};
+  std::vector<u8> destination;
+};
+
+CoreTiming::EventType* s_halt_check_event = nullptr;
+u32 s_halt_address = 0;
+u32 s_halt_checks = 0;
+
+void CheckForHalt(Core::System& system, u64, s64 cycles_late)
+{
+  if (PowerPC::ppcState.pc == s_halt_address || ++s_halt_checks >= MAX_HALT_CHECKS)
+  {
+    CPU::Break();
+    return;
+  }
+
+  system.GetCoreTiming().ScheduleEvent(HALT_CHECK_INTERVAL - cycles_late, s_halt_check_event);
+}
+
+RunResult RunKernel(const Kernel& kernel)
+{
+  auto& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
+
+  memory.Clear();
+  for (size_t i = 0; i < kernel.code.size(); ++i)
+    memory.Write_U32(kernel.code[i], CODE_ADDRESS + static_cast<u32>(i * 4));
+  u32 seed = 1;
+  for (u32 i = 0; i < DATA_WINDOW_SIZE; i += 4)
+  {
+    seed = seed * 1664525 + 1013904223;
+    memory.Write_U32(seed, SOURCE_ADDRESS + i);
+  }
+  JitInterface::ClearCache();
+
+  PowerPC::PowerPCState& ppc_state = PowerPC::ppcState;
+  std::fill(std::begin(ppc_state.gpr), std::end(ppc_state.gpr), 0);
+  for (PowerPC::PairedSingle& ps : ppc_state.ps)
+    ps.Fill(0.0);
+  ppc_state.gpr[3] = ITERATIONS;
+  ppc_state.gpr[5] = 12345;
+  ppc_state.gpr[10] = SOURCE_ADDRESS;
+  ppc_state.gpr[11] = DESTINATION_ADDRESS;
+  ppc_state.ps[2].SetBoth(1.0, 2.0);
+  ppc_state.ps[3].SetBoth(0.5, 0.25);
+  ppc_state.ps[5].SetBoth(3.0, 4.0);
+  ppc_state.msr.Hex = 0;
+  ppc_state.msr.FP = 1;
+  HID2(ppc_state).PSE = 1;
+  HID2(ppc_state).LSQE = 1;
+  ppc_state.pc = CODE_ADDRESS;
+  ppc_state.npc = CODE_ADDRESS;
+  PowerPC::RoundingModeUpdated();
+
+  s_halt_address = CODE_ADDRESS + static_cast<u32>(kernel.halt_index * 4);
+  s_halt_checks = 0;
+  system.GetCoreTiming().ScheduleEvent(HALT_CHECK_INTERVAL, s_halt_check_event);
+
+  const auto start = std::chrono::steady_clock::now();
+  CPU::EnableStepping(false);
+  PowerPC::RunLoop();
+  const auto end = std::chrono::steady_clock::now();
+
+  RunResult result;
+  result.halted = ppc_state.pc == s_halt_address;
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  result.mips = static_cast<double>(ITERATIONS) * kernel.instructions_per_iteration / seconds / 1e6;
+  std::copy(std::begin(ppc_state.gpr), std::end(ppc_state.gpr), result.gpr.begin());
+  result.destination.resize(DATA_WINDOW_SIZE);
+  memory.CopyFromEmu(result.destination.data(), DESTINATION_ADDRESS, DATA_WINDOW_SIZE);
+  return result;
+}
+
+class ScopeInit final
+{
+public:
+  ScopeInit() : m_profile_path(File::CreateTempDir())
+  {
+    if (!UserDirectoryExists())
+      return;
+
+    Core::DeclareAsCPUThread();
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+    // Run everything as fast as possible, and don't wait for the GPU thread when idle skipping.
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    Config::SetCurrent(Config::MAIN_SYNC_ON_SKIP_IDLE, false);
+
+    Core::System::GetInstance().GetMemory().Init();
+    EMM::InstallExceptionHandler();
+  }
+  ~ScopeInit()
+  {
+    if (!UserDirectoryExists())
+      return;
+
+    EMM::UninstallExceptionHandler();
+    Core::System::GetInstance().GetMemory().Shutdown();
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+  bool UserDirectoryExists() const { return !m_profile_path.empty(); }
+
+private:
+  std::string m_profile_path;
+};
+}  // namespace
+
+TEST(CPUCoreBenchmark, DISABLED_Kernels)
+{
+  ScopeInit guard;
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  // results[kernel][core]
+  std::vector<std::vector<RunResult>> results(KERNELS.size());
+  for (const CoreInfo& core : CORES)
+  {
+    // CoreTiming has to be reset along with the CPU core, which registers its own events.
+    auto& core_timing = Core::System::GetInstance().GetCoreTiming();
+    core_timing.Init();
+    s_halt_check_event = core_timing.RegisterEvent("CPUCoreBenchmarkHaltCheck", CheckForHalt);
+    CPU::Init(core.core);
+
+    for (size_t i = 0; i < KERNELS.size(); ++i)
+      results[i].push_back(RunKernel(KERNELS[i]));
+
+    CPU::Shutdown();
+    core_timing.Shutdown();
+  }
+
+  fmt::print("{:<20}", "guest MIPS");
+  for (const CoreInfo& core : CORES)
+    fmt::print("{:>20}", core.name);
+  fmt::print("\n");
+
+  for (size_t i = 0; i < KERNELS.size(); ++i)
+  {
+    fmt::print("{:<20}", KERNELS[i].name);
+    for (const RunResult& result : results[i])
+      fmt::print("{:>20.1f}", result.mips);
+    fmt::print("\n");
+
+    for (size_t j = 0; j < CORES.size(); ++j)
+    {
+      SCOPED_TRACE(fmt::format("{} on {}", KERNELS[i].name, CORES[j].name));
+      EXPECT_TRUE(results[i][j].halted);
+      // Floating point results aren't compared, since the cores differ in how exactly they round
+      // some paired single operations.
+      EXPECT_EQ(results[i][0].gpr, results[i][j].gpr);
+      EXPECT_TRUE(results[i][0].destination == results[i][j].destination);
+    }
+  }
+}
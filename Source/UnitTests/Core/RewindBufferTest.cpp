@@ -0,0 +1,119 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Core/RewindBuffer.h"
+
+using State::RewindBuffer;
+
+namespace
+{
+constexpr size_t PAGE_SIZE = State::StateDelta::PAGE_SIZE;
+
+std::vector<u8> MakeState(size_t size, u8 seed)
+{
+  std::vector<u8> state(size);
+  for (size_t i = 0; i < size; ++i)
+    state[i] = static_cast<u8>(i * 7 + seed + i / PAGE_SIZE);
+  return state;
+}
+}  // namespace
+
+TEST(RewindBuffer, PopReturnsStatesNewestFirst)
+{
+  RewindBuffer buffer(64 * PAGE_SIZE * 8);
+
+  std::vector<std::vector<u8>> states;
+  states.push_back(MakeState(16 * PAGE_SIZE, 0));
+  for (size_t i = 1; i < 6; ++i)
+  {
+    std::vector<u8> state = states.back();
+    state[i * PAGE_SIZE + 123] ^= 0xff;
+    state.back() += static_cast<u8>(i);
+    states.push_back(state);
+  }
+
+  for (const std::vector<u8>& state : states)
+    buffer.Push(state);
+  EXPECT_EQ(buffer.GetCount(), states.size());
+
+  std::vector<u8> popped;
+  for (auto it = states.rbegin(); it != states.rend(); ++it)
+  {
+    ASSERT_TRUE(buffer.Pop(&popped));
+    EXPECT_EQ(popped, *it);
+  }
+  EXPECT_FALSE(buffer.Pop(&popped));
+  EXPECT_EQ(buffer.GetCount(), 0u);
+  EXPECT_EQ(buffer.GetMemoryUsage(), 0u);
+}
+
+TEST(RewindBuffer, HandlesSectionsChangingSize)
+{
+  RewindBuffer buffer(64 * PAGE_SIZE * 8);
+
+  // A small header, followed by a variable size section, followed by a large unchanged section
+  // whose pages no longer line up with the previous state.
+  const std::vector<u8> header = MakeState(100, 1);
+  const std::vector<u8> tail = MakeState(32 * PAGE_SIZE + 17, 2);
+  const auto make = [&](size_t variable_size) {
+    std::vector<u8> state = header;
+    const std::vector<u8> variable = MakeState(variable_size, 3);
+    state.insert(state.end(), variable.begin(), variable.end());
+    state.insert(state.end(), tail.begin(), tail.end());
+    return state;
+  };
+
+  const std::vector<u8> a = make(500);
+  const std::vector<u8> b = make(2 * PAGE_SIZE + 3);
+  const std::vector<u8> c = make(10);
+  buffer.Push(a);
+  buffer.Push(b);
+  buffer.Push(c);
+
+  // Most of the tail should have been matched rather than stored as literals.
+  EXPECT_LT(buffer.GetMemoryUsage(), c.size() + 12 * PAGE_SIZE);
+
+  std::vector<u8> popped;
+  ASSERT_TRUE(buffer.Pop(&popped));
+  EXPECT_EQ(popped, c);
+  ASSERT_TRUE(buffer.Pop(&popped));
+  EXPECT_EQ(popped, b);
+  ASSERT_TRUE(buffer.Pop(&popped));
+  EXPECT_EQ(popped, a);
+}
+
+TEST(RewindBuffer, DropsOldestStatesWhenOverBudget)
+{
+  const size_t state_size = 8 * PAGE_SIZE;
+  RewindBuffer buffer(state_size + 4 * PAGE_SIZE);
+
+  std::vector<std::vector<u8>> states;
+  for (u8 i = 0; i < 10; ++i)
+  {
+    // Two pages change per state.
+    std::vector<u8> state = states.empty() ? MakeState(state_size, 0) : states.back();
+    state[(i % 4) * PAGE_SIZE] += 1;
+    state[(i % 4 + 4) * PAGE_SIZE] += 1;
+    states.push_back(state);
+    buffer.Push(state);
+    EXPECT_LE(buffer.GetMemoryUsage(), state_size + 4 * PAGE_SIZE);
+  }
+
+  EXPECT_GE(buffer.GetCount(), 1u);
+  EXPECT_LT(buffer.GetCount(), states.size());
+
+  std::vector<u8> popped;
+  const size_t count = buffer.GetCount();
+  for (size_t i = 0; i < count; ++i)
+  {
+    ASSERT_TRUE(buffer.Pop(&popped));
+    EXPECT_EQ(popped, states[states.size() - 1 - i]);
+  }
+  EXPECT_FALSE(buffer.Pop(&popped));
+}
@@ -0,0 +1,97 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Core/StateDelta.h"
+
+using State::StateDelta;
+
+namespace
+{
+constexpr size_t PAGE_SIZE = StateDelta::PAGE_SIZE;
+
+std::vector<u8> MakeState(size_t size, u8 seed)
+{
+  std::vector<u8> state(size);
+  for (size_t i = 0; i < size; ++i)
+    state[i] = static_cast<u8>(i * 7 + seed + i / PAGE_SIZE);
+  return state;
+}
+}  // namespace
+
+TEST(StateDelta, SerializedDeltaReconstructsTarget)
+{
+  const std::vector<u8> base = MakeState(16 * PAGE_SIZE + 5, 0);
+  std::vector<u8> target = base;
+  target[3 * PAGE_SIZE + 1] ^= 0xff;
+  target.insert(target.begin() + 100, 40, 0xaa);
+
+  const std::vector<u8> serialized = StateDelta::Create(base, target).Serialize();
+  // Only the pages before the insertion and the changed page should be stored.
+  EXPECT_LT(serialized.size(), 6 * PAGE_SIZE);
+
+  const std::optional<StateDelta> delta = StateDelta::Deserialize(serialized);
+  ASSERT_TRUE(delta);
+  EXPECT_EQ(delta->GetSize(), target.size());
+
+  std::vector<u8> applied;
+  ASSERT_TRUE(delta->Apply(base, &applied));
+  EXPECT_EQ(applied, target);
+}
+
+TEST(StateDelta, DeltaAgainstEmptyBaseIsFullState)
+{
+  const std::vector<u8> target = MakeState(5 * PAGE_SIZE + 3, 1);
+  const std::optional<StateDelta> delta =
+      StateDelta::Deserialize(StateDelta::Create({}, target).Serialize());
+  ASSERT_TRUE(delta);
+
+  std::vector<u8> applied;
+  ASSERT_TRUE(delta->Apply({}, &applied));
+  EXPECT_EQ(applied, target);
+}
+
+TEST(StateDelta, RejectsMismatchedBaseAndCorruptData)
+{
+  const std::vector<u8> base = MakeState(8 * PAGE_SIZE, 2);
+  std::vector<u8> target = base;
+  target[PAGE_SIZE] += 1;
+  const StateDelta delta = StateDelta::Create(base, target);
+
+  std::vector<u8> applied;
+  EXPECT_FALSE(delta.Apply(std::vector<u8>(PAGE_SIZE), &applied));
+  EXPECT_TRUE(applied.empty());
+
+  const std::vector<u8> serialized = delta.Serialize();
+  for (size_t size = 0; size < serialized.size(); size += 3)
+  {
+    const std::vector<u8> truncated(serialized.begin(), serialized.begin() + size);
+    EXPECT_FALSE(StateDelta::Deserialize(truncated));
+  }
+
+  std::vector<u8> bad_source = serialized;
+  bad_source[2 * sizeof(u64)] = 0x7f;
+  EXPECT_FALSE(StateDelta::Deserialize(bad_source));
+
+  // A state just over the maximum size, taken entirely from the base state.
+  const u64 huge_size = StateDelta::MAX_SIZE + 1;
+  const u64 run_count = 1;
+  const u8 source = 0;
+  const u32 page_count = static_cast<u32>(huge_size / PAGE_SIZE + 1);
+  const u64 literals_size = 0;
+  std::vector<u8> huge(sizeof(u64) * 3 + sizeof(u8) + sizeof(u32));
+  u8* out = huge.data();
+  std::memcpy(out, &huge_size, sizeof(u64));
+  std::memcpy(out += sizeof(u64), &run_count, sizeof(u64));
+  std::memcpy(out += sizeof(u64), &source, sizeof(u8));
+  std::memcpy(out += sizeof(u8), &page_count, sizeof(u32));
+  std::memcpy(out += sizeof(u32), &literals_size, sizeof(u64));
+  EXPECT_FALSE(StateDelta::Deserialize(huge));
+}
@@ -0,0 +1,133 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/BC7Encoder.h"
+
+namespace
+{
+// Decodes a mode 6 block, which is the only mode the encoder produces.
+std::array<std::array<u8, 4>, 16> DecodeMode6Block(const u8* block)
+{
+  u32 position = 0;
+  const auto read = [block, &position](u32 bit_count) {
+    u32 value = 0;
+    for (u32 i = 0; i < bit_count; i++, position++)
+      value |= ((block[position / 8] >> (position % 8)) & 1) << i;
+    return value;
+  };
+
+  EXPECT_EQ(1u << 6, read(7));
+
+  std::array<std::array<u32, 4>, 2> endpoints;
+  for (size_t c = 0; c < 4; c++)
+  {
+    endpoints[0][c] = read(7) << 1;
+    endpoints[1][c] = read(7) << 1;
+  }
+  for (auto& endpoint : endpoints)
+  {
+    const u32 p_bit = read(1);
+    for (u32& value : endpoint)
+      value |= p_bit;
+  }
+
+  static constexpr std::array<u32, 16> weights = {0,  4,  9,  13, 17, 21, 26, 30,
+                                                  34, 38, 43, 47, 51, 55, 60, 64};
+  std::array<std::array<u8, 4>, 16> pixels;
+  for (size_t i = 0; i < pixels.size(); i++)
+  {
+    const u32 weight = weights[read(i == 0 ? 3 : 4)];
+    for (size_t c = 0; c < 4; c++)
+      pixels[i][c] = ((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >> 6;
+  }
+  return pixels;
+}
+
+// Returns the largest difference of any channel between the image and its encoded version.
+int EncodeAndCompare(const std::vector<u8>& image, u32 width, u32 height)
+{
+  std::vector<u8> encoded(BC7Encoder::GetEncodedSize(width, height));
+  BC7Encoder::Encode(encoded.data(), image.data(), width, height, width);
+
+  int max_difference = 0;
+  const u32 blocks_wide = (width + 3) / 4;
+  for (u32 y = 0; y < height; y++)
+  {
+    for (u32 x = 0; x < width; x++)
+    {
+      const u8* block = &encoded[((y / 4) * blocks_wide + x / 4) * BC7Encoder::BYTES_PER_BLOCK];
+      const auto decoded = DecodeMode6Block(block)[(y % 4) * 4 + x % 4];
+      for (size_t c = 0; c < 4; c++)
+      {
+        const int difference = std::abs(decoded[c] - image[(y * width + x) * 4 + c]);
+        max_difference = std::max(max_difference, difference);
+      }
+    }
+  }
+  return max_difference;
+}
+}  // namespace
+
+TEST(BC7Encoder, SolidColor)
+{
+  constexpr u32 width = 8;
+  constexpr u32 height = 8;
+  std::vector<u8> image(width * height * 4);
+  for (size_t i = 0; i < image.size(); i += 4)
+  {
+    image[i + 0] = 200;
+    image[i + 1] = 13;
+    image[i + 2] = 77;
+    image[i + 3] = 255;
+  }
+
+  EXPECT_LE(EncodeAndCompare(image, width, height), 1);
+}
+
+TEST(BC7Encoder, Gradient)
+{
+  // Mode 6 can represent a linear gradient within a block almost exactly. The size isn't a multiple
+  // of the block size, to also cover partial blocks.
+  constexpr u32 width = 30;
+  constexpr u32 height = 18;
+  std::vector<u8> image(width * height * 4);
+  for (u32 y = 0; y < height; y++)
+  {
+    for (u32 x = 0; x < width; x++)
+    {
+      u8* pixel = &image[(y * width + x) * 4];
+      pixel[0] = static_cast<u8>((x + y) * 5);
+      pixel[1] = static_cast<u8>((x + y) * 2);
+      pixel[2] = static_cast<u8>(255 - (x + y) * 4);
+      pixel[3] = static_cast<u8>(x < 16 ? 0 : 255);
+    }
+  }
+
+  EXPECT_LE(EncodeAndCompare(image, width, height), 8);
+}
+
+TEST(BC7Encoder, KeepsOpaqueAlpha)
+{
+  constexpr u32 width = 16;
+  constexpr u32 height = 16;
+  std::mt19937 rng(1234);
+  std::vector<u8> image(width * height * 4);
+  for (size_t i = 0; i < image.size(); i++)
+    image[i] = i % 4 == 3 ? 255 : static_cast<u8>(rng());
+
+  std::vector<u8> encoded(BC7Encoder::GetEncodedSize(width, height));
+  BC7Encoder::Encode(encoded.data(), image.data(), width, height, width);
+  for (size_t i = 0; i < encoded.size(); i += BC7Encoder::BYTES_PER_BLOCK)
+  {
+    for (const auto& pixel : DecodeMode6Block(&encoded[i]))
+      EXPECT_EQ(255, pixel[3]);
+  }
+}
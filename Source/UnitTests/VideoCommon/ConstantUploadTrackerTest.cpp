@@ -0,0 +1,63 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/ConstantUploadTracker.h"
+
+namespace
+{
+// Deliberately not a multiple of the row size, so the last row is partial.
+struct TestConstants
+{
+  u32 values[18];
+};
+
+using Tracker = ConstantUploadTracker<TestConstants>;
+}  // namespace
+
+TEST(ConstantUploadTracker, FirstUpdateIsFull)
+{
+  Tracker tracker;
+  TestConstants constants{};
+  const Tracker::DirtyRange range = tracker.Update(constants);
+  EXPECT_EQ(0u, range.offset);
+  EXPECT_EQ(sizeof(TestConstants), range.size);
+
+  EXPECT_TRUE(tracker.Update(constants).IsEmpty());
+}
+
+TEST(ConstantUploadTracker, CoversChangedRows)
+{
+  Tracker tracker;
+  TestConstants constants{};
+  tracker.Update(constants);
+
+  constants.values[5] = 1;
+  Tracker::DirtyRange range = tracker.Update(constants);
+  EXPECT_EQ(16u, range.offset);
+  EXPECT_EQ(16u, range.size);
+  EXPECT_TRUE(tracker.Update(constants).IsEmpty());
+
+  // Unchanged rows in between are included, and a partial last row is clamped to the struct.
+  constants.values[1] = 2;
+  constants.values[17] = 3;
+  range = tracker.Update(constants);
+  EXPECT_EQ(0u, range.offset);
+  EXPECT_EQ(sizeof(TestConstants), range.size);
+
+  constants.values[16] = 4;
+  range = tracker.Update(constants);
+  EXPECT_EQ(64u, range.offset);
+  EXPECT_EQ(8u, range.size);
+}
+
+TEST(ConstantUploadTracker, Invalidate)
+{
+  Tracker tracker;
+  TestConstants constants{};
+  tracker.Update(constants);
+  tracker.Invalidate();
+  EXPECT_EQ(sizeof(TestConstants), tracker.Update(constants).size);
+}
@@ -0,0 +1,66 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/DisplayListCache.h"
+
+using DisplayListCache::CachedDisplayList;
+using DisplayListCache::CachedVertices;
+
+TEST(DisplayListCache, ListsAreCachedOnceCalledAgainUnchanged)
+{
+  DisplayListCache::Clear();
+  std::array<u8, 64> list{};
+  list[0] = 0x90;
+
+  EXPECT_EQ(DisplayListCache::Lookup(0x1000, list.data(), list.size()), nullptr);
+  CachedDisplayList* cached = DisplayListCache::Lookup(0x1000, list.data(), list.size());
+  ASSERT_NE(cached, nullptr);
+  EXPECT_EQ(DisplayListCache::Lookup(0x1000, list.data(), list.size()), cached);
+
+  // Changing the contents or the size of the list throws away what was cached for it.
+  list[10] = 0x42;
+  EXPECT_EQ(DisplayListCache::Lookup(0x1000, list.data(), list.size()), nullptr);
+  EXPECT_NE(DisplayListCache::Lookup(0x1000, list.data(), list.size()), nullptr);
+  EXPECT_EQ(DisplayListCache::Lookup(0x1000, list.data(), list.size() - 4), nullptr);
+
+  // Lists at other addresses are separate.
+  EXPECT_EQ(DisplayListCache::Lookup(0x2000, list.data(), list.size()), nullptr);
+  DisplayListCache::Clear();
+}
+
+TEST(DisplayListCache, VerticesAreFoundByOffset)
+{
+  CachedDisplayList list;
+  CachedVertices* first = list.GetVertices(3);
+  first->count = 1;
+  list.GetVertices(40)->count = 2;
+  list.GetVertices(20)->count = 3;
+
+  list.Rewind();
+  EXPECT_EQ(list.GetVertices(3)->count, 1);
+  EXPECT_EQ(list.GetVertices(20)->count, 3);
+  EXPECT_EQ(list.GetVertices(40)->count, 2);
+  EXPECT_EQ(list.GetVertices(20)->count, 3);
+  EXPECT_EQ(list.GetVertices(60)->count, 0);
+}
+
+TEST(DisplayListCache, IndexedVerticesAreNotCached)
+{
+  TVtxDesc desc;
+  desc.low.Position = VertexComponentFormat::Direct;
+  desc.high.Tex3Coord = VertexComponentFormat::Direct;
+  EXPECT_TRUE(CachedVertices::CanCache(desc, 3));
+  EXPECT_FALSE(CachedVertices::CanCache(desc, 2));
+
+  desc.high.Tex3Coord = VertexComponentFormat::Index16;
+  EXPECT_FALSE(CachedVertices::CanCache(desc, 3));
+  desc.high.Tex3Coord = VertexComponentFormat::Direct;
+  desc.low.Color1 = VertexComponentFormat::Index8;
+  EXPECT_FALSE(CachedVertices::CanCache(desc, 3));
+}
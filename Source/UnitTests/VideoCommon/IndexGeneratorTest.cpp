@@ -0,0 +1,198 @@
+// Copyright 2024 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VideoConfig.h"
+
+using OpcodeDecoder::Primitive;
+
+namespace
+{
+constexpr u16 RESTART = UINT16_MAX;
+
+// Straightforward reference versions of the index patterns, one triangle (or strip) at a time.
+std::vector<u16> ReferenceIndices(Primitive primitive, u32 num_verts, u32 index, bool pr)
+{
+  std::vector<u16> out;
+  const auto triangle = [&](u32 a, u32 b, u32 c) {
+    out.push_back(index + a);
+    out.push_back(index + b);
+    out.push_back(index + c);
+    if (pr)
+      out.push_back(RESTART);
+  };
+
+  switch (primitive)
+  {
+  case Primitive::GX_DRAW_TRIANGLES:
+    for (u32 i = 2; i < num_verts; i += 3)
+      triangle(i - 2, i - 1, i);
+    break;
+  case Primitive::GX_DRAW_TRIANGLE_STRIP:
+    if (pr)
+    {
+      for (u32 i = 0; i < num_verts; i++)
+        out.push_back(index + i);
+      out.push_back(RESTART);
+    }
+    else
+    {
+      for (u32 i = 2; i < num_verts; i++)
+      {
+        if (i % 2 == 0)
+          triangle(i - 2, i - 1, i);
+        else
+          triangle(i - 2, i, i - 1);
+      }
+    }
+    break;
+  case Primitive::GX_DRAW_TRIANGLE_FAN:
+  {
+    u32 i = 2;
+    if (pr)
+    {
+      for (; i + 3 <= num_verts; i += 3)
+      {
+        for (u32 v : {i - 1, i, 0u, i + 1, i + 2})
+          out.push_back(index + v);
+        out.push_back(RESTART);
+      }
+      for (; i + 2 <= num_verts; i += 2)
+      {
+        for (u32 v : {i - 1, i, 0u, i + 1})
+          out.push_back(index + v);
+        out.push_back(RESTART);
+      }
+    }
+    for (; i < num_verts; i++)
+      triangle(0, i - 1, i);
+    break;
+  }
+  case Primitive::GX_DRAW_QUADS:
+  {
+    u32 i = 3;
+    for (; i < num_verts; i += 4)
+    {
+      if (pr)
+      {
+        for (u32 v : {i - 2, i - 1, i - 3, i})
+          out.push_back(index + v);
+        out.push_back(RESTART);
+      }
+      else
+      {
+        triangle(i - 3, i - 2, i - 1);
+        triangle(i - 3, i - 1, i);
+      }
+    }
+    if (i == num_verts)
+      triangle(num_verts - 3, num_verts - 2, num_verts - 1);
+    break;
+  }
+  case Primitive::GX_DRAW_POINTS:
+    for (u32 i = 0; i < num_verts; i++)
+      out.push_back(index + i);
+    break;
+  default:
+    break;
+  }
+  return out;
+}
+
+void CheckPrimitive(Primitive primitive, bool pr)
+{
+  g_Config.backend_info.bSupportsPrimitiveRestart = pr;
+  g_Config.backend_info.bSupportsVSLinePointExpand = false;
+
+  IndexGenerator generator;
+  generator.Init();
+
+  // Cover sizes on both sides of every SIMD period, and a base index that isn't a multiple of
+  // the vector width.
+  std::vector<u16> buffer(4096);
+  for (u32 num_verts = 0; num_verts < 130; num_verts++)
+  {
+    constexpr u32 first_verts = 5;
+    generator.Start(buffer.data());
+    generator.AddIndices(Primitive::GX_DRAW_POINTS, first_verts);
+    const u32 first_len = generator.GetIndexLen();
+    generator.AddIndices(primitive, num_verts);
+
+    const std::vector<u16> expected = ReferenceIndices(primitive, num_verts, first_verts, pr);
+    const std::vector<u16> actual(buffer.begin() + first_len,
+                                  buffer.begin() + generator.GetIndexLen());
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(first_verts + num_verts, generator.GetNumVerts());
+  }
+}
+}  // namespace
+
+TEST(IndexGenerator, Triangles)
+{
+  CheckPrimitive(Primitive::GX_DRAW_TRIANGLES, false);
+  CheckPrimitive(Primitive::GX_DRAW_TRIANGLES, true);
+}
+
+TEST(IndexGenerator, TriangleStrip)
+{
+  CheckPrimitive(Primitive::GX_DRAW_TRIANGLE_STRIP, false);
+  CheckPrimitive(Primitive::GX_DRAW_TRIANGLE_STRIP, true);
+}
+
+TEST(IndexGenerator, TriangleFan)
+{
+  CheckPrimitive(Primitive::GX_DRAW_TRIANGLE_FAN, false);
+  CheckPrimitive(Primitive::GX_DRAW_TRIANGLE_FAN, true);
+}
+
+TEST(IndexGenerator, Quads)
+{
+  CheckPrimitive(Primitive::GX_DRAW_QUADS, false);
+  CheckPrimitive(Primitive::GX_DRAW_QUADS, true);
+}
+
+TEST(IndexGenerator, RemappedIndices)
+{
+  for (const bool pr : {false, true})
+  {
+    g_Config.backend_info.bSupportsPrimitiveRestart = pr;
+    g_Config.backend_info.bSupportsVSLinePointExpand = false;
+
+    IndexGenerator generator;
+    generator.Init();
+
+    std::vector<u16> buffer(4096);
+    std::vector<u16> remap(40);
+    for (u32 i = 0; i < remap.size(); i++)
+      remap[i] = static_cast<u16>(i % 7);
+
+    constexpr u32 first_verts = 5;
+    generator.Start(buffer.data());
+    generator.AddIndices(Primitive::GX_DRAW_POINTS, first_verts);
+    const u32 first_len = generator.GetIndexLen();
+    generator.AddRemappedIndices(Primitive::GX_DRAW_TRIANGLE_STRIP, 40, remap.data(), 7);
+
+    std::vector<u16> expected = ReferenceIndices(Primitive::GX_DRAW_TRIANGLE_STRIP, 40, 0, pr);
+    for (u16& index : expected)
+    {
+      if (index != RESTART)
+        index = static_cast<u16>(first_verts + remap[index]);
+    }
+    const std::vector<u16> actual(buffer.begin() + first_len,
+                                  buffer.begin() + generator.GetIndexLen());
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(first_verts + 7, generator.GetNumVerts());
+  }
+}
+
+TEST(IndexGenerator, Points)
+{
+  CheckPrimitive(Primitive::GX_DRAW_POINTS, false);
+  CheckPrimitive(Primitive::GX_DRAW_POINTS, true);
+}
@@ -0,0 +1,97 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "VideoCommon/SharedShaderStore.h"
+
+namespace
+{
+constexpr u32 TYPE = 1;
+
+std::vector<u8> MakeValue(u8 seed, size_t size)
+{
+  std::vector<u8> value(size);
+  for (size_t i = 0; i < size; i++)
+    value[i] = static_cast<u8>(seed + i);
+  return value;
+}
+
+class SharedShaderStoreTest : public testing::Test
+{
+protected:
+  SharedShaderStoreTest() : m_directory(File::CreateTempDir()) {}
+  ~SharedShaderStoreTest() override { File::DeleteDirRecursively(m_directory); }
+
+  void Insert(SharedShaderStore& store, u32 key, const std::vector<u8>& value)
+  {
+    store.Insert(TYPE, &key, sizeof(key), value.data(), static_cast<u32>(value.size()));
+  }
+
+  std::vector<u8> Lookup(SharedShaderStore& store, u32 key)
+  {
+    return store.Lookup(TYPE, &key, sizeof(key));
+  }
+
+  size_t References(const SharedShaderStore& store, u32 key)
+  {
+    return store.GetReferenceCount(TYPE, &key, sizeof(key));
+  }
+
+  std::string m_directory;
+};
+}  // namespace
+
+TEST_F(SharedShaderStoreTest, PersistsAcrossGames)
+{
+  const std::vector<u8> value = MakeValue(1, 64);
+  {
+    SharedShaderStore store;
+    store.Open(m_directory, "GAMEA1", 1 << 20);
+    Insert(store, 42, value);
+    EXPECT_EQ(value, Lookup(store, 42));
+    EXPECT_EQ(1u, References(store, 42));
+  }
+
+  SharedShaderStore store;
+  store.Open(m_directory, "GAMEB1", 1 << 20);
+  EXPECT_EQ(value, Lookup(store, 42));
+  EXPECT_EQ(2u, References(store, 42));
+  EXPECT_EQ(0u, Lookup(store, 43).size());
+
+  // The same bytes under a different type are a different entry.
+  const u32 key = 42;
+  EXPECT_EQ(0u, store.Lookup(TYPE + 1, &key, sizeof(key)).size());
+}
+
+TEST_F(SharedShaderStoreTest, EvictsLeastShared)
+{
+  {
+    SharedShaderStore store;
+    store.Open(m_directory, "GAMEA1", 1000);
+    Insert(store, 1, MakeValue(1, 300));
+    Insert(store, 2, MakeValue(2, 300));
+  }
+  {
+    // Entry 1 is now used by two games, entry 2 by one.
+    SharedShaderStore store;
+    store.Open(m_directory, "GAMEB1", 1000);
+    EXPECT_EQ(300u, Lookup(store, 1).size());
+  }
+
+  SharedShaderStore store;
+  store.Open(m_directory, "GAMEC1", 1000);
+  Insert(store, 3, MakeValue(3, 300));
+  Insert(store, 4, MakeValue(4, 300));
+
+  // Over the limit: entry 2 is the oldest of the single-game entries, so it goes first.
+  EXPECT_LE(store.GetTotalSize(), 1000u);
+  EXPECT_EQ(300u, Lookup(store, 1).size());
+  EXPECT_EQ(0u, Lookup(store, 2).size());
+  EXPECT_EQ(300u, Lookup(store, 4).size());
+}
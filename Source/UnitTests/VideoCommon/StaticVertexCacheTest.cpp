@@ -0,0 +1,81 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <memory>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/StaticVertexCache.h"
+
+namespace
+{
+constexpr u32 SIZE = StaticVertexCache::MIN_VERTEX_DATA_SIZE;
+
+std::unique_ptr<StaticVertexBuffer> MakeBuffer()
+{
+  return std::make_unique<StaticVertexBuffer>();
+}
+}  // namespace
+
+TEST(StaticVertexCache, VertexDataIsInsertedOnceDrawnAgain)
+{
+  StaticVertexCache cache;
+  EXPECT_EQ(cache.Lookup(1, SIZE), nullptr);
+  EXPECT_FALSE(cache.ShouldInsert(1, SIZE));
+  EXPECT_TRUE(cache.ShouldInsert(1, SIZE));
+
+  // Vertex data drawn in the previous frame is inserted as well.
+  EXPECT_FALSE(cache.ShouldInsert(2, SIZE));
+  cache.OnEndFrame();
+  EXPECT_TRUE(cache.ShouldInsert(2, SIZE));
+
+  // But not when it was last drawn before that.
+  EXPECT_FALSE(cache.ShouldInsert(3, SIZE));
+  cache.OnEndFrame();
+  cache.OnEndFrame();
+  EXPECT_FALSE(cache.ShouldInsert(3, SIZE));
+
+  // Small draws are never inserted.
+  EXPECT_FALSE(cache.ShouldInsert(4, SIZE - 1));
+  EXPECT_FALSE(cache.ShouldInsert(4, SIZE - 1));
+}
+
+TEST(StaticVertexCache, LookupMatchesHashAndSize)
+{
+  StaticVertexCache cache;
+  const StaticVertexBuffer* buffer = cache.Insert(1, SIZE, MakeBuffer());
+  EXPECT_EQ(cache.Lookup(1, SIZE), buffer);
+  EXPECT_EQ(cache.Lookup(1, SIZE * 2), nullptr);
+  EXPECT_EQ(cache.Lookup(2, SIZE), nullptr);
+
+  cache.Clear();
+  EXPECT_EQ(cache.Lookup(1, SIZE), nullptr);
+  EXPECT_EQ(cache.GetSize(), 0u);
+}
+
+TEST(StaticVertexCache, LeastRecentlyUsedIsEvicted)
+{
+  StaticVertexCache cache(SIZE * 2);
+  cache.Insert(1, SIZE, MakeBuffer());
+  cache.Insert(2, SIZE, MakeBuffer());
+  EXPECT_NE(cache.Lookup(1, SIZE), nullptr);
+
+  cache.Insert(3, SIZE, MakeBuffer());
+  EXPECT_EQ(cache.GetEntryCount(), 2u);
+  EXPECT_EQ(cache.GetSize(), SIZE * 2);
+  EXPECT_NE(cache.Lookup(1, SIZE), nullptr);
+  EXPECT_EQ(cache.Lookup(2, SIZE), nullptr);
+  EXPECT_NE(cache.Lookup(3, SIZE), nullptr);
+}
+
+TEST(StaticVertexCache, HashDependsOnStride)
+{
+  std::array<u8, 64> data{};
+  data[5] = 0x42;
+  EXPECT_EQ(StaticVertexCache::HashVertexData(data.data(), 64, 16),
+            StaticVertexCache::HashVertexData(data.data(), 64, 16));
+  EXPECT_NE(StaticVertexCache::HashVertexData(data.data(), 64, 16),
+            StaticVertexCache::HashVertexData(data.data(), 64, 32));
+}
@@ -0,0 +1,46 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/VertexDeduplicator.h"
+
+TEST(VertexDeduplicator, IdenticalVerticesAreMerged)
+{
+  // Three bytes per vertex, like an 8-bit position index followed by a 16-bit color index.
+  const std::array<u8, 18> src = {1, 0, 2,  //
+                                  3, 0, 4,  //
+                                  1, 0, 2,  //
+                                  1, 0, 5,  //
+                                  3, 0, 4,  //
+                                  1, 0, 2};
+
+  VertexDeduplicator deduplicator;
+  ASSERT_EQ(deduplicator.Run(src.data(), 3, 6), 3u);
+
+  const std::vector<u16> remap(deduplicator.GetRemap(), deduplicator.GetRemap() + 6);
+  EXPECT_EQ(remap, (std::vector<u16>{0, 1, 0, 2, 1, 0}));
+
+  const std::vector<u8> unique(deduplicator.GetUniqueVertices(),
+                               deduplicator.GetUniqueVertices() + 9);
+  EXPECT_EQ(unique, (std::vector<u8>{1, 0, 2, 3, 0, 4, 1, 0, 5}));
+}
+
+TEST(VertexDeduplicator, DistinctVerticesAreKept)
+{
+  std::vector<u8> src(2 * 1000);
+  for (u32 i = 0; i < 1000; i++)
+  {
+    src[i * 2] = static_cast<u8>(i);
+    src[i * 2 + 1] = static_cast<u8>(i >> 8);
+  }
+
+  VertexDeduplicator deduplicator;
+  ASSERT_EQ(deduplicator.Run(src.data(), 2, 1000), 1000u);
+  for (u32 i = 0; i < 1000; i++)
+    EXPECT_EQ(deduplicator.GetRemap()[i], i);
+}